@@ -5,10 +5,18 @@ struct buf {
   uint blockno;
   struct sleeplock lock;
   uint refcnt;
-  struct buf *prev; // LRU cache list
+  struct buf *prev; // LRU list of unreferenced buffers
   struct buf *next;
+  struct buf *hnext; // hash bucket chain
+  struct buf *dprev; // delayed writes, oldest first
+  struct buf *dnext;
   struct buf *qnext; // disk queue
-  uchar data[BSIZE];
+  uint qtime;        // ticks when queued
+  void (*iodone)(struct buf *); // called when a B_ASYNC request completes
+  uchar *mem;  // BSIZE bytes in a page owned by the buffer cache
+  uchar *data; // mem, or the block itself on a memory disk (B_MAPPED)
 };
 #define B_VALID 0x2 // buffer has been read from disk
 #define B_DIRTY 0x4 // buffer needs to be written to disk
+#define B_ASYNC 0x8 // request started by idesubmit, nobody sleeping in iderw
+#define B_MAPPED 0x10 // data points into the memory disk; read only
@@ -164,6 +164,9 @@
     (typeof(x))(((_x) / _y) * _y);                                             \
   })
 
+/* index of the lowest set bit of x, which must not be 0 */
+#define ctz64(x) __builtin_ctzll(x)
+
 /* types */
 typedef uintptr_t physaddr_t;
 typedef uintptr_t register_t;
@@ -6,6 +6,7 @@ struct buf;
 struct context;
 struct extent;
 struct inode;
+struct kmcache;
 struct proc;
 struct rtcdate;
 struct spinlock;
@@ -24,6 +25,10 @@ extern int pages_in_swap;
 extern int free_pages;
 extern int num_page_faults;
 extern int num_disk_reads;
+extern int num_io_requests;
+extern int num_io_merges;
+extern int io_queue_depth;
+extern int max_io_queue_depth;
 
 extern int crashn_enable;
 extern int crashn;
@@ -47,8 +52,23 @@ extern int crashn;
 // bio.c
 void binit(void);
 struct buf *bread(uint, uint);
+struct buf *bread_ro(uint, uint);
+void breadn(uint, uint, int, struct buf **);
 void brelse(struct buf *);
 void bwrite(struct buf *);
+void bwritev(struct buf **, int);
+void bdwrite(struct buf *);
+void bsync(void);
+void bsyncrange(uint, uint, uint);
+void bprefetch(uint, uint);
+struct buf *bread_async(uint, uint);
+struct buf *bwait(struct buf *);
+void bdone(struct buf *);
+void bpin(struct buf *);
+void bunpin(struct buf *);
+void bundelay(struct buf *);
+void bflusher(void);
+int bshrink(void);
 void print_data_at_block(uint);
 
 // console.c
@@ -74,15 +94,29 @@ struct inode *namei(char *);
 struct inode *nameiparent(char *, char *);
 int concurrent_readi(struct inode *, char *, uint, uint);
 int readi(struct inode *, char *, uint, uint);
+int readi_ra(struct inode *, char *, uint, uint, uint *, uint *);
 void concurrent_stati(struct inode *, struct stat *);
 void stati(struct inode *, struct stat *);
 int concurrent_writei(struct inode *, char *, uint, uint);
 int writei(struct inode *, char *, uint, uint);
+void isync(struct inode *);
+void iupdate(struct inode *);
 
 // ide.c
 void ideinit(void);
 void ideintr(void);
 void iderw(struct buf *);
+void idesubmit(struct buf *);
+void idewaitbuf(struct buf *);
+uchar *idemap(struct buf *);
+void iderwv(struct buf **, int);
+
+// iosched.c
+void ioschedadd(struct buf **, int, struct buf *);
+struct buf *ioschednext(struct buf **);
+void ioschedstart(int);
+void ioscheddone(int);
+int ioschedset(char *);
 
 // ioapic.c
 void ioapicenable(int irq, int cpu);
@@ -94,11 +128,20 @@ struct core_map_entry *pa2page(uint64_t pa);
 void detect_memory(void);
 char *kalloc(void);
 void kfree(char *);
+char *kalloc_order(int);
+void kfree_order(char *, int);
+char *kalloc_zeroed(void);
+void kzerofill(void);
 void mem_init(void *);
 void mark_user_mem(uint64_t, uint64_t);
 void mark_kernel_mem(uint64_t);
 struct core_map_entry *get_random_user_page();
-void cmap_lock_init(void);
+
+// kmalloc.c
+struct kmcache *kmcache_create(char *, uint);
+void *kmcache_alloc(struct kmcache *);
+void kmcache_free(struct kmcache *, void *);
+void kmallocinit(void);
 
 // kbd.c
 void kbdintr(void);
@@ -112,10 +155,25 @@ void lapicinit(void);
 void lapicstartap(uchar, uint);
 void microdelay(int);
 
+// log.c
+void initlog(int dev, struct superblock *sb);
+void log_write(struct buf *);
+void begin_op(void);
+void end_op(void);
+
 // mp.c
 extern int ismp;
 void mpinit(void);
 
+// virtio.c
+extern int virtioirq;
+int virtioinit(void);
+void virtiointr(void);
+void virtiorw(struct buf *);
+void virtiorwv(struct buf **, int);
+void virtiosubmit(struct buf *);
+void virtiowait(struct buf *);
+
 // vspace.c
 void                vspacebootinit(void);
 int                 vspaceinit(struct vspace *);
@@ -144,6 +202,12 @@ void                vspacetordonly(struct vspace *);
 void picenable(int);
 void picinit(void);
 
+// pci.c
+uint pciconfread(int, int, int, int);
+void pciconfwrite(int, int, int, int, uint);
+int pcifindclass(int, int, int *, int *, int *);
+int pcifindid(int, int, int *, int *, int *);
+
 // proc.c
 void exit(void);
 int fork(void);
@@ -159,6 +223,7 @@ int wait(void);
 void wakeup(void *);
 void yield(void);
 void reboot(void);
+void kthread(char *, void (*)(void));
 void update_rip(uint64_t);
 void update_rdi(uint64_t new_rdi);
 void update_rsp(uint64_t new_rsp);
@@ -179,6 +244,7 @@ void popcli(void);
 
 // sleeplock.c
 void acquiresleep(struct sleeplock *);
+int tryacquiresleep(struct sleeplock *);
 void releasesleep(struct sleeplock *);
 int holdingsleep(struct sleeplock *);
 void initsleeplock(struct sleeplock *, char *);
@@ -203,6 +269,11 @@ int fetchint64_t(uint64_t, int64_t *);
 int fetchstr(uint64_t, char **);
 void syscall(void);
 
+// trace.c
+void traceinit(void);
+void tracerec(int, int, char *, ...);
+void tracedump(void);
+
 // trap.c
 void idtinit(void);
 extern uint ticks;
@@ -235,15 +306,12 @@ struct file_info {
   int permissions;
   int is_pipe; //0 if refers to inode, 1 if refers to pipe
   char* ref_pipe;
+  uint ra_next;   //offset a sequential read would start at
+  uint ra_window; //blocks to read ahead of it
 };
 
 extern int first_file_allocated;
 
-//helps for updating file records,
-//at this point all files have
-//contiguous extents, but from
-//here on out that could change...
-extern int updated_extra_extents_flag;
 
 //struct ftable {
  // struct file_info data[16]; // <--- this 16 comes from NFILE, but I didn't want to redefine NFILE in case it clashes
@@ -257,7 +325,6 @@ extern struct file_info global_file_info_array[];
 extern struct spinlock global_ftable_lock;
 
 
-extern struct spinlock cmap_lock;
 
 
 //sysfile.c
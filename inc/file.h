@@ -9,6 +9,7 @@ struct inode {
   uint inum; // Inode number
   int ref;   // Reference count
   int valid; // Flag for if node is valid
+  int dirty; // Changed since read, unlocki writes it back
   struct sleeplock lock;
 
   short type; // copy of disk inode
@@ -17,6 +18,13 @@ struct inode {
   struct extent data;
   int extra_extents_blk_nums[28];
 //  int extra_extent_start_num;
+
+  uint ra_next;   // read-ahead state for readi callers,
+  uint ra_window; // see readahead()
+
+  struct inode *hnext; // icache hash chain
+  struct inode *lprev; // icache LRU list, while ref is 0
+  struct inode *lnext;
 };
 
 //struct file_info {
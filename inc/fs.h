@@ -11,7 +11,7 @@
 
 
 // Disk layout:
-// [ boot block | super block | free bit map |
+// [ boot block | super block | log | free bit map |
 //                                          inode file | data blocks]
 //
 // mkfs computes the super block and builds an initial file system. The
@@ -21,6 +21,8 @@ struct superblock {
   uint nblocks;    // Number of data blocks
   uint bmapstart;  // Block number of first free map block
   uint inodestart; // Block number of the start of inode file
+  uint nlog;       // Number of log blocks
+  uint logstart;   // Block number of first log block
 };
 
 // On-disk inode structure
@@ -35,6 +37,15 @@ struct dinode {
                               //basically blocks are assumed contiguous until dealing with extra blocks
 };
 
+// Once data is full a file grows into extra extents, kept in
+// extra_extents_blk_nums as (startblkno, nblocks) pairs: extra
+// extent i is at [2*i] and [2*i+1].  [XEXTCOUNT] is the number in
+// use; 0 and -1 both mean none.
+#define NXEXTENT 13
+#define XEXTCOUNT 27
+#define XSTART(ip, i) ((ip)->extra_extents_blk_nums[2 * (i)])
+#define XNBLOCKS(ip, i) ((ip)->extra_extents_blk_nums[2 * (i) + 1])
+
 // offset of inode in inodefile
 #define INODEOFF(inum) ((inum) * sizeof(struct dinode))
 
@@ -155,6 +155,9 @@ struct core_map_entry {
   int ref_count;
   short user;   // 0 if kernel allocated memory, otherwise is user
   uint64_t va;  // if it is used by kernel only, this field is 0
+  short order;  // free block order if this is a free block's first page, else -1
+  struct core_map_entry *next; // free list of order, while available
+  struct core_map_entry *prev;
 };
 
 #endif
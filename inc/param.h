@@ -5,14 +5,31 @@
 #define NCPU 8         // maximum number of CPUs
 #define NOFILE 16      // open files per process
 #define NFILE 100      // open files per system
-#define NINODE 50      // maximum number of active i-nodes
+#define NINODE 200     // maximum number of cached i-nodes
+#define NIHASH 64      // inode cache hash buckets
 #define NDEV 10        // maximum major device number
 #define ROOTDEV 1      // device number of file system root disk
 #define MAXARG 32      // max exec arguments
-#define MAXOPBLOCKS 10 // max # of blocks any FS op writes
+#define MAXOPBLOCKS 12 // max # of blocks any FS op writes
 
 #define LOGSIZE (MAXOPBLOCKS * 3) // max data blocks in on-disk log
-#define NBUF (MAXOPBLOCKS * 3)    // size of disk block cache
+#define NBUF (MAXOPBLOCKS * 3)    // minimum size of disk block cache
+#define NBUFMAX 1024              // maximum size of disk block cache
+#define BUFLOWPAGES 256           // shrink block cache below this many free pages
+#define BFLUSHTICKS 100           // ticks between write-backs of delayed writes
+#define BCLUSTER 16               // max blocks read by one breadn
+#define RAMAXBLOCKS 32            // max blocks read ahead of a sequential reader
+#define IOSCHED "cscan"           // disk request scheduler, see iosched.c
+#define IOREADDEADLINE 10         // ticks before a queued read jumps the queue
 #define FSSIZE 100000             // size of file system in blocks
+#define FILEBLOCKS 20             // blocks allocated to a new file
+#define MAXINODES 4096            // max inodes in the inode file
+#define KMAXORDER 10              // largest kalloc_order block is 2^KMAXORDER pages
+#define NZEROPAGES 32             // pre-zeroed pages the idle loop keeps ready
+#define NFREEEXT 512              // free extents the block allocator tracks
+#define NDIRINDEX 4               // directories with an in-memory name index
+#define NDIRHENT 1024             // names across all directory indexes
+#define NDENTRY 64                // path components namex remembers
+#define NTRACE 256                // events kept by the trace ring buffer
 #define MAXCODEPAGES 256
 #define MAXPATHLEN 20
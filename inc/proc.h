@@ -88,6 +88,7 @@ struct proc {
   void *chan;                  // If non-zero, sleeping on chan
   int killed;                  // If non-zero, have been killed
   char name[16];               // Process name (debugging)
+  void (*kfn)(void);           // Kernel thread's function, see kthread
   int stack_page_count;
   int heap_cursor;
   int lower_lim_heap_cursor;
@@ -6,4 +6,8 @@ struct sys_info {
   int free_pages;
   int num_page_faults;
   int num_disk_reads;
+  int num_io_requests;    // disk commands issued
+  int num_io_merges;      // bufs merged into another buf's command
+  int io_queue_depth;     // bufs waiting for or in the disk now
+  int max_io_queue_depth; // most bufs ever queued at once
 };
@@ -0,0 +1,49 @@
+#pragma once
+
+// Kernel trace points.
+//
+//   trace(TR_FS, TL_DEBUG, "readi: block %d", b);
+//
+// records an event in an in-memory ring buffer, which Control-T on
+// the console dumps.  Which trace points exist is decided at compile
+// time: one is compiled in only if its level is at most TRACE_LEVEL
+// and its subsystem is in TRACE_MASK, so the default build has none.
+// Set them through make, e.g.
+//
+//   make qemu TRACE_LEVEL=3 TRACE_MASK=0x1
+//
+// With TRACE_CONSOLE=1 events are also printed as they happen.
+//
+// An event keeps its format and up to TRACEARGS arguments, not the
+// formatted text, so %s arguments must outlive the event.
+
+// Subsystems
+#define TR_FS 0x1      // file system
+#define TR_BIO 0x2     // buffer cache and disk
+#define TR_SYSCALL 0x4 // system call arguments and errors
+#define TR_VM 0x8      // address spaces and heap
+
+// Levels
+#define TL_ERROR 1
+#define TL_INFO 2
+#define TL_DEBUG 3
+
+#ifndef TRACE_LEVEL
+#define TRACE_LEVEL 0
+#endif
+#ifndef TRACE_MASK
+#define TRACE_MASK 0xffff
+#endif
+#ifndef TRACE_CONSOLE
+#define TRACE_CONSOLE 0
+#endif
+
+#define TRACE_ON(sys, level) (((sys) & TRACE_MASK) && (level) <= TRACE_LEVEL)
+
+// A disabled trace point is constant-folded away, but its arguments
+// are still type checked.
+#define trace(sys, level, ...)                                                 \
+  do {                                                                         \
+    if (TRACE_ON(sys, level))                                                  \
+      tracerec(sys, level, __VA_ARGS__);                                       \
+  } while (0)
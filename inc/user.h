@@ -28,6 +28,8 @@ int sleep(int);
 int uptime(void);
 int sysinfo(struct sys_info *);
 int crashn(int);
+int sync(void);
+int fsync(int);
 
 // ulib.c
 int stat(char *, struct stat *);
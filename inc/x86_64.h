@@ -18,6 +18,20 @@ static inline void insl(int port, void *addr, int cnt) {
                : "memory", "cc");
 }
 
+static inline ushort inw(ushort port) {
+  ushort data;
+
+  asm volatile("in %1,%0" : "=a"(data) : "d"(port));
+  return data;
+}
+
+static inline uint inl(ushort port) {
+  uint data;
+
+  asm volatile("in %1,%0" : "=a"(data) : "d"(port));
+  return data;
+}
+
 static inline void outb(ushort port, uchar data) {
   asm volatile("out %0,%1" : : "a"(data), "d"(port));
 }
@@ -26,6 +40,10 @@ static inline void outw(ushort port, ushort data) {
   asm volatile("out %0,%1" : : "a"(data), "d"(port));
 }
 
+static inline void outl(ushort port, uint data) {
+  asm volatile("out %0,%1" : : "a"(data), "d"(port));
+}
+
 static inline void outsl(int port, const void *addr, int cnt) {
   asm volatile("cld; rep outsl"
                : "=S"(addr), "=c"(cnt)
@@ -1,13 +1,19 @@
 // Buffer cache.
 //
-// The buffer cache is a linked list of buf structures holding
+// The buffer cache is a hash table of buf structures holding
 // cached copies of disk block contents.  Caching disk blocks
 // in memory reduces the number of disk reads and also provides
 // a synchronization point for disk blocks used by multiple processes.
 //
 // Interface:
 // * To get a buffer for a particular disk block, call bread.
-// * After changing buffer data, call bwrite to write it to disk.
+// * After changing buffer data, call bwrite to write it to disk
+//     now, or bdwrite to leave it dirty in the cache and have it
+//     written back later.
+// * A caller that will only look at the data can use bread_ro
+//     (or breadn) instead.  On the memory disk the buffer then
+//     points straight at the block in the disk image, and is only
+//     copied if a later bread wants to change it.
 // * When done with the buffer, call brelse.
 // * Do not use the buffer after calling brelse.
 // * Only one process at a time can use a buffer,
@@ -17,80 +23,568 @@
 // * B_VALID: the buffer data has been read from the disk.
 // * B_DIRTY: the buffer data has been modified
 //     and needs to be written to disk.
+// * B_MAPPED: the buffer data is the memory disk's copy of the
+//     block, not the buffer's own memory, and must not be changed.
+//
+// Delayed writes:
+// * bdwrite puts a buffer on the dirty list, which is kept in the
+//     order buffers were first dirtied.  Dirty buffers are never
+//     recycled; they are written back oldest first by the bflush
+//     kernel thread every BFLUSHTICKS ticks, by bsync (the sync and
+//     fsync system calls), or by bget when every idle buffer is dirty.
+// * Write-back goes out in batches of up to BFLUSHBATCH buffers, and
+//     breadn reads a run of blocks in one batch, so the disk driver
+//     can merge consecutive blocks into one request.
+// * bwrite still writes synchronously; use it (or bsync) where a
+//     block must be on disk before the caller goes on.
+// * crashn counts writes that actually reach the disk.
+//
+// Asynchronous reads:
+// * bread_async starts reading a block and returns the locked
+//     buffer at once; bwait sleeps until the data is there.  A
+//     caller can start several reads and then wait for each, as
+//     the log does for a commit's blocks.
+// * A buffer may instead carry an iodone callback, which the
+//     driver runs from its interrupt handler (holding its own
+//     lock, so it must not sleep) when the request completes.
+// * bprefetch starts reading a block with a callback that drops
+//     the buffer; a bread of the block meanwhile simply waits for
+//     the lock.  It only uses a clean idle buffer, and skips the
+//     block if there is none.
+//
+// Locking:
+// * Each hash bucket has its own spinlock, which protects the
+//     bucket's chain and the refcnt of every buffer on it, so
+//     cache hits on different blocks do not contend.
+// * bcache.lrulock protects the LRU list of unreferenced buffers
+//     and the dirty list.
+// * bcache.lock serializes misses: only the holder may change a
+//     buffer's (dev, blockno), so a block is never cached twice.
+// Lock order is bcache.lock, then a bucket lock, then bcache.lrulock.
+//
+// The cache is not a fixed array.  Buffers are allocated in chunks
+// whose block data lives in pages taken from kalloc.  On a miss the
+// cache grows by a chunk while memory is plentiful, up to NBUFMAX
+// buffers, and hands idle chunks back once free_pages drops below
+// BUFLOWPAGES (or kalloc runs dry), never going below NBUF buffers.
 
 #include <cdefs.h>
 #include <defs.h>
 #include <fs.h>
+#include <mmu.h>
 #include <param.h>
 #include <sleeplock.h>
 #include <spinlock.h>
 
 #include <buf.h>
 
+#define NBUCKET 13
+#define BHASH(dev, blockno) ((((dev) << 27) | (blockno)) % NBUCKET)
+
+// Number of data pages backing each chunk of buffers.
+#define BCHUNKPAGES 2
+#define BPERCHUNK (BCHUNKPAGES * PGSIZE / BSIZE)
+
+// Most delayed writes handled per pass over the dirty list.
+#define BFLUSHBATCH 8
+
 int crashn_enable = 0;
 int crashn = 0;
 
 int num_disk_reads = 0;
 
+struct bucket {
+  struct spinlock lock;
+  struct buf *head; // chain through hnext
+};
+
+// A chunk of buffers.  The chunk itself occupies one page and
+// its buffers' data occupies BCHUNKPAGES more.
+struct bchunk {
+  struct buf buf[BPERCHUNK];
+  uchar *pages[BCHUNKPAGES];
+  struct bchunk *next;
+};
+
 struct {
   struct spinlock lock;
-  struct buf buf[NBUF];
+  struct spinlock lrulock;
+  struct bucket bucket[NBUCKET];
+  struct bchunk *chunks;
+  int nbuf;
 
-  // Linked list of all buffers, through prev/next.
-  // head.next is most recently used.
+  // Linked list of unreferenced buffers, through prev/next.
+  // head.next is most recently used, head.prev is the next victim.
   struct buf head;
+
+  // Linked list of delayed writes, through dprev/dnext.
+  // dhead.dnext was dirtied first.
+  struct buf dhead;
+  int ndirty;
 } bcache;
 
-void binit(void) {
+static struct bucket *bbucket(uint dev, uint blockno) {
+  return &bcache.bucket[BHASH(dev, blockno)];
+}
+
+// Unlink b from the LRU list.  Caller must hold bcache.lrulock.
+static void lruremove(struct buf *b) {
+  b->next->prev = b->prev;
+  b->prev->next = b->next;
+  b->next = b->prev = 0;
+}
+
+// Insert b at the most recently used end of the LRU list.
+// Caller must hold bcache.lrulock.
+static void lrupush(struct buf *b) {
+  b->next = bcache.head.next;
+  b->prev = &bcache.head;
+  bcache.head.next->prev = b;
+  bcache.head.next = b;
+}
+
+// Append b to the dirty list unless it is already on it.
+// Caller must hold bcache.lrulock.
+static void dirtypush(struct buf *b) {
+  if (b->dnext)
+    return;
+  b->dnext = &bcache.dhead;
+  b->dprev = bcache.dhead.dprev;
+  bcache.dhead.dprev->dnext = b;
+  bcache.dhead.dprev = b;
+  bcache.ndirty++;
+}
+
+// Take b off the dirty list if it is on it.
+// Caller must hold bcache.lrulock.
+static void dirtyremove(struct buf *b) {
+  if (b->dnext == 0)
+    return;
+  b->dnext->dprev = b->dprev;
+  b->dprev->dnext = b->dnext;
+  b->dnext = b->dprev = 0;
+  bcache.ndirty--;
+}
+
+// Free a chunk and its data pages.
+static void bfreechunk(struct bchunk *c) {
+  int i;
+
+  for (i = 0; i < BCHUNKPAGES; i++)
+    if (c->pages[i])
+      kfree((char *)c->pages[i]);
+  kfree((char *)c);
+}
+
+// Add a chunk of buffers to the cache.  The new buffers start out
+// unreferenced and unhashed on the LRU list.  Caller must hold
+// bcache.lock.  Returns 0 if there is no memory to grow.
+static int bgrow(void) {
+  struct bchunk *c;
   struct buf *b;
+  int i;
+
+  if ((c = (struct bchunk *)kalloc()) == 0)
+    return 0;
+  memset(c, 0, sizeof(*c));
+  for (i = 0; i < BCHUNKPAGES; i++) {
+    if ((c->pages[i] = (uchar *)kalloc()) == 0) {
+      bfreechunk(c);
+      return 0;
+    }
+  }
+
+  for (i = 0; i < BPERCHUNK; i++) {
+    b = &c->buf[i];
+    initsleeplock(&b->lock, "buffer");
+    b->mem = c->pages[i * BSIZE / PGSIZE] + (i * BSIZE) % PGSIZE;
+    b->data = b->mem;
+    acquire(&bcache.lrulock);
+    lrupush(b);
+    release(&bcache.lrulock);
+  }
+  c->next = bcache.chunks;
+  bcache.chunks = c;
+  bcache.nbuf += BPERCHUNK;
+  return 1;
+}
+
+void binit(void) {
+  int i;
+
+  if (sizeof(struct bchunk) > PGSIZE)
+    panic("binit: bchunk too big");
 
   initlock(&bcache.lock, "bcache");
+  initlock(&bcache.lrulock, "bcache.lru");
+  for (i = 0; i < NBUCKET; i++) {
+    initlock(&bcache.bucket[i].lock, "bcache.bucket");
+    bcache.bucket[i].head = 0;
+  }
 
-  // Create linked list of buffers
   bcache.head.prev = &bcache.head;
   bcache.head.next = &bcache.head;
-  for (b = bcache.buf; b < bcache.buf + NBUF; b++) {
-    b->next = bcache.head.next;
-    b->prev = &bcache.head;
-    initsleeplock(&b->lock, "buffer");
-    bcache.head.next->prev = b;
-    bcache.head.next = b;
+  bcache.dhead.dprev = &bcache.dhead;
+  bcache.dhead.dnext = &bcache.dhead;
+
+  acquire(&bcache.lock);
+  while (bcache.nbuf < NBUF)
+    if (!bgrow())
+      panic("binit: no memory for buffers");
+  release(&bcache.lock);
+}
+
+// Find the cached buffer for (dev, blockno) in bkt and take a
+// reference to it.  Caller must hold bkt->lock.
+static struct buf *bfind(struct bucket *bkt, uint dev, uint blockno) {
+  struct buf *b;
+
+  for (b = bkt->head; b; b = b->hnext) {
+    if (b->dev == dev && b->blockno == blockno) {
+      if (b->refcnt++ == 0) {
+        acquire(&bcache.lrulock);
+        lruremove(b);
+        release(&bcache.lrulock);
+      }
+      return b;
+    }
+  }
+  return 0;
+}
+
+// Claim b for reuse if it is unreferenced and clean: take it out
+// of its hash bucket and off the LRU list, and give it refcnt 1.
+// Caller must hold bcache.lock, so b's (dev, blockno) is stable.
+// Returns 0 if b is in use.
+static int bclaim(struct buf *b) {
+  struct buf **pp;
+  struct bucket *bkt;
+
+  bkt = bbucket(b->dev, b->blockno);
+  acquire(&bkt->lock);
+  if (b->refcnt != 0 || (b->flags & B_DIRTY)) {
+    release(&bkt->lock);
+    return 0;
+  }
+  for (pp = &bkt->head; *pp; pp = &(*pp)->hnext) {
+    if (*pp == b) {
+      *pp = b->hnext;
+      break;
+    }
   }
+  b->hnext = 0;
+  acquire(&bcache.lrulock);
+  lruremove(b);
+  release(&bcache.lrulock);
+  b->refcnt = 1;
+  release(&bkt->lock);
+  return 1;
+}
+
+// Undo bclaim, leaving b unhashed and empty on the LRU list.
+static void bunclaim(struct buf *b) {
+  b->flags = 0;
+  b->refcnt = 0;
+  acquire(&bcache.lrulock);
+  lrupush(b);
+  release(&bcache.lrulock);
+}
+
+// Take the least recently used clean buffer out of the cache,
+// returning it with refcnt 1.  Caller must hold bcache.lock.
+// Returns 0 if every buffer is busy.
+static struct buf *brecycle(void) {
+  struct buf *b;
+
+  for (;;) {
+    acquire(&bcache.lrulock);
+    for (b = bcache.head.prev; b != &bcache.head; b = b->prev)
+      if ((b->flags & B_DIRTY) == 0)
+        break;
+    release(&bcache.lrulock);
+    if (b == &bcache.head)
+      return 0;
+
+    // A cache hit may have referenced b after we dropped the lru
+    // lock; if so it is off the list now and we look again.
+    if (bclaim(b))
+      return b;
+  }
+}
+
+// Free one chunk whose buffers are all idle.  Caller must hold
+// bcache.lock.  Returns 1 if memory was given back.
+static int bshrinklocked(void) {
+  struct bchunk *c, **pc;
+  int n;
+
+  for (pc = &bcache.chunks; (c = *pc) != 0; pc = &c->next) {
+    if (bcache.nbuf - BPERCHUNK < NBUF)
+      break;
+    for (n = 0; n < BPERCHUNK; n++)
+      if (!bclaim(&c->buf[n]))
+        break;
+    if (n == BPERCHUNK) {
+      *pc = c->next;
+      bcache.nbuf -= BPERCHUNK;
+      bfreechunk(c);
+      return 1;
+    }
+    while (n-- > 0)
+      bunclaim(&c->buf[n]);
+  }
+  return 0;
+}
+
+// Give memory held by idle buffers back to the page allocator.
+// Called by kalloc when it runs out of pages.  Returns 1 if any
+// page was freed.
+int bshrink(void) {
+  int r;
+
+  // kalloc may be called from bgrow with bcache.lock held.
+  if (holding(&bcache.lock))
+    return 0;
+
+  acquire(&bcache.lock);
+  r = bshrinklocked();
+  release(&bcache.lock);
+  return r;
+}
+
+// Drop a reference to b taken by bfind or bget.
+// Move to the head of the MRU list once unreferenced.
+static void bput(struct buf *b) {
+  struct bucket *bkt;
+
+  bkt = bbucket(b->dev, b->blockno);
+  acquire(&bkt->lock);
+  b->refcnt--;
+  if (b->refcnt == 0) {
+    // no one is waiting for it.
+    acquire(&bcache.lrulock);
+    lrupush(b);
+    release(&bcache.lrulock);
+  }
+  release(&bkt->lock);
+}
+
+// Count one disk write toward crashn, rebooting at the crash point.
+// pending[0..n) are locked buffers the caller has prepared to write
+// before this one; they go to disk first.
+static void bcrashpoint(struct buf **pending, int n) {
+  if (crashn_enable) {
+    crashn--;
+    if (crashn < 0) {
+      iderwv(pending, n);
+      reboot();
+    }
+  }
+}
+
+// Prepare locked b to be written to disk.
+static void bwriteprep(struct buf *b) {
+  acquire(&bcache.lrulock);
+  dirtyremove(b);
+  release(&bcache.lrulock);
+  b->flags |= B_DIRTY;
+}
+
+// Collect the identities of up to n of the oldest delayed writes.
+// If idle is set, only consider unreferenced buffers.
+static int bdirty(uint *dev, uint *blockno, int n, int idle) {
+  struct buf *b;
+  int i;
+
+  i = 0;
+  acquire(&bcache.lrulock);
+  for (b = bcache.dhead.dnext; b != &bcache.dhead && i < n; b = b->dnext) {
+    if (idle && b->refcnt != 0)
+      continue;
+    dev[i] = b->dev;
+    blockno[i] = b->blockno;
+    i++;
+  }
+  release(&bcache.lrulock);
+  return i;
+}
+
+// Write back the cached copies of n blocks that are still dirty, in
+// one batch so the driver can cluster runs of consecutive blocks.
+// Once the batch holds a buffer, give up on buffers someone else
+// holds rather than sleep with locks held; if wait is not set, do
+// that for the first buffer too.  Returns the number written.
+static int bflushv(uint *dev, uint *blockno, int n, int wait) {
+  struct buf *bs[BFLUSHBATCH];
+  struct bucket *bkt;
+  struct buf *b;
+  int i, nb;
+
+  nb = 0;
+  for (i = 0; i < n; i++) {
+    bkt = bbucket(dev[i], blockno[i]);
+    acquire(&bkt->lock);
+    b = bfind(bkt, dev[i], blockno[i]);
+    release(&bkt->lock);
+    if (b == 0)
+      continue; // written back and recycled since
+
+    if (wait && nb == 0)
+      acquiresleep(&b->lock);
+    else if (!tryacquiresleep(&b->lock)) {
+      bput(b);
+      continue;
+    }
+    // Skip b if it was written back meanwhile, or if the log has
+    // taken it over (see bundelay); the buffer lock keeps b's place
+    // on the dirty list from changing.
+    if (!(b->flags & B_DIRTY) || b->dnext == 0) {
+      releasesleep(&b->lock);
+      bput(b);
+      continue;
+    }
+    bcrashpoint(bs, nb);
+    bwriteprep(b);
+    bs[nb++] = b;
+  }
+
+  iderwv(bs, nb);
+  for (i = 0; i < nb; i++) {
+    releasesleep(&bs[i]->lock);
+    bput(bs[i]);
+  }
+  return nb;
+}
+
+// Write back some idle delayed writes so bget has a buffer to
+// recycle.  The caller may hold buffers of its own, so never sleep
+// on a buffer lock.  Returns the number of buffers written.
+static int bevict(void) {
+  uint dev[BFLUSHBATCH], blockno[BFLUSHBATCH];
+  int n;
+
+  n = bdirty(dev, blockno, BFLUSHBATCH, 1);
+  return bflushv(dev, blockno, n, 0);
 }
 
 // Look through buffer cache for block on device dev.
 // If not found, allocate a buffer.
 // In either case, return locked buffer.
 static struct buf *bget(uint dev, uint blockno) {
+  struct bucket *bkt;
   struct buf *b;
 
-  acquire(&bcache.lock);
+  bkt = bbucket(dev, blockno);
 
   // Is the block already cached?
-  for (b = bcache.head.next; b != &bcache.head; b = b->next) {
-    if (b->dev == dev && b->blockno == blockno) {
-      b->refcnt++;
-      release(&bcache.lock);
-      acquiresleep(&b->lock);
-      return b;
-    }
+  acquire(&bkt->lock);
+  b = bfind(bkt, dev, blockno);
+  release(&bkt->lock);
+  if (b) {
+    acquiresleep(&b->lock);
+    return b;
   }
 
-  // Not cached; recycle some unused buffer and clean buffer
-  // "clean" because B_DIRTY and not locked means log.c
-  // hasn't yet committed the changes to the buffer.
-  for (b = bcache.head.prev; b != &bcache.head; b = b->prev) {
-    if (b->refcnt == 0 && (b->flags & B_DIRTY) == 0) {
-      b->dev = dev;
-      b->blockno = blockno;
-      b->flags = 0;
-      b->refcnt = 1;
+  // Not cached.  Recheck under bcache.lock, since another process
+  // may have brought the block in after we dropped the bucket lock.
+  acquire(&bcache.lock);
+  for (;;) {
+    acquire(&bkt->lock);
+    b = bfind(bkt, dev, blockno);
+    release(&bkt->lock);
+    if (b) {
       release(&bcache.lock);
       acquiresleep(&b->lock);
       return b;
     }
+
+    // Size the cache to the memory that is free right now.
+    if (free_pages < BUFLOWPAGES)
+      bshrinklocked();
+    else if (bcache.nbuf < NBUFMAX)
+      bgrow();
+
+    // Recycle some unused buffer and clean buffer
+    // "clean" because B_DIRTY and not locked means its
+    // delayed write hasn't reached the disk yet.
+    if ((b = brecycle()) != 0 || (bgrow() && (b = brecycle()) != 0))
+      break;
+
+    // Every idle buffer is dirty.  Write some back (which sleeps,
+    // so without bcache.lock) and look again.
+    release(&bcache.lock);
+    if (bevict() == 0)
+      panic("bget: no buffers");
+    acquire(&bcache.lock);
+  }
+  b->dev = dev;
+  b->blockno = blockno;
+  b->flags = 0;
+  b->data = b->mem;
+
+  acquire(&bkt->lock);
+  b->hnext = bkt->head;
+  bkt->head = b;
+  release(&bkt->lock);
+
+  release(&bcache.lock);
+  acquiresleep(&b->lock);
+  return b;
+}
+
+// Like bget for a block that is not cached, but only ever takes a
+// clean idle buffer: never grows the cache, writes anything back or
+// sleeps.  Returns 0 if the block is cached or no buffer is idle.
+static struct buf *bgetidle(uint dev, uint blockno) {
+  struct bucket *bkt;
+  struct buf *b;
+
+  bkt = bbucket(dev, blockno);
+  acquire(&bcache.lock);
+  acquire(&bkt->lock);
+  for (b = bkt->head; b; b = b->hnext)
+    if (b->dev == dev && b->blockno == blockno)
+      break;
+  release(&bkt->lock);
+  if (b || (b = brecycle()) == 0) {
+    release(&bcache.lock);
+    return 0;
+  }
+  b->dev = dev;
+  b->blockno = blockno;
+  b->flags = 0;
+  b->data = b->mem;
+
+  acquire(&bkt->lock);
+  b->hnext = bkt->head;
+  bkt->head = b;
+  release(&bkt->lock);
+
+  release(&bcache.lock);
+  // Unreferenced buffers are unlocked, so this does not sleep.
+  acquiresleep(&b->lock);
+  return b;
+}
+
+// If the disk is in memory, point b at its block there instead of
+// reading it.  Returns 1 if b is now valid.
+static int bmapdisk(struct buf *b) {
+  uchar *p;
+
+  if ((p = idemap(b)) == 0)
+    return 0;
+  b->data = p;
+  b->flags |= B_VALID | B_MAPPED;
+  return 1;
+}
+
+// Give b its own copy of the block it maps, so it can be changed.
+static void bunmap(struct buf *b) {
+  if (b->flags & B_MAPPED) {
+    memmove(b->mem, b->data, BSIZE);
+    b->data = b->mem;
+    b->flags &= ~B_MAPPED;
   }
-  panic("bget: no buffers");
 }
 
 // Return a locked buf with the contents of the indicated block.
@@ -102,43 +596,240 @@ struct buf *bread(uint dev, uint blockno) {
   if (!(b->flags & B_VALID)) {
     iderw(b);
   }
+  bunmap(b);
   return b;
 }
 
+// Like bread, but the caller promises not to change the data.
+struct buf *bread_ro(uint dev, uint blockno) {
+  struct buf *b;
+
+  num_disk_reads += 1;
+  b = bget(dev, blockno);
+  if (!(b->flags & B_VALID) && !bmapdisk(b))
+    iderw(b);
+  return b;
+}
+
+// Return locked bufs bps[0..n) with the contents of blocks
+// blockno..blockno+n-1, for reading only, as bread_ro does.  The
+// blocks not cached are read in one batch, so the driver can move
+// them with a single request.
+void breadn(uint dev, uint blockno, int n, struct buf **bps) {
+  struct buf *miss[BCLUSTER];
+  int i, nmiss;
+
+  if (n > BCLUSTER)
+    panic("breadn");
+
+  num_disk_reads += n;
+  nmiss = 0;
+  for (i = 0; i < n; i++) {
+    bps[i] = bget(dev, blockno + i);
+    if (!(bps[i]->flags & B_VALID) && !bmapdisk(bps[i]))
+      miss[nmiss++] = bps[i];
+  }
+  iderwv(miss, nmiss);
+}
+
 // Write b's contents to disk.  Must be locked.
 void bwrite(struct buf *b) {
-  if (crashn_enable) {
-    crashn--;
-    if (crashn < 0)
-      reboot();
-  }
-  if (!holdingsleep(&b->lock))
+  if (!holdingsleep(&b->lock) || (b->flags & B_MAPPED))
     panic("bwrite");
-  b->flags |= B_DIRTY;
+  bcrashpoint(0, 0);
+  bwriteprep(b);
   iderw(b);
 }
 
-// Release a locked buffer.
-// Move to the head of the MRU list.
-void brelse(struct buf *b) {
+// Write the contents of bs[0..n) to disk in one batch, so the
+// driver can merge runs of consecutive blocks.  All must be locked.
+void bwritev(struct buf **bs, int n) {
+  int i;
+
+  for (i = 0; i < n; i++) {
+    if (!holdingsleep(&bs[i]->lock) || (bs[i]->flags & B_MAPPED))
+      panic("bwritev");
+    bcrashpoint(bs, i);
+    bwriteprep(bs[i]);
+  }
+  iderwv(bs, n);
+}
+
+// Mark b's contents to be written to disk later.  Must be locked.
+void bdwrite(struct buf *b) {
+  if (!holdingsleep(&b->lock) || (b->flags & B_MAPPED))
+    panic("bdwrite");
+  b->flags |= B_DIRTY;
+  acquire(&bcache.lrulock);
+  dirtypush(b);
+  release(&bcache.lrulock);
+}
+
+// Write back the delayed writes of blocks [start, start+n) of dev,
+// as bsync does for all of them.  Caller must not hold any buffer.
+void bsyncrange(uint dev, uint start, uint n) {
+  uint devs[BFLUSHBATCH], blocknos[BFLUSHBATCH];
+  struct buf *b;
+  int i;
+
+  for (;;) {
+    i = 0;
+    acquire(&bcache.lrulock);
+    for (b = bcache.dhead.dnext; b != &bcache.dhead && i < BFLUSHBATCH;
+         b = b->dnext) {
+      if (b->dev != dev || b->blockno < start || b->blockno - start >= n)
+        continue;
+      devs[i] = b->dev;
+      blocknos[i] = b->blockno;
+      i++;
+    }
+    release(&bcache.lrulock);
+    if (i == 0)
+      break;
+    // Waits for the first buffer, so every round writes or drops
+    // at least one of them.
+    bflushv(devs, blocknos, i, 1);
+  }
+}
+
+// Take locked b off the delayed-write list, if a bdwrite put it
+// there, so bflusher and bsync leave it alone; the log writes it.
+void bundelay(struct buf *b) {
   if (!holdingsleep(&b->lock))
-    panic("brelse");
+    panic("bundelay");
+  acquire(&bcache.lrulock);
+  dirtyremove(b);
+  release(&bcache.lrulock);
+}
+
+// Write every delayed write to disk, oldest first.
+// Caller must not hold any buffer.
+void bsync(void) {
+  uint dev[BFLUSHBATCH], blockno[BFLUSHBATCH];
+  int n, nwritten, left;
+
+  // Buffers dirtied after we start are left for the next sync.
+  acquire(&bcache.lrulock);
+  left = bcache.ndirty;
+  release(&bcache.lrulock);
+
+  while (left > 0) {
+    n = bdirty(dev, blockno, left < BFLUSHBATCH ? left : BFLUSHBATCH, 0);
+    if (n == 0)
+      break;
+    // Buffers skipped because they were busy are still the oldest,
+    // so the next batch waits for the first of them.
+    nwritten = bflushv(dev, blockno, n, 1);
+    left -= nwritten ? nwritten : n;
+  }
+}
 
+// Body of the bflush kernel thread: write back delayed writes
+// every BFLUSHTICKS ticks.
+void bflusher(void) {
+  uint ticks0;
+
+  for (;;) {
+    acquire(&tickslock);
+    ticks0 = ticks;
+    while (ticks - ticks0 < BFLUSHTICKS)
+      sleep(&ticks, &tickslock);
+    release(&tickslock);
+    bsync();
+  }
+}
+
+// iodone callback for bprefetch: drop the lock and reference
+// that bprefetch handed to the driver.
+static void bprefetchdone(struct buf *b) {
   releasesleep(&b->lock);
+  bput(b);
+}
 
-  acquire(&bcache.lock);
-  b->refcnt--;
-  if (b->refcnt == 0) {
-    // no one is waiting for it.
-    b->next->prev = b->prev;
-    b->prev->next = b->next;
-    b->next = bcache.head.next;
-    b->prev = &bcache.head;
-    bcache.head.next->prev = b;
-    bcache.head.next = b;
+// Start reading (dev, blockno) into the cache without waiting
+// for it.  Read-ahead is only a hint, so this does nothing if the
+// block is already cached or there is no idle buffer to read it into.
+void bprefetch(uint dev, uint blockno) {
+  struct buf *b;
+
+  if ((b = bgetidle(dev, blockno)) == 0)
+    return;
+  if ((b->flags & B_VALID) || bmapdisk(b)) {
+    brelse(b);
+    return;
   }
+  b->flags |= B_ASYNC;
+  b->iodone = bprefetchdone;
+  idesubmit(b);
+}
 
-  release(&bcache.lock);
+// Return a locked buf for (dev, blockno), starting a read if the
+// block is not cached, without waiting for the read to finish.
+// Call bwait before looking at b->data.
+struct buf *bread_async(uint dev, uint blockno) {
+  struct buf *b;
+
+  num_disk_reads += 1;
+  b = bget(dev, blockno);
+  bunmap(b);
+  if (!(b->flags & B_VALID)) {
+    b->flags |= B_ASYNC;
+    b->iodone = 0;
+    idesubmit(b);
+  }
+  return b;
+}
+
+// Wait for the read bread_async started on b.  Returns at once if
+// bread_async found b cached and started no read.
+struct buf *bwait(struct buf *b) {
+  if (!holdingsleep(&b->lock))
+    panic("bwait");
+  if (b->flags & B_ASYNC)
+    idewaitbuf(b);
+  return b;
+}
+
+// Called by the disk driver, possibly from its interrupt handler,
+// when the request for b completes.  Runs b's iodone callback if
+// the request was started with one, and otherwise wakes whoever
+// waits in iderw or bwait.
+void bdone(struct buf *b) {
+  void (*iodone)(struct buf *);
+
+  iodone = 0;
+  if (b->flags & B_ASYNC) {
+    b->flags &= ~B_ASYNC;
+    iodone = b->iodone;
+    b->iodone = 0;
+  }
+  if (iodone)
+    iodone(b);
+  else
+    wakeup(b);
+}
+
+// Keep b in the cache after it is released, until bunpin.
+void bpin(struct buf *b) {
+  struct bucket *bkt;
+
+  bkt = bbucket(b->dev, b->blockno);
+  acquire(&bkt->lock);
+  b->refcnt++;
+  release(&bkt->lock);
+}
+
+void bunpin(struct buf *b) {
+  bput(b);
+}
+
+// Release a locked buffer.
+void brelse(struct buf *b) {
+  if (!holdingsleep(&b->lock))
+    panic("brelse");
+
+  releasesleep(&b->lock);
+  bput(b);
 }
 
 // Print the data at the given block.
@@ -220,7 +220,7 @@ struct {
 #define C(x) ((x) - '@') // Control-x
 
 void consoleintr(int (*getc)(void)) {
-  int c, doprocdump = 0;
+  int c, doprocdump = 0, dotracedump = 0;
 
   acquire(&cons.lock);
   while ((c = getc()) >= 0) {
@@ -229,6 +229,9 @@ void consoleintr(int (*getc)(void)) {
       // procdump() locks cons.lock indirectly; invoke later
       doprocdump = 1;
       break;
+    case C('T'): // Trace buffer, likewise.
+      dotracedump = 1;
+      break;
     case C('U'): // Kill line.
       while (input.e != input.w &&
              input.buf[(input.e - 1) % INPUT_BUF] != '\n') {
@@ -260,6 +263,9 @@ void consoleintr(int (*getc)(void)) {
   if (doprocdump) {
     procdump(); // now call procdump() wo. cons.lock held
   }
+  if (dotracedump) {
+    tracedump();
+  }
 }
 
 int consoleread(struct inode *ip, char *dst, int n) {
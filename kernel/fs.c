@@ -18,6 +18,7 @@
 #include <sleeplock.h>
 #include <spinlock.h>
 #include <stat.h>
+#include <trace.h>
 
 #include <buf.h>
 
@@ -30,11 +31,20 @@ uint create_file_lock_in_use = 0;
 int create_file_lock_initialized = -1;
 
 
-uchar create_set_low_bitmask(int);
-uchar create_set_high_bitmask(int);
 static struct inode *iget(uint, uint);
-
-void update_extra_extents_flag(void);
+static int nxextent(struct inode *);
+static uint bmap(struct inode *, uint, uint *);
+static void imapinit(void);
+static int ialloc(void);
+static void ifree(uint);
+void read_dinode(uint, struct dinode *);
+static void bmapinit(int);
+static void dirindexinit(void);
+static void dirindexadd(uint, uint, char *, uint, uint);
+static void dirindexremove(uint, uint, char *);
+static void dcacheinit(void);
+static void dcacheforget(uint, uint, char *);
+static void readahead(struct inode *, uint *, uint *, uint, uint);
 
 
 // there should be one superblock per disk device, but we run with
@@ -45,7 +55,7 @@ struct superblock sb;
 void readsb(int dev, struct superblock *sb) {
   struct buf *bp;
 
-  bp = bread(dev, 1);
+  bp = bread_ro(dev, 1);
   memmove(sb, bp->data, sizeof(*sb));
   brelse(bp);
 }
@@ -68,22 +78,30 @@ void readsb(int dev, struct superblock *sb) {
 // inodes include book-keeping information that is
 // not stored on disk: ip->ref and ip->flags.
 //
-// Since there is no writing to the file system there is no need
-// for the callers to worry about coherence between the disk
-// and the in memory copy, although that will become important
-// if writing to the disk is introduced.
+// Once read, the in memory copy is the authoritative one: code
+// that changes an inode sets ip->dirty, and unlocki writes the
+// inode back to the inode file.
 //
 // Clients use iget() to populate an inode with valid information
 // from the disk. idup() can be used to add an in memory reference
 // to and inode. irelease() will decrement the in memory reference count
 // and will free the inode if there are no more references to it,
 // freeing up space in the cache for the inode to be used again.
+//
+// Cached inodes are found through a hash table on (dev, inum).  An
+// inode with no references stays in the table, still valid, on an
+// LRU list; iget takes it back if it is wanted again.  The cache
+// allocates inodes from an object cache as it needs them, up to
+// NINODE, and after that recycles the least recently used one.
 
 
 
 struct {
   struct spinlock lock;
-  struct inode inode[NINODE];
+  struct kmcache *cache;
+  int n; // inodes allocated
+  struct inode *hash[NIHASH];
+  struct inode lru; // unreferenced inodes, most recent first
   struct inode inodefile;
 } icache;
 
@@ -106,7 +124,7 @@ static void init_inodefile(int dev) {
   struct buf *b;
   struct dinode di;
 
-  b = bread(dev, sb.inodestart);
+  b = bread_ro(dev, sb.inodestart);
   memmove(&di, b->data, sizeof(struct dinode));
 
   icache.inodefile.inum = INODEFILEINO;
@@ -118,63 +136,360 @@ static void init_inodefile(int dev) {
   icache.inodefile.devid = di.devid;
   icache.inodefile.size = di.size;
   icache.inodefile.data = di.data;
+  memmove(icache.inodefile.extra_extents_blk_nums, di.extra_extents_blk_nums,
+          sizeof(di.extra_extents_blk_nums));
 
   brelse(b);
 }
 
 void iinit(int dev) {
-  int i;
-
   initlock(&icache.lock, "icache");
-  for (i = 0; i < NINODE; i++) {
-    initsleeplock(&icache.inode[i].lock, "inode");
-  }
+  icache.lru.lprev = &icache.lru;
+  icache.lru.lnext = &icache.lru;
+  if ((icache.cache = kmcache_create("inode", sizeof(struct inode))) == 0)
+    panic("iinit: inode cache");
   initsleeplock(&icache.inodefile.lock, "inodefile");
 
   readsb(dev, &sb);
   cprintf("sb: size %d nblocks %d bmap start %d inodestart %d\n", sb.size,
           sb.nblocks, sb.bmapstart, sb.inodestart);
 
+  initlog(dev, &sb);
   init_inodefile(dev);
+  bmapinit(dev);
+  imapinit();
+  dirindexinit();
+  dcacheinit();
 }
 
 
 
 
 
-//uses bitmap to see if block is 
-//free or used
-int get_block_state(int blk_num){
+// Blocks.
+//
+// The free bitmap is read into memory at mount and stays there;
+// bits are looked up and changed 64 at a time, and each change is
+// written through to the bitmap blocks on disk.
+//
+// For allocation, free space is also kept as an array of free
+// extents, sorted by block number and with neighbours merged.
+// balloc hands out the free run right after a hint if there is one,
+// so a growing file stays contiguous, and otherwise the smallest run
+// that holds the whole request (or the largest there is).  bfree
+// gives a run back.  If the free space is too fragmented for the
+// array, the smallest extents are left out of it; once nothing in
+// the array fits a request, it is rebuilt from the bitmap.
+
+// Whole bitmap blocks, so each can be written straight from here.
+static uint64_t bmapbits[(FSSIZE + BPB - 1) / BPB * BSIZE / 8];
+
+static struct {
+  struct sleeplock lock;
+  int n;
+  int dropped; // some free extents are not in ext
+  struct extent ext[NFREEEXT];
+} fmap;
+
+// Return the first free block at or after b, or sb.size if none.
+static uint bmapnextfree(uint b) {
+  uint64_t w;
+
+  while (b < sb.size) {
+    w = ~bmapbits[b / 64] >> (b % 64);
+    if (w != 0)
+      return min(b + (uint)ctz64(w), sb.size);
+    b += 64 - b % 64;
+  }
+  return sb.size;
+}
+
+// Return the number of free blocks from b on, up to max.
+static uint bmapfreerun(uint b, uint max) {
+  uint64_t w;
+  uint n;
+
+  for (n = 0; n < max && b + n < sb.size;) {
+    w = bmapbits[(b + n) / 64] >> ((b + n) % 64);
+    if (w != 0) {
+      n += ctz64(w);
+      break;
+    }
+    n += 64 - (b + n) % 64;
+  }
+  return min(n, min(max, sb.size - b));
+}
+
+// Set (val 1) or clear the bits of blocks [start, start+n) and
+// write the bitmap blocks that changed.
+static void bmapset(uint start, uint n, int val) {
+  struct buf *bp;
+  uint64_t mask;
+  uint b, k, end;
+
+  end = start + n;
+  for (b = start; b < end; b += k) {
+    k = min(64 - b % 64, end - b);
+    mask = (k == 64 ? ~0ULL : (1ULL << k) - 1) << (b % 64);
+    if (val)
+      bmapbits[b / 64] |= mask;
+    else
+      bmapbits[b / 64] &= ~mask;
+  }
+
+  for (b = start - start % BPB; b < end; b += BPB) {
+    bp = bread(ROOTDEV, BBLOCK(b, sb));
+    memmove(bp->data, (uchar *)bmapbits + b / 8, BSIZE);
+    log_write(bp);
+    brelse(bp);
+  }
+}
+
+static void fmapremove(int i) {
+  memmove(&fmap.ext[i], &fmap.ext[i + 1], (fmap.n - i - 1) * sizeof(fmap.ext[0]));
+  fmap.n--;
+}
+
+// Add the free run [start, start+n) to the index.
+static void fmapadd(uint start, uint n) {
+  int i, j;
+
+  for (i = 0; i < fmap.n && fmap.ext[i].startblkno < start; i++)
+    ;
+
+  if (i > 0 && fmap.ext[i - 1].startblkno + fmap.ext[i - 1].nblocks == start) {
+    fmap.ext[i - 1].nblocks += n;
+    if (i < fmap.n && start + n == fmap.ext[i].startblkno) {
+      fmap.ext[i - 1].nblocks += fmap.ext[i].nblocks;
+      fmapremove(i);
+    }
+    return;
+  }
+  if (i < fmap.n && start + n == fmap.ext[i].startblkno) {
+    fmap.ext[i].startblkno = start;
+    fmap.ext[i].nblocks += n;
+    return;
+  }
+
+  if (fmap.n == NFREEEXT) {
+    // Full: drop the smallest extent, or this one.
+    fmap.dropped = 1;
+    for (j = 0, i = 1; i < fmap.n; i++)
+      if (fmap.ext[i].nblocks < fmap.ext[j].nblocks)
+        j = i;
+    if (fmap.ext[j].nblocks >= n)
+      return;
+    fmapremove(j);
+    for (i = 0; i < fmap.n && fmap.ext[i].startblkno < start; i++)
+      ;
+  }
+  memmove(&fmap.ext[i + 1], &fmap.ext[i], (fmap.n - i) * sizeof(fmap.ext[0]));
+  fmap.ext[i].startblkno = start;
+  fmap.ext[i].nblocks = n;
+  fmap.n++;
+}
+
+// Rebuild the free extent index from the bitmap.
+static void fmapbuild(void) {
+  uint b, n;
+
+  fmap.n = 0;
+  fmap.dropped = 0;
+  for (b = bmapnextfree(0); b < sb.size; b = bmapnextfree(b + n)) {
+    n = bmapfreerun(b, sb.size);
+    fmapadd(b, n);
+  }
+}
+
+// Read the bitmap into memory and index its free extents.
+static void bmapinit(int dev) {
+  struct buf *bp;
+  uint b;
+
+  if (sb.size > FSSIZE)
+    panic("bmapinit: file system too large");
+
+  initsleeplock(&fmap.lock, "fmap");
+  for (b = 0; b < sb.size; b += BPB) {
+    bp = bread_ro(dev, BBLOCK(b, sb));
+    memmove((uchar *)bmapbits + b / 8, bp->data, BSIZE);
+    brelse(bp);
+  }
+  fmapbuild();
+}
+
+// Pick the index entry balloc should take from, or -1 if empty.
+static int fmapbest(uint n, uint hint) {
+  int i, best;
+  uint have;
+
+  best = -1;
+  for (i = 0; i < fmap.n; i++) {
+    if (hint != 0 && fmap.ext[i].startblkno == hint)
+      return i;
+    if (best < 0) {
+      best = i;
+      continue;
+    }
+    have = fmap.ext[best].nblocks;
+    if (have < n ? fmap.ext[i].nblocks > have
+                 : fmap.ext[i].nblocks >= n && fmap.ext[i].nblocks < have)
+      best = i;
+  }
+  return best;
+}
 
+// Allocate up to n contiguous blocks into *e, preferring the free
+// run that starts at hint (if hint is not 0).  Returns the number of
+// blocks allocated, which is less than n if no run is long enough
+// and 0 if the disk is full.
+static uint balloc(uint n, uint hint, struct extent *e) {
+  int best;
+
+  acquiresleep(&fmap.lock);
+  best = fmapbest(n, hint);
+  if (fmap.dropped && (best < 0 || fmap.ext[best].nblocks < n)) {
+    fmapbuild();
+    best = fmapbest(n, hint);
+  }
+  if (best < 0) {
+    releasesleep(&fmap.lock);
+    e->startblkno = 0;
+    e->nblocks = 0;
+    return 0;
+  }
 
-  int block_steps = (blk_num - sb.bmapstart)/4096;
+  e->startblkno = fmap.ext[best].startblkno;
+  e->nblocks = min(n, fmap.ext[best].nblocks);
+  fmap.ext[best].startblkno += e->nblocks;
+  fmap.ext[best].nblocks -= e->nblocks;
+  if (fmap.ext[best].nblocks == 0)
+    fmapremove(best);
+  bmapset(e->startblkno, e->nblocks, 1);
+  releasesleep(&fmap.lock);
+  return e->nblocks;
+}
 
-  int block_offset = blk_num - block_steps * 4096;
+// Free the blocks of extent e.
+static void bfree(struct extent *e) {
+  if (e->nblocks == 0)
+    return;
+  acquiresleep(&fmap.lock);
+  bmapset(e->startblkno, e->nblocks, 0);
+  fmapadd(e->startblkno, e->nblocks);
+  releasesleep(&fmap.lock);
+}
 
-  int buf_data_steps = block_offset/8;
+//uses bitmap to see if block is 
+//free or used
+int get_block_state(int blk_num){
 
-  int byte_offset = block_offset - buf_data_steps*8;
+  return (bmapbits[blk_num / 64] >> (blk_num % 64)) & 1;
 
-  struct buf* bmap_buf;
+}
 
-  bmap_buf = bread(1, sb.bmapstart + block_steps);
 
 
-  uchar my_bitmask = create_set_high_bitmask(byte_offset);
+// Free inodes.
+//
+// Which inums are free is kept in an in-memory bitmap, built from the
+// inode file at mount.  ialloc takes the lowest free inum, adding a
+// block of inodes to the inode file when there is none.
 
-  uchar new_num = my_bitmask & bmap_buf->data[buf_data_steps];
+static struct {
+  struct spinlock lock;
+  uint ninodes;  // inodes in the inode file
+  uint lowfree;  // no free inum below this
+  uint64_t used[MAXINODES / 64];
+} imap;
 
-  new_num = (new_num << (7 - byte_offset)) >> 7;
+static void imapinit(void) {
+  struct dinode di[BSIZE / sizeof(struct dinode)];
+  uint inum, off;
+  int i, n;
 
+  initlock(&imap.lock, "imap");
+  locki(&icache.inodefile);
+  imap.ninodes = min(icache.inodefile.size / (uint)sizeof(struct dinode), (uint)MAXINODES);
+  // The inode file and root directory are always in use.
+  imap.used[0] = (1ULL << INODEFILEINO) | (1ULL << ROOTINO);
+  for (off = 0; off < imap.ninodes * sizeof(struct dinode); off += n) {
+    n = readi(&icache.inodefile, (char *)di, off, sizeof(di));
+    if (n <= 0)
+      panic("imapinit read");
+    for (i = 0; i < n / sizeof(struct dinode); i++) {
+      inum = off / sizeof(struct dinode) + i;
+      if (inum < imap.ninodes && di[i].type != 0)
+        imap.used[inum / 64] |= 1ULL << (inum % 64);
+    }
+  }
+  unlocki(&icache.inodefile);
+}
 
-  brelse(bmap_buf);
+// Add a block of free inodes to the inode file.
+// Must be called inside a transaction.  Returns 0, or -1 if the
+// inode file cannot grow.
+static int igrowinodes(void) {
+  char zero[BSIZE];
+  uint off;
+  int r;
 
-  return new_num;
+  memset(zero, 0, sizeof(zero));
+  locki(&icache.inodefile);
+  off = icache.inodefile.size;
+  r = -1;
+  if (off / sizeof(struct dinode) < MAXINODES &&
+      writei(&icache.inodefile, zero, off, BSIZE - off % BSIZE) > 0)
+    r = 0;
+  acquire(&imap.lock);
+  imap.ninodes = min(icache.inodefile.size / (uint)sizeof(struct dinode), (uint)MAXINODES);
+  release(&imap.lock);
+  unlocki(&icache.inodefile);
+  return r;
+}
 
+// Allocate a free inum, or return 0 if there is none.
+// Must be called inside a transaction.
+static int ialloc(void) {
+  uint64_t w;
+  uint i, inum;
+
+  for (;;) {
+    acquire(&imap.lock);
+    for (i = imap.lowfree / 64; i * 64 < imap.ninodes; i++) {
+      w = ~imap.used[i];
+      if (w != 0 && i * 64 + ctz64(w) < imap.ninodes) {
+        imap.used[i] |= w & -w;
+        inum = i * 64 + ctz64(w);
+        imap.lowfree = inum;
+        release(&imap.lock);
+        return inum;
+      }
+    }
+    imap.lowfree = imap.ninodes;
+    release(&imap.lock);
+    if (igrowinodes() < 0)
+      return 0;
+  }
 }
 
+static void ifree(uint inum) {
+  acquire(&imap.lock);
+  imap.used[inum / 64] &= ~(1ULL << (inum % 64));
+  if (inum < imap.lowfree)
+    imap.lowfree = inum;
+  release(&imap.lock);
+}
 
+//let the next create_file_on_disk in
+static void create_file_unlock(void){
+  acquire(&create_file_lock);
+  create_file_lock_in_use = 0;
+  wakeup(9999);
+  release(&create_file_lock);
+}
 
+//returns NULL if there is no free inode or block for the file
 struct inode* create_file_on_disk(char* filename){
 
 
@@ -216,250 +531,72 @@ struct inode* create_file_on_disk(char* filename){
   release(&create_file_lock);
 
 
-  //this let's me know if I need to increase root dir size or not
-  int file_used_deleted_files_space = 0;
-
-  //need to see the last block used
-  //by the previous dinode, so the caller
-  //knows what block to use for the start of this file
-  int last_free_block = -1;
-
-  int found_free_inode = 0;
-
-  struct buf* last_blk;
-
-  //in looking at the code it's already obvious the first dinodes are found
-  //in the last block of the inode file
-  int last_block_num = 33;
-
-  last_blk = bread(icache.inodefile.dev, last_block_num);
-
-  struct dinode* last_block_dinodes = (struct dinode*)(last_blk -> data);
-
-
-
-  //since this is the 7th block 6*4 = 24
-  //so the first inode in this block has 
-  //inum = 24
-  int inum = 24;
-
-  // //dinode = 128 bytes, block = 512 bytes 
-  // //so 4 dinodes per block
-  // for(int i = 0; i < 4; i++){
-  //   if(last_block_dinodes[i].type == 0){
-  //     inum = inum + i;
-  //     found_free_inode = 1;
-  //     last_block_dinodes[i].type = 2;
-  //     last_block_dinodes[i].size = 0;
-
-  //     int num_data_blocks = 20;
-
-  //     //signifies this was a space of a recently deleted file, so can potentially use more than 20 (default blocks)
-  //     if(last_block_dinodes[i].extra_extents_blk_nums[25] != 0 && last_block_dinodes[i].extra_extents_blk_nums[24] != 0 ){
-  //       num_data_blocks = (last_block_dinodes[i].extra_extents_blk_nums[25]-last_block_dinodes[i].extra_extents_blk_nums[24])+1;
-  //       file_used_deleted_files_space = 1;
-  //       if(last_block_dinodes[i].extra_extents_blk_nums[24] != last_free_block+1){
-  //         cprintf("inum = %d and filename = %s \n", inum, filename);
-  //         panic("error or first time extra extents are used");
-  //       }
-  //     }
-
-  //     struct extent data;
-  //     data.startblkno = last_free_block+1;
-  //     data.nblocks = num_data_blocks;
-  //     last_block_dinodes[i].data = data;
-  //     //update the bimap that these blocks are in use
-  //     for(int j = 0; j < num_data_blocks; j++){
-  //       set_blk_num_in_bitmap(data.startblkno + j, 1);
-  //      // if(j != 0){
-  //       //  last_block_dinodes[i].extra_extents_blk_nums[j - 1] = data.startblkno + j;
-  //      // }
-  //     }
-  //     //flag to let sysfile know that extra extents array isn't yet used
-  //     last_block_dinodes[i].extra_extents_blk_nums[27] = -1;
-  //     //mark number of contiguous blocks
-  //     last_block_dinodes[i].extra_extents_blk_nums[26] = last_block_dinodes[i].data.nblocks;
-  //     break;
-  //   }else{
-  //     last_free_block = last_block_dinodes[i].data.startblkno + last_block_dinodes[i].data.nblocks - 1;
-  //   }
-  // }
-
-  // if(found_free_inode == 1 && last_free_block != -1){
-  //   bwrite(last_blk);
-  //   brelse(last_blk);
-  // }
-
-
-
- //TODO to support also checking earlier blocks (e.g. if earlier inums get deleted)
- //here is where I can do that without deleting all the stuff above this...
-  if(found_free_inode == 0 || last_free_block == -1){
-    brelse(last_blk);
-
-    int check_blk_num = 34;
-
-    inum = 28;
-
-    while(found_free_inode == 0){
-
-      struct buf* last_blk = bread(1, check_blk_num);
-
-      struct dinode* last_block_dinodes = (struct dinode*)(last_blk -> data);
-
-      for(int i = 0; i < 4; i++){
-        if(last_block_dinodes[i].type == 0){
-          inum = inum + i;
-          found_free_inode = 1;
-          last_block_dinodes[i].type = 2;
-          last_block_dinodes[i].size = 0;
-
-          int num_data_blocks = 20;
-
-          //signifies this was a space of a recently deleted file, so can potentially use more than 20 (default blocks)
-          if(last_block_dinodes[i].extra_extents_blk_nums[25] != 0 && last_block_dinodes[i].extra_extents_blk_nums[24] != 0 ){
-            num_data_blocks = (last_block_dinodes[i].extra_extents_blk_nums[25]-last_block_dinodes[i].extra_extents_blk_nums[24])+1;
-            file_used_deleted_files_space = 1;
-            if(inum == 28){
-              last_free_block = 48;
-              num_data_blocks = 20;
-              file_used_deleted_files_space = 0;
-            }else if(last_block_dinodes[i].extra_extents_blk_nums[24] != last_free_block+1){
-              cprintf("inum = %d and filename = %s \n and last free block = %d \n and start = %d and end = %d", inum, filename, last_free_block, last_block_dinodes[i].extra_extents_blk_nums[24], last_block_dinodes[i].extra_extents_blk_nums[25]);
-              panic("error or first time extra extents are used");
-            }
-          }
-
-          struct extent data;
-          data.startblkno = last_free_block+1;
-          if(inum == 28){
-            cprintf("last free block = %d \n", last_free_block+1);
-          }
-          data.nblocks = num_data_blocks;
-          last_block_dinodes[i].data = data;
-          //update the bimap that these blocks are in use
-          for(int j = 0; j < num_data_blocks; j++){
-            set_blk_num_in_bitmap(data.startblkno + j, 1);
-          }
-          //flag to let sysfile know that extra extents array isn't yet used
-          last_block_dinodes[i].extra_extents_blk_nums[27] = -1;
-          //mark number of contiguous blocks
-          last_block_dinodes[i].extra_extents_blk_nums[26] = last_block_dinodes[i].data.nblocks;
-          break;
-        }else{
-          last_free_block = last_block_dinodes[i].data.startblkno + last_block_dinodes[i].data.nblocks - 1;
-        }
-      }
-
-
-      if(found_free_inode == 1 && last_free_block != -1){ 
-        if(inum == 28){
-          cprintf("yes wrote the blk back \n");
-        }
-        bwrite(last_blk);
-        brelse(last_blk);
-        last_blk = bread(1, check_blk_num);
-        
-
-        last_block_dinodes = (struct dinode*)(last_blk -> data);
-        if(inum == 28){
-          cprintf("check blk num = %d \n", check_blk_num);
-          cprintf("type retrieved = %d size = %d\n", last_block_dinodes[0].type, last_block_dinodes[0].size, last_block_dinodes[0].type);
-
-        }
-        break;
-      }else{
-        check_blk_num++;
-        //since 4 dinodes per block
-        inum = inum + 4;
-        brelse(last_blk);
-        if(check_blk_num > 36){
-          break;
-        }
-      }
-
-    }
-
-    if(found_free_inode == 0){
-      cprintf("found free inode = %d and last_free_block = %d \n", found_free_inode, last_free_block);
-      panic("couldn't find free inode or couldn't find last free block");
-    }
-
+  //the root directory keeps the entry of inode inum in slot inum
+  int inum = ialloc();
+  if(inum == 0){
+    create_file_unlock();
+    return NULL;
   }
 
-
-
-  //need to update the inode file to have a larger size since
-  //another file was appended
-  struct buf* inodefileblock = bread(1, 27);
-
-  struct dinode* inodefileextents = (struct dinode*)inodefileblock -> data;
-
-  //increase the size of the inode file
-//  inodefileextents[0].size = inodefileextents[0].size + sizeof(struct dinode);   <--- this doesn't actually need to happen, the size is set to maximum in mkfs.c
-
-
-
-  //only increaes size if it didn't reuse space of previously deleted file
-  if(file_used_deleted_files_space == 0){
-    //increase the size of the root directory file since it will soon 
-    //have another entry
-    inodefileextents[1].size = inodefileextents[1].size + sizeof(struct dirent);
+  //set up the new inode in memory, unlocki writes it out.
+  //give the file its first extent, the file grows into
+  //extra extents from there
+  struct inode* return_inode = iget(1, inum);
+  acquiresleep(&return_inode -> lock);
+  return_inode -> type = T_FILE;
+  return_inode -> devid = 0;
+  return_inode -> size = 0;
+  memset(return_inode -> extra_extents_blk_nums, 0, sizeof(return_inode -> extra_extents_blk_nums));
+  if(balloc(FILEBLOCKS, 0, &return_inode -> data) == 0){
+    //nothing was written, leave the inode invalid so it is reread
+    return_inode -> type = 0;
+    releasesleep(&return_inode -> lock);
+    irelease(return_inode);
+    ifree(inum);
+    create_file_unlock();
+    return NULL;
   }
+  return_inode -> valid = 1;
+  return_inode -> dirty = 1;
+  unlocki(return_inode);
 
-  bwrite(inodefileblock);
-  brelse(inodefileblock);
-
-  icache.inodefile.valid = 0;
-
-  //synchronize the inode for icacheinodefile
-  locki(&icache.inodefile);
-  unlocki(&icache.inodefile);
-
-
-  //synchronize the newly modified dinode
-  //with the inode
-//  struct inode* syncnew = iget(1, inum);
- // syncnew -> valid = 0;
- // locki(syncnew);
- // unlocki(syncnew);
 
+  //add the new inode to the root directory, writei grows the
+  //root directory if the new entry is past its end
+  struct inode* root = iget(1, ROOTINO);
+  locki(root);
 
-  //add the new inode to the root directory
   struct dirent new_dirent;
 
+  memset(&new_dirent, 0, sizeof(new_dirent));
   strncpy(new_dirent.name, filename, DIRSIZ);
   new_dirent.inum = inum;
 
+  if(writei(root, (char*)&new_dirent, inum * sizeof(struct dirent), sizeof(struct dirent)) != sizeof(struct dirent)){
+    //no room to grow the root directory, undo the new inode
+    unlocki(root);
+    irelease(root);
+
+    locki(return_inode);
+    bfree(&return_inode -> data);
+    return_inode -> type = 0;
+    memset(&return_inode -> data, 0, sizeof(return_inode -> data));
+    return_inode -> dirty = 1;
+    unlocki(return_inode);
+    irelease(return_inode);
+
+    ifree(inum);
+    create_file_unlock();
+    return NULL;
+  }
 
-  int root_block_to_get = 37 + (inum*sizeof(struct dirent))/BSIZE;
-
-  int root_block_offset = inum%(BSIZE/sizeof(struct dirent));
-
-  struct buf* root_extents = bread(1, root_block_to_get);
-
-  struct dirent* root_extents_files = (struct dirent*)(root_extents -> data);
-
-  root_extents_files[root_block_offset] = new_dirent;
-
-  bwrite(root_extents);
-  brelse(root_extents);
-
-  //synchronize the root dir inode
-  struct inode* syncroot = iget(1, 1);
-  syncroot -> valid = 0;
-  locki(syncroot);
-  unlocki(syncroot);
+  dirindexadd(ROOTDEV, ROOTINO, filename, inum, inum * sizeof(struct dirent));
+  dcacheforget(ROOTDEV, ROOTINO, filename);
 
-  struct inode* return_inode = iget(1, inum);
-  return_inode -> valid = 0;
-  locki(return_inode);
-  unlocki(return_inode);
+  unlocki(root);
+  irelease(root);
 
-  acquire(&create_file_lock);
-  create_file_lock_in_use = 0;
-  wakeup(9999);
-  release(&create_file_lock);
+  create_file_unlock();
 
   return return_inode;
 
@@ -469,6 +606,8 @@ struct inode* create_file_on_disk(char* filename){
 
 
 
+//must be called inside a transaction, which it may end and
+//begin again
 void delete_file(int inum){
 
 
@@ -476,179 +615,80 @@ void delete_file(int inum){
 
   memset(&null_dirent, 0, sizeof(struct dirent));
 
-  struct buf* root_extents = bread(1, 37);
-
-  struct dirent* root_extents_files = (struct dirent*)(root_extents -> data);
-
-
-  root_extents_files[inum] = null_dirent;
-
-  bwrite(root_extents);
-  brelse(root_extents);
-
-
-  //zero out the corresponding inode portion of the
-  //inode file
-  int block_num = 27+inum/4;
-
-  int block_offset = inum % 4;
-
-  struct buf* inode_blk = bread(1, block_num);
-
-  struct dinode* dinode_list = (struct dinode*)(inode_blk -> data);
-
-  int start_block = dinode_list[block_offset].data.startblkno;
-  int end_block = start_block + dinode_list[block_offset].data.nblocks - 1;
-
-  for(int i = start_block; i < end_block + 1; i++){
-
-   // cprintf("block %d has value %d \n", i, get_block_state(i));
-    set_blk_num_in_bitmap(i, 0);
-   // cprintf("block %d has value %d \n", i, get_block_state(i));
-
-  }
-
-  memset(&dinode_list[block_offset], 0, sizeof(struct dinode));
-
-
-  //small trick to tell files the amount of contiguous blocks
-  //available from a deleted file, for now just use all blocks
-  //that a deleted file frees up
-  dinode_list[block_offset].extra_extents_blk_nums[25] = end_block;
-  dinode_list[block_offset].extra_extents_blk_nums[24] = start_block;
-
-
-  bwrite(inode_blk);
-  brelse(inode_blk);
-
-  icache.inodefile.valid = 0;
-  //synchronize the inode for icacheinodefile
-  locki(&icache.inodefile);
-  unlocki(&icache.inodefile);
-
-
-  struct inode* syncroot = iget(1, 1);
-  syncroot -> valid = 0;
-  locki(syncroot);
-  unlocki(syncroot);
-
-}
-
-
+  struct inode* root = iget(1, ROOTINO);
+  locki(root);
 
-void set_blk_num_in_bitmap(int blk_num, int val){
+  struct dirent old_dirent;
 
-  //since it's a bit can only set to 0 or 1...
-  if(val != 1 && val != 0){
-    panic("can't set bitmap bit to anything besides 1 or 0");
+  if(readi(root, (char*)&old_dirent, inum * sizeof(struct dirent), sizeof(struct dirent)) != sizeof(struct dirent)){
+    panic("delete: no directory entry");
   }
+  char old_name[DIRSIZ];
+  memmove(old_name, old_dirent.name, DIRSIZ);
 
-  int block_steps = (blk_num - sb.bmapstart)/4096;
+  writei(root, (char*)&null_dirent, inum * sizeof(struct dirent), sizeof(struct dirent));
 
-  int block_offset = blk_num - block_steps * 4096;
+  dirindexremove(ROOTDEV, ROOTINO, old_name);
+  dcacheforget(ROOTDEV, ROOTINO, old_name);
 
-  int buf_data_steps = block_offset/8;
+  unlocki(root);
+  irelease(root);
 
-  int byte_offset = block_offset - buf_data_steps*8;
 
-  struct buf* bmap_buf;
+  //free the file's extents and clear the inode,
+  //unlocki writes the empty dinode out
+  struct inode* old_inode = iget(1, inum);
+  locki(old_inode);
 
-  bmap_buf = bread(1, sb.bmapstart + block_steps);
+  struct extent extents[NXEXTENT + 1];
+  int nextents = 0;
 
-  //if setting the bit low
-  if(val == 0){
-    bmap_buf -> data[buf_data_steps] = bmap_buf->data[buf_data_steps] & create_set_low_bitmask(byte_offset);
-  //if setting the bit high
-  }else{
-    bmap_buf -> data[buf_data_steps] = bmap_buf->data[buf_data_steps] | create_set_high_bitmask(byte_offset);
-  }
-
-  bwrite(bmap_buf);
-  brelse(bmap_buf);
-
-
-}
-
-int number_of_high_bits(uchar bmap_byte){
-
-  int number_bits_high = 0;
-
-  for(int i = 0; i < 8; i++){
-
-    uchar my_bitmask = create_set_high_bitmask(i);
-
-    uchar new_num = my_bitmask & bmap_byte;
-
-    new_num = (new_num << (7 - i)) >> 7;
-
-    if(new_num == (uchar)1){
-      number_bits_high++;
-    }
-
-  }
-
-  return number_bits_high;
-
-
-}
-
-
-
-
-//struct buf get_next_free_block_and_mark
-
-
-//create a bitmask that when "AND" is applied to a byte
-//will set the bit at "bit_position" low 0 is the rightmost bit
-//7 is the left most bit
-uchar create_set_low_bitmask(int bit_position){
-
-  uchar amt_to_add = 1;
-
-  uchar amt = 0;
-
-  for(int i = 0; i < 8; i++){
-
-    if(i == 0){
-      amt_to_add = 1;
-    }else{
-      amt_to_add = amt_to_add * 2;
-    }
-    if(i != bit_position){
-      amt += amt_to_add;
-    }
+  extents[nextents++] = old_inode -> data;
+  for(int i = 0; i < nxextent(old_inode); i++){
+    extents[nextents].startblkno = XSTART(old_inode, i);
+    extents[nextents].nblocks = XNBLOCKS(old_inode, i);
+    nextents++;
   }
 
-  return amt;
-}
-
-//create a bitmask that when "OR" is applied to a byte
-//will set the bit at "bit_position" high, 0 is the rightmost bit
-//7 is the left most bit
-uchar create_set_high_bitmask(int bit_position){
-
-  uchar amt_to_add = 1;
-
-  uchar amt = 0;
-
-  for(int i = 0; i < 8; i++){
+  old_inode -> type = 0;
+  old_inode -> devid = 0;
+  old_inode -> size = 0;
+  memset(&old_inode -> data, 0, sizeof(old_inode -> data));
+  memset(old_inode -> extra_extents_blk_nums, 0, sizeof(old_inode -> extra_extents_blk_nums));
+  old_inode -> dirty = 1;
+
+  unlocki(old_inode);
+  irelease(old_inode);
+
+  ifree(inum);
+
+  //free the extents one bitmap block's worth at a time, starting a
+  //new transaction whenever this one has logged as many bitmap blocks
+  //as it may. a crash in between only leaks the blocks not yet freed
+  int nbmap = 3; //dirent, root and file dinodes
+  for(int i = 0; i < nextents; i++){
+    while(extents[i].nblocks > 0){
+      struct extent piece;
+      piece.startblkno = extents[i].startblkno;
+      piece.nblocks = min(extents[i].nblocks, BPB - piece.startblkno % BPB);
+
+      if(nbmap == MAXOPBLOCKS){
+        end_op();
+        begin_op();
+        nbmap = 0;
+      }
+      bfree(&piece);
+      nbmap++;
 
-    if(i == 0){
-      amt_to_add = 1;
-    }else{
-      amt_to_add = amt_to_add * 2;
-    }
-    if(i == bit_position){
-      amt += amt_to_add;
+      extents[i].startblkno += piece.nblocks;
+      extents[i].nblocks -= piece.nblocks;
     }
   }
 
-  return amt;
 }
 
 
 
-
 // Reads the dinode with the passed inum from the inode file.
 // Threadsafe, will acquire sleeplock on inodefile inode if not held.
 void read_dinode(uint inum, struct dinode *dip) {
@@ -658,9 +698,7 @@ void read_dinode(uint inum, struct dinode *dip) {
 
   int value = readi(&icache.inodefile, (char *)dip, INODEOFF(inum), sizeof(*dip));
 
-  if(inum == 28){
-    cprintf("readi value = %d \n", value);
-  }
+  trace(TR_FS, TL_DEBUG, "read_dinode: inum %d read %d", inum, value);
   if (!holding_inodefile_lock)
     unlocki(&icache.inodefile);
 
@@ -678,11 +716,28 @@ void write_dinode(uint inum, struct dinode dip) {
 
 }
 
+// Copy a modified in-memory inode to disk.
+// Caller must hold ip->lock.
+void iupdate(struct inode *ip) {
+  struct dinode dip;
+
+  if (!holdingsleep(&ip->lock))
+    panic("iupdate");
+
+  dip.type = ip->type;
+  dip.devid = ip->devid;
+  dip.size = ip->size;
+  dip.data = ip->data;
+  memmove(dip.extra_extents_blk_nums, ip->extra_extents_blk_nums,
+          sizeof(dip.extra_extents_blk_nums));
+  write_dinode(ip->inum, dip);
+}
+
 // Read data from inode.
 // Returns number of bytes read.
 // Caller must hold ip->lock.
 void read_then_write_dinode(struct inode *ip, struct dinode src, uint off) {
-  uint tot, m;
+  uint run;
   struct buf *bp;
 
   if (!holdingsleep(&ip->lock))
@@ -690,7 +745,7 @@ void read_then_write_dinode(struct inode *ip, struct dinode src, uint off) {
 
   
   //get the block based on device and block number, note sleeplock is held
-  bp = bread(ip->dev, ip->data.startblkno + off / BSIZE);
+  bp = bread(ip->dev, bmap(ip, off / BSIZE, &run));
 
   struct dinode* to_modify = bp -> data + off %BSIZE;
 
@@ -699,42 +754,96 @@ void read_then_write_dinode(struct inode *ip, struct dinode src, uint off) {
  // to_modify -> size = n;
 
  // memmove(bp->data + off % BSIZE, src,  n);
-  bwrite(bp);
+  log_write(bp);
   //release the locked block sleep lock and move to most recently used (MRU) list
   brelse(bp);
   
  // return n;
 }
 
+static struct inode **ihash(uint dev, uint inum) {
+  return &icache.hash[(dev * 31 + inum) % NIHASH];
+}
+
+// Caller must hold icache.lock, as for the rest of the LRU list.
+static void ilruremove(struct inode *ip) {
+  ip->lprev->lnext = ip->lnext;
+  ip->lnext->lprev = ip->lprev;
+}
+
+static void ilrupush(struct inode *ip) {
+  ip->lnext = icache.lru.lnext;
+  ip->lprev = &icache.lru;
+  icache.lru.lnext->lprev = ip;
+  icache.lru.lnext = ip;
+}
+
 // Find the inode with number inum on device dev
 // and return the in-memory copy. Does not read
 // the inode from from disk.
 static struct inode *iget(uint dev, uint inum) {
-  struct inode *ip, *empty;
+  struct inode *ip, **pp;
+  int grow;
 
+  grow = 1;
   acquire(&icache.lock);
 
+again:
   // Is the inode already cached?
-  empty = 0;
-  for (ip = &icache.inode[0]; ip < &icache.inode[NINODE]; ip++) {
-    if (ip->ref > 0 && ip->dev == dev && ip->inum == inum) {
-      ip->ref++;
+  for (ip = *ihash(dev, inum); ip != 0; ip = ip->hnext) {
+    if (ip->dev == dev && ip->inum == inum) {
+      if (ip->ref++ == 0)
+        ilruremove(ip);
       release(&icache.lock);
       return ip;
     }
-    if (empty == 0 && ip->ref == 0) // Remember empty slot.
-      empty = ip;
   }
 
-  // Recycle an inode cache entry.
-  if (empty == 0)
+  // Below NINODE, add a fresh inode at the old end of the LRU list
+  // so it is the one recycled.  Allocate it without icache.lock
+  // held, then look again in case someone else cached inum.
+  if (grow && icache.n < NINODE) {
+    icache.n++;
+    release(&icache.lock);
+    ip = kmcache_alloc(icache.cache);
+    acquire(&icache.lock);
+    grow = 0;
+    if (ip == 0) {
+      // Out of memory; make do with the inodes we have.
+      icache.n--;
+    } else {
+      memset(ip, 0, sizeof(*ip));
+      initsleeplock(&ip->lock, "inode");
+      ip->lprev = icache.lru.lprev;
+      ip->lnext = &icache.lru;
+      icache.lru.lprev->lnext = ip;
+      icache.lru.lprev = ip;
+    }
+    goto again;
+  }
+
+  // Recycle the least recently used inode cache entry.
+  ip = icache.lru.lprev;
+  if (ip == &icache.lru)
     panic("iget: no inodes");
+  ilruremove(ip);
+  for (pp = ihash(ip->dev, ip->inum); *pp != 0; pp = &(*pp)->hnext) {
+    if (*pp == ip) {
+      *pp = ip->hnext;
+      break;
+    }
+  }
 
-  ip = empty;
   ip->ref = 1;
   ip->valid = 0;
+  ip->dirty = 0;
   ip->dev = dev;
   ip->inum = inum;
+  ip->ra_next = 0;
+  ip->ra_window = 0;
+  pp = ihash(dev, inum);
+  ip->hnext = *pp;
+  *pp = ip;
 
   release(&icache.lock);
 
@@ -755,10 +864,9 @@ struct inode *idup(struct inode *ip) {
 // be recycled.
 void irelease(struct inode *ip) {
   acquire(&icache.lock);
-  // inode has no other references release
-  if (ip->ref == 1)
-    ip->type = 0;
-  ip->ref--;
+  // inode has no other references, keep it for reuse
+  if (--ip->ref == 0)
+    ilrupush(ip);
   release(&icache.lock);
 }
 
@@ -788,8 +896,8 @@ void locki(struct inode *ip) {
 
     ip->valid = 1;
 
-    cprintf("ip type = %d \n", dip.type);
-    cprintf("extensts special = %d \n", dip.extra_extents_blk_nums[24]);
+    trace(TR_FS, TL_DEBUG, "locki: inum %d type %d extra extents %d",
+          ip->inum, dip.type, dip.extra_extents_blk_nums[XEXTCOUNT]);
 
 
     //copy the block numbers for extra extents
@@ -805,11 +913,16 @@ void locki(struct inode *ip) {
   }
 }
 
-// Unlock the given inode.
+// Unlock the given inode, first writing it back if it changed.
+// A dirty inode must be unlocked inside a transaction.
 void unlocki(struct inode *ip) {
   if(ip == 0 || !holdingsleep(&ip->lock) || ip->ref < 1)
     panic("unlocki");
 
+  if (ip->dirty) {
+    iupdate(ip);
+    ip->dirty = 0;
+  }
   releasesleep(&ip->lock);
 }
 
@@ -843,12 +956,112 @@ int concurrent_readi(struct inode *ip, char *dst, uint off, uint n) {
   return retval;
 }
 
+// Number of extra extents ip uses.
+static int nxextent(struct inode *ip) {
+  int n;
+
+  n = ip->extra_extents_blk_nums[XEXTCOUNT];
+  return n < 0 ? 0 : min(n, NXEXTENT);
+}
+
+// Number of blocks allocated to ip.
+static uint iblocks(struct inode *ip) {
+  uint nb;
+  int i;
+
+  nb = ip->data.nblocks;
+  for (i = 0; i < nxextent(ip); i++)
+    nb += XNBLOCKS(ip, i);
+  return nb;
+}
+
+// Return the disk block that holds block bn of ip's contents, and
+// set *run to the number of blocks from there to the end of its
+// extent.  Returns 0 if bn is past the blocks allocated to ip.
+static uint bmap(struct inode *ip, uint bn, uint *run) {
+  int i;
+
+  if (bn < ip->data.nblocks) {
+    *run = ip->data.nblocks - bn;
+    return ip->data.startblkno + bn;
+  }
+  bn -= ip->data.nblocks;
+  for (i = 0; i < nxextent(ip); i++) {
+    if (bn < XNBLOCKS(ip, i)) {
+      *run = XNBLOCKS(ip, i) - bn;
+      return XSTART(ip, i) + bn;
+    }
+    bn -= XNBLOCKS(ip, i);
+  }
+  return 0;
+}
+
+#define IGROWBMAPS 2
+
+// Allocate blocks to ip until it has at least nb.  Each step at
+// least doubles ip's blocks, or adds BPB of them once ip is big, so
+// a file's extents stay few and long;
+// blocks right after ip's last extent extend it, others start a new
+// extra extent.  Every bitmap block a step changes goes through the
+// log, so one call stops after IGROWBMAPS of them; a step of at most
+// BPB blocks changes at most two.  Returns the number of blocks ip
+// has, which is less than nb if the disk or ip's extent list is
+// full, or if the call ran out of bitmap blocks.
+// Caller must hold ip->lock and mark ip dirty.
+static uint igrow(struct inode *ip, uint nb) {
+  struct extent e;
+  uint have, hint, nbmap;
+  int nx;
+
+  have = iblocks(ip);
+  nbmap = 0;
+  while (have < nb && nbmap + 2 <= IGROWBMAPS) {
+    nx = nxextent(ip);
+    if (nx > 0)
+      hint = XSTART(ip, nx - 1) + XNBLOCKS(ip, nx - 1);
+    else if (ip->data.nblocks > 0)
+      hint = ip->data.startblkno + ip->data.nblocks;
+    else
+      hint = 0;
+
+    if (balloc(min(max(nb - have, min(have, (uint)BPB)), (uint)BPB), hint, &e) == 0)
+      break;
+    nbmap += (e.startblkno + e.nblocks - 1) / BPB - e.startblkno / BPB + 1;
+    if (hint != 0 && e.startblkno == hint) {
+      if (nx > 0)
+        XNBLOCKS(ip, nx - 1) += e.nblocks;
+      else
+        ip->data.nblocks += e.nblocks;
+    } else if (ip->data.nblocks == 0) {
+      ip->data = e;
+    } else if (nx < NXEXTENT) {
+      XSTART(ip, nx) = e.startblkno;
+      XNBLOCKS(ip, nx) = e.nblocks;
+      ip->extra_extents_blk_nums[XEXTCOUNT] = nx + 1;
+    } else {
+      bfree(&e);
+      break;
+    }
+    have += e.nblocks;
+  }
+  return have;
+}
+
 // Read data from inode.
 // Returns number of bytes read.
 // Caller must hold ip->lock.
 int readi(struct inode *ip, char *dst, uint off, uint n) {
-  uint tot, m;
-  struct buf *bp;
+  return readi_ra(ip, dst, off, n, &ip->ra_next, &ip->ra_window);
+}
+
+// readi for a reader that keeps its own read-ahead state (see
+// readahead), such as an open file.
+// Caller must hold ip->lock.
+int readi_ra(struct inode *ip, char *dst, uint off, uint n, uint *ranext,
+             uint *rawindow) {
+  uint tot, m, off0, bn, run;
+  struct buf *bps[BCLUSTER];
+  int i, nb;
 
   if (!holdingsleep(&ip->lock))
     panic("not holding lock");
@@ -864,18 +1077,80 @@ int readi(struct inode *ip, char *dst, uint off, uint n) {
   if (off + n > ip->size)
     n = ip->size - off;
 
-  for (tot = 0; tot < n; tot += m, off += m, dst += m) {
-    bp = bread(ip->dev, ip->data.startblkno + off / BSIZE);
-   
-    cprintf("blk num read = %d", ip->data.startblkno + off / BSIZE);
-    
-    m = min(n - tot, BSIZE - off % BSIZE);
-    memmove(dst, bp->data + off % BSIZE, m);
-    brelse(bp);
+  off0 = off;
+  for (tot = 0; tot < n;) {
+    // Read each extent's blocks in runs of up to BCLUSTER.
+    if ((bn = bmap(ip, off / BSIZE, &run)) == 0)
+      panic("readi: block not allocated");
+    nb = min((off + (n - tot) - 1) / BSIZE - off / BSIZE + 1, run);
+    nb = min(nb, BCLUSTER);
+    breadn(ip->dev, bn, nb, bps);
+    for (i = 0; i < nb; i++, tot += m, off += m, dst += m) {
+      trace(TR_FS, TL_DEBUG, "readi: inum %d block %d", ip->inum, bps[i]->blockno);
+      m = min(n - tot, BSIZE - off % BSIZE);
+      memmove(dst, bps[i]->data + off % BSIZE, m);
+      brelse(bps[i]);
+    }
   }
+  readahead(ip, ranext, rawindow, off0, n);
   return n;
 }
 
+// Sequential read-ahead, called after reading n bytes at off.
+// *next and *window are the read-ahead state of one reader: the
+// offset a sequential read would start at, and how many blocks to
+// fetch ahead of it.  A sequential read that reaches a new block
+// doubles the window, up to RAMAXBLOCKS; any other read resets it.
+// The blocks past the read are then started into the buffer cache
+// without waiting, so the next read finds them there.
+// Caller must hold ip->lock.
+static void readahead(struct inode *ip, uint *next, uint *window, uint off,
+                      uint n) {
+  uint bn, end, b, run;
+
+  if (n == 0)
+    return;
+
+  if (off != *next) {
+    *next = off + n;
+    *window = 0;
+    return;
+  }
+  *next = off + n;
+
+  // Still inside the block the previous read ended in.
+  if (off % BSIZE != 0 && off / BSIZE == (off + n - 1) / BSIZE)
+    return;
+
+  *window = *window ? min(*window * 2, (uint)RAMAXBLOCKS) : 4;
+
+  bn = (off + n - 1) / BSIZE + 1;
+  end = min((ip->size + BSIZE - 1) / BSIZE, bn + *window);
+  for (; bn < end; bn++)
+    if ((b = bmap(ip, bn, &run)) != 0)
+      bprefetch(ip->dev, b);
+}
+
+// Write back ip's delayed data writes.  Its metadata is already on
+// disk once the transaction that changed it has committed.
+void isync(struct inode *ip) {
+  struct extent e[NXEXTENT + 1];
+  int i, n;
+
+  locki(ip);
+  n = 0;
+  e[n++] = ip->data;
+  for (i = 0; i < nxextent(ip); i++, n++) {
+    e[n].startblkno = XSTART(ip, i);
+    e[n].nblocks = XNBLOCKS(ip, i);
+  }
+  unlocki(ip);
+
+  for (i = 0; i < n; i++)
+    if (e[i].nblocks > 0)
+      bsyncrange(ip->dev, e[i].startblkno, e[i].nblocks);
+}
+
 // threadsafe writei.
 int concurrent_writei(struct inode *ip, char *src, uint off, uint n) {
   int retval;
@@ -889,8 +1164,11 @@ int concurrent_writei(struct inode *ip, char *src, uint off, uint n) {
 
 // Write data to inode.
 // Returns number of bytes written.
-// Caller must hold ip->lock.
+// Caller must hold ip->lock; unlocki writes back the inode.
 int writei(struct inode *ip, char *src, uint off, uint n) {
+  uint tot, m, nb, run, want;
+  struct buf *bp;
+
   if (!holdingsleep(&ip->lock))
     panic("not holding lock");
 
@@ -899,8 +1177,37 @@ int writei(struct inode *ip, char *src, uint off, uint n) {
       return -1;
     return devsw[ip->devid].write(ip, src, n);
   }
-  // read-only fs, writing to inode is an error
-  return -1;
+
+  if (off > ip->size || off + n < off)
+    return -1;
+
+  // Grow the file if the write goes past its blocks, writing as
+  // much as fits if the disk is full.
+  want = n;
+  nb = (off + n + BSIZE - 1) / BSIZE;
+  if (nb > iblocks(ip)) {
+    ip->dirty = 1;
+    nb = igrow(ip, nb);
+    if (off + n > nb * BSIZE)
+      n = nb * BSIZE - off;
+  }
+
+  for (tot = 0; tot < n; tot += m, off += m, src += m) {
+    bp = bread(ip->dev, bmap(ip, off / BSIZE, &run));
+    m = min(n - tot, BSIZE - off % BSIZE);
+    memmove(bp->data + off % BSIZE, src, m);
+    if (ip->type == T_DIR || ip == &icache.inodefile)
+      log_write(bp);
+    else
+      bdwrite(bp);
+    brelse(bp);
+  }
+
+  if (off > ip->size) {
+    ip->size = off;
+    ip->dirty = 1;
+  }
+  return n == 0 && want > 0 ? -1 : n;
 }
 
 // Directories
@@ -911,14 +1218,187 @@ struct inode *rootlookup(char *name) {
   return dirlookup(namei("/"), name, 0);
 }
 
-// Look for a directory entry in a directory.
-// If found, set *poff to byte offset of entry.
-struct inode *dirlookup(struct inode *dp, char *name, uint *poff) {
-  uint off, inum;
-  struct dirent de;
+// Directory indexes.
+//
+// Names in a recently searched directory are kept in an in-memory
+// hash table, so a lookup reads one bucket instead of the whole
+// directory.  A directory's index is built from its entries the
+// first time it is searched, and create and unlink keep it current.
+// Entries come from one pool shared by all indexes; a directory too
+// big for the pool is searched linearly instead.
 
-  if (dp->type != T_DIR)
-    panic("dirlookup not DIR");
+#define NDIRHASH 64
+
+struct dirhent {
+  char name[DIRSIZ];
+  uint inum;
+  uint off;
+  struct dirhent *next;
+};
+
+struct dirindex {
+  uint dev;
+  uint inum;     // directory's inum, 0 if the slot is unused
+  int overflow;  // pool ran out, search linearly
+  uint lastuse;
+  struct dirhent *hash[NDIRHASH];
+};
+
+static struct {
+  struct sleeplock lock;
+  uint clock;
+  struct dirhent *free;
+  struct dirhent ent[NDIRHENT];
+  struct dirindex dir[NDIRINDEX];
+} dircache;
+
+static uint namehash(const char *name) {
+  uint h;
+  int i;
+
+  h = 0;
+  for (i = 0; i < DIRSIZ && name[i]; i++)
+    h = h * 31 + (uchar)name[i];
+  return h;
+}
+
+static void dirindexinit(void) {
+  int i;
+
+  initsleeplock(&dircache.lock, "dircache");
+  for (i = 0; i < NDIRHENT; i++) {
+    dircache.ent[i].next = dircache.free;
+    dircache.free = &dircache.ent[i];
+  }
+}
+
+// Give di's entries back to the pool.
+static void dirindexdrop(struct dirindex *di) {
+  struct dirhent *e;
+  int i;
+
+  for (i = 0; i < NDIRHASH; i++) {
+    while ((e = di->hash[i]) != 0) {
+      di->hash[i] = e->next;
+      e->next = dircache.free;
+      dircache.free = e;
+    }
+  }
+  di->overflow = 0;
+}
+
+static struct dirindex *dirindexfind(uint dev, uint inum) {
+  struct dirindex *di;
+
+  for (di = dircache.dir; di < dircache.dir + NDIRINDEX; di++)
+    if (di->inum == inum && di->dev == dev)
+      return di;
+  return 0;
+}
+
+// Add an entry to di; on running out of entries, switch di over to
+// linear search.  Returns 0, or -1 if di overflowed.
+static int dirindexput(struct dirindex *di, const char *name, uint inum,
+                       uint off) {
+  struct dirhent *e;
+  uint h;
+
+  if (di->overflow)
+    return -1;
+  if ((e = dircache.free) == 0) {
+    dirindexdrop(di);
+    di->overflow = 1;
+    return -1;
+  }
+  dircache.free = e->next;
+  strncpy(e->name, name, DIRSIZ);
+  e->inum = inum;
+  e->off = off;
+  h = namehash(name) % NDIRHASH;
+  e->next = di->hash[h];
+  di->hash[h] = e;
+  return 0;
+}
+
+// Return dp's index, building it if there is none.  A new index
+// takes the least recently used slot.  Caller must hold dp->lock
+// and dircache.lock.
+static struct dirindex *dirindexget(struct inode *dp) {
+  struct dirent de[BSIZE / sizeof(struct dirent)];
+  struct dirindex *di, *victim;
+  uint off;
+  int i, n;
+
+  if ((di = dirindexfind(dp->dev, dp->inum)) != 0) {
+    di->lastuse = ++dircache.clock;
+    return di;
+  }
+
+  victim = dircache.dir;
+  for (di = dircache.dir; di < dircache.dir + NDIRINDEX; di++) {
+    if (di->inum == 0) {
+      victim = di;
+      break;
+    }
+    if (di->lastuse < victim->lastuse)
+      victim = di;
+  }
+  di = victim;
+  dirindexdrop(di);
+  di->dev = dp->dev;
+  di->inum = dp->inum;
+  di->lastuse = ++dircache.clock;
+
+  // Read the directory a block at a time.
+  for (off = 0; off < dp->size; off += n) {
+    n = readi(dp, (char *)de, off, min((uint)sizeof(de), dp->size - off));
+    if (n <= 0)
+      panic("dirindexget read");
+    n -= n % sizeof(struct dirent);
+    if (n == 0)
+      break;
+    for (i = 0; i < n / sizeof(struct dirent); i++)
+      if (de[i].inum != 0 &&
+          dirindexput(di, de[i].name, de[i].inum, off + i * sizeof(struct dirent)) < 0)
+        return di;
+  }
+  return di;
+}
+
+// Record that directory (dev, dinum) now has name at offset off.
+// Only an index that already exists needs updating.
+static void dirindexadd(uint dev, uint dinum, char *name, uint inum, uint off) {
+  struct dirindex *di;
+
+  acquiresleep(&dircache.lock);
+  if ((di = dirindexfind(dev, dinum)) != 0)
+    dirindexput(di, name, inum, off);
+  releasesleep(&dircache.lock);
+}
+
+// Record that directory (dev, dinum) no longer has name.
+static void dirindexremove(uint dev, uint dinum, char *name) {
+  struct dirindex *di;
+  struct dirhent **pe, *e;
+
+  acquiresleep(&dircache.lock);
+  if ((di = dirindexfind(dev, dinum)) != 0) {
+    for (pe = &di->hash[namehash(name) % NDIRHASH]; (e = *pe) != 0; pe = &e->next) {
+      if (namecmp(name, e->name) == 0) {
+        *pe = e->next;
+        e->next = dircache.free;
+        dircache.free = e;
+        break;
+      }
+    }
+  }
+  releasesleep(&dircache.lock);
+}
+
+// Look for a directory entry in a directory by scanning it.
+static int dirscan(struct inode *dp, char *name, uint *poff) {
+  uint off;
+  struct dirent de;
 
   for (off = 0; off < dp->size; off += sizeof(de)) {
     if (readi(dp, (char *)&de, off, sizeof(de)) != sizeof(de))
@@ -927,16 +1407,47 @@ struct inode *dirlookup(struct inode *dp, char *name, uint *poff) {
       continue;
     if (namecmp(name, de.name) == 0) {
       // entry matches path element
-      if (poff)
-        *poff = off;
-      inum = de.inum;
-      return iget(dp->dev, inum);
+      *poff = off;
+      return de.inum;
     }
   }
-
   return 0;
 }
 
+// Look for a directory entry in a directory.
+// If found, set *poff to byte offset of entry.
+// Caller must hold dp->lock.
+struct inode *dirlookup(struct inode *dp, char *name, uint *poff) {
+  struct dirindex *di;
+  struct dirhent *e;
+  uint off, inum;
+
+  if (dp->type != T_DIR)
+    panic("dirlookup not DIR");
+
+  inum = 0;
+  acquiresleep(&dircache.lock);
+  di = dirindexget(dp);
+  if (di->overflow) {
+    inum = dirscan(dp, name, &off);
+  } else {
+    for (e = di->hash[namehash(name) % NDIRHASH]; e != 0; e = e->next) {
+      if (namecmp(name, e->name) == 0) {
+        inum = e->inum;
+        off = e->off;
+        break;
+      }
+    }
+  }
+  releasesleep(&dircache.lock);
+
+  if (inum == 0)
+    return 0;
+  if (poff)
+    *poff = off;
+  return iget(dp->dev, inum);
+}
+
 // Paths
 
 // Copy the next path element from path into name.
@@ -974,6 +1485,132 @@ static char *skipelem(char *path, char *name) {
   return path;
 }
 
+// Name cache.
+//
+// namex remembers the result of each path component it resolves,
+// found or not, keyed by the directory's inum and the name, so hot
+// paths skip locking and searching the directory again.  Entries
+// are recycled least recently used first.  create_file_on_disk and
+// delete_file forget the names they change; gen makes sure a lookup
+// that raced with them does not put the old answer back.
+
+#define NDHASH 32
+
+struct dentry {
+  uint dev;
+  uint dinum; // directory's inum, 0 if unused
+  char name[DIRSIZ];
+  uint inum;  // 0 if the directory has no such name
+  struct dentry *hnext;
+  struct dentry *prev; // LRU list, most recent first
+  struct dentry *next;
+};
+
+static struct {
+  struct spinlock lock;
+  uint gen;
+  struct dentry *hash[NDHASH];
+  struct dentry lru;
+  struct dentry ent[NDENTRY];
+} dcache;
+
+static void dcacheinit(void) {
+  struct dentry *d;
+
+  initlock(&dcache.lock, "dcache");
+  dcache.lru.prev = &dcache.lru;
+  dcache.lru.next = &dcache.lru;
+  for (d = dcache.ent; d < dcache.ent + NDENTRY; d++) {
+    d->next = dcache.lru.next;
+    d->prev = &dcache.lru;
+    dcache.lru.next->prev = d;
+    dcache.lru.next = d;
+  }
+}
+
+// Find the entry for name in directory (dev, dinum).
+// Caller must hold dcache.lock.
+static struct dentry **dcachefind(uint dev, uint dinum, const char *name) {
+  struct dentry **pd;
+
+  for (pd = &dcache.hash[(namehash(name) + dinum) % NDHASH]; *pd != 0;
+       pd = &(*pd)->hnext)
+    if ((*pd)->dinum == dinum && (*pd)->dev == dev &&
+        namecmp(name, (*pd)->name) == 0)
+      return pd;
+  return pd;
+}
+
+// Move d to the front of the LRU list.
+// Caller must hold dcache.lock.
+static void dcachetouch(struct dentry *d) {
+  d->prev->next = d->next;
+  d->next->prev = d->prev;
+  d->next = dcache.lru.next;
+  d->prev = &dcache.lru;
+  dcache.lru.next->prev = d;
+  dcache.lru.next = d;
+}
+
+// Look name up in directory dp.  Returns 1 and sets *inum (0 for a
+// name known not to exist) on a hit, 0 on a miss.
+static int dcachelookup(struct inode *dp, char *name, uint *inum) {
+  struct dentry *d;
+  int hit;
+
+  acquire(&dcache.lock);
+  d = *dcachefind(dp->dev, dp->inum, name);
+  hit = d != 0;
+  if (hit) {
+    *inum = d->inum;
+    dcachetouch(d);
+  }
+  release(&dcache.lock);
+  return hit;
+}
+
+// Remember that name in directory dp is inum (0 if absent), unless
+// an entry changed since dcache.gen was gen.
+static void dcacheenter(struct inode *dp, char *name, uint inum, uint gen) {
+  struct dentry **pd, *d;
+
+  acquire(&dcache.lock);
+  if (gen != dcache.gen || *dcachefind(dp->dev, dp->inum, name) != 0) {
+    release(&dcache.lock);
+    return;
+  }
+
+  // Recycle the least recently used entry.
+  d = dcache.lru.prev;
+  if (d->dinum != 0) {
+    pd = dcachefind(d->dev, d->dinum, d->name);
+    *pd = d->hnext;
+  }
+  d->dev = dp->dev;
+  d->dinum = dp->inum;
+  strncpy(d->name, name, DIRSIZ);
+  d->inum = inum;
+  pd = dcachefind(d->dev, d->dinum, name);
+  d->hnext = 0;
+  *pd = d;
+  dcachetouch(d);
+  release(&dcache.lock);
+}
+
+// Forget what is known about name in directory (dev, dinum).
+static void dcacheforget(uint dev, uint dinum, char *name) {
+  struct dentry **pd, *d;
+
+  acquire(&dcache.lock);
+  dcache.gen++;
+  pd = dcachefind(dev, dinum, name);
+  if ((d = *pd) != 0) {
+    *pd = d->hnext;
+    d->dinum = 0;
+  }
+  release(&dcache.lock);
+}
+
 // Look up and return the inode for a path name.
 // If parent != 0, return the inode for the parent and copy the final
 // path element into name, which must have room for DIRSIZ bytes.
@@ -981,12 +1618,22 @@ static char *skipelem(char *path, char *name) {
 static struct inode *namex(char *path, int nameiparent, char *name) {
   struct inode *ip, *next;
 
-  if (*path == '/')
-    ip = iget(ROOTDEV, ROOTINO);
-  else
-    ip = idup(namei("/"));
+  uint inum, gen;
+
+  // There are no working directories; every path starts at the root.
+  ip = iget(ROOTDEV, ROOTINO);
 
   while ((path = skipelem(path, name)) != 0) {
+    if (!(nameiparent && *path == '\0') && dcachelookup(ip, name, &inum)) {
+      // Only directories have entries, so ip needs no check.
+      if (inum == 0)
+        goto notfound;
+      next = iget(ip->dev, inum);
+      irelease(ip);
+      ip = next;
+      continue;
+    }
+
     locki(ip);
     if (ip->type != T_DIR) {
       unlocki(ip);
@@ -999,7 +1646,10 @@ static struct inode *namex(char *path, int nameiparent, char *name) {
       return ip;
     }
 
-    if ((next = dirlookup(ip, name, 0)) == 0) {
+    gen = dcache.gen;
+    next = dirlookup(ip, name, 0);
+    dcacheenter(ip, name, next ? next->inum : 0, gen);
+    if (next == 0) {
       unlocki(ip);
       goto notfound;
     }
@@ -1026,71 +1676,3 @@ struct inode *namei(char *path) {
 struct inode *nameiparent(char *path, char *name) {
   return namex(path, 1, name);
 }
-
-
-void update_extra_extents_flag(void){
-
-  struct buf* inodefileblock;
-  struct dinode* dinodelist;
-
-  int breakall = 0;
-
-  int inum = 0;
-
-  for(int i = 27; i < 34; i++){
-    inodefileblock = bread(1, i);
-    dinodelist = (struct dinode*)inodefileblock -> data;
-
-    cprintf("i val reached = %d \n", i);
-
-    for(int j = 0; j < 4; j++){
-      if(dinodelist[j].type == 0 || (i == 33 && j == 1)){
-        breakall = 1;
-        break;
-      }else{
-        //-1 implies no extra extents used
-        //and that all blocks are contiguous
-        dinodelist[j].extra_extents_blk_nums[27] = -1;
-
-        //mark how many blocks are contiguous here
-        dinodelist[j].extra_extents_blk_nums[26] = dinodelist[j].data.nblocks;
-      }
-    }
-    bwrite(inodefileblock);
-    brelse(inodefileblock);
-    if(breakall == 1){
-      break;
-    }
-  }
-
-
-
-  //zero out the remaining files dinodes (useful for later checks to free inodes)
-  for(int i = 33; i < 37; i++){
-
-    inodefileblock = bread(1, i);
-    dinodelist = (struct dinode*)inodefileblock -> data;
-
-    for(int j = 0; j < 4; j++){
-        if(i == 33 && j== 0){
-          continue;
-        }else{
-          //dinodelist[j].type = 0;
-          memset(&dinodelist[j], 0, sizeof(struct dinode));
-        }
-    }
-    bwrite(inodefileblock);
-    brelse(inodefileblock);
-  }
-
-
-
-  icache.inodefile.valid = 0;
-  //synchronize the inode for icacheinodefile
-  locki(&icache.inodefile);
-  unlocki(&icache.inodefile);
-
-
-
-
-}
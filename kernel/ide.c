@@ -1,4 +1,6 @@
-// Simple PIO-based (non-DMA) IDE driver code.
+// Simple IDE driver code.
+// Uses PCI bus-master DMA when the controller supports it (the PIIX
+// IDE function QEMU emulates does), and PIO otherwise.
 
 #include <cdefs.h>
 #include <defs.h>
@@ -24,15 +26,55 @@
 #define IDE_CMD_WRITE 0x30
 #define IDE_CMD_RDMUL 0xc4
 #define IDE_CMD_WRMUL 0xc5
+#define IDE_CMD_SETMULT 0xc6
+#define IDE_CMD_READDMA 0xc8
+#define IDE_CMD_WRITEDMA 0xca
+
+// Bus-master IDE registers for the primary channel, at idebm.
+#define BM_CMD 0
+#define BM_STATUS 2
+#define BM_PRDT 4
+#define BM_CMD_START 0x01
+#define BM_CMD_TOMEM 0x08 // transfer from disk to memory
+#define BM_STATUS_ERR 0x02
+#define BM_STATUS_IRQ 0x04
+
+// Most blocks moved by one DMA request.
+#define IDE_DMAMAX 64
+
+// Physical region descriptor: one contiguous piece of a DMA
+// transfer.  A table of them must not cross a 64KB boundary.
+struct prd {
+  uint32_t addr;
+  uint16_t nbytes;
+  uint16_t flags;
+};
+#define PRD_EOT 0x8000 // last entry in the table
+
+// Sectors per READ/WRITE MULTIPLE data block, and so the most
+// sectors moved by one clustered request.
+#define IDE_MULT 16
 
 // idequeue points to the buf now being read/written to the disk.
 // idequeue->qnext points to the next buf to be processed.
+// The active request covers the first idenbuf bufs on the queue:
+// idestart clusters queued bufs for consecutive blocks of the same
+// disk, in the same direction, into one multiple-sector command.
+// The order of the rest is up to the I/O scheduler (iosched.c).
+// The disk is busy exactly when idequeue is not empty.
 // You must hold idelock while manipulating queue.
 
 static struct spinlock idelock;
 static struct buf *idequeue;
+static int idenbuf;
 
 static int havedisk1;
+static int havevirtio; // disk 1 is the virtio-blk device
+static int idemult[2]; // sectors per data block, 0 if not supported
+
+static ushort idebm;  // bus-master I/O base, 0 if no DMA
+static int idedma;    // active request uses DMA
+static struct prd prdt[IDE_DMAMAX] __attribute__((aligned(sizeof(struct prd) * IDE_DMAMAX)));
 static void idestart(struct buf *);
 
 // Wait for IDE disk to become ready.
@@ -46,10 +88,48 @@ static int idewait(int checkerr) {
   return 0;
 }
 
+// Ask disk d to move IDE_MULT sectors per interrupt for
+// READ/WRITE MULTIPLE.  Returns the setting, or 0 if refused.
+static int idesetmult(int d) {
+  idewait(0);
+  outb(0x3f6, 2); // no interrupt
+  outb(0x1f6, 0xe0 | (d << 4));
+  outb(0x1f2, IDE_MULT);
+  outb(0x1f7, IDE_CMD_SETMULT);
+  if (idewait(1) < 0)
+    return 0;
+  return IDE_MULT;
+}
+
+// Find the PCI IDE controller and enable bus mastering.
+// Returns the bus-master I/O base, or 0 to stay with PIO.
+static ushort idedmainit(void) {
+  int bus, slot, func;
+  uint bar;
+
+  // Class 1 (mass storage), subclass 1 (IDE).
+  if (pcifindclass(1, 1, &bus, &slot, &func) < 0)
+    return 0;
+  if (!(pciconfread(bus, slot, func, 0x08) & 0x8000))
+    return 0; // programming interface lacks bus mastering
+  bar = pciconfread(bus, slot, func, 0x20);
+  if (!(bar & 1) || (bar & ~3) == 0)
+    return 0;
+  // I/O space and bus master enable.
+  pciconfwrite(bus, slot, func, 0x04, pciconfread(bus, slot, func, 0x04) | 0x5);
+  return bar & ~3;
+}
+
+// Can the controller reach b->data with a 32-bit address?
+static int idedmaok(struct buf *b) {
+  return idebm && V2P(b->data) + BSIZE <= 0x100000000UL;
+}
+
 void ideinit(void) {
   int i;
 
   initlock(&idelock, "ide");
+  havevirtio = virtioinit() == 0;
   picenable(IRQ_IDE);
   ioapicenable(IRQ_IDE, ncpu - 1);
   idewait(0);
@@ -63,34 +143,87 @@ void ideinit(void) {
     }
   }
 
+  idemult[0] = idesetmult(0);
+  if (havedisk1)
+    idemult[1] = idesetmult(1);
+  idebm = idedmainit();
+  if (ioschedset(IOSCHED) < 0)
+    panic("ideinit: unknown IOSCHED");
+
   // Switch back to disk 0.
   outb(0x1f6, 0xe0 | (0 << 4));
 }
 
-// Start the request for b.  Caller must hold idelock.
+// Start the request for b, the head of idequeue, together with the
+// bufs queued behind it that continue the same transfer.
+// Caller must hold idelock.
 static void idestart(struct buf *b) {
+  struct buf *q;
+  int i;
+
   if (b == 0)
     panic("idestart");
   if (b->blockno >= FSSIZE)
     panic("incorrect blockno");
   int sector_per_block = BSIZE / SECTOR_SIZE;
   int sector = b->blockno * sector_per_block;
-  int read_cmd = (sector_per_block == 1) ? IDE_CMD_READ : IDE_CMD_RDMUL;
-  int write_cmd = (sector_per_block == 1) ? IDE_CMD_WRITE : IDE_CMD_WRMUL;
+  int mult = idemult[b->dev & 1];
+  int nsector = sector_per_block;
+  int maxsector;
 
   if (sector_per_block > 7)
     panic("idestart");
 
+  idedma = idedmaok(b);
+  maxsector = idedma ? IDE_DMAMAX * sector_per_block : mult;
+  if (sector_per_block > 1 && maxsector < sector_per_block)
+    panic("idestart: no multiple mode");
+
+  // Cluster following bufs for consecutive blocks.
+  idenbuf = 1;
+  for (q = b->qnext; q && nsector + sector_per_block <= maxsector; q = q->qnext) {
+    if (q->dev != b->dev || q->blockno != b->blockno + idenbuf ||
+        (q->flags & B_DIRTY) != (b->flags & B_DIRTY))
+      break;
+    if (idedma && !idedmaok(q))
+      break;
+    nsector += sector_per_block;
+    idenbuf++;
+  }
+  ioschedstart(idenbuf);
+
+  int read_cmd = (nsector == 1) ? IDE_CMD_READ : IDE_CMD_RDMUL;
+  int write_cmd = (nsector == 1) ? IDE_CMD_WRITE : IDE_CMD_WRMUL;
+
+  if (idedma) {
+    // Point the controller at the bufs' data, in order.
+    for (q = b, i = 0; i < idenbuf; i++, q = q->qnext) {
+      prdt[i].addr = V2P(q->data);
+      prdt[i].nbytes = BSIZE;
+      prdt[i].flags = 0;
+    }
+    prdt[idenbuf - 1].flags = PRD_EOT;
+    outl(idebm + BM_PRDT, V2P(prdt));
+    outb(idebm + BM_CMD, (b->flags & B_DIRTY) ? 0 : BM_CMD_TOMEM);
+    outb(idebm + BM_STATUS, BM_STATUS_ERR | BM_STATUS_IRQ); // clear
+    read_cmd = IDE_CMD_READDMA;
+    write_cmd = IDE_CMD_WRITEDMA;
+  }
+
   idewait(0);
   outb(0x3f6, 0);                // generate interrupt
-  outb(0x1f2, sector_per_block); // number of sectors
+  outb(0x1f2, nsector);          // number of sectors
   outb(0x1f3, sector & 0xff);
   outb(0x1f4, (sector >> 8) & 0xff);
   outb(0x1f5, (sector >> 16) & 0xff);
   outb(0x1f6, 0xe0 | ((b->dev & 1) << 4) | ((sector >> 24) & 0x0f));
-  if (b->flags & B_DIRTY) {
+  if (idedma) {
+    outb(0x1f7, (b->flags & B_DIRTY) ? write_cmd : read_cmd);
+    outb(idebm + BM_CMD, inb(idebm + BM_CMD) | BM_CMD_START);
+  } else if (b->flags & B_DIRTY) {
     outb(0x1f7, write_cmd);
-    outsl(0x1f0, b->data, BSIZE / 4);
+    for (q = b, i = 0; i < idenbuf; i++, q = q->qnext)
+      outsl(0x1f0, q->data, BSIZE / 4);
   } else {
     outb(0x1f7, read_cmd);
   }
@@ -99,37 +232,60 @@ static void idestart(struct buf *b) {
 // Interrupt handler.
 void ideintr(void) {
   struct buf *b;
+  int i, ok;
 
-  // First queued buffer is the active request.
+  // The first idenbuf queued buffers are the active request.
   acquire(&idelock);
-  if ((b = idequeue) == 0) {
+  if (idequeue == 0) {
     release(&idelock);
     // cprintf("spurious IDE interrupt\n");
     return;
   }
-  idequeue = b->qnext;
 
-  // Read data if needed.
-  if (!(b->flags & B_DIRTY) && idewait(1) >= 0)
-    insl(0x1f0, b->data, BSIZE / 4);
+  ok = 1;
+  if (idedma) {
+    // Stop the transfer and acknowledge the controller.
+    if (!(inb(idebm + BM_STATUS) & BM_STATUS_IRQ)) {
+      release(&idelock);
+      return; // not done yet
+    }
+    outb(idebm + BM_CMD, 0);
+    if (inb(idebm + BM_STATUS) & BM_STATUS_ERR)
+      ok = 0;
+    outb(idebm + BM_STATUS, BM_STATUS_ERR | BM_STATUS_IRQ);
+  }
+  if (idewait(1) < 0)
+    ok = 0;
+  if (!ok && idedma)
+    panic("ideintr: dma error");
+
+  for (i = 0; i < idenbuf; i++) {
+    b = idequeue;
+    idequeue = b->qnext;
 
-  // Wake process waiting for this buf.
-  b->flags |= B_VALID;
-  b->flags &= ~B_DIRTY;
-  wakeup(b);
+    // Read data if needed.
+    if (!(b->flags & B_DIRTY) && !idedma && ok)
+      insl(0x1f0, b->data, BSIZE / 4);
+
+    // Wake process waiting for this buf.
+    b->flags |= B_VALID;
+    b->flags &= ~B_DIRTY;
+    bdone(b);
+  }
+  ioscheddone(idenbuf);
+  idenbuf = 0;
 
   // Start disk on next buf in queue.
   if (idequeue != 0)
-    idestart(idequeue);
+    idestart(ioschednext(&idequeue));
 
   release(&idelock);
 }
 
-// Sync buf with disk.
-// If B_DIRTY is set, write buf to disk, clear B_DIRTY, set B_VALID.
-// Else if B_VALID is not set, read buf from disk, set B_VALID.
-void iderw(struct buf *b) {
-  struct buf **pp;
+// Check that b is a valid request and add it to idequeue.
+// The caller starts the disk if it was idle.
+// Caller must hold idelock.
+static void idequeueb(struct buf *b) {
 
   if (!holdingsleep(&b->lock))
     panic("iderw: buf not locked");
@@ -138,17 +294,70 @@ void iderw(struct buf *b) {
   if (b->dev != 0 && !havedisk1)
     panic("iderw: ide disk 1 not present");
 
+  ioschedadd(&idequeue, idenbuf, b);
+}
+
+// Start syncing B_ASYNC buf with disk and return without waiting.
+// ideintr calls bdone(b) when the request completes; wait for it
+// with idewaitbuf.
+void idesubmit(struct buf *b) {
+  int idle;
+
+  if (!(b->flags & B_ASYNC))
+    panic("idesubmit: not async");
+  if (b->dev == 1 && havevirtio) {
+    virtiosubmit(b);
+    return;
+  }
+
+  acquire(&idelock);
+  idle = idequeue == 0;
+  idequeueb(b);
+
+  // Start disk if necessary.
+  if (idle)
+    idestart(idequeue);
+
+  release(&idelock);
+}
+
+// Wait for the request idesubmit started for b to complete.
+void idewaitbuf(struct buf *b) {
+  if (b->dev == 1 && havevirtio) {
+    virtiowait(b);
+    return;
+  }
+
+  acquire(&idelock);
+  while ((b->flags & (B_VALID | B_DIRTY)) != B_VALID)
+    sleep(b, &idelock);
+  release(&idelock);
+}
+
+// Disk blocks are not in memory; bufs always hold a copy.
+uchar *idemap(struct buf *b) {
+  return 0;
+}
+
+// Sync buf with disk.
+// If B_DIRTY is set, write buf to disk, clear B_DIRTY, set B_VALID.
+// Else if B_VALID is not set, read buf from disk, set B_VALID.
+void iderw(struct buf *b) {
+  int idle;
+
+  if (b->dev == 1 && havevirtio) {
+    virtiorw(b);
+    return;
+  }
+
   acquire(&idelock); // DOC:acquire-lock
 
-  // Append b to idequeue.
-  b->qnext = 0;
-  for (pp = &idequeue; *pp; pp = &(*pp)->qnext) // DOC:insert-queue
-    ;
-  *pp = b;
+  idle = idequeue == 0;
+  idequeueb(b);
 
   // Start disk if necessary.
-  if (idequeue == b)
-    idestart(b);
+  if (idle)
+    idestart(idequeue);
 
   // Wait for request to finish.
   while ((b->flags & (B_VALID | B_DIRTY)) != B_VALID) {
@@ -157,3 +366,33 @@ void iderw(struct buf *b) {
 
   release(&idelock);
 }
+
+// Sync n bufs with disk, as iderw does for one.  They are queued
+// together, so runs of consecutive blocks become single requests.
+void iderwv(struct buf **bs, int n) {
+  int i, idle;
+
+  if (n == 0)
+    return;
+  if (bs[0]->dev == 1 && havevirtio) {
+    virtiorwv(bs, n);
+    return;
+  }
+
+  acquire(&idelock);
+
+  idle = idequeue == 0;
+  for (i = 0; i < n; i++)
+    idequeueb(bs[i]);
+
+  // Start disk if necessary.
+  if (idle)
+    idestart(idequeue);
+
+  // Wait for all the requests to finish.
+  for (i = 0; i < n; i++)
+    while ((bs[i]->flags & (B_VALID | B_DIRTY)) != B_VALID)
+      sleep(bs[i], &idelock);
+
+  release(&idelock);
+}
@@ -0,0 +1,148 @@
+// Disk request scheduling.
+//
+// A driver keeps its pending bufs on a singly linked queue through
+// qnext.  The first nactive bufs on the queue are the request the
+// disk is working on; the scheduler decides where new bufs go
+// behind them and which buf the next request starts with.  The
+// driver merges runs of bufs for consecutive blocks at the head of
+// the queue into one request, so keeping the queue sorted is also
+// what makes merging work.
+//
+// Schedulers:
+// * fifo: serve bufs in arrival order.
+// * cscan: circular elevator.  Serve bufs in ascending block order
+//     from the disk's current position, then wrap around to the
+//     lowest block, so no region of the disk waits more than one
+//     sweep.  A read that has waited IOREADDEADLINE ticks is moved
+//     to the front anyway: a process is sleeping on it, while
+//     writes are mostly write-back.  The sweep then continues from
+//     that read's block.
+
+#include <cdefs.h>
+#include <defs.h>
+#include <param.h>
+#include <sleeplock.h>
+#include <spinlock.h>
+
+#include <buf.h>
+
+struct iosched {
+  char *name;
+  // Insert b into *q behind the first nactive bufs.
+  void (*insert)(struct buf **q, int nactive, struct buf *b);
+};
+
+int num_io_requests = 0;
+int num_io_merges = 0;
+int io_queue_depth = 0;
+int max_io_queue_depth = 0;
+
+static void fifoinsert(struct buf **q, int nactive, struct buf *b) {
+  struct buf **pp;
+
+  for (pp = q; *pp; pp = &(*pp)->qnext)
+    ;
+  *pp = b;
+}
+
+// Keep the queue in two ascending runs: blocks at or after the disk
+// position first, then the blocks the next sweep will serve.
+static void cscaninsert(struct buf **q, int nactive, struct buf *b) {
+  struct buf **pp, *last;
+  int i, wrapped;
+
+  if (*q == 0) {
+    *q = b;
+    return;
+  }
+
+  // The disk position is the end of the active request (or the
+  // head, if the driver has not started it yet).
+  last = *q;
+  pp = &last->qnext;
+  for (i = 1; i < nactive && *pp; i++) {
+    last = *pp;
+    pp = &last->qnext;
+  }
+
+  wrapped = b->blockno < last->blockno;
+  for (; *pp; pp = &(*pp)->qnext) {
+    if ((*pp)->blockno < last->blockno) {
+      // Start of the second run.
+      if (!wrapped)
+        break;
+      if ((*pp)->blockno > b->blockno)
+        break;
+    } else if (!wrapped && (*pp)->blockno > b->blockno)
+      break;
+  }
+  b->qnext = *pp;
+  *pp = b;
+}
+
+static struct iosched iosched_fifo = { "fifo", fifoinsert };
+static struct iosched iosched_cscan = { "cscan", cscaninsert };
+
+static struct iosched *iosched = &iosched_cscan;
+
+// Add b to the queue *q, whose first nactive bufs are in progress.
+// Caller must hold the driver's queue lock.
+void ioschedadd(struct buf **q, int nactive, struct buf *b) {
+  b->qnext = 0;
+  b->qtime = ticks;
+  iosched->insert(q, nactive, b);
+  if (++io_queue_depth > max_io_queue_depth)
+    max_io_queue_depth = io_queue_depth;
+}
+
+// Choose the head of the next request, after the previous one's
+// bufs have been taken off *q.  Returns the new head.
+// Caller must hold the driver's queue lock.
+struct buf *ioschednext(struct buf **q) {
+  struct buf **pp, **oldest, *b, *rest;
+
+  // Move an overdue read to the front.
+  oldest = 0;
+  for (pp = q; *pp; pp = &(*pp)->qnext)
+    if (!((*pp)->flags & B_DIRTY) &&
+        (oldest == 0 || (*pp)->qtime < (*oldest)->qtime))
+      oldest = pp;
+  if (oldest && oldest != q && ticks - (*oldest)->qtime >= IOREADDEADLINE) {
+    // The disk will be at b next, so insert the other bufs again
+    // behind it; cscan splits them into runs around b's block.
+    b = *oldest;
+    *oldest = b->qnext;
+    rest = *q;
+    b->qnext = 0;
+    *q = b;
+    while (rest) {
+      b = rest;
+      rest = b->qnext;
+      b->qnext = 0;
+      iosched->insert(q, 1, b);
+    }
+  }
+  return *q;
+}
+
+// Account for a request of nbuf bufs started by the driver.
+void ioschedstart(int nbuf) {
+  num_io_requests++;
+  num_io_merges += nbuf - 1;
+}
+
+// Account for nbuf bufs completed by the driver.
+void ioscheddone(int nbuf) {
+  io_queue_depth -= nbuf;
+}
+
+// Select the scheduler by name.  Returns 0, or -1 if unknown.
+int ioschedset(char *name) {
+  if (strncmp(name, iosched_fifo.name, 8) == 0)
+    iosched = &iosched_fifo;
+  else if (strncmp(name, iosched_cscan.name, 8) == 0)
+    iosched = &iosched_cscan;
+  else
+    return -1;
+  return 0;
+}
@@ -17,12 +17,6 @@ int free_pages;
 
 struct core_map_entry *core_map = NULL;
 
-
-struct spinlock cmap_lock;
-
-void cmap_lock_init(void) { initlock(&cmap_lock, "cmap"); }
-
-
 struct core_map_entry *pa2page(uint64_t pa) {
   if (PGNUM(pa) >= npages) {
     cprintf("%x\n", pa);
@@ -60,12 +54,56 @@ void detect_memory(void) {
 void freerange(void *vstart, void *vend);
 extern char end[]; // first address after kernel loaded from ELF file
 
+// Free memory is kept in power-of-two blocks of pages, a buddy
+// allocator: a block of 2^k pages starts at a multiple of 2^k pages,
+// and its buddy is the block of the same size it would merge with.
+// The free blocks of each order are on a list threaded through the
+// core_map entries of their first pages.  A request is served from
+// the smallest free block that fits, split in halves as needed, and
+// a freed block merges with its buddy for as long as the buddy is
+// free as a whole.  kalloc is a single page, so it usually just
+// takes the first entry of the order 0 list.
 struct {
   struct spinlock lock;
   int use_lock;
+  struct core_map_entry *freelist[KMAXORDER + 1];
 } kmem;
 
+// In front of the buddy lists, each CPU keeps a magazine of single
+// free pages that kalloc and kfree use without kmem.lock.  The
+// magazine's own lock is only ever contended when kalloc runs out
+// and empties every CPU's magazine.  An empty magazine is refilled,
+// and a full one drained, by KBATCH pages at a time under kmem.lock.
+// Pages in a magazine are marked available and counted in free_pages,
+// but are not on any free list, so they do not merge with their
+// buddies until drained.
+#define KMAG 16
+#define KBATCH 8
+
+static struct {
+  struct spinlock lock;
+  int n;
+  struct core_map_entry *page[KMAG];
+} kmag[NCPU];
+
+// Pages zeroed ahead of time by the idle loop, for kalloc_zeroed.
+// They are allocated pages, chained through their core_map entries,
+// but are counted in free_pages rather than pages_in_use.
+static struct {
+  struct spinlock lock;
+  int n;
+  struct core_map_entry *head;
+} zpool;
+
+// free_pages and pages_in_use change outside kmem.lock when a
+// magazine is used, so all updates are atomic.
+static void account(int n) {
+  __sync_fetch_and_add(&pages_in_use, n);
+  __sync_fetch_and_sub(&free_pages, n);
+}
+
 static void setrand(unsigned int);
+static struct core_map_entry *zpooltake(void);
 
 // Initialization happens in two phases.
 // 1. main() calls kinit1() while still using entrypgdir to place just
@@ -74,12 +112,16 @@ static void setrand(unsigned int);
 // after installing a full page table that maps them on all cores.
 void mem_init(void *vstart) {
   void *vend;
+  int i;
 
   core_map = vstart;
   memset(vstart, 0, PGROUNDUP(npages * sizeof(struct core_map_entry)));
   vstart += PGROUNDUP(npages * sizeof(struct core_map_entry));
 
   initlock(&kmem.lock, "kmem");
+  initlock(&zpool.lock, "zpool");
+  for (i = 0; i < NCPU; i++)
+    initlock(&kmag[i].lock, "kmag");
   kmem.use_lock = 0;
 
   vend = (void *)P2V((uint64_t)(npages * PGSIZE));
@@ -91,59 +133,187 @@ void mem_init(void *vstart) {
   setrand(1);
 }
 
+// Free the pages in [vstart, vend).  They are freed from the top
+// down, so kalloc hands out low pages first.
 void freerange(void *vstart, void *vend) {
-  char *p;
-  p = (char *)PGROUNDUP((uint64_t)vstart);
-  for (; p + PGSIZE <= (char *)vend; p += PGSIZE)
+  char *p, *lo;
+  lo = (char *)PGROUNDUP((uint64_t)vstart);
+  p = (char *)PGROUNDDOWN((uint64_t)vend);
+  for (p -= PGSIZE; p >= lo; p -= PGSIZE)
     kfree(p);
 }
 
+static void freelistpush(struct core_map_entry *r, int order) {
+  r->order = order;
+  r->prev = NULL;
+  r->next = kmem.freelist[order];
+  if (r->next)
+    r->next->prev = r;
+  kmem.freelist[order] = r;
+}
+
+static void freelistremove(struct core_map_entry *r, int order) {
+  if (r->prev)
+    r->prev->next = r->next;
+  else
+    kmem.freelist[order] = r->next;
+  if (r->next)
+    r->next->prev = r->prev;
+  r->order = -1;
+}
+
+// Put the 2^order pages from r on the free lists, merging with free
+// buddies.  Caller must hold kmem.lock.
+static void freeblock(struct core_map_entry *r, int order) {
+  struct core_map_entry *b;
+  uint64_t i, j;
+
+  i = r - core_map;
+  for (j = 0; j < (1 << order); j++) {
+    r[j].available = 1;
+    r[j].order = -1;
+  }
+  account(-(1 << order));
+
+  for (; order < KMAXORDER; order++) {
+    j = i ^ (1 << order);
+    if (j + (1 << order) > npages)
+      break;
+    b = &core_map[j];
+    if (!b->available || b->order != order)
+      break;
+    freelistremove(b, order);
+    i &= ~(uint64_t)(1 << order);
+  }
+  freelistpush(&core_map[i], order);
+}
+
+// Take a block of 2^order pages off the free lists, splitting a
+// larger block if there is none that size.  Returns 0 if no block is
+// big enough.  Caller must hold kmem.lock.
+static struct core_map_entry *allocblock(int order) {
+  struct core_map_entry *r;
+  uint64_t j;
+  int k;
+
+  for (k = order; k <= KMAXORDER && kmem.freelist[k] == NULL; k++)
+    ;
+  if (k > KMAXORDER)
+    return NULL;
+  r = kmem.freelist[k];
+  freelistremove(r, k);
+  // Keep the low half, free the high half.
+  while (k > order) {
+    k--;
+    freelistpush(r + (1 << k), k);
+  }
+
+  for (j = 0; j < (1 << order); j++)
+    r[j].available = 0;
+  //set the ref count to 1 upon allocation
+  r->ref_count = 1;
+  account(1 << order);
+  return r;
+}
+
+// Move up to KBATCH pages from the free lists into magazine m.
+// Caller holds kmag[m].lock.
+static void magfill(int m) {
+  struct core_map_entry *r;
+  int i;
+
+  acquire(&kmem.lock);
+  for (i = 0; i < KBATCH; i++) {
+    if ((r = allocblock(0)) == NULL)
+      break;
+    r->available = 1;
+    kmag[m].page[kmag[m].n++] = r;
+  }
+  release(&kmem.lock);
+  account(-i);
+}
+
+// Move n pages from magazine m back to the free lists.
+// Caller holds kmag[m].lock.
+static void magdrain(int m, int n) {
+  struct core_map_entry *r;
+  int i;
+
+  acquire(&kmem.lock);
+  for (i = 0; i < n; i++) {
+    r = kmag[m].page[--kmag[m].n];
+    freeblock(r, 0);
+  }
+  release(&kmem.lock);
+  account(n);
+}
+
+// Empty every CPU's magazine, so that pages cached by other CPUs
+// can be allocated and merged.  Returns the number of pages moved.
+static int magdrainall(void) {
+  int m, n;
+
+  n = 0;
+  for (m = 0; m < NCPU; m++) {
+    acquire(&kmag[m].lock);
+    n += kmag[m].n;
+    magdrain(m, kmag[m].n);
+    release(&kmag[m].lock);
+  }
+  return n;
+}
+
 // Free the page of physical memory pointed at by v,
 // which normally should have been returned by a
 // call to kalloc().  (The exception is when
 // initializing the allocator; see kinit above.)
 void kfree(char *v) {
   struct core_map_entry *r;
+  int m;
 
   if ((uint64_t)v % PGSIZE || v < _end || V2P(v) >= (uint64_t)(npages * PGSIZE))
     panic("kfree");
 
-//  cprintf("got to kfree\n");
-
-  if (kmem.use_lock)
-    acquire(&kmem.lock);
-
   r = (struct core_map_entry *)pa2page(V2P(v));
 
-  if(r -> ref_count == 1 || r -> ref_count == 0){
+  // Drop a reference to a shared (copy-on-write) page; the last one
+  // to go frees it.
+  if (r->ref_count > 1 && __sync_sub_and_fetch(&r->ref_count, 1) > 0)
+    return;
 
-  pages_in_use--;
-  free_pages++;
-
- 
+  if (r->available) {
+    //already free, it must not go on the list twice
+    return;
+  }
+  if (r->ref_count < 0) {
+    cprintf("tried to free a page that had 0 references... addr = %p \n", v);
+    return;
+  }
 
+#if KALLOC_DEBUG
   // Fill with junk to catch dangling refs.
   memset(v, 2, PGSIZE);
+#endif
 
-  r->available = 1;
   r->user = 0;
   r->va = 0;
-  if (kmem.use_lock)
-    release(&kmem.lock);
-  }else if(r -> ref_count > 1){
-
-    r -> ref_count--;
-
-    if (kmem.use_lock)
-      release(&kmem.lock);
+  r->ref_count = 0;
 
-  }else{
-    cprintf("tried to free a page that had 0 references... addr = %p \n", v);
-
-    if (kmem.use_lock)
-      release(&kmem.lock);
+  if (!kmem.use_lock) {
+    freeblock(r, 0);
+    return;
   }
 
+  pushcli();
+  m = cpunum();
+  acquire(&kmag[m].lock);
+  popcli();
+  if (kmag[m].n == KMAG)
+    magdrain(m, KBATCH);
+  r->available = 1;
+  kmag[m].page[kmag[m].n++] = r;
+  account(-1);
+  release(&kmag[m].lock);
 }
 
 void
@@ -168,32 +338,140 @@ mark_kernel_mem(uint64_t pa)
 
 char *kalloc(void) {
 
-  int i;
+  return kalloc_order(0);
+}
+
+// Allocate 2^order physically contiguous pages, aligned to their
+// size.  Free them with kfree_order.
+char *kalloc_order(int order) {
+  struct core_map_entry *r;
+  int m;
+
+  if (order < 0 || order > KMAXORDER)
+    return 0;
+
+retry:
+  if (order == 0 && kmem.use_lock) {
+    pushcli();
+    m = cpunum();
+    acquire(&kmag[m].lock);
+    popcli();
+    if (kmag[m].n == 0)
+      magfill(m);
+    r = NULL;
+    if (kmag[m].n > 0) {
+      r = kmag[m].page[--kmag[m].n];
+      r->available = 0;
+      r->ref_count = 1;
+      account(1);
+    }
+    release(&kmag[m].lock);
+  } else {
+    if (kmem.use_lock)
+      acquire(&kmem.lock);
+    r = allocblock(order);
+    if (kmem.use_lock)
+      release(&kmem.lock);
+  }
 
-//  cprintf("got to kalloc\n");
+  if (r)
+    return P2V(page2pa(r));
 
-  if (kmem.use_lock)
-    acquire(&kmem.lock);
+  // Out of pages; take back the ones other CPUs have cached, then
+  // some from the buffer cache, or use a pre-zeroed page.
+  if (kmem.use_lock && magdrainall())
+    goto retry;
+  if (bshrink())
+    goto retry;
+  if (order == 0 && (r = zpooltake()) != NULL)
+    return P2V(page2pa(r));
 
-  for (i = 0; i < npages; i++) {
-    if (core_map[i].available == 1) {
-      core_map[i].available = 0;
-      //set the ref count to 1 upon allocation
-      core_map[i].ref_count = 1;
-      pages_in_use++;
-      free_pages--;
-      if (kmem.use_lock)
-        release(&kmem.lock);
-      return P2V(page2pa(&core_map[i]));
-    }
+  return 0;
+}
+
+// Free 2^order pages from kalloc_order.
+void kfree_order(char *v, int order) {
+  struct core_map_entry *r;
+
+  if (order == 0) {
+    kfree(v);
+    return;
   }
+  if (order < 0 || order > KMAXORDER || (uint64_t)v % (PGSIZE << order) ||
+      v < _end || V2P(v) + (PGSIZE << order) > (uint64_t)(npages * PGSIZE))
+    panic("kfree_order");
+
+#if KALLOC_DEBUG
+  // Fill with junk to catch dangling refs.
+  memset(v, 2, PGSIZE << order);
+#endif
 
+  if (kmem.use_lock)
+    acquire(&kmem.lock);
+  r = pa2page(V2P(v));
+  if (r->available)
+    panic("kfree_order: not allocated");
+  r->user = 0;
+  r->va = 0;
+  freeblock(r, order);
   if (kmem.use_lock)
     release(&kmem.lock);
+}
 
-  return 0;
+
+static struct core_map_entry *zpooltake(void) {
+  struct core_map_entry *r;
+
+  acquire(&zpool.lock);
+  if ((r = zpool.head) != NULL) {
+    zpool.head = r->next;
+    r->next = NULL;
+    zpool.n--;
+  }
+  release(&zpool.lock);
+  if (r != NULL)
+    account(1);
+  return r;
 }
 
+// Allocate a page filled with zeros.
+char *kalloc_zeroed(void) {
+  struct core_map_entry *r;
+  char *v;
+
+  if ((r = zpooltake()) != NULL)
+    return P2V(page2pa(r));
+  if ((v = kalloc()) != 0)
+    memset(v, 0, PGSIZE);
+  return v;
+}
+
+// Zero one page for kalloc_zeroed, if the pool is short and memory
+// is not.  Called by the scheduler when it has nothing to run.
+void kzerofill(void) {
+  struct core_map_entry *r;
+  char *v;
+
+  if (zpool.n >= NZEROPAGES || free_pages < BUFLOWPAGES)
+    return;
+  if ((v = kalloc()) == 0)
+    return;
+  memset(v, 0, PGSIZE);
+
+  r = pa2page(V2P(v));
+  acquire(&zpool.lock);
+  if (zpool.n < NZEROPAGES) {
+    r->next = zpool.head;
+    zpool.head = r;
+    zpool.n++;
+    v = 0;
+  }
+  release(&zpool.lock);
+  if (v)
+    kfree(v);
+  else
+    account(-1);
+}
 
 static unsigned long int next = 1;
 
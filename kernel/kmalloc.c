@@ -0,0 +1,162 @@
+// Slab allocator for small kernel objects.
+//
+// An object cache hands out objects of one size, carved from pages
+// (slabs) taken from kalloc.  Each slab starts with a header naming
+// its cache and holding a list of its free objects, so freeing finds
+// the cache from the object's address alone.  Slabs with free
+// objects are kept on the cache's list; a slab whose objects are all
+// free goes back to kalloc, except for one kept to absorb churn.
+
+#include <cdefs.h>
+#include <defs.h>
+#include <memlayout.h>
+#include <mmu.h>
+#include <param.h>
+#include <spinlock.h>
+
+#define NKMCACHE 16
+
+struct kmobj {
+  struct kmobj *next;
+};
+
+struct slab {
+  struct kmcache *cache;
+  struct slab *prev; // cache's list of slabs with free objects
+  struct slab *next;
+  struct kmobj *free;
+  int inuse;
+};
+
+// Objects start here, aligned for any type.
+#define SLABHDR ((sizeof(struct slab) + 15) & ~15)
+
+struct kmcache {
+  char *name;
+  uint size;
+  int perslab;
+  struct spinlock lock;
+  struct slab *partial; // slabs with a free object
+  int nempty;           // slabs on partial with no object in use
+};
+
+static struct {
+  struct spinlock lock;
+  int n;
+  struct kmcache cache[NKMCACHE];
+} kmcaches;
+
+static struct slab *slabof(void *p) {
+  return (struct slab *)PGROUNDDOWN((uint64_t)p);
+}
+
+static void partialpush(struct kmcache *c, struct slab *s) {
+  s->prev = 0;
+  s->next = c->partial;
+  if (s->next)
+    s->next->prev = s;
+  c->partial = s;
+}
+
+static void partialremove(struct kmcache *c, struct slab *s) {
+  if (s->prev)
+    s->prev->next = s->next;
+  else
+    c->partial = s->next;
+  if (s->next)
+    s->next->prev = s->prev;
+}
+
+// Create a cache of size-byte objects.  Returns 0 if size does not
+// fit in a slab or there are too many caches.
+struct kmcache *kmcache_create(char *name, uint size) {
+  struct kmcache *c;
+
+  size = (max(size, (uint)sizeof(struct kmobj)) + 15) & ~15;
+  if (size > PGSIZE - SLABHDR)
+    return 0;
+
+  acquire(&kmcaches.lock);
+  if (kmcaches.n == NKMCACHE) {
+    release(&kmcaches.lock);
+    return 0;
+  }
+  c = &kmcaches.cache[kmcaches.n++];
+  release(&kmcaches.lock);
+
+  c->name = name;
+  c->size = size;
+  c->perslab = (PGSIZE - SLABHDR) / size;
+  initlock(&c->lock, name);
+  return c;
+}
+
+// Allocate an object from c.  Returns 0 if out of memory.
+void *kmcache_alloc(struct kmcache *c) {
+  struct slab *s;
+  struct kmobj *o;
+  char *p;
+  int i;
+
+  acquire(&c->lock);
+  if ((s = c->partial) == 0) {
+    // No free object; make a new slab without holding c->lock,
+    // since kalloc may have to shrink the buffer cache.
+    release(&c->lock);
+    if ((p = kalloc()) == 0)
+      return 0;
+    s = (struct slab *)p;
+    s->cache = c;
+    s->free = 0;
+    s->inuse = 0;
+    for (i = c->perslab - 1; i >= 0; i--) {
+      o = (struct kmobj *)(p + SLABHDR + i * c->size);
+      o->next = s->free;
+      s->free = o;
+    }
+    acquire(&c->lock);
+    partialpush(c, s);
+    c->nempty++;
+  }
+
+  o = s->free;
+  s->free = o->next;
+  if (s->inuse++ == 0)
+    c->nempty--;
+  if (s->free == 0)
+    partialremove(c, s);
+  release(&c->lock);
+  return o;
+}
+
+// Free an object from kmcache_alloc(c).
+void kmcache_free(struct kmcache *c, void *p) {
+  struct slab *s;
+  struct kmobj *o;
+
+  s = slabof(p);
+  if (s->cache != c || ((char *)p - (char *)s - SLABHDR) % c->size)
+    panic("kmcache_free");
+
+  acquire(&c->lock);
+  o = (struct kmobj *)p;
+  o->next = s->free;
+  s->free = o;
+  if (o->next == 0)
+    partialpush(c, s);
+  if (--s->inuse == 0) {
+    if (c->nempty > 0) {
+      // Already have an empty slab in reserve.
+      partialremove(c, s);
+      release(&c->lock);
+      kfree((char *)s);
+      return;
+    }
+    c->nempty++;
+  }
+  release(&c->lock);
+}
+
+void kmallocinit(void) {
+  initlock(&kmcaches.lock, "kmcaches");
+}
@@ -0,0 +1,250 @@
+#include <cdefs.h>
+#include <defs.h>
+#include <fs.h>
+#include <param.h>
+#include <sleeplock.h>
+#include <spinlock.h>
+
+#include <buf.h>
+
+// Simple logging that allows concurrent FS system calls.
+//
+// A log transaction contains the updates of multiple FS system
+// calls. The logging system only commits when there are
+// no FS system calls active. Thus there is never
+// any reasoning required about whether a commit might
+// write an uncommitted system call's updates to disk.
+//
+// A system call should call begin_op()/end_op() to mark
+// its start and end. Usually begin_op() just increments
+// the count of in-progress FS system calls and returns.
+// But if it thinks the log is close to running out, it
+// sleeps until the last outstanding end_op() commits.
+// Every system call that ends while a commit is pending joins
+// it, so one commit covers them all.
+//
+// Only metadata goes through the log: the bitmap, the inode
+// file and directory blocks.  File data is written back later
+// through the buffer cache (bdwrite), so a crash can lose the
+// data of recent writes but never leaves the metadata half done.
+//
+// The log is a physical re-do log containing disk blocks.
+// The on-disk log format:
+//   header block, containing block #s for block A, B, C, ...
+//   block A
+//   block B
+//   block C
+//   ...
+// Log appends are synchronous.  The log and home blocks a commit
+// or recovery needs are read with bread_async, all started before
+// waiting for any.  A commit writes the logged blocks
+// in one batch, the header, the blocks' home locations in one
+// batch, and finally an empty header.
+
+// Contents of the header block, used for both the on-disk header block
+// and to keep track in memory of logged block# before commit.
+struct logheader {
+  int n;
+  int block[LOGSIZE];
+};
+
+struct log {
+  struct spinlock lock;
+  int start;
+  int size;
+  int outstanding; // how many FS sys calls are executing.
+  int committing;  // in commit(), please wait.
+  int dev;
+  struct logheader lh;
+};
+struct log log;
+
+static void recover_from_log(void);
+static void commit(void);
+
+void initlog(int dev, struct superblock *sb) {
+  if (sizeof(struct logheader) >= BSIZE)
+    panic("initlog: too big logheader");
+  if (sb->nlog < 2)
+    panic("initlog: no log");
+
+  initlock(&log.lock, "log");
+  log.start = sb->logstart;
+  log.size = sb->nlog;
+  log.dev = dev;
+  recover_from_log();
+}
+
+// Copy committed blocks from log to their home location.  When
+// recovering, the blocks are read back from the log; otherwise the
+// pinned cached copies are still there.
+static void install_trans(int recovering) {
+  struct buf *lbuf[LOGSIZE], *dbuf[LOGSIZE];
+  int tail;
+
+  if (!recovering) {
+    for (tail = 0; tail < log.lh.n; tail++)
+      dbuf[tail] = bread(log.dev, log.lh.block[tail]); // pinned, dirty
+  } else {
+    // Start all the reads, then wait for each.
+    for (tail = 0; tail < log.lh.n; tail++) {
+      dbuf[tail] = bread_async(log.dev, log.lh.block[tail]); // read dst
+      lbuf[tail] = bread_async(log.dev, log.start + tail + 1); // read log block
+    }
+    for (tail = 0; tail < log.lh.n; tail++) {
+      bwait(dbuf[tail]);
+      memmove(dbuf[tail]->data, bwait(lbuf[tail])->data, BSIZE);
+      brelse(lbuf[tail]);
+    }
+  }
+  bwritev(dbuf, log.lh.n); // write dst to disk
+  for (tail = 0; tail < log.lh.n; tail++) {
+    if (!recovering)
+      bunpin(dbuf[tail]);
+    brelse(dbuf[tail]);
+  }
+}
+
+// Read the log header from disk into the in-memory log header
+static void read_head(void) {
+  struct buf *buf = bread(log.dev, log.start);
+  struct logheader *lh = (struct logheader *)(buf->data);
+  int i;
+  log.lh.n = lh->n;
+  for (i = 0; i < log.lh.n; i++) {
+    log.lh.block[i] = lh->block[i];
+  }
+  brelse(buf);
+}
+
+// Write in-memory log header to disk.
+// This is the true point at which the
+// current transaction commits.
+static void write_head(void) {
+  struct buf *buf = bread(log.dev, log.start);
+  struct logheader *hb = (struct logheader *)(buf->data);
+  int i;
+  hb->n = log.lh.n;
+  for (i = 0; i < log.lh.n; i++) {
+    hb->block[i] = log.lh.block[i];
+  }
+  bwrite(buf);
+  brelse(buf);
+}
+
+static void recover_from_log(void) {
+  read_head();
+  install_trans(1); // if committed, copy from log to disk
+  log.lh.n = 0;
+  write_head(); // clear the log
+}
+
+// called at the start of each FS system call.
+void begin_op(void) {
+  acquire(&log.lock);
+  while (1) {
+    if (log.committing) {
+      sleep(&log, &log.lock);
+    } else if (log.lh.n + (log.outstanding + 1) * MAXOPBLOCKS > LOGSIZE) {
+      // this op might exhaust log space; wait for commit.
+      sleep(&log, &log.lock);
+    } else {
+      log.outstanding += 1;
+      release(&log.lock);
+      break;
+    }
+  }
+}
+
+// called at the end of each FS system call.
+// commits if this was the last outstanding operation.
+void end_op(void) {
+  int do_commit = 0;
+
+  acquire(&log.lock);
+  log.outstanding -= 1;
+  if (log.committing)
+    panic("log.committing");
+  if (log.outstanding == 0) {
+    do_commit = 1;
+    log.committing = 1;
+  } else {
+    // begin_op() may be waiting for log space,
+    // and decrementing log.outstanding has decreased
+    // the amount of reserved space.
+    wakeup(&log);
+  }
+  release(&log.lock);
+
+  if (do_commit) {
+    // call commit w/o holding locks, since not allowed
+    // to sleep with locks.
+    commit();
+    acquire(&log.lock);
+    log.committing = 0;
+    wakeup(&log);
+    release(&log.lock);
+  }
+}
+
+// Copy modified blocks from cache to log.
+static void write_log(void) {
+  struct buf *to[LOGSIZE], *from;
+  int tail;
+
+  for (tail = 0; tail < log.lh.n; tail++)
+    to[tail] = bread_async(log.dev, log.start + tail + 1); // log block
+  for (tail = 0; tail < log.lh.n; tail++) {
+    from = bread(log.dev, log.lh.block[tail]);             // cache block
+    memmove(bwait(to[tail])->data, from->data, BSIZE);
+    brelse(from);
+  }
+  bwritev(to, log.lh.n); // write the log
+  for (tail = 0; tail < log.lh.n; tail++)
+    brelse(to[tail]);
+}
+
+static void commit(void) {
+  if (log.lh.n > 0) {
+    write_log();     // Write modified blocks from cache to log
+    write_head();    // Write header to disk -- the real commit
+    install_trans(0); // Now install writes to home locations
+    log.lh.n = 0;
+    write_head(); // Erase the transaction from the log
+  }
+}
+
+// Caller has modified b->data and is done with the buffer.
+// Record the block number and pin in the cache by increasing refcnt.
+// commit()/write_log() will do the disk write.
+//
+// log_write() replaces bwrite(); a typical use is:
+//   bp = bread(...)
+//   modify bp->data[]
+//   log_write(bp)
+//   brelse(bp)
+void log_write(struct buf *b) {
+  int i;
+
+  if (log.lh.n >= LOGSIZE || log.lh.n >= log.size - 1)
+    panic("too big a transaction");
+  if (log.outstanding < 1)
+    panic("log_write outside of trans");
+
+  acquire(&log.lock);
+  for (i = 0; i < log.lh.n; i++) {
+    if (log.lh.block[i] == b->blockno) // log absorbtion
+      break;
+  }
+  log.lh.block[i] = b->blockno;
+  if (i == log.lh.n) { // Add new block to log?
+    bpin(b);
+    log.lh.n++;
+  }
+  // Keep b off the delayed-write list, which it may still be on
+  // from before its block was freed and reused, and from being
+  // recycled until the commit writes it.
+  bundelay(b);
+  b->flags |= B_DIRTY;
+  release(&log.lock);
+}
@@ -12,6 +12,7 @@ int main(uint64_t addr) {
   e820_init(addr);
   detect_memory();
   mem_init(_end); // phys page allocator
+  kmallocinit();  // small object caches
   vspacebootinit();
   mpinit();
   lapicinit();
@@ -19,6 +20,7 @@ int main(uint64_t addr) {
   ioapicinit();
   consoleinit();
   uartinit(); // serial port
+  traceinit();
   cpuid_print();
   e820_print();
   cprintf("\ncpu%d: starting xk\n\n", cpunum());
@@ -28,7 +30,7 @@ int main(uint64_t addr) {
   binit();    // buffer cache
   ideinit();  // disk
   userinit(); // first user process
-  cmap_lock_init();
+  kthread("bflush", bflusher); // writes back delayed writes
   mpmain();
   return 0;
 }
@@ -53,3 +53,36 @@ void iderw(struct buf *b) {
     memmove(b->data, p, BSIZE);
   b->flags |= B_VALID;
 }
+
+// Start syncing B_ASYNC buf with disk.  The memory disk finishes
+// at once, so complete the request before returning.
+void idesubmit(struct buf *b) {
+  if (!(b->flags & B_ASYNC))
+    panic("idesubmit: not async");
+
+  iderw(b);
+  bdone(b);
+}
+
+// Wait for the request idesubmit started for b.  It is already
+// done.
+void idewaitbuf(struct buf *b) {
+  if ((b->flags & (B_VALID | B_DIRTY)) != B_VALID)
+    panic("idewaitbuf: request not done");
+}
+
+// Return the address of b's block inside the memory disk, so the
+// buffer cache can use it in place instead of copying it.
+uchar *idemap(struct buf *b) {
+  if (b->dev != 1 || b->blockno >= disksize)
+    return 0;
+  return memdisk + b->blockno * BSIZE;
+}
+
+// Sync n bufs with disk.
+void iderwv(struct buf **bs, int n) {
+  int i;
+
+  for (i = 0; i < n; i++)
+    iderw(bs[i]);
+}
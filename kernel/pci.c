@@ -0,0 +1,71 @@
+// PCI configuration space access.
+// Uses configuration mechanism #1 (I/O ports 0xCF8/0xCFC),
+// which every PC chipset QEMU emulates supports.
+
+#include <cdefs.h>
+#include <defs.h>
+#include <x86_64.h>
+
+#define PCI_CONFIG_ADDR 0xCF8
+#define PCI_CONFIG_DATA 0xCFC
+
+#define PCI_ID 0x00
+#define PCI_CLASS 0x08
+#define PCI_HEADER 0x0C
+
+static void pcisel(int bus, int slot, int func, int off) {
+  outl(PCI_CONFIG_ADDR, (1U << 31) | (bus << 16) | (slot << 11) |
+                            (func << 8) | (off & 0xFC));
+}
+
+// Read the 32-bit register at off in a function's config space.
+uint pciconfread(int bus, int slot, int func, int off) {
+  pcisel(bus, slot, func, off);
+  return inl(PCI_CONFIG_DATA);
+}
+
+// Write the 32-bit register at off in a function's config space.
+void pciconfwrite(int bus, int slot, int func, int off, uint val) {
+  pcisel(bus, slot, func, off);
+  outl(PCI_CONFIG_DATA, val);
+}
+
+// Find the first function whose config register reg, masked with
+// mask, equals want.  Returns 0 and its location, or -1.
+static int pcisearch(int reg, uint mask, uint want, int *bus, int *slot,
+                     int *func) {
+  int b, s, f, nfunc;
+
+  for (b = 0; b < 256; b++) {
+    for (s = 0; s < 32; s++) {
+      nfunc = 1;
+      for (f = 0; f < nfunc; f++) {
+        if ((pciconfread(b, s, f, PCI_ID) & 0xFFFF) == 0xFFFF)
+          continue;
+        if (f == 0 && (pciconfread(b, s, f, PCI_HEADER) & 0x800000))
+          nfunc = 8; // multi-function device
+        if ((pciconfread(b, s, f, reg) & mask) == want) {
+          *bus = b;
+          *slot = s;
+          *func = f;
+          return 0;
+        }
+      }
+    }
+  }
+  return -1;
+}
+
+// Find the first function with the given class and subclass.
+// Returns 0 and its location, or -1 if there is none.
+int pcifindclass(int class, int subclass, int *bus, int *slot, int *func) {
+  return pcisearch(PCI_CLASS, 0xFFFF0000, (class << 24) | (subclass << 16),
+                   bus, slot, func);
+}
+
+// Find the first function with the given vendor and device IDs.
+// Returns 0 and its location, or -1 if there is none.
+int pcifindid(int vendor, int device, int *bus, int *slot, int *func) {
+  return pcisearch(PCI_ID, 0xFFFFFFFF, (device << 16) | vendor, bus, slot,
+                   func);
+}
@@ -62,6 +62,7 @@ found:
   p->state = EMBRYO;
   p->pid = nextpid++;
   p->killed = 0;
+  p->kfn = 0;
 
   release(&ptable.lock);
 
@@ -117,6 +118,35 @@ void userinit(void) {
   release(&ptable.lock);
 }
 
+// A kernel thread's first scheduling by scheduler() will swtch
+// here; run the thread's function (see kthread).
+static void kthreadret(void) {
+  // Still holding ptable.lock from scheduler.
+  release(&ptable.lock);
+
+  myproc()->kfn();
+  panic("kthread returned");
+}
+
+// Start a kernel thread running fn, which must never return.
+// Kernel threads have no user memory and never leave the kernel.
+void kthread(char *name, void (*fn)(void)) {
+  struct proc *p;
+
+  if ((p = allocproc()) == 0)
+    panic("kthread: no proc");
+  if (vspaceinit(&p->vspace) < 0)
+    panic("kthread: no page table");
+
+  p->kfn = fn;
+  p->context->rip = (uint64_t)kthreadret;
+  safestrcpy(p->name, name, sizeof(p->name));
+
+  acquire(&ptable.lock);
+  p->state = RUNNABLE;
+  release(&ptable.lock);
+}
+
 // Create a new process copying p as the parent.
 // Sets up stack to return as if from system call.
 // Caller must set state of returned proc to RUNNABLE.
@@ -383,16 +413,19 @@ int wait(void) {
 //      via swtch back to the scheduler.
 void scheduler(void) {
   struct proc *p;
+  int ran;
 
   for (;;) {
     // Enable interrupts on this processor.
     sti();
 
     // Loop over process table looking for process to run.
+    ran = 0;
     acquire(&ptable.lock);
     for (p = ptable.proc; p < &ptable.proc[NPROC]; p++) {
       if (p->state != RUNNABLE)
         continue;
+      ran = 1;
 
       // Switch to chosen process.  It is the process's job
       // to release ptable.lock and then reacquire it
@@ -408,6 +441,10 @@ void scheduler(void) {
       mycpu()->proc = 0;
     }
     release(&ptable.lock);
+
+    // Nothing to run; zero a page for kalloc_zeroed meanwhile.
+    if (!ran)
+      kzerofill();
   }
 }
 
@@ -29,6 +29,20 @@ void acquiresleep(struct sleeplock *lk) {
   release(&lk->lk);
 }
 
+// acquire the lock only if it is free; returns 1 on success
+int tryacquiresleep(struct sleeplock *lk) {
+  int r;
+
+  acquire(&lk->lk);
+  r = !lk->locked;
+  if (r) {
+    lk->locked = 1;
+    lk->pid = myproc()->pid;
+  }
+  release(&lk->lk);
+  return r;
+}
+
 // a sleeping lock wakes up a waiting process, if any, on lock release
 void releasesleep(struct sleeplock *lk) {
   acquire(&lk->lk);
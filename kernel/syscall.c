@@ -181,6 +181,8 @@ extern int sys_uptime(void);
 extern int sys_sysinfo(void);
 extern int sys_crashn(void);
 extern int sys_unlink(void);
+extern int sys_sync(void);
+extern int sys_fsync(void);
 
 static int (*syscalls[])(void) = {
     [SYS_fork] = sys_fork,       [SYS_exit] = sys_exit,
@@ -192,7 +194,8 @@ static int (*syscalls[])(void) = {
     [SYS_uptime] = sys_uptime,   [SYS_open] = sys_open,
     [SYS_write] = sys_write,     [SYS_close] = sys_close,
     [SYS_sysinfo] = sys_sysinfo, [SYS_crashn] = sys_crashn,
-    [SYS_unlink] = sys_unlink,
+    [SYS_unlink] = sys_unlink,   [SYS_sync] = sys_sync,
+    [SYS_fsync] = sys_fsync,
 };
 
 void syscall(void) {
@@ -218,6 +221,10 @@ int sys_sysinfo(void) {
   info->free_pages = free_pages;
   info->num_page_faults = num_page_faults;
   info->num_disk_reads = num_disk_reads;
+  info->num_io_requests = num_io_requests;
+  info->num_io_merges = num_io_merges;
+  info->io_queue_depth = io_queue_depth;
+  info->max_io_queue_depth = max_io_queue_depth;
 
   return 0;
 }
@@ -15,6 +15,7 @@
 #include <sleeplock.h>
 #include <spinlock.h>
 #include <stat.h>
+#include <trace.h>
 #include <vspace.h>
 
 #include <buf.h>
@@ -40,8 +41,6 @@ int first_file_allocated = 0;
 
 
 
-//has to do with marking metadata of extra extents for file
-int updated_extra_extents_flag = 0;
 
 
 
@@ -296,66 +295,11 @@ if(myproc() -> proc_ptr_to_global_table[fd] -> is_pipe == 0){
 
       offset = myproc() -> proc_ptr_to_global_table[fd] -> current_offset;
 
-      struct buf* bp;
-
-      int start_block = fd_inode -> data.startblkno+offset/BSIZE;
-      int end_block = fd_inode -> data.startblkno+(offset + size)/BSIZE;
-
-
-      //if trying to read past the end of the file only read to end of file
-      if(size > (fd_inode -> size - offset)) {
-        size = fd_inode -> size - offset;
-      }
-
-      if(size == 0){
-        unlocki(fd_inode);
-        return 0;
-      }
-
-      int current_block = start_block;
-
-      int bytes_left_to_read = size;
-
-      int start_block_extra_extents = fd_inode -> extra_extents_blk_nums[27];
-
-      int block_pos = offset%BSIZE;
-
-      while(bytes_left_to_read > 0){
-
-        //all blocks are contiguous
-        if(start_block_extra_extents == -1){
-
-          bp = bread(fd_inode -> dev, current_block);
-
-          for(int i = block_pos; i < BSIZE; i++){
-            buf[size - bytes_left_to_read] = bp -> data[i];
-
-            bytes_left_to_read--;
-
-            if(bytes_left_to_read == 0){
-              break;
-            }
-
-          }
-
-          //reset to start for each new block
-          block_pos = 0;
-
-          current_block++;
-
-          //only need release since nothing modified on read
-          brelse(bp);
-
-          
-
-        //some blocks might not be contiguous
-        }else{
-          panic("this need to be implemeneted (sys_read)");
-        }
-
-      }
-
-      bytes_read = size;
+      //read with the open file's own read-ahead state, so the blocks
+      //a sequential reader will want next are fetched early
+      bytes_read = readi_ra(fd_inode, buf, offset, size,
+                            &myproc() -> proc_ptr_to_global_table[fd] -> ra_next,
+                            &myproc() -> proc_ptr_to_global_table[fd] -> ra_window);
 
       acquire(&global_ftable_lock);
       if(bytes_read > 0){
@@ -518,11 +462,6 @@ void pipe_check_if_write_needs_sleep(struct pipe* active_pipe){
  * arg0 is not a file descriptor open for write
  * some address between [arg1,arg1+arg2-1] is invalid
  * arg2 is not positive
- *
- * note that for lab1, the file system does not support writing past
- * the end of the file. Normally this would extend the size of the file
- * allowing the write to complete, to the maximum extent possible
- * provided there is space on the disk.
  */
 
 int sys_write(void) {
@@ -532,25 +471,6 @@ int sys_write(void) {
 //  print_bitmap_block(28);
   // cprintf("GOT HERE\n");
 
-  if(updated_extra_extents_flag == 0){
-
-    struct buf* check_created;
-
-    check_created = bread(1, 33);
-
-    struct dinode* dinode_list = (struct dinode*)(check_created -> data);
-
-    if(dinode_list[0].type == 2 && dinode_list[0].size == 20){
-      brelse(check_created);
-      update_extra_extents_flag();
-      updated_extra_extents_flag = 1;
-    }else{
-      brelse(check_created);
-    }
-
-
-  }
-
   //no files have even been opened so must be error
   if(first_file_allocated == 0){
 
@@ -577,14 +497,14 @@ int sys_write(void) {
   if(valid_fd < 0){
 
     release(&global_ftable_lock);
-    cprintf("err 1\n");
+    trace(TR_SYSCALL, TL_ERROR, "sys_write: bad fd");
     return -1;
   }
 
   //check that the permission of the file isn't read only
   if(myproc() -> proc_ptr_to_global_table[fd] ->permissions == O_RDONLY){
     release(&global_ftable_lock);
-    cprintf("err 2\n");
+    trace(TR_SYSCALL, TL_ERROR, "sys_write: fd is read only");
     return -1;
   }
   //check valid arg int
@@ -593,7 +513,7 @@ int sys_write(void) {
   if(err_code_argint2 < 0){
 
     release(&global_ftable_lock);
-    cprintf("err 3\n");
+    trace(TR_SYSCALL, TL_ERROR, "sys_write: bad size");
     return -1;
   }
 
@@ -601,7 +521,7 @@ int sys_write(void) {
   if(size < 0){
 
     release(&global_ftable_lock);
-    cprintf("err 4\n");
+    trace(TR_SYSCALL, TL_ERROR, "sys_write: negative size");
     return -1;
   }
   //check valid pointer retrieved
@@ -610,7 +530,7 @@ int sys_write(void) {
   if(err_code_argptr < 0){
 
     release(&global_ftable_lock);
-    cprintf("err 5\n");
+    trace(TR_SYSCALL, TL_ERROR, "sys_write: bad buffer");
     return -1;
   }
 
@@ -626,7 +546,7 @@ int sys_write(void) {
     if(fd_inode == NULL){
 
       release(&global_ftable_lock);
-      cprintf("err 6\n");
+      trace(TR_SYSCALL, TL_ERROR, "sys_write: fd has no inode");
       return -1;
     }
 
@@ -649,113 +569,40 @@ int sys_write(void) {
 
 
     }else{
-      //set to error code initially so if bytes aren't written it fails
-      bytes_written = -1;
-
-
-      struct buf* bp;
-      //need to release spinlock before acquiring sleeplock on buf
+      //need to release spinlock before acquiring sleeplock on inode
       release(&global_ftable_lock);
 
-      locki(fd_inode);
-
       offset = myproc() -> proc_ptr_to_global_table[fd] -> current_offset;
 
-      //check the dinode size is capable of holding the data
-      struct dinode fd_dinode;
-      read_dinode(fd_inode -> inum, &fd_dinode);
-
+      //one transaction can only log so many bitmap blocks, so
+      //big writes go in pieces of at most one bitmap block's worth,
+      //and a piece may come up short when writei grows the file in
+      //steps; only a failed piece means the disk is full
+      bytes_written = 0;
+      while(bytes_written < size){
+        int chunk = min(size - bytes_written, BPB * BSIZE);
 
-      int start_block = fd_inode -> data.startblkno+offset/BSIZE;
-      int end_block = fd_inode -> data.startblkno+(offset + size)/BSIZE;
-
-
-      //check if writing past number of blocks allocated for file
-      if(end_block > fd_inode -> data.startblkno + fd_inode -> data.nblocks - 1) {
-        //TODO if we are supposed to offer allocating
-        //more blocks to exisiting files here is where
-        //it can be done
+        begin_op();
+        locki(fd_inode);
+        int n = writei(fd_inode, buf + bytes_written, offset + bytes_written, chunk);
         unlocki(fd_inode);
-        cprintf("inum of error = %d \n", fd_inode -> inum);
-        panic("too much data written to file");
-      }else{
-
-        int size_to_add_to_dinode = 0;
-
-        if((offset+size) > fd_dinode.size){
-          size_to_add_to_dinode = (offset+size) - fd_dinode.size;
-        }
-
-        fd_dinode.size += size_to_add_to_dinode;
-
-        int done_writing = 0;
-
-        int current_block = start_block;
-
-        int bytes_left_to_write = size;
-
-        int start_block_extra_extents = fd_inode -> extra_extents_blk_nums[27];
-
-        int block_pos = offset%BSIZE;
-
-        while(bytes_left_to_write > 0){
-
-          //all extents are contiguous
-          if(start_block_extra_extents == -1){
-            bp = bread(fd_inode -> dev, current_block);
+        end_op();
 
-
-            for(int i = block_pos; i < BSIZE; i++){
-              bp -> data[i] = buf[size - bytes_left_to_write];
-              bytes_left_to_write--;
-              if(bytes_left_to_write == 0){
-                break;
-              }
-            }
-
-            current_block++;
-
-            //reset to 0 for each new block
-            block_pos = 0;
-
-            bwrite(bp);
-            brelse(bp);
-
-          //some extents might not be contiguous
-          }else{
-            panic("this is tested so need to implement");
+        if(n < 0){
+          if(bytes_written == 0){
+            bytes_written = n;
           }
-
+          break;
         }
-
-        bytes_written = size;
-
-        write_dinode(fd_inode -> inum, fd_dinode);
-
-        //need to reacquire lock to update offset in global table
-        acquire(&global_ftable_lock);
-        if(bytes_written > 0){
-          myproc() -> proc_ptr_to_global_table[fd] -> current_offset = myproc() -> proc_ptr_to_global_table[fd] -> current_offset + bytes_written;
-        }
-        release(&global_ftable_lock);
-
-
-        unlocki(fd_inode);
-
-        fd_inode -> valid = 0;
-        locki(fd_inode);
-        unlocki(fd_inode);
-
-
+        bytes_written += n;
       }
 
-
       //need to reacquire lock to update offset in global table
-     // acquire(&global_ftable_lock);
-     // if(bytes_written > 0){
-      //  myproc() -> proc_ptr_to_global_table[fd] -> current_offset = myproc() -> proc_ptr_to_global_table[fd] -> current_offset + bytes_written;
-     // }
-     // release(&global_ftable_lock);
+      acquire(&global_ftable_lock);
+      if(bytes_written > 0){
+        myproc() -> proc_ptr_to_global_table[fd] -> current_offset = myproc() -> proc_ptr_to_global_table[fd] -> current_offset + bytes_written;
+      }
+      release(&global_ftable_lock);
 
       return bytes_written;
 
@@ -778,7 +625,7 @@ int sys_write(void) {
     //because that's an error
     if(active_pipe -> ref_count_readers == 0){
       release(&global_ftable_lock);
-      cprintf("err 7\n");
+      trace(TR_SYSCALL, TL_ERROR, "sys_write: pipe has no readers");
       return -1;
     }
     //if another writer has already began it's write process
@@ -828,7 +675,7 @@ int sys_write(void) {
 
     release(&global_ftable_lock);
 
-    cprintf("bytes written = %d \n", bytes_written);
+    trace(TR_SYSCALL, TL_DEBUG, "sys_write: %d bytes to pipe", bytes_written);
 
     return bytes_written;
 
@@ -1088,7 +935,9 @@ int sys_open(void) {
   //if inode is null and create is set
   if(permission_contains_create && path_inode == NULL){
 
+    begin_op();
     path_inode = create_file_on_disk(path);
+    end_op();
 
   }
 
@@ -1616,21 +1465,18 @@ int sys_unlink(void) {
 
   struct inode* path_inode = namei(path);
 
-  path_inode -> ref--;
-
   //no such file exists
   if(path_inode == NULL){
 
     return -1;
 
   }
-  //synchronize the inode
-  path_inode -> valid = 0;
   locki(path_inode);
   unlocki(path_inode);
 
   //don't allow deleting directory
   if(path_inode -> type == T_DIR ){
+    irelease(path_inode);
     return -1;
   }
 
@@ -1655,11 +1501,61 @@ int sys_unlink(void) {
   release(&global_ftable_lock);
 
   if(safe_to_delete == 0){
+    irelease(path_inode);
     return -1;
   }
 
+  begin_op();
   delete_file(path_inode -> inum);
+  end_op();
+  irelease(path_inode);
+
+  return 0;
+}
+
+/*
+ * write every delayed write in the buffer cache to disk
+ * returns 0
+ */
+int sys_sync(void) {
+  bsync();
+  return 0;
+}
+
+/*
+ * arg0: int [file descriptor]
+ *
+ * write the file's delayed writes to disk, found through the
+ * file's extents. pipes have nothing to write.
+ * returns 0 on success, -1 otherwise
+ *
+ * Error conditions:
+ * arg0 is not an open file descriptor
+ */
+int sys_fsync(void) {
+  int fd;
+  int valid_fd;
+
+  if(first_file_allocated == 0){
+    return -1;
+  }
 
+  acquire(&global_ftable_lock);
+  valid_fd = argfd(0, &fd);
+  struct inode* fd_inode = NULL;
+  if(valid_fd >= 0 && !myproc() -> proc_ptr_to_global_table[fd] -> is_pipe){
+    fd_inode = idup(myproc() -> proc_ptr_to_global_table[fd] -> ref_inode);
+  }
+  release(&global_ftable_lock);
+
+  if(valid_fd < 0){
+    return -1;
+  }
+
+  if(fd_inode != NULL){
+    isync(fd_inode);
+    irelease(fd_inode);
+  }
   return 0;
 }
 
@@ -5,6 +5,7 @@
 #include <mmu.h>
 #include <param.h>
 #include <proc.h>
+#include <trace.h>
 #include <x86_64.h>
 
 
@@ -59,7 +60,7 @@ int sys_sbrk(void) {
    // heap_cursor_initialized = 1;
     myproc() -> heap_cursor = myproc() -> vspace.regions[VR_HEAP].va_base;
     myproc() -> lower_lim_heap_cursor = -1;
-    cprintf("my processes heap cursor is: %d \n", myproc() -> heap_cursor);
+    trace(TR_VM, TL_DEBUG, "sbrk: heap starts at %x", myproc() -> heap_cursor);
   }
 
   int size;
@@ -128,7 +129,7 @@ int sys_sbrk(void) {
 
     int abs_val = 0 - size;
 
-    cprintf("lower limit = %d \n", myproc() -> lower_lim_heap_cursor);
+    trace(TR_VM, TL_DEBUG, "sbrk: lower limit %x", myproc() -> lower_lim_heap_cursor);
 
     //if there isn't enough memory to deallocate treat as if sbrk(0) was called
     if(abs_val > (myproc() -> heap_cursor - myproc() -> vspace.regions[VR_HEAP].va_base) || abs_val > (myproc() -> heap_cursor - myproc() -> lower_lim_heap_cursor)){
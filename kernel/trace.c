@@ -0,0 +1,80 @@
+// Kernel trace ring buffer, see inc/trace.h.
+
+#include <cdefs.h>
+#include <defs.h>
+#include <param.h>
+#include <spinlock.h>
+#include <stdarg.h>
+#include <trace.h>
+
+#define TRACEARGS 4 // arguments kept per event
+
+struct traceev {
+  uint ticks;
+  ushort sys;
+  ushort level;
+  char *fmt;
+  uint64_t arg[TRACEARGS];
+};
+
+static struct {
+  struct spinlock lock;
+  uint next; // events recorded so far
+  struct traceev ev[NTRACE];
+} tracebuf;
+
+void traceinit(void) {
+  initlock(&tracebuf.lock, "trace");
+}
+
+// Record an event.  Called through the trace() macro.
+void tracerec(int sys, int level, char *fmt, ...) {
+  struct traceev *e;
+  va_list ap;
+  int i, n;
+
+  // Each conversion but %% takes one argument.
+  for (i = n = 0; fmt[i]; i++) {
+    if (fmt[i] != '%')
+      continue;
+    if (fmt[i + 1] == '%')
+      i++;
+    else
+      n++;
+  }
+
+  acquire(&tracebuf.lock);
+  e = &tracebuf.ev[tracebuf.next++ % NTRACE];
+  e->ticks = ticks;
+  e->sys = sys;
+  e->level = level;
+  e->fmt = fmt;
+  // Every argument is passed in a full 64-bit slot, so reading
+  // them all as uint64_t is safe; cprintf reads back the right part.
+  va_start(ap, fmt);
+  for (i = 0; i < TRACEARGS; i++)
+    e->arg[i] = i < n ? va_arg(ap, uint64_t) : 0;
+  va_end(ap);
+  release(&tracebuf.lock);
+
+  if (TRACE_CONSOLE) {
+    cprintf(fmt, e->arg[0], e->arg[1], e->arg[2], e->arg[3]);
+    cprintf("\n");
+  }
+}
+
+// Print the recorded events, oldest first.
+void tracedump(void) {
+  struct traceev *e;
+  uint i, start;
+
+  acquire(&tracebuf.lock);
+  start = tracebuf.next > NTRACE ? tracebuf.next - NTRACE : 0;
+  for (i = start; i < tracebuf.next; i++) {
+    e = &tracebuf.ev[i % NTRACE];
+    cprintf("%d %x/%d: ", e->ticks, e->sys, e->level);
+    cprintf(e->fmt, e->arg[0], e->arg[1], e->arg[2], e->arg[3]);
+    cprintf("\n");
+  }
+  release(&tracebuf.lock);
+}
@@ -42,6 +42,13 @@ void trap(struct trap_frame *tf) {
     return;
   }
 
+  // The virtio disk's PCI interrupt line is only known at boot.
+  if (virtioirq >= 0 && tf->trapno == TRAP_IRQ0 + virtioirq) {
+    virtiointr();
+    lapiceoi();
+    goto done;
+  }
+
   switch (tf->trapno) {
   case TRAP_IRQ0 + IRQ_TIMER:
     if (cpunum() == 0) {
@@ -126,20 +133,9 @@ void trap(struct trap_frame *tf) {
           uint64_t pa = (addr_info -> ppn << PT_SHIFT);
 
           //the physical page lost a reference since the writer is now going
-          //to point to the newly created page, so decrement old pages ref count
-          acquire(&cmap_lock);
-
-          //get the corresponding core map entry
-          struct core_map_entry* cmap_entry = pa2page(pa);
-
-          //increase the reference count
-          cmap_entry -> ref_count--;
-
-          if(cmap_entry -> ref_count == 0){
-            kfree(P2V(addr_info->ppn << PT_SHIFT));
-          }
-
-          release(&cmap_lock);
+          //to point to the newly created page; kfree drops the reference
+          //and frees the page if it was the last one
+          kfree(P2V(pa));
 
           addr_info->ppn = PGNUM(V2P(mem));
           addr_info->writable = VPI_WRITABLE;
@@ -229,21 +225,10 @@ void trap(struct trap_frame *tf) {
           //get the physical address
           uint64_t pa = (addr_info -> ppn << PT_SHIFT);
 
-          //the physical page lost a reference since the writer is now going 
-          //to point to the newly created page, so decrement old pages ref count
-          acquire(&cmap_lock);
-
-          //get the corresponding core map entry
-          struct core_map_entry* cmap_entry = pa2page(pa);
-
-          //increase the reference count
-          cmap_entry -> ref_count--;
-
-          if(cmap_entry -> ref_count == 0){
-            kfree(P2V(addr_info->ppn << PT_SHIFT));
-          }
-
-          release(&cmap_lock);
+          //the physical page lost a reference since the writer is now going
+          //to point to the newly created page; kfree drops the reference
+          //and frees the page if it was the last one
+          kfree(P2V(pa));
 
 
 
@@ -319,6 +304,7 @@ void trap(struct trap_frame *tf) {
     }
   }
 
+done:
   // Force process exit if it has been killed and is in user space.
   // (If it is still executing in the kernel, let it keep running
   // until it gets to the regular system call return.)
@@ -0,0 +1,319 @@
+// Virtio block device driver, legacy (virtio 0.9.5) PCI interface.
+//
+// When QEMU is given a virtio-blk drive (make qemu-virtio), it
+// takes the place of IDE disk 1: ide.c hands requests for dev 1
+// here.  Unlike the IDE disk, the device accepts many requests at
+// once, so every submitted request goes straight to the available
+// ring and completions come back in any order.
+
+#include <cdefs.h>
+#include <defs.h>
+#include <fs.h>
+#include <memlayout.h>
+#include <mmu.h>
+#include <param.h>
+#include <proc.h>
+#include <sleeplock.h>
+#include <spinlock.h>
+#include <trap.h>
+#include <x86_64.h>
+
+#include <buf.h>
+
+#define SECTOR_SIZE 512
+
+// Legacy virtio PCI registers, relative to the I/O BAR.
+#define VIRTIO_HOST_FEATURES 0x00
+#define VIRTIO_GUEST_FEATURES 0x04
+#define VIRTIO_QUEUE_PFN 0x08
+#define VIRTIO_QUEUE_SIZE 0x0C
+#define VIRTIO_QUEUE_SEL 0x0E
+#define VIRTIO_QUEUE_NOTIFY 0x10
+#define VIRTIO_STATUS 0x12
+#define VIRTIO_ISR 0x13
+
+#define VIRTIO_STATUS_ACK 1
+#define VIRTIO_STATUS_DRIVER 2
+#define VIRTIO_STATUS_DRIVER_OK 4
+#define VIRTIO_STATUS_FAILED 128
+
+#define VIRTIO_VENDOR 0x1AF4
+#define VIRTIO_DEV_BLK 0x1001
+
+// Virtqueue layout.
+struct vring_desc {
+  uint64_t addr;
+  uint32_t len;
+  uint16_t flags;
+  uint16_t next;
+};
+#define VRING_DESC_F_NEXT 1
+#define VRING_DESC_F_WRITE 2 // device writes the buffer
+
+struct vring_avail {
+  uint16_t flags;
+  uint16_t idx;
+  uint16_t ring[];
+};
+
+struct vring_used_elem {
+  uint32_t id; // head of the completed descriptor chain
+  uint32_t len;
+};
+
+struct vring_used {
+  uint16_t flags;
+  uint16_t idx;
+  struct vring_used_elem ring[];
+};
+
+// Block request header.
+struct virtio_blk_req {
+  uint32_t type;
+  uint32_t reserved;
+  uint64_t sector;
+};
+#define VIRTIO_BLK_T_IN 0
+#define VIRTIO_BLK_T_OUT 1
+
+// Largest queue we have memory for, and most bufs in one request.
+#define VQMAX 256
+#define VSEGMAX 16
+
+// One request in flight, indexed by its head descriptor.
+struct vreq {
+  struct virtio_blk_req hdr;
+  uchar status;
+  struct buf *b; // first buf; the rest follow through qnext
+  int nbuf;
+};
+
+static struct {
+  struct spinlock lock;
+  ushort iobase;
+  int qsize;
+  struct vring_desc *desc;
+  struct vring_avail *avail;
+  struct vring_used *used;
+  ushort lastused;  // used ring entries already handled
+  ushort freehead;  // free descriptors, chained through next
+  int nfree;
+  struct vreq req[VQMAX];
+} vblk;
+
+// Room for a VQMAX-entry queue: descriptors and available ring,
+// then the used ring on the next page boundary.
+static uchar vqmem[3 * PGSIZE] __attribute__((aligned(PGSIZE)));
+
+int virtioirq = -1;
+
+// Find and set up a virtio-blk device.  Returns 0, or -1 if there
+// is none.
+int virtioinit(void) {
+  int bus, slot, func, i;
+  uint bar;
+
+  if (pcifindid(VIRTIO_VENDOR, VIRTIO_DEV_BLK, &bus, &slot, &func) < 0)
+    return -1;
+  bar = pciconfread(bus, slot, func, 0x10);
+  if (!(bar & 1))
+    return -1;
+  // I/O space and bus master enable.
+  pciconfwrite(bus, slot, func, 0x04, pciconfread(bus, slot, func, 0x04) | 0x5);
+
+  initlock(&vblk.lock, "virtio");
+  vblk.iobase = bar & ~3;
+
+  // Reset, then tell the device we found it and can drive it.
+  outb(vblk.iobase + VIRTIO_STATUS, 0);
+  outb(vblk.iobase + VIRTIO_STATUS, VIRTIO_STATUS_ACK);
+  outb(vblk.iobase + VIRTIO_STATUS, VIRTIO_STATUS_ACK | VIRTIO_STATUS_DRIVER);
+  outl(vblk.iobase + VIRTIO_GUEST_FEATURES, 0); // no optional features
+
+  outw(vblk.iobase + VIRTIO_QUEUE_SEL, 0);
+  vblk.qsize = inw(vblk.iobase + VIRTIO_QUEUE_SIZE);
+  if (vblk.qsize == 0 || vblk.qsize > VQMAX) {
+    // Tell the device we gave up on it.
+    outb(vblk.iobase + VIRTIO_STATUS, VIRTIO_STATUS_FAILED);
+    return -1;
+  }
+
+  memset(vqmem, 0, sizeof(vqmem));
+  vblk.desc = (struct vring_desc *)vqmem;
+  vblk.avail = (struct vring_avail *)(vqmem + vblk.qsize * sizeof(struct vring_desc));
+  vblk.used = (struct vring_used *)(vqmem +
+      PGROUNDUP(vblk.qsize * sizeof(struct vring_desc) + sizeof(struct vring_avail) +
+                (vblk.qsize + 1) * sizeof(uint16_t)));
+  for (i = 0; i < vblk.qsize; i++)
+    vblk.desc[i].next = i + 1;
+  vblk.freehead = 0;
+  vblk.nfree = vblk.qsize;
+  outl(vblk.iobase + VIRTIO_QUEUE_PFN, V2P(vqmem) >> PT_SHIFT);
+
+  virtioirq = pciconfread(bus, slot, func, 0x3C) & 0xFF;
+  picenable(virtioirq);
+  ioapicenable(virtioirq, ncpu - 1);
+
+  outb(vblk.iobase + VIRTIO_STATUS,
+       VIRTIO_STATUS_ACK | VIRTIO_STATUS_DRIVER | VIRTIO_STATUS_DRIVER_OK);
+  return 0;
+}
+
+static int descalloc(void) {
+  int d;
+
+  d = vblk.freehead;
+  vblk.freehead = vblk.desc[d].next;
+  vblk.nfree--;
+  return d;
+}
+
+static void descfree(int d) {
+  vblk.desc[d].next = vblk.freehead;
+  vblk.freehead = d;
+  vblk.nfree++;
+}
+
+// Hand the device one request for bs[0..n), which are for
+// consecutive blocks and all reads or all writes.
+// Caller must hold vblk.lock.
+static void virtiostart(struct buf **bs, int n) {
+  struct vreq *r;
+  int head, d, i;
+
+  for (i = 0; i < n; i++) {
+    if (!holdingsleep(&bs[i]->lock))
+      panic("iderw: buf not locked");
+    if ((bs[i]->flags & (B_VALID | B_DIRTY)) == B_VALID)
+      panic("iderw: nothing to do");
+  }
+
+  // Header, one descriptor per buf, status.
+  while (vblk.nfree < n + 2)
+    sleep(&vblk.nfree, &vblk.lock);
+
+  head = descalloc();
+  r = &vblk.req[head];
+  r->hdr.type = (bs[0]->flags & B_DIRTY) ? VIRTIO_BLK_T_OUT : VIRTIO_BLK_T_IN;
+  r->hdr.reserved = 0;
+  r->hdr.sector = (uint64_t)bs[0]->blockno * (BSIZE / SECTOR_SIZE);
+  r->status = 0xff;
+  r->b = bs[0];
+  r->nbuf = n;
+
+  vblk.desc[head].addr = V2P(&r->hdr);
+  vblk.desc[head].len = sizeof(r->hdr);
+  vblk.desc[head].flags = VRING_DESC_F_NEXT;
+  d = head;
+  for (i = 0; i < n; i++) {
+    vblk.desc[d].next = descalloc();
+    d = vblk.desc[d].next;
+    vblk.desc[d].addr = V2P(bs[i]->data);
+    vblk.desc[d].len = BSIZE;
+    vblk.desc[d].flags = VRING_DESC_F_NEXT;
+    if (!(bs[i]->flags & B_DIRTY))
+      vblk.desc[d].flags |= VRING_DESC_F_WRITE;
+    bs[i]->qnext = (i + 1 < n) ? bs[i + 1] : 0;
+  }
+  vblk.desc[d].next = descalloc();
+  d = vblk.desc[d].next;
+  vblk.desc[d].addr = V2P(&r->status);
+  vblk.desc[d].len = 1;
+  vblk.desc[d].flags = VRING_DESC_F_WRITE;
+
+  vblk.avail->ring[vblk.avail->idx % vblk.qsize] = head;
+  __sync_synchronize();
+  vblk.avail->idx++;
+  __sync_synchronize();
+  outw(vblk.iobase + VIRTIO_QUEUE_NOTIFY, 0);
+
+  ioschedstart(n);
+  io_queue_depth += n;
+  if (io_queue_depth > max_io_queue_depth)
+    max_io_queue_depth = io_queue_depth;
+}
+
+// Interrupt handler.
+void virtiointr(void) {
+  struct vring_used_elem *e;
+  struct vreq *r;
+  struct buf *b, *next;
+  int d;
+
+  acquire(&vblk.lock);
+  inb(vblk.iobase + VIRTIO_ISR); // acknowledge
+
+  while (vblk.lastused != vblk.used->idx) {
+    __sync_synchronize();
+    e = &vblk.used->ring[vblk.lastused % vblk.qsize];
+    r = &vblk.req[e->id];
+    if (r->status != 0)
+      panic("virtiointr: request failed");
+
+    for (b = r->b; b; b = next) {
+      next = b->qnext;
+      b->flags |= B_VALID;
+      b->flags &= ~B_DIRTY;
+      bdone(b);
+    }
+    ioscheddone(r->nbuf);
+
+    // Free the descriptor chain.
+    for (d = e->id; vblk.desc[d].flags & VRING_DESC_F_NEXT;) {
+      int nd = vblk.desc[d].next;
+      descfree(d);
+      d = nd;
+    }
+    descfree(d);
+    vblk.lastused++;
+  }
+  wakeup(&vblk.nfree);
+
+  release(&vblk.lock);
+}
+
+// Submit bs[0..n), split into runs of consecutive blocks.
+// Caller must hold vblk.lock.
+static void virtiosubmitv(struct buf **bs, int n) {
+  int i, j;
+
+  for (i = 0; i < n; i = j) {
+    for (j = i + 1; j < n && j - i < VSEGMAX; j++)
+      if (bs[j]->blockno != bs[j - 1]->blockno + 1 ||
+          (bs[j]->flags & B_DIRTY) != (bs[i]->flags & B_DIRTY))
+        break;
+    virtiostart(bs + i, j - i);
+  }
+}
+
+// Sync buf with disk, as iderw does.
+void virtiorw(struct buf *b) {
+  virtiorwv(&b, 1);
+}
+
+// Sync n bufs with disk, as iderwv does.
+void virtiorwv(struct buf **bs, int n) {
+  int i;
+
+  acquire(&vblk.lock);
+  virtiosubmitv(bs, n);
+  for (i = 0; i < n; i++)
+    while ((bs[i]->flags & (B_VALID | B_DIRTY)) != B_VALID)
+      sleep(bs[i], &vblk.lock);
+  release(&vblk.lock);
+}
+
+// Start syncing B_ASYNC buf with disk, as idesubmit does.
+void virtiosubmit(struct buf *b) {
+  acquire(&vblk.lock);
+  virtiosubmitv(&b, 1);
+  release(&vblk.lock);
+}
+
+// Wait for b's request to complete, as idewaitbuf does.
+void virtiowait(struct buf *b) {
+  acquire(&vblk.lock);
+  while ((b->flags & (B_VALID | B_DIRTY)) != B_VALID)
+    sleep(b, &vblk.lock);
+  release(&vblk.lock);
+}
@@ -89,10 +89,9 @@ vregionaddmap(struct vregion *vr, uint64_t from_va, uint64_t sz, short present,
     if (!(vpi = va2vpage_info(vr, a)))
       goto addmap_failure;
 
-    mem = kalloc();
+    mem = kalloc_zeroed();
     if (!mem)
       goto addmap_failure;
-    memset(mem, 0, PGSIZE);
 
     vpi->used = 1;
     vpi->present = present;
@@ -494,15 +493,11 @@ copy_vpi_page_cow(struct vpi_page **dst, struct vpi_page *src)
       //get the physical address
       uint64_t pa = (srcvpi -> ppn << PT_SHIFT);
 
-      acquire(&cmap_lock);
-
       //get the corresponding core map entry
       struct core_map_entry* cmap_entry = pa2page(pa);
 
       //increase the reference count
-      cmap_entry -> ref_count++;
-
-      release(&cmap_lock);
+      __sync_fetch_and_add(&cmap_entry -> ref_count, 1);
 
     }
   }
@@ -23,9 +23,10 @@ typedef unsigned char  uchar;
 #define CONSOLE 1
 
 // Disk layout:
-// [ boot block | sb block | free bit map | inode file start | data blocks ]
+// [ boot block | sb block | log | free bit map | inode file start | data blocks ]
 
 int nbitmap = FSSIZE/(BSIZE*8) + 1;
+int nlog = LOGSIZE + 1;  // Header block plus LOGSIZE logged blocks
 int nmeta;    // Number of meta blocks (boot, sb, nlog, inode, bitmap)
 int nblocks;  // Number of data blocks
 
@@ -99,16 +100,18 @@ main(int argc, char *argv[])
   }
 
   // 1 fs block = 1 disk sector
-  nmeta = 2 + nbitmap;
+  nmeta = 2 + nlog + nbitmap;
   nblocks = FSSIZE - nmeta;
 
   sb.size = xint(FSSIZE);
   sb.nblocks = xint(nblocks);
-  sb.bmapstart = xint(2);
-  sb.inodestart = xint(2+nbitmap);
+  sb.nlog = xint(nlog);
+  sb.logstart = xint(2);
+  sb.bmapstart = xint(2+nlog);
+  sb.inodestart = xint(2+nlog+nbitmap);
 
-  printf("nmeta %d (boot, super, bitmap blocks %u) blocks %d total %d\n",
-       nmeta, nbitmap, nblocks, FSSIZE);
+  printf("nmeta %d (boot, super, log blocks %u, bitmap blocks %u) blocks %d total %d\n",
+       nmeta, nlog, nbitmap, nblocks, FSSIZE);
   freeblock = nmeta;     // the first free block that we can allocate
 
   for(i = 0; i < FSSIZE; i++)
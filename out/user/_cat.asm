@@ -0,0 +1,1373 @@
+
+out/user/_cat:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000000000 <cat>:
+#include <stat.h>
+#include <user.h>
+
+char buf[512];
+
+void cat(int fd) {
+   0:	55                   	push   %rbp
+   1:	48 89 e5             	mov    %rsp,%rbp
+   4:	48 83 ec 20          	sub    $0x20,%rsp
+   8:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  int n;
+
+  while ((n = read(fd, buf, sizeof(buf))) > 0) {
+   b:	eb 3c                	jmp    49 <cat+0x49>
+    if (write(1, buf, n) != n) {
+   d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  10:	89 c2                	mov    %eax,%edx
+  12:	48 8d 05 27 0f 00 00 	lea    0xf27(%rip),%rax        # f40 <buf>
+  19:	48 89 c6             	mov    %rax,%rsi
+  1c:	bf 01 00 00 00       	mov    $0x1,%edi
+  21:	e8 b0 08 00 00       	call   8d6 <write>
+  26:	39 45 fc             	cmp    %eax,-0x4(%rbp)
+  29:	74 1e                	je     49 <cat+0x49>
+      printf(1, "cat: write error\n");
+  2b:	48 8d 05 e0 0b 00 00 	lea    0xbe0(%rip),%rax        # c12 <malloc+0x115>
+  32:	48 89 c6             	mov    %rax,%rsi
+  35:	bf 01 00 00 00       	mov    $0x1,%edi
+  3a:	b8 00 00 00 00       	mov    $0x0,%eax
+  3f:	e8 cb 02 00 00       	call   30f <printf>
+      exit();
+  44:	e8 6d 08 00 00       	call   8b6 <exit>
+  while ((n = read(fd, buf, sizeof(buf))) > 0) {
+  49:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  4c:	ba 00 02 00 00       	mov    $0x200,%edx
+  51:	48 8d 0d e8 0e 00 00 	lea    0xee8(%rip),%rcx        # f40 <buf>
+  58:	48 89 ce             	mov    %rcx,%rsi
+  5b:	89 c7                	mov    %eax,%edi
+  5d:	e8 6c 08 00 00       	call   8ce <read>
+  62:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  65:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  69:	7f a2                	jg     d <cat+0xd>
+    }
+  }
+  if (n < 0) {
+  6b:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  6f:	79 1e                	jns    8f <cat+0x8f>
+    printf(1, "cat: read error\n");
+  71:	48 8d 05 ac 0b 00 00 	lea    0xbac(%rip),%rax        # c24 <malloc+0x127>
+  78:	48 89 c6             	mov    %rax,%rsi
+  7b:	bf 01 00 00 00       	mov    $0x1,%edi
+  80:	b8 00 00 00 00       	mov    $0x0,%eax
+  85:	e8 85 02 00 00       	call   30f <printf>
+    exit();
+  8a:	e8 27 08 00 00       	call   8b6 <exit>
+  }
+}
+  8f:	90                   	nop
+  90:	c9                   	leave
+  91:	c3                   	ret
+
+0000000000000092 <main>:
+
+int main(int argc, char *argv[]) {
+  92:	55                   	push   %rbp
+  93:	48 89 e5             	mov    %rsp,%rbp
+  96:	48 83 ec 20          	sub    $0x20,%rsp
+  9a:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  9d:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int fd, i;
+
+  if (argc <= 1) {
+  a1:	83 7d ec 01          	cmpl   $0x1,-0x14(%rbp)
+  a5:	7f 0f                	jg     b6 <main+0x24>
+    cat(0);
+  a7:	bf 00 00 00 00       	mov    $0x0,%edi
+  ac:	e8 4f ff ff ff       	call   0 <cat>
+    exit();
+  b1:	e8 00 08 00 00       	call   8b6 <exit>
+  }
+
+  for (i = 1; i < argc; i++) {
+  b6:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+  bd:	eb 7d                	jmp    13c <main+0xaa>
+    if ((fd = open(argv[i], 0)) < 0) {
+  bf:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  c2:	48 98                	cltq
+  c4:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  cb:	00 
+  cc:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  d0:	48 01 d0             	add    %rdx,%rax
+  d3:	48 8b 00             	mov    (%rax),%rax
+  d6:	be 00 00 00 00       	mov    $0x0,%esi
+  db:	48 89 c7             	mov    %rax,%rdi
+  de:	e8 13 08 00 00       	call   8f6 <open>
+  e3:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  e6:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  ea:	79 38                	jns    124 <main+0x92>
+      printf(1, "cat: cannot open %s\n", argv[i]);
+  ec:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  ef:	48 98                	cltq
+  f1:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  f8:	00 
+  f9:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  fd:	48 01 d0             	add    %rdx,%rax
+ 100:	48 8b 00             	mov    (%rax),%rax
+ 103:	48 89 c2             	mov    %rax,%rdx
+ 106:	48 8d 05 28 0b 00 00 	lea    0xb28(%rip),%rax        # c35 <malloc+0x138>
+ 10d:	48 89 c6             	mov    %rax,%rsi
+ 110:	bf 01 00 00 00       	mov    $0x1,%edi
+ 115:	b8 00 00 00 00       	mov    $0x0,%eax
+ 11a:	e8 f0 01 00 00       	call   30f <printf>
+      exit();
+ 11f:	e8 92 07 00 00       	call   8b6 <exit>
+    }
+    cat(fd);
+ 124:	8b 45 f8             	mov    -0x8(%rbp),%eax
+ 127:	89 c7                	mov    %eax,%edi
+ 129:	e8 d2 fe ff ff       	call   0 <cat>
+    close(fd);
+ 12e:	8b 45 f8             	mov    -0x8(%rbp),%eax
+ 131:	89 c7                	mov    %eax,%edi
+ 133:	e8 a6 07 00 00       	call   8de <close>
+  for (i = 1; i < argc; i++) {
+ 138:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+ 13c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 13f:	3b 45 ec             	cmp    -0x14(%rbp),%eax
+ 142:	0f 8c 77 ff ff ff    	jl     bf <main+0x2d>
+  }
+  exit();
+ 148:	e8 69 07 00 00       	call   8b6 <exit>
+
+000000000000014d <putc>:
+#include <cdefs.h>
+#include <stat.h>
+#include <stdarg.h>
+#include <user.h>
+
+static void putc(int fd, char c) { write(fd, &c, 1); }
+ 14d:	55                   	push   %rbp
+ 14e:	48 89 e5             	mov    %rsp,%rbp
+ 151:	48 83 ec 10          	sub    $0x10,%rsp
+ 155:	89 7d fc             	mov    %edi,-0x4(%rbp)
+ 158:	89 f0                	mov    %esi,%eax
+ 15a:	88 45 f8             	mov    %al,-0x8(%rbp)
+ 15d:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+ 161:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 164:	ba 01 00 00 00       	mov    $0x1,%edx
+ 169:	48 89 ce             	mov    %rcx,%rsi
+ 16c:	89 c7                	mov    %eax,%edi
+ 16e:	e8 63 07 00 00       	call   8d6 <write>
+ 173:	90                   	nop
+ 174:	c9                   	leave
+ 175:	c3                   	ret
+
+0000000000000176 <printint64>:
+
+static void printint64(int fd, int xx, int base, int sgn) {
+ 176:	55                   	push   %rbp
+ 177:	48 89 e5             	mov    %rsp,%rbp
+ 17a:	48 83 ec 40          	sub    $0x40,%rsp
+ 17e:	89 7d cc             	mov    %edi,-0x34(%rbp)
+ 181:	89 75 c8             	mov    %esi,-0x38(%rbp)
+ 184:	89 55 c4             	mov    %edx,-0x3c(%rbp)
+ 187:	89 4d c0             	mov    %ecx,-0x40(%rbp)
+  static char digits[] = "0123456789abcdef";
+  char buf[32];
+  int i;
+  uint64_t x;
+
+  if (sgn && (sgn = xx < 0))
+ 18a:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+ 18e:	74 1f                	je     1af <printint64+0x39>
+ 190:	8b 45 c8             	mov    -0x38(%rbp),%eax
+ 193:	c1 e8 1f             	shr    $0x1f,%eax
+ 196:	0f b6 c0             	movzbl %al,%eax
+ 199:	89 45 c0             	mov    %eax,-0x40(%rbp)
+ 19c:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+ 1a0:	74 0d                	je     1af <printint64+0x39>
+    x = -xx;
+ 1a2:	8b 45 c8             	mov    -0x38(%rbp),%eax
+ 1a5:	f7 d8                	neg    %eax
+ 1a7:	48 98                	cltq
+ 1a9:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+ 1ad:	eb 09                	jmp    1b8 <printint64+0x42>
+  else
+    x = xx;
+ 1af:	8b 45 c8             	mov    -0x38(%rbp),%eax
+ 1b2:	48 98                	cltq
+ 1b4:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+  i = 0;
+ 1b8:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  do {
+    buf[i++] = digits[x % base];
+ 1bf:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+ 1c2:	48 63 c8             	movslq %eax,%rcx
+ 1c5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ 1c9:	ba 00 00 00 00       	mov    $0x0,%edx
+ 1ce:	48 f7 f1             	div    %rcx
+ 1d1:	48 89 d1             	mov    %rdx,%rcx
+ 1d4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 1d7:	8d 50 01             	lea    0x1(%rax),%edx
+ 1da:	89 55 fc             	mov    %edx,-0x4(%rbp)
+ 1dd:	48 8d 15 ec 0c 00 00 	lea    0xcec(%rip),%rdx        # ed0 <digits.1>
+ 1e4:	0f b6 14 11          	movzbl (%rcx,%rdx,1),%edx
+ 1e8:	48 98                	cltq
+ 1ea:	88 54 05 d0          	mov    %dl,-0x30(%rbp,%rax,1)
+  } while ((x /= base) != 0);
+ 1ee:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+ 1f1:	48 63 f0             	movslq %eax,%rsi
+ 1f4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ 1f8:	ba 00 00 00 00       	mov    $0x0,%edx
+ 1fd:	48 f7 f6             	div    %rsi
+ 200:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+ 204:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+ 209:	75 b4                	jne    1bf <printint64+0x49>
+
+  if (sgn)
+ 20b:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+ 20f:	74 2b                	je     23c <printint64+0xc6>
+    buf[i++] = '-';
+ 211:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 214:	8d 50 01             	lea    0x1(%rax),%edx
+ 217:	89 55 fc             	mov    %edx,-0x4(%rbp)
+ 21a:	48 98                	cltq
+ 21c:	c6 44 05 d0 2d       	movb   $0x2d,-0x30(%rbp,%rax,1)
+
+  while (--i >= 0)
+ 221:	eb 19                	jmp    23c <printint64+0xc6>
+    putc(fd, buf[i]);
+ 223:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 226:	48 98                	cltq
+ 228:	0f b6 44 05 d0       	movzbl -0x30(%rbp,%rax,1),%eax
+ 22d:	0f be d0             	movsbl %al,%edx
+ 230:	8b 45 cc             	mov    -0x34(%rbp),%eax
+ 233:	89 d6                	mov    %edx,%esi
+ 235:	89 c7                	mov    %eax,%edi
+ 237:	e8 11 ff ff ff       	call   14d <putc>
+  while (--i >= 0)
+ 23c:	83 6d fc 01          	subl   $0x1,-0x4(%rbp)
+ 240:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+ 244:	79 dd                	jns    223 <printint64+0xad>
+}
+ 246:	90                   	nop
+ 247:	90                   	nop
+ 248:	c9                   	leave
+ 249:	c3                   	ret
+
+000000000000024a <printint>:
+
+static void printint(int fd, int xx, int base, int sgn) {
+ 24a:	55                   	push   %rbp
+ 24b:	48 89 e5             	mov    %rsp,%rbp
+ 24e:	48 83 ec 30          	sub    $0x30,%rsp
+ 252:	89 7d dc             	mov    %edi,-0x24(%rbp)
+ 255:	89 75 d8             	mov    %esi,-0x28(%rbp)
+ 258:	89 55 d4             	mov    %edx,-0x2c(%rbp)
+ 25b:	89 4d d0             	mov    %ecx,-0x30(%rbp)
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+ 25e:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+  if (sgn && xx < 0) {
+ 265:	83 7d d0 00          	cmpl   $0x0,-0x30(%rbp)
+ 269:	74 17                	je     282 <printint+0x38>
+ 26b:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+ 26f:	79 11                	jns    282 <printint+0x38>
+    neg = 1;
+ 271:	c7 45 f8 01 00 00 00 	movl   $0x1,-0x8(%rbp)
+    x = -xx;
+ 278:	8b 45 d8             	mov    -0x28(%rbp),%eax
+ 27b:	f7 d8                	neg    %eax
+ 27d:	89 45 f4             	mov    %eax,-0xc(%rbp)
+ 280:	eb 06                	jmp    288 <printint+0x3e>
+  } else {
+    x = xx;
+ 282:	8b 45 d8             	mov    -0x28(%rbp),%eax
+ 285:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  }
+
+  i = 0;
+ 288:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  do {
+    buf[i++] = digits[x % base];
+ 28f:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+ 292:	8b 45 f4             	mov    -0xc(%rbp),%eax
+ 295:	ba 00 00 00 00       	mov    $0x0,%edx
+ 29a:	f7 f1                	div    %ecx
+ 29c:	89 d1                	mov    %edx,%ecx
+ 29e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 2a1:	8d 50 01             	lea    0x1(%rax),%edx
+ 2a4:	89 55 fc             	mov    %edx,-0x4(%rbp)
+ 2a7:	89 c9                	mov    %ecx,%ecx
+ 2a9:	48 8d 15 40 0c 00 00 	lea    0xc40(%rip),%rdx        # ef0 <digits.0>
+ 2b0:	0f b6 14 11          	movzbl (%rcx,%rdx,1),%edx
+ 2b4:	48 98                	cltq
+ 2b6:	88 54 05 e4          	mov    %dl,-0x1c(%rbp,%rax,1)
+  } while ((x /= base) != 0);
+ 2ba:	8b 75 d4             	mov    -0x2c(%rbp),%esi
+ 2bd:	8b 45 f4             	mov    -0xc(%rbp),%eax
+ 2c0:	ba 00 00 00 00       	mov    $0x0,%edx
+ 2c5:	f7 f6                	div    %esi
+ 2c7:	89 45 f4             	mov    %eax,-0xc(%rbp)
+ 2ca:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+ 2ce:	75 bf                	jne    28f <printint+0x45>
+  if (neg)
+ 2d0:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+ 2d4:	74 2b                	je     301 <printint+0xb7>
+    buf[i++] = '-';
+ 2d6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 2d9:	8d 50 01             	lea    0x1(%rax),%edx
+ 2dc:	89 55 fc             	mov    %edx,-0x4(%rbp)
+ 2df:	48 98                	cltq
+ 2e1:	c6 44 05 e4 2d       	movb   $0x2d,-0x1c(%rbp,%rax,1)
+
+  while (--i >= 0)
+ 2e6:	eb 19                	jmp    301 <printint+0xb7>
+    putc(fd, buf[i]);
+ 2e8:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 2eb:	48 98                	cltq
+ 2ed:	0f b6 44 05 e4       	movzbl -0x1c(%rbp,%rax,1),%eax
+ 2f2:	0f be d0             	movsbl %al,%edx
+ 2f5:	8b 45 dc             	mov    -0x24(%rbp),%eax
+ 2f8:	89 d6                	mov    %edx,%esi
+ 2fa:	89 c7                	mov    %eax,%edi
+ 2fc:	e8 4c fe ff ff       	call   14d <putc>
+  while (--i >= 0)
+ 301:	83 6d fc 01          	subl   $0x1,-0x4(%rbp)
+ 305:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+ 309:	79 dd                	jns    2e8 <printint+0x9e>
+}
+ 30b:	90                   	nop
+ 30c:	90                   	nop
+ 30d:	c9                   	leave
+ 30e:	c3                   	ret
+
+000000000000030f <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void printf(int fd, char *fmt, ...) {
+ 30f:	55                   	push   %rbp
+ 310:	48 89 e5             	mov    %rsp,%rbp
+ 313:	48 83 ec 70          	sub    $0x70,%rsp
+ 317:	89 7d 9c             	mov    %edi,-0x64(%rbp)
+ 31a:	48 89 75 90          	mov    %rsi,-0x70(%rbp)
+ 31e:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+ 322:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+ 326:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+ 32a:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+  char *s;
+  int c, i, state;
+  int lflag;
+  va_list valist;
+  va_start(valist, fmt);
+ 32e:	c7 45 a0 10 00 00 00 	movl   $0x10,-0x60(%rbp)
+ 335:	48 8d 45 10          	lea    0x10(%rbp),%rax
+ 339:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+ 33d:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+ 341:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+
+  state = 0;
+ 345:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%rbp)
+  for (i = 0; fmt[i]; i++) {
+ 34c:	c7 45 c4 00 00 00 00 	movl   $0x0,-0x3c(%rbp)
+ 353:	e9 6b 02 00 00       	jmp    5c3 <printf+0x2b4>
+    c = fmt[i] & 0xff;
+ 358:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+ 35b:	48 63 d0             	movslq %eax,%rdx
+ 35e:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+ 362:	48 01 d0             	add    %rdx,%rax
+ 365:	0f b6 00             	movzbl (%rax),%eax
+ 368:	0f be c0             	movsbl %al,%eax
+ 36b:	25 ff 00 00 00       	and    $0xff,%eax
+ 370:	89 45 b8             	mov    %eax,-0x48(%rbp)
+    if (state == 0) {
+ 373:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+ 377:	75 30                	jne    3a9 <printf+0x9a>
+      if (c == '%') {
+ 379:	83 7d b8 25          	cmpl   $0x25,-0x48(%rbp)
+ 37d:	75 13                	jne    392 <printf+0x83>
+        state = '%';
+ 37f:	c7 45 c0 25 00 00 00 	movl   $0x25,-0x40(%rbp)
+        lflag = 0;
+ 386:	c7 45 bc 00 00 00 00 	movl   $0x0,-0x44(%rbp)
+ 38d:	e9 2d 02 00 00       	jmp    5bf <printf+0x2b0>
+      } else {
+        putc(fd, c);
+ 392:	8b 45 b8             	mov    -0x48(%rbp),%eax
+ 395:	0f be d0             	movsbl %al,%edx
+ 398:	8b 45 9c             	mov    -0x64(%rbp),%eax
+ 39b:	89 d6                	mov    %edx,%esi
+ 39d:	89 c7                	mov    %eax,%edi
+ 39f:	e8 a9 fd ff ff       	call   14d <putc>
+ 3a4:	e9 16 02 00 00       	jmp    5bf <printf+0x2b0>
+      }
+    } else if (state == '%') {
+ 3a9:	83 7d c0 25          	cmpl   $0x25,-0x40(%rbp)
+ 3ad:	0f 85 0c 02 00 00    	jne    5bf <printf+0x2b0>
+      if (c == 'l') {
+ 3b3:	83 7d b8 6c          	cmpl   $0x6c,-0x48(%rbp)
+ 3b7:	75 0c                	jne    3c5 <printf+0xb6>
+        lflag = 1;
+ 3b9:	c7 45 bc 01 00 00 00 	movl   $0x1,-0x44(%rbp)
+        continue;
+ 3c0:	e9 fa 01 00 00       	jmp    5bf <printf+0x2b0>
+      } else if (c == 'd') {
+ 3c5:	83 7d b8 64          	cmpl   $0x64,-0x48(%rbp)
+ 3c9:	0f 85 95 00 00 00    	jne    464 <printf+0x155>
+        if (lflag == 1)
+ 3cf:	83 7d bc 01          	cmpl   $0x1,-0x44(%rbp)
+ 3d3:	75 49                	jne    41e <printf+0x10f>
+          printint64(fd, va_arg(valist, int64_t), 10, 1);
+ 3d5:	8b 45 a0             	mov    -0x60(%rbp),%eax
+ 3d8:	83 f8 2f             	cmp    $0x2f,%eax
+ 3db:	77 17                	ja     3f4 <printf+0xe5>
+ 3dd:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+ 3e1:	8b 55 a0             	mov    -0x60(%rbp),%edx
+ 3e4:	89 d2                	mov    %edx,%edx
+ 3e6:	48 01 d0             	add    %rdx,%rax
+ 3e9:	8b 55 a0             	mov    -0x60(%rbp),%edx
+ 3ec:	83 c2 08             	add    $0x8,%edx
+ 3ef:	89 55 a0             	mov    %edx,-0x60(%rbp)
+ 3f2:	eb 0c                	jmp    400 <printf+0xf1>
+ 3f4:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+ 3f8:	48 8d 50 08          	lea    0x8(%rax),%rdx
+ 3fc:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+ 400:	48 8b 00             	mov    (%rax),%rax
+ 403:	89 c6                	mov    %eax,%esi
+ 405:	8b 45 9c             	mov    -0x64(%rbp),%eax
+ 408:	b9 01 00 00 00       	mov    $0x1,%ecx
+ 40d:	ba 0a 00 00 00       	mov    $0xa,%edx
+ 412:	89 c7                	mov    %eax,%edi
+ 414:	e8 5d fd ff ff       	call   176 <printint64>
+ 419:	e9 9a 01 00 00       	jmp    5b8 <printf+0x2a9>
+        else
+          printint(fd, va_arg(valist, int), 10, 1);
+ 41e:	8b 45 a0             	mov    -0x60(%rbp),%eax
+ 421:	83 f8 2f             	cmp    $0x2f,%eax
+ 424:	77 17                	ja     43d <printf+0x12e>
+ 426:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+ 42a:	8b 55 a0             	mov    -0x60(%rbp),%edx
+ 42d:	89 d2                	mov    %edx,%edx
+ 42f:	48 01 d0             	add    %rdx,%rax
+ 432:	8b 55 a0             	mov    -0x60(%rbp),%edx
+ 435:	83 c2 08             	add    $0x8,%edx
+ 438:	89 55 a0             	mov    %edx,-0x60(%rbp)
+ 43b:	eb 0c                	jmp    449 <printf+0x13a>
+ 43d:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+ 441:	48 8d 50 08          	lea    0x8(%rax),%rdx
+ 445:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+ 449:	8b 30                	mov    (%rax),%esi
+ 44b:	8b 45 9c             	mov    -0x64(%rbp),%eax
+ 44e:	b9 01 00 00 00       	mov    $0x1,%ecx
+ 453:	ba 0a 00 00 00       	mov    $0xa,%edx
+ 458:	89 c7                	mov    %eax,%edi
+ 45a:	e8 eb fd ff ff       	call   24a <printint>
+ 45f:	e9 54 01 00 00       	jmp    5b8 <printf+0x2a9>
+      } else if (c == 'x' || c == 'p') {
+ 464:	83 7d b8 78          	cmpl   $0x78,-0x48(%rbp)
+ 468:	74 0a                	je     474 <printf+0x165>
+ 46a:	83 7d b8 70          	cmpl   $0x70,-0x48(%rbp)
+ 46e:	0f 85 95 00 00 00    	jne    509 <printf+0x1fa>
+        if (lflag == 1)
+ 474:	83 7d bc 01          	cmpl   $0x1,-0x44(%rbp)
+ 478:	75 49                	jne    4c3 <printf+0x1b4>
+          printint64(fd, va_arg(valist, int64_t), 16, 0);
+ 47a:	8b 45 a0             	mov    -0x60(%rbp),%eax
+ 47d:	83 f8 2f             	cmp    $0x2f,%eax
+ 480:	77 17                	ja     499 <printf+0x18a>
+ 482:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+ 486:	8b 55 a0             	mov    -0x60(%rbp),%edx
+ 489:	89 d2                	mov    %edx,%edx
+ 48b:	48 01 d0             	add    %rdx,%rax
+ 48e:	8b 55 a0             	mov    -0x60(%rbp),%edx
+ 491:	83 c2 08             	add    $0x8,%edx
+ 494:	89 55 a0             	mov    %edx,-0x60(%rbp)
+ 497:	eb 0c                	jmp    4a5 <printf+0x196>
+ 499:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+ 49d:	48 8d 50 08          	lea    0x8(%rax),%rdx
+ 4a1:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+ 4a5:	48 8b 00             	mov    (%rax),%rax
+ 4a8:	89 c6                	mov    %eax,%esi
+ 4aa:	8b 45 9c             	mov    -0x64(%rbp),%eax
+ 4ad:	b9 00 00 00 00       	mov    $0x0,%ecx
+ 4b2:	ba 10 00 00 00       	mov    $0x10,%edx
+ 4b7:	89 c7                	mov    %eax,%edi
+ 4b9:	e8 b8 fc ff ff       	call   176 <printint64>
+        if (lflag == 1)
+ 4be:	e9 f5 00 00 00       	jmp    5b8 <printf+0x2a9>
+        else
+          printint(fd, va_arg(valist, int), 16, 0);
+ 4c3:	8b 45 a0             	mov    -0x60(%rbp),%eax
+ 4c6:	83 f8 2f             	cmp    $0x2f,%eax
+ 4c9:	77 17                	ja     4e2 <printf+0x1d3>
+ 4cb:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+ 4cf:	8b 55 a0             	mov    -0x60(%rbp),%edx
+ 4d2:	89 d2                	mov    %edx,%edx
+ 4d4:	48 01 d0             	add    %rdx,%rax
+ 4d7:	8b 55 a0             	mov    -0x60(%rbp),%edx
+ 4da:	83 c2 08             	add    $0x8,%edx
+ 4dd:	89 55 a0             	mov    %edx,-0x60(%rbp)
+ 4e0:	eb 0c                	jmp    4ee <printf+0x1df>
+ 4e2:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+ 4e6:	48 8d 50 08          	lea    0x8(%rax),%rdx
+ 4ea:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+ 4ee:	8b 30                	mov    (%rax),%esi
+ 4f0:	8b 45 9c             	mov    -0x64(%rbp),%eax
+ 4f3:	b9 00 00 00 00       	mov    $0x0,%ecx
+ 4f8:	ba 10 00 00 00       	mov    $0x10,%edx
+ 4fd:	89 c7                	mov    %eax,%edi
+ 4ff:	e8 46 fd ff ff       	call   24a <printint>
+        if (lflag == 1)
+ 504:	e9 af 00 00 00       	jmp    5b8 <printf+0x2a9>
+      } else if (c == 's') {
+ 509:	83 7d b8 73          	cmpl   $0x73,-0x48(%rbp)
+ 50d:	75 6e                	jne    57d <printf+0x26e>
+        if ((s = (char *)va_arg(valist, char *)) == 0)
+ 50f:	8b 45 a0             	mov    -0x60(%rbp),%eax
+ 512:	83 f8 2f             	cmp    $0x2f,%eax
+ 515:	77 17                	ja     52e <printf+0x21f>
+ 517:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+ 51b:	8b 55 a0             	mov    -0x60(%rbp),%edx
+ 51e:	89 d2                	mov    %edx,%edx
+ 520:	48 01 d0             	add    %rdx,%rax
+ 523:	8b 55 a0             	mov    -0x60(%rbp),%edx
+ 526:	83 c2 08             	add    $0x8,%edx
+ 529:	89 55 a0             	mov    %edx,-0x60(%rbp)
+ 52c:	eb 0c                	jmp    53a <printf+0x22b>
+ 52e:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+ 532:	48 8d 50 08          	lea    0x8(%rax),%rdx
+ 536:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+ 53a:	48 8b 00             	mov    (%rax),%rax
+ 53d:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+ 541:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+ 546:	75 28                	jne    570 <printf+0x261>
+          s = "(null)";
+ 548:	48 8d 05 fb 06 00 00 	lea    0x6fb(%rip),%rax        # c4a <malloc+0x14d>
+ 54f:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        for (; *s; s++)
+ 553:	eb 1b                	jmp    570 <printf+0x261>
+          putc(fd, *s);
+ 555:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+ 559:	0f b6 00             	movzbl (%rax),%eax
+ 55c:	0f be d0             	movsbl %al,%edx
+ 55f:	8b 45 9c             	mov    -0x64(%rbp),%eax
+ 562:	89 d6                	mov    %edx,%esi
+ 564:	89 c7                	mov    %eax,%edi
+ 566:	e8 e2 fb ff ff       	call   14d <putc>
+        for (; *s; s++)
+ 56b:	48 83 45 c8 01       	addq   $0x1,-0x38(%rbp)
+ 570:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+ 574:	0f b6 00             	movzbl (%rax),%eax
+ 577:	84 c0                	test   %al,%al
+ 579:	75 da                	jne    555 <printf+0x246>
+ 57b:	eb 3b                	jmp    5b8 <printf+0x2a9>
+      } else if (c == '%') {
+ 57d:	83 7d b8 25          	cmpl   $0x25,-0x48(%rbp)
+ 581:	75 14                	jne    597 <printf+0x288>
+        putc(fd, c);
+ 583:	8b 45 b8             	mov    -0x48(%rbp),%eax
+ 586:	0f be d0             	movsbl %al,%edx
+ 589:	8b 45 9c             	mov    -0x64(%rbp),%eax
+ 58c:	89 d6                	mov    %edx,%esi
+ 58e:	89 c7                	mov    %eax,%edi
+ 590:	e8 b8 fb ff ff       	call   14d <putc>
+ 595:	eb 21                	jmp    5b8 <printf+0x2a9>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+ 597:	8b 45 9c             	mov    -0x64(%rbp),%eax
+ 59a:	be 25 00 00 00       	mov    $0x25,%esi
+ 59f:	89 c7                	mov    %eax,%edi
+ 5a1:	e8 a7 fb ff ff       	call   14d <putc>
+        putc(fd, c);
+ 5a6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+ 5a9:	0f be d0             	movsbl %al,%edx
+ 5ac:	8b 45 9c             	mov    -0x64(%rbp),%eax
+ 5af:	89 d6                	mov    %edx,%esi
+ 5b1:	89 c7                	mov    %eax,%edi
+ 5b3:	e8 95 fb ff ff       	call   14d <putc>
+      }
+      state = 0;
+ 5b8:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%rbp)
+  for (i = 0; fmt[i]; i++) {
+ 5bf:	83 45 c4 01          	addl   $0x1,-0x3c(%rbp)
+ 5c3:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+ 5c6:	48 63 d0             	movslq %eax,%rdx
+ 5c9:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+ 5cd:	48 01 d0             	add    %rdx,%rax
+ 5d0:	0f b6 00             	movzbl (%rax),%eax
+ 5d3:	84 c0                	test   %al,%al
+ 5d5:	0f 85 7d fd ff ff    	jne    358 <printf+0x49>
+    }
+  }
+
+  va_end(valist);
+}
+ 5db:	90                   	nop
+ 5dc:	90                   	nop
+ 5dd:	c9                   	leave
+ 5de:	c3                   	ret
+
+00000000000005df <stosb>:
+      break;
+    buf[i++] = c;
+    if (c == '\n' || c == '\r')
+      break;
+  }
+  buf[i] = '\0';
+ 5df:	55                   	push   %rbp
+ 5e0:	48 89 e5             	mov    %rsp,%rbp
+ 5e3:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+ 5e7:	89 75 f4             	mov    %esi,-0xc(%rbp)
+ 5ea:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  return buf;
+ 5ed:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+ 5f1:	8b 55 f0             	mov    -0x10(%rbp),%edx
+ 5f4:	8b 45 f4             	mov    -0xc(%rbp),%eax
+ 5f7:	48 89 ce             	mov    %rcx,%rsi
+ 5fa:	48 89 f7             	mov    %rsi,%rdi
+ 5fd:	89 d1                	mov    %edx,%ecx
+ 5ff:	fc                   	cld
+ 600:	f3 aa                	rep stos %al,%es:(%rdi)
+ 602:	89 ca                	mov    %ecx,%edx
+ 604:	48 89 fe             	mov    %rdi,%rsi
+ 607:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+ 60b:	89 55 f0             	mov    %edx,-0x10(%rbp)
+}
+
+int stat(char *n, struct stat *st) {
+  int fd;
+ 60e:	90                   	nop
+ 60f:	5d                   	pop    %rbp
+ 610:	c3                   	ret
+
+0000000000000611 <strcpy>:
+char *strcpy(char *s, char *t) {
+ 611:	55                   	push   %rbp
+ 612:	48 89 e5             	mov    %rsp,%rbp
+ 615:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+ 619:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  os = s;
+ 61d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 621:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while ((*s++ = *t++) != 0)
+ 625:	90                   	nop
+ 626:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+ 62a:	48 8d 42 01          	lea    0x1(%rdx),%rax
+ 62e:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+ 632:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 636:	48 8d 48 01          	lea    0x1(%rax),%rcx
+ 63a:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+ 63e:	0f b6 12             	movzbl (%rdx),%edx
+ 641:	88 10                	mov    %dl,(%rax)
+ 643:	0f b6 00             	movzbl (%rax),%eax
+ 646:	84 c0                	test   %al,%al
+ 648:	75 dc                	jne    626 <strcpy+0x15>
+  return os;
+ 64a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+ 64e:	5d                   	pop    %rbp
+ 64f:	c3                   	ret
+
+0000000000000650 <strcmp>:
+int strcmp(const char *p, const char *q) {
+ 650:	55                   	push   %rbp
+ 651:	48 89 e5             	mov    %rsp,%rbp
+ 654:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+ 658:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  while (*p && *p == *q)
+ 65c:	eb 0a                	jmp    668 <strcmp+0x18>
+    p++, q++;
+ 65e:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+ 663:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (*p && *p == *q)
+ 668:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 66c:	0f b6 00             	movzbl (%rax),%eax
+ 66f:	84 c0                	test   %al,%al
+ 671:	74 12                	je     685 <strcmp+0x35>
+ 673:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 677:	0f b6 10             	movzbl (%rax),%edx
+ 67a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ 67e:	0f b6 00             	movzbl (%rax),%eax
+ 681:	38 c2                	cmp    %al,%dl
+ 683:	74 d9                	je     65e <strcmp+0xe>
+  return (uchar)*p - (uchar)*q;
+ 685:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 689:	0f b6 00             	movzbl (%rax),%eax
+ 68c:	0f b6 d0             	movzbl %al,%edx
+ 68f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ 693:	0f b6 00             	movzbl (%rax),%eax
+ 696:	0f b6 c0             	movzbl %al,%eax
+ 699:	29 c2                	sub    %eax,%edx
+ 69b:	89 d0                	mov    %edx,%eax
+}
+ 69d:	5d                   	pop    %rbp
+ 69e:	c3                   	ret
+
+000000000000069f <strlen>:
+uint strlen(char *s) {
+ 69f:	55                   	push   %rbp
+ 6a0:	48 89 e5             	mov    %rsp,%rbp
+ 6a3:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  for (n = 0; s[n]; n++)
+ 6a7:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+ 6ae:	eb 04                	jmp    6b4 <strlen+0x15>
+ 6b0:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+ 6b4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 6b7:	48 63 d0             	movslq %eax,%rdx
+ 6ba:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 6be:	48 01 d0             	add    %rdx,%rax
+ 6c1:	0f b6 00             	movzbl (%rax),%eax
+ 6c4:	84 c0                	test   %al,%al
+ 6c6:	75 e8                	jne    6b0 <strlen+0x11>
+  return n;
+ 6c8:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+ 6cb:	5d                   	pop    %rbp
+ 6cc:	c3                   	ret
+
+00000000000006cd <memset>:
+void *memset(void *dst, int c, uint n) {
+ 6cd:	55                   	push   %rbp
+ 6ce:	48 89 e5             	mov    %rsp,%rbp
+ 6d1:	48 83 ec 10          	sub    $0x10,%rsp
+ 6d5:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+ 6d9:	89 75 f4             	mov    %esi,-0xc(%rbp)
+ 6dc:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  stosb(dst, c, n);
+ 6df:	8b 55 f0             	mov    -0x10(%rbp),%edx
+ 6e2:	8b 4d f4             	mov    -0xc(%rbp),%ecx
+ 6e5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 6e9:	89 ce                	mov    %ecx,%esi
+ 6eb:	48 89 c7             	mov    %rax,%rdi
+ 6ee:	e8 ec fe ff ff       	call   5df <stosb>
+  return dst;
+ 6f3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+ 6f7:	c9                   	leave
+ 6f8:	c3                   	ret
+
+00000000000006f9 <strchr>:
+char *strchr(const char *s, char c) {
+ 6f9:	55                   	push   %rbp
+ 6fa:	48 89 e5             	mov    %rsp,%rbp
+ 6fd:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+ 701:	89 f0                	mov    %esi,%eax
+ 703:	88 45 f4             	mov    %al,-0xc(%rbp)
+  for (; *s; s++)
+ 706:	eb 17                	jmp    71f <strchr+0x26>
+    if (*s == c)
+ 708:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 70c:	0f b6 00             	movzbl (%rax),%eax
+ 70f:	38 45 f4             	cmp    %al,-0xc(%rbp)
+ 712:	75 06                	jne    71a <strchr+0x21>
+      return (char *)s;
+ 714:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 718:	eb 15                	jmp    72f <strchr+0x36>
+  for (; *s; s++)
+ 71a:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+ 71f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 723:	0f b6 00             	movzbl (%rax),%eax
+ 726:	84 c0                	test   %al,%al
+ 728:	75 de                	jne    708 <strchr+0xf>
+  return 0;
+ 72a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 72f:	5d                   	pop    %rbp
+ 730:	c3                   	ret
+
+0000000000000731 <gets>:
+char *gets(char *buf, int max) {
+ 731:	55                   	push   %rbp
+ 732:	48 89 e5             	mov    %rsp,%rbp
+ 735:	48 83 ec 20          	sub    $0x20,%rsp
+ 739:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+ 73d:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  for (i = 0; i + 1 < max;) {
+ 740:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+ 747:	eb 48                	jmp    791 <gets+0x60>
+    cc = read(0, &c, 1);
+ 749:	48 8d 45 f7          	lea    -0x9(%rbp),%rax
+ 74d:	ba 01 00 00 00       	mov    $0x1,%edx
+ 752:	48 89 c6             	mov    %rax,%rsi
+ 755:	bf 00 00 00 00       	mov    $0x0,%edi
+ 75a:	e8 6f 01 00 00       	call   8ce <read>
+ 75f:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    if (cc < 1)
+ 762:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+ 766:	7e 36                	jle    79e <gets+0x6d>
+    buf[i++] = c;
+ 768:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 76b:	8d 50 01             	lea    0x1(%rax),%edx
+ 76e:	89 55 fc             	mov    %edx,-0x4(%rbp)
+ 771:	48 63 d0             	movslq %eax,%rdx
+ 774:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 778:	48 01 c2             	add    %rax,%rdx
+ 77b:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+ 77f:	88 02                	mov    %al,(%rdx)
+    if (c == '\n' || c == '\r')
+ 781:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+ 785:	3c 0a                	cmp    $0xa,%al
+ 787:	74 16                	je     79f <gets+0x6e>
+ 789:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+ 78d:	3c 0d                	cmp    $0xd,%al
+ 78f:	74 0e                	je     79f <gets+0x6e>
+  for (i = 0; i + 1 < max;) {
+ 791:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 794:	83 c0 01             	add    $0x1,%eax
+ 797:	39 45 e4             	cmp    %eax,-0x1c(%rbp)
+ 79a:	7f ad                	jg     749 <gets+0x18>
+ 79c:	eb 01                	jmp    79f <gets+0x6e>
+      break;
+ 79e:	90                   	nop
+  buf[i] = '\0';
+ 79f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 7a2:	48 63 d0             	movslq %eax,%rdx
+ 7a5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 7a9:	48 01 d0             	add    %rdx,%rax
+ 7ac:	c6 00 00             	movb   $0x0,(%rax)
+  return buf;
+ 7af:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+ 7b3:	c9                   	leave
+ 7b4:	c3                   	ret
+
+00000000000007b5 <stat>:
+int stat(char *n, struct stat *st) {
+ 7b5:	55                   	push   %rbp
+ 7b6:	48 89 e5             	mov    %rsp,%rbp
+ 7b9:	48 83 ec 20          	sub    $0x20,%rsp
+ 7bd:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+ 7c1:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 7c5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 7c9:	be 00 00 00 00       	mov    $0x0,%esi
+ 7ce:	48 89 c7             	mov    %rax,%rdi
+ 7d1:	e8 20 01 00 00       	call   8f6 <open>
+ 7d6:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  if (fd < 0)
+ 7d9:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+ 7dd:	79 07                	jns    7e6 <stat+0x31>
+    return -1;
+ 7df:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 7e4:	eb 21                	jmp    807 <stat+0x52>
+  r = fstat(fd, st);
+ 7e6:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+ 7ea:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 7ed:	48 89 d6             	mov    %rdx,%rsi
+ 7f0:	89 c7                	mov    %eax,%edi
+ 7f2:	e8 17 01 00 00       	call   90e <fstat>
+ 7f7:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  close(fd);
+ 7fa:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 7fd:	89 c7                	mov    %eax,%edi
+ 7ff:	e8 da 00 00 00       	call   8de <close>
+  return r;
+ 804:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+ 807:	c9                   	leave
+ 808:	c3                   	ret
+
+0000000000000809 <atoi>:
+
+int atoi(const char *s) {
+ 809:	55                   	push   %rbp
+ 80a:	48 89 e5             	mov    %rsp,%rbp
+ 80d:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int n;
+
+  n = 0;
+ 811:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  while ('0' <= *s && *s <= '9')
+ 818:	eb 28                	jmp    842 <atoi+0x39>
+    n = n * 10 + *s++ - '0';
+ 81a:	8b 55 fc             	mov    -0x4(%rbp),%edx
+ 81d:	89 d0                	mov    %edx,%eax
+ 81f:	c1 e0 02             	shl    $0x2,%eax
+ 822:	01 d0                	add    %edx,%eax
+ 824:	01 c0                	add    %eax,%eax
+ 826:	89 c1                	mov    %eax,%ecx
+ 828:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 82c:	48 8d 50 01          	lea    0x1(%rax),%rdx
+ 830:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+ 834:	0f b6 00             	movzbl (%rax),%eax
+ 837:	0f be c0             	movsbl %al,%eax
+ 83a:	01 c8                	add    %ecx,%eax
+ 83c:	83 e8 30             	sub    $0x30,%eax
+ 83f:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while ('0' <= *s && *s <= '9')
+ 842:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 846:	0f b6 00             	movzbl (%rax),%eax
+ 849:	3c 2f                	cmp    $0x2f,%al
+ 84b:	7e 0b                	jle    858 <atoi+0x4f>
+ 84d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 851:	0f b6 00             	movzbl (%rax),%eax
+ 854:	3c 39                	cmp    $0x39,%al
+ 856:	7e c2                	jle    81a <atoi+0x11>
+  return n;
+ 858:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+ 85b:	5d                   	pop    %rbp
+ 85c:	c3                   	ret
+
+000000000000085d <memmove>:
+
+void *memmove(void *vdst, void *vsrc, int n) {
+ 85d:	55                   	push   %rbp
+ 85e:	48 89 e5             	mov    %rsp,%rbp
+ 861:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+ 865:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+ 869:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  char *dst, *src;
+
+  dst = vdst;
+ 86c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 870:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  src = vsrc;
+ 874:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+ 878:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  while (n-- > 0)
+ 87c:	eb 1d                	jmp    89b <memmove+0x3e>
+    *dst++ = *src++;
+ 87e:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+ 882:	48 8d 42 01          	lea    0x1(%rdx),%rax
+ 886:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+ 88a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 88e:	48 8d 48 01          	lea    0x1(%rax),%rcx
+ 892:	48 89 4d f8          	mov    %rcx,-0x8(%rbp)
+ 896:	0f b6 12             	movzbl (%rdx),%edx
+ 899:	88 10                	mov    %dl,(%rax)
+  while (n-- > 0)
+ 89b:	8b 45 dc             	mov    -0x24(%rbp),%eax
+ 89e:	8d 50 ff             	lea    -0x1(%rax),%edx
+ 8a1:	89 55 dc             	mov    %edx,-0x24(%rbp)
+ 8a4:	85 c0                	test   %eax,%eax
+ 8a6:	7f d6                	jg     87e <memmove+0x21>
+  return vdst;
+ 8a8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 8ac:	5d                   	pop    %rbp
+ 8ad:	c3                   	ret
+
+00000000000008ae <fork>:
+  name:                                                                        \
+  movl $SYS_##name, % eax;                                                     \
+  int $TRAP_SYSCALL;                                                           \
+  ret
+
+SYSCALL(fork)
+ 8ae:	b8 01 00 00 00       	mov    $0x1,%eax
+ 8b3:	cd 40                	int    $0x40
+ 8b5:	c3                   	ret
+
+00000000000008b6 <exit>:
+SYSCALL(exit)
+ 8b6:	b8 02 00 00 00       	mov    $0x2,%eax
+ 8bb:	cd 40                	int    $0x40
+ 8bd:	c3                   	ret
+
+00000000000008be <wait>:
+SYSCALL(wait)
+ 8be:	b8 03 00 00 00       	mov    $0x3,%eax
+ 8c3:	cd 40                	int    $0x40
+ 8c5:	c3                   	ret
+
+00000000000008c6 <pipe>:
+SYSCALL(pipe)
+ 8c6:	b8 04 00 00 00       	mov    $0x4,%eax
+ 8cb:	cd 40                	int    $0x40
+ 8cd:	c3                   	ret
+
+00000000000008ce <read>:
+SYSCALL(read)
+ 8ce:	b8 05 00 00 00       	mov    $0x5,%eax
+ 8d3:	cd 40                	int    $0x40
+ 8d5:	c3                   	ret
+
+00000000000008d6 <write>:
+SYSCALL(write)
+ 8d6:	b8 10 00 00 00       	mov    $0x10,%eax
+ 8db:	cd 40                	int    $0x40
+ 8dd:	c3                   	ret
+
+00000000000008de <close>:
+SYSCALL(close)
+ 8de:	b8 15 00 00 00       	mov    $0x15,%eax
+ 8e3:	cd 40                	int    $0x40
+ 8e5:	c3                   	ret
+
+00000000000008e6 <kill>:
+SYSCALL(kill)
+ 8e6:	b8 06 00 00 00       	mov    $0x6,%eax
+ 8eb:	cd 40                	int    $0x40
+ 8ed:	c3                   	ret
+
+00000000000008ee <exec>:
+SYSCALL(exec)
+ 8ee:	b8 07 00 00 00       	mov    $0x7,%eax
+ 8f3:	cd 40                	int    $0x40
+ 8f5:	c3                   	ret
+
+00000000000008f6 <open>:
+SYSCALL(open)
+ 8f6:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 8fb:	cd 40                	int    $0x40
+ 8fd:	c3                   	ret
+
+00000000000008fe <mknod>:
+SYSCALL(mknod)
+ 8fe:	b8 11 00 00 00       	mov    $0x11,%eax
+ 903:	cd 40                	int    $0x40
+ 905:	c3                   	ret
+
+0000000000000906 <unlink>:
+SYSCALL(unlink)
+ 906:	b8 12 00 00 00       	mov    $0x12,%eax
+ 90b:	cd 40                	int    $0x40
+ 90d:	c3                   	ret
+
+000000000000090e <fstat>:
+SYSCALL(fstat)
+ 90e:	b8 08 00 00 00       	mov    $0x8,%eax
+ 913:	cd 40                	int    $0x40
+ 915:	c3                   	ret
+
+0000000000000916 <link>:
+SYSCALL(link)
+ 916:	b8 13 00 00 00       	mov    $0x13,%eax
+ 91b:	cd 40                	int    $0x40
+ 91d:	c3                   	ret
+
+000000000000091e <mkdir>:
+SYSCALL(mkdir)
+ 91e:	b8 14 00 00 00       	mov    $0x14,%eax
+ 923:	cd 40                	int    $0x40
+ 925:	c3                   	ret
+
+0000000000000926 <chdir>:
+SYSCALL(chdir)
+ 926:	b8 09 00 00 00       	mov    $0x9,%eax
+ 92b:	cd 40                	int    $0x40
+ 92d:	c3                   	ret
+
+000000000000092e <dup>:
+SYSCALL(dup)
+ 92e:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 933:	cd 40                	int    $0x40
+ 935:	c3                   	ret
+
+0000000000000936 <getpid>:
+SYSCALL(getpid)
+ 936:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 93b:	cd 40                	int    $0x40
+ 93d:	c3                   	ret
+
+000000000000093e <sbrk>:
+SYSCALL(sbrk)
+ 93e:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 943:	cd 40                	int    $0x40
+ 945:	c3                   	ret
+
+0000000000000946 <sleep>:
+SYSCALL(sleep)
+ 946:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 94b:	cd 40                	int    $0x40
+ 94d:	c3                   	ret
+
+000000000000094e <uptime>:
+SYSCALL(uptime)
+ 94e:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 953:	cd 40                	int    $0x40
+ 955:	c3                   	ret
+
+0000000000000956 <sysinfo>:
+SYSCALL(sysinfo)
+ 956:	b8 16 00 00 00       	mov    $0x16,%eax
+ 95b:	cd 40                	int    $0x40
+ 95d:	c3                   	ret
+
+000000000000095e <crashn>:
+SYSCALL(crashn)
+ 95e:	b8 17 00 00 00       	mov    $0x17,%eax
+ 963:	cd 40                	int    $0x40
+ 965:	c3                   	ret
+
+0000000000000966 <sync>:
+SYSCALL(sync)
+ 966:	b8 18 00 00 00       	mov    $0x18,%eax
+ 96b:	cd 40                	int    $0x40
+ 96d:	c3                   	ret
+
+000000000000096e <fsync>:
+SYSCALL(fsync)
+ 96e:	b8 19 00 00 00       	mov    $0x19,%eax
+ 973:	cd 40                	int    $0x40
+ 975:	c3                   	ret
+
+0000000000000976 <free>:
+typedef union header Header;
+
+static Header base;
+static Header *freep;
+
+void free(void *ap) {
+ 976:	55                   	push   %rbp
+ 977:	48 89 e5             	mov    %rsp,%rbp
+ 97a:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  Header *bp, *p;
+
+  bp = (Header *)ap - 1;
+ 97e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 982:	48 83 e8 10          	sub    $0x10,%rax
+ 986:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  for (p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 98a:	48 8b 05 9f 05 00 00 	mov    0x59f(%rip),%rax        # f30 <freep>
+ 991:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+ 995:	eb 2f                	jmp    9c6 <free+0x50>
+    if (p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 997:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 99b:	48 8b 00             	mov    (%rax),%rax
+ 99e:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+ 9a2:	72 17                	jb     9bb <free+0x45>
+ 9a4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ 9a8:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+ 9ac:	72 2f                	jb     9dd <free+0x67>
+ 9ae:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 9b2:	48 8b 00             	mov    (%rax),%rax
+ 9b5:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+ 9b9:	72 22                	jb     9dd <free+0x67>
+  for (p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 9bb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 9bf:	48 8b 00             	mov    (%rax),%rax
+ 9c2:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+ 9c6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ 9ca:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+ 9ce:	73 c7                	jae    997 <free+0x21>
+ 9d0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 9d4:	48 8b 00             	mov    (%rax),%rax
+ 9d7:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+ 9db:	73 ba                	jae    997 <free+0x21>
+      break;
+  if (bp + bp->s.size == p->s.ptr) {
+ 9dd:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ 9e1:	8b 40 08             	mov    0x8(%rax),%eax
+ 9e4:	89 c0                	mov    %eax,%eax
+ 9e6:	48 c1 e0 04          	shl    $0x4,%rax
+ 9ea:	48 89 c2             	mov    %rax,%rdx
+ 9ed:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ 9f1:	48 01 c2             	add    %rax,%rdx
+ 9f4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 9f8:	48 8b 00             	mov    (%rax),%rax
+ 9fb:	48 39 c2             	cmp    %rax,%rdx
+ 9fe:	75 2d                	jne    a2d <free+0xb7>
+    bp->s.size += p->s.ptr->s.size;
+ a00:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ a04:	8b 50 08             	mov    0x8(%rax),%edx
+ a07:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ a0b:	48 8b 00             	mov    (%rax),%rax
+ a0e:	8b 40 08             	mov    0x8(%rax),%eax
+ a11:	01 c2                	add    %eax,%edx
+ a13:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ a17:	89 50 08             	mov    %edx,0x8(%rax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ a1a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ a1e:	48 8b 00             	mov    (%rax),%rax
+ a21:	48 8b 10             	mov    (%rax),%rdx
+ a24:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ a28:	48 89 10             	mov    %rdx,(%rax)
+ a2b:	eb 0e                	jmp    a3b <free+0xc5>
+  } else
+    bp->s.ptr = p->s.ptr;
+ a2d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ a31:	48 8b 10             	mov    (%rax),%rdx
+ a34:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ a38:	48 89 10             	mov    %rdx,(%rax)
+  if (p + p->s.size == bp) {
+ a3b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ a3f:	8b 40 08             	mov    0x8(%rax),%eax
+ a42:	89 c0                	mov    %eax,%eax
+ a44:	48 c1 e0 04          	shl    $0x4,%rax
+ a48:	48 89 c2             	mov    %rax,%rdx
+ a4b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ a4f:	48 01 d0             	add    %rdx,%rax
+ a52:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+ a56:	75 27                	jne    a7f <free+0x109>
+    p->s.size += bp->s.size;
+ a58:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ a5c:	8b 50 08             	mov    0x8(%rax),%edx
+ a5f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ a63:	8b 40 08             	mov    0x8(%rax),%eax
+ a66:	01 c2                	add    %eax,%edx
+ a68:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ a6c:	89 50 08             	mov    %edx,0x8(%rax)
+    p->s.ptr = bp->s.ptr;
+ a6f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ a73:	48 8b 10             	mov    (%rax),%rdx
+ a76:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ a7a:	48 89 10             	mov    %rdx,(%rax)
+ a7d:	eb 0b                	jmp    a8a <free+0x114>
+  } else
+    p->s.ptr = bp;
+ a7f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ a83:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+ a87:	48 89 10             	mov    %rdx,(%rax)
+  freep = p;
+ a8a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ a8e:	48 89 05 9b 04 00 00 	mov    %rax,0x49b(%rip)        # f30 <freep>
+}
+ a95:	90                   	nop
+ a96:	5d                   	pop    %rbp
+ a97:	c3                   	ret
+
+0000000000000a98 <morecore>:
+
+static Header *morecore(uint nu) {
+ a98:	55                   	push   %rbp
+ a99:	48 89 e5             	mov    %rsp,%rbp
+ a9c:	48 83 ec 20          	sub    $0x20,%rsp
+ aa0:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  char *p;
+  Header *hp;
+
+  if (nu < 4096)
+ aa3:	81 7d ec ff 0f 00 00 	cmpl   $0xfff,-0x14(%rbp)
+ aaa:	77 07                	ja     ab3 <morecore+0x1b>
+    nu = 4096;
+ aac:	c7 45 ec 00 10 00 00 	movl   $0x1000,-0x14(%rbp)
+  p = sbrk(nu * sizeof(Header));
+ ab3:	8b 45 ec             	mov    -0x14(%rbp),%eax
+ ab6:	c1 e0 04             	shl    $0x4,%eax
+ ab9:	89 c7                	mov    %eax,%edi
+ abb:	e8 7e fe ff ff       	call   93e <sbrk>
+ ac0:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (p == (char *)-1)
+ ac4:	48 83 7d f8 ff       	cmpq   $0xffffffffffffffff,-0x8(%rbp)
+ ac9:	75 07                	jne    ad2 <morecore+0x3a>
+    return 0;
+ acb:	b8 00 00 00 00       	mov    $0x0,%eax
+ ad0:	eb 29                	jmp    afb <morecore+0x63>
+  hp = (Header *)p;
+ ad2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ ad6:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  hp->s.size = nu;
+ ada:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ ade:	8b 55 ec             	mov    -0x14(%rbp),%edx
+ ae1:	89 50 08             	mov    %edx,0x8(%rax)
+  free((void *)(hp + 1));
+ ae4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ ae8:	48 83 c0 10          	add    $0x10,%rax
+ aec:	48 89 c7             	mov    %rax,%rdi
+ aef:	e8 82 fe ff ff       	call   976 <free>
+  return freep;
+ af4:	48 8b 05 35 04 00 00 	mov    0x435(%rip),%rax        # f30 <freep>
+}
+ afb:	c9                   	leave
+ afc:	c3                   	ret
+
+0000000000000afd <malloc>:
+
+void *malloc(uint nbytes) {
+ afd:	55                   	push   %rbp
+ afe:	48 89 e5             	mov    %rsp,%rbp
+ b01:	48 83 ec 30          	sub    $0x30,%rsp
+ b05:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1) / sizeof(Header) + 1;
+ b08:	8b 45 dc             	mov    -0x24(%rbp),%eax
+ b0b:	48 83 c0 0f          	add    $0xf,%rax
+ b0f:	48 c1 e8 04          	shr    $0x4,%rax
+ b13:	83 c0 01             	add    $0x1,%eax
+ b16:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  if ((prevp = freep) == 0) {
+ b19:	48 8b 05 10 04 00 00 	mov    0x410(%rip),%rax        # f30 <freep>
+ b20:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+ b24:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+ b29:	75 2e                	jne    b59 <malloc+0x5c>
+    base.s.ptr = freep = prevp = &base;
+ b2b:	48 8d 05 ee 03 00 00 	lea    0x3ee(%rip),%rax        # f20 <base>
+ b32:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+ b36:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ b3a:	48 89 05 ef 03 00 00 	mov    %rax,0x3ef(%rip)        # f30 <freep>
+ b41:	48 8b 05 e8 03 00 00 	mov    0x3e8(%rip),%rax        # f30 <freep>
+ b48:	48 89 05 d1 03 00 00 	mov    %rax,0x3d1(%rip)        # f20 <base>
+    base.s.size = 0;
+ b4f:	c7 05 cf 03 00 00 00 	movl   $0x0,0x3cf(%rip)        # f28 <base+0x8>
+ b56:	00 00 00 
+  }
+  for (p = prevp->s.ptr;; prevp = p, p = p->s.ptr) {
+ b59:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ b5d:	48 8b 00             	mov    (%rax),%rax
+ b60:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    if (p->s.size >= nunits) {
+ b64:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ b68:	8b 40 08             	mov    0x8(%rax),%eax
+ b6b:	3b 45 ec             	cmp    -0x14(%rbp),%eax
+ b6e:	72 5f                	jb     bcf <malloc+0xd2>
+      if (p->s.size == nunits)
+ b70:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ b74:	8b 40 08             	mov    0x8(%rax),%eax
+ b77:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+ b7a:	75 10                	jne    b8c <malloc+0x8f>
+        prevp->s.ptr = p->s.ptr;
+ b7c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ b80:	48 8b 10             	mov    (%rax),%rdx
+ b83:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ b87:	48 89 10             	mov    %rdx,(%rax)
+ b8a:	eb 2e                	jmp    bba <malloc+0xbd>
+      else {
+        p->s.size -= nunits;
+ b8c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ b90:	8b 40 08             	mov    0x8(%rax),%eax
+ b93:	2b 45 ec             	sub    -0x14(%rbp),%eax
+ b96:	89 c2                	mov    %eax,%edx
+ b98:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ b9c:	89 50 08             	mov    %edx,0x8(%rax)
+        p += p->s.size;
+ b9f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ ba3:	8b 40 08             	mov    0x8(%rax),%eax
+ ba6:	89 c0                	mov    %eax,%eax
+ ba8:	48 c1 e0 04          	shl    $0x4,%rax
+ bac:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+        p->s.size = nunits;
+ bb0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ bb4:	8b 55 ec             	mov    -0x14(%rbp),%edx
+ bb7:	89 50 08             	mov    %edx,0x8(%rax)
+      }
+      freep = prevp;
+ bba:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ bbe:	48 89 05 6b 03 00 00 	mov    %rax,0x36b(%rip)        # f30 <freep>
+      return (void *)(p + 1);
+ bc5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ bc9:	48 83 c0 10          	add    $0x10,%rax
+ bcd:	eb 41                	jmp    c10 <malloc+0x113>
+    }
+    if (p == freep)
+ bcf:	48 8b 05 5a 03 00 00 	mov    0x35a(%rip),%rax        # f30 <freep>
+ bd6:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+ bda:	75 1c                	jne    bf8 <malloc+0xfb>
+      if ((p = morecore(nunits)) == 0)
+ bdc:	8b 45 ec             	mov    -0x14(%rbp),%eax
+ bdf:	89 c7                	mov    %eax,%edi
+ be1:	e8 b2 fe ff ff       	call   a98 <morecore>
+ be6:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+ bea:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+ bef:	75 07                	jne    bf8 <malloc+0xfb>
+        return 0;
+ bf1:	b8 00 00 00 00       	mov    $0x0,%eax
+ bf6:	eb 18                	jmp    c10 <malloc+0x113>
+  for (p = prevp->s.ptr;; prevp = p, p = p->s.ptr) {
+ bf8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ bfc:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+ c00:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ c04:	48 8b 00             	mov    (%rax),%rax
+ c07:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    if (p->s.size >= nunits) {
+ c0b:	e9 54 ff ff ff       	jmp    b64 <malloc+0x67>
+  }
+ c10:	c9                   	leave
+ c11:	c3                   	ret
@@ -0,0 +1,1289 @@
+
+out/user/_kill:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000000000 <main>:
+#include <cdefs.h>
+#include <stat.h>
+#include <user.h>
+
+int main(int argc, char **argv) {
+   0:	55                   	push   %rbp
+   1:	48 89 e5             	mov    %rsp,%rbp
+   4:	48 83 ec 20          	sub    $0x20,%rsp
+   8:	89 7d ec             	mov    %edi,-0x14(%rbp)
+   b:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int i;
+
+  if (argc < 2) {
+   f:	83 7d ec 01          	cmpl   $0x1,-0x14(%rbp)
+  13:	7f 1e                	jg     33 <main+0x33>
+    printf(2, "usage: kill pid...\n");
+  15:	48 8d 05 1c 0b 00 00 	lea    0xb1c(%rip),%rax        # b38 <malloc+0x115>
+  1c:	48 89 c6             	mov    %rax,%rsi
+  1f:	bf 02 00 00 00       	mov    $0x2,%edi
+  24:	b8 00 00 00 00       	mov    $0x0,%eax
+  29:	e8 07 02 00 00       	call   235 <printf>
+    exit();
+  2e:	e8 a9 07 00 00       	call   7dc <exit>
+  }
+  for (i = 1; i < argc; i++)
+  33:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+  3a:	eb 2a                	jmp    66 <main+0x66>
+    kill(atoi(argv[i]));
+  3c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  3f:	48 98                	cltq
+  41:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  48:	00 
+  49:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  4d:	48 01 d0             	add    %rdx,%rax
+  50:	48 8b 00             	mov    (%rax),%rax
+  53:	48 89 c7             	mov    %rax,%rdi
+  56:	e8 d4 06 00 00       	call   72f <atoi>
+  5b:	89 c7                	mov    %eax,%edi
+  5d:	e8 aa 07 00 00       	call   80c <kill>
+  for (i = 1; i < argc; i++)
+  62:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  66:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  69:	3b 45 ec             	cmp    -0x14(%rbp),%eax
+  6c:	7c ce                	jl     3c <main+0x3c>
+  exit();
+  6e:	e8 69 07 00 00       	call   7dc <exit>
+
+0000000000000073 <putc>:
+#include <cdefs.h>
+#include <stat.h>
+#include <stdarg.h>
+#include <user.h>
+
+static void putc(int fd, char c) { write(fd, &c, 1); }
+  73:	55                   	push   %rbp
+  74:	48 89 e5             	mov    %rsp,%rbp
+  77:	48 83 ec 10          	sub    $0x10,%rsp
+  7b:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  7e:	89 f0                	mov    %esi,%eax
+  80:	88 45 f8             	mov    %al,-0x8(%rbp)
+  83:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+  87:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8a:	ba 01 00 00 00       	mov    $0x1,%edx
+  8f:	48 89 ce             	mov    %rcx,%rsi
+  92:	89 c7                	mov    %eax,%edi
+  94:	e8 63 07 00 00       	call   7fc <write>
+  99:	90                   	nop
+  9a:	c9                   	leave
+  9b:	c3                   	ret
+
+000000000000009c <printint64>:
+
+static void printint64(int fd, int xx, int base, int sgn) {
+  9c:	55                   	push   %rbp
+  9d:	48 89 e5             	mov    %rsp,%rbp
+  a0:	48 83 ec 40          	sub    $0x40,%rsp
+  a4:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  a7:	89 75 c8             	mov    %esi,-0x38(%rbp)
+  aa:	89 55 c4             	mov    %edx,-0x3c(%rbp)
+  ad:	89 4d c0             	mov    %ecx,-0x40(%rbp)
+  static char digits[] = "0123456789abcdef";
+  char buf[32];
+  int i;
+  uint64_t x;
+
+  if (sgn && (sgn = xx < 0))
+  b0:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+  b4:	74 1f                	je     d5 <printint64+0x39>
+  b6:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  b9:	c1 e8 1f             	shr    $0x1f,%eax
+  bc:	0f b6 c0             	movzbl %al,%eax
+  bf:	89 45 c0             	mov    %eax,-0x40(%rbp)
+  c2:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+  c6:	74 0d                	je     d5 <printint64+0x39>
+    x = -xx;
+  c8:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  cb:	f7 d8                	neg    %eax
+  cd:	48 98                	cltq
+  cf:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  d3:	eb 09                	jmp    de <printint64+0x42>
+  else
+    x = xx;
+  d5:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  d8:	48 98                	cltq
+  da:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+  i = 0;
+  de:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  do {
+    buf[i++] = digits[x % base];
+  e5:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  e8:	48 63 c8             	movslq %eax,%rcx
+  eb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  ef:	ba 00 00 00 00       	mov    $0x0,%edx
+  f4:	48 f7 f1             	div    %rcx
+  f7:	48 89 d1             	mov    %rdx,%rcx
+  fa:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  fd:	8d 50 01             	lea    0x1(%rax),%edx
+ 100:	89 55 fc             	mov    %edx,-0x4(%rbp)
+ 103:	48 8d 15 a6 0c 00 00 	lea    0xca6(%rip),%rdx        # db0 <digits.1>
+ 10a:	0f b6 14 11          	movzbl (%rcx,%rdx,1),%edx
+ 10e:	48 98                	cltq
+ 110:	88 54 05 d0          	mov    %dl,-0x30(%rbp,%rax,1)
+  } while ((x /= base) != 0);
+ 114:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+ 117:	48 63 f0             	movslq %eax,%rsi
+ 11a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ 11e:	ba 00 00 00 00       	mov    $0x0,%edx
+ 123:	48 f7 f6             	div    %rsi
+ 126:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+ 12a:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+ 12f:	75 b4                	jne    e5 <printint64+0x49>
+
+  if (sgn)
+ 131:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+ 135:	74 2b                	je     162 <printint64+0xc6>
+    buf[i++] = '-';
+ 137:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 13a:	8d 50 01             	lea    0x1(%rax),%edx
+ 13d:	89 55 fc             	mov    %edx,-0x4(%rbp)
+ 140:	48 98                	cltq
+ 142:	c6 44 05 d0 2d       	movb   $0x2d,-0x30(%rbp,%rax,1)
+
+  while (--i >= 0)
+ 147:	eb 19                	jmp    162 <printint64+0xc6>
+    putc(fd, buf[i]);
+ 149:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 14c:	48 98                	cltq
+ 14e:	0f b6 44 05 d0       	movzbl -0x30(%rbp,%rax,1),%eax
+ 153:	0f be d0             	movsbl %al,%edx
+ 156:	8b 45 cc             	mov    -0x34(%rbp),%eax
+ 159:	89 d6                	mov    %edx,%esi
+ 15b:	89 c7                	mov    %eax,%edi
+ 15d:	e8 11 ff ff ff       	call   73 <putc>
+  while (--i >= 0)
+ 162:	83 6d fc 01          	subl   $0x1,-0x4(%rbp)
+ 166:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+ 16a:	79 dd                	jns    149 <printint64+0xad>
+}
+ 16c:	90                   	nop
+ 16d:	90                   	nop
+ 16e:	c9                   	leave
+ 16f:	c3                   	ret
+
+0000000000000170 <printint>:
+
+static void printint(int fd, int xx, int base, int sgn) {
+ 170:	55                   	push   %rbp
+ 171:	48 89 e5             	mov    %rsp,%rbp
+ 174:	48 83 ec 30          	sub    $0x30,%rsp
+ 178:	89 7d dc             	mov    %edi,-0x24(%rbp)
+ 17b:	89 75 d8             	mov    %esi,-0x28(%rbp)
+ 17e:	89 55 d4             	mov    %edx,-0x2c(%rbp)
+ 181:	89 4d d0             	mov    %ecx,-0x30(%rbp)
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+ 184:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+  if (sgn && xx < 0) {
+ 18b:	83 7d d0 00          	cmpl   $0x0,-0x30(%rbp)
+ 18f:	74 17                	je     1a8 <printint+0x38>
+ 191:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+ 195:	79 11                	jns    1a8 <printint+0x38>
+    neg = 1;
+ 197:	c7 45 f8 01 00 00 00 	movl   $0x1,-0x8(%rbp)
+    x = -xx;
+ 19e:	8b 45 d8             	mov    -0x28(%rbp),%eax
+ 1a1:	f7 d8                	neg    %eax
+ 1a3:	89 45 f4             	mov    %eax,-0xc(%rbp)
+ 1a6:	eb 06                	jmp    1ae <printint+0x3e>
+  } else {
+    x = xx;
+ 1a8:	8b 45 d8             	mov    -0x28(%rbp),%eax
+ 1ab:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  }
+
+  i = 0;
+ 1ae:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  do {
+    buf[i++] = digits[x % base];
+ 1b5:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+ 1b8:	8b 45 f4             	mov    -0xc(%rbp),%eax
+ 1bb:	ba 00 00 00 00       	mov    $0x0,%edx
+ 1c0:	f7 f1                	div    %ecx
+ 1c2:	89 d1                	mov    %edx,%ecx
+ 1c4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 1c7:	8d 50 01             	lea    0x1(%rax),%edx
+ 1ca:	89 55 fc             	mov    %edx,-0x4(%rbp)
+ 1cd:	89 c9                	mov    %ecx,%ecx
+ 1cf:	48 8d 15 fa 0b 00 00 	lea    0xbfa(%rip),%rdx        # dd0 <digits.0>
+ 1d6:	0f b6 14 11          	movzbl (%rcx,%rdx,1),%edx
+ 1da:	48 98                	cltq
+ 1dc:	88 54 05 e4          	mov    %dl,-0x1c(%rbp,%rax,1)
+  } while ((x /= base) != 0);
+ 1e0:	8b 75 d4             	mov    -0x2c(%rbp),%esi
+ 1e3:	8b 45 f4             	mov    -0xc(%rbp),%eax
+ 1e6:	ba 00 00 00 00       	mov    $0x0,%edx
+ 1eb:	f7 f6                	div    %esi
+ 1ed:	89 45 f4             	mov    %eax,-0xc(%rbp)
+ 1f0:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+ 1f4:	75 bf                	jne    1b5 <printint+0x45>
+  if (neg)
+ 1f6:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+ 1fa:	74 2b                	je     227 <printint+0xb7>
+    buf[i++] = '-';
+ 1fc:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 1ff:	8d 50 01             	lea    0x1(%rax),%edx
+ 202:	89 55 fc             	mov    %edx,-0x4(%rbp)
+ 205:	48 98                	cltq
+ 207:	c6 44 05 e4 2d       	movb   $0x2d,-0x1c(%rbp,%rax,1)
+
+  while (--i >= 0)
+ 20c:	eb 19                	jmp    227 <printint+0xb7>
+    putc(fd, buf[i]);
+ 20e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 211:	48 98                	cltq
+ 213:	0f b6 44 05 e4       	movzbl -0x1c(%rbp,%rax,1),%eax
+ 218:	0f be d0             	movsbl %al,%edx
+ 21b:	8b 45 dc             	mov    -0x24(%rbp),%eax
+ 21e:	89 d6                	mov    %edx,%esi
+ 220:	89 c7                	mov    %eax,%edi
+ 222:	e8 4c fe ff ff       	call   73 <putc>
+  while (--i >= 0)
+ 227:	83 6d fc 01          	subl   $0x1,-0x4(%rbp)
+ 22b:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+ 22f:	79 dd                	jns    20e <printint+0x9e>
+}
+ 231:	90                   	nop
+ 232:	90                   	nop
+ 233:	c9                   	leave
+ 234:	c3                   	ret
+
+0000000000000235 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void printf(int fd, char *fmt, ...) {
+ 235:	55                   	push   %rbp
+ 236:	48 89 e5             	mov    %rsp,%rbp
+ 239:	48 83 ec 70          	sub    $0x70,%rsp
+ 23d:	89 7d 9c             	mov    %edi,-0x64(%rbp)
+ 240:	48 89 75 90          	mov    %rsi,-0x70(%rbp)
+ 244:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+ 248:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+ 24c:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+ 250:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+  char *s;
+  int c, i, state;
+  int lflag;
+  va_list valist;
+  va_start(valist, fmt);
+ 254:	c7 45 a0 10 00 00 00 	movl   $0x10,-0x60(%rbp)
+ 25b:	48 8d 45 10          	lea    0x10(%rbp),%rax
+ 25f:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+ 263:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+ 267:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+
+  state = 0;
+ 26b:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%rbp)
+  for (i = 0; fmt[i]; i++) {
+ 272:	c7 45 c4 00 00 00 00 	movl   $0x0,-0x3c(%rbp)
+ 279:	e9 6b 02 00 00       	jmp    4e9 <printf+0x2b4>
+    c = fmt[i] & 0xff;
+ 27e:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+ 281:	48 63 d0             	movslq %eax,%rdx
+ 284:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+ 288:	48 01 d0             	add    %rdx,%rax
+ 28b:	0f b6 00             	movzbl (%rax),%eax
+ 28e:	0f be c0             	movsbl %al,%eax
+ 291:	25 ff 00 00 00       	and    $0xff,%eax
+ 296:	89 45 b8             	mov    %eax,-0x48(%rbp)
+    if (state == 0) {
+ 299:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+ 29d:	75 30                	jne    2cf <printf+0x9a>
+      if (c == '%') {
+ 29f:	83 7d b8 25          	cmpl   $0x25,-0x48(%rbp)
+ 2a3:	75 13                	jne    2b8 <printf+0x83>
+        state = '%';
+ 2a5:	c7 45 c0 25 00 00 00 	movl   $0x25,-0x40(%rbp)
+        lflag = 0;
+ 2ac:	c7 45 bc 00 00 00 00 	movl   $0x0,-0x44(%rbp)
+ 2b3:	e9 2d 02 00 00       	jmp    4e5 <printf+0x2b0>
+      } else {
+        putc(fd, c);
+ 2b8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+ 2bb:	0f be d0             	movsbl %al,%edx
+ 2be:	8b 45 9c             	mov    -0x64(%rbp),%eax
+ 2c1:	89 d6                	mov    %edx,%esi
+ 2c3:	89 c7                	mov    %eax,%edi
+ 2c5:	e8 a9 fd ff ff       	call   73 <putc>
+ 2ca:	e9 16 02 00 00       	jmp    4e5 <printf+0x2b0>
+      }
+    } else if (state == '%') {
+ 2cf:	83 7d c0 25          	cmpl   $0x25,-0x40(%rbp)
+ 2d3:	0f 85 0c 02 00 00    	jne    4e5 <printf+0x2b0>
+      if (c == 'l') {
+ 2d9:	83 7d b8 6c          	cmpl   $0x6c,-0x48(%rbp)
+ 2dd:	75 0c                	jne    2eb <printf+0xb6>
+        lflag = 1;
+ 2df:	c7 45 bc 01 00 00 00 	movl   $0x1,-0x44(%rbp)
+        continue;
+ 2e6:	e9 fa 01 00 00       	jmp    4e5 <printf+0x2b0>
+      } else if (c == 'd') {
+ 2eb:	83 7d b8 64          	cmpl   $0x64,-0x48(%rbp)
+ 2ef:	0f 85 95 00 00 00    	jne    38a <printf+0x155>
+        if (lflag == 1)
+ 2f5:	83 7d bc 01          	cmpl   $0x1,-0x44(%rbp)
+ 2f9:	75 49                	jne    344 <printf+0x10f>
+          printint64(fd, va_arg(valist, int64_t), 10, 1);
+ 2fb:	8b 45 a0             	mov    -0x60(%rbp),%eax
+ 2fe:	83 f8 2f             	cmp    $0x2f,%eax
+ 301:	77 17                	ja     31a <printf+0xe5>
+ 303:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+ 307:	8b 55 a0             	mov    -0x60(%rbp),%edx
+ 30a:	89 d2                	mov    %edx,%edx
+ 30c:	48 01 d0             	add    %rdx,%rax
+ 30f:	8b 55 a0             	mov    -0x60(%rbp),%edx
+ 312:	83 c2 08             	add    $0x8,%edx
+ 315:	89 55 a0             	mov    %edx,-0x60(%rbp)
+ 318:	eb 0c                	jmp    326 <printf+0xf1>
+ 31a:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+ 31e:	48 8d 50 08          	lea    0x8(%rax),%rdx
+ 322:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+ 326:	48 8b 00             	mov    (%rax),%rax
+ 329:	89 c6                	mov    %eax,%esi
+ 32b:	8b 45 9c             	mov    -0x64(%rbp),%eax
+ 32e:	b9 01 00 00 00       	mov    $0x1,%ecx
+ 333:	ba 0a 00 00 00       	mov    $0xa,%edx
+ 338:	89 c7                	mov    %eax,%edi
+ 33a:	e8 5d fd ff ff       	call   9c <printint64>
+ 33f:	e9 9a 01 00 00       	jmp    4de <printf+0x2a9>
+        else
+          printint(fd, va_arg(valist, int), 10, 1);
+ 344:	8b 45 a0             	mov    -0x60(%rbp),%eax
+ 347:	83 f8 2f             	cmp    $0x2f,%eax
+ 34a:	77 17                	ja     363 <printf+0x12e>
+ 34c:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+ 350:	8b 55 a0             	mov    -0x60(%rbp),%edx
+ 353:	89 d2                	mov    %edx,%edx
+ 355:	48 01 d0             	add    %rdx,%rax
+ 358:	8b 55 a0             	mov    -0x60(%rbp),%edx
+ 35b:	83 c2 08             	add    $0x8,%edx
+ 35e:	89 55 a0             	mov    %edx,-0x60(%rbp)
+ 361:	eb 0c                	jmp    36f <printf+0x13a>
+ 363:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+ 367:	48 8d 50 08          	lea    0x8(%rax),%rdx
+ 36b:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+ 36f:	8b 30                	mov    (%rax),%esi
+ 371:	8b 45 9c             	mov    -0x64(%rbp),%eax
+ 374:	b9 01 00 00 00       	mov    $0x1,%ecx
+ 379:	ba 0a 00 00 00       	mov    $0xa,%edx
+ 37e:	89 c7                	mov    %eax,%edi
+ 380:	e8 eb fd ff ff       	call   170 <printint>
+ 385:	e9 54 01 00 00       	jmp    4de <printf+0x2a9>
+      } else if (c == 'x' || c == 'p') {
+ 38a:	83 7d b8 78          	cmpl   $0x78,-0x48(%rbp)
+ 38e:	74 0a                	je     39a <printf+0x165>
+ 390:	83 7d b8 70          	cmpl   $0x70,-0x48(%rbp)
+ 394:	0f 85 95 00 00 00    	jne    42f <printf+0x1fa>
+        if (lflag == 1)
+ 39a:	83 7d bc 01          	cmpl   $0x1,-0x44(%rbp)
+ 39e:	75 49                	jne    3e9 <printf+0x1b4>
+          printint64(fd, va_arg(valist, int64_t), 16, 0);
+ 3a0:	8b 45 a0             	mov    -0x60(%rbp),%eax
+ 3a3:	83 f8 2f             	cmp    $0x2f,%eax
+ 3a6:	77 17                	ja     3bf <printf+0x18a>
+ 3a8:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+ 3ac:	8b 55 a0             	mov    -0x60(%rbp),%edx
+ 3af:	89 d2                	mov    %edx,%edx
+ 3b1:	48 01 d0             	add    %rdx,%rax
+ 3b4:	8b 55 a0             	mov    -0x60(%rbp),%edx
+ 3b7:	83 c2 08             	add    $0x8,%edx
+ 3ba:	89 55 a0             	mov    %edx,-0x60(%rbp)
+ 3bd:	eb 0c                	jmp    3cb <printf+0x196>
+ 3bf:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+ 3c3:	48 8d 50 08          	lea    0x8(%rax),%rdx
+ 3c7:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+ 3cb:	48 8b 00             	mov    (%rax),%rax
+ 3ce:	89 c6                	mov    %eax,%esi
+ 3d0:	8b 45 9c             	mov    -0x64(%rbp),%eax
+ 3d3:	b9 00 00 00 00       	mov    $0x0,%ecx
+ 3d8:	ba 10 00 00 00       	mov    $0x10,%edx
+ 3dd:	89 c7                	mov    %eax,%edi
+ 3df:	e8 b8 fc ff ff       	call   9c <printint64>
+        if (lflag == 1)
+ 3e4:	e9 f5 00 00 00       	jmp    4de <printf+0x2a9>
+        else
+          printint(fd, va_arg(valist, int), 16, 0);
+ 3e9:	8b 45 a0             	mov    -0x60(%rbp),%eax
+ 3ec:	83 f8 2f             	cmp    $0x2f,%eax
+ 3ef:	77 17                	ja     408 <printf+0x1d3>
+ 3f1:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+ 3f5:	8b 55 a0             	mov    -0x60(%rbp),%edx
+ 3f8:	89 d2                	mov    %edx,%edx
+ 3fa:	48 01 d0             	add    %rdx,%rax
+ 3fd:	8b 55 a0             	mov    -0x60(%rbp),%edx
+ 400:	83 c2 08             	add    $0x8,%edx
+ 403:	89 55 a0             	mov    %edx,-0x60(%rbp)
+ 406:	eb 0c                	jmp    414 <printf+0x1df>
+ 408:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+ 40c:	48 8d 50 08          	lea    0x8(%rax),%rdx
+ 410:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+ 414:	8b 30                	mov    (%rax),%esi
+ 416:	8b 45 9c             	mov    -0x64(%rbp),%eax
+ 419:	b9 00 00 00 00       	mov    $0x0,%ecx
+ 41e:	ba 10 00 00 00       	mov    $0x10,%edx
+ 423:	89 c7                	mov    %eax,%edi
+ 425:	e8 46 fd ff ff       	call   170 <printint>
+        if (lflag == 1)
+ 42a:	e9 af 00 00 00       	jmp    4de <printf+0x2a9>
+      } else if (c == 's') {
+ 42f:	83 7d b8 73          	cmpl   $0x73,-0x48(%rbp)
+ 433:	75 6e                	jne    4a3 <printf+0x26e>
+        if ((s = (char *)va_arg(valist, char *)) == 0)
+ 435:	8b 45 a0             	mov    -0x60(%rbp),%eax
+ 438:	83 f8 2f             	cmp    $0x2f,%eax
+ 43b:	77 17                	ja     454 <printf+0x21f>
+ 43d:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+ 441:	8b 55 a0             	mov    -0x60(%rbp),%edx
+ 444:	89 d2                	mov    %edx,%edx
+ 446:	48 01 d0             	add    %rdx,%rax
+ 449:	8b 55 a0             	mov    -0x60(%rbp),%edx
+ 44c:	83 c2 08             	add    $0x8,%edx
+ 44f:	89 55 a0             	mov    %edx,-0x60(%rbp)
+ 452:	eb 0c                	jmp    460 <printf+0x22b>
+ 454:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+ 458:	48 8d 50 08          	lea    0x8(%rax),%rdx
+ 45c:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+ 460:	48 8b 00             	mov    (%rax),%rax
+ 463:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+ 467:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+ 46c:	75 28                	jne    496 <printf+0x261>
+          s = "(null)";
+ 46e:	48 8d 05 d7 06 00 00 	lea    0x6d7(%rip),%rax        # b4c <malloc+0x129>
+ 475:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        for (; *s; s++)
+ 479:	eb 1b                	jmp    496 <printf+0x261>
+          putc(fd, *s);
+ 47b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+ 47f:	0f b6 00             	movzbl (%rax),%eax
+ 482:	0f be d0             	movsbl %al,%edx
+ 485:	8b 45 9c             	mov    -0x64(%rbp),%eax
+ 488:	89 d6                	mov    %edx,%esi
+ 48a:	89 c7                	mov    %eax,%edi
+ 48c:	e8 e2 fb ff ff       	call   73 <putc>
+        for (; *s; s++)
+ 491:	48 83 45 c8 01       	addq   $0x1,-0x38(%rbp)
+ 496:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+ 49a:	0f b6 00             	movzbl (%rax),%eax
+ 49d:	84 c0                	test   %al,%al
+ 49f:	75 da                	jne    47b <printf+0x246>
+ 4a1:	eb 3b                	jmp    4de <printf+0x2a9>
+      } else if (c == '%') {
+ 4a3:	83 7d b8 25          	cmpl   $0x25,-0x48(%rbp)
+ 4a7:	75 14                	jne    4bd <printf+0x288>
+        putc(fd, c);
+ 4a9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+ 4ac:	0f be d0             	movsbl %al,%edx
+ 4af:	8b 45 9c             	mov    -0x64(%rbp),%eax
+ 4b2:	89 d6                	mov    %edx,%esi
+ 4b4:	89 c7                	mov    %eax,%edi
+ 4b6:	e8 b8 fb ff ff       	call   73 <putc>
+ 4bb:	eb 21                	jmp    4de <printf+0x2a9>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+ 4bd:	8b 45 9c             	mov    -0x64(%rbp),%eax
+ 4c0:	be 25 00 00 00       	mov    $0x25,%esi
+ 4c5:	89 c7                	mov    %eax,%edi
+ 4c7:	e8 a7 fb ff ff       	call   73 <putc>
+        putc(fd, c);
+ 4cc:	8b 45 b8             	mov    -0x48(%rbp),%eax
+ 4cf:	0f be d0             	movsbl %al,%edx
+ 4d2:	8b 45 9c             	mov    -0x64(%rbp),%eax
+ 4d5:	89 d6                	mov    %edx,%esi
+ 4d7:	89 c7                	mov    %eax,%edi
+ 4d9:	e8 95 fb ff ff       	call   73 <putc>
+      }
+      state = 0;
+ 4de:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%rbp)
+  for (i = 0; fmt[i]; i++) {
+ 4e5:	83 45 c4 01          	addl   $0x1,-0x3c(%rbp)
+ 4e9:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+ 4ec:	48 63 d0             	movslq %eax,%rdx
+ 4ef:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+ 4f3:	48 01 d0             	add    %rdx,%rax
+ 4f6:	0f b6 00             	movzbl (%rax),%eax
+ 4f9:	84 c0                	test   %al,%al
+ 4fb:	0f 85 7d fd ff ff    	jne    27e <printf+0x49>
+    }
+  }
+
+  va_end(valist);
+}
+ 501:	90                   	nop
+ 502:	90                   	nop
+ 503:	c9                   	leave
+ 504:	c3                   	ret
+
+0000000000000505 <stosb>:
+      break;
+    buf[i++] = c;
+    if (c == '\n' || c == '\r')
+      break;
+  }
+  buf[i] = '\0';
+ 505:	55                   	push   %rbp
+ 506:	48 89 e5             	mov    %rsp,%rbp
+ 509:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+ 50d:	89 75 f4             	mov    %esi,-0xc(%rbp)
+ 510:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  return buf;
+ 513:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+ 517:	8b 55 f0             	mov    -0x10(%rbp),%edx
+ 51a:	8b 45 f4             	mov    -0xc(%rbp),%eax
+ 51d:	48 89 ce             	mov    %rcx,%rsi
+ 520:	48 89 f7             	mov    %rsi,%rdi
+ 523:	89 d1                	mov    %edx,%ecx
+ 525:	fc                   	cld
+ 526:	f3 aa                	rep stos %al,%es:(%rdi)
+ 528:	89 ca                	mov    %ecx,%edx
+ 52a:	48 89 fe             	mov    %rdi,%rsi
+ 52d:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+ 531:	89 55 f0             	mov    %edx,-0x10(%rbp)
+}
+
+int stat(char *n, struct stat *st) {
+  int fd;
+ 534:	90                   	nop
+ 535:	5d                   	pop    %rbp
+ 536:	c3                   	ret
+
+0000000000000537 <strcpy>:
+char *strcpy(char *s, char *t) {
+ 537:	55                   	push   %rbp
+ 538:	48 89 e5             	mov    %rsp,%rbp
+ 53b:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+ 53f:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  os = s;
+ 543:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 547:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while ((*s++ = *t++) != 0)
+ 54b:	90                   	nop
+ 54c:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+ 550:	48 8d 42 01          	lea    0x1(%rdx),%rax
+ 554:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+ 558:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 55c:	48 8d 48 01          	lea    0x1(%rax),%rcx
+ 560:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+ 564:	0f b6 12             	movzbl (%rdx),%edx
+ 567:	88 10                	mov    %dl,(%rax)
+ 569:	0f b6 00             	movzbl (%rax),%eax
+ 56c:	84 c0                	test   %al,%al
+ 56e:	75 dc                	jne    54c <strcpy+0x15>
+  return os;
+ 570:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+ 574:	5d                   	pop    %rbp
+ 575:	c3                   	ret
+
+0000000000000576 <strcmp>:
+int strcmp(const char *p, const char *q) {
+ 576:	55                   	push   %rbp
+ 577:	48 89 e5             	mov    %rsp,%rbp
+ 57a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+ 57e:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  while (*p && *p == *q)
+ 582:	eb 0a                	jmp    58e <strcmp+0x18>
+    p++, q++;
+ 584:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+ 589:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (*p && *p == *q)
+ 58e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 592:	0f b6 00             	movzbl (%rax),%eax
+ 595:	84 c0                	test   %al,%al
+ 597:	74 12                	je     5ab <strcmp+0x35>
+ 599:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 59d:	0f b6 10             	movzbl (%rax),%edx
+ 5a0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ 5a4:	0f b6 00             	movzbl (%rax),%eax
+ 5a7:	38 c2                	cmp    %al,%dl
+ 5a9:	74 d9                	je     584 <strcmp+0xe>
+  return (uchar)*p - (uchar)*q;
+ 5ab:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 5af:	0f b6 00             	movzbl (%rax),%eax
+ 5b2:	0f b6 d0             	movzbl %al,%edx
+ 5b5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ 5b9:	0f b6 00             	movzbl (%rax),%eax
+ 5bc:	0f b6 c0             	movzbl %al,%eax
+ 5bf:	29 c2                	sub    %eax,%edx
+ 5c1:	89 d0                	mov    %edx,%eax
+}
+ 5c3:	5d                   	pop    %rbp
+ 5c4:	c3                   	ret
+
+00000000000005c5 <strlen>:
+uint strlen(char *s) {
+ 5c5:	55                   	push   %rbp
+ 5c6:	48 89 e5             	mov    %rsp,%rbp
+ 5c9:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  for (n = 0; s[n]; n++)
+ 5cd:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+ 5d4:	eb 04                	jmp    5da <strlen+0x15>
+ 5d6:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+ 5da:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 5dd:	48 63 d0             	movslq %eax,%rdx
+ 5e0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 5e4:	48 01 d0             	add    %rdx,%rax
+ 5e7:	0f b6 00             	movzbl (%rax),%eax
+ 5ea:	84 c0                	test   %al,%al
+ 5ec:	75 e8                	jne    5d6 <strlen+0x11>
+  return n;
+ 5ee:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+ 5f1:	5d                   	pop    %rbp
+ 5f2:	c3                   	ret
+
+00000000000005f3 <memset>:
+void *memset(void *dst, int c, uint n) {
+ 5f3:	55                   	push   %rbp
+ 5f4:	48 89 e5             	mov    %rsp,%rbp
+ 5f7:	48 83 ec 10          	sub    $0x10,%rsp
+ 5fb:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+ 5ff:	89 75 f4             	mov    %esi,-0xc(%rbp)
+ 602:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  stosb(dst, c, n);
+ 605:	8b 55 f0             	mov    -0x10(%rbp),%edx
+ 608:	8b 4d f4             	mov    -0xc(%rbp),%ecx
+ 60b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 60f:	89 ce                	mov    %ecx,%esi
+ 611:	48 89 c7             	mov    %rax,%rdi
+ 614:	e8 ec fe ff ff       	call   505 <stosb>
+  return dst;
+ 619:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+ 61d:	c9                   	leave
+ 61e:	c3                   	ret
+
+000000000000061f <strchr>:
+char *strchr(const char *s, char c) {
+ 61f:	55                   	push   %rbp
+ 620:	48 89 e5             	mov    %rsp,%rbp
+ 623:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+ 627:	89 f0                	mov    %esi,%eax
+ 629:	88 45 f4             	mov    %al,-0xc(%rbp)
+  for (; *s; s++)
+ 62c:	eb 17                	jmp    645 <strchr+0x26>
+    if (*s == c)
+ 62e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 632:	0f b6 00             	movzbl (%rax),%eax
+ 635:	38 45 f4             	cmp    %al,-0xc(%rbp)
+ 638:	75 06                	jne    640 <strchr+0x21>
+      return (char *)s;
+ 63a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 63e:	eb 15                	jmp    655 <strchr+0x36>
+  for (; *s; s++)
+ 640:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+ 645:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 649:	0f b6 00             	movzbl (%rax),%eax
+ 64c:	84 c0                	test   %al,%al
+ 64e:	75 de                	jne    62e <strchr+0xf>
+  return 0;
+ 650:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 655:	5d                   	pop    %rbp
+ 656:	c3                   	ret
+
+0000000000000657 <gets>:
+char *gets(char *buf, int max) {
+ 657:	55                   	push   %rbp
+ 658:	48 89 e5             	mov    %rsp,%rbp
+ 65b:	48 83 ec 20          	sub    $0x20,%rsp
+ 65f:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+ 663:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  for (i = 0; i + 1 < max;) {
+ 666:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+ 66d:	eb 48                	jmp    6b7 <gets+0x60>
+    cc = read(0, &c, 1);
+ 66f:	48 8d 45 f7          	lea    -0x9(%rbp),%rax
+ 673:	ba 01 00 00 00       	mov    $0x1,%edx
+ 678:	48 89 c6             	mov    %rax,%rsi
+ 67b:	bf 00 00 00 00       	mov    $0x0,%edi
+ 680:	e8 6f 01 00 00       	call   7f4 <read>
+ 685:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    if (cc < 1)
+ 688:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+ 68c:	7e 36                	jle    6c4 <gets+0x6d>
+    buf[i++] = c;
+ 68e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 691:	8d 50 01             	lea    0x1(%rax),%edx
+ 694:	89 55 fc             	mov    %edx,-0x4(%rbp)
+ 697:	48 63 d0             	movslq %eax,%rdx
+ 69a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 69e:	48 01 c2             	add    %rax,%rdx
+ 6a1:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+ 6a5:	88 02                	mov    %al,(%rdx)
+    if (c == '\n' || c == '\r')
+ 6a7:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+ 6ab:	3c 0a                	cmp    $0xa,%al
+ 6ad:	74 16                	je     6c5 <gets+0x6e>
+ 6af:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+ 6b3:	3c 0d                	cmp    $0xd,%al
+ 6b5:	74 0e                	je     6c5 <gets+0x6e>
+  for (i = 0; i + 1 < max;) {
+ 6b7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 6ba:	83 c0 01             	add    $0x1,%eax
+ 6bd:	39 45 e4             	cmp    %eax,-0x1c(%rbp)
+ 6c0:	7f ad                	jg     66f <gets+0x18>
+ 6c2:	eb 01                	jmp    6c5 <gets+0x6e>
+      break;
+ 6c4:	90                   	nop
+  buf[i] = '\0';
+ 6c5:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 6c8:	48 63 d0             	movslq %eax,%rdx
+ 6cb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 6cf:	48 01 d0             	add    %rdx,%rax
+ 6d2:	c6 00 00             	movb   $0x0,(%rax)
+  return buf;
+ 6d5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+ 6d9:	c9                   	leave
+ 6da:	c3                   	ret
+
+00000000000006db <stat>:
+int stat(char *n, struct stat *st) {
+ 6db:	55                   	push   %rbp
+ 6dc:	48 89 e5             	mov    %rsp,%rbp
+ 6df:	48 83 ec 20          	sub    $0x20,%rsp
+ 6e3:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+ 6e7:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 6eb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 6ef:	be 00 00 00 00       	mov    $0x0,%esi
+ 6f4:	48 89 c7             	mov    %rax,%rdi
+ 6f7:	e8 20 01 00 00       	call   81c <open>
+ 6fc:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  if (fd < 0)
+ 6ff:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+ 703:	79 07                	jns    70c <stat+0x31>
+    return -1;
+ 705:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 70a:	eb 21                	jmp    72d <stat+0x52>
+  r = fstat(fd, st);
+ 70c:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+ 710:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 713:	48 89 d6             	mov    %rdx,%rsi
+ 716:	89 c7                	mov    %eax,%edi
+ 718:	e8 17 01 00 00       	call   834 <fstat>
+ 71d:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  close(fd);
+ 720:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 723:	89 c7                	mov    %eax,%edi
+ 725:	e8 da 00 00 00       	call   804 <close>
+  return r;
+ 72a:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+ 72d:	c9                   	leave
+ 72e:	c3                   	ret
+
+000000000000072f <atoi>:
+
+int atoi(const char *s) {
+ 72f:	55                   	push   %rbp
+ 730:	48 89 e5             	mov    %rsp,%rbp
+ 733:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int n;
+
+  n = 0;
+ 737:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  while ('0' <= *s && *s <= '9')
+ 73e:	eb 28                	jmp    768 <atoi+0x39>
+    n = n * 10 + *s++ - '0';
+ 740:	8b 55 fc             	mov    -0x4(%rbp),%edx
+ 743:	89 d0                	mov    %edx,%eax
+ 745:	c1 e0 02             	shl    $0x2,%eax
+ 748:	01 d0                	add    %edx,%eax
+ 74a:	01 c0                	add    %eax,%eax
+ 74c:	89 c1                	mov    %eax,%ecx
+ 74e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 752:	48 8d 50 01          	lea    0x1(%rax),%rdx
+ 756:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+ 75a:	0f b6 00             	movzbl (%rax),%eax
+ 75d:	0f be c0             	movsbl %al,%eax
+ 760:	01 c8                	add    %ecx,%eax
+ 762:	83 e8 30             	sub    $0x30,%eax
+ 765:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while ('0' <= *s && *s <= '9')
+ 768:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 76c:	0f b6 00             	movzbl (%rax),%eax
+ 76f:	3c 2f                	cmp    $0x2f,%al
+ 771:	7e 0b                	jle    77e <atoi+0x4f>
+ 773:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 777:	0f b6 00             	movzbl (%rax),%eax
+ 77a:	3c 39                	cmp    $0x39,%al
+ 77c:	7e c2                	jle    740 <atoi+0x11>
+  return n;
+ 77e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+ 781:	5d                   	pop    %rbp
+ 782:	c3                   	ret
+
+0000000000000783 <memmove>:
+
+void *memmove(void *vdst, void *vsrc, int n) {
+ 783:	55                   	push   %rbp
+ 784:	48 89 e5             	mov    %rsp,%rbp
+ 787:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+ 78b:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+ 78f:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  char *dst, *src;
+
+  dst = vdst;
+ 792:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 796:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  src = vsrc;
+ 79a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+ 79e:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  while (n-- > 0)
+ 7a2:	eb 1d                	jmp    7c1 <memmove+0x3e>
+    *dst++ = *src++;
+ 7a4:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+ 7a8:	48 8d 42 01          	lea    0x1(%rdx),%rax
+ 7ac:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+ 7b0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 7b4:	48 8d 48 01          	lea    0x1(%rax),%rcx
+ 7b8:	48 89 4d f8          	mov    %rcx,-0x8(%rbp)
+ 7bc:	0f b6 12             	movzbl (%rdx),%edx
+ 7bf:	88 10                	mov    %dl,(%rax)
+  while (n-- > 0)
+ 7c1:	8b 45 dc             	mov    -0x24(%rbp),%eax
+ 7c4:	8d 50 ff             	lea    -0x1(%rax),%edx
+ 7c7:	89 55 dc             	mov    %edx,-0x24(%rbp)
+ 7ca:	85 c0                	test   %eax,%eax
+ 7cc:	7f d6                	jg     7a4 <memmove+0x21>
+  return vdst;
+ 7ce:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 7d2:	5d                   	pop    %rbp
+ 7d3:	c3                   	ret
+
+00000000000007d4 <fork>:
+  name:                                                                        \
+  movl $SYS_##name, % eax;                                                     \
+  int $TRAP_SYSCALL;                                                           \
+  ret
+
+SYSCALL(fork)
+ 7d4:	b8 01 00 00 00       	mov    $0x1,%eax
+ 7d9:	cd 40                	int    $0x40
+ 7db:	c3                   	ret
+
+00000000000007dc <exit>:
+SYSCALL(exit)
+ 7dc:	b8 02 00 00 00       	mov    $0x2,%eax
+ 7e1:	cd 40                	int    $0x40
+ 7e3:	c3                   	ret
+
+00000000000007e4 <wait>:
+SYSCALL(wait)
+ 7e4:	b8 03 00 00 00       	mov    $0x3,%eax
+ 7e9:	cd 40                	int    $0x40
+ 7eb:	c3                   	ret
+
+00000000000007ec <pipe>:
+SYSCALL(pipe)
+ 7ec:	b8 04 00 00 00       	mov    $0x4,%eax
+ 7f1:	cd 40                	int    $0x40
+ 7f3:	c3                   	ret
+
+00000000000007f4 <read>:
+SYSCALL(read)
+ 7f4:	b8 05 00 00 00       	mov    $0x5,%eax
+ 7f9:	cd 40                	int    $0x40
+ 7fb:	c3                   	ret
+
+00000000000007fc <write>:
+SYSCALL(write)
+ 7fc:	b8 10 00 00 00       	mov    $0x10,%eax
+ 801:	cd 40                	int    $0x40
+ 803:	c3                   	ret
+
+0000000000000804 <close>:
+SYSCALL(close)
+ 804:	b8 15 00 00 00       	mov    $0x15,%eax
+ 809:	cd 40                	int    $0x40
+ 80b:	c3                   	ret
+
+000000000000080c <kill>:
+SYSCALL(kill)
+ 80c:	b8 06 00 00 00       	mov    $0x6,%eax
+ 811:	cd 40                	int    $0x40
+ 813:	c3                   	ret
+
+0000000000000814 <exec>:
+SYSCALL(exec)
+ 814:	b8 07 00 00 00       	mov    $0x7,%eax
+ 819:	cd 40                	int    $0x40
+ 81b:	c3                   	ret
+
+000000000000081c <open>:
+SYSCALL(open)
+ 81c:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 821:	cd 40                	int    $0x40
+ 823:	c3                   	ret
+
+0000000000000824 <mknod>:
+SYSCALL(mknod)
+ 824:	b8 11 00 00 00       	mov    $0x11,%eax
+ 829:	cd 40                	int    $0x40
+ 82b:	c3                   	ret
+
+000000000000082c <unlink>:
+SYSCALL(unlink)
+ 82c:	b8 12 00 00 00       	mov    $0x12,%eax
+ 831:	cd 40                	int    $0x40
+ 833:	c3                   	ret
+
+0000000000000834 <fstat>:
+SYSCALL(fstat)
+ 834:	b8 08 00 00 00       	mov    $0x8,%eax
+ 839:	cd 40                	int    $0x40
+ 83b:	c3                   	ret
+
+000000000000083c <link>:
+SYSCALL(link)
+ 83c:	b8 13 00 00 00       	mov    $0x13,%eax
+ 841:	cd 40                	int    $0x40
+ 843:	c3                   	ret
+
+0000000000000844 <mkdir>:
+SYSCALL(mkdir)
+ 844:	b8 14 00 00 00       	mov    $0x14,%eax
+ 849:	cd 40                	int    $0x40
+ 84b:	c3                   	ret
+
+000000000000084c <chdir>:
+SYSCALL(chdir)
+ 84c:	b8 09 00 00 00       	mov    $0x9,%eax
+ 851:	cd 40                	int    $0x40
+ 853:	c3                   	ret
+
+0000000000000854 <dup>:
+SYSCALL(dup)
+ 854:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 859:	cd 40                	int    $0x40
+ 85b:	c3                   	ret
+
+000000000000085c <getpid>:
+SYSCALL(getpid)
+ 85c:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 861:	cd 40                	int    $0x40
+ 863:	c3                   	ret
+
+0000000000000864 <sbrk>:
+SYSCALL(sbrk)
+ 864:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 869:	cd 40                	int    $0x40
+ 86b:	c3                   	ret
+
+000000000000086c <sleep>:
+SYSCALL(sleep)
+ 86c:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 871:	cd 40                	int    $0x40
+ 873:	c3                   	ret
+
+0000000000000874 <uptime>:
+SYSCALL(uptime)
+ 874:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 879:	cd 40                	int    $0x40
+ 87b:	c3                   	ret
+
+000000000000087c <sysinfo>:
+SYSCALL(sysinfo)
+ 87c:	b8 16 00 00 00       	mov    $0x16,%eax
+ 881:	cd 40                	int    $0x40
+ 883:	c3                   	ret
+
+0000000000000884 <crashn>:
+SYSCALL(crashn)
+ 884:	b8 17 00 00 00       	mov    $0x17,%eax
+ 889:	cd 40                	int    $0x40
+ 88b:	c3                   	ret
+
+000000000000088c <sync>:
+SYSCALL(sync)
+ 88c:	b8 18 00 00 00       	mov    $0x18,%eax
+ 891:	cd 40                	int    $0x40
+ 893:	c3                   	ret
+
+0000000000000894 <fsync>:
+SYSCALL(fsync)
+ 894:	b8 19 00 00 00       	mov    $0x19,%eax
+ 899:	cd 40                	int    $0x40
+ 89b:	c3                   	ret
+
+000000000000089c <free>:
+typedef union header Header;
+
+static Header base;
+static Header *freep;
+
+void free(void *ap) {
+ 89c:	55                   	push   %rbp
+ 89d:	48 89 e5             	mov    %rsp,%rbp
+ 8a0:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  Header *bp, *p;
+
+  bp = (Header *)ap - 1;
+ 8a4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 8a8:	48 83 e8 10          	sub    $0x10,%rax
+ 8ac:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  for (p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 8b0:	48 8b 05 49 05 00 00 	mov    0x549(%rip),%rax        # e00 <freep>
+ 8b7:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+ 8bb:	eb 2f                	jmp    8ec <free+0x50>
+    if (p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 8bd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 8c1:	48 8b 00             	mov    (%rax),%rax
+ 8c4:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+ 8c8:	72 17                	jb     8e1 <free+0x45>
+ 8ca:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ 8ce:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+ 8d2:	72 2f                	jb     903 <free+0x67>
+ 8d4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 8d8:	48 8b 00             	mov    (%rax),%rax
+ 8db:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+ 8df:	72 22                	jb     903 <free+0x67>
+  for (p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 8e1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 8e5:	48 8b 00             	mov    (%rax),%rax
+ 8e8:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+ 8ec:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ 8f0:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+ 8f4:	73 c7                	jae    8bd <free+0x21>
+ 8f6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 8fa:	48 8b 00             	mov    (%rax),%rax
+ 8fd:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+ 901:	73 ba                	jae    8bd <free+0x21>
+      break;
+  if (bp + bp->s.size == p->s.ptr) {
+ 903:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ 907:	8b 40 08             	mov    0x8(%rax),%eax
+ 90a:	89 c0                	mov    %eax,%eax
+ 90c:	48 c1 e0 04          	shl    $0x4,%rax
+ 910:	48 89 c2             	mov    %rax,%rdx
+ 913:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ 917:	48 01 c2             	add    %rax,%rdx
+ 91a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 91e:	48 8b 00             	mov    (%rax),%rax
+ 921:	48 39 c2             	cmp    %rax,%rdx
+ 924:	75 2d                	jne    953 <free+0xb7>
+    bp->s.size += p->s.ptr->s.size;
+ 926:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ 92a:	8b 50 08             	mov    0x8(%rax),%edx
+ 92d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 931:	48 8b 00             	mov    (%rax),%rax
+ 934:	8b 40 08             	mov    0x8(%rax),%eax
+ 937:	01 c2                	add    %eax,%edx
+ 939:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ 93d:	89 50 08             	mov    %edx,0x8(%rax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 940:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 944:	48 8b 00             	mov    (%rax),%rax
+ 947:	48 8b 10             	mov    (%rax),%rdx
+ 94a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ 94e:	48 89 10             	mov    %rdx,(%rax)
+ 951:	eb 0e                	jmp    961 <free+0xc5>
+  } else
+    bp->s.ptr = p->s.ptr;
+ 953:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 957:	48 8b 10             	mov    (%rax),%rdx
+ 95a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ 95e:	48 89 10             	mov    %rdx,(%rax)
+  if (p + p->s.size == bp) {
+ 961:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 965:	8b 40 08             	mov    0x8(%rax),%eax
+ 968:	89 c0                	mov    %eax,%eax
+ 96a:	48 c1 e0 04          	shl    $0x4,%rax
+ 96e:	48 89 c2             	mov    %rax,%rdx
+ 971:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 975:	48 01 d0             	add    %rdx,%rax
+ 978:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+ 97c:	75 27                	jne    9a5 <free+0x109>
+    p->s.size += bp->s.size;
+ 97e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 982:	8b 50 08             	mov    0x8(%rax),%edx
+ 985:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ 989:	8b 40 08             	mov    0x8(%rax),%eax
+ 98c:	01 c2                	add    %eax,%edx
+ 98e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 992:	89 50 08             	mov    %edx,0x8(%rax)
+    p->s.ptr = bp->s.ptr;
+ 995:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ 999:	48 8b 10             	mov    (%rax),%rdx
+ 99c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 9a0:	48 89 10             	mov    %rdx,(%rax)
+ 9a3:	eb 0b                	jmp    9b0 <free+0x114>
+  } else
+    p->s.ptr = bp;
+ 9a5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 9a9:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+ 9ad:	48 89 10             	mov    %rdx,(%rax)
+  freep = p;
+ 9b0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 9b4:	48 89 05 45 04 00 00 	mov    %rax,0x445(%rip)        # e00 <freep>
+}
+ 9bb:	90                   	nop
+ 9bc:	5d                   	pop    %rbp
+ 9bd:	c3                   	ret
+
+00000000000009be <morecore>:
+
+static Header *morecore(uint nu) {
+ 9be:	55                   	push   %rbp
+ 9bf:	48 89 e5             	mov    %rsp,%rbp
+ 9c2:	48 83 ec 20          	sub    $0x20,%rsp
+ 9c6:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  char *p;
+  Header *hp;
+
+  if (nu < 4096)
+ 9c9:	81 7d ec ff 0f 00 00 	cmpl   $0xfff,-0x14(%rbp)
+ 9d0:	77 07                	ja     9d9 <morecore+0x1b>
+    nu = 4096;
+ 9d2:	c7 45 ec 00 10 00 00 	movl   $0x1000,-0x14(%rbp)
+  p = sbrk(nu * sizeof(Header));
+ 9d9:	8b 45 ec             	mov    -0x14(%rbp),%eax
+ 9dc:	c1 e0 04             	shl    $0x4,%eax
+ 9df:	89 c7                	mov    %eax,%edi
+ 9e1:	e8 7e fe ff ff       	call   864 <sbrk>
+ 9e6:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (p == (char *)-1)
+ 9ea:	48 83 7d f8 ff       	cmpq   $0xffffffffffffffff,-0x8(%rbp)
+ 9ef:	75 07                	jne    9f8 <morecore+0x3a>
+    return 0;
+ 9f1:	b8 00 00 00 00       	mov    $0x0,%eax
+ 9f6:	eb 29                	jmp    a21 <morecore+0x63>
+  hp = (Header *)p;
+ 9f8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 9fc:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  hp->s.size = nu;
+ a00:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ a04:	8b 55 ec             	mov    -0x14(%rbp),%edx
+ a07:	89 50 08             	mov    %edx,0x8(%rax)
+  free((void *)(hp + 1));
+ a0a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ a0e:	48 83 c0 10          	add    $0x10,%rax
+ a12:	48 89 c7             	mov    %rax,%rdi
+ a15:	e8 82 fe ff ff       	call   89c <free>
+  return freep;
+ a1a:	48 8b 05 df 03 00 00 	mov    0x3df(%rip),%rax        # e00 <freep>
+}
+ a21:	c9                   	leave
+ a22:	c3                   	ret
+
+0000000000000a23 <malloc>:
+
+void *malloc(uint nbytes) {
+ a23:	55                   	push   %rbp
+ a24:	48 89 e5             	mov    %rsp,%rbp
+ a27:	48 83 ec 30          	sub    $0x30,%rsp
+ a2b:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1) / sizeof(Header) + 1;
+ a2e:	8b 45 dc             	mov    -0x24(%rbp),%eax
+ a31:	48 83 c0 0f          	add    $0xf,%rax
+ a35:	48 c1 e8 04          	shr    $0x4,%rax
+ a39:	83 c0 01             	add    $0x1,%eax
+ a3c:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  if ((prevp = freep) == 0) {
+ a3f:	48 8b 05 ba 03 00 00 	mov    0x3ba(%rip),%rax        # e00 <freep>
+ a46:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+ a4a:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+ a4f:	75 2e                	jne    a7f <malloc+0x5c>
+    base.s.ptr = freep = prevp = &base;
+ a51:	48 8d 05 98 03 00 00 	lea    0x398(%rip),%rax        # df0 <base>
+ a58:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+ a5c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ a60:	48 89 05 99 03 00 00 	mov    %rax,0x399(%rip)        # e00 <freep>
+ a67:	48 8b 05 92 03 00 00 	mov    0x392(%rip),%rax        # e00 <freep>
+ a6e:	48 89 05 7b 03 00 00 	mov    %rax,0x37b(%rip)        # df0 <base>
+    base.s.size = 0;
+ a75:	c7 05 79 03 00 00 00 	movl   $0x0,0x379(%rip)        # df8 <base+0x8>
+ a7c:	00 00 00 
+  }
+  for (p = prevp->s.ptr;; prevp = p, p = p->s.ptr) {
+ a7f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ a83:	48 8b 00             	mov    (%rax),%rax
+ a86:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    if (p->s.size >= nunits) {
+ a8a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ a8e:	8b 40 08             	mov    0x8(%rax),%eax
+ a91:	3b 45 ec             	cmp    -0x14(%rbp),%eax
+ a94:	72 5f                	jb     af5 <malloc+0xd2>
+      if (p->s.size == nunits)
+ a96:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ a9a:	8b 40 08             	mov    0x8(%rax),%eax
+ a9d:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+ aa0:	75 10                	jne    ab2 <malloc+0x8f>
+        prevp->s.ptr = p->s.ptr;
+ aa2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ aa6:	48 8b 10             	mov    (%rax),%rdx
+ aa9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ aad:	48 89 10             	mov    %rdx,(%rax)
+ ab0:	eb 2e                	jmp    ae0 <malloc+0xbd>
+      else {
+        p->s.size -= nunits;
+ ab2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ ab6:	8b 40 08             	mov    0x8(%rax),%eax
+ ab9:	2b 45 ec             	sub    -0x14(%rbp),%eax
+ abc:	89 c2                	mov    %eax,%edx
+ abe:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ ac2:	89 50 08             	mov    %edx,0x8(%rax)
+        p += p->s.size;
+ ac5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ ac9:	8b 40 08             	mov    0x8(%rax),%eax
+ acc:	89 c0                	mov    %eax,%eax
+ ace:	48 c1 e0 04          	shl    $0x4,%rax
+ ad2:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+        p->s.size = nunits;
+ ad6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ ada:	8b 55 ec             	mov    -0x14(%rbp),%edx
+ add:	89 50 08             	mov    %edx,0x8(%rax)
+      }
+      freep = prevp;
+ ae0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ ae4:	48 89 05 15 03 00 00 	mov    %rax,0x315(%rip)        # e00 <freep>
+      return (void *)(p + 1);
+ aeb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ aef:	48 83 c0 10          	add    $0x10,%rax
+ af3:	eb 41                	jmp    b36 <malloc+0x113>
+    }
+    if (p == freep)
+ af5:	48 8b 05 04 03 00 00 	mov    0x304(%rip),%rax        # e00 <freep>
+ afc:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+ b00:	75 1c                	jne    b1e <malloc+0xfb>
+      if ((p = morecore(nunits)) == 0)
+ b02:	8b 45 ec             	mov    -0x14(%rbp),%eax
+ b05:	89 c7                	mov    %eax,%edi
+ b07:	e8 b2 fe ff ff       	call   9be <morecore>
+ b0c:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+ b10:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+ b15:	75 07                	jne    b1e <malloc+0xfb>
+        return 0;
+ b17:	b8 00 00 00 00       	mov    $0x0,%eax
+ b1c:	eb 18                	jmp    b36 <malloc+0x113>
+  for (p = prevp->s.ptr;; prevp = p, p = p->s.ptr) {
+ b1e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ b22:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+ b26:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ b2a:	48 8b 00             	mov    (%rax),%rax
+ b2d:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    if (p->s.size >= nunits) {
+ b31:	e9 54 ff ff ff       	jmp    a8a <malloc+0x67>
+  }
+ b36:	c9                   	leave
+ b37:	c3                   	ret
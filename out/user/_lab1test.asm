@@ -0,0 +1,3130 @@
+
+out/user/_lab1test:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000000000 <main>:
+void testinvalidargs(void);
+void smallfilereadtest(void);
+void duptest(void);
+void nofilestest(void);
+
+int main() {
+       0:	55                   	push   %rbp
+       1:	48 89 e5             	mov    %rsp,%rbp
+
+   if(open("console", O_RDWR) < 0){
+       4:	be 02 00 00 00       	mov    $0x2,%esi
+       9:	48 8d 05 a8 24 00 00 	lea    0x24a8(%rip),%rax        # 24b8 <malloc+0x11c>
+      10:	48 89 c7             	mov    %rax,%rdi
+      13:	e8 7d 21 00 00       	call   2195 <open>
+      18:	85 c0                	test   %eax,%eax
+      1a:	79 07                	jns    23 <main+0x23>
+     return -1;
+      1c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+      21:	eb 4e                	jmp    71 <main+0x71>
+   }
+   dup(0);     // stdout
+      23:	bf 00 00 00 00       	mov    $0x0,%edi
+      28:	e8 a0 21 00 00       	call   21cd <dup>
+   dup(0);     // stderr
+      2d:	bf 00 00 00 00       	mov    $0x0,%edi
+      32:	e8 96 21 00 00       	call   21cd <dup>
+
+//  printf(stdout, "hello world\n");
+
+  //while (1);
+
+  testopen();
+      37:	e8 37 00 00 00       	call   73 <testopen>
+  testinvalidargs();
+      3c:	e8 43 03 00 00       	call   384 <testinvalidargs>
+  smallfilereadtest();
+      41:	e8 b9 0a 00 00       	call   aff <smallfilereadtest>
+  duptest();
+      46:	e8 67 10 00 00       	call   10b2 <duptest>
+  nofilestest();
+      4b:	e8 d4 16 00 00       	call   1724 <nofilestest>
+
+  printf(stdout, "lab1 tests passed!\n");
+      50:	8b 05 3a 32 00 00    	mov    0x323a(%rip),%eax        # 3290 <stdout>
+      56:	48 8d 15 63 24 00 00 	lea    0x2463(%rip),%rdx        # 24c0 <malloc+0x124>
+      5d:	48 89 d6             	mov    %rdx,%rsi
+      60:	89 c7                	mov    %eax,%edi
+      62:	b8 00 00 00 00       	mov    $0x0,%eax
+      67:	e8 42 1b 00 00       	call   1bae <printf>
+
+  exit();
+      6c:	e8 e4 20 00 00       	call   2155 <exit>
+  return 0;
+}
+      71:	5d                   	pop    %rbp
+      72:	c3                   	ret
+
+0000000000000073 <testopen>:
+
+void testopen(void) {
+      73:	55                   	push   %rbp
+      74:	48 89 e5             	mov    %rsp,%rbp
+      77:	48 83 ec 10          	sub    $0x10,%rsp
+  int fd, fd2;
+
+  // test invalid open arguments.
+  if (open("/other.txt", O_CREATE) != -1)
+      7b:	be 00 02 00 00       	mov    $0x200,%esi
+      80:	48 8d 05 4d 24 00 00 	lea    0x244d(%rip),%rax        # 24d4 <malloc+0x138>
+      87:	48 89 c7             	mov    %rax,%rdi
+      8a:	e8 06 21 00 00       	call   2195 <open>
+      8f:	83 f8 ff             	cmp    $0xffffffff,%eax
+      92:	74 5c                	je     f0 <testopen+0x7d>
+    error("created file in read only file system");
+      94:	8b 05 f6 31 00 00    	mov    0x31f6(%rip),%eax        # 3290 <stdout>
+      9a:	ba 41 00 00 00       	mov    $0x41,%edx
+      9f:	48 8d 0d 39 24 00 00 	lea    0x2439(%rip),%rcx        # 24df <malloc+0x143>
+      a6:	48 89 ce             	mov    %rcx,%rsi
+      a9:	89 c7                	mov    %eax,%edi
+      ab:	b8 00 00 00 00       	mov    $0x0,%eax
+      b0:	e8 f9 1a 00 00       	call   1bae <printf>
+      b5:	8b 05 d5 31 00 00    	mov    0x31d5(%rip),%eax        # 3290 <stdout>
+      bb:	48 8d 15 36 24 00 00 	lea    0x2436(%rip),%rdx        # 24f8 <malloc+0x15c>
+      c2:	48 89 d6             	mov    %rdx,%rsi
+      c5:	89 c7                	mov    %eax,%edi
+      c7:	b8 00 00 00 00       	mov    $0x0,%eax
+      cc:	e8 dd 1a 00 00       	call   1bae <printf>
+      d1:	8b 05 b9 31 00 00    	mov    0x31b9(%rip),%eax        # 3290 <stdout>
+      d7:	48 8d 15 40 24 00 00 	lea    0x2440(%rip),%rdx        # 251e <malloc+0x182>
+      de:	48 89 d6             	mov    %rdx,%rsi
+      e1:	89 c7                	mov    %eax,%edi
+      e3:	b8 00 00 00 00       	mov    $0x0,%eax
+      e8:	e8 c1 1a 00 00       	call   1bae <printf>
+      ed:	90                   	nop
+      ee:	eb fd                	jmp    ed <testopen+0x7a>
+
+  if (open("/small.txt", O_RDWR) != -1 || open("/small.txt", O_WRONLY) != -1)
+      f0:	be 02 00 00 00       	mov    $0x2,%esi
+      f5:	48 8d 05 24 24 00 00 	lea    0x2424(%rip),%rax        # 2520 <malloc+0x184>
+      fc:	48 89 c7             	mov    %rax,%rdi
+      ff:	e8 91 20 00 00       	call   2195 <open>
+     104:	83 f8 ff             	cmp    $0xffffffff,%eax
+     107:	75 19                	jne    122 <testopen+0xaf>
+     109:	be 01 00 00 00       	mov    $0x1,%esi
+     10e:	48 8d 05 0b 24 00 00 	lea    0x240b(%rip),%rax        # 2520 <malloc+0x184>
+     115:	48 89 c7             	mov    %rax,%rdi
+     118:	e8 78 20 00 00       	call   2195 <open>
+     11d:	83 f8 ff             	cmp    $0xffffffff,%eax
+     120:	74 5c                	je     17e <testopen+0x10b>
+    error("tried to open a file for writing in read only fs");
+     122:	8b 05 68 31 00 00    	mov    0x3168(%rip),%eax        # 3290 <stdout>
+     128:	ba 44 00 00 00       	mov    $0x44,%edx
+     12d:	48 8d 0d ab 23 00 00 	lea    0x23ab(%rip),%rcx        # 24df <malloc+0x143>
+     134:	48 89 ce             	mov    %rcx,%rsi
+     137:	89 c7                	mov    %eax,%edi
+     139:	b8 00 00 00 00       	mov    $0x0,%eax
+     13e:	e8 6b 1a 00 00       	call   1bae <printf>
+     143:	8b 05 47 31 00 00    	mov    0x3147(%rip),%eax        # 3290 <stdout>
+     149:	48 8d 15 e0 23 00 00 	lea    0x23e0(%rip),%rdx        # 2530 <malloc+0x194>
+     150:	48 89 d6             	mov    %rdx,%rsi
+     153:	89 c7                	mov    %eax,%edi
+     155:	b8 00 00 00 00       	mov    $0x0,%eax
+     15a:	e8 4f 1a 00 00       	call   1bae <printf>
+     15f:	8b 05 2b 31 00 00    	mov    0x312b(%rip),%eax        # 3290 <stdout>
+     165:	48 8d 15 b2 23 00 00 	lea    0x23b2(%rip),%rdx        # 251e <malloc+0x182>
+     16c:	48 89 d6             	mov    %rdx,%rsi
+     16f:	89 c7                	mov    %eax,%edi
+     171:	b8 00 00 00 00       	mov    $0x0,%eax
+     176:	e8 33 1a 00 00       	call   1bae <printf>
+     17b:	90                   	nop
+     17c:	eb fd                	jmp    17b <testopen+0x108>
+
+  if (open("/other.txt", O_RDONLY) != -1)
+     17e:	be 00 00 00 00       	mov    $0x0,%esi
+     183:	48 8d 05 4a 23 00 00 	lea    0x234a(%rip),%rax        # 24d4 <malloc+0x138>
+     18a:	48 89 c7             	mov    %rax,%rdi
+     18d:	e8 03 20 00 00       	call   2195 <open>
+     192:	83 f8 ff             	cmp    $0xffffffff,%eax
+     195:	74 5c                	je     1f3 <testopen+0x180>
+    error("opened a file that doesn't exist");
+     197:	8b 05 f3 30 00 00    	mov    0x30f3(%rip),%eax        # 3290 <stdout>
+     19d:	ba 47 00 00 00       	mov    $0x47,%edx
+     1a2:	48 8d 0d 36 23 00 00 	lea    0x2336(%rip),%rcx        # 24df <malloc+0x143>
+     1a9:	48 89 ce             	mov    %rcx,%rsi
+     1ac:	89 c7                	mov    %eax,%edi
+     1ae:	b8 00 00 00 00       	mov    $0x0,%eax
+     1b3:	e8 f6 19 00 00       	call   1bae <printf>
+     1b8:	8b 05 d2 30 00 00    	mov    0x30d2(%rip),%eax        # 3290 <stdout>
+     1be:	48 8d 15 a3 23 00 00 	lea    0x23a3(%rip),%rdx        # 2568 <malloc+0x1cc>
+     1c5:	48 89 d6             	mov    %rdx,%rsi
+     1c8:	89 c7                	mov    %eax,%edi
+     1ca:	b8 00 00 00 00       	mov    $0x0,%eax
+     1cf:	e8 da 19 00 00       	call   1bae <printf>
+     1d4:	8b 05 b6 30 00 00    	mov    0x30b6(%rip),%eax        # 3290 <stdout>
+     1da:	48 8d 15 3d 23 00 00 	lea    0x233d(%rip),%rdx        # 251e <malloc+0x182>
+     1e1:	48 89 d6             	mov    %rdx,%rsi
+     1e4:	89 c7                	mov    %eax,%edi
+     1e6:	b8 00 00 00 00       	mov    $0x0,%eax
+     1eb:	e8 be 19 00 00       	call   1bae <printf>
+     1f0:	90                   	nop
+     1f1:	eb fd                	jmp    1f0 <testopen+0x17d>
+
+  fd = open("/small.txt", O_RDONLY);
+     1f3:	be 00 00 00 00       	mov    $0x0,%esi
+     1f8:	48 8d 05 21 23 00 00 	lea    0x2321(%rip),%rax        # 2520 <malloc+0x184>
+     1ff:	48 89 c7             	mov    %rax,%rdi
+     202:	e8 8e 1f 00 00       	call   2195 <open>
+     207:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  if (fd == -1)
+     20a:	83 7d fc ff          	cmpl   $0xffffffff,-0x4(%rbp)
+     20e:	75 5c                	jne    26c <testopen+0x1f9>
+    error("cannot open small.txt");
+     210:	8b 05 7a 30 00 00    	mov    0x307a(%rip),%eax        # 3290 <stdout>
+     216:	ba 4b 00 00 00       	mov    $0x4b,%edx
+     21b:	48 8d 0d bd 22 00 00 	lea    0x22bd(%rip),%rcx        # 24df <malloc+0x143>
+     222:	48 89 ce             	mov    %rcx,%rsi
+     225:	89 c7                	mov    %eax,%edi
+     227:	b8 00 00 00 00       	mov    $0x0,%eax
+     22c:	e8 7d 19 00 00       	call   1bae <printf>
+     231:	8b 05 59 30 00 00    	mov    0x3059(%rip),%eax        # 3290 <stdout>
+     237:	48 8d 15 4b 23 00 00 	lea    0x234b(%rip),%rdx        # 2589 <malloc+0x1ed>
+     23e:	48 89 d6             	mov    %rdx,%rsi
+     241:	89 c7                	mov    %eax,%edi
+     243:	b8 00 00 00 00       	mov    $0x0,%eax
+     248:	e8 61 19 00 00       	call   1bae <printf>
+     24d:	8b 05 3d 30 00 00    	mov    0x303d(%rip),%eax        # 3290 <stdout>
+     253:	48 8d 15 c4 22 00 00 	lea    0x22c4(%rip),%rdx        # 251e <malloc+0x182>
+     25a:	48 89 d6             	mov    %rdx,%rsi
+     25d:	89 c7                	mov    %eax,%edi
+     25f:	b8 00 00 00 00       	mov    $0x0,%eax
+     264:	e8 45 19 00 00       	call   1bae <printf>
+     269:	90                   	nop
+     26a:	eb fd                	jmp    269 <testopen+0x1f6>
+
+  printf(stdout, "passed argument checking for open\n");
+     26c:	8b 05 1e 30 00 00    	mov    0x301e(%rip),%eax        # 3290 <stdout>
+     272:	48 8d 15 27 23 00 00 	lea    0x2327(%rip),%rdx        # 25a0 <malloc+0x204>
+     279:	48 89 d6             	mov    %rdx,%rsi
+     27c:	89 c7                	mov    %eax,%edi
+     27e:	b8 00 00 00 00       	mov    $0x0,%eax
+     283:	e8 26 19 00 00       	call   1bae <printf>
+
+  // ensure opening the same file results with a
+  // different file descriptor.
+  fd2 = open("/small.txt", O_RDONLY);
+     288:	be 00 00 00 00       	mov    $0x0,%esi
+     28d:	48 8d 05 8c 22 00 00 	lea    0x228c(%rip),%rax        # 2520 <malloc+0x184>
+     294:	48 89 c7             	mov    %rax,%rdi
+     297:	e8 f9 1e 00 00       	call   2195 <open>
+     29c:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  if (fd2 == -1)
+     29f:	83 7d f8 ff          	cmpl   $0xffffffff,-0x8(%rbp)
+     2a3:	75 5c                	jne    301 <testopen+0x28e>
+    error("cannot open small.txt on 2nd try");
+     2a5:	8b 05 e5 2f 00 00    	mov    0x2fe5(%rip),%eax        # 3290 <stdout>
+     2ab:	ba 53 00 00 00       	mov    $0x53,%edx
+     2b0:	48 8d 0d 28 22 00 00 	lea    0x2228(%rip),%rcx        # 24df <malloc+0x143>
+     2b7:	48 89 ce             	mov    %rcx,%rsi
+     2ba:	89 c7                	mov    %eax,%edi
+     2bc:	b8 00 00 00 00       	mov    $0x0,%eax
+     2c1:	e8 e8 18 00 00       	call   1bae <printf>
+     2c6:	8b 05 c4 2f 00 00    	mov    0x2fc4(%rip),%eax        # 3290 <stdout>
+     2cc:	48 8d 15 f5 22 00 00 	lea    0x22f5(%rip),%rdx        # 25c8 <malloc+0x22c>
+     2d3:	48 89 d6             	mov    %rdx,%rsi
+     2d6:	89 c7                	mov    %eax,%edi
+     2d8:	b8 00 00 00 00       	mov    $0x0,%eax
+     2dd:	e8 cc 18 00 00       	call   1bae <printf>
+     2e2:	8b 05 a8 2f 00 00    	mov    0x2fa8(%rip),%eax        # 3290 <stdout>
+     2e8:	48 8d 15 2f 22 00 00 	lea    0x222f(%rip),%rdx        # 251e <malloc+0x182>
+     2ef:	48 89 d6             	mov    %rdx,%rsi
+     2f2:	89 c7                	mov    %eax,%edi
+     2f4:	b8 00 00 00 00       	mov    $0x0,%eax
+     2f9:	e8 b0 18 00 00       	call   1bae <printf>
+     2fe:	90                   	nop
+     2ff:	eb fd                	jmp    2fe <testopen+0x28b>
+  if (fd == fd2)
+     301:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     304:	3b 45 f8             	cmp    -0x8(%rbp),%eax
+     307:	75 5c                	jne    365 <testopen+0x2f2>
+    error("opening same file results with same file descriptor");
+     309:	8b 05 81 2f 00 00    	mov    0x2f81(%rip),%eax        # 3290 <stdout>
+     30f:	ba 55 00 00 00       	mov    $0x55,%edx
+     314:	48 8d 0d c4 21 00 00 	lea    0x21c4(%rip),%rcx        # 24df <malloc+0x143>
+     31b:	48 89 ce             	mov    %rcx,%rsi
+     31e:	89 c7                	mov    %eax,%edi
+     320:	b8 00 00 00 00       	mov    $0x0,%eax
+     325:	e8 84 18 00 00       	call   1bae <printf>
+     32a:	8b 05 60 2f 00 00    	mov    0x2f60(%rip),%eax        # 3290 <stdout>
+     330:	48 8d 15 b9 22 00 00 	lea    0x22b9(%rip),%rdx        # 25f0 <malloc+0x254>
+     337:	48 89 d6             	mov    %rdx,%rsi
+     33a:	89 c7                	mov    %eax,%edi
+     33c:	b8 00 00 00 00       	mov    $0x0,%eax
+     341:	e8 68 18 00 00       	call   1bae <printf>
+     346:	8b 05 44 2f 00 00    	mov    0x2f44(%rip),%eax        # 3290 <stdout>
+     34c:	48 8d 15 cb 21 00 00 	lea    0x21cb(%rip),%rdx        # 251e <malloc+0x182>
+     353:	48 89 d6             	mov    %rdx,%rsi
+     356:	89 c7                	mov    %eax,%edi
+     358:	b8 00 00 00 00       	mov    $0x0,%eax
+     35d:	e8 4c 18 00 00       	call   1bae <printf>
+     362:	90                   	nop
+     363:	eb fd                	jmp    362 <testopen+0x2ef>
+
+  printf(stdout, "passed opening same file twice.\n");
+     365:	8b 05 25 2f 00 00    	mov    0x2f25(%rip),%eax        # 3290 <stdout>
+     36b:	48 8d 15 b6 22 00 00 	lea    0x22b6(%rip),%rdx        # 2628 <malloc+0x28c>
+     372:	48 89 d6             	mov    %rdx,%rsi
+     375:	89 c7                	mov    %eax,%edi
+     377:	b8 00 00 00 00       	mov    $0x0,%eax
+     37c:	e8 2d 18 00 00       	call   1bae <printf>
+
+}
+     381:	90                   	nop
+     382:	c9                   	leave
+     383:	c3                   	ret
+
+0000000000000384 <testinvalidargs>:
+
+void testinvalidargs(void) {
+     384:	55                   	push   %rbp
+     385:	48 89 e5             	mov    %rsp,%rbp
+     388:	48 83 ec 30          	sub    $0x30,%rsp
+  char buf[11];
+  struct stat st;
+
+
+  // read
+  if (read(15, buf, 11) != -1)
+     38c:	48 8d 45 ed          	lea    -0x13(%rbp),%rax
+     390:	ba 0b 00 00 00       	mov    $0xb,%edx
+     395:	48 89 c6             	mov    %rax,%rsi
+     398:	bf 0f 00 00 00       	mov    $0xf,%edi
+     39d:	e8 cb 1d 00 00       	call   216d <read>
+     3a2:	83 f8 ff             	cmp    $0xffffffff,%eax
+     3a5:	74 5c                	je     403 <testinvalidargs+0x7f>
+    error("read on a non existent file descriptor");
+     3a7:	8b 05 e3 2e 00 00    	mov    0x2ee3(%rip),%eax        # 3290 <stdout>
+     3ad:	ba 63 00 00 00       	mov    $0x63,%edx
+     3b2:	48 8d 0d 26 21 00 00 	lea    0x2126(%rip),%rcx        # 24df <malloc+0x143>
+     3b9:	48 89 ce             	mov    %rcx,%rsi
+     3bc:	89 c7                	mov    %eax,%edi
+     3be:	b8 00 00 00 00       	mov    $0x0,%eax
+     3c3:	e8 e6 17 00 00       	call   1bae <printf>
+     3c8:	8b 05 c2 2e 00 00    	mov    0x2ec2(%rip),%eax        # 3290 <stdout>
+     3ce:	48 8d 15 7b 22 00 00 	lea    0x227b(%rip),%rdx        # 2650 <malloc+0x2b4>
+     3d5:	48 89 d6             	mov    %rdx,%rsi
+     3d8:	89 c7                	mov    %eax,%edi
+     3da:	b8 00 00 00 00       	mov    $0x0,%eax
+     3df:	e8 ca 17 00 00       	call   1bae <printf>
+     3e4:	8b 05 a6 2e 00 00    	mov    0x2ea6(%rip),%eax        # 3290 <stdout>
+     3ea:	48 8d 15 2d 21 00 00 	lea    0x212d(%rip),%rdx        # 251e <malloc+0x182>
+     3f1:	48 89 d6             	mov    %rdx,%rsi
+     3f4:	89 c7                	mov    %eax,%edi
+     3f6:	b8 00 00 00 00       	mov    $0x0,%eax
+     3fb:	e8 ae 17 00 00       	call   1bae <printf>
+     400:	90                   	nop
+     401:	eb fd                	jmp    400 <testinvalidargs+0x7c>
+
+  fd = open("console", O_WRONLY);
+     403:	be 01 00 00 00       	mov    $0x1,%esi
+     408:	48 8d 05 a9 20 00 00 	lea    0x20a9(%rip),%rax        # 24b8 <malloc+0x11c>
+     40f:	48 89 c7             	mov    %rax,%rdi
+     412:	e8 7e 1d 00 00       	call   2195 <open>
+     417:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  assert(fd != -1);
+     41a:	83 7d fc ff          	cmpl   $0xffffffff,-0x4(%rbp)
+     41e:	75 2b                	jne    44b <testinvalidargs+0xc7>
+     420:	8b 05 6a 2e 00 00    	mov    0x2e6a(%rip),%eax        # 3290 <stdout>
+     426:	48 8d 15 4a 22 00 00 	lea    0x224a(%rip),%rdx        # 2677 <malloc+0x2db>
+     42d:	48 89 d1             	mov    %rdx,%rcx
+     430:	ba 66 00 00 00       	mov    $0x66,%edx
+     435:	48 8d 35 44 22 00 00 	lea    0x2244(%rip),%rsi        # 2680 <malloc+0x2e4>
+     43c:	89 c7                	mov    %eax,%edi
+     43e:	b8 00 00 00 00       	mov    $0x0,%eax
+     443:	e8 66 17 00 00       	call   1bae <printf>
+     448:	90                   	nop
+     449:	eb fd                	jmp    448 <testinvalidargs+0xc4>
+
+  if (read(fd, buf, 10) != -1)
+     44b:	48 8d 4d ed          	lea    -0x13(%rbp),%rcx
+     44f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     452:	ba 0a 00 00 00       	mov    $0xa,%edx
+     457:	48 89 ce             	mov    %rcx,%rsi
+     45a:	89 c7                	mov    %eax,%edi
+     45c:	e8 0c 1d 00 00       	call   216d <read>
+     461:	83 f8 ff             	cmp    $0xffffffff,%eax
+     464:	74 5c                	je     4c2 <testinvalidargs+0x13e>
+    // NOTE: If the test hangs here it's because you're trying to read from
+    // stdin (hint: shouldn't happen).
+    error("able to read from a write only console");
+     466:	8b 05 24 2e 00 00    	mov    0x2e24(%rip),%eax        # 3290 <stdout>
+     46c:	ba 6b 00 00 00       	mov    $0x6b,%edx
+     471:	48 8d 0d 67 20 00 00 	lea    0x2067(%rip),%rcx        # 24df <malloc+0x143>
+     478:	48 89 ce             	mov    %rcx,%rsi
+     47b:	89 c7                	mov    %eax,%edi
+     47d:	b8 00 00 00 00       	mov    $0x0,%eax
+     482:	e8 27 17 00 00       	call   1bae <printf>
+     487:	8b 05 03 2e 00 00    	mov    0x2e03(%rip),%eax        # 3290 <stdout>
+     48d:	48 8d 15 0c 22 00 00 	lea    0x220c(%rip),%rdx        # 26a0 <malloc+0x304>
+     494:	48 89 d6             	mov    %rdx,%rsi
+     497:	89 c7                	mov    %eax,%edi
+     499:	b8 00 00 00 00       	mov    $0x0,%eax
+     49e:	e8 0b 17 00 00       	call   1bae <printf>
+     4a3:	8b 05 e7 2d 00 00    	mov    0x2de7(%rip),%eax        # 3290 <stdout>
+     4a9:	48 8d 15 6e 20 00 00 	lea    0x206e(%rip),%rdx        # 251e <malloc+0x182>
+     4b0:	48 89 d6             	mov    %rdx,%rsi
+     4b3:	89 c7                	mov    %eax,%edi
+     4b5:	b8 00 00 00 00       	mov    $0x0,%eax
+     4ba:	e8 ef 16 00 00       	call   1bae <printf>
+     4bf:	90                   	nop
+     4c0:	eb fd                	jmp    4bf <testinvalidargs+0x13b>
+  assert(close(fd) == 0);
+     4c2:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     4c5:	89 c7                	mov    %eax,%edi
+     4c7:	e8 b1 1c 00 00       	call   217d <close>
+     4cc:	85 c0                	test   %eax,%eax
+     4ce:	74 2b                	je     4fb <testinvalidargs+0x177>
+     4d0:	8b 05 ba 2d 00 00    	mov    0x2dba(%rip),%eax        # 3290 <stdout>
+     4d6:	48 8d 15 ea 21 00 00 	lea    0x21ea(%rip),%rdx        # 26c7 <malloc+0x32b>
+     4dd:	48 89 d1             	mov    %rdx,%rcx
+     4e0:	ba 6c 00 00 00       	mov    $0x6c,%edx
+     4e5:	48 8d 35 94 21 00 00 	lea    0x2194(%rip),%rsi        # 2680 <malloc+0x2e4>
+     4ec:	89 c7                	mov    %eax,%edi
+     4ee:	b8 00 00 00 00       	mov    $0x0,%eax
+     4f3:	e8 b6 16 00 00       	call   1bae <printf>
+     4f8:	90                   	nop
+     4f9:	eb fd                	jmp    4f8 <testinvalidargs+0x174>
+
+  fd = open("/small.txt", O_RDONLY);
+     4fb:	be 00 00 00 00       	mov    $0x0,%esi
+     500:	48 8d 05 19 20 00 00 	lea    0x2019(%rip),%rax        # 2520 <malloc+0x184>
+     507:	48 89 c7             	mov    %rax,%rdi
+     50a:	e8 86 1c 00 00       	call   2195 <open>
+     50f:	89 45 fc             	mov    %eax,-0x4(%rbp)
+
+  if ((i = read(fd, buf, -100)) != -1)
+     512:	48 8d 4d ed          	lea    -0x13(%rbp),%rcx
+     516:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     519:	ba 9c ff ff ff       	mov    $0xffffff9c,%edx
+     51e:	48 89 ce             	mov    %rcx,%rsi
+     521:	89 c7                	mov    %eax,%edi
+     523:	e8 45 1c 00 00       	call   216d <read>
+     528:	89 45 f8             	mov    %eax,-0x8(%rbp)
+     52b:	83 7d f8 ff          	cmpl   $0xffffffff,-0x8(%rbp)
+     52f:	74 5f                	je     590 <testinvalidargs+0x20c>
+    error("negative n didn't return error, return value was '%d'", i);
+     531:	8b 05 59 2d 00 00    	mov    0x2d59(%rip),%eax        # 3290 <stdout>
+     537:	ba 71 00 00 00       	mov    $0x71,%edx
+     53c:	48 8d 0d 9c 1f 00 00 	lea    0x1f9c(%rip),%rcx        # 24df <malloc+0x143>
+     543:	48 89 ce             	mov    %rcx,%rsi
+     546:	89 c7                	mov    %eax,%edi
+     548:	b8 00 00 00 00       	mov    $0x0,%eax
+     54d:	e8 5c 16 00 00       	call   1bae <printf>
+     552:	8b 05 38 2d 00 00    	mov    0x2d38(%rip),%eax        # 3290 <stdout>
+     558:	8b 55 f8             	mov    -0x8(%rbp),%edx
+     55b:	48 8d 0d 76 21 00 00 	lea    0x2176(%rip),%rcx        # 26d8 <malloc+0x33c>
+     562:	48 89 ce             	mov    %rcx,%rsi
+     565:	89 c7                	mov    %eax,%edi
+     567:	b8 00 00 00 00       	mov    $0x0,%eax
+     56c:	e8 3d 16 00 00       	call   1bae <printf>
+     571:	8b 05 19 2d 00 00    	mov    0x2d19(%rip),%eax        # 3290 <stdout>
+     577:	48 8d 15 a0 1f 00 00 	lea    0x1fa0(%rip),%rdx        # 251e <malloc+0x182>
+     57e:	48 89 d6             	mov    %rdx,%rsi
+     581:	89 c7                	mov    %eax,%edi
+     583:	b8 00 00 00 00       	mov    $0x0,%eax
+     588:	e8 21 16 00 00       	call   1bae <printf>
+     58d:	90                   	nop
+     58e:	eb fd                	jmp    58d <testinvalidargs+0x209>
+
+  if (read(fd, (char *)0xffffff00, 10) != -1)
+     590:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     593:	ba 0a 00 00 00       	mov    $0xa,%edx
+     598:	b9 00 ff ff ff       	mov    $0xffffff00,%ecx
+     59d:	48 89 ce             	mov    %rcx,%rsi
+     5a0:	89 c7                	mov    %eax,%edi
+     5a2:	e8 c6 1b 00 00       	call   216d <read>
+     5a7:	83 f8 ff             	cmp    $0xffffffff,%eax
+     5aa:	74 5c                	je     608 <testinvalidargs+0x284>
+    error("able to read to a buffer not in my memory region");
+     5ac:	8b 05 de 2c 00 00    	mov    0x2cde(%rip),%eax        # 3290 <stdout>
+     5b2:	ba 74 00 00 00       	mov    $0x74,%edx
+     5b7:	48 8d 0d 21 1f 00 00 	lea    0x1f21(%rip),%rcx        # 24df <malloc+0x143>
+     5be:	48 89 ce             	mov    %rcx,%rsi
+     5c1:	89 c7                	mov    %eax,%edi
+     5c3:	b8 00 00 00 00       	mov    $0x0,%eax
+     5c8:	e8 e1 15 00 00       	call   1bae <printf>
+     5cd:	8b 05 bd 2c 00 00    	mov    0x2cbd(%rip),%eax        # 3290 <stdout>
+     5d3:	48 8d 15 36 21 00 00 	lea    0x2136(%rip),%rdx        # 2710 <malloc+0x374>
+     5da:	48 89 d6             	mov    %rdx,%rsi
+     5dd:	89 c7                	mov    %eax,%edi
+     5df:	b8 00 00 00 00       	mov    $0x0,%eax
+     5e4:	e8 c5 15 00 00       	call   1bae <printf>
+     5e9:	8b 05 a1 2c 00 00    	mov    0x2ca1(%rip),%eax        # 3290 <stdout>
+     5ef:	48 8d 15 28 1f 00 00 	lea    0x1f28(%rip),%rdx        # 251e <malloc+0x182>
+     5f6:	48 89 d6             	mov    %rdx,%rsi
+     5f9:	89 c7                	mov    %eax,%edi
+     5fb:	b8 00 00 00 00       	mov    $0x0,%eax
+     600:	e8 a9 15 00 00       	call   1bae <printf>
+     605:	90                   	nop
+     606:	eb fd                	jmp    605 <testinvalidargs+0x281>
+
+  printf(stdout, "passed argument checking for read\n");
+     608:	8b 05 82 2c 00 00    	mov    0x2c82(%rip),%eax        # 3290 <stdout>
+     60e:	48 8d 15 33 21 00 00 	lea    0x2133(%rip),%rdx        # 2748 <malloc+0x3ac>
+     615:	48 89 d6             	mov    %rdx,%rsi
+     618:	89 c7                	mov    %eax,%edi
+     61a:	b8 00 00 00 00       	mov    $0x0,%eax
+     61f:	e8 8a 15 00 00       	call   1bae <printf>
+
+  // write
+  if (write(15, buf, 11) != -1)
+     624:	48 8d 45 ed          	lea    -0x13(%rbp),%rax
+     628:	ba 0b 00 00 00       	mov    $0xb,%edx
+     62d:	48 89 c6             	mov    %rax,%rsi
+     630:	bf 0f 00 00 00       	mov    $0xf,%edi
+     635:	e8 3b 1b 00 00       	call   2175 <write>
+     63a:	83 f8 ff             	cmp    $0xffffffff,%eax
+     63d:	74 5c                	je     69b <testinvalidargs+0x317>
+    error("write on a non existent file descriptor");
+     63f:	8b 05 4b 2c 00 00    	mov    0x2c4b(%rip),%eax        # 3290 <stdout>
+     645:	ba 7a 00 00 00       	mov    $0x7a,%edx
+     64a:	48 8d 0d 8e 1e 00 00 	lea    0x1e8e(%rip),%rcx        # 24df <malloc+0x143>
+     651:	48 89 ce             	mov    %rcx,%rsi
+     654:	89 c7                	mov    %eax,%edi
+     656:	b8 00 00 00 00       	mov    $0x0,%eax
+     65b:	e8 4e 15 00 00       	call   1bae <printf>
+     660:	8b 05 2a 2c 00 00    	mov    0x2c2a(%rip),%eax        # 3290 <stdout>
+     666:	48 8d 15 03 21 00 00 	lea    0x2103(%rip),%rdx        # 2770 <malloc+0x3d4>
+     66d:	48 89 d6             	mov    %rdx,%rsi
+     670:	89 c7                	mov    %eax,%edi
+     672:	b8 00 00 00 00       	mov    $0x0,%eax
+     677:	e8 32 15 00 00       	call   1bae <printf>
+     67c:	8b 05 0e 2c 00 00    	mov    0x2c0e(%rip),%eax        # 3290 <stdout>
+     682:	48 8d 15 95 1e 00 00 	lea    0x1e95(%rip),%rdx        # 251e <malloc+0x182>
+     689:	48 89 d6             	mov    %rdx,%rsi
+     68c:	89 c7                	mov    %eax,%edi
+     68e:	b8 00 00 00 00       	mov    $0x0,%eax
+     693:	e8 16 15 00 00       	call   1bae <printf>
+     698:	90                   	nop
+     699:	eb fd                	jmp    698 <testinvalidargs+0x314>
+
+  if (write(fd, buf, 11) != -1)
+     69b:	48 8d 4d ed          	lea    -0x13(%rbp),%rcx
+     69f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     6a2:	ba 0b 00 00 00       	mov    $0xb,%edx
+     6a7:	48 89 ce             	mov    %rcx,%rsi
+     6aa:	89 c7                	mov    %eax,%edi
+     6ac:	e8 c4 1a 00 00       	call   2175 <write>
+     6b1:	83 f8 ff             	cmp    $0xffffffff,%eax
+     6b4:	74 5c                	je     712 <testinvalidargs+0x38e>
+    error("able to write to a file in read only fs");
+     6b6:	8b 05 d4 2b 00 00    	mov    0x2bd4(%rip),%eax        # 3290 <stdout>
+     6bc:	ba 7d 00 00 00       	mov    $0x7d,%edx
+     6c1:	48 8d 0d 17 1e 00 00 	lea    0x1e17(%rip),%rcx        # 24df <malloc+0x143>
+     6c8:	48 89 ce             	mov    %rcx,%rsi
+     6cb:	89 c7                	mov    %eax,%edi
+     6cd:	b8 00 00 00 00       	mov    $0x0,%eax
+     6d2:	e8 d7 14 00 00       	call   1bae <printf>
+     6d7:	8b 05 b3 2b 00 00    	mov    0x2bb3(%rip),%eax        # 3290 <stdout>
+     6dd:	48 8d 15 b4 20 00 00 	lea    0x20b4(%rip),%rdx        # 2798 <malloc+0x3fc>
+     6e4:	48 89 d6             	mov    %rdx,%rsi
+     6e7:	89 c7                	mov    %eax,%edi
+     6e9:	b8 00 00 00 00       	mov    $0x0,%eax
+     6ee:	e8 bb 14 00 00       	call   1bae <printf>
+     6f3:	8b 05 97 2b 00 00    	mov    0x2b97(%rip),%eax        # 3290 <stdout>
+     6f9:	48 8d 15 1e 1e 00 00 	lea    0x1e1e(%rip),%rdx        # 251e <malloc+0x182>
+     700:	48 89 d6             	mov    %rdx,%rsi
+     703:	89 c7                	mov    %eax,%edi
+     705:	b8 00 00 00 00       	mov    $0x0,%eax
+     70a:	e8 9f 14 00 00       	call   1bae <printf>
+     70f:	90                   	nop
+     710:	eb fd                	jmp    70f <testinvalidargs+0x38b>
+
+  printf(stdout, "passed argument checking for write\n");
+     712:	8b 05 78 2b 00 00    	mov    0x2b78(%rip),%eax        # 3290 <stdout>
+     718:	48 8d 15 a1 20 00 00 	lea    0x20a1(%rip),%rdx        # 27c0 <malloc+0x424>
+     71f:	48 89 d6             	mov    %rdx,%rsi
+     722:	89 c7                	mov    %eax,%edi
+     724:	b8 00 00 00 00       	mov    $0x0,%eax
+     729:	e8 80 14 00 00       	call   1bae <printf>
+
+  // stat
+  if (fstat(15, &st) != -1)
+     72e:	48 8d 45 dc          	lea    -0x24(%rbp),%rax
+     732:	48 89 c6             	mov    %rax,%rsi
+     735:	bf 0f 00 00 00       	mov    $0xf,%edi
+     73a:	e8 6e 1a 00 00       	call   21ad <fstat>
+     73f:	83 f8 ff             	cmp    $0xffffffff,%eax
+     742:	74 5c                	je     7a0 <testinvalidargs+0x41c>
+    error("tried to fstat on a non existent file descriptor");
+     744:	8b 05 46 2b 00 00    	mov    0x2b46(%rip),%eax        # 3290 <stdout>
+     74a:	ba 83 00 00 00       	mov    $0x83,%edx
+     74f:	48 8d 0d 89 1d 00 00 	lea    0x1d89(%rip),%rcx        # 24df <malloc+0x143>
+     756:	48 89 ce             	mov    %rcx,%rsi
+     759:	89 c7                	mov    %eax,%edi
+     75b:	b8 00 00 00 00       	mov    $0x0,%eax
+     760:	e8 49 14 00 00       	call   1bae <printf>
+     765:	8b 05 25 2b 00 00    	mov    0x2b25(%rip),%eax        # 3290 <stdout>
+     76b:	48 8d 15 76 20 00 00 	lea    0x2076(%rip),%rdx        # 27e8 <malloc+0x44c>
+     772:	48 89 d6             	mov    %rdx,%rsi
+     775:	89 c7                	mov    %eax,%edi
+     777:	b8 00 00 00 00       	mov    $0x0,%eax
+     77c:	e8 2d 14 00 00       	call   1bae <printf>
+     781:	8b 05 09 2b 00 00    	mov    0x2b09(%rip),%eax        # 3290 <stdout>
+     787:	48 8d 15 90 1d 00 00 	lea    0x1d90(%rip),%rdx        # 251e <malloc+0x182>
+     78e:	48 89 d6             	mov    %rdx,%rsi
+     791:	89 c7                	mov    %eax,%edi
+     793:	b8 00 00 00 00       	mov    $0x0,%eax
+     798:	e8 11 14 00 00       	call   1bae <printf>
+     79d:	90                   	nop
+     79e:	eb fd                	jmp    79d <testinvalidargs+0x419>
+
+  if (fstat(stdout, &st) != 0) error("couldn't fstat on stdout");
+     7a0:	8b 05 ea 2a 00 00    	mov    0x2aea(%rip),%eax        # 3290 <stdout>
+     7a6:	48 8d 55 dc          	lea    -0x24(%rbp),%rdx
+     7aa:	48 89 d6             	mov    %rdx,%rsi
+     7ad:	89 c7                	mov    %eax,%edi
+     7af:	e8 f9 19 00 00       	call   21ad <fstat>
+     7b4:	85 c0                	test   %eax,%eax
+     7b6:	74 5c                	je     814 <testinvalidargs+0x490>
+     7b8:	8b 05 d2 2a 00 00    	mov    0x2ad2(%rip),%eax        # 3290 <stdout>
+     7be:	ba 85 00 00 00       	mov    $0x85,%edx
+     7c3:	48 8d 0d 15 1d 00 00 	lea    0x1d15(%rip),%rcx        # 24df <malloc+0x143>
+     7ca:	48 89 ce             	mov    %rcx,%rsi
+     7cd:	89 c7                	mov    %eax,%edi
+     7cf:	b8 00 00 00 00       	mov    $0x0,%eax
+     7d4:	e8 d5 13 00 00       	call   1bae <printf>
+     7d9:	8b 05 b1 2a 00 00    	mov    0x2ab1(%rip),%eax        # 3290 <stdout>
+     7df:	48 8d 15 33 20 00 00 	lea    0x2033(%rip),%rdx        # 2819 <malloc+0x47d>
+     7e6:	48 89 d6             	mov    %rdx,%rsi
+     7e9:	89 c7                	mov    %eax,%edi
+     7eb:	b8 00 00 00 00       	mov    $0x0,%eax
+     7f0:	e8 b9 13 00 00       	call   1bae <printf>
+     7f5:	8b 05 95 2a 00 00    	mov    0x2a95(%rip),%eax        # 3290 <stdout>
+     7fb:	48 8d 15 1c 1d 00 00 	lea    0x1d1c(%rip),%rdx        # 251e <malloc+0x182>
+     802:	48 89 d6             	mov    %rdx,%rsi
+     805:	89 c7                	mov    %eax,%edi
+     807:	b8 00 00 00 00       	mov    $0x0,%eax
+     80c:	e8 9d 13 00 00       	call   1bae <printf>
+     811:	90                   	nop
+     812:	eb fd                	jmp    811 <testinvalidargs+0x48d>
+
+  assert(st.type == T_DEV);
+     814:	0f b7 45 dc          	movzwl -0x24(%rbp),%eax
+     818:	66 83 f8 03          	cmp    $0x3,%ax
+     81c:	74 2b                	je     849 <testinvalidargs+0x4c5>
+     81e:	8b 05 6c 2a 00 00    	mov    0x2a6c(%rip),%eax        # 3290 <stdout>
+     824:	48 8d 15 07 20 00 00 	lea    0x2007(%rip),%rdx        # 2832 <malloc+0x496>
+     82b:	48 89 d1             	mov    %rdx,%rcx
+     82e:	ba 87 00 00 00       	mov    $0x87,%edx
+     833:	48 8d 35 46 1e 00 00 	lea    0x1e46(%rip),%rsi        # 2680 <malloc+0x2e4>
+     83a:	89 c7                	mov    %eax,%edi
+     83c:	b8 00 00 00 00       	mov    $0x0,%eax
+     841:	e8 68 13 00 00       	call   1bae <printf>
+     846:	90                   	nop
+     847:	eb fd                	jmp    846 <testinvalidargs+0x4c2>
+  assert(st.size == 0);
+     849:	8b 45 e8             	mov    -0x18(%rbp),%eax
+     84c:	85 c0                	test   %eax,%eax
+     84e:	74 2b                	je     87b <testinvalidargs+0x4f7>
+     850:	8b 05 3a 2a 00 00    	mov    0x2a3a(%rip),%eax        # 3290 <stdout>
+     856:	48 8d 15 e6 1f 00 00 	lea    0x1fe6(%rip),%rdx        # 2843 <malloc+0x4a7>
+     85d:	48 89 d1             	mov    %rdx,%rcx
+     860:	ba 88 00 00 00       	mov    $0x88,%edx
+     865:	48 8d 35 14 1e 00 00 	lea    0x1e14(%rip),%rsi        # 2680 <malloc+0x2e4>
+     86c:	89 c7                	mov    %eax,%edi
+     86e:	b8 00 00 00 00       	mov    $0x0,%eax
+     873:	e8 36 13 00 00       	call   1bae <printf>
+     878:	90                   	nop
+     879:	eb fd                	jmp    878 <testinvalidargs+0x4f4>
+
+  if (stat("/small.txt", &st) != 0) error("couldn't stat on '/small.txt'");
+     87b:	48 8d 45 dc          	lea    -0x24(%rbp),%rax
+     87f:	48 89 c6             	mov    %rax,%rsi
+     882:	48 8d 05 97 1c 00 00 	lea    0x1c97(%rip),%rax        # 2520 <malloc+0x184>
+     889:	48 89 c7             	mov    %rax,%rdi
+     88c:	e8 c3 17 00 00       	call   2054 <stat>
+     891:	85 c0                	test   %eax,%eax
+     893:	74 5c                	je     8f1 <testinvalidargs+0x56d>
+     895:	8b 05 f5 29 00 00    	mov    0x29f5(%rip),%eax        # 3290 <stdout>
+     89b:	ba 8a 00 00 00       	mov    $0x8a,%edx
+     8a0:	48 8d 0d 38 1c 00 00 	lea    0x1c38(%rip),%rcx        # 24df <malloc+0x143>
+     8a7:	48 89 ce             	mov    %rcx,%rsi
+     8aa:	89 c7                	mov    %eax,%edi
+     8ac:	b8 00 00 00 00       	mov    $0x0,%eax
+     8b1:	e8 f8 12 00 00       	call   1bae <printf>
+     8b6:	8b 05 d4 29 00 00    	mov    0x29d4(%rip),%eax        # 3290 <stdout>
+     8bc:	48 8d 15 8d 1f 00 00 	lea    0x1f8d(%rip),%rdx        # 2850 <malloc+0x4b4>
+     8c3:	48 89 d6             	mov    %rdx,%rsi
+     8c6:	89 c7                	mov    %eax,%edi
+     8c8:	b8 00 00 00 00       	mov    $0x0,%eax
+     8cd:	e8 dc 12 00 00       	call   1bae <printf>
+     8d2:	8b 05 b8 29 00 00    	mov    0x29b8(%rip),%eax        # 3290 <stdout>
+     8d8:	48 8d 15 3f 1c 00 00 	lea    0x1c3f(%rip),%rdx        # 251e <malloc+0x182>
+     8df:	48 89 d6             	mov    %rdx,%rsi
+     8e2:	89 c7                	mov    %eax,%edi
+     8e4:	b8 00 00 00 00       	mov    $0x0,%eax
+     8e9:	e8 c0 12 00 00       	call   1bae <printf>
+     8ee:	90                   	nop
+     8ef:	eb fd                	jmp    8ee <testinvalidargs+0x56a>
+
+  assert(st.type == T_FILE);
+     8f1:	0f b7 45 dc          	movzwl -0x24(%rbp),%eax
+     8f5:	66 83 f8 02          	cmp    $0x2,%ax
+     8f9:	74 2b                	je     926 <testinvalidargs+0x5a2>
+     8fb:	8b 05 8f 29 00 00    	mov    0x298f(%rip),%eax        # 3290 <stdout>
+     901:	48 8d 15 66 1f 00 00 	lea    0x1f66(%rip),%rdx        # 286e <malloc+0x4d2>
+     908:	48 89 d1             	mov    %rdx,%rcx
+     90b:	ba 8c 00 00 00       	mov    $0x8c,%edx
+     910:	48 8d 35 69 1d 00 00 	lea    0x1d69(%rip),%rsi        # 2680 <malloc+0x2e4>
+     917:	89 c7                	mov    %eax,%edi
+     919:	b8 00 00 00 00       	mov    $0x0,%eax
+     91e:	e8 8b 12 00 00       	call   1bae <printf>
+     923:	90                   	nop
+     924:	eb fd                	jmp    923 <testinvalidargs+0x59f>
+  assert(st.size == 26);
+     926:	8b 45 e8             	mov    -0x18(%rbp),%eax
+     929:	83 f8 1a             	cmp    $0x1a,%eax
+     92c:	74 2b                	je     959 <testinvalidargs+0x5d5>
+     92e:	8b 05 5c 29 00 00    	mov    0x295c(%rip),%eax        # 3290 <stdout>
+     934:	48 8d 15 45 1f 00 00 	lea    0x1f45(%rip),%rdx        # 2880 <malloc+0x4e4>
+     93b:	48 89 d1             	mov    %rdx,%rcx
+     93e:	ba 8d 00 00 00       	mov    $0x8d,%edx
+     943:	48 8d 35 36 1d 00 00 	lea    0x1d36(%rip),%rsi        # 2680 <malloc+0x2e4>
+     94a:	89 c7                	mov    %eax,%edi
+     94c:	b8 00 00 00 00       	mov    $0x0,%eax
+     951:	e8 58 12 00 00       	call   1bae <printf>
+     956:	90                   	nop
+     957:	eb fd                	jmp    956 <testinvalidargs+0x5d2>
+
+  printf(stdout, "passed argument checking for fstat\n");
+     959:	8b 05 31 29 00 00    	mov    0x2931(%rip),%eax        # 3290 <stdout>
+     95f:	48 8d 15 2a 1f 00 00 	lea    0x1f2a(%rip),%rdx        # 2890 <malloc+0x4f4>
+     966:	48 89 d6             	mov    %rdx,%rsi
+     969:	89 c7                	mov    %eax,%edi
+     96b:	b8 00 00 00 00       	mov    $0x0,%eax
+     970:	e8 39 12 00 00       	call   1bae <printf>
+
+  // dup
+  if (dup(15) != -1)
+     975:	bf 0f 00 00 00       	mov    $0xf,%edi
+     97a:	e8 4e 18 00 00       	call   21cd <dup>
+     97f:	83 f8 ff             	cmp    $0xffffffff,%eax
+     982:	74 5c                	je     9e0 <testinvalidargs+0x65c>
+    error("able to duplicated a non open file");
+     984:	8b 05 06 29 00 00    	mov    0x2906(%rip),%eax        # 3290 <stdout>
+     98a:	ba 93 00 00 00       	mov    $0x93,%edx
+     98f:	48 8d 0d 49 1b 00 00 	lea    0x1b49(%rip),%rcx        # 24df <malloc+0x143>
+     996:	48 89 ce             	mov    %rcx,%rsi
+     999:	89 c7                	mov    %eax,%edi
+     99b:	b8 00 00 00 00       	mov    $0x0,%eax
+     9a0:	e8 09 12 00 00       	call   1bae <printf>
+     9a5:	8b 05 e5 28 00 00    	mov    0x28e5(%rip),%eax        # 3290 <stdout>
+     9ab:	48 8d 15 06 1f 00 00 	lea    0x1f06(%rip),%rdx        # 28b8 <malloc+0x51c>
+     9b2:	48 89 d6             	mov    %rdx,%rsi
+     9b5:	89 c7                	mov    %eax,%edi
+     9b7:	b8 00 00 00 00       	mov    $0x0,%eax
+     9bc:	e8 ed 11 00 00       	call   1bae <printf>
+     9c1:	8b 05 c9 28 00 00    	mov    0x28c9(%rip),%eax        # 3290 <stdout>
+     9c7:	48 8d 15 50 1b 00 00 	lea    0x1b50(%rip),%rdx        # 251e <malloc+0x182>
+     9ce:	48 89 d6             	mov    %rdx,%rsi
+     9d1:	89 c7                	mov    %eax,%edi
+     9d3:	b8 00 00 00 00       	mov    $0x0,%eax
+     9d8:	e8 d1 11 00 00       	call   1bae <printf>
+     9dd:	90                   	nop
+     9de:	eb fd                	jmp    9dd <testinvalidargs+0x659>
+
+  printf(stdout, "passed argument checking for dup\n");
+     9e0:	8b 05 aa 28 00 00    	mov    0x28aa(%rip),%eax        # 3290 <stdout>
+     9e6:	48 8d 15 f3 1e 00 00 	lea    0x1ef3(%rip),%rdx        # 28e0 <malloc+0x544>
+     9ed:	48 89 d6             	mov    %rdx,%rsi
+     9f0:	89 c7                	mov    %eax,%edi
+     9f2:	b8 00 00 00 00       	mov    $0x0,%eax
+     9f7:	e8 b2 11 00 00       	call   1bae <printf>
+
+  // close
+  if (close(15) != -1)
+     9fc:	bf 0f 00 00 00       	mov    $0xf,%edi
+     a01:	e8 77 17 00 00       	call   217d <close>
+     a06:	83 f8 ff             	cmp    $0xffffffff,%eax
+     a09:	74 5c                	je     a67 <testinvalidargs+0x6e3>
+    error("able to close non open file");
+     a0b:	8b 05 7f 28 00 00    	mov    0x287f(%rip),%eax        # 3290 <stdout>
+     a11:	ba 99 00 00 00       	mov    $0x99,%edx
+     a16:	48 8d 0d c2 1a 00 00 	lea    0x1ac2(%rip),%rcx        # 24df <malloc+0x143>
+     a1d:	48 89 ce             	mov    %rcx,%rsi
+     a20:	89 c7                	mov    %eax,%edi
+     a22:	b8 00 00 00 00       	mov    $0x0,%eax
+     a27:	e8 82 11 00 00       	call   1bae <printf>
+     a2c:	8b 05 5e 28 00 00    	mov    0x285e(%rip),%eax        # 3290 <stdout>
+     a32:	48 8d 15 c9 1e 00 00 	lea    0x1ec9(%rip),%rdx        # 2902 <malloc+0x566>
+     a39:	48 89 d6             	mov    %rdx,%rsi
+     a3c:	89 c7                	mov    %eax,%edi
+     a3e:	b8 00 00 00 00       	mov    $0x0,%eax
+     a43:	e8 66 11 00 00       	call   1bae <printf>
+     a48:	8b 05 42 28 00 00    	mov    0x2842(%rip),%eax        # 3290 <stdout>
+     a4e:	48 8d 15 c9 1a 00 00 	lea    0x1ac9(%rip),%rdx        # 251e <malloc+0x182>
+     a55:	48 89 d6             	mov    %rdx,%rsi
+     a58:	89 c7                	mov    %eax,%edi
+     a5a:	b8 00 00 00 00       	mov    $0x0,%eax
+     a5f:	e8 4a 11 00 00       	call   1bae <printf>
+     a64:	90                   	nop
+     a65:	eb fd                	jmp    a64 <testinvalidargs+0x6e0>
+
+  if (close(fd) > 0 && close(fd) != -1)
+     a67:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     a6a:	89 c7                	mov    %eax,%edi
+     a6c:	e8 0c 17 00 00       	call   217d <close>
+     a71:	85 c0                	test   %eax,%eax
+     a73:	7e 6b                	jle    ae0 <testinvalidargs+0x75c>
+     a75:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     a78:	89 c7                	mov    %eax,%edi
+     a7a:	e8 fe 16 00 00       	call   217d <close>
+     a7f:	83 f8 ff             	cmp    $0xffffffff,%eax
+     a82:	74 5c                	je     ae0 <testinvalidargs+0x75c>
+    error("able to close same file twice");
+     a84:	8b 05 06 28 00 00    	mov    0x2806(%rip),%eax        # 3290 <stdout>
+     a8a:	ba 9c 00 00 00       	mov    $0x9c,%edx
+     a8f:	48 8d 0d 49 1a 00 00 	lea    0x1a49(%rip),%rcx        # 24df <malloc+0x143>
+     a96:	48 89 ce             	mov    %rcx,%rsi
+     a99:	89 c7                	mov    %eax,%edi
+     a9b:	b8 00 00 00 00       	mov    $0x0,%eax
+     aa0:	e8 09 11 00 00       	call   1bae <printf>
+     aa5:	8b 05 e5 27 00 00    	mov    0x27e5(%rip),%eax        # 3290 <stdout>
+     aab:	48 8d 15 6c 1e 00 00 	lea    0x1e6c(%rip),%rdx        # 291e <malloc+0x582>
+     ab2:	48 89 d6             	mov    %rdx,%rsi
+     ab5:	89 c7                	mov    %eax,%edi
+     ab7:	b8 00 00 00 00       	mov    $0x0,%eax
+     abc:	e8 ed 10 00 00       	call   1bae <printf>
+     ac1:	8b 05 c9 27 00 00    	mov    0x27c9(%rip),%eax        # 3290 <stdout>
+     ac7:	48 8d 15 50 1a 00 00 	lea    0x1a50(%rip),%rdx        # 251e <malloc+0x182>
+     ace:	48 89 d6             	mov    %rdx,%rsi
+     ad1:	89 c7                	mov    %eax,%edi
+     ad3:	b8 00 00 00 00       	mov    $0x0,%eax
+     ad8:	e8 d1 10 00 00       	call   1bae <printf>
+     add:	90                   	nop
+     ade:	eb fd                	jmp    add <testinvalidargs+0x759>
+
+  printf(stdout, "passed argument checking for close\n");
+     ae0:	8b 05 aa 27 00 00    	mov    0x27aa(%rip),%eax        # 3290 <stdout>
+     ae6:	48 8d 15 53 1e 00 00 	lea    0x1e53(%rip),%rdx        # 2940 <malloc+0x5a4>
+     aed:	48 89 d6             	mov    %rdx,%rsi
+     af0:	89 c7                	mov    %eax,%edi
+     af2:	b8 00 00 00 00       	mov    $0x0,%eax
+     af7:	e8 b2 10 00 00       	call   1bae <printf>
+}
+     afc:	90                   	nop
+     afd:	c9                   	leave
+     afe:	c3                   	ret
+
+0000000000000aff <smallfilereadtest>:
+
+void smallfilereadtest(void) {
+     aff:	55                   	push   %rbp
+     b00:	48 89 e5             	mov    %rsp,%rbp
+     b03:	48 83 ec 20          	sub    $0x20,%rsp
+  int fd, i;
+  char buf[11];
+
+  printf(stdout, "small file test\n");
+     b07:	8b 05 83 27 00 00    	mov    0x2783(%rip),%eax        # 3290 <stdout>
+     b0d:	48 8d 15 50 1e 00 00 	lea    0x1e50(%rip),%rdx        # 2964 <malloc+0x5c8>
+     b14:	48 89 d6             	mov    %rdx,%rsi
+     b17:	89 c7                	mov    %eax,%edi
+     b19:	b8 00 00 00 00       	mov    $0x0,%eax
+     b1e:	e8 8b 10 00 00       	call   1bae <printf>
+  // Test read only funcionality
+  fd = open("/small.txt", O_RDONLY);
+     b23:	be 00 00 00 00       	mov    $0x0,%esi
+     b28:	48 8d 05 f1 19 00 00 	lea    0x19f1(%rip),%rax        # 2520 <malloc+0x184>
+     b2f:	48 89 c7             	mov    %rax,%rdi
+     b32:	e8 5e 16 00 00       	call   2195 <open>
+     b37:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  if (fd < 0)
+     b3a:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     b3e:	79 5c                	jns    b9c <smallfilereadtest+0x9d>
+    error("unable to open small file");
+     b40:	8b 05 4a 27 00 00    	mov    0x274a(%rip),%eax        # 3290 <stdout>
+     b46:	ba a9 00 00 00       	mov    $0xa9,%edx
+     b4b:	48 8d 0d 8d 19 00 00 	lea    0x198d(%rip),%rcx        # 24df <malloc+0x143>
+     b52:	48 89 ce             	mov    %rcx,%rsi
+     b55:	89 c7                	mov    %eax,%edi
+     b57:	b8 00 00 00 00       	mov    $0x0,%eax
+     b5c:	e8 4d 10 00 00       	call   1bae <printf>
+     b61:	8b 05 29 27 00 00    	mov    0x2729(%rip),%eax        # 3290 <stdout>
+     b67:	48 8d 15 07 1e 00 00 	lea    0x1e07(%rip),%rdx        # 2975 <malloc+0x5d9>
+     b6e:	48 89 d6             	mov    %rdx,%rsi
+     b71:	89 c7                	mov    %eax,%edi
+     b73:	b8 00 00 00 00       	mov    $0x0,%eax
+     b78:	e8 31 10 00 00       	call   1bae <printf>
+     b7d:	8b 05 0d 27 00 00    	mov    0x270d(%rip),%eax        # 3290 <stdout>
+     b83:	48 8d 15 94 19 00 00 	lea    0x1994(%rip),%rdx        # 251e <malloc+0x182>
+     b8a:	48 89 d6             	mov    %rdx,%rsi
+     b8d:	89 c7                	mov    %eax,%edi
+     b8f:	b8 00 00 00 00       	mov    $0x0,%eax
+     b94:	e8 15 10 00 00       	call   1bae <printf>
+     b99:	90                   	nop
+     b9a:	eb fd                	jmp    b99 <smallfilereadtest+0x9a>
+
+  printf(stdout, "open small file succeeded; ok\n");
+     b9c:	8b 05 ee 26 00 00    	mov    0x26ee(%rip),%eax        # 3290 <stdout>
+     ba2:	48 8d 15 e7 1d 00 00 	lea    0x1de7(%rip),%rdx        # 2990 <malloc+0x5f4>
+     ba9:	48 89 d6             	mov    %rdx,%rsi
+     bac:	89 c7                	mov    %eax,%edi
+     bae:	b8 00 00 00 00       	mov    $0x0,%eax
+     bb3:	e8 f6 0f 00 00       	call   1bae <printf>
+
+  if ((i = read(fd, buf, 10)) != 10)
+     bb8:	48 8d 4d ed          	lea    -0x13(%rbp),%rcx
+     bbc:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     bbf:	ba 0a 00 00 00       	mov    $0xa,%edx
+     bc4:	48 89 ce             	mov    %rcx,%rsi
+     bc7:	89 c7                	mov    %eax,%edi
+     bc9:	e8 9f 15 00 00       	call   216d <read>
+     bce:	89 45 f8             	mov    %eax,-0x8(%rbp)
+     bd1:	83 7d f8 0a          	cmpl   $0xa,-0x8(%rbp)
+     bd5:	74 5f                	je     c36 <smallfilereadtest+0x137>
+    error("read of first 10 bytes unsucessful was %d bytes", i);
+     bd7:	8b 05 b3 26 00 00    	mov    0x26b3(%rip),%eax        # 3290 <stdout>
+     bdd:	ba ae 00 00 00       	mov    $0xae,%edx
+     be2:	48 8d 0d f6 18 00 00 	lea    0x18f6(%rip),%rcx        # 24df <malloc+0x143>
+     be9:	48 89 ce             	mov    %rcx,%rsi
+     bec:	89 c7                	mov    %eax,%edi
+     bee:	b8 00 00 00 00       	mov    $0x0,%eax
+     bf3:	e8 b6 0f 00 00       	call   1bae <printf>
+     bf8:	8b 05 92 26 00 00    	mov    0x2692(%rip),%eax        # 3290 <stdout>
+     bfe:	8b 55 f8             	mov    -0x8(%rbp),%edx
+     c01:	48 8d 0d a8 1d 00 00 	lea    0x1da8(%rip),%rcx        # 29b0 <malloc+0x614>
+     c08:	48 89 ce             	mov    %rcx,%rsi
+     c0b:	89 c7                	mov    %eax,%edi
+     c0d:	b8 00 00 00 00       	mov    $0x0,%eax
+     c12:	e8 97 0f 00 00       	call   1bae <printf>
+     c17:	8b 05 73 26 00 00    	mov    0x2673(%rip),%eax        # 3290 <stdout>
+     c1d:	48 8d 15 fa 18 00 00 	lea    0x18fa(%rip),%rdx        # 251e <malloc+0x182>
+     c24:	48 89 d6             	mov    %rdx,%rsi
+     c27:	89 c7                	mov    %eax,%edi
+     c29:	b8 00 00 00 00       	mov    $0x0,%eax
+     c2e:	e8 7b 0f 00 00       	call   1bae <printf>
+     c33:	90                   	nop
+     c34:	eb fd                	jmp    c33 <smallfilereadtest+0x134>
+
+  buf[10] = 0;
+     c36:	c6 45 f7 00          	movb   $0x0,-0x9(%rbp)
+  if (strcmp(buf, "aaaaaaaaaa") != 0)
+     c3a:	48 8d 45 ed          	lea    -0x13(%rbp),%rax
+     c3e:	48 8d 15 9b 1d 00 00 	lea    0x1d9b(%rip),%rdx        # 29e0 <malloc+0x644>
+     c45:	48 89 d6             	mov    %rdx,%rsi
+     c48:	48 89 c7             	mov    %rax,%rdi
+     c4b:	e8 9f 12 00 00       	call   1eef <strcmp>
+     c50:	85 c0                	test   %eax,%eax
+     c52:	74 60                	je     cb4 <smallfilereadtest+0x1b5>
+    error("buf was not 10 a's, was: '%s'", buf);
+     c54:	8b 05 36 26 00 00    	mov    0x2636(%rip),%eax        # 3290 <stdout>
+     c5a:	ba b2 00 00 00       	mov    $0xb2,%edx
+     c5f:	48 8d 0d 79 18 00 00 	lea    0x1879(%rip),%rcx        # 24df <malloc+0x143>
+     c66:	48 89 ce             	mov    %rcx,%rsi
+     c69:	89 c7                	mov    %eax,%edi
+     c6b:	b8 00 00 00 00       	mov    $0x0,%eax
+     c70:	e8 39 0f 00 00       	call   1bae <printf>
+     c75:	8b 05 15 26 00 00    	mov    0x2615(%rip),%eax        # 3290 <stdout>
+     c7b:	48 8d 55 ed          	lea    -0x13(%rbp),%rdx
+     c7f:	48 8d 0d 65 1d 00 00 	lea    0x1d65(%rip),%rcx        # 29eb <malloc+0x64f>
+     c86:	48 89 ce             	mov    %rcx,%rsi
+     c89:	89 c7                	mov    %eax,%edi
+     c8b:	b8 00 00 00 00       	mov    $0x0,%eax
+     c90:	e8 19 0f 00 00       	call   1bae <printf>
+     c95:	8b 05 f5 25 00 00    	mov    0x25f5(%rip),%eax        # 3290 <stdout>
+     c9b:	48 8d 15 7c 18 00 00 	lea    0x187c(%rip),%rdx        # 251e <malloc+0x182>
+     ca2:	48 89 d6             	mov    %rdx,%rsi
+     ca5:	89 c7                	mov    %eax,%edi
+     ca7:	b8 00 00 00 00       	mov    $0x0,%eax
+     cac:	e8 fd 0e 00 00       	call   1bae <printf>
+     cb1:	90                   	nop
+     cb2:	eb fd                	jmp    cb1 <smallfilereadtest+0x1b2>
+  printf(stdout, "read of first 10 bytes sucessful\n");
+     cb4:	8b 05 d6 25 00 00    	mov    0x25d6(%rip),%eax        # 3290 <stdout>
+     cba:	48 8d 15 4f 1d 00 00 	lea    0x1d4f(%rip),%rdx        # 2a10 <malloc+0x674>
+     cc1:	48 89 d6             	mov    %rdx,%rsi
+     cc4:	89 c7                	mov    %eax,%edi
+     cc6:	b8 00 00 00 00       	mov    $0x0,%eax
+     ccb:	e8 de 0e 00 00       	call   1bae <printf>
+
+  if ((i = read(fd, buf, 10)) != 10)
+     cd0:	48 8d 4d ed          	lea    -0x13(%rbp),%rcx
+     cd4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     cd7:	ba 0a 00 00 00       	mov    $0xa,%edx
+     cdc:	48 89 ce             	mov    %rcx,%rsi
+     cdf:	89 c7                	mov    %eax,%edi
+     ce1:	e8 87 14 00 00       	call   216d <read>
+     ce6:	89 45 f8             	mov    %eax,-0x8(%rbp)
+     ce9:	83 7d f8 0a          	cmpl   $0xa,-0x8(%rbp)
+     ced:	74 5f                	je     d4e <smallfilereadtest+0x24f>
+    error("read of second 10 bytes unsucessful was %d bytes", i);
+     cef:	8b 05 9b 25 00 00    	mov    0x259b(%rip),%eax        # 3290 <stdout>
+     cf5:	ba b6 00 00 00       	mov    $0xb6,%edx
+     cfa:	48 8d 0d de 17 00 00 	lea    0x17de(%rip),%rcx        # 24df <malloc+0x143>
+     d01:	48 89 ce             	mov    %rcx,%rsi
+     d04:	89 c7                	mov    %eax,%edi
+     d06:	b8 00 00 00 00       	mov    $0x0,%eax
+     d0b:	e8 9e 0e 00 00       	call   1bae <printf>
+     d10:	8b 05 7a 25 00 00    	mov    0x257a(%rip),%eax        # 3290 <stdout>
+     d16:	8b 55 f8             	mov    -0x8(%rbp),%edx
+     d19:	48 8d 0d 18 1d 00 00 	lea    0x1d18(%rip),%rcx        # 2a38 <malloc+0x69c>
+     d20:	48 89 ce             	mov    %rcx,%rsi
+     d23:	89 c7                	mov    %eax,%edi
+     d25:	b8 00 00 00 00       	mov    $0x0,%eax
+     d2a:	e8 7f 0e 00 00       	call   1bae <printf>
+     d2f:	8b 05 5b 25 00 00    	mov    0x255b(%rip),%eax        # 3290 <stdout>
+     d35:	48 8d 15 e2 17 00 00 	lea    0x17e2(%rip),%rdx        # 251e <malloc+0x182>
+     d3c:	48 89 d6             	mov    %rdx,%rsi
+     d3f:	89 c7                	mov    %eax,%edi
+     d41:	b8 00 00 00 00       	mov    $0x0,%eax
+     d46:	e8 63 0e 00 00       	call   1bae <printf>
+     d4b:	90                   	nop
+     d4c:	eb fd                	jmp    d4b <smallfilereadtest+0x24c>
+
+  buf[10] = 0;
+     d4e:	c6 45 f7 00          	movb   $0x0,-0x9(%rbp)
+  if (strcmp(buf, "bbbbbbbbbb") != 0)
+     d52:	48 8d 45 ed          	lea    -0x13(%rbp),%rax
+     d56:	48 8d 15 0c 1d 00 00 	lea    0x1d0c(%rip),%rdx        # 2a69 <malloc+0x6cd>
+     d5d:	48 89 d6             	mov    %rdx,%rsi
+     d60:	48 89 c7             	mov    %rax,%rdi
+     d63:	e8 87 11 00 00       	call   1eef <strcmp>
+     d68:	85 c0                	test   %eax,%eax
+     d6a:	74 60                	je     dcc <smallfilereadtest+0x2cd>
+    error("buf was not 10 b's, was: '%s'", buf);
+     d6c:	8b 05 1e 25 00 00    	mov    0x251e(%rip),%eax        # 3290 <stdout>
+     d72:	ba ba 00 00 00       	mov    $0xba,%edx
+     d77:	48 8d 0d 61 17 00 00 	lea    0x1761(%rip),%rcx        # 24df <malloc+0x143>
+     d7e:	48 89 ce             	mov    %rcx,%rsi
+     d81:	89 c7                	mov    %eax,%edi
+     d83:	b8 00 00 00 00       	mov    $0x0,%eax
+     d88:	e8 21 0e 00 00       	call   1bae <printf>
+     d8d:	8b 05 fd 24 00 00    	mov    0x24fd(%rip),%eax        # 3290 <stdout>
+     d93:	48 8d 55 ed          	lea    -0x13(%rbp),%rdx
+     d97:	48 8d 0d d6 1c 00 00 	lea    0x1cd6(%rip),%rcx        # 2a74 <malloc+0x6d8>
+     d9e:	48 89 ce             	mov    %rcx,%rsi
+     da1:	89 c7                	mov    %eax,%edi
+     da3:	b8 00 00 00 00       	mov    $0x0,%eax
+     da8:	e8 01 0e 00 00       	call   1bae <printf>
+     dad:	8b 05 dd 24 00 00    	mov    0x24dd(%rip),%eax        # 3290 <stdout>
+     db3:	48 8d 15 64 17 00 00 	lea    0x1764(%rip),%rdx        # 251e <malloc+0x182>
+     dba:	48 89 d6             	mov    %rdx,%rsi
+     dbd:	89 c7                	mov    %eax,%edi
+     dbf:	b8 00 00 00 00       	mov    $0x0,%eax
+     dc4:	e8 e5 0d 00 00       	call   1bae <printf>
+     dc9:	90                   	nop
+     dca:	eb fd                	jmp    dc9 <smallfilereadtest+0x2ca>
+  printf(stdout, "read of second 10 bytes sucessful\n");
+     dcc:	8b 05 be 24 00 00    	mov    0x24be(%rip),%eax        # 3290 <stdout>
+     dd2:	48 8d 15 bf 1c 00 00 	lea    0x1cbf(%rip),%rdx        # 2a98 <malloc+0x6fc>
+     dd9:	48 89 d6             	mov    %rdx,%rsi
+     ddc:	89 c7                	mov    %eax,%edi
+     dde:	b8 00 00 00 00       	mov    $0x0,%eax
+     de3:	e8 c6 0d 00 00       	call   1bae <printf>
+
+  // only 25 byte file
+  if ((i = read(fd, buf, 10)) != 6)
+     de8:	48 8d 4d ed          	lea    -0x13(%rbp),%rcx
+     dec:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     def:	ba 0a 00 00 00       	mov    $0xa,%edx
+     df4:	48 89 ce             	mov    %rcx,%rsi
+     df7:	89 c7                	mov    %eax,%edi
+     df9:	e8 6f 13 00 00       	call   216d <read>
+     dfe:	89 45 f8             	mov    %eax,-0x8(%rbp)
+     e01:	83 7d f8 06          	cmpl   $0x6,-0x8(%rbp)
+     e05:	74 5f                	je     e66 <smallfilereadtest+0x367>
+    error("read of last 6 bytes unsucessful was %d bytes", i);
+     e07:	8b 05 83 24 00 00    	mov    0x2483(%rip),%eax        # 3290 <stdout>
+     e0d:	ba bf 00 00 00       	mov    $0xbf,%edx
+     e12:	48 8d 0d c6 16 00 00 	lea    0x16c6(%rip),%rcx        # 24df <malloc+0x143>
+     e19:	48 89 ce             	mov    %rcx,%rsi
+     e1c:	89 c7                	mov    %eax,%edi
+     e1e:	b8 00 00 00 00       	mov    $0x0,%eax
+     e23:	e8 86 0d 00 00       	call   1bae <printf>
+     e28:	8b 05 62 24 00 00    	mov    0x2462(%rip),%eax        # 3290 <stdout>
+     e2e:	8b 55 f8             	mov    -0x8(%rbp),%edx
+     e31:	48 8d 0d 88 1c 00 00 	lea    0x1c88(%rip),%rcx        # 2ac0 <malloc+0x724>
+     e38:	48 89 ce             	mov    %rcx,%rsi
+     e3b:	89 c7                	mov    %eax,%edi
+     e3d:	b8 00 00 00 00       	mov    $0x0,%eax
+     e42:	e8 67 0d 00 00       	call   1bae <printf>
+     e47:	8b 05 43 24 00 00    	mov    0x2443(%rip),%eax        # 3290 <stdout>
+     e4d:	48 8d 15 ca 16 00 00 	lea    0x16ca(%rip),%rdx        # 251e <malloc+0x182>
+     e54:	48 89 d6             	mov    %rdx,%rsi
+     e57:	89 c7                	mov    %eax,%edi
+     e59:	b8 00 00 00 00       	mov    $0x0,%eax
+     e5e:	e8 4b 0d 00 00       	call   1bae <printf>
+     e63:	90                   	nop
+     e64:	eb fd                	jmp    e63 <smallfilereadtest+0x364>
+
+  buf[6] = 0;
+     e66:	c6 45 f3 00          	movb   $0x0,-0xd(%rbp)
+  if (strcmp(buf, "ccccc\n") != 0)
+     e6a:	48 8d 45 ed          	lea    -0x13(%rbp),%rax
+     e6e:	48 8d 15 79 1c 00 00 	lea    0x1c79(%rip),%rdx        # 2aee <malloc+0x752>
+     e75:	48 89 d6             	mov    %rdx,%rsi
+     e78:	48 89 c7             	mov    %rax,%rdi
+     e7b:	e8 6f 10 00 00       	call   1eef <strcmp>
+     e80:	85 c0                	test   %eax,%eax
+     e82:	74 60                	je     ee4 <smallfilereadtest+0x3e5>
+    error("buf was not 5 c's (and a newline), was: '%s'", buf);
+     e84:	8b 05 06 24 00 00    	mov    0x2406(%rip),%eax        # 3290 <stdout>
+     e8a:	ba c3 00 00 00       	mov    $0xc3,%edx
+     e8f:	48 8d 0d 49 16 00 00 	lea    0x1649(%rip),%rcx        # 24df <malloc+0x143>
+     e96:	48 89 ce             	mov    %rcx,%rsi
+     e99:	89 c7                	mov    %eax,%edi
+     e9b:	b8 00 00 00 00       	mov    $0x0,%eax
+     ea0:	e8 09 0d 00 00       	call   1bae <printf>
+     ea5:	8b 05 e5 23 00 00    	mov    0x23e5(%rip),%eax        # 3290 <stdout>
+     eab:	48 8d 55 ed          	lea    -0x13(%rbp),%rdx
+     eaf:	48 8d 0d 42 1c 00 00 	lea    0x1c42(%rip),%rcx        # 2af8 <malloc+0x75c>
+     eb6:	48 89 ce             	mov    %rcx,%rsi
+     eb9:	89 c7                	mov    %eax,%edi
+     ebb:	b8 00 00 00 00       	mov    $0x0,%eax
+     ec0:	e8 e9 0c 00 00       	call   1bae <printf>
+     ec5:	8b 05 c5 23 00 00    	mov    0x23c5(%rip),%eax        # 3290 <stdout>
+     ecb:	48 8d 15 4c 16 00 00 	lea    0x164c(%rip),%rdx        # 251e <malloc+0x182>
+     ed2:	48 89 d6             	mov    %rdx,%rsi
+     ed5:	89 c7                	mov    %eax,%edi
+     ed7:	b8 00 00 00 00       	mov    $0x0,%eax
+     edc:	e8 cd 0c 00 00       	call   1bae <printf>
+     ee1:	90                   	nop
+     ee2:	eb fd                	jmp    ee1 <smallfilereadtest+0x3e2>
+
+  printf(stdout, "read of last 5 bytes sucessful\n");
+     ee4:	8b 05 a6 23 00 00    	mov    0x23a6(%rip),%eax        # 3290 <stdout>
+     eea:	48 8d 15 37 1c 00 00 	lea    0x1c37(%rip),%rdx        # 2b28 <malloc+0x78c>
+     ef1:	48 89 d6             	mov    %rdx,%rsi
+     ef4:	89 c7                	mov    %eax,%edi
+     ef6:	b8 00 00 00 00       	mov    $0x0,%eax
+     efb:	e8 ae 0c 00 00       	call   1bae <printf>
+
+  if (read(fd, buf, 10) != 0)
+     f00:	48 8d 4d ed          	lea    -0x13(%rbp),%rcx
+     f04:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     f07:	ba 0a 00 00 00       	mov    $0xa,%edx
+     f0c:	48 89 ce             	mov    %rcx,%rsi
+     f0f:	89 c7                	mov    %eax,%edi
+     f11:	e8 57 12 00 00       	call   216d <read>
+     f16:	85 c0                	test   %eax,%eax
+     f18:	74 5c                	je     f76 <smallfilereadtest+0x477>
+    error("read more bytes than should be possible");
+     f1a:	8b 05 70 23 00 00    	mov    0x2370(%rip),%eax        # 3290 <stdout>
+     f20:	ba c8 00 00 00       	mov    $0xc8,%edx
+     f25:	48 8d 0d b3 15 00 00 	lea    0x15b3(%rip),%rcx        # 24df <malloc+0x143>
+     f2c:	48 89 ce             	mov    %rcx,%rsi
+     f2f:	89 c7                	mov    %eax,%edi
+     f31:	b8 00 00 00 00       	mov    $0x0,%eax
+     f36:	e8 73 0c 00 00       	call   1bae <printf>
+     f3b:	8b 05 4f 23 00 00    	mov    0x234f(%rip),%eax        # 3290 <stdout>
+     f41:	48 8d 15 00 1c 00 00 	lea    0x1c00(%rip),%rdx        # 2b48 <malloc+0x7ac>
+     f48:	48 89 d6             	mov    %rdx,%rsi
+     f4b:	89 c7                	mov    %eax,%edi
+     f4d:	b8 00 00 00 00       	mov    $0x0,%eax
+     f52:	e8 57 0c 00 00       	call   1bae <printf>
+     f57:	8b 05 33 23 00 00    	mov    0x2333(%rip),%eax        # 3290 <stdout>
+     f5d:	48 8d 15 ba 15 00 00 	lea    0x15ba(%rip),%rdx        # 251e <malloc+0x182>
+     f64:	48 89 d6             	mov    %rdx,%rsi
+     f67:	89 c7                	mov    %eax,%edi
+     f69:	b8 00 00 00 00       	mov    $0x0,%eax
+     f6e:	e8 3b 0c 00 00       	call   1bae <printf>
+     f73:	90                   	nop
+     f74:	eb fd                	jmp    f73 <smallfilereadtest+0x474>
+
+  strcpy(buf, "stdout\n");
+     f76:	48 8d 45 ed          	lea    -0x13(%rbp),%rax
+     f7a:	48 8d 15 ef 1b 00 00 	lea    0x1bef(%rip),%rdx        # 2b70 <malloc+0x7d4>
+     f81:	48 89 d6             	mov    %rdx,%rsi
+     f84:	48 89 c7             	mov    %rax,%rdi
+     f87:	e8 24 0f 00 00       	call   1eb0 <strcpy>
+
+  if ((i = write(stdout, buf, 7)) != 7)
+     f8c:	8b 05 fe 22 00 00    	mov    0x22fe(%rip),%eax        # 3290 <stdout>
+     f92:	48 8d 4d ed          	lea    -0x13(%rbp),%rcx
+     f96:	ba 07 00 00 00       	mov    $0x7,%edx
+     f9b:	48 89 ce             	mov    %rcx,%rsi
+     f9e:	89 c7                	mov    %eax,%edi
+     fa0:	e8 d0 11 00 00       	call   2175 <write>
+     fa5:	89 45 f8             	mov    %eax,-0x8(%rbp)
+     fa8:	83 7d f8 07          	cmpl   $0x7,-0x8(%rbp)
+     fac:	74 5f                	je     100d <smallfilereadtest+0x50e>
+    error("wasn't able to write to stdout, return value was '%d'", i);
+     fae:	8b 05 dc 22 00 00    	mov    0x22dc(%rip),%eax        # 3290 <stdout>
+     fb4:	ba cd 00 00 00       	mov    $0xcd,%edx
+     fb9:	48 8d 0d 1f 15 00 00 	lea    0x151f(%rip),%rcx        # 24df <malloc+0x143>
+     fc0:	48 89 ce             	mov    %rcx,%rsi
+     fc3:	89 c7                	mov    %eax,%edi
+     fc5:	b8 00 00 00 00       	mov    $0x0,%eax
+     fca:	e8 df 0b 00 00       	call   1bae <printf>
+     fcf:	8b 05 bb 22 00 00    	mov    0x22bb(%rip),%eax        # 3290 <stdout>
+     fd5:	8b 55 f8             	mov    -0x8(%rbp),%edx
+     fd8:	48 8d 0d 99 1b 00 00 	lea    0x1b99(%rip),%rcx        # 2b78 <malloc+0x7dc>
+     fdf:	48 89 ce             	mov    %rcx,%rsi
+     fe2:	89 c7                	mov    %eax,%edi
+     fe4:	b8 00 00 00 00       	mov    $0x0,%eax
+     fe9:	e8 c0 0b 00 00       	call   1bae <printf>
+     fee:	8b 05 9c 22 00 00    	mov    0x229c(%rip),%eax        # 3290 <stdout>
+     ff4:	48 8d 15 23 15 00 00 	lea    0x1523(%rip),%rdx        # 251e <malloc+0x182>
+     ffb:	48 89 d6             	mov    %rdx,%rsi
+     ffe:	89 c7                	mov    %eax,%edi
+    1000:	b8 00 00 00 00       	mov    $0x0,%eax
+    1005:	e8 a4 0b 00 00       	call   1bae <printf>
+    100a:	90                   	nop
+    100b:	eb fd                	jmp    100a <smallfilereadtest+0x50b>
+
+  printf(stdout, "write to stdout directly ok\n");
+    100d:	8b 05 7d 22 00 00    	mov    0x227d(%rip),%eax        # 3290 <stdout>
+    1013:	48 8d 15 94 1b 00 00 	lea    0x1b94(%rip),%rdx        # 2bae <malloc+0x812>
+    101a:	48 89 d6             	mov    %rdx,%rsi
+    101d:	89 c7                	mov    %eax,%edi
+    101f:	b8 00 00 00 00       	mov    $0x0,%eax
+    1024:	e8 85 0b 00 00       	call   1bae <printf>
+
+  if (close(fd) != 0)
+    1029:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    102c:	89 c7                	mov    %eax,%edi
+    102e:	e8 4a 11 00 00       	call   217d <close>
+    1033:	85 c0                	test   %eax,%eax
+    1035:	74 5c                	je     1093 <smallfilereadtest+0x594>
+    error("error closing fd");
+    1037:	8b 05 53 22 00 00    	mov    0x2253(%rip),%eax        # 3290 <stdout>
+    103d:	ba d2 00 00 00       	mov    $0xd2,%edx
+    1042:	48 8d 0d 96 14 00 00 	lea    0x1496(%rip),%rcx        # 24df <malloc+0x143>
+    1049:	48 89 ce             	mov    %rcx,%rsi
+    104c:	89 c7                	mov    %eax,%edi
+    104e:	b8 00 00 00 00       	mov    $0x0,%eax
+    1053:	e8 56 0b 00 00       	call   1bae <printf>
+    1058:	8b 05 32 22 00 00    	mov    0x2232(%rip),%eax        # 3290 <stdout>
+    105e:	48 8d 15 66 1b 00 00 	lea    0x1b66(%rip),%rdx        # 2bcb <malloc+0x82f>
+    1065:	48 89 d6             	mov    %rdx,%rsi
+    1068:	89 c7                	mov    %eax,%edi
+    106a:	b8 00 00 00 00       	mov    $0x0,%eax
+    106f:	e8 3a 0b 00 00       	call   1bae <printf>
+    1074:	8b 05 16 22 00 00    	mov    0x2216(%rip),%eax        # 3290 <stdout>
+    107a:	48 8d 15 9d 14 00 00 	lea    0x149d(%rip),%rdx        # 251e <malloc+0x182>
+    1081:	48 89 d6             	mov    %rdx,%rsi
+    1084:	89 c7                	mov    %eax,%edi
+    1086:	b8 00 00 00 00       	mov    $0x0,%eax
+    108b:	e8 1e 0b 00 00       	call   1bae <printf>
+    1090:	90                   	nop
+    1091:	eb fd                	jmp    1090 <smallfilereadtest+0x591>
+
+  printf(stdout, "small file test ok\n");
+    1093:	8b 05 f7 21 00 00    	mov    0x21f7(%rip),%eax        # 3290 <stdout>
+    1099:	48 8d 15 3c 1b 00 00 	lea    0x1b3c(%rip),%rdx        # 2bdc <malloc+0x840>
+    10a0:	48 89 d6             	mov    %rdx,%rsi
+    10a3:	89 c7                	mov    %eax,%edi
+    10a5:	b8 00 00 00 00       	mov    $0x0,%eax
+    10aa:	e8 ff 0a 00 00       	call   1bae <printf>
+}
+    10af:	90                   	nop
+    10b0:	c9                   	leave
+    10b1:	c3                   	ret
+
+00000000000010b2 <duptest>:
+
+void duptest(void) {
+    10b2:	55                   	push   %rbp
+    10b3:	48 89 e5             	mov    %rsp,%rbp
+    10b6:	53                   	push   %rbx
+    10b7:	48 81 ec 88 00 00 00 	sub    $0x88,%rsp
+  int fd1, fd2, stdout_cpy;
+  char buf[100];
+
+//  printf(stdout, "dup test\n");
+  // Test read only funcionality
+  fd1 = open("/small.txt", O_RDONLY);
+    10be:	be 00 00 00 00       	mov    $0x0,%esi
+    10c3:	48 8d 05 56 14 00 00 	lea    0x1456(%rip),%rax        # 2520 <malloc+0x184>
+    10ca:	48 89 c7             	mov    %rax,%rdi
+    10cd:	e8 c3 10 00 00       	call   2195 <open>
+    10d2:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  if (fd1 < 0)
+    10d5:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+    10d9:	79 5c                	jns    1137 <duptest+0x85>
+    error("unable to open small file");
+    10db:	8b 05 af 21 00 00    	mov    0x21af(%rip),%eax        # 3290 <stdout>
+    10e1:	ba df 00 00 00       	mov    $0xdf,%edx
+    10e6:	48 8d 0d f2 13 00 00 	lea    0x13f2(%rip),%rcx        # 24df <malloc+0x143>
+    10ed:	48 89 ce             	mov    %rcx,%rsi
+    10f0:	89 c7                	mov    %eax,%edi
+    10f2:	b8 00 00 00 00       	mov    $0x0,%eax
+    10f7:	e8 b2 0a 00 00       	call   1bae <printf>
+    10fc:	8b 05 8e 21 00 00    	mov    0x218e(%rip),%eax        # 3290 <stdout>
+    1102:	48 8d 15 6c 18 00 00 	lea    0x186c(%rip),%rdx        # 2975 <malloc+0x5d9>
+    1109:	48 89 d6             	mov    %rdx,%rsi
+    110c:	89 c7                	mov    %eax,%edi
+    110e:	b8 00 00 00 00       	mov    $0x0,%eax
+    1113:	e8 96 0a 00 00       	call   1bae <printf>
+    1118:	8b 05 72 21 00 00    	mov    0x2172(%rip),%eax        # 3290 <stdout>
+    111e:	48 8d 15 f9 13 00 00 	lea    0x13f9(%rip),%rdx        # 251e <malloc+0x182>
+    1125:	48 89 d6             	mov    %rdx,%rsi
+    1128:	89 c7                	mov    %eax,%edi
+    112a:	b8 00 00 00 00       	mov    $0x0,%eax
+    112f:	e8 7a 0a 00 00       	call   1bae <printf>
+    1134:	90                   	nop
+    1135:	eb fd                	jmp    1134 <duptest+0x82>
+
+  if ((fd2 = dup(fd1)) != fd1 + 1)
+    1137:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    113a:	89 c7                	mov    %eax,%edi
+    113c:	e8 8c 10 00 00       	call   21cd <dup>
+    1141:	89 45 e8             	mov    %eax,-0x18(%rbp)
+    1144:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    1147:	83 c0 01             	add    $0x1,%eax
+    114a:	39 45 e8             	cmp    %eax,-0x18(%rbp)
+    114d:	74 5f                	je     11ae <duptest+0xfc>
+    error("returned fd from dup was not the smallest free fd, was '%d'", fd2);
+    114f:	8b 05 3b 21 00 00    	mov    0x213b(%rip),%eax        # 3290 <stdout>
+    1155:	ba e2 00 00 00       	mov    $0xe2,%edx
+    115a:	48 8d 0d 7e 13 00 00 	lea    0x137e(%rip),%rcx        # 24df <malloc+0x143>
+    1161:	48 89 ce             	mov    %rcx,%rsi
+    1164:	89 c7                	mov    %eax,%edi
+    1166:	b8 00 00 00 00       	mov    $0x0,%eax
+    116b:	e8 3e 0a 00 00       	call   1bae <printf>
+    1170:	8b 05 1a 21 00 00    	mov    0x211a(%rip),%eax        # 3290 <stdout>
+    1176:	8b 55 e8             	mov    -0x18(%rbp),%edx
+    1179:	48 8d 0d 70 1a 00 00 	lea    0x1a70(%rip),%rcx        # 2bf0 <malloc+0x854>
+    1180:	48 89 ce             	mov    %rcx,%rsi
+    1183:	89 c7                	mov    %eax,%edi
+    1185:	b8 00 00 00 00       	mov    $0x0,%eax
+    118a:	e8 1f 0a 00 00       	call   1bae <printf>
+    118f:	8b 05 fb 20 00 00    	mov    0x20fb(%rip),%eax        # 3290 <stdout>
+    1195:	48 8d 15 82 13 00 00 	lea    0x1382(%rip),%rdx        # 251e <malloc+0x182>
+    119c:	48 89 d6             	mov    %rdx,%rsi
+    119f:	89 c7                	mov    %eax,%edi
+    11a1:	b8 00 00 00 00       	mov    $0x0,%eax
+    11a6:	e8 03 0a 00 00       	call   1bae <printf>
+    11ab:	90                   	nop
+    11ac:	eb fd                	jmp    11ab <duptest+0xf9>
+
+  // test offsets are respected in dupped files
+  assert(read(fd1, buf, 10) == 10);
+    11ae:	48 8d 8d 74 ff ff ff 	lea    -0x8c(%rbp),%rcx
+    11b5:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    11b8:	ba 0a 00 00 00       	mov    $0xa,%edx
+    11bd:	48 89 ce             	mov    %rcx,%rsi
+    11c0:	89 c7                	mov    %eax,%edi
+    11c2:	e8 a6 0f 00 00       	call   216d <read>
+    11c7:	83 f8 0a             	cmp    $0xa,%eax
+    11ca:	74 2b                	je     11f7 <duptest+0x145>
+    11cc:	8b 05 be 20 00 00    	mov    0x20be(%rip),%eax        # 3290 <stdout>
+    11d2:	48 8d 15 53 1a 00 00 	lea    0x1a53(%rip),%rdx        # 2c2c <malloc+0x890>
+    11d9:	48 89 d1             	mov    %rdx,%rcx
+    11dc:	ba e5 00 00 00       	mov    $0xe5,%edx
+    11e1:	48 8d 35 98 14 00 00 	lea    0x1498(%rip),%rsi        # 2680 <malloc+0x2e4>
+    11e8:	89 c7                	mov    %eax,%edi
+    11ea:	b8 00 00 00 00       	mov    $0x0,%eax
+    11ef:	e8 ba 09 00 00       	call   1bae <printf>
+    11f4:	90                   	nop
+    11f5:	eb fd                	jmp    11f4 <duptest+0x142>
+  buf[10] = 0;
+    11f7:	c6 85 7e ff ff ff 00 	movb   $0x0,-0x82(%rbp)
+
+  if (strcmp(buf, "aaaaaaaaaa") != 0)
+    11fe:	48 8d 85 74 ff ff ff 	lea    -0x8c(%rbp),%rax
+    1205:	48 8d 15 d4 17 00 00 	lea    0x17d4(%rip),%rdx        # 29e0 <malloc+0x644>
+    120c:	48 89 d6             	mov    %rdx,%rsi
+    120f:	48 89 c7             	mov    %rax,%rdi
+    1212:	e8 d8 0c 00 00       	call   1eef <strcmp>
+    1217:	85 c0                	test   %eax,%eax
+    1219:	74 5c                	je     1277 <duptest+0x1c5>
+    error("couldn't read from original fd after dup");
+    121b:	8b 05 6f 20 00 00    	mov    0x206f(%rip),%eax        # 3290 <stdout>
+    1221:	ba e9 00 00 00       	mov    $0xe9,%edx
+    1226:	48 8d 0d b2 12 00 00 	lea    0x12b2(%rip),%rcx        # 24df <malloc+0x143>
+    122d:	48 89 ce             	mov    %rcx,%rsi
+    1230:	89 c7                	mov    %eax,%edi
+    1232:	b8 00 00 00 00       	mov    $0x0,%eax
+    1237:	e8 72 09 00 00       	call   1bae <printf>
+    123c:	8b 05 4e 20 00 00    	mov    0x204e(%rip),%eax        # 3290 <stdout>
+    1242:	48 8d 15 ff 19 00 00 	lea    0x19ff(%rip),%rdx        # 2c48 <malloc+0x8ac>
+    1249:	48 89 d6             	mov    %rdx,%rsi
+    124c:	89 c7                	mov    %eax,%edi
+    124e:	b8 00 00 00 00       	mov    $0x0,%eax
+    1253:	e8 56 09 00 00       	call   1bae <printf>
+    1258:	8b 05 32 20 00 00    	mov    0x2032(%rip),%eax        # 3290 <stdout>
+    125e:	48 8d 15 b9 12 00 00 	lea    0x12b9(%rip),%rdx        # 251e <malloc+0x182>
+    1265:	48 89 d6             	mov    %rdx,%rsi
+    1268:	89 c7                	mov    %eax,%edi
+    126a:	b8 00 00 00 00       	mov    $0x0,%eax
+    126f:	e8 3a 09 00 00       	call   1bae <printf>
+    1274:	90                   	nop
+    1275:	eb fd                	jmp    1274 <duptest+0x1c2>
+
+  if (read(fd2, buf, 10) != 10)
+    1277:	48 8d 8d 74 ff ff ff 	lea    -0x8c(%rbp),%rcx
+    127e:	8b 45 e8             	mov    -0x18(%rbp),%eax
+    1281:	ba 0a 00 00 00       	mov    $0xa,%edx
+    1286:	48 89 ce             	mov    %rcx,%rsi
+    1289:	89 c7                	mov    %eax,%edi
+    128b:	e8 dd 0e 00 00       	call   216d <read>
+    1290:	83 f8 0a             	cmp    $0xa,%eax
+    1293:	74 5c                	je     12f1 <duptest+0x23f>
+    error("coudn't read from the dupped fd");
+    1295:	8b 05 f5 1f 00 00    	mov    0x1ff5(%rip),%eax        # 3290 <stdout>
+    129b:	ba ec 00 00 00       	mov    $0xec,%edx
+    12a0:	48 8d 0d 38 12 00 00 	lea    0x1238(%rip),%rcx        # 24df <malloc+0x143>
+    12a7:	48 89 ce             	mov    %rcx,%rsi
+    12aa:	89 c7                	mov    %eax,%edi
+    12ac:	b8 00 00 00 00       	mov    $0x0,%eax
+    12b1:	e8 f8 08 00 00       	call   1bae <printf>
+    12b6:	8b 05 d4 1f 00 00    	mov    0x1fd4(%rip),%eax        # 3290 <stdout>
+    12bc:	48 8d 15 b5 19 00 00 	lea    0x19b5(%rip),%rdx        # 2c78 <malloc+0x8dc>
+    12c3:	48 89 d6             	mov    %rdx,%rsi
+    12c6:	89 c7                	mov    %eax,%edi
+    12c8:	b8 00 00 00 00       	mov    $0x0,%eax
+    12cd:	e8 dc 08 00 00       	call   1bae <printf>
+    12d2:	8b 05 b8 1f 00 00    	mov    0x1fb8(%rip),%eax        # 3290 <stdout>
+    12d8:	48 8d 15 3f 12 00 00 	lea    0x123f(%rip),%rdx        # 251e <malloc+0x182>
+    12df:	48 89 d6             	mov    %rdx,%rsi
+    12e2:	89 c7                	mov    %eax,%edi
+    12e4:	b8 00 00 00 00       	mov    $0x0,%eax
+    12e9:	e8 c0 08 00 00       	call   1bae <printf>
+    12ee:	90                   	nop
+    12ef:	eb fd                	jmp    12ee <duptest+0x23c>
+  buf[10] = 0;
+    12f1:	c6 85 7e ff ff ff 00 	movb   $0x0,-0x82(%rbp)
+
+  if (strcmp(buf, "aaaaaaaaaa") == 0)
+    12f8:	48 8d 85 74 ff ff ff 	lea    -0x8c(%rbp),%rax
+    12ff:	48 8d 15 da 16 00 00 	lea    0x16da(%rip),%rdx        # 29e0 <malloc+0x644>
+    1306:	48 89 d6             	mov    %rdx,%rsi
+    1309:	48 89 c7             	mov    %rax,%rdi
+    130c:	e8 de 0b 00 00       	call   1eef <strcmp>
+    1311:	85 c0                	test   %eax,%eax
+    1313:	75 5c                	jne    1371 <duptest+0x2bf>
+    error("the duped fd didn't respect the read offset from the other file.");
+    1315:	8b 05 75 1f 00 00    	mov    0x1f75(%rip),%eax        # 3290 <stdout>
+    131b:	ba f0 00 00 00       	mov    $0xf0,%edx
+    1320:	48 8d 0d b8 11 00 00 	lea    0x11b8(%rip),%rcx        # 24df <malloc+0x143>
+    1327:	48 89 ce             	mov    %rcx,%rsi
+    132a:	89 c7                	mov    %eax,%edi
+    132c:	b8 00 00 00 00       	mov    $0x0,%eax
+    1331:	e8 78 08 00 00       	call   1bae <printf>
+    1336:	8b 05 54 1f 00 00    	mov    0x1f54(%rip),%eax        # 3290 <stdout>
+    133c:	48 8d 15 55 19 00 00 	lea    0x1955(%rip),%rdx        # 2c98 <malloc+0x8fc>
+    1343:	48 89 d6             	mov    %rdx,%rsi
+    1346:	89 c7                	mov    %eax,%edi
+    1348:	b8 00 00 00 00       	mov    $0x0,%eax
+    134d:	e8 5c 08 00 00       	call   1bae <printf>
+    1352:	8b 05 38 1f 00 00    	mov    0x1f38(%rip),%eax        # 3290 <stdout>
+    1358:	48 8d 15 bf 11 00 00 	lea    0x11bf(%rip),%rdx        # 251e <malloc+0x182>
+    135f:	48 89 d6             	mov    %rdx,%rsi
+    1362:	89 c7                	mov    %eax,%edi
+    1364:	b8 00 00 00 00       	mov    $0x0,%eax
+    1369:	e8 40 08 00 00       	call   1bae <printf>
+    136e:	90                   	nop
+    136f:	eb fd                	jmp    136e <duptest+0x2bc>
+
+  if (strcmp(buf, "bbbbbbbbbb") != 0)
+    1371:	48 8d 85 74 ff ff ff 	lea    -0x8c(%rbp),%rax
+    1378:	48 8d 15 ea 16 00 00 	lea    0x16ea(%rip),%rdx        # 2a69 <malloc+0x6cd>
+    137f:	48 89 d6             	mov    %rdx,%rsi
+    1382:	48 89 c7             	mov    %rax,%rdi
+    1385:	e8 65 0b 00 00       	call   1eef <strcmp>
+    138a:	85 c0                	test   %eax,%eax
+    138c:	74 5c                	je     13ea <duptest+0x338>
+    error(
+    138e:	8b 05 fc 1e 00 00    	mov    0x1efc(%rip),%eax        # 3290 <stdout>
+    1394:	ba f3 00 00 00       	mov    $0xf3,%edx
+    1399:	48 8d 0d 3f 11 00 00 	lea    0x113f(%rip),%rcx        # 24df <malloc+0x143>
+    13a0:	48 89 ce             	mov    %rcx,%rsi
+    13a3:	89 c7                	mov    %eax,%edi
+    13a5:	b8 00 00 00 00       	mov    $0x0,%eax
+    13aa:	e8 ff 07 00 00       	call   1bae <printf>
+    13af:	8b 05 db 1e 00 00    	mov    0x1edb(%rip),%eax        # 3290 <stdout>
+    13b5:	48 8d 15 24 19 00 00 	lea    0x1924(%rip),%rdx        # 2ce0 <malloc+0x944>
+    13bc:	48 89 d6             	mov    %rdx,%rsi
+    13bf:	89 c7                	mov    %eax,%edi
+    13c1:	b8 00 00 00 00       	mov    $0x0,%eax
+    13c6:	e8 e3 07 00 00       	call   1bae <printf>
+    13cb:	8b 05 bf 1e 00 00    	mov    0x1ebf(%rip),%eax        # 3290 <stdout>
+    13d1:	48 8d 15 46 11 00 00 	lea    0x1146(%rip),%rdx        # 251e <malloc+0x182>
+    13d8:	48 89 d6             	mov    %rdx,%rsi
+    13db:	89 c7                	mov    %eax,%edi
+    13dd:	b8 00 00 00 00       	mov    $0x0,%eax
+    13e2:	e8 c7 07 00 00       	call   1bae <printf>
+    13e7:	90                   	nop
+    13e8:	eb fd                	jmp    13e7 <duptest+0x335>
+        "the duped fd didn't read the correct 10 bytes at the 10 byte offset");
+
+  if (close(fd1) != 0)
+    13ea:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    13ed:	89 c7                	mov    %eax,%edi
+    13ef:	e8 89 0d 00 00       	call   217d <close>
+    13f4:	85 c0                	test   %eax,%eax
+    13f6:	74 5c                	je     1454 <duptest+0x3a2>
+    error("closing the original file");
+    13f8:	8b 05 92 1e 00 00    	mov    0x1e92(%rip),%eax        # 3290 <stdout>
+    13fe:	ba f7 00 00 00       	mov    $0xf7,%edx
+    1403:	48 8d 0d d5 10 00 00 	lea    0x10d5(%rip),%rcx        # 24df <malloc+0x143>
+    140a:	48 89 ce             	mov    %rcx,%rsi
+    140d:	89 c7                	mov    %eax,%edi
+    140f:	b8 00 00 00 00       	mov    $0x0,%eax
+    1414:	e8 95 07 00 00       	call   1bae <printf>
+    1419:	8b 05 71 1e 00 00    	mov    0x1e71(%rip),%eax        # 3290 <stdout>
+    141f:	48 8d 15 fe 18 00 00 	lea    0x18fe(%rip),%rdx        # 2d24 <malloc+0x988>
+    1426:	48 89 d6             	mov    %rdx,%rsi
+    1429:	89 c7                	mov    %eax,%edi
+    142b:	b8 00 00 00 00       	mov    $0x0,%eax
+    1430:	e8 79 07 00 00       	call   1bae <printf>
+    1435:	8b 05 55 1e 00 00    	mov    0x1e55(%rip),%eax        # 3290 <stdout>
+    143b:	48 8d 15 dc 10 00 00 	lea    0x10dc(%rip),%rdx        # 251e <malloc+0x182>
+    1442:	48 89 d6             	mov    %rdx,%rsi
+    1445:	89 c7                	mov    %eax,%edi
+    1447:	b8 00 00 00 00       	mov    $0x0,%eax
+    144c:	e8 5d 07 00 00       	call   1bae <printf>
+    1451:	90                   	nop
+    1452:	eb fd                	jmp    1451 <duptest+0x39f>
+
+  if (read(fd2, buf, 5) != 5)
+    1454:	48 8d 8d 74 ff ff ff 	lea    -0x8c(%rbp),%rcx
+    145b:	8b 45 e8             	mov    -0x18(%rbp),%eax
+    145e:	ba 05 00 00 00       	mov    $0x5,%edx
+    1463:	48 89 ce             	mov    %rcx,%rsi
+    1466:	89 c7                	mov    %eax,%edi
+    1468:	e8 00 0d 00 00       	call   216d <read>
+    146d:	83 f8 05             	cmp    $0x5,%eax
+    1470:	74 5c                	je     14ce <duptest+0x41c>
+    error("wasn't able to read from the duped file after the original file was "
+    1472:	8b 05 18 1e 00 00    	mov    0x1e18(%rip),%eax        # 3290 <stdout>
+    1478:	ba fa 00 00 00       	mov    $0xfa,%edx
+    147d:	48 8d 0d 5b 10 00 00 	lea    0x105b(%rip),%rcx        # 24df <malloc+0x143>
+    1484:	48 89 ce             	mov    %rcx,%rsi
+    1487:	89 c7                	mov    %eax,%edi
+    1489:	b8 00 00 00 00       	mov    $0x0,%eax
+    148e:	e8 1b 07 00 00       	call   1bae <printf>
+    1493:	8b 05 f7 1d 00 00    	mov    0x1df7(%rip),%eax        # 3290 <stdout>
+    1499:	48 8d 15 a0 18 00 00 	lea    0x18a0(%rip),%rdx        # 2d40 <malloc+0x9a4>
+    14a0:	48 89 d6             	mov    %rdx,%rsi
+    14a3:	89 c7                	mov    %eax,%edi
+    14a5:	b8 00 00 00 00       	mov    $0x0,%eax
+    14aa:	e8 ff 06 00 00       	call   1bae <printf>
+    14af:	8b 05 db 1d 00 00    	mov    0x1ddb(%rip),%eax        # 3290 <stdout>
+    14b5:	48 8d 15 62 10 00 00 	lea    0x1062(%rip),%rdx        # 251e <malloc+0x182>
+    14bc:	48 89 d6             	mov    %rdx,%rsi
+    14bf:	89 c7                	mov    %eax,%edi
+    14c1:	b8 00 00 00 00       	mov    $0x0,%eax
+    14c6:	e8 e3 06 00 00       	call   1bae <printf>
+    14cb:	90                   	nop
+    14cc:	eb fd                	jmp    14cb <duptest+0x419>
+          "closed");
+
+  buf[5] = 0;
+    14ce:	c6 85 79 ff ff ff 00 	movb   $0x0,-0x87(%rbp)
+  assert(strcmp(buf, "ccccc") == 0);
+    14d5:	48 8d 85 74 ff ff ff 	lea    -0x8c(%rbp),%rax
+    14dc:	48 8d 15 a8 18 00 00 	lea    0x18a8(%rip),%rdx        # 2d8b <malloc+0x9ef>
+    14e3:	48 89 d6             	mov    %rdx,%rsi
+    14e6:	48 89 c7             	mov    %rax,%rdi
+    14e9:	e8 01 0a 00 00       	call   1eef <strcmp>
+    14ee:	85 c0                	test   %eax,%eax
+    14f0:	74 2b                	je     151d <duptest+0x46b>
+    14f2:	8b 05 98 1d 00 00    	mov    0x1d98(%rip),%eax        # 3290 <stdout>
+    14f8:	48 8d 15 92 18 00 00 	lea    0x1892(%rip),%rdx        # 2d91 <malloc+0x9f5>
+    14ff:	48 89 d1             	mov    %rdx,%rcx
+    1502:	ba fe 00 00 00       	mov    $0xfe,%edx
+    1507:	48 8d 35 72 11 00 00 	lea    0x1172(%rip),%rsi        # 2680 <malloc+0x2e4>
+    150e:	89 c7                	mov    %eax,%edi
+    1510:	b8 00 00 00 00       	mov    $0x0,%eax
+    1515:	e8 94 06 00 00       	call   1bae <printf>
+    151a:	90                   	nop
+    151b:	eb fd                	jmp    151a <duptest+0x468>
+
+  printf(stdout, "dup read offsets ok\n");
+    151d:	8b 05 6d 1d 00 00    	mov    0x1d6d(%rip),%eax        # 3290 <stdout>
+    1523:	48 8d 15 81 18 00 00 	lea    0x1881(%rip),%rdx        # 2dab <malloc+0xa0f>
+    152a:	48 89 d6             	mov    %rdx,%rsi
+    152d:	89 c7                	mov    %eax,%edi
+    152f:	b8 00 00 00 00       	mov    $0x0,%eax
+    1534:	e8 75 06 00 00       	call   1bae <printf>
+
+  if (close(fd2) != 0)
+    1539:	8b 45 e8             	mov    -0x18(%rbp),%eax
+    153c:	89 c7                	mov    %eax,%edi
+    153e:	e8 3a 0c 00 00       	call   217d <close>
+    1543:	85 c0                	test   %eax,%eax
+    1545:	74 5c                	je     15a3 <duptest+0x4f1>
+    error("closing the duped file");
+    1547:	8b 05 43 1d 00 00    	mov    0x1d43(%rip),%eax        # 3290 <stdout>
+    154d:	ba 03 01 00 00       	mov    $0x103,%edx
+    1552:	48 8d 0d 86 0f 00 00 	lea    0xf86(%rip),%rcx        # 24df <malloc+0x143>
+    1559:	48 89 ce             	mov    %rcx,%rsi
+    155c:	89 c7                	mov    %eax,%edi
+    155e:	b8 00 00 00 00       	mov    $0x0,%eax
+    1563:	e8 46 06 00 00       	call   1bae <printf>
+    1568:	8b 05 22 1d 00 00    	mov    0x1d22(%rip),%eax        # 3290 <stdout>
+    156e:	48 8d 15 4b 18 00 00 	lea    0x184b(%rip),%rdx        # 2dc0 <malloc+0xa24>
+    1575:	48 89 d6             	mov    %rdx,%rsi
+    1578:	89 c7                	mov    %eax,%edi
+    157a:	b8 00 00 00 00       	mov    $0x0,%eax
+    157f:	e8 2a 06 00 00       	call   1bae <printf>
+    1584:	8b 05 06 1d 00 00    	mov    0x1d06(%rip),%eax        # 3290 <stdout>
+    158a:	48 8d 15 8d 0f 00 00 	lea    0xf8d(%rip),%rdx        # 251e <malloc+0x182>
+    1591:	48 89 d6             	mov    %rdx,%rsi
+    1594:	89 c7                	mov    %eax,%edi
+    1596:	b8 00 00 00 00       	mov    $0x0,%eax
+    159b:	e8 0e 06 00 00       	call   1bae <printf>
+    15a0:	90                   	nop
+    15a1:	eb fd                	jmp    15a0 <duptest+0x4ee>
+
+  // test duping of stdout
+  // should be fd1, because that is the first file I opened (and closed) earlier
+  if ((stdout_cpy = dup(stdout)) != fd1)
+    15a3:	8b 05 e7 1c 00 00    	mov    0x1ce7(%rip),%eax        # 3290 <stdout>
+    15a9:	89 c7                	mov    %eax,%edi
+    15ab:	e8 1d 0c 00 00       	call   21cd <dup>
+    15b0:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+    15b3:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+    15b6:	3b 45 ec             	cmp    -0x14(%rbp),%eax
+    15b9:	74 5f                	je     161a <duptest+0x568>
+    error("returned fd from dup that was not the smallest free fd, was '%d'",
+    15bb:	8b 05 cf 1c 00 00    	mov    0x1ccf(%rip),%eax        # 3290 <stdout>
+    15c1:	ba 08 01 00 00       	mov    $0x108,%edx
+    15c6:	48 8d 0d 12 0f 00 00 	lea    0xf12(%rip),%rcx        # 24df <malloc+0x143>
+    15cd:	48 89 ce             	mov    %rcx,%rsi
+    15d0:	89 c7                	mov    %eax,%edi
+    15d2:	b8 00 00 00 00       	mov    $0x0,%eax
+    15d7:	e8 d2 05 00 00       	call   1bae <printf>
+    15dc:	8b 05 ae 1c 00 00    	mov    0x1cae(%rip),%eax        # 3290 <stdout>
+    15e2:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+    15e5:	48 8d 0d ec 17 00 00 	lea    0x17ec(%rip),%rcx        # 2dd8 <malloc+0xa3c>
+    15ec:	48 89 ce             	mov    %rcx,%rsi
+    15ef:	89 c7                	mov    %eax,%edi
+    15f1:	b8 00 00 00 00       	mov    $0x0,%eax
+    15f6:	e8 b3 05 00 00       	call   1bae <printf>
+    15fb:	8b 05 8f 1c 00 00    	mov    0x1c8f(%rip),%eax        # 3290 <stdout>
+    1601:	48 8d 15 16 0f 00 00 	lea    0xf16(%rip),%rdx        # 251e <malloc+0x182>
+    1608:	48 89 d6             	mov    %rdx,%rsi
+    160b:	89 c7                	mov    %eax,%edi
+    160d:	b8 00 00 00 00       	mov    $0x0,%eax
+    1612:	e8 97 05 00 00       	call   1bae <printf>
+    1617:	90                   	nop
+    1618:	eb fd                	jmp    1617 <duptest+0x565>
+          stdout_cpy);
+
+  char *consolestr = "print to console directly from write\n";
+    161a:	48 8d 05 ff 17 00 00 	lea    0x17ff(%rip),%rax        # 2e20 <malloc+0xa84>
+    1621:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  strcpy(buf, consolestr);
+    1625:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+    1629:	48 8d 85 74 ff ff ff 	lea    -0x8c(%rbp),%rax
+    1630:	48 89 d6             	mov    %rdx,%rsi
+    1633:	48 89 c7             	mov    %rax,%rdi
+    1636:	e8 75 08 00 00       	call   1eb0 <strcpy>
+
+  if (write(stdout_cpy, consolestr, strlen(consolestr)) != strlen(consolestr))
+    163b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    163f:	48 89 c7             	mov    %rax,%rdi
+    1642:	e8 f7 08 00 00       	call   1f3e <strlen>
+    1647:	89 c2                	mov    %eax,%edx
+    1649:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+    164d:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+    1650:	48 89 ce             	mov    %rcx,%rsi
+    1653:	89 c7                	mov    %eax,%edi
+    1655:	e8 1b 0b 00 00       	call   2175 <write>
+    165a:	89 c3                	mov    %eax,%ebx
+    165c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    1660:	48 89 c7             	mov    %rax,%rdi
+    1663:	e8 d6 08 00 00       	call   1f3e <strlen>
+    1668:	39 c3                	cmp    %eax,%ebx
+    166a:	74 5c                	je     16c8 <duptest+0x616>
+    error("couldn't write to console from duped fd");
+    166c:	8b 05 1e 1c 00 00    	mov    0x1c1e(%rip),%eax        # 3290 <stdout>
+    1672:	ba 0f 01 00 00       	mov    $0x10f,%edx
+    1677:	48 8d 0d 61 0e 00 00 	lea    0xe61(%rip),%rcx        # 24df <malloc+0x143>
+    167e:	48 89 ce             	mov    %rcx,%rsi
+    1681:	89 c7                	mov    %eax,%edi
+    1683:	b8 00 00 00 00       	mov    $0x0,%eax
+    1688:	e8 21 05 00 00       	call   1bae <printf>
+    168d:	8b 05 fd 1b 00 00    	mov    0x1bfd(%rip),%eax        # 3290 <stdout>
+    1693:	48 8d 15 ae 17 00 00 	lea    0x17ae(%rip),%rdx        # 2e48 <malloc+0xaac>
+    169a:	48 89 d6             	mov    %rdx,%rsi
+    169d:	89 c7                	mov    %eax,%edi
+    169f:	b8 00 00 00 00       	mov    $0x0,%eax
+    16a4:	e8 05 05 00 00       	call   1bae <printf>
+    16a9:	8b 05 e1 1b 00 00    	mov    0x1be1(%rip),%eax        # 3290 <stdout>
+    16af:	48 8d 15 68 0e 00 00 	lea    0xe68(%rip),%rdx        # 251e <malloc+0x182>
+    16b6:	48 89 d6             	mov    %rdx,%rsi
+    16b9:	89 c7                	mov    %eax,%edi
+    16bb:	b8 00 00 00 00       	mov    $0x0,%eax
+    16c0:	e8 e9 04 00 00       	call   1bae <printf>
+    16c5:	90                   	nop
+    16c6:	eb fd                	jmp    16c5 <duptest+0x613>
+
+  assert(close(stdout_cpy) == 0);
+    16c8:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+    16cb:	89 c7                	mov    %eax,%edi
+    16cd:	e8 ab 0a 00 00       	call   217d <close>
+    16d2:	85 c0                	test   %eax,%eax
+    16d4:	74 2b                	je     1701 <duptest+0x64f>
+    16d6:	8b 05 b4 1b 00 00    	mov    0x1bb4(%rip),%eax        # 3290 <stdout>
+    16dc:	48 8d 15 8d 17 00 00 	lea    0x178d(%rip),%rdx        # 2e70 <malloc+0xad4>
+    16e3:	48 89 d1             	mov    %rdx,%rcx
+    16e6:	ba 11 01 00 00       	mov    $0x111,%edx
+    16eb:	48 8d 35 8e 0f 00 00 	lea    0xf8e(%rip),%rsi        # 2680 <malloc+0x2e4>
+    16f2:	89 c7                	mov    %eax,%edi
+    16f4:	b8 00 00 00 00       	mov    $0x0,%eax
+    16f9:	e8 b0 04 00 00       	call   1bae <printf>
+    16fe:	90                   	nop
+    16ff:	eb fd                	jmp    16fe <duptest+0x64c>
+
+  printf(stdout, "dup test ok\n");
+    1701:	8b 05 89 1b 00 00    	mov    0x1b89(%rip),%eax        # 3290 <stdout>
+    1707:	48 8d 15 79 17 00 00 	lea    0x1779(%rip),%rdx        # 2e87 <malloc+0xaeb>
+    170e:	48 89 d6             	mov    %rdx,%rsi
+    1711:	89 c7                	mov    %eax,%edi
+    1713:	b8 00 00 00 00       	mov    $0x0,%eax
+    1718:	e8 91 04 00 00       	call   1bae <printf>
+}
+    171d:	90                   	nop
+    171e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    1722:	c9                   	leave
+    1723:	c3                   	ret
+
+0000000000001724 <nofilestest>:
+
+void nofilestest() {
+    1724:	55                   	push   %rbp
+    1725:	48 89 e5             	mov    %rsp,%rbp
+    1728:	48 83 ec 10          	sub    $0x10,%rsp
+  int fd, tmpfd;
+
+  printf(stdout, "nofiles test\n");
+    172c:	8b 05 5e 1b 00 00    	mov    0x1b5e(%rip),%eax        # 3290 <stdout>
+    1732:	48 8d 15 5b 17 00 00 	lea    0x175b(%rip),%rdx        # 2e94 <malloc+0xaf8>
+    1739:	48 89 d6             	mov    %rdx,%rsi
+    173c:	89 c7                	mov    %eax,%edi
+    173e:	b8 00 00 00 00       	mov    $0x0,%eax
+    1743:	e8 66 04 00 00       	call   1bae <printf>
+  fd = open("/small.txt", O_RDONLY);
+    1748:	be 00 00 00 00       	mov    $0x0,%esi
+    174d:	48 8d 05 cc 0d 00 00 	lea    0xdcc(%rip),%rax        # 2520 <malloc+0x184>
+    1754:	48 89 c7             	mov    %rax,%rdi
+    1757:	e8 39 0a 00 00       	call   2195 <open>
+    175c:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  assert(fd != -1);
+    175f:	83 7d f8 ff          	cmpl   $0xffffffff,-0x8(%rbp)
+    1763:	75 2b                	jne    1790 <nofilestest+0x6c>
+    1765:	8b 05 25 1b 00 00    	mov    0x1b25(%rip),%eax        # 3290 <stdout>
+    176b:	48 8d 15 05 0f 00 00 	lea    0xf05(%rip),%rdx        # 2677 <malloc+0x2db>
+    1772:	48 89 d1             	mov    %rdx,%rcx
+    1775:	ba 1b 01 00 00       	mov    $0x11b,%edx
+    177a:	48 8d 35 ff 0e 00 00 	lea    0xeff(%rip),%rsi        # 2680 <malloc+0x2e4>
+    1781:	89 c7                	mov    %eax,%edi
+    1783:	b8 00 00 00 00       	mov    $0x0,%eax
+    1788:	e8 21 04 00 00       	call   1bae <printf>
+    178d:	90                   	nop
+    178e:	eb fd                	jmp    178d <nofilestest+0x69>
+
+  for (tmpfd = fd + 1; tmpfd < NOFILE; tmpfd++) {
+    1790:	8b 45 f8             	mov    -0x8(%rbp),%eax
+    1793:	83 c0 01             	add    $0x1,%eax
+    1796:	89 45 fc             	mov    %eax,-0x4(%rbp)
+    1799:	e9 82 00 00 00       	jmp    1820 <nofilestest+0xfc>
+    int newfd = open("/small.txt", O_RDONLY);
+    179e:	be 00 00 00 00       	mov    $0x0,%esi
+    17a3:	48 8d 05 76 0d 00 00 	lea    0xd76(%rip),%rax        # 2520 <malloc+0x184>
+    17aa:	48 89 c7             	mov    %rax,%rdi
+    17ad:	e8 e3 09 00 00       	call   2195 <open>
+    17b2:	89 45 f0             	mov    %eax,-0x10(%rbp)
+    if (newfd != tmpfd)
+    17b5:	8b 45 f0             	mov    -0x10(%rbp),%eax
+    17b8:	3b 45 fc             	cmp    -0x4(%rbp),%eax
+    17bb:	74 5f                	je     181c <nofilestest+0xf8>
+      error("returned fd from open was not the smallest free fd, was '%d'",
+    17bd:	8b 05 cd 1a 00 00    	mov    0x1acd(%rip),%eax        # 3290 <stdout>
+    17c3:	ba 20 01 00 00       	mov    $0x120,%edx
+    17c8:	48 8d 0d 10 0d 00 00 	lea    0xd10(%rip),%rcx        # 24df <malloc+0x143>
+    17cf:	48 89 ce             	mov    %rcx,%rsi
+    17d2:	89 c7                	mov    %eax,%edi
+    17d4:	b8 00 00 00 00       	mov    $0x0,%eax
+    17d9:	e8 d0 03 00 00       	call   1bae <printf>
+    17de:	8b 05 ac 1a 00 00    	mov    0x1aac(%rip),%eax        # 3290 <stdout>
+    17e4:	8b 55 f0             	mov    -0x10(%rbp),%edx
+    17e7:	48 8d 0d ba 16 00 00 	lea    0x16ba(%rip),%rcx        # 2ea8 <malloc+0xb0c>
+    17ee:	48 89 ce             	mov    %rcx,%rsi
+    17f1:	89 c7                	mov    %eax,%edi
+    17f3:	b8 00 00 00 00       	mov    $0x0,%eax
+    17f8:	e8 b1 03 00 00       	call   1bae <printf>
+    17fd:	8b 05 8d 1a 00 00    	mov    0x1a8d(%rip),%eax        # 3290 <stdout>
+    1803:	48 8d 15 14 0d 00 00 	lea    0xd14(%rip),%rdx        # 251e <malloc+0x182>
+    180a:	48 89 d6             	mov    %rdx,%rsi
+    180d:	89 c7                	mov    %eax,%edi
+    180f:	b8 00 00 00 00       	mov    $0x0,%eax
+    1814:	e8 95 03 00 00       	call   1bae <printf>
+    1819:	90                   	nop
+    181a:	eb fd                	jmp    1819 <nofilestest+0xf5>
+  for (tmpfd = fd + 1; tmpfd < NOFILE; tmpfd++) {
+    181c:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+    1820:	83 7d fc 0f          	cmpl   $0xf,-0x4(%rbp)
+    1824:	0f 8e 74 ff ff ff    	jle    179e <nofilestest+0x7a>
+            newfd);
+  }
+
+  // Opening should fail as we have reached the NOFILE limit
+  if (open("/small.txt", O_RDONLY) != -1)
+    182a:	be 00 00 00 00       	mov    $0x0,%esi
+    182f:	48 8d 05 ea 0c 00 00 	lea    0xcea(%rip),%rax        # 2520 <malloc+0x184>
+    1836:	48 89 c7             	mov    %rax,%rdi
+    1839:	e8 57 09 00 00       	call   2195 <open>
+    183e:	83 f8 ff             	cmp    $0xffffffff,%eax
+    1841:	74 5c                	je     189f <nofilestest+0x17b>
+    error("opened more files than allowed");
+    1843:	8b 05 47 1a 00 00    	mov    0x1a47(%rip),%eax        # 3290 <stdout>
+    1849:	ba 26 01 00 00       	mov    $0x126,%edx
+    184e:	48 8d 0d 8a 0c 00 00 	lea    0xc8a(%rip),%rcx        # 24df <malloc+0x143>
+    1855:	48 89 ce             	mov    %rcx,%rsi
+    1858:	89 c7                	mov    %eax,%edi
+    185a:	b8 00 00 00 00       	mov    $0x0,%eax
+    185f:	e8 4a 03 00 00       	call   1bae <printf>
+    1864:	8b 05 26 1a 00 00    	mov    0x1a26(%rip),%eax        # 3290 <stdout>
+    186a:	48 8d 15 77 16 00 00 	lea    0x1677(%rip),%rdx        # 2ee8 <malloc+0xb4c>
+    1871:	48 89 d6             	mov    %rdx,%rsi
+    1874:	89 c7                	mov    %eax,%edi
+    1876:	b8 00 00 00 00       	mov    $0x0,%eax
+    187b:	e8 2e 03 00 00       	call   1bae <printf>
+    1880:	8b 05 0a 1a 00 00    	mov    0x1a0a(%rip),%eax        # 3290 <stdout>
+    1886:	48 8d 15 91 0c 00 00 	lea    0xc91(%rip),%rdx        # 251e <malloc+0x182>
+    188d:	48 89 d6             	mov    %rdx,%rsi
+    1890:	89 c7                	mov    %eax,%edi
+    1892:	b8 00 00 00 00       	mov    $0x0,%eax
+    1897:	e8 12 03 00 00       	call   1bae <printf>
+    189c:	90                   	nop
+    189d:	eb fd                	jmp    189c <nofilestest+0x178>
+
+  assert(close(NOFILE - 1) == 0);
+    189f:	bf 0f 00 00 00       	mov    $0xf,%edi
+    18a4:	e8 d4 08 00 00       	call   217d <close>
+    18a9:	85 c0                	test   %eax,%eax
+    18ab:	74 2b                	je     18d8 <nofilestest+0x1b4>
+    18ad:	8b 05 dd 19 00 00    	mov    0x19dd(%rip),%eax        # 3290 <stdout>
+    18b3:	48 8d 15 4d 16 00 00 	lea    0x164d(%rip),%rdx        # 2f07 <malloc+0xb6b>
+    18ba:	48 89 d1             	mov    %rdx,%rcx
+    18bd:	ba 28 01 00 00       	mov    $0x128,%edx
+    18c2:	48 8d 35 b7 0d 00 00 	lea    0xdb7(%rip),%rsi        # 2680 <malloc+0x2e4>
+    18c9:	89 c7                	mov    %eax,%edi
+    18cb:	b8 00 00 00 00       	mov    $0x0,%eax
+    18d0:	e8 d9 02 00 00       	call   1bae <printf>
+    18d5:	90                   	nop
+    18d6:	eb fd                	jmp    18d5 <nofilestest+0x1b1>
+
+  // Opening should work once there is a fd available
+  int fd2 = open("/small.txt", O_RDONLY);
+    18d8:	be 00 00 00 00       	mov    $0x0,%esi
+    18dd:	48 8d 05 3c 0c 00 00 	lea    0xc3c(%rip),%rax        # 2520 <malloc+0x184>
+    18e4:	48 89 c7             	mov    %rax,%rdi
+    18e7:	e8 a9 08 00 00       	call   2195 <open>
+    18ec:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  if (fd2 == -1) error("unable to open file after an fd is available");
+    18ef:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%rbp)
+    18f3:	75 5c                	jne    1951 <nofilestest+0x22d>
+    18f5:	8b 05 95 19 00 00    	mov    0x1995(%rip),%eax        # 3290 <stdout>
+    18fb:	ba 2c 01 00 00       	mov    $0x12c,%edx
+    1900:	48 8d 0d d8 0b 00 00 	lea    0xbd8(%rip),%rcx        # 24df <malloc+0x143>
+    1907:	48 89 ce             	mov    %rcx,%rsi
+    190a:	89 c7                	mov    %eax,%edi
+    190c:	b8 00 00 00 00       	mov    $0x0,%eax
+    1911:	e8 98 02 00 00       	call   1bae <printf>
+    1916:	8b 05 74 19 00 00    	mov    0x1974(%rip),%eax        # 3290 <stdout>
+    191c:	48 8d 15 fd 15 00 00 	lea    0x15fd(%rip),%rdx        # 2f20 <malloc+0xb84>
+    1923:	48 89 d6             	mov    %rdx,%rsi
+    1926:	89 c7                	mov    %eax,%edi
+    1928:	b8 00 00 00 00       	mov    $0x0,%eax
+    192d:	e8 7c 02 00 00       	call   1bae <printf>
+    1932:	8b 05 58 19 00 00    	mov    0x1958(%rip),%eax        # 3290 <stdout>
+    1938:	48 8d 15 df 0b 00 00 	lea    0xbdf(%rip),%rdx        # 251e <malloc+0x182>
+    193f:	48 89 d6             	mov    %rdx,%rsi
+    1942:	89 c7                	mov    %eax,%edi
+    1944:	b8 00 00 00 00       	mov    $0x0,%eax
+    1949:	e8 60 02 00 00       	call   1bae <printf>
+    194e:	90                   	nop
+    194f:	eb fd                	jmp    194e <nofilestest+0x22a>
+
+  assert(fd2 == NOFILE - 1);
+    1951:	83 7d f4 0f          	cmpl   $0xf,-0xc(%rbp)
+    1955:	74 2b                	je     1982 <nofilestest+0x25e>
+    1957:	8b 05 33 19 00 00    	mov    0x1933(%rip),%eax        # 3290 <stdout>
+    195d:	48 8d 15 e9 15 00 00 	lea    0x15e9(%rip),%rdx        # 2f4d <malloc+0xbb1>
+    1964:	48 89 d1             	mov    %rdx,%rcx
+    1967:	ba 2e 01 00 00       	mov    $0x12e,%edx
+    196c:	48 8d 35 0d 0d 00 00 	lea    0xd0d(%rip),%rsi        # 2680 <malloc+0x2e4>
+    1973:	89 c7                	mov    %eax,%edi
+    1975:	b8 00 00 00 00       	mov    $0x0,%eax
+    197a:	e8 2f 02 00 00       	call   1bae <printf>
+    197f:	90                   	nop
+    1980:	eb fd                	jmp    197f <nofilestest+0x25b>
+
+  for (tmpfd = fd; tmpfd < NOFILE; tmpfd++) {
+    1982:	8b 45 f8             	mov    -0x8(%rbp),%eax
+    1985:	89 45 fc             	mov    %eax,-0x4(%rbp)
+    1988:	eb 3d                	jmp    19c7 <nofilestest+0x2a3>
+    assert(close(tmpfd) == 0);
+    198a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    198d:	89 c7                	mov    %eax,%edi
+    198f:	e8 e9 07 00 00       	call   217d <close>
+    1994:	85 c0                	test   %eax,%eax
+    1996:	74 2b                	je     19c3 <nofilestest+0x29f>
+    1998:	8b 05 f2 18 00 00    	mov    0x18f2(%rip),%eax        # 3290 <stdout>
+    199e:	48 8d 15 ba 15 00 00 	lea    0x15ba(%rip),%rdx        # 2f5f <malloc+0xbc3>
+    19a5:	48 89 d1             	mov    %rdx,%rcx
+    19a8:	ba 31 01 00 00       	mov    $0x131,%edx
+    19ad:	48 8d 35 cc 0c 00 00 	lea    0xccc(%rip),%rsi        # 2680 <malloc+0x2e4>
+    19b4:	89 c7                	mov    %eax,%edi
+    19b6:	b8 00 00 00 00       	mov    $0x0,%eax
+    19bb:	e8 ee 01 00 00       	call   1bae <printf>
+    19c0:	90                   	nop
+    19c1:	eb fd                	jmp    19c0 <nofilestest+0x29c>
+  for (tmpfd = fd; tmpfd < NOFILE; tmpfd++) {
+    19c3:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+    19c7:	83 7d fc 0f          	cmpl   $0xf,-0x4(%rbp)
+    19cb:	7e bd                	jle    198a <nofilestest+0x266>
+  }
+
+  printf(stdout, "nofiles test ok\n");
+    19cd:	8b 05 bd 18 00 00    	mov    0x18bd(%rip),%eax        # 3290 <stdout>
+    19d3:	48 8d 15 97 15 00 00 	lea    0x1597(%rip),%rdx        # 2f71 <malloc+0xbd5>
+    19da:	48 89 d6             	mov    %rdx,%rsi
+    19dd:	89 c7                	mov    %eax,%edi
+    19df:	b8 00 00 00 00       	mov    $0x0,%eax
+    19e4:	e8 c5 01 00 00       	call   1bae <printf>
+}
+    19e9:	90                   	nop
+    19ea:	c9                   	leave
+    19eb:	c3                   	ret
+
+00000000000019ec <putc>:
+#include <cdefs.h>
+#include <stat.h>
+#include <stdarg.h>
+#include <user.h>
+
+static void putc(int fd, char c) { write(fd, &c, 1); }
+    19ec:	55                   	push   %rbp
+    19ed:	48 89 e5             	mov    %rsp,%rbp
+    19f0:	48 83 ec 10          	sub    $0x10,%rsp
+    19f4:	89 7d fc             	mov    %edi,-0x4(%rbp)
+    19f7:	89 f0                	mov    %esi,%eax
+    19f9:	88 45 f8             	mov    %al,-0x8(%rbp)
+    19fc:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+    1a00:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1a03:	ba 01 00 00 00       	mov    $0x1,%edx
+    1a08:	48 89 ce             	mov    %rcx,%rsi
+    1a0b:	89 c7                	mov    %eax,%edi
+    1a0d:	e8 63 07 00 00       	call   2175 <write>
+    1a12:	90                   	nop
+    1a13:	c9                   	leave
+    1a14:	c3                   	ret
+
+0000000000001a15 <printint64>:
+
+static void printint64(int fd, int xx, int base, int sgn) {
+    1a15:	55                   	push   %rbp
+    1a16:	48 89 e5             	mov    %rsp,%rbp
+    1a19:	48 83 ec 40          	sub    $0x40,%rsp
+    1a1d:	89 7d cc             	mov    %edi,-0x34(%rbp)
+    1a20:	89 75 c8             	mov    %esi,-0x38(%rbp)
+    1a23:	89 55 c4             	mov    %edx,-0x3c(%rbp)
+    1a26:	89 4d c0             	mov    %ecx,-0x40(%rbp)
+  static char digits[] = "0123456789abcdef";
+  char buf[32];
+  int i;
+  uint64_t x;
+
+  if (sgn && (sgn = xx < 0))
+    1a29:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+    1a2d:	74 1f                	je     1a4e <printint64+0x39>
+    1a2f:	8b 45 c8             	mov    -0x38(%rbp),%eax
+    1a32:	c1 e8 1f             	shr    $0x1f,%eax
+    1a35:	0f b6 c0             	movzbl %al,%eax
+    1a38:	89 45 c0             	mov    %eax,-0x40(%rbp)
+    1a3b:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+    1a3f:	74 0d                	je     1a4e <printint64+0x39>
+    x = -xx;
+    1a41:	8b 45 c8             	mov    -0x38(%rbp),%eax
+    1a44:	f7 d8                	neg    %eax
+    1a46:	48 98                	cltq
+    1a48:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    1a4c:	eb 09                	jmp    1a57 <printint64+0x42>
+  else
+    x = xx;
+    1a4e:	8b 45 c8             	mov    -0x38(%rbp),%eax
+    1a51:	48 98                	cltq
+    1a53:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+  i = 0;
+    1a57:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  do {
+    buf[i++] = digits[x % base];
+    1a5e:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+    1a61:	48 63 c8             	movslq %eax,%rcx
+    1a64:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1a68:	ba 00 00 00 00       	mov    $0x0,%edx
+    1a6d:	48 f7 f1             	div    %rcx
+    1a70:	48 89 d1             	mov    %rdx,%rcx
+    1a73:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1a76:	8d 50 01             	lea    0x1(%rax),%edx
+    1a79:	89 55 fc             	mov    %edx,-0x4(%rbp)
+    1a7c:	48 8d 15 1d 18 00 00 	lea    0x181d(%rip),%rdx        # 32a0 <digits.1>
+    1a83:	0f b6 14 11          	movzbl (%rcx,%rdx,1),%edx
+    1a87:	48 98                	cltq
+    1a89:	88 54 05 d0          	mov    %dl,-0x30(%rbp,%rax,1)
+  } while ((x /= base) != 0);
+    1a8d:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+    1a90:	48 63 f0             	movslq %eax,%rsi
+    1a93:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1a97:	ba 00 00 00 00       	mov    $0x0,%edx
+    1a9c:	48 f7 f6             	div    %rsi
+    1a9f:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    1aa3:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+    1aa8:	75 b4                	jne    1a5e <printint64+0x49>
+
+  if (sgn)
+    1aaa:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+    1aae:	74 2b                	je     1adb <printint64+0xc6>
+    buf[i++] = '-';
+    1ab0:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1ab3:	8d 50 01             	lea    0x1(%rax),%edx
+    1ab6:	89 55 fc             	mov    %edx,-0x4(%rbp)
+    1ab9:	48 98                	cltq
+    1abb:	c6 44 05 d0 2d       	movb   $0x2d,-0x30(%rbp,%rax,1)
+
+  while (--i >= 0)
+    1ac0:	eb 19                	jmp    1adb <printint64+0xc6>
+    putc(fd, buf[i]);
+    1ac2:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1ac5:	48 98                	cltq
+    1ac7:	0f b6 44 05 d0       	movzbl -0x30(%rbp,%rax,1),%eax
+    1acc:	0f be d0             	movsbl %al,%edx
+    1acf:	8b 45 cc             	mov    -0x34(%rbp),%eax
+    1ad2:	89 d6                	mov    %edx,%esi
+    1ad4:	89 c7                	mov    %eax,%edi
+    1ad6:	e8 11 ff ff ff       	call   19ec <putc>
+  while (--i >= 0)
+    1adb:	83 6d fc 01          	subl   $0x1,-0x4(%rbp)
+    1adf:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+    1ae3:	79 dd                	jns    1ac2 <printint64+0xad>
+}
+    1ae5:	90                   	nop
+    1ae6:	90                   	nop
+    1ae7:	c9                   	leave
+    1ae8:	c3                   	ret
+
+0000000000001ae9 <printint>:
+
+static void printint(int fd, int xx, int base, int sgn) {
+    1ae9:	55                   	push   %rbp
+    1aea:	48 89 e5             	mov    %rsp,%rbp
+    1aed:	48 83 ec 30          	sub    $0x30,%rsp
+    1af1:	89 7d dc             	mov    %edi,-0x24(%rbp)
+    1af4:	89 75 d8             	mov    %esi,-0x28(%rbp)
+    1af7:	89 55 d4             	mov    %edx,-0x2c(%rbp)
+    1afa:	89 4d d0             	mov    %ecx,-0x30(%rbp)
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+    1afd:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+  if (sgn && xx < 0) {
+    1b04:	83 7d d0 00          	cmpl   $0x0,-0x30(%rbp)
+    1b08:	74 17                	je     1b21 <printint+0x38>
+    1b0a:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+    1b0e:	79 11                	jns    1b21 <printint+0x38>
+    neg = 1;
+    1b10:	c7 45 f8 01 00 00 00 	movl   $0x1,-0x8(%rbp)
+    x = -xx;
+    1b17:	8b 45 d8             	mov    -0x28(%rbp),%eax
+    1b1a:	f7 d8                	neg    %eax
+    1b1c:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    1b1f:	eb 06                	jmp    1b27 <printint+0x3e>
+  } else {
+    x = xx;
+    1b21:	8b 45 d8             	mov    -0x28(%rbp),%eax
+    1b24:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  }
+
+  i = 0;
+    1b27:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  do {
+    buf[i++] = digits[x % base];
+    1b2e:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+    1b31:	8b 45 f4             	mov    -0xc(%rbp),%eax
+    1b34:	ba 00 00 00 00       	mov    $0x0,%edx
+    1b39:	f7 f1                	div    %ecx
+    1b3b:	89 d1                	mov    %edx,%ecx
+    1b3d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1b40:	8d 50 01             	lea    0x1(%rax),%edx
+    1b43:	89 55 fc             	mov    %edx,-0x4(%rbp)
+    1b46:	89 c9                	mov    %ecx,%ecx
+    1b48:	48 8d 15 71 17 00 00 	lea    0x1771(%rip),%rdx        # 32c0 <digits.0>
+    1b4f:	0f b6 14 11          	movzbl (%rcx,%rdx,1),%edx
+    1b53:	48 98                	cltq
+    1b55:	88 54 05 e4          	mov    %dl,-0x1c(%rbp,%rax,1)
+  } while ((x /= base) != 0);
+    1b59:	8b 75 d4             	mov    -0x2c(%rbp),%esi
+    1b5c:	8b 45 f4             	mov    -0xc(%rbp),%eax
+    1b5f:	ba 00 00 00 00       	mov    $0x0,%edx
+    1b64:	f7 f6                	div    %esi
+    1b66:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    1b69:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+    1b6d:	75 bf                	jne    1b2e <printint+0x45>
+  if (neg)
+    1b6f:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+    1b73:	74 2b                	je     1ba0 <printint+0xb7>
+    buf[i++] = '-';
+    1b75:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1b78:	8d 50 01             	lea    0x1(%rax),%edx
+    1b7b:	89 55 fc             	mov    %edx,-0x4(%rbp)
+    1b7e:	48 98                	cltq
+    1b80:	c6 44 05 e4 2d       	movb   $0x2d,-0x1c(%rbp,%rax,1)
+
+  while (--i >= 0)
+    1b85:	eb 19                	jmp    1ba0 <printint+0xb7>
+    putc(fd, buf[i]);
+    1b87:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1b8a:	48 98                	cltq
+    1b8c:	0f b6 44 05 e4       	movzbl -0x1c(%rbp,%rax,1),%eax
+    1b91:	0f be d0             	movsbl %al,%edx
+    1b94:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1b97:	89 d6                	mov    %edx,%esi
+    1b99:	89 c7                	mov    %eax,%edi
+    1b9b:	e8 4c fe ff ff       	call   19ec <putc>
+  while (--i >= 0)
+    1ba0:	83 6d fc 01          	subl   $0x1,-0x4(%rbp)
+    1ba4:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+    1ba8:	79 dd                	jns    1b87 <printint+0x9e>
+}
+    1baa:	90                   	nop
+    1bab:	90                   	nop
+    1bac:	c9                   	leave
+    1bad:	c3                   	ret
+
+0000000000001bae <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void printf(int fd, char *fmt, ...) {
+    1bae:	55                   	push   %rbp
+    1baf:	48 89 e5             	mov    %rsp,%rbp
+    1bb2:	48 83 ec 70          	sub    $0x70,%rsp
+    1bb6:	89 7d 9c             	mov    %edi,-0x64(%rbp)
+    1bb9:	48 89 75 90          	mov    %rsi,-0x70(%rbp)
+    1bbd:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+    1bc1:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+    1bc5:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+    1bc9:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+  char *s;
+  int c, i, state;
+  int lflag;
+  va_list valist;
+  va_start(valist, fmt);
+    1bcd:	c7 45 a0 10 00 00 00 	movl   $0x10,-0x60(%rbp)
+    1bd4:	48 8d 45 10          	lea    0x10(%rbp),%rax
+    1bd8:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+    1bdc:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+    1be0:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+
+  state = 0;
+    1be4:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%rbp)
+  for (i = 0; fmt[i]; i++) {
+    1beb:	c7 45 c4 00 00 00 00 	movl   $0x0,-0x3c(%rbp)
+    1bf2:	e9 6b 02 00 00       	jmp    1e62 <printf+0x2b4>
+    c = fmt[i] & 0xff;
+    1bf7:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+    1bfa:	48 63 d0             	movslq %eax,%rdx
+    1bfd:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+    1c01:	48 01 d0             	add    %rdx,%rax
+    1c04:	0f b6 00             	movzbl (%rax),%eax
+    1c07:	0f be c0             	movsbl %al,%eax
+    1c0a:	25 ff 00 00 00       	and    $0xff,%eax
+    1c0f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+    if (state == 0) {
+    1c12:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+    1c16:	75 30                	jne    1c48 <printf+0x9a>
+      if (c == '%') {
+    1c18:	83 7d b8 25          	cmpl   $0x25,-0x48(%rbp)
+    1c1c:	75 13                	jne    1c31 <printf+0x83>
+        state = '%';
+    1c1e:	c7 45 c0 25 00 00 00 	movl   $0x25,-0x40(%rbp)
+        lflag = 0;
+    1c25:	c7 45 bc 00 00 00 00 	movl   $0x0,-0x44(%rbp)
+    1c2c:	e9 2d 02 00 00       	jmp    1e5e <printf+0x2b0>
+      } else {
+        putc(fd, c);
+    1c31:	8b 45 b8             	mov    -0x48(%rbp),%eax
+    1c34:	0f be d0             	movsbl %al,%edx
+    1c37:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    1c3a:	89 d6                	mov    %edx,%esi
+    1c3c:	89 c7                	mov    %eax,%edi
+    1c3e:	e8 a9 fd ff ff       	call   19ec <putc>
+    1c43:	e9 16 02 00 00       	jmp    1e5e <printf+0x2b0>
+      }
+    } else if (state == '%') {
+    1c48:	83 7d c0 25          	cmpl   $0x25,-0x40(%rbp)
+    1c4c:	0f 85 0c 02 00 00    	jne    1e5e <printf+0x2b0>
+      if (c == 'l') {
+    1c52:	83 7d b8 6c          	cmpl   $0x6c,-0x48(%rbp)
+    1c56:	75 0c                	jne    1c64 <printf+0xb6>
+        lflag = 1;
+    1c58:	c7 45 bc 01 00 00 00 	movl   $0x1,-0x44(%rbp)
+        continue;
+    1c5f:	e9 fa 01 00 00       	jmp    1e5e <printf+0x2b0>
+      } else if (c == 'd') {
+    1c64:	83 7d b8 64          	cmpl   $0x64,-0x48(%rbp)
+    1c68:	0f 85 95 00 00 00    	jne    1d03 <printf+0x155>
+        if (lflag == 1)
+    1c6e:	83 7d bc 01          	cmpl   $0x1,-0x44(%rbp)
+    1c72:	75 49                	jne    1cbd <printf+0x10f>
+          printint64(fd, va_arg(valist, int64_t), 10, 1);
+    1c74:	8b 45 a0             	mov    -0x60(%rbp),%eax
+    1c77:	83 f8 2f             	cmp    $0x2f,%eax
+    1c7a:	77 17                	ja     1c93 <printf+0xe5>
+    1c7c:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    1c80:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    1c83:	89 d2                	mov    %edx,%edx
+    1c85:	48 01 d0             	add    %rdx,%rax
+    1c88:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    1c8b:	83 c2 08             	add    $0x8,%edx
+    1c8e:	89 55 a0             	mov    %edx,-0x60(%rbp)
+    1c91:	eb 0c                	jmp    1c9f <printf+0xf1>
+    1c93:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+    1c97:	48 8d 50 08          	lea    0x8(%rax),%rdx
+    1c9b:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    1c9f:	48 8b 00             	mov    (%rax),%rax
+    1ca2:	89 c6                	mov    %eax,%esi
+    1ca4:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    1ca7:	b9 01 00 00 00       	mov    $0x1,%ecx
+    1cac:	ba 0a 00 00 00       	mov    $0xa,%edx
+    1cb1:	89 c7                	mov    %eax,%edi
+    1cb3:	e8 5d fd ff ff       	call   1a15 <printint64>
+    1cb8:	e9 9a 01 00 00       	jmp    1e57 <printf+0x2a9>
+        else
+          printint(fd, va_arg(valist, int), 10, 1);
+    1cbd:	8b 45 a0             	mov    -0x60(%rbp),%eax
+    1cc0:	83 f8 2f             	cmp    $0x2f,%eax
+    1cc3:	77 17                	ja     1cdc <printf+0x12e>
+    1cc5:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    1cc9:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    1ccc:	89 d2                	mov    %edx,%edx
+    1cce:	48 01 d0             	add    %rdx,%rax
+    1cd1:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    1cd4:	83 c2 08             	add    $0x8,%edx
+    1cd7:	89 55 a0             	mov    %edx,-0x60(%rbp)
+    1cda:	eb 0c                	jmp    1ce8 <printf+0x13a>
+    1cdc:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+    1ce0:	48 8d 50 08          	lea    0x8(%rax),%rdx
+    1ce4:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    1ce8:	8b 30                	mov    (%rax),%esi
+    1cea:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    1ced:	b9 01 00 00 00       	mov    $0x1,%ecx
+    1cf2:	ba 0a 00 00 00       	mov    $0xa,%edx
+    1cf7:	89 c7                	mov    %eax,%edi
+    1cf9:	e8 eb fd ff ff       	call   1ae9 <printint>
+    1cfe:	e9 54 01 00 00       	jmp    1e57 <printf+0x2a9>
+      } else if (c == 'x' || c == 'p') {
+    1d03:	83 7d b8 78          	cmpl   $0x78,-0x48(%rbp)
+    1d07:	74 0a                	je     1d13 <printf+0x165>
+    1d09:	83 7d b8 70          	cmpl   $0x70,-0x48(%rbp)
+    1d0d:	0f 85 95 00 00 00    	jne    1da8 <printf+0x1fa>
+        if (lflag == 1)
+    1d13:	83 7d bc 01          	cmpl   $0x1,-0x44(%rbp)
+    1d17:	75 49                	jne    1d62 <printf+0x1b4>
+          printint64(fd, va_arg(valist, int64_t), 16, 0);
+    1d19:	8b 45 a0             	mov    -0x60(%rbp),%eax
+    1d1c:	83 f8 2f             	cmp    $0x2f,%eax
+    1d1f:	77 17                	ja     1d38 <printf+0x18a>
+    1d21:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    1d25:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    1d28:	89 d2                	mov    %edx,%edx
+    1d2a:	48 01 d0             	add    %rdx,%rax
+    1d2d:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    1d30:	83 c2 08             	add    $0x8,%edx
+    1d33:	89 55 a0             	mov    %edx,-0x60(%rbp)
+    1d36:	eb 0c                	jmp    1d44 <printf+0x196>
+    1d38:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+    1d3c:	48 8d 50 08          	lea    0x8(%rax),%rdx
+    1d40:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    1d44:	48 8b 00             	mov    (%rax),%rax
+    1d47:	89 c6                	mov    %eax,%esi
+    1d49:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    1d4c:	b9 00 00 00 00       	mov    $0x0,%ecx
+    1d51:	ba 10 00 00 00       	mov    $0x10,%edx
+    1d56:	89 c7                	mov    %eax,%edi
+    1d58:	e8 b8 fc ff ff       	call   1a15 <printint64>
+        if (lflag == 1)
+    1d5d:	e9 f5 00 00 00       	jmp    1e57 <printf+0x2a9>
+        else
+          printint(fd, va_arg(valist, int), 16, 0);
+    1d62:	8b 45 a0             	mov    -0x60(%rbp),%eax
+    1d65:	83 f8 2f             	cmp    $0x2f,%eax
+    1d68:	77 17                	ja     1d81 <printf+0x1d3>
+    1d6a:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    1d6e:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    1d71:	89 d2                	mov    %edx,%edx
+    1d73:	48 01 d0             	add    %rdx,%rax
+    1d76:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    1d79:	83 c2 08             	add    $0x8,%edx
+    1d7c:	89 55 a0             	mov    %edx,-0x60(%rbp)
+    1d7f:	eb 0c                	jmp    1d8d <printf+0x1df>
+    1d81:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+    1d85:	48 8d 50 08          	lea    0x8(%rax),%rdx
+    1d89:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    1d8d:	8b 30                	mov    (%rax),%esi
+    1d8f:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    1d92:	b9 00 00 00 00       	mov    $0x0,%ecx
+    1d97:	ba 10 00 00 00       	mov    $0x10,%edx
+    1d9c:	89 c7                	mov    %eax,%edi
+    1d9e:	e8 46 fd ff ff       	call   1ae9 <printint>
+        if (lflag == 1)
+    1da3:	e9 af 00 00 00       	jmp    1e57 <printf+0x2a9>
+      } else if (c == 's') {
+    1da8:	83 7d b8 73          	cmpl   $0x73,-0x48(%rbp)
+    1dac:	75 6e                	jne    1e1c <printf+0x26e>
+        if ((s = (char *)va_arg(valist, char *)) == 0)
+    1dae:	8b 45 a0             	mov    -0x60(%rbp),%eax
+    1db1:	83 f8 2f             	cmp    $0x2f,%eax
+    1db4:	77 17                	ja     1dcd <printf+0x21f>
+    1db6:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    1dba:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    1dbd:	89 d2                	mov    %edx,%edx
+    1dbf:	48 01 d0             	add    %rdx,%rax
+    1dc2:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    1dc5:	83 c2 08             	add    $0x8,%edx
+    1dc8:	89 55 a0             	mov    %edx,-0x60(%rbp)
+    1dcb:	eb 0c                	jmp    1dd9 <printf+0x22b>
+    1dcd:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+    1dd1:	48 8d 50 08          	lea    0x8(%rax),%rdx
+    1dd5:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    1dd9:	48 8b 00             	mov    (%rax),%rax
+    1ddc:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    1de0:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+    1de5:	75 28                	jne    1e0f <printf+0x261>
+          s = "(null)";
+    1de7:	48 8d 05 94 11 00 00 	lea    0x1194(%rip),%rax        # 2f82 <malloc+0xbe6>
+    1dee:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        for (; *s; s++)
+    1df2:	eb 1b                	jmp    1e0f <printf+0x261>
+          putc(fd, *s);
+    1df4:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    1df8:	0f b6 00             	movzbl (%rax),%eax
+    1dfb:	0f be d0             	movsbl %al,%edx
+    1dfe:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    1e01:	89 d6                	mov    %edx,%esi
+    1e03:	89 c7                	mov    %eax,%edi
+    1e05:	e8 e2 fb ff ff       	call   19ec <putc>
+        for (; *s; s++)
+    1e0a:	48 83 45 c8 01       	addq   $0x1,-0x38(%rbp)
+    1e0f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    1e13:	0f b6 00             	movzbl (%rax),%eax
+    1e16:	84 c0                	test   %al,%al
+    1e18:	75 da                	jne    1df4 <printf+0x246>
+    1e1a:	eb 3b                	jmp    1e57 <printf+0x2a9>
+      } else if (c == '%') {
+    1e1c:	83 7d b8 25          	cmpl   $0x25,-0x48(%rbp)
+    1e20:	75 14                	jne    1e36 <printf+0x288>
+        putc(fd, c);
+    1e22:	8b 45 b8             	mov    -0x48(%rbp),%eax
+    1e25:	0f be d0             	movsbl %al,%edx
+    1e28:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    1e2b:	89 d6                	mov    %edx,%esi
+    1e2d:	89 c7                	mov    %eax,%edi
+    1e2f:	e8 b8 fb ff ff       	call   19ec <putc>
+    1e34:	eb 21                	jmp    1e57 <printf+0x2a9>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+    1e36:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    1e39:	be 25 00 00 00       	mov    $0x25,%esi
+    1e3e:	89 c7                	mov    %eax,%edi
+    1e40:	e8 a7 fb ff ff       	call   19ec <putc>
+        putc(fd, c);
+    1e45:	8b 45 b8             	mov    -0x48(%rbp),%eax
+    1e48:	0f be d0             	movsbl %al,%edx
+    1e4b:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    1e4e:	89 d6                	mov    %edx,%esi
+    1e50:	89 c7                	mov    %eax,%edi
+    1e52:	e8 95 fb ff ff       	call   19ec <putc>
+      }
+      state = 0;
+    1e57:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%rbp)
+  for (i = 0; fmt[i]; i++) {
+    1e5e:	83 45 c4 01          	addl   $0x1,-0x3c(%rbp)
+    1e62:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+    1e65:	48 63 d0             	movslq %eax,%rdx
+    1e68:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+    1e6c:	48 01 d0             	add    %rdx,%rax
+    1e6f:	0f b6 00             	movzbl (%rax),%eax
+    1e72:	84 c0                	test   %al,%al
+    1e74:	0f 85 7d fd ff ff    	jne    1bf7 <printf+0x49>
+    }
+  }
+
+  va_end(valist);
+}
+    1e7a:	90                   	nop
+    1e7b:	90                   	nop
+    1e7c:	c9                   	leave
+    1e7d:	c3                   	ret
+
+0000000000001e7e <stosb>:
+      break;
+    buf[i++] = c;
+    if (c == '\n' || c == '\r')
+      break;
+  }
+  buf[i] = '\0';
+    1e7e:	55                   	push   %rbp
+    1e7f:	48 89 e5             	mov    %rsp,%rbp
+    1e82:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1e86:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    1e89:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  return buf;
+    1e8c:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+    1e90:	8b 55 f0             	mov    -0x10(%rbp),%edx
+    1e93:	8b 45 f4             	mov    -0xc(%rbp),%eax
+    1e96:	48 89 ce             	mov    %rcx,%rsi
+    1e99:	48 89 f7             	mov    %rsi,%rdi
+    1e9c:	89 d1                	mov    %edx,%ecx
+    1e9e:	fc                   	cld
+    1e9f:	f3 aa                	rep stos %al,%es:(%rdi)
+    1ea1:	89 ca                	mov    %ecx,%edx
+    1ea3:	48 89 fe             	mov    %rdi,%rsi
+    1ea6:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+    1eaa:	89 55 f0             	mov    %edx,-0x10(%rbp)
+}
+
+int stat(char *n, struct stat *st) {
+  int fd;
+    1ead:	90                   	nop
+    1eae:	5d                   	pop    %rbp
+    1eaf:	c3                   	ret
+
+0000000000001eb0 <strcpy>:
+char *strcpy(char *s, char *t) {
+    1eb0:	55                   	push   %rbp
+    1eb1:	48 89 e5             	mov    %rsp,%rbp
+    1eb4:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    1eb8:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  os = s;
+    1ebc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1ec0:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while ((*s++ = *t++) != 0)
+    1ec4:	90                   	nop
+    1ec5:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    1ec9:	48 8d 42 01          	lea    0x1(%rdx),%rax
+    1ecd:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    1ed1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1ed5:	48 8d 48 01          	lea    0x1(%rax),%rcx
+    1ed9:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+    1edd:	0f b6 12             	movzbl (%rdx),%edx
+    1ee0:	88 10                	mov    %dl,(%rax)
+    1ee2:	0f b6 00             	movzbl (%rax),%eax
+    1ee5:	84 c0                	test   %al,%al
+    1ee7:	75 dc                	jne    1ec5 <strcpy+0x15>
+  return os;
+    1ee9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    1eed:	5d                   	pop    %rbp
+    1eee:	c3                   	ret
+
+0000000000001eef <strcmp>:
+int strcmp(const char *p, const char *q) {
+    1eef:	55                   	push   %rbp
+    1ef0:	48 89 e5             	mov    %rsp,%rbp
+    1ef3:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1ef7:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  while (*p && *p == *q)
+    1efb:	eb 0a                	jmp    1f07 <strcmp+0x18>
+    p++, q++;
+    1efd:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    1f02:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (*p && *p == *q)
+    1f07:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1f0b:	0f b6 00             	movzbl (%rax),%eax
+    1f0e:	84 c0                	test   %al,%al
+    1f10:	74 12                	je     1f24 <strcmp+0x35>
+    1f12:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1f16:	0f b6 10             	movzbl (%rax),%edx
+    1f19:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1f1d:	0f b6 00             	movzbl (%rax),%eax
+    1f20:	38 c2                	cmp    %al,%dl
+    1f22:	74 d9                	je     1efd <strcmp+0xe>
+  return (uchar)*p - (uchar)*q;
+    1f24:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1f28:	0f b6 00             	movzbl (%rax),%eax
+    1f2b:	0f b6 d0             	movzbl %al,%edx
+    1f2e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1f32:	0f b6 00             	movzbl (%rax),%eax
+    1f35:	0f b6 c0             	movzbl %al,%eax
+    1f38:	29 c2                	sub    %eax,%edx
+    1f3a:	89 d0                	mov    %edx,%eax
+}
+    1f3c:	5d                   	pop    %rbp
+    1f3d:	c3                   	ret
+
+0000000000001f3e <strlen>:
+uint strlen(char *s) {
+    1f3e:	55                   	push   %rbp
+    1f3f:	48 89 e5             	mov    %rsp,%rbp
+    1f42:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  for (n = 0; s[n]; n++)
+    1f46:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+    1f4d:	eb 04                	jmp    1f53 <strlen+0x15>
+    1f4f:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+    1f53:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1f56:	48 63 d0             	movslq %eax,%rdx
+    1f59:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1f5d:	48 01 d0             	add    %rdx,%rax
+    1f60:	0f b6 00             	movzbl (%rax),%eax
+    1f63:	84 c0                	test   %al,%al
+    1f65:	75 e8                	jne    1f4f <strlen+0x11>
+  return n;
+    1f67:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+    1f6a:	5d                   	pop    %rbp
+    1f6b:	c3                   	ret
+
+0000000000001f6c <memset>:
+void *memset(void *dst, int c, uint n) {
+    1f6c:	55                   	push   %rbp
+    1f6d:	48 89 e5             	mov    %rsp,%rbp
+    1f70:	48 83 ec 10          	sub    $0x10,%rsp
+    1f74:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1f78:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    1f7b:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  stosb(dst, c, n);
+    1f7e:	8b 55 f0             	mov    -0x10(%rbp),%edx
+    1f81:	8b 4d f4             	mov    -0xc(%rbp),%ecx
+    1f84:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1f88:	89 ce                	mov    %ecx,%esi
+    1f8a:	48 89 c7             	mov    %rax,%rdi
+    1f8d:	e8 ec fe ff ff       	call   1e7e <stosb>
+  return dst;
+    1f92:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    1f96:	c9                   	leave
+    1f97:	c3                   	ret
+
+0000000000001f98 <strchr>:
+char *strchr(const char *s, char c) {
+    1f98:	55                   	push   %rbp
+    1f99:	48 89 e5             	mov    %rsp,%rbp
+    1f9c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1fa0:	89 f0                	mov    %esi,%eax
+    1fa2:	88 45 f4             	mov    %al,-0xc(%rbp)
+  for (; *s; s++)
+    1fa5:	eb 17                	jmp    1fbe <strchr+0x26>
+    if (*s == c)
+    1fa7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1fab:	0f b6 00             	movzbl (%rax),%eax
+    1fae:	38 45 f4             	cmp    %al,-0xc(%rbp)
+    1fb1:	75 06                	jne    1fb9 <strchr+0x21>
+      return (char *)s;
+    1fb3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1fb7:	eb 15                	jmp    1fce <strchr+0x36>
+  for (; *s; s++)
+    1fb9:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    1fbe:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1fc2:	0f b6 00             	movzbl (%rax),%eax
+    1fc5:	84 c0                	test   %al,%al
+    1fc7:	75 de                	jne    1fa7 <strchr+0xf>
+  return 0;
+    1fc9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    1fce:	5d                   	pop    %rbp
+    1fcf:	c3                   	ret
+
+0000000000001fd0 <gets>:
+char *gets(char *buf, int max) {
+    1fd0:	55                   	push   %rbp
+    1fd1:	48 89 e5             	mov    %rsp,%rbp
+    1fd4:	48 83 ec 20          	sub    $0x20,%rsp
+    1fd8:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    1fdc:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  for (i = 0; i + 1 < max;) {
+    1fdf:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+    1fe6:	eb 48                	jmp    2030 <gets+0x60>
+    cc = read(0, &c, 1);
+    1fe8:	48 8d 45 f7          	lea    -0x9(%rbp),%rax
+    1fec:	ba 01 00 00 00       	mov    $0x1,%edx
+    1ff1:	48 89 c6             	mov    %rax,%rsi
+    1ff4:	bf 00 00 00 00       	mov    $0x0,%edi
+    1ff9:	e8 6f 01 00 00       	call   216d <read>
+    1ffe:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    if (cc < 1)
+    2001:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+    2005:	7e 36                	jle    203d <gets+0x6d>
+    buf[i++] = c;
+    2007:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    200a:	8d 50 01             	lea    0x1(%rax),%edx
+    200d:	89 55 fc             	mov    %edx,-0x4(%rbp)
+    2010:	48 63 d0             	movslq %eax,%rdx
+    2013:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2017:	48 01 c2             	add    %rax,%rdx
+    201a:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+    201e:	88 02                	mov    %al,(%rdx)
+    if (c == '\n' || c == '\r')
+    2020:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+    2024:	3c 0a                	cmp    $0xa,%al
+    2026:	74 16                	je     203e <gets+0x6e>
+    2028:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+    202c:	3c 0d                	cmp    $0xd,%al
+    202e:	74 0e                	je     203e <gets+0x6e>
+  for (i = 0; i + 1 < max;) {
+    2030:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    2033:	83 c0 01             	add    $0x1,%eax
+    2036:	39 45 e4             	cmp    %eax,-0x1c(%rbp)
+    2039:	7f ad                	jg     1fe8 <gets+0x18>
+    203b:	eb 01                	jmp    203e <gets+0x6e>
+      break;
+    203d:	90                   	nop
+  buf[i] = '\0';
+    203e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    2041:	48 63 d0             	movslq %eax,%rdx
+    2044:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2048:	48 01 d0             	add    %rdx,%rax
+    204b:	c6 00 00             	movb   $0x0,(%rax)
+  return buf;
+    204e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+    2052:	c9                   	leave
+    2053:	c3                   	ret
+
+0000000000002054 <stat>:
+int stat(char *n, struct stat *st) {
+    2054:	55                   	push   %rbp
+    2055:	48 89 e5             	mov    %rsp,%rbp
+    2058:	48 83 ec 20          	sub    $0x20,%rsp
+    205c:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    2060:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int r;
+
+  fd = open(n, O_RDONLY);
+    2064:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2068:	be 00 00 00 00       	mov    $0x0,%esi
+    206d:	48 89 c7             	mov    %rax,%rdi
+    2070:	e8 20 01 00 00       	call   2195 <open>
+    2075:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  if (fd < 0)
+    2078:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+    207c:	79 07                	jns    2085 <stat+0x31>
+    return -1;
+    207e:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    2083:	eb 21                	jmp    20a6 <stat+0x52>
+  r = fstat(fd, st);
+    2085:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    2089:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    208c:	48 89 d6             	mov    %rdx,%rsi
+    208f:	89 c7                	mov    %eax,%edi
+    2091:	e8 17 01 00 00       	call   21ad <fstat>
+    2096:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  close(fd);
+    2099:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    209c:	89 c7                	mov    %eax,%edi
+    209e:	e8 da 00 00 00       	call   217d <close>
+  return r;
+    20a3:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+    20a6:	c9                   	leave
+    20a7:	c3                   	ret
+
+00000000000020a8 <atoi>:
+
+int atoi(const char *s) {
+    20a8:	55                   	push   %rbp
+    20a9:	48 89 e5             	mov    %rsp,%rbp
+    20ac:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int n;
+
+  n = 0;
+    20b0:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  while ('0' <= *s && *s <= '9')
+    20b7:	eb 28                	jmp    20e1 <atoi+0x39>
+    n = n * 10 + *s++ - '0';
+    20b9:	8b 55 fc             	mov    -0x4(%rbp),%edx
+    20bc:	89 d0                	mov    %edx,%eax
+    20be:	c1 e0 02             	shl    $0x2,%eax
+    20c1:	01 d0                	add    %edx,%eax
+    20c3:	01 c0                	add    %eax,%eax
+    20c5:	89 c1                	mov    %eax,%ecx
+    20c7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    20cb:	48 8d 50 01          	lea    0x1(%rax),%rdx
+    20cf:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    20d3:	0f b6 00             	movzbl (%rax),%eax
+    20d6:	0f be c0             	movsbl %al,%eax
+    20d9:	01 c8                	add    %ecx,%eax
+    20db:	83 e8 30             	sub    $0x30,%eax
+    20de:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while ('0' <= *s && *s <= '9')
+    20e1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    20e5:	0f b6 00             	movzbl (%rax),%eax
+    20e8:	3c 2f                	cmp    $0x2f,%al
+    20ea:	7e 0b                	jle    20f7 <atoi+0x4f>
+    20ec:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    20f0:	0f b6 00             	movzbl (%rax),%eax
+    20f3:	3c 39                	cmp    $0x39,%al
+    20f5:	7e c2                	jle    20b9 <atoi+0x11>
+  return n;
+    20f7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+    20fa:	5d                   	pop    %rbp
+    20fb:	c3                   	ret
+
+00000000000020fc <memmove>:
+
+void *memmove(void *vdst, void *vsrc, int n) {
+    20fc:	55                   	push   %rbp
+    20fd:	48 89 e5             	mov    %rsp,%rbp
+    2100:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    2104:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    2108:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  char *dst, *src;
+
+  dst = vdst;
+    210b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    210f:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  src = vsrc;
+    2113:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2117:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  while (n-- > 0)
+    211b:	eb 1d                	jmp    213a <memmove+0x3e>
+    *dst++ = *src++;
+    211d:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    2121:	48 8d 42 01          	lea    0x1(%rdx),%rax
+    2125:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    2129:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    212d:	48 8d 48 01          	lea    0x1(%rax),%rcx
+    2131:	48 89 4d f8          	mov    %rcx,-0x8(%rbp)
+    2135:	0f b6 12             	movzbl (%rdx),%edx
+    2138:	88 10                	mov    %dl,(%rax)
+  while (n-- > 0)
+    213a:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    213d:	8d 50 ff             	lea    -0x1(%rax),%edx
+    2140:	89 55 dc             	mov    %edx,-0x24(%rbp)
+    2143:	85 c0                	test   %eax,%eax
+    2145:	7f d6                	jg     211d <memmove+0x21>
+  return vdst;
+    2147:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    214b:	5d                   	pop    %rbp
+    214c:	c3                   	ret
+
+000000000000214d <fork>:
+  name:                                                                        \
+  movl $SYS_##name, % eax;                                                     \
+  int $TRAP_SYSCALL;                                                           \
+  ret
+
+SYSCALL(fork)
+    214d:	b8 01 00 00 00       	mov    $0x1,%eax
+    2152:	cd 40                	int    $0x40
+    2154:	c3                   	ret
+
+0000000000002155 <exit>:
+SYSCALL(exit)
+    2155:	b8 02 00 00 00       	mov    $0x2,%eax
+    215a:	cd 40                	int    $0x40
+    215c:	c3                   	ret
+
+000000000000215d <wait>:
+SYSCALL(wait)
+    215d:	b8 03 00 00 00       	mov    $0x3,%eax
+    2162:	cd 40                	int    $0x40
+    2164:	c3                   	ret
+
+0000000000002165 <pipe>:
+SYSCALL(pipe)
+    2165:	b8 04 00 00 00       	mov    $0x4,%eax
+    216a:	cd 40                	int    $0x40
+    216c:	c3                   	ret
+
+000000000000216d <read>:
+SYSCALL(read)
+    216d:	b8 05 00 00 00       	mov    $0x5,%eax
+    2172:	cd 40                	int    $0x40
+    2174:	c3                   	ret
+
+0000000000002175 <write>:
+SYSCALL(write)
+    2175:	b8 10 00 00 00       	mov    $0x10,%eax
+    217a:	cd 40                	int    $0x40
+    217c:	c3                   	ret
+
+000000000000217d <close>:
+SYSCALL(close)
+    217d:	b8 15 00 00 00       	mov    $0x15,%eax
+    2182:	cd 40                	int    $0x40
+    2184:	c3                   	ret
+
+0000000000002185 <kill>:
+SYSCALL(kill)
+    2185:	b8 06 00 00 00       	mov    $0x6,%eax
+    218a:	cd 40                	int    $0x40
+    218c:	c3                   	ret
+
+000000000000218d <exec>:
+SYSCALL(exec)
+    218d:	b8 07 00 00 00       	mov    $0x7,%eax
+    2192:	cd 40                	int    $0x40
+    2194:	c3                   	ret
+
+0000000000002195 <open>:
+SYSCALL(open)
+    2195:	b8 0f 00 00 00       	mov    $0xf,%eax
+    219a:	cd 40                	int    $0x40
+    219c:	c3                   	ret
+
+000000000000219d <mknod>:
+SYSCALL(mknod)
+    219d:	b8 11 00 00 00       	mov    $0x11,%eax
+    21a2:	cd 40                	int    $0x40
+    21a4:	c3                   	ret
+
+00000000000021a5 <unlink>:
+SYSCALL(unlink)
+    21a5:	b8 12 00 00 00       	mov    $0x12,%eax
+    21aa:	cd 40                	int    $0x40
+    21ac:	c3                   	ret
+
+00000000000021ad <fstat>:
+SYSCALL(fstat)
+    21ad:	b8 08 00 00 00       	mov    $0x8,%eax
+    21b2:	cd 40                	int    $0x40
+    21b4:	c3                   	ret
+
+00000000000021b5 <link>:
+SYSCALL(link)
+    21b5:	b8 13 00 00 00       	mov    $0x13,%eax
+    21ba:	cd 40                	int    $0x40
+    21bc:	c3                   	ret
+
+00000000000021bd <mkdir>:
+SYSCALL(mkdir)
+    21bd:	b8 14 00 00 00       	mov    $0x14,%eax
+    21c2:	cd 40                	int    $0x40
+    21c4:	c3                   	ret
+
+00000000000021c5 <chdir>:
+SYSCALL(chdir)
+    21c5:	b8 09 00 00 00       	mov    $0x9,%eax
+    21ca:	cd 40                	int    $0x40
+    21cc:	c3                   	ret
+
+00000000000021cd <dup>:
+SYSCALL(dup)
+    21cd:	b8 0a 00 00 00       	mov    $0xa,%eax
+    21d2:	cd 40                	int    $0x40
+    21d4:	c3                   	ret
+
+00000000000021d5 <getpid>:
+SYSCALL(getpid)
+    21d5:	b8 0b 00 00 00       	mov    $0xb,%eax
+    21da:	cd 40                	int    $0x40
+    21dc:	c3                   	ret
+
+00000000000021dd <sbrk>:
+SYSCALL(sbrk)
+    21dd:	b8 0c 00 00 00       	mov    $0xc,%eax
+    21e2:	cd 40                	int    $0x40
+    21e4:	c3                   	ret
+
+00000000000021e5 <sleep>:
+SYSCALL(sleep)
+    21e5:	b8 0d 00 00 00       	mov    $0xd,%eax
+    21ea:	cd 40                	int    $0x40
+    21ec:	c3                   	ret
+
+00000000000021ed <uptime>:
+SYSCALL(uptime)
+    21ed:	b8 0e 00 00 00       	mov    $0xe,%eax
+    21f2:	cd 40                	int    $0x40
+    21f4:	c3                   	ret
+
+00000000000021f5 <sysinfo>:
+SYSCALL(sysinfo)
+    21f5:	b8 16 00 00 00       	mov    $0x16,%eax
+    21fa:	cd 40                	int    $0x40
+    21fc:	c3                   	ret
+
+00000000000021fd <crashn>:
+SYSCALL(crashn)
+    21fd:	b8 17 00 00 00       	mov    $0x17,%eax
+    2202:	cd 40                	int    $0x40
+    2204:	c3                   	ret
+
+0000000000002205 <sync>:
+SYSCALL(sync)
+    2205:	b8 18 00 00 00       	mov    $0x18,%eax
+    220a:	cd 40                	int    $0x40
+    220c:	c3                   	ret
+
+000000000000220d <fsync>:
+SYSCALL(fsync)
+    220d:	b8 19 00 00 00       	mov    $0x19,%eax
+    2212:	cd 40                	int    $0x40
+    2214:	c3                   	ret
+
+0000000000002215 <free>:
+typedef union header Header;
+
+static Header base;
+static Header *freep;
+
+void free(void *ap) {
+    2215:	55                   	push   %rbp
+    2216:	48 89 e5             	mov    %rsp,%rbp
+    2219:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  Header *bp, *p;
+
+  bp = (Header *)ap - 1;
+    221d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2221:	48 83 e8 10          	sub    $0x10,%rax
+    2225:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  for (p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    2229:	48 8b 05 c0 10 00 00 	mov    0x10c0(%rip),%rax        # 32f0 <freep>
+    2230:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    2234:	eb 2f                	jmp    2265 <free+0x50>
+    if (p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    2236:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    223a:	48 8b 00             	mov    (%rax),%rax
+    223d:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+    2241:	72 17                	jb     225a <free+0x45>
+    2243:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2247:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+    224b:	72 2f                	jb     227c <free+0x67>
+    224d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2251:	48 8b 00             	mov    (%rax),%rax
+    2254:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+    2258:	72 22                	jb     227c <free+0x67>
+  for (p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    225a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    225e:	48 8b 00             	mov    (%rax),%rax
+    2261:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    2265:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2269:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+    226d:	73 c7                	jae    2236 <free+0x21>
+    226f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2273:	48 8b 00             	mov    (%rax),%rax
+    2276:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+    227a:	73 ba                	jae    2236 <free+0x21>
+      break;
+  if (bp + bp->s.size == p->s.ptr) {
+    227c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2280:	8b 40 08             	mov    0x8(%rax),%eax
+    2283:	89 c0                	mov    %eax,%eax
+    2285:	48 c1 e0 04          	shl    $0x4,%rax
+    2289:	48 89 c2             	mov    %rax,%rdx
+    228c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2290:	48 01 c2             	add    %rax,%rdx
+    2293:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2297:	48 8b 00             	mov    (%rax),%rax
+    229a:	48 39 c2             	cmp    %rax,%rdx
+    229d:	75 2d                	jne    22cc <free+0xb7>
+    bp->s.size += p->s.ptr->s.size;
+    229f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    22a3:	8b 50 08             	mov    0x8(%rax),%edx
+    22a6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    22aa:	48 8b 00             	mov    (%rax),%rax
+    22ad:	8b 40 08             	mov    0x8(%rax),%eax
+    22b0:	01 c2                	add    %eax,%edx
+    22b2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    22b6:	89 50 08             	mov    %edx,0x8(%rax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+    22b9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    22bd:	48 8b 00             	mov    (%rax),%rax
+    22c0:	48 8b 10             	mov    (%rax),%rdx
+    22c3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    22c7:	48 89 10             	mov    %rdx,(%rax)
+    22ca:	eb 0e                	jmp    22da <free+0xc5>
+  } else
+    bp->s.ptr = p->s.ptr;
+    22cc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    22d0:	48 8b 10             	mov    (%rax),%rdx
+    22d3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    22d7:	48 89 10             	mov    %rdx,(%rax)
+  if (p + p->s.size == bp) {
+    22da:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    22de:	8b 40 08             	mov    0x8(%rax),%eax
+    22e1:	89 c0                	mov    %eax,%eax
+    22e3:	48 c1 e0 04          	shl    $0x4,%rax
+    22e7:	48 89 c2             	mov    %rax,%rdx
+    22ea:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    22ee:	48 01 d0             	add    %rdx,%rax
+    22f1:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+    22f5:	75 27                	jne    231e <free+0x109>
+    p->s.size += bp->s.size;
+    22f7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    22fb:	8b 50 08             	mov    0x8(%rax),%edx
+    22fe:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2302:	8b 40 08             	mov    0x8(%rax),%eax
+    2305:	01 c2                	add    %eax,%edx
+    2307:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    230b:	89 50 08             	mov    %edx,0x8(%rax)
+    p->s.ptr = bp->s.ptr;
+    230e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2312:	48 8b 10             	mov    (%rax),%rdx
+    2315:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2319:	48 89 10             	mov    %rdx,(%rax)
+    231c:	eb 0b                	jmp    2329 <free+0x114>
+  } else
+    p->s.ptr = bp;
+    231e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2322:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    2326:	48 89 10             	mov    %rdx,(%rax)
+  freep = p;
+    2329:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    232d:	48 89 05 bc 0f 00 00 	mov    %rax,0xfbc(%rip)        # 32f0 <freep>
+}
+    2334:	90                   	nop
+    2335:	5d                   	pop    %rbp
+    2336:	c3                   	ret
+
+0000000000002337 <morecore>:
+
+static Header *morecore(uint nu) {
+    2337:	55                   	push   %rbp
+    2338:	48 89 e5             	mov    %rsp,%rbp
+    233b:	48 83 ec 20          	sub    $0x20,%rsp
+    233f:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  char *p;
+  Header *hp;
+
+  if (nu < 4096)
+    2342:	81 7d ec ff 0f 00 00 	cmpl   $0xfff,-0x14(%rbp)
+    2349:	77 07                	ja     2352 <morecore+0x1b>
+    nu = 4096;
+    234b:	c7 45 ec 00 10 00 00 	movl   $0x1000,-0x14(%rbp)
+  p = sbrk(nu * sizeof(Header));
+    2352:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    2355:	c1 e0 04             	shl    $0x4,%eax
+    2358:	89 c7                	mov    %eax,%edi
+    235a:	e8 7e fe ff ff       	call   21dd <sbrk>
+    235f:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (p == (char *)-1)
+    2363:	48 83 7d f8 ff       	cmpq   $0xffffffffffffffff,-0x8(%rbp)
+    2368:	75 07                	jne    2371 <morecore+0x3a>
+    return 0;
+    236a:	b8 00 00 00 00       	mov    $0x0,%eax
+    236f:	eb 29                	jmp    239a <morecore+0x63>
+  hp = (Header *)p;
+    2371:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2375:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  hp->s.size = nu;
+    2379:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    237d:	8b 55 ec             	mov    -0x14(%rbp),%edx
+    2380:	89 50 08             	mov    %edx,0x8(%rax)
+  free((void *)(hp + 1));
+    2383:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2387:	48 83 c0 10          	add    $0x10,%rax
+    238b:	48 89 c7             	mov    %rax,%rdi
+    238e:	e8 82 fe ff ff       	call   2215 <free>
+  return freep;
+    2393:	48 8b 05 56 0f 00 00 	mov    0xf56(%rip),%rax        # 32f0 <freep>
+}
+    239a:	c9                   	leave
+    239b:	c3                   	ret
+
+000000000000239c <malloc>:
+
+void *malloc(uint nbytes) {
+    239c:	55                   	push   %rbp
+    239d:	48 89 e5             	mov    %rsp,%rbp
+    23a0:	48 83 ec 30          	sub    $0x30,%rsp
+    23a4:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1) / sizeof(Header) + 1;
+    23a7:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    23aa:	48 83 c0 0f          	add    $0xf,%rax
+    23ae:	48 c1 e8 04          	shr    $0x4,%rax
+    23b2:	83 c0 01             	add    $0x1,%eax
+    23b5:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  if ((prevp = freep) == 0) {
+    23b8:	48 8b 05 31 0f 00 00 	mov    0xf31(%rip),%rax        # 32f0 <freep>
+    23bf:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    23c3:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+    23c8:	75 2e                	jne    23f8 <malloc+0x5c>
+    base.s.ptr = freep = prevp = &base;
+    23ca:	48 8d 05 0f 0f 00 00 	lea    0xf0f(%rip),%rax        # 32e0 <base>
+    23d1:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    23d5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    23d9:	48 89 05 10 0f 00 00 	mov    %rax,0xf10(%rip)        # 32f0 <freep>
+    23e0:	48 8b 05 09 0f 00 00 	mov    0xf09(%rip),%rax        # 32f0 <freep>
+    23e7:	48 89 05 f2 0e 00 00 	mov    %rax,0xef2(%rip)        # 32e0 <base>
+    base.s.size = 0;
+    23ee:	c7 05 f0 0e 00 00 00 	movl   $0x0,0xef0(%rip)        # 32e8 <base+0x8>
+    23f5:	00 00 00 
+  }
+  for (p = prevp->s.ptr;; prevp = p, p = p->s.ptr) {
+    23f8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    23fc:	48 8b 00             	mov    (%rax),%rax
+    23ff:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    if (p->s.size >= nunits) {
+    2403:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2407:	8b 40 08             	mov    0x8(%rax),%eax
+    240a:	3b 45 ec             	cmp    -0x14(%rbp),%eax
+    240d:	72 5f                	jb     246e <malloc+0xd2>
+      if (p->s.size == nunits)
+    240f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2413:	8b 40 08             	mov    0x8(%rax),%eax
+    2416:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+    2419:	75 10                	jne    242b <malloc+0x8f>
+        prevp->s.ptr = p->s.ptr;
+    241b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    241f:	48 8b 10             	mov    (%rax),%rdx
+    2422:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2426:	48 89 10             	mov    %rdx,(%rax)
+    2429:	eb 2e                	jmp    2459 <malloc+0xbd>
+      else {
+        p->s.size -= nunits;
+    242b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    242f:	8b 40 08             	mov    0x8(%rax),%eax
+    2432:	2b 45 ec             	sub    -0x14(%rbp),%eax
+    2435:	89 c2                	mov    %eax,%edx
+    2437:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    243b:	89 50 08             	mov    %edx,0x8(%rax)
+        p += p->s.size;
+    243e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2442:	8b 40 08             	mov    0x8(%rax),%eax
+    2445:	89 c0                	mov    %eax,%eax
+    2447:	48 c1 e0 04          	shl    $0x4,%rax
+    244b:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+        p->s.size = nunits;
+    244f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2453:	8b 55 ec             	mov    -0x14(%rbp),%edx
+    2456:	89 50 08             	mov    %edx,0x8(%rax)
+      }
+      freep = prevp;
+    2459:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    245d:	48 89 05 8c 0e 00 00 	mov    %rax,0xe8c(%rip)        # 32f0 <freep>
+      return (void *)(p + 1);
+    2464:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2468:	48 83 c0 10          	add    $0x10,%rax
+    246c:	eb 41                	jmp    24af <malloc+0x113>
+    }
+    if (p == freep)
+    246e:	48 8b 05 7b 0e 00 00 	mov    0xe7b(%rip),%rax        # 32f0 <freep>
+    2475:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+    2479:	75 1c                	jne    2497 <malloc+0xfb>
+      if ((p = morecore(nunits)) == 0)
+    247b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    247e:	89 c7                	mov    %eax,%edi
+    2480:	e8 b2 fe ff ff       	call   2337 <morecore>
+    2485:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    2489:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+    248e:	75 07                	jne    2497 <malloc+0xfb>
+        return 0;
+    2490:	b8 00 00 00 00       	mov    $0x0,%eax
+    2495:	eb 18                	jmp    24af <malloc+0x113>
+  for (p = prevp->s.ptr;; prevp = p, p = p->s.ptr) {
+    2497:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    249b:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    249f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    24a3:	48 8b 00             	mov    (%rax),%rax
+    24a6:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    if (p->s.size >= nunits) {
+    24aa:	e9 54 ff ff ff       	jmp    2403 <malloc+0x67>
+  }
+    24af:	c9                   	leave
+    24b0:	c3                   	ret
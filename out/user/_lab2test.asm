@@ -0,0 +1,3517 @@
+
+out/user/_lab2test:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000000000 <main>:
+void fdesctest(void);
+void racetest(void);
+void childpidtest(void);
+void exectest(void);
+
+int main() {
+       0:	55                   	push   %rbp
+       1:	48 89 e5             	mov    %rsp,%rbp
+       4:	48 83 ec 50          	sub    $0x50,%rsp
+  dup(0); // stderr
+
+*/
+
+  struct sys_info info1, info2;
+  sysinfo(&info1);
+       8:	48 8d 45 d4          	lea    -0x2c(%rbp),%rax
+       c:	48 89 c7             	mov    %rax,%rdi
+       f:	e8 fb 24 00 00       	call   250f <sysinfo>
+
+  printf(stdout, "pages_in_use pre fork = %d\n",
+      14:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+      17:	8b 05 e3 32 00 00    	mov    0x32e3(%rip),%eax        # 3300 <stdout>
+      1d:	48 8d 0d ac 27 00 00 	lea    0x27ac(%rip),%rcx        # 27d0 <malloc+0x11a>
+      24:	48 89 ce             	mov    %rcx,%rsi
+      27:	89 c7                	mov    %eax,%edi
+      29:	b8 00 00 00 00       	mov    $0x0,%eax
+      2e:	e8 95 1e 00 00       	call   1ec8 <printf>
+         info1.pages_in_use);
+
+  pid = fork();
+      33:	e8 2f 24 00 00       	call   2467 <fork>
+      38:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  if (pid < 0) {
+      3b:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+      3f:	79 1e                	jns    5f <main+0x5f>
+    printf(1, "fork failed\n");
+      41:	48 8d 05 a4 27 00 00 	lea    0x27a4(%rip),%rax        # 27ec <malloc+0x136>
+      48:	48 89 c6             	mov    %rax,%rsi
+      4b:	bf 01 00 00 00       	mov    $0x1,%edi
+      50:	b8 00 00 00 00       	mov    $0x0,%eax
+      55:	e8 6e 1e 00 00       	call   1ec8 <printf>
+    exit();
+      5a:	e8 10 24 00 00       	call   246f <exit>
+  }
+
+  if (pid == 0) {
+      5f:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+      63:	75 5a                	jne    bf <main+0xbf>
+    forktest();
+      65:	e8 9b 00 00 00       	call   105 <forktest>
+    racetest();
+      6a:	e8 2b 0d 00 00       	call   d9a <racetest>
+    fdesctest();
+      6f:	e8 3f 0e 00 00       	call   eb3 <fdesctest>
+    pipetest();
+      74:	e8 41 02 00 00       	call   2ba <pipetest>
+    extendedpipetest();
+      79:	e8 b4 05 00 00       	call   632 <extendedpipetest>
+    childpidtest();
+      7e:	e8 52 15 00 00       	call   15d5 <childpidtest>
+    exectest();
+      83:	e8 90 15 00 00       	call   1618 <exectest>
+
+    printf(1, "lab2 tests passed!!\n");
+      88:	48 8d 05 6a 27 00 00 	lea    0x276a(%rip),%rax        # 27f9 <malloc+0x143>
+      8f:	48 89 c6             	mov    %rax,%rsi
+      92:	bf 01 00 00 00       	mov    $0x1,%edi
+      97:	b8 00 00 00 00       	mov    $0x0,%eax
+      9c:	e8 27 1e 00 00       	call   1ec8 <printf>
+    exit();
+      a1:	e8 c9 23 00 00       	call   246f <exit>
+    while (1)
+      ;
+  }
+
+  while ((wpid = wait()) >= 0 && wpid != pid)
+    printf(1, "zombie!\n");
+      a6:	48 8d 05 61 27 00 00 	lea    0x2761(%rip),%rax        # 280e <malloc+0x158>
+      ad:	48 89 c6             	mov    %rax,%rsi
+      b0:	bf 01 00 00 00       	mov    $0x1,%edi
+      b5:	b8 00 00 00 00       	mov    $0x0,%eax
+      ba:	e8 09 1e 00 00       	call   1ec8 <printf>
+  while ((wpid = wait()) >= 0 && wpid != pid)
+      bf:	e8 b3 23 00 00       	call   2477 <wait>
+      c4:	89 45 f8             	mov    %eax,-0x8(%rbp)
+      c7:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+      cb:	78 08                	js     d5 <main+0xd5>
+      cd:	8b 45 f8             	mov    -0x8(%rbp),%eax
+      d0:	3b 45 fc             	cmp    -0x4(%rbp),%eax
+      d3:	75 d1                	jne    a6 <main+0xa6>
+
+  sysinfo(&info1);
+      d5:	48 8d 45 d4          	lea    -0x2c(%rbp),%rax
+      d9:	48 89 c7             	mov    %rax,%rdi
+      dc:	e8 2e 24 00 00       	call   250f <sysinfo>
+
+  printf(stdout, "pages_in_use post exit = %d\n",
+      e1:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+      e4:	8b 05 16 32 00 00    	mov    0x3216(%rip),%eax        # 3300 <stdout>
+      ea:	48 8d 0d 26 27 00 00 	lea    0x2726(%rip),%rcx        # 2817 <malloc+0x161>
+      f1:	48 89 ce             	mov    %rcx,%rsi
+      f4:	89 c7                	mov    %eax,%edi
+      f6:	b8 00 00 00 00       	mov    $0x0,%eax
+      fb:	e8 c8 1d 00 00       	call   1ec8 <printf>
+         info1.pages_in_use);
+
+  exit();
+     100:	e8 6a 23 00 00       	call   246f <exit>
+
+0000000000000105 <forktest>:
+  return 0;
+}
+
+void forktest(void) {
+     105:	55                   	push   %rbp
+     106:	48 89 e5             	mov    %rsp,%rbp
+     109:	48 83 ec 10          	sub    $0x10,%rsp
+  int n, pid;
+  int nproc = 6;
+     10d:	c7 45 f8 06 00 00 00 	movl   $0x6,-0x8(%rbp)
+
+  printf(1, "forktest\n");
+     114:	48 8d 05 19 27 00 00 	lea    0x2719(%rip),%rax        # 2834 <malloc+0x17e>
+     11b:	48 89 c6             	mov    %rax,%rsi
+     11e:	bf 01 00 00 00       	mov    $0x1,%edi
+     123:	b8 00 00 00 00       	mov    $0x0,%eax
+     128:	e8 9b 1d 00 00       	call   1ec8 <printf>
+
+  for (n = 0; n < nproc; n++) {
+     12d:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     134:	eb 1d                	jmp    153 <forktest+0x4e>
+    pid = fork();
+     136:	e8 2c 23 00 00       	call   2467 <fork>
+     13b:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    if (pid < 0)
+     13e:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+     142:	78 19                	js     15d <forktest+0x58>
+      break;
+    if (pid == 0) {
+     144:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+     148:	75 05                	jne    14f <forktest+0x4a>
+      exit();
+     14a:	e8 20 23 00 00       	call   246f <exit>
+  for (n = 0; n < nproc; n++) {
+     14f:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     153:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     156:	3b 45 f8             	cmp    -0x8(%rbp),%eax
+     159:	7c db                	jl     136 <forktest+0x31>
+     15b:	eb 01                	jmp    15e <forktest+0x59>
+      break;
+     15d:	90                   	nop
+      error("forktest: exit failed to destroy this process");
+    }
+  }
+
+  if (n != nproc) {
+     15e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     161:	3b 45 f8             	cmp    -0x8(%rbp),%eax
+     164:	0f 84 c8 00 00 00    	je     232 <forktest+0x12d>
+    error("forktest: fork claimed to work %d times! but only %d\n", nproc, n);
+     16a:	8b 05 90 31 00 00    	mov    0x3190(%rip),%eax        # 3300 <stdout>
+     170:	ba 6a 00 00 00       	mov    $0x6a,%edx
+     175:	48 8d 0d c2 26 00 00 	lea    0x26c2(%rip),%rcx        # 283e <malloc+0x188>
+     17c:	48 89 ce             	mov    %rcx,%rsi
+     17f:	89 c7                	mov    %eax,%edi
+     181:	b8 00 00 00 00       	mov    $0x0,%eax
+     186:	e8 3d 1d 00 00       	call   1ec8 <printf>
+     18b:	8b 05 6f 31 00 00    	mov    0x316f(%rip),%eax        # 3300 <stdout>
+     191:	8b 4d fc             	mov    -0x4(%rbp),%ecx
+     194:	8b 55 f8             	mov    -0x8(%rbp),%edx
+     197:	48 8d 35 b2 26 00 00 	lea    0x26b2(%rip),%rsi        # 2850 <malloc+0x19a>
+     19e:	89 c7                	mov    %eax,%edi
+     1a0:	b8 00 00 00 00       	mov    $0x0,%eax
+     1a5:	e8 1e 1d 00 00       	call   1ec8 <printf>
+     1aa:	8b 05 50 31 00 00    	mov    0x3150(%rip),%eax        # 3300 <stdout>
+     1b0:	48 8d 15 cf 26 00 00 	lea    0x26cf(%rip),%rdx        # 2886 <malloc+0x1d0>
+     1b7:	48 89 d6             	mov    %rdx,%rsi
+     1ba:	89 c7                	mov    %eax,%edi
+     1bc:	b8 00 00 00 00       	mov    $0x0,%eax
+     1c1:	e8 02 1d 00 00       	call   1ec8 <printf>
+     1c6:	90                   	nop
+     1c7:	eb fd                	jmp    1c6 <forktest+0xc1>
+  }
+
+  for (; n > 0; n--) {
+    if (wait() < 0) {
+     1c9:	e8 a9 22 00 00       	call   2477 <wait>
+     1ce:	85 c0                	test   %eax,%eax
+     1d0:	79 5c                	jns    22e <forktest+0x129>
+      error("forktest: wait stopped early\n");
+     1d2:	8b 05 28 31 00 00    	mov    0x3128(%rip),%eax        # 3300 <stdout>
+     1d8:	ba 6f 00 00 00       	mov    $0x6f,%edx
+     1dd:	48 8d 0d 5a 26 00 00 	lea    0x265a(%rip),%rcx        # 283e <malloc+0x188>
+     1e4:	48 89 ce             	mov    %rcx,%rsi
+     1e7:	89 c7                	mov    %eax,%edi
+     1e9:	b8 00 00 00 00       	mov    $0x0,%eax
+     1ee:	e8 d5 1c 00 00       	call   1ec8 <printf>
+     1f3:	8b 05 07 31 00 00    	mov    0x3107(%rip),%eax        # 3300 <stdout>
+     1f9:	48 8d 15 88 26 00 00 	lea    0x2688(%rip),%rdx        # 2888 <malloc+0x1d2>
+     200:	48 89 d6             	mov    %rdx,%rsi
+     203:	89 c7                	mov    %eax,%edi
+     205:	b8 00 00 00 00       	mov    $0x0,%eax
+     20a:	e8 b9 1c 00 00       	call   1ec8 <printf>
+     20f:	8b 05 eb 30 00 00    	mov    0x30eb(%rip),%eax        # 3300 <stdout>
+     215:	48 8d 15 6a 26 00 00 	lea    0x266a(%rip),%rdx        # 2886 <malloc+0x1d0>
+     21c:	48 89 d6             	mov    %rdx,%rsi
+     21f:	89 c7                	mov    %eax,%edi
+     221:	b8 00 00 00 00       	mov    $0x0,%eax
+     226:	e8 9d 1c 00 00       	call   1ec8 <printf>
+     22b:	90                   	nop
+     22c:	eb fd                	jmp    22b <forktest+0x126>
+  for (; n > 0; n--) {
+     22e:	83 6d fc 01          	subl   $0x1,-0x4(%rbp)
+     232:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     236:	7f 91                	jg     1c9 <forktest+0xc4>
+    }
+  }
+
+  if (wait() != -1) {
+     238:	e8 3a 22 00 00       	call   2477 <wait>
+     23d:	83 f8 ff             	cmp    $0xffffffff,%eax
+     240:	74 5c                	je     29e <forktest+0x199>
+    error("forktest: wait got too many\n");
+     242:	8b 05 b8 30 00 00    	mov    0x30b8(%rip),%eax        # 3300 <stdout>
+     248:	ba 74 00 00 00       	mov    $0x74,%edx
+     24d:	48 8d 0d ea 25 00 00 	lea    0x25ea(%rip),%rcx        # 283e <malloc+0x188>
+     254:	48 89 ce             	mov    %rcx,%rsi
+     257:	89 c7                	mov    %eax,%edi
+     259:	b8 00 00 00 00       	mov    $0x0,%eax
+     25e:	e8 65 1c 00 00       	call   1ec8 <printf>
+     263:	8b 05 97 30 00 00    	mov    0x3097(%rip),%eax        # 3300 <stdout>
+     269:	48 8d 15 36 26 00 00 	lea    0x2636(%rip),%rdx        # 28a6 <malloc+0x1f0>
+     270:	48 89 d6             	mov    %rdx,%rsi
+     273:	89 c7                	mov    %eax,%edi
+     275:	b8 00 00 00 00       	mov    $0x0,%eax
+     27a:	e8 49 1c 00 00       	call   1ec8 <printf>
+     27f:	8b 05 7b 30 00 00    	mov    0x307b(%rip),%eax        # 3300 <stdout>
+     285:	48 8d 15 fa 25 00 00 	lea    0x25fa(%rip),%rdx        # 2886 <malloc+0x1d0>
+     28c:	48 89 d6             	mov    %rdx,%rsi
+     28f:	89 c7                	mov    %eax,%edi
+     291:	b8 00 00 00 00       	mov    $0x0,%eax
+     296:	e8 2d 1c 00 00       	call   1ec8 <printf>
+     29b:	90                   	nop
+     29c:	eb fd                	jmp    29b <forktest+0x196>
+  }
+
+  printf(1, "forktest: ok\n");
+     29e:	48 8d 05 1e 26 00 00 	lea    0x261e(%rip),%rax        # 28c3 <malloc+0x20d>
+     2a5:	48 89 c6             	mov    %rax,%rsi
+     2a8:	bf 01 00 00 00       	mov    $0x1,%edi
+     2ad:	b8 00 00 00 00       	mov    $0x0,%eax
+     2b2:	e8 11 1c 00 00       	call   1ec8 <printf>
+}
+     2b7:	90                   	nop
+     2b8:	c9                   	leave
+     2b9:	c3                   	ret
+
+00000000000002ba <pipetest>:
+
+void pipetest(void) {
+     2ba:	55                   	push   %rbp
+     2bb:	48 89 e5             	mov    %rsp,%rbp
+     2be:	48 81 ec 20 02 00 00 	sub    $0x220,%rsp
+  char buf[500];
+  int fds[2], pid;
+  int seq, i, n, cc, total;
+
+  printf(1, "pipetest\n");
+     2c5:	48 8d 05 05 26 00 00 	lea    0x2605(%rip),%rax        # 28d1 <malloc+0x21b>
+     2cc:	48 89 c6             	mov    %rax,%rsi
+     2cf:	bf 01 00 00 00       	mov    $0x1,%edi
+     2d4:	b8 00 00 00 00       	mov    $0x0,%eax
+     2d9:	e8 ea 1b 00 00       	call   1ec8 <printf>
+
+  if (pipe(fds) != 0) {
+     2de:	48 8d 85 ec fd ff ff 	lea    -0x214(%rbp),%rax
+     2e5:	48 89 c7             	mov    %rax,%rdi
+     2e8:	e8 92 21 00 00       	call   247f <pipe>
+     2ed:	85 c0                	test   %eax,%eax
+     2ef:	74 5c                	je     34d <pipetest+0x93>
+    error("pipetest: pipe() failed\n");
+     2f1:	8b 05 09 30 00 00    	mov    0x3009(%rip),%eax        # 3300 <stdout>
+     2f7:	ba 82 00 00 00       	mov    $0x82,%edx
+     2fc:	48 8d 0d 3b 25 00 00 	lea    0x253b(%rip),%rcx        # 283e <malloc+0x188>
+     303:	48 89 ce             	mov    %rcx,%rsi
+     306:	89 c7                	mov    %eax,%edi
+     308:	b8 00 00 00 00       	mov    $0x0,%eax
+     30d:	e8 b6 1b 00 00       	call   1ec8 <printf>
+     312:	8b 05 e8 2f 00 00    	mov    0x2fe8(%rip),%eax        # 3300 <stdout>
+     318:	48 8d 15 bc 25 00 00 	lea    0x25bc(%rip),%rdx        # 28db <malloc+0x225>
+     31f:	48 89 d6             	mov    %rdx,%rsi
+     322:	89 c7                	mov    %eax,%edi
+     324:	b8 00 00 00 00       	mov    $0x0,%eax
+     329:	e8 9a 1b 00 00       	call   1ec8 <printf>
+     32e:	8b 05 cc 2f 00 00    	mov    0x2fcc(%rip),%eax        # 3300 <stdout>
+     334:	48 8d 15 4b 25 00 00 	lea    0x254b(%rip),%rdx        # 2886 <malloc+0x1d0>
+     33b:	48 89 d6             	mov    %rdx,%rsi
+     33e:	89 c7                	mov    %eax,%edi
+     340:	b8 00 00 00 00       	mov    $0x0,%eax
+     345:	e8 7e 1b 00 00       	call   1ec8 <printf>
+     34a:	90                   	nop
+     34b:	eb fd                	jmp    34a <pipetest+0x90>
+  }
+  pid = fork();
+     34d:	e8 15 21 00 00       	call   2467 <fork>
+     352:	89 45 e8             	mov    %eax,-0x18(%rbp)
+  seq = 0;
+     355:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  if (pid == 0) {
+     35c:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+     360:	0f 85 d3 00 00 00    	jne    439 <pipetest+0x17f>
+    close(fds[0]);
+     366:	8b 85 ec fd ff ff    	mov    -0x214(%rbp),%eax
+     36c:	89 c7                	mov    %eax,%edi
+     36e:	e8 24 21 00 00       	call   2497 <close>
+    for (n = 0; n < 5; n++) {
+     373:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+     37a:	e9 ab 00 00 00       	jmp    42a <pipetest+0x170>
+      for (i = 0; i < 95; i++)
+     37f:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+     386:	eb 1b                	jmp    3a3 <pipetest+0xe9>
+        buf[i] = seq++;
+     388:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     38b:	8d 50 01             	lea    0x1(%rax),%edx
+     38e:	89 55 fc             	mov    %edx,-0x4(%rbp)
+     391:	89 c2                	mov    %eax,%edx
+     393:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     396:	48 98                	cltq
+     398:	88 94 05 f4 fd ff ff 	mov    %dl,-0x20c(%rbp,%rax,1)
+      for (i = 0; i < 95; i++)
+     39f:	83 45 f8 01          	addl   $0x1,-0x8(%rbp)
+     3a3:	83 7d f8 5e          	cmpl   $0x5e,-0x8(%rbp)
+     3a7:	7e df                	jle    388 <pipetest+0xce>
+      if (write(fds[1], buf, 95) != 95) {
+     3a9:	8b 85 f0 fd ff ff    	mov    -0x210(%rbp),%eax
+     3af:	48 8d 8d f4 fd ff ff 	lea    -0x20c(%rbp),%rcx
+     3b6:	ba 5f 00 00 00       	mov    $0x5f,%edx
+     3bb:	48 89 ce             	mov    %rcx,%rsi
+     3be:	89 c7                	mov    %eax,%edi
+     3c0:	e8 ca 20 00 00       	call   248f <write>
+     3c5:	83 f8 5f             	cmp    $0x5f,%eax
+     3c8:	74 5c                	je     426 <pipetest+0x16c>
+        error("pipetest: oops 1\n");
+     3ca:	8b 05 30 2f 00 00    	mov    0x2f30(%rip),%eax        # 3300 <stdout>
+     3d0:	ba 8c 00 00 00       	mov    $0x8c,%edx
+     3d5:	48 8d 0d 62 24 00 00 	lea    0x2462(%rip),%rcx        # 283e <malloc+0x188>
+     3dc:	48 89 ce             	mov    %rcx,%rsi
+     3df:	89 c7                	mov    %eax,%edi
+     3e1:	b8 00 00 00 00       	mov    $0x0,%eax
+     3e6:	e8 dd 1a 00 00       	call   1ec8 <printf>
+     3eb:	8b 05 0f 2f 00 00    	mov    0x2f0f(%rip),%eax        # 3300 <stdout>
+     3f1:	48 8d 15 fc 24 00 00 	lea    0x24fc(%rip),%rdx        # 28f4 <malloc+0x23e>
+     3f8:	48 89 d6             	mov    %rdx,%rsi
+     3fb:	89 c7                	mov    %eax,%edi
+     3fd:	b8 00 00 00 00       	mov    $0x0,%eax
+     402:	e8 c1 1a 00 00       	call   1ec8 <printf>
+     407:	8b 05 f3 2e 00 00    	mov    0x2ef3(%rip),%eax        # 3300 <stdout>
+     40d:	48 8d 15 72 24 00 00 	lea    0x2472(%rip),%rdx        # 2886 <malloc+0x1d0>
+     414:	48 89 d6             	mov    %rdx,%rsi
+     417:	89 c7                	mov    %eax,%edi
+     419:	b8 00 00 00 00       	mov    $0x0,%eax
+     41e:	e8 a5 1a 00 00       	call   1ec8 <printf>
+     423:	90                   	nop
+     424:	eb fd                	jmp    423 <pipetest+0x169>
+    for (n = 0; n < 5; n++) {
+     426:	83 45 f4 01          	addl   $0x1,-0xc(%rbp)
+     42a:	83 7d f4 04          	cmpl   $0x4,-0xc(%rbp)
+     42e:	0f 8e 4b ff ff ff    	jle    37f <pipetest+0xc5>
+      }
+    }
+    exit();
+     434:	e8 36 20 00 00       	call   246f <exit>
+  } else if (pid > 0) {
+     439:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+     43d:	0f 8e 77 01 00 00    	jle    5ba <pipetest+0x300>
+    close(fds[1]);
+     443:	8b 85 f0 fd ff ff    	mov    -0x210(%rbp),%eax
+     449:	89 c7                	mov    %eax,%edi
+     44b:	e8 47 20 00 00       	call   2497 <close>
+    total = 0;
+     450:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+    cc = 1;
+     457:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%rbp)
+    while ((n = read(fds[0], buf, cc)) > 0) {
+     45e:	e9 b4 00 00 00       	jmp    517 <pipetest+0x25d>
+      for (i = 0; i < n; i++) {
+     463:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+     46a:	e9 82 00 00 00       	jmp    4f1 <pipetest+0x237>
+        if ((buf[i] & 0xff) != (seq++ & 0xff)) {
+     46f:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     472:	48 98                	cltq
+     474:	0f b6 84 05 f4 fd ff 	movzbl -0x20c(%rbp,%rax,1),%eax
+     47b:	ff 
+     47c:	0f be c8             	movsbl %al,%ecx
+     47f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     482:	8d 50 01             	lea    0x1(%rax),%edx
+     485:	89 55 fc             	mov    %edx,-0x4(%rbp)
+     488:	31 c8                	xor    %ecx,%eax
+     48a:	0f b6 c0             	movzbl %al,%eax
+     48d:	85 c0                	test   %eax,%eax
+     48f:	74 5c                	je     4ed <pipetest+0x233>
+          error("pipetest: oops 2\n");
+     491:	8b 05 69 2e 00 00    	mov    0x2e69(%rip),%eax        # 3300 <stdout>
+     497:	ba 97 00 00 00       	mov    $0x97,%edx
+     49c:	48 8d 0d 9b 23 00 00 	lea    0x239b(%rip),%rcx        # 283e <malloc+0x188>
+     4a3:	48 89 ce             	mov    %rcx,%rsi
+     4a6:	89 c7                	mov    %eax,%edi
+     4a8:	b8 00 00 00 00       	mov    $0x0,%eax
+     4ad:	e8 16 1a 00 00       	call   1ec8 <printf>
+     4b2:	8b 05 48 2e 00 00    	mov    0x2e48(%rip),%eax        # 3300 <stdout>
+     4b8:	48 8d 15 47 24 00 00 	lea    0x2447(%rip),%rdx        # 2906 <malloc+0x250>
+     4bf:	48 89 d6             	mov    %rdx,%rsi
+     4c2:	89 c7                	mov    %eax,%edi
+     4c4:	b8 00 00 00 00       	mov    $0x0,%eax
+     4c9:	e8 fa 19 00 00       	call   1ec8 <printf>
+     4ce:	8b 05 2c 2e 00 00    	mov    0x2e2c(%rip),%eax        # 3300 <stdout>
+     4d4:	48 8d 15 ab 23 00 00 	lea    0x23ab(%rip),%rdx        # 2886 <malloc+0x1d0>
+     4db:	48 89 d6             	mov    %rdx,%rsi
+     4de:	89 c7                	mov    %eax,%edi
+     4e0:	b8 00 00 00 00       	mov    $0x0,%eax
+     4e5:	e8 de 19 00 00       	call   1ec8 <printf>
+     4ea:	90                   	nop
+     4eb:	eb fd                	jmp    4ea <pipetest+0x230>
+      for (i = 0; i < n; i++) {
+     4ed:	83 45 f8 01          	addl   $0x1,-0x8(%rbp)
+     4f1:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     4f4:	3b 45 f4             	cmp    -0xc(%rbp),%eax
+     4f7:	0f 8c 72 ff ff ff    	jl     46f <pipetest+0x1b5>
+        }
+      }
+      total += n;
+     4fd:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     500:	01 45 ec             	add    %eax,-0x14(%rbp)
+      cc = cc * 2;
+     503:	d1 65 f0             	shll   -0x10(%rbp)
+      if (cc > sizeof(buf))
+     506:	8b 45 f0             	mov    -0x10(%rbp),%eax
+     509:	3d f4 01 00 00       	cmp    $0x1f4,%eax
+     50e:	76 07                	jbe    517 <pipetest+0x25d>
+        cc = sizeof(buf);
+     510:	c7 45 f0 f4 01 00 00 	movl   $0x1f4,-0x10(%rbp)
+    while ((n = read(fds[0], buf, cc)) > 0) {
+     517:	8b 85 ec fd ff ff    	mov    -0x214(%rbp),%eax
+     51d:	8b 55 f0             	mov    -0x10(%rbp),%edx
+     520:	48 8d 8d f4 fd ff ff 	lea    -0x20c(%rbp),%rcx
+     527:	48 89 ce             	mov    %rcx,%rsi
+     52a:	89 c7                	mov    %eax,%edi
+     52c:	e8 56 1f 00 00       	call   2487 <read>
+     531:	89 45 f4             	mov    %eax,-0xc(%rbp)
+     534:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+     538:	0f 8f 25 ff ff ff    	jg     463 <pipetest+0x1a9>
+    }
+    if (total != 5 * 95) {
+     53e:	81 7d ec db 01 00 00 	cmpl   $0x1db,-0x14(%rbp)
+     545:	74 5f                	je     5a6 <pipetest+0x2ec>
+      error("pipetest: oops 3 total %d\n", total);
+     547:	8b 05 b3 2d 00 00    	mov    0x2db3(%rip),%eax        # 3300 <stdout>
+     54d:	ba a0 00 00 00       	mov    $0xa0,%edx
+     552:	48 8d 0d e5 22 00 00 	lea    0x22e5(%rip),%rcx        # 283e <malloc+0x188>
+     559:	48 89 ce             	mov    %rcx,%rsi
+     55c:	89 c7                	mov    %eax,%edi
+     55e:	b8 00 00 00 00       	mov    $0x0,%eax
+     563:	e8 60 19 00 00       	call   1ec8 <printf>
+     568:	8b 05 92 2d 00 00    	mov    0x2d92(%rip),%eax        # 3300 <stdout>
+     56e:	8b 55 ec             	mov    -0x14(%rbp),%edx
+     571:	48 8d 0d a0 23 00 00 	lea    0x23a0(%rip),%rcx        # 2918 <malloc+0x262>
+     578:	48 89 ce             	mov    %rcx,%rsi
+     57b:	89 c7                	mov    %eax,%edi
+     57d:	b8 00 00 00 00       	mov    $0x0,%eax
+     582:	e8 41 19 00 00       	call   1ec8 <printf>
+     587:	8b 05 73 2d 00 00    	mov    0x2d73(%rip),%eax        # 3300 <stdout>
+     58d:	48 8d 15 f2 22 00 00 	lea    0x22f2(%rip),%rdx        # 2886 <malloc+0x1d0>
+     594:	48 89 d6             	mov    %rdx,%rsi
+     597:	89 c7                	mov    %eax,%edi
+     599:	b8 00 00 00 00       	mov    $0x0,%eax
+     59e:	e8 25 19 00 00       	call   1ec8 <printf>
+     5a3:	90                   	nop
+     5a4:	eb fd                	jmp    5a3 <pipetest+0x2e9>
+    }
+    close(fds[0]);
+     5a6:	8b 85 ec fd ff ff    	mov    -0x214(%rbp),%eax
+     5ac:	89 c7                	mov    %eax,%edi
+     5ae:	e8 e4 1e 00 00       	call   2497 <close>
+    wait();
+     5b3:	e8 bf 1e 00 00       	call   2477 <wait>
+     5b8:	eb 5c                	jmp    616 <pipetest+0x35c>
+  } else {
+    error("pipetest: fork() failed\n");
+     5ba:	8b 05 40 2d 00 00    	mov    0x2d40(%rip),%eax        # 3300 <stdout>
+     5c0:	ba a5 00 00 00       	mov    $0xa5,%edx
+     5c5:	48 8d 0d 72 22 00 00 	lea    0x2272(%rip),%rcx        # 283e <malloc+0x188>
+     5cc:	48 89 ce             	mov    %rcx,%rsi
+     5cf:	89 c7                	mov    %eax,%edi
+     5d1:	b8 00 00 00 00       	mov    $0x0,%eax
+     5d6:	e8 ed 18 00 00       	call   1ec8 <printf>
+     5db:	8b 05 1f 2d 00 00    	mov    0x2d1f(%rip),%eax        # 3300 <stdout>
+     5e1:	48 8d 15 4b 23 00 00 	lea    0x234b(%rip),%rdx        # 2933 <malloc+0x27d>
+     5e8:	48 89 d6             	mov    %rdx,%rsi
+     5eb:	89 c7                	mov    %eax,%edi
+     5ed:	b8 00 00 00 00       	mov    $0x0,%eax
+     5f2:	e8 d1 18 00 00       	call   1ec8 <printf>
+     5f7:	8b 05 03 2d 00 00    	mov    0x2d03(%rip),%eax        # 3300 <stdout>
+     5fd:	48 8d 15 82 22 00 00 	lea    0x2282(%rip),%rdx        # 2886 <malloc+0x1d0>
+     604:	48 89 d6             	mov    %rdx,%rsi
+     607:	89 c7                	mov    %eax,%edi
+     609:	b8 00 00 00 00       	mov    $0x0,%eax
+     60e:	e8 b5 18 00 00       	call   1ec8 <printf>
+     613:	90                   	nop
+     614:	eb fd                	jmp    613 <pipetest+0x359>
+  }
+  printf(1, "pipetest: ok\n");
+     616:	48 8d 05 2f 23 00 00 	lea    0x232f(%rip),%rax        # 294c <malloc+0x296>
+     61d:	48 89 c6             	mov    %rax,%rsi
+     620:	bf 01 00 00 00       	mov    $0x1,%edi
+     625:	b8 00 00 00 00       	mov    $0x0,%eax
+     62a:	e8 99 18 00 00       	call   1ec8 <printf>
+}
+     62f:	90                   	nop
+     630:	c9                   	leave
+     631:	c3                   	ret
+
+0000000000000632 <extendedpipetest>:
+
+void extendedpipetest(void) {
+     632:	55                   	push   %rbp
+     633:	48 89 e5             	mov    %rsp,%rbp
+     636:	48 83 ec 30          	sub    $0x30,%rsp
+  // read return remaining bytes when write-end is closed,
+  // then return 0 at EOF
+  int pid;
+  int fds[2];
+  char *buf = "pipetestwrite";
+     63a:	48 8d 05 19 23 00 00 	lea    0x2319(%rip),%rax        # 295a <malloc+0x2a4>
+     641:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+  printf(1, "extendedpipetest\n");
+     645:	48 8d 05 1c 23 00 00 	lea    0x231c(%rip),%rax        # 2968 <malloc+0x2b2>
+     64c:	48 89 c6             	mov    %rax,%rsi
+     64f:	bf 01 00 00 00       	mov    $0x1,%edi
+     654:	b8 00 00 00 00       	mov    $0x0,%eax
+     659:	e8 6a 18 00 00       	call   1ec8 <printf>
+  if (pipe(fds) != 0) {
+     65e:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+     662:	48 89 c7             	mov    %rax,%rdi
+     665:	e8 15 1e 00 00       	call   247f <pipe>
+     66a:	85 c0                	test   %eax,%eax
+     66c:	74 5c                	je     6ca <extendedpipetest+0x98>
+    error("extended pipe test: pipe() failed\n");
+     66e:	8b 05 8c 2c 00 00    	mov    0x2c8c(%rip),%eax        # 3300 <stdout>
+     674:	ba b3 00 00 00       	mov    $0xb3,%edx
+     679:	48 8d 0d be 21 00 00 	lea    0x21be(%rip),%rcx        # 283e <malloc+0x188>
+     680:	48 89 ce             	mov    %rcx,%rsi
+     683:	89 c7                	mov    %eax,%edi
+     685:	b8 00 00 00 00       	mov    $0x0,%eax
+     68a:	e8 39 18 00 00       	call   1ec8 <printf>
+     68f:	8b 05 6b 2c 00 00    	mov    0x2c6b(%rip),%eax        # 3300 <stdout>
+     695:	48 8d 15 e4 22 00 00 	lea    0x22e4(%rip),%rdx        # 2980 <malloc+0x2ca>
+     69c:	48 89 d6             	mov    %rdx,%rsi
+     69f:	89 c7                	mov    %eax,%edi
+     6a1:	b8 00 00 00 00       	mov    $0x0,%eax
+     6a6:	e8 1d 18 00 00       	call   1ec8 <printf>
+     6ab:	8b 05 4f 2c 00 00    	mov    0x2c4f(%rip),%eax        # 3300 <stdout>
+     6b1:	48 8d 15 ce 21 00 00 	lea    0x21ce(%rip),%rdx        # 2886 <malloc+0x1d0>
+     6b8:	48 89 d6             	mov    %rdx,%rsi
+     6bb:	89 c7                	mov    %eax,%edi
+     6bd:	b8 00 00 00 00       	mov    $0x0,%eax
+     6c2:	e8 01 18 00 00       	call   1ec8 <printf>
+     6c7:	90                   	nop
+     6c8:	eb fd                	jmp    6c7 <extendedpipetest+0x95>
+  }
+  pid = fork();
+     6ca:	e8 98 1d 00 00       	call   2467 <fork>
+     6cf:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  if (pid == 0) {
+     6d2:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+     6d6:	0f 85 86 00 00 00    	jne    762 <extendedpipetest+0x130>
+    sleep(100);
+     6dc:	bf 64 00 00 00       	mov    $0x64,%edi
+     6e1:	e8 19 1e 00 00       	call   24ff <sleep>
+    if (write(fds[1], buf, 14) != 14) {
+     6e6:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+     6e9:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+     6ed:	ba 0e 00 00 00       	mov    $0xe,%edx
+     6f2:	48 89 ce             	mov    %rcx,%rsi
+     6f5:	89 c7                	mov    %eax,%edi
+     6f7:	e8 93 1d 00 00       	call   248f <write>
+     6fc:	83 f8 0e             	cmp    $0xe,%eax
+     6ff:	74 5c                	je     75d <extendedpipetest+0x12b>
+      error("extended pipe test: oops 1\n");
+     701:	8b 05 f9 2b 00 00    	mov    0x2bf9(%rip),%eax        # 3300 <stdout>
+     707:	ba b9 00 00 00       	mov    $0xb9,%edx
+     70c:	48 8d 0d 2b 21 00 00 	lea    0x212b(%rip),%rcx        # 283e <malloc+0x188>
+     713:	48 89 ce             	mov    %rcx,%rsi
+     716:	89 c7                	mov    %eax,%edi
+     718:	b8 00 00 00 00       	mov    $0x0,%eax
+     71d:	e8 a6 17 00 00       	call   1ec8 <printf>
+     722:	8b 05 d8 2b 00 00    	mov    0x2bd8(%rip),%eax        # 3300 <stdout>
+     728:	48 8d 15 74 22 00 00 	lea    0x2274(%rip),%rdx        # 29a3 <malloc+0x2ed>
+     72f:	48 89 d6             	mov    %rdx,%rsi
+     732:	89 c7                	mov    %eax,%edi
+     734:	b8 00 00 00 00       	mov    $0x0,%eax
+     739:	e8 8a 17 00 00       	call   1ec8 <printf>
+     73e:	8b 05 bc 2b 00 00    	mov    0x2bbc(%rip),%eax        # 3300 <stdout>
+     744:	48 8d 15 3b 21 00 00 	lea    0x213b(%rip),%rdx        # 2886 <malloc+0x1d0>
+     74b:	48 89 d6             	mov    %rdx,%rsi
+     74e:	89 c7                	mov    %eax,%edi
+     750:	b8 00 00 00 00       	mov    $0x0,%eax
+     755:	e8 6e 17 00 00       	call   1ec8 <printf>
+     75a:	90                   	nop
+     75b:	eb fd                	jmp    75a <extendedpipetest+0x128>
+    }
+    exit();
+     75d:	e8 0d 1d 00 00       	call   246f <exit>
+  } else if (pid > 0) {
+     762:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+     766:	0f 8e 5d 02 00 00    	jle    9c9 <extendedpipetest+0x397>
+    close(fds[1]);
+     76c:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+     76f:	89 c7                	mov    %eax,%edi
+     771:	e8 21 1d 00 00       	call   2497 <close>
+    if (wait() != pid) {
+     776:	e8 fc 1c 00 00       	call   2477 <wait>
+     77b:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+     77e:	74 5c                	je     7dc <extendedpipetest+0x1aa>
+      error("extended pipe test: wait() failed\n");
+     780:	8b 05 7a 2b 00 00    	mov    0x2b7a(%rip),%eax        # 3300 <stdout>
+     786:	ba bf 00 00 00       	mov    $0xbf,%edx
+     78b:	48 8d 0d ac 20 00 00 	lea    0x20ac(%rip),%rcx        # 283e <malloc+0x188>
+     792:	48 89 ce             	mov    %rcx,%rsi
+     795:	89 c7                	mov    %eax,%edi
+     797:	b8 00 00 00 00       	mov    $0x0,%eax
+     79c:	e8 27 17 00 00       	call   1ec8 <printf>
+     7a1:	8b 05 59 2b 00 00    	mov    0x2b59(%rip),%eax        # 3300 <stdout>
+     7a7:	48 8d 15 12 22 00 00 	lea    0x2212(%rip),%rdx        # 29c0 <malloc+0x30a>
+     7ae:	48 89 d6             	mov    %rdx,%rsi
+     7b1:	89 c7                	mov    %eax,%edi
+     7b3:	b8 00 00 00 00       	mov    $0x0,%eax
+     7b8:	e8 0b 17 00 00       	call   1ec8 <printf>
+     7bd:	8b 05 3d 2b 00 00    	mov    0x2b3d(%rip),%eax        # 3300 <stdout>
+     7c3:	48 8d 15 bc 20 00 00 	lea    0x20bc(%rip),%rdx        # 2886 <malloc+0x1d0>
+     7ca:	48 89 d6             	mov    %rdx,%rsi
+     7cd:	89 c7                	mov    %eax,%edi
+     7cf:	b8 00 00 00 00       	mov    $0x0,%eax
+     7d4:	e8 ef 16 00 00       	call   1ec8 <printf>
+     7d9:	90                   	nop
+     7da:	eb fd                	jmp    7d9 <extendedpipetest+0x1a7>
+    }
+
+    int bytes_to_read = 14;
+     7dc:	c7 45 fc 0e 00 00 00 	movl   $0xe,-0x4(%rbp)
+    int n = 0;
+     7e3:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+    char buf2[14];
+    while(bytes_to_read > 0) {
+     7ea:	e9 8e 00 00 00       	jmp    87d <extendedpipetest+0x24b>
+      int retval = read(fds[0], buf2 + n, bytes_to_read);
+     7ef:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     7f2:	48 98                	cltq
+     7f4:	48 8d 55 d2          	lea    -0x2e(%rbp),%rdx
+     7f8:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+     7fc:	8b 45 e0             	mov    -0x20(%rbp),%eax
+     7ff:	8b 55 fc             	mov    -0x4(%rbp),%edx
+     802:	48 89 ce             	mov    %rcx,%rsi
+     805:	89 c7                	mov    %eax,%edi
+     807:	e8 7b 1c 00 00       	call   2487 <read>
+     80c:	89 45 e8             	mov    %eax,-0x18(%rbp)
+      if (retval <= 0) {
+     80f:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+     813:	7f 5c                	jg     871 <extendedpipetest+0x23f>
+        error("extended pipe test: read() failed\n");
+     815:	8b 05 e5 2a 00 00    	mov    0x2ae5(%rip),%eax        # 3300 <stdout>
+     81b:	ba c8 00 00 00       	mov    $0xc8,%edx
+     820:	48 8d 0d 17 20 00 00 	lea    0x2017(%rip),%rcx        # 283e <malloc+0x188>
+     827:	48 89 ce             	mov    %rcx,%rsi
+     82a:	89 c7                	mov    %eax,%edi
+     82c:	b8 00 00 00 00       	mov    $0x0,%eax
+     831:	e8 92 16 00 00       	call   1ec8 <printf>
+     836:	8b 05 c4 2a 00 00    	mov    0x2ac4(%rip),%eax        # 3300 <stdout>
+     83c:	48 8d 15 a5 21 00 00 	lea    0x21a5(%rip),%rdx        # 29e8 <malloc+0x332>
+     843:	48 89 d6             	mov    %rdx,%rsi
+     846:	89 c7                	mov    %eax,%edi
+     848:	b8 00 00 00 00       	mov    $0x0,%eax
+     84d:	e8 76 16 00 00       	call   1ec8 <printf>
+     852:	8b 05 a8 2a 00 00    	mov    0x2aa8(%rip),%eax        # 3300 <stdout>
+     858:	48 8d 15 27 20 00 00 	lea    0x2027(%rip),%rdx        # 2886 <malloc+0x1d0>
+     85f:	48 89 d6             	mov    %rdx,%rsi
+     862:	89 c7                	mov    %eax,%edi
+     864:	b8 00 00 00 00       	mov    $0x0,%eax
+     869:	e8 5a 16 00 00       	call   1ec8 <printf>
+     86e:	90                   	nop
+     86f:	eb fd                	jmp    86e <extendedpipetest+0x23c>
+      }
+      n += retval;
+     871:	8b 45 e8             	mov    -0x18(%rbp),%eax
+     874:	01 45 f8             	add    %eax,-0x8(%rbp)
+      bytes_to_read -= retval;
+     877:	8b 45 e8             	mov    -0x18(%rbp),%eax
+     87a:	29 45 fc             	sub    %eax,-0x4(%rbp)
+    while(bytes_to_read > 0) {
+     87d:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     881:	0f 8f 68 ff ff ff    	jg     7ef <extendedpipetest+0x1bd>
+    }
+
+    if (read(fds[0], buf, 1) != 0) {
+     887:	8b 45 e0             	mov    -0x20(%rbp),%eax
+     88a:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+     88e:	ba 01 00 00 00       	mov    $0x1,%edx
+     893:	48 89 ce             	mov    %rcx,%rsi
+     896:	89 c7                	mov    %eax,%edi
+     898:	e8 ea 1b 00 00       	call   2487 <read>
+     89d:	85 c0                	test   %eax,%eax
+     89f:	74 5c                	je     8fd <extendedpipetest+0x2cb>
+      error("pipe tet: read() returns non-zero at EOF\n");
+     8a1:	8b 05 59 2a 00 00    	mov    0x2a59(%rip),%eax        # 3300 <stdout>
+     8a7:	ba cf 00 00 00       	mov    $0xcf,%edx
+     8ac:	48 8d 0d 8b 1f 00 00 	lea    0x1f8b(%rip),%rcx        # 283e <malloc+0x188>
+     8b3:	48 89 ce             	mov    %rcx,%rsi
+     8b6:	89 c7                	mov    %eax,%edi
+     8b8:	b8 00 00 00 00       	mov    $0x0,%eax
+     8bd:	e8 06 16 00 00       	call   1ec8 <printf>
+     8c2:	8b 05 38 2a 00 00    	mov    0x2a38(%rip),%eax        # 3300 <stdout>
+     8c8:	48 8d 15 41 21 00 00 	lea    0x2141(%rip),%rdx        # 2a10 <malloc+0x35a>
+     8cf:	48 89 d6             	mov    %rdx,%rsi
+     8d2:	89 c7                	mov    %eax,%edi
+     8d4:	b8 00 00 00 00       	mov    $0x0,%eax
+     8d9:	e8 ea 15 00 00       	call   1ec8 <printf>
+     8de:	8b 05 1c 2a 00 00    	mov    0x2a1c(%rip),%eax        # 3300 <stdout>
+     8e4:	48 8d 15 9b 1f 00 00 	lea    0x1f9b(%rip),%rdx        # 2886 <malloc+0x1d0>
+     8eb:	48 89 d6             	mov    %rdx,%rsi
+     8ee:	89 c7                	mov    %eax,%edi
+     8f0:	b8 00 00 00 00       	mov    $0x0,%eax
+     8f5:	e8 ce 15 00 00       	call   1ec8 <printf>
+     8fa:	90                   	nop
+     8fb:	eb fd                	jmp    8fa <extendedpipetest+0x2c8>
+    }
+
+    if (strcmp(buf, buf2) != 0) {
+     8fd:	48 8d 55 d2          	lea    -0x2e(%rbp),%rdx
+     901:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     905:	48 89 d6             	mov    %rdx,%rsi
+     908:	48 89 c7             	mov    %rax,%rdi
+     90b:	e8 f9 18 00 00       	call   2209 <strcmp>
+     910:	85 c0                	test   %eax,%eax
+     912:	0f 84 91 00 00 00    	je     9a9 <extendedpipetest+0x377>
+      printf(stdout, "extended pipe test: bad output:\n");
+     918:	8b 05 e2 29 00 00    	mov    0x29e2(%rip),%eax        # 3300 <stdout>
+     91e:	48 8d 15 1b 21 00 00 	lea    0x211b(%rip),%rdx        # 2a40 <malloc+0x38a>
+     925:	48 89 d6             	mov    %rdx,%rsi
+     928:	89 c7                	mov    %eax,%edi
+     92a:	b8 00 00 00 00       	mov    $0x0,%eax
+     92f:	e8 94 15 00 00       	call   1ec8 <printf>
+      printf(stdout, buf2);
+     934:	8b 05 c6 29 00 00    	mov    0x29c6(%rip),%eax        # 3300 <stdout>
+     93a:	48 8d 55 d2          	lea    -0x2e(%rbp),%rdx
+     93e:	48 89 d6             	mov    %rdx,%rsi
+     941:	89 c7                	mov    %eax,%edi
+     943:	b8 00 00 00 00       	mov    $0x0,%eax
+     948:	e8 7b 15 00 00       	call   1ec8 <printf>
+      error("extended pipe test: output test failed");
+     94d:	8b 05 ad 29 00 00    	mov    0x29ad(%rip),%eax        # 3300 <stdout>
+     953:	ba d5 00 00 00       	mov    $0xd5,%edx
+     958:	48 8d 0d df 1e 00 00 	lea    0x1edf(%rip),%rcx        # 283e <malloc+0x188>
+     95f:	48 89 ce             	mov    %rcx,%rsi
+     962:	89 c7                	mov    %eax,%edi
+     964:	b8 00 00 00 00       	mov    $0x0,%eax
+     969:	e8 5a 15 00 00       	call   1ec8 <printf>
+     96e:	8b 05 8c 29 00 00    	mov    0x298c(%rip),%eax        # 3300 <stdout>
+     974:	48 8d 15 ed 20 00 00 	lea    0x20ed(%rip),%rdx        # 2a68 <malloc+0x3b2>
+     97b:	48 89 d6             	mov    %rdx,%rsi
+     97e:	89 c7                	mov    %eax,%edi
+     980:	b8 00 00 00 00       	mov    $0x0,%eax
+     985:	e8 3e 15 00 00       	call   1ec8 <printf>
+     98a:	8b 05 70 29 00 00    	mov    0x2970(%rip),%eax        # 3300 <stdout>
+     990:	48 8d 15 ef 1e 00 00 	lea    0x1eef(%rip),%rdx        # 2886 <malloc+0x1d0>
+     997:	48 89 d6             	mov    %rdx,%rsi
+     99a:	89 c7                	mov    %eax,%edi
+     99c:	b8 00 00 00 00       	mov    $0x0,%eax
+     9a1:	e8 22 15 00 00       	call   1ec8 <printf>
+     9a6:	90                   	nop
+     9a7:	eb fd                	jmp    9a6 <extendedpipetest+0x374>
+    }
+    close(fds[0]);
+     9a9:	8b 45 e0             	mov    -0x20(%rbp),%eax
+     9ac:	89 c7                	mov    %eax,%edi
+     9ae:	e8 e4 1a 00 00       	call   2497 <close>
+  } else {
+    error("extended pipe test: fork() failed\n");
+  }
+
+  // write return -1 when read-end is closed
+  if (pipe(fds) != 0) {
+     9b3:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+     9b7:	48 89 c7             	mov    %rax,%rdi
+     9ba:	e8 c0 1a 00 00       	call   247f <pipe>
+     9bf:	85 c0                	test   %eax,%eax
+     9c1:	0f 84 ba 00 00 00    	je     a81 <extendedpipetest+0x44f>
+     9c7:	eb 5c                	jmp    a25 <extendedpipetest+0x3f3>
+    error("extended pipe test: fork() failed\n");
+     9c9:	8b 05 31 29 00 00    	mov    0x2931(%rip),%eax        # 3300 <stdout>
+     9cf:	ba d9 00 00 00       	mov    $0xd9,%edx
+     9d4:	48 8d 0d 63 1e 00 00 	lea    0x1e63(%rip),%rcx        # 283e <malloc+0x188>
+     9db:	48 89 ce             	mov    %rcx,%rsi
+     9de:	89 c7                	mov    %eax,%edi
+     9e0:	b8 00 00 00 00       	mov    $0x0,%eax
+     9e5:	e8 de 14 00 00       	call   1ec8 <printf>
+     9ea:	8b 05 10 29 00 00    	mov    0x2910(%rip),%eax        # 3300 <stdout>
+     9f0:	48 8d 15 99 20 00 00 	lea    0x2099(%rip),%rdx        # 2a90 <malloc+0x3da>
+     9f7:	48 89 d6             	mov    %rdx,%rsi
+     9fa:	89 c7                	mov    %eax,%edi
+     9fc:	b8 00 00 00 00       	mov    $0x0,%eax
+     a01:	e8 c2 14 00 00       	call   1ec8 <printf>
+     a06:	8b 05 f4 28 00 00    	mov    0x28f4(%rip),%eax        # 3300 <stdout>
+     a0c:	48 8d 15 73 1e 00 00 	lea    0x1e73(%rip),%rdx        # 2886 <malloc+0x1d0>
+     a13:	48 89 d6             	mov    %rdx,%rsi
+     a16:	89 c7                	mov    %eax,%edi
+     a18:	b8 00 00 00 00       	mov    $0x0,%eax
+     a1d:	e8 a6 14 00 00       	call   1ec8 <printf>
+     a22:	90                   	nop
+     a23:	eb fd                	jmp    a22 <extendedpipetest+0x3f0>
+    error("extended pipe test: pipe() failed\n");
+     a25:	8b 05 d5 28 00 00    	mov    0x28d5(%rip),%eax        # 3300 <stdout>
+     a2b:	ba de 00 00 00       	mov    $0xde,%edx
+     a30:	48 8d 0d 07 1e 00 00 	lea    0x1e07(%rip),%rcx        # 283e <malloc+0x188>
+     a37:	48 89 ce             	mov    %rcx,%rsi
+     a3a:	89 c7                	mov    %eax,%edi
+     a3c:	b8 00 00 00 00       	mov    $0x0,%eax
+     a41:	e8 82 14 00 00       	call   1ec8 <printf>
+     a46:	8b 05 b4 28 00 00    	mov    0x28b4(%rip),%eax        # 3300 <stdout>
+     a4c:	48 8d 15 2d 1f 00 00 	lea    0x1f2d(%rip),%rdx        # 2980 <malloc+0x2ca>
+     a53:	48 89 d6             	mov    %rdx,%rsi
+     a56:	89 c7                	mov    %eax,%edi
+     a58:	b8 00 00 00 00       	mov    $0x0,%eax
+     a5d:	e8 66 14 00 00       	call   1ec8 <printf>
+     a62:	8b 05 98 28 00 00    	mov    0x2898(%rip),%eax        # 3300 <stdout>
+     a68:	48 8d 15 17 1e 00 00 	lea    0x1e17(%rip),%rdx        # 2886 <malloc+0x1d0>
+     a6f:	48 89 d6             	mov    %rdx,%rsi
+     a72:	89 c7                	mov    %eax,%edi
+     a74:	b8 00 00 00 00       	mov    $0x0,%eax
+     a79:	e8 4a 14 00 00       	call   1ec8 <printf>
+     a7e:	90                   	nop
+     a7f:	eb fd                	jmp    a7e <extendedpipetest+0x44c>
+  }
+  if (write(fds[1], buf, 14) != 14) {
+     a81:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+     a84:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+     a88:	ba 0e 00 00 00       	mov    $0xe,%edx
+     a8d:	48 89 ce             	mov    %rcx,%rsi
+     a90:	89 c7                	mov    %eax,%edi
+     a92:	e8 f8 19 00 00       	call   248f <write>
+     a97:	83 f8 0e             	cmp    $0xe,%eax
+     a9a:	74 5c                	je     af8 <extendedpipetest+0x4c6>
+      error("extended pipe test: oops 1\n");
+     a9c:	8b 05 5e 28 00 00    	mov    0x285e(%rip),%eax        # 3300 <stdout>
+     aa2:	ba e1 00 00 00       	mov    $0xe1,%edx
+     aa7:	48 8d 0d 90 1d 00 00 	lea    0x1d90(%rip),%rcx        # 283e <malloc+0x188>
+     aae:	48 89 ce             	mov    %rcx,%rsi
+     ab1:	89 c7                	mov    %eax,%edi
+     ab3:	b8 00 00 00 00       	mov    $0x0,%eax
+     ab8:	e8 0b 14 00 00       	call   1ec8 <printf>
+     abd:	8b 05 3d 28 00 00    	mov    0x283d(%rip),%eax        # 3300 <stdout>
+     ac3:	48 8d 15 d9 1e 00 00 	lea    0x1ed9(%rip),%rdx        # 29a3 <malloc+0x2ed>
+     aca:	48 89 d6             	mov    %rdx,%rsi
+     acd:	89 c7                	mov    %eax,%edi
+     acf:	b8 00 00 00 00       	mov    $0x0,%eax
+     ad4:	e8 ef 13 00 00       	call   1ec8 <printf>
+     ad9:	8b 05 21 28 00 00    	mov    0x2821(%rip),%eax        # 3300 <stdout>
+     adf:	48 8d 15 a0 1d 00 00 	lea    0x1da0(%rip),%rdx        # 2886 <malloc+0x1d0>
+     ae6:	48 89 d6             	mov    %rdx,%rsi
+     ae9:	89 c7                	mov    %eax,%edi
+     aeb:	b8 00 00 00 00       	mov    $0x0,%eax
+     af0:	e8 d3 13 00 00       	call   1ec8 <printf>
+     af5:	90                   	nop
+     af6:	eb fd                	jmp    af5 <extendedpipetest+0x4c3>
+    }
+  close(fds[0]);
+     af8:	8b 45 e0             	mov    -0x20(%rbp),%eax
+     afb:	89 c7                	mov    %eax,%edi
+     afd:	e8 95 19 00 00       	call   2497 <close>
+  if (write(fds[1], buf, 14) != -1) {
+     b02:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+     b05:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+     b09:	ba 0e 00 00 00       	mov    $0xe,%edx
+     b0e:	48 89 ce             	mov    %rcx,%rsi
+     b11:	89 c7                	mov    %eax,%edi
+     b13:	e8 77 19 00 00       	call   248f <write>
+     b18:	83 f8 ff             	cmp    $0xffffffff,%eax
+     b1b:	74 5c                	je     b79 <extendedpipetest+0x547>
+    error("extended pipe test: not returning -1 when read-end is closed\n");
+     b1d:	8b 05 dd 27 00 00    	mov    0x27dd(%rip),%eax        # 3300 <stdout>
+     b23:	ba e5 00 00 00       	mov    $0xe5,%edx
+     b28:	48 8d 0d 0f 1d 00 00 	lea    0x1d0f(%rip),%rcx        # 283e <malloc+0x188>
+     b2f:	48 89 ce             	mov    %rcx,%rsi
+     b32:	89 c7                	mov    %eax,%edi
+     b34:	b8 00 00 00 00       	mov    $0x0,%eax
+     b39:	e8 8a 13 00 00       	call   1ec8 <printf>
+     b3e:	8b 05 bc 27 00 00    	mov    0x27bc(%rip),%eax        # 3300 <stdout>
+     b44:	48 8d 15 6d 1f 00 00 	lea    0x1f6d(%rip),%rdx        # 2ab8 <malloc+0x402>
+     b4b:	48 89 d6             	mov    %rdx,%rsi
+     b4e:	89 c7                	mov    %eax,%edi
+     b50:	b8 00 00 00 00       	mov    $0x0,%eax
+     b55:	e8 6e 13 00 00       	call   1ec8 <printf>
+     b5a:	8b 05 a0 27 00 00    	mov    0x27a0(%rip),%eax        # 3300 <stdout>
+     b60:	48 8d 15 1f 1d 00 00 	lea    0x1d1f(%rip),%rdx        # 2886 <malloc+0x1d0>
+     b67:	48 89 d6             	mov    %rdx,%rsi
+     b6a:	89 c7                	mov    %eax,%edi
+     b6c:	b8 00 00 00 00       	mov    $0x0,%eax
+     b71:	e8 52 13 00 00       	call   1ec8 <printf>
+     b76:	90                   	nop
+     b77:	eb fd                	jmp    b76 <extendedpipetest+0x544>
+  }
+  close(fds[1]);
+     b79:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+     b7c:	89 c7                	mov    %eax,%edi
+     b7e:	e8 14 19 00 00       	call   2497 <close>
+
+  printf(stdout, "extendedpipetest: ok\n");
+     b83:	8b 05 77 27 00 00    	mov    0x2777(%rip),%eax        # 3300 <stdout>
+     b89:	48 8d 15 66 1f 00 00 	lea    0x1f66(%rip),%rdx        # 2af6 <malloc+0x440>
+     b90:	48 89 d6             	mov    %rdx,%rsi
+     b93:	89 c7                	mov    %eax,%edi
+     b95:	b8 00 00 00 00       	mov    $0x0,%eax
+     b9a:	e8 29 13 00 00       	call   1ec8 <printf>
+}
+     b9f:	90                   	nop
+     ba0:	c9                   	leave
+     ba1:	c3                   	ret
+
+0000000000000ba2 <pkilltest>:
+
+void pkilltest(void) {
+     ba2:	55                   	push   %rbp
+     ba3:	48 89 e5             	mov    %rsp,%rbp
+     ba6:	48 83 ec 20          	sub    $0x20,%rsp
+  char buf[11];
+
+  int pid1, pid2, pid3;
+  int pfds[2];
+
+  printf(1, "preempt: ");
+     baa:	48 8d 05 5b 1f 00 00 	lea    0x1f5b(%rip),%rax        # 2b0c <malloc+0x456>
+     bb1:	48 89 c6             	mov    %rax,%rsi
+     bb4:	bf 01 00 00 00       	mov    $0x1,%edi
+     bb9:	b8 00 00 00 00       	mov    $0x0,%eax
+     bbe:	e8 05 13 00 00       	call   1ec8 <printf>
+  pid1 = fork();
+     bc3:	e8 9f 18 00 00       	call   2467 <fork>
+     bc8:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  if (pid1 == 0)
+     bcb:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     bcf:	75 03                	jne    bd4 <pkilltest+0x32>
+    for (;;)
+     bd1:	90                   	nop
+     bd2:	eb fd                	jmp    bd1 <pkilltest+0x2f>
+      ;
+
+  pid2 = fork();
+     bd4:	e8 8e 18 00 00       	call   2467 <fork>
+     bd9:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  if (pid2 == 0)
+     bdc:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+     be0:	75 03                	jne    be5 <pkilltest+0x43>
+    for (;;)
+     be2:	90                   	nop
+     be3:	eb fd                	jmp    be2 <pkilltest+0x40>
+      ;
+
+  pipe(pfds);
+     be5:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+     be9:	48 89 c7             	mov    %rax,%rdi
+     bec:	e8 8e 18 00 00       	call   247f <pipe>
+  pid3 = fork();
+     bf1:	e8 71 18 00 00       	call   2467 <fork>
+     bf6:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  if (pid3 == 0) {
+     bf9:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+     bfd:	0f 85 91 00 00 00    	jne    c94 <pkilltest+0xf2>
+    close(pfds[0]);
+     c03:	8b 45 e0             	mov    -0x20(%rbp),%eax
+     c06:	89 c7                	mov    %eax,%edi
+     c08:	e8 8a 18 00 00       	call   2497 <close>
+    if (write(pfds[1], "x", 1) != 1)
+     c0d:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+     c10:	ba 01 00 00 00       	mov    $0x1,%edx
+     c15:	48 8d 0d fa 1e 00 00 	lea    0x1efa(%rip),%rcx        # 2b16 <malloc+0x460>
+     c1c:	48 89 ce             	mov    %rcx,%rsi
+     c1f:	89 c7                	mov    %eax,%edi
+     c21:	e8 69 18 00 00       	call   248f <write>
+     c26:	83 f8 01             	cmp    $0x1,%eax
+     c29:	74 5c                	je     c87 <pkilltest+0xe5>
+      error("pkilltest: write error");
+     c2b:	8b 05 cf 26 00 00    	mov    0x26cf(%rip),%eax        # 3300 <stdout>
+     c31:	ba 02 01 00 00       	mov    $0x102,%edx
+     c36:	48 8d 0d 01 1c 00 00 	lea    0x1c01(%rip),%rcx        # 283e <malloc+0x188>
+     c3d:	48 89 ce             	mov    %rcx,%rsi
+     c40:	89 c7                	mov    %eax,%edi
+     c42:	b8 00 00 00 00       	mov    $0x0,%eax
+     c47:	e8 7c 12 00 00       	call   1ec8 <printf>
+     c4c:	8b 05 ae 26 00 00    	mov    0x26ae(%rip),%eax        # 3300 <stdout>
+     c52:	48 8d 15 bf 1e 00 00 	lea    0x1ebf(%rip),%rdx        # 2b18 <malloc+0x462>
+     c59:	48 89 d6             	mov    %rdx,%rsi
+     c5c:	89 c7                	mov    %eax,%edi
+     c5e:	b8 00 00 00 00       	mov    $0x0,%eax
+     c63:	e8 60 12 00 00       	call   1ec8 <printf>
+     c68:	8b 05 92 26 00 00    	mov    0x2692(%rip),%eax        # 3300 <stdout>
+     c6e:	48 8d 15 11 1c 00 00 	lea    0x1c11(%rip),%rdx        # 2886 <malloc+0x1d0>
+     c75:	48 89 d6             	mov    %rdx,%rsi
+     c78:	89 c7                	mov    %eax,%edi
+     c7a:	b8 00 00 00 00       	mov    $0x0,%eax
+     c7f:	e8 44 12 00 00       	call   1ec8 <printf>
+     c84:	90                   	nop
+     c85:	eb fd                	jmp    c84 <pkilltest+0xe2>
+    close(pfds[1]);
+     c87:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+     c8a:	89 c7                	mov    %eax,%edi
+     c8c:	e8 06 18 00 00       	call   2497 <close>
+    for (;;)
+     c91:	90                   	nop
+     c92:	eb fd                	jmp    c91 <pkilltest+0xef>
+      ;
+  }
+
+  close(pfds[1]);
+     c94:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+     c97:	89 c7                	mov    %eax,%edi
+     c99:	e8 f9 17 00 00       	call   2497 <close>
+  if (read(pfds[0], buf, sizeof(buf)) != 1) {
+     c9e:	8b 45 e0             	mov    -0x20(%rbp),%eax
+     ca1:	48 8d 4d e9          	lea    -0x17(%rbp),%rcx
+     ca5:	ba 0b 00 00 00       	mov    $0xb,%edx
+     caa:	48 89 ce             	mov    %rcx,%rsi
+     cad:	89 c7                	mov    %eax,%edi
+     caf:	e8 d3 17 00 00       	call   2487 <read>
+     cb4:	83 f8 01             	cmp    $0x1,%eax
+     cb7:	74 5c                	je     d15 <pkilltest+0x173>
+    error("pkilltest: read error");
+     cb9:	8b 05 41 26 00 00    	mov    0x2641(%rip),%eax        # 3300 <stdout>
+     cbf:	ba 0a 01 00 00       	mov    $0x10a,%edx
+     cc4:	48 8d 0d 73 1b 00 00 	lea    0x1b73(%rip),%rcx        # 283e <malloc+0x188>
+     ccb:	48 89 ce             	mov    %rcx,%rsi
+     cce:	89 c7                	mov    %eax,%edi
+     cd0:	b8 00 00 00 00       	mov    $0x0,%eax
+     cd5:	e8 ee 11 00 00       	call   1ec8 <printf>
+     cda:	8b 05 20 26 00 00    	mov    0x2620(%rip),%eax        # 3300 <stdout>
+     ce0:	48 8d 15 48 1e 00 00 	lea    0x1e48(%rip),%rdx        # 2b2f <malloc+0x479>
+     ce7:	48 89 d6             	mov    %rdx,%rsi
+     cea:	89 c7                	mov    %eax,%edi
+     cec:	b8 00 00 00 00       	mov    $0x0,%eax
+     cf1:	e8 d2 11 00 00       	call   1ec8 <printf>
+     cf6:	8b 05 04 26 00 00    	mov    0x2604(%rip),%eax        # 3300 <stdout>
+     cfc:	48 8d 15 83 1b 00 00 	lea    0x1b83(%rip),%rdx        # 2886 <malloc+0x1d0>
+     d03:	48 89 d6             	mov    %rdx,%rsi
+     d06:	89 c7                	mov    %eax,%edi
+     d08:	b8 00 00 00 00       	mov    $0x0,%eax
+     d0d:	e8 b6 11 00 00       	call   1ec8 <printf>
+     d12:	90                   	nop
+     d13:	eb fd                	jmp    d12 <pkilltest+0x170>
+  }
+  close(pfds[0]);
+     d15:	8b 45 e0             	mov    -0x20(%rbp),%eax
+     d18:	89 c7                	mov    %eax,%edi
+     d1a:	e8 78 17 00 00       	call   2497 <close>
+  printf(1, "kill... ");
+     d1f:	48 8d 05 1f 1e 00 00 	lea    0x1e1f(%rip),%rax        # 2b45 <malloc+0x48f>
+     d26:	48 89 c6             	mov    %rax,%rsi
+     d29:	bf 01 00 00 00       	mov    $0x1,%edi
+     d2e:	b8 00 00 00 00       	mov    $0x0,%eax
+     d33:	e8 90 11 00 00       	call   1ec8 <printf>
+  kill(pid1);
+     d38:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     d3b:	89 c7                	mov    %eax,%edi
+     d3d:	e8 5d 17 00 00       	call   249f <kill>
+  kill(pid2);
+     d42:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     d45:	89 c7                	mov    %eax,%edi
+     d47:	e8 53 17 00 00       	call   249f <kill>
+  kill(pid3);
+     d4c:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     d4f:	89 c7                	mov    %eax,%edi
+     d51:	e8 49 17 00 00       	call   249f <kill>
+  printf(1, "wait... ");
+     d56:	48 8d 05 f1 1d 00 00 	lea    0x1df1(%rip),%rax        # 2b4e <malloc+0x498>
+     d5d:	48 89 c6             	mov    %rax,%rsi
+     d60:	bf 01 00 00 00       	mov    $0x1,%edi
+     d65:	b8 00 00 00 00       	mov    $0x0,%eax
+     d6a:	e8 59 11 00 00       	call   1ec8 <printf>
+  wait();
+     d6f:	e8 03 17 00 00       	call   2477 <wait>
+  wait();
+     d74:	e8 fe 16 00 00       	call   2477 <wait>
+  wait();
+     d79:	e8 f9 16 00 00       	call   2477 <wait>
+  printf(1, "pkilltest: ok\n");
+     d7e:	48 8d 05 d2 1d 00 00 	lea    0x1dd2(%rip),%rax        # 2b57 <malloc+0x4a1>
+     d85:	48 89 c6             	mov    %rax,%rsi
+     d88:	bf 01 00 00 00       	mov    $0x1,%edi
+     d8d:	b8 00 00 00 00       	mov    $0x0,%eax
+     d92:	e8 31 11 00 00       	call   1ec8 <printf>
+}
+     d97:	90                   	nop
+     d98:	c9                   	leave
+     d99:	c3                   	ret
+
+0000000000000d9a <racetest>:
+
+void racetest(void) {
+     d9a:	55                   	push   %rbp
+     d9b:	48 89 e5             	mov    %rsp,%rbp
+     d9e:	48 83 ec 10          	sub    $0x10,%rsp
+  int i, pid;
+
+  for (i = 0; i < 100; i++) {
+     da2:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     da9:	e9 df 00 00 00       	jmp    e8d <racetest+0xf3>
+    pid = fork();
+     dae:	e8 b4 16 00 00       	call   2467 <fork>
+     db3:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    if (pid < 0) {
+     db6:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+     dba:	79 5c                	jns    e18 <racetest+0x7e>
+      error("racetest: fork failed\n");
+     dbc:	8b 05 3e 25 00 00    	mov    0x253e(%rip),%eax        # 3300 <stdout>
+     dc2:	ba 1e 01 00 00       	mov    $0x11e,%edx
+     dc7:	48 8d 0d 70 1a 00 00 	lea    0x1a70(%rip),%rcx        # 283e <malloc+0x188>
+     dce:	48 89 ce             	mov    %rcx,%rsi
+     dd1:	89 c7                	mov    %eax,%edi
+     dd3:	b8 00 00 00 00       	mov    $0x0,%eax
+     dd8:	e8 eb 10 00 00       	call   1ec8 <printf>
+     ddd:	8b 05 1d 25 00 00    	mov    0x251d(%rip),%eax        # 3300 <stdout>
+     de3:	48 8d 15 7c 1d 00 00 	lea    0x1d7c(%rip),%rdx        # 2b66 <malloc+0x4b0>
+     dea:	48 89 d6             	mov    %rdx,%rsi
+     ded:	89 c7                	mov    %eax,%edi
+     def:	b8 00 00 00 00       	mov    $0x0,%eax
+     df4:	e8 cf 10 00 00       	call   1ec8 <printf>
+     df9:	8b 05 01 25 00 00    	mov    0x2501(%rip),%eax        # 3300 <stdout>
+     dff:	48 8d 15 80 1a 00 00 	lea    0x1a80(%rip),%rdx        # 2886 <malloc+0x1d0>
+     e06:	48 89 d6             	mov    %rdx,%rsi
+     e09:	89 c7                	mov    %eax,%edi
+     e0b:	b8 00 00 00 00       	mov    $0x0,%eax
+     e10:	e8 b3 10 00 00       	call   1ec8 <printf>
+     e15:	90                   	nop
+     e16:	eb fd                	jmp    e15 <racetest+0x7b>
+    }
+    if (pid) {
+     e18:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+     e1c:	74 66                	je     e84 <racetest+0xea>
+      if (wait() != pid) {
+     e1e:	e8 54 16 00 00       	call   2477 <wait>
+     e23:	39 45 f8             	cmp    %eax,-0x8(%rbp)
+     e26:	74 61                	je     e89 <racetest+0xef>
+        error("racetest: wait wrong pid\n");
+     e28:	8b 05 d2 24 00 00    	mov    0x24d2(%rip),%eax        # 3300 <stdout>
+     e2e:	ba 22 01 00 00       	mov    $0x122,%edx
+     e33:	48 8d 0d 04 1a 00 00 	lea    0x1a04(%rip),%rcx        # 283e <malloc+0x188>
+     e3a:	48 89 ce             	mov    %rcx,%rsi
+     e3d:	89 c7                	mov    %eax,%edi
+     e3f:	b8 00 00 00 00       	mov    $0x0,%eax
+     e44:	e8 7f 10 00 00       	call   1ec8 <printf>
+     e49:	8b 05 b1 24 00 00    	mov    0x24b1(%rip),%eax        # 3300 <stdout>
+     e4f:	48 8d 15 27 1d 00 00 	lea    0x1d27(%rip),%rdx        # 2b7d <malloc+0x4c7>
+     e56:	48 89 d6             	mov    %rdx,%rsi
+     e59:	89 c7                	mov    %eax,%edi
+     e5b:	b8 00 00 00 00       	mov    $0x0,%eax
+     e60:	e8 63 10 00 00       	call   1ec8 <printf>
+     e65:	8b 05 95 24 00 00    	mov    0x2495(%rip),%eax        # 3300 <stdout>
+     e6b:	48 8d 15 14 1a 00 00 	lea    0x1a14(%rip),%rdx        # 2886 <malloc+0x1d0>
+     e72:	48 89 d6             	mov    %rdx,%rsi
+     e75:	89 c7                	mov    %eax,%edi
+     e77:	b8 00 00 00 00       	mov    $0x0,%eax
+     e7c:	e8 47 10 00 00       	call   1ec8 <printf>
+     e81:	90                   	nop
+     e82:	eb fd                	jmp    e81 <racetest+0xe7>
+      }
+    } else {
+      exit();
+     e84:	e8 e6 15 00 00       	call   246f <exit>
+  for (i = 0; i < 100; i++) {
+     e89:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     e8d:	83 7d fc 63          	cmpl   $0x63,-0x4(%rbp)
+     e91:	0f 8e 17 ff ff ff    	jle    dae <racetest+0x14>
+    }
+  }
+  printf(1, "racetest: ok\n");
+     e97:	48 8d 05 f9 1c 00 00 	lea    0x1cf9(%rip),%rax        # 2b97 <malloc+0x4e1>
+     e9e:	48 89 c6             	mov    %rax,%rsi
+     ea1:	bf 01 00 00 00       	mov    $0x1,%edi
+     ea6:	b8 00 00 00 00       	mov    $0x0,%eax
+     eab:	e8 18 10 00 00       	call   1ec8 <printf>
+}
+     eb0:	90                   	nop
+     eb1:	c9                   	leave
+     eb2:	c3                   	ret
+
+0000000000000eb3 <fdesctest>:
+
+void fdesctest(void) {
+     eb3:	55                   	push   %rbp
+     eb4:	48 89 e5             	mov    %rsp,%rbp
+     eb7:	48 83 ec 10          	sub    $0x10,%rsp
+  printf(1, "fdesctest\n");
+     ebb:	48 8d 05 e3 1c 00 00 	lea    0x1ce3(%rip),%rax        # 2ba5 <malloc+0x4ef>
+     ec2:	48 89 c6             	mov    %rax,%rsi
+     ec5:	bf 01 00 00 00       	mov    $0x1,%edi
+     eca:	b8 00 00 00 00       	mov    $0x0,%eax
+     ecf:	e8 f4 0f 00 00       	call   1ec8 <printf>
+  int fd1;
+  char buf[11] = {0};
+     ed4:	48 c7 45 f1 00 00 00 	movq   $0x0,-0xf(%rbp)
+     edb:	00 
+     edc:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+  // Make sure offsets are shared
+  assert((fd1 = open("l2_share.txt", O_RDONLY)) > -1);
+     ee3:	be 00 00 00 00       	mov    $0x0,%esi
+     ee8:	48 8d 05 c1 1c 00 00 	lea    0x1cc1(%rip),%rax        # 2bb0 <malloc+0x4fa>
+     eef:	48 89 c7             	mov    %rax,%rdi
+     ef2:	e8 b8 15 00 00       	call   24af <open>
+     ef7:	89 45 fc             	mov    %eax,-0x4(%rbp)
+     efa:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     efe:	79 2b                	jns    f2b <fdesctest+0x78>
+     f00:	8b 05 fa 23 00 00    	mov    0x23fa(%rip),%eax        # 3300 <stdout>
+     f06:	48 8d 15 b3 1c 00 00 	lea    0x1cb3(%rip),%rdx        # 2bc0 <malloc+0x50a>
+     f0d:	48 89 d1             	mov    %rdx,%rcx
+     f10:	ba 31 01 00 00       	mov    $0x131,%edx
+     f15:	48 8d 35 d4 1c 00 00 	lea    0x1cd4(%rip),%rsi        # 2bf0 <malloc+0x53a>
+     f1c:	89 c7                	mov    %eax,%edi
+     f1e:	b8 00 00 00 00       	mov    $0x0,%eax
+     f23:	e8 a0 0f 00 00       	call   1ec8 <printf>
+     f28:	90                   	nop
+     f29:	eb fd                	jmp    f28 <fdesctest+0x75>
+
+  if (!fork()) {
+     f2b:	e8 37 15 00 00       	call   2467 <fork>
+     f30:	85 c0                	test   %eax,%eax
+     f32:	0f 85 f6 00 00 00    	jne    102e <fdesctest+0x17b>
+    if (read(fd1, buf, 10) != 10)
+     f38:	48 8d 4d f1          	lea    -0xf(%rbp),%rcx
+     f3c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     f3f:	ba 0a 00 00 00       	mov    $0xa,%edx
+     f44:	48 89 ce             	mov    %rcx,%rsi
+     f47:	89 c7                	mov    %eax,%edi
+     f49:	e8 39 15 00 00       	call   2487 <read>
+     f4e:	83 f8 0a             	cmp    $0xa,%eax
+     f51:	74 5c                	je     faf <fdesctest+0xfc>
+      error("tried to read 10 bytes from fd1");
+     f53:	8b 05 a7 23 00 00    	mov    0x23a7(%rip),%eax        # 3300 <stdout>
+     f59:	ba 35 01 00 00       	mov    $0x135,%edx
+     f5e:	48 8d 0d d9 18 00 00 	lea    0x18d9(%rip),%rcx        # 283e <malloc+0x188>
+     f65:	48 89 ce             	mov    %rcx,%rsi
+     f68:	89 c7                	mov    %eax,%edi
+     f6a:	b8 00 00 00 00       	mov    $0x0,%eax
+     f6f:	e8 54 0f 00 00       	call   1ec8 <printf>
+     f74:	8b 05 86 23 00 00    	mov    0x2386(%rip),%eax        # 3300 <stdout>
+     f7a:	48 8d 15 8f 1c 00 00 	lea    0x1c8f(%rip),%rdx        # 2c10 <malloc+0x55a>
+     f81:	48 89 d6             	mov    %rdx,%rsi
+     f84:	89 c7                	mov    %eax,%edi
+     f86:	b8 00 00 00 00       	mov    $0x0,%eax
+     f8b:	e8 38 0f 00 00       	call   1ec8 <printf>
+     f90:	8b 05 6a 23 00 00    	mov    0x236a(%rip),%eax        # 3300 <stdout>
+     f96:	48 8d 15 e9 18 00 00 	lea    0x18e9(%rip),%rdx        # 2886 <malloc+0x1d0>
+     f9d:	48 89 d6             	mov    %rdx,%rsi
+     fa0:	89 c7                	mov    %eax,%edi
+     fa2:	b8 00 00 00 00       	mov    $0x0,%eax
+     fa7:	e8 1c 0f 00 00       	call   1ec8 <printf>
+     fac:	90                   	nop
+     fad:	eb fd                	jmp    fac <fdesctest+0xf9>
+
+    if (strcmp("cccccccccc", buf))
+     faf:	48 8d 45 f1          	lea    -0xf(%rbp),%rax
+     fb3:	48 89 c6             	mov    %rax,%rsi
+     fb6:	48 8d 05 73 1c 00 00 	lea    0x1c73(%rip),%rax        # 2c30 <malloc+0x57a>
+     fbd:	48 89 c7             	mov    %rax,%rdi
+     fc0:	e8 44 12 00 00       	call   2209 <strcmp>
+     fc5:	85 c0                	test   %eax,%eax
+     fc7:	74 60                	je     1029 <fdesctest+0x176>
+      error("should have reead 10 c's, instead: '%s'", buf);
+     fc9:	8b 05 31 23 00 00    	mov    0x2331(%rip),%eax        # 3300 <stdout>
+     fcf:	ba 38 01 00 00       	mov    $0x138,%edx
+     fd4:	48 8d 0d 63 18 00 00 	lea    0x1863(%rip),%rcx        # 283e <malloc+0x188>
+     fdb:	48 89 ce             	mov    %rcx,%rsi
+     fde:	89 c7                	mov    %eax,%edi
+     fe0:	b8 00 00 00 00       	mov    $0x0,%eax
+     fe5:	e8 de 0e 00 00       	call   1ec8 <printf>
+     fea:	8b 05 10 23 00 00    	mov    0x2310(%rip),%eax        # 3300 <stdout>
+     ff0:	48 8d 55 f1          	lea    -0xf(%rbp),%rdx
+     ff4:	48 8d 0d 45 1c 00 00 	lea    0x1c45(%rip),%rcx        # 2c40 <malloc+0x58a>
+     ffb:	48 89 ce             	mov    %rcx,%rsi
+     ffe:	89 c7                	mov    %eax,%edi
+    1000:	b8 00 00 00 00       	mov    $0x0,%eax
+    1005:	e8 be 0e 00 00       	call   1ec8 <printf>
+    100a:	8b 05 f0 22 00 00    	mov    0x22f0(%rip),%eax        # 3300 <stdout>
+    1010:	48 8d 15 6f 18 00 00 	lea    0x186f(%rip),%rdx        # 2886 <malloc+0x1d0>
+    1017:	48 89 d6             	mov    %rdx,%rsi
+    101a:	89 c7                	mov    %eax,%edi
+    101c:	b8 00 00 00 00       	mov    $0x0,%eax
+    1021:	e8 a2 0e 00 00       	call   1ec8 <printf>
+    1026:	90                   	nop
+    1027:	eb fd                	jmp    1026 <fdesctest+0x173>
+    exit();
+    1029:	e8 41 14 00 00       	call   246f <exit>
+  } else {
+    wait();
+    102e:	e8 44 14 00 00       	call   2477 <wait>
+  }
+
+  if (read(fd1, buf, 10) != 10)
+    1033:	48 8d 4d f1          	lea    -0xf(%rbp),%rcx
+    1037:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    103a:	ba 0a 00 00 00       	mov    $0xa,%edx
+    103f:	48 89 ce             	mov    %rcx,%rsi
+    1042:	89 c7                	mov    %eax,%edi
+    1044:	e8 3e 14 00 00       	call   2487 <read>
+    1049:	83 f8 0a             	cmp    $0xa,%eax
+    104c:	74 5c                	je     10aa <fdesctest+0x1f7>
+    error("tried to read 10 bytes from fd1");
+    104e:	8b 05 ac 22 00 00    	mov    0x22ac(%rip),%eax        # 3300 <stdout>
+    1054:	ba 3f 01 00 00       	mov    $0x13f,%edx
+    1059:	48 8d 0d de 17 00 00 	lea    0x17de(%rip),%rcx        # 283e <malloc+0x188>
+    1060:	48 89 ce             	mov    %rcx,%rsi
+    1063:	89 c7                	mov    %eax,%edi
+    1065:	b8 00 00 00 00       	mov    $0x0,%eax
+    106a:	e8 59 0e 00 00       	call   1ec8 <printf>
+    106f:	8b 05 8b 22 00 00    	mov    0x228b(%rip),%eax        # 3300 <stdout>
+    1075:	48 8d 15 94 1b 00 00 	lea    0x1b94(%rip),%rdx        # 2c10 <malloc+0x55a>
+    107c:	48 89 d6             	mov    %rdx,%rsi
+    107f:	89 c7                	mov    %eax,%edi
+    1081:	b8 00 00 00 00       	mov    $0x0,%eax
+    1086:	e8 3d 0e 00 00       	call   1ec8 <printf>
+    108b:	8b 05 6f 22 00 00    	mov    0x226f(%rip),%eax        # 3300 <stdout>
+    1091:	48 8d 15 ee 17 00 00 	lea    0x17ee(%rip),%rdx        # 2886 <malloc+0x1d0>
+    1098:	48 89 d6             	mov    %rdx,%rsi
+    109b:	89 c7                	mov    %eax,%edi
+    109d:	b8 00 00 00 00       	mov    $0x0,%eax
+    10a2:	e8 21 0e 00 00       	call   1ec8 <printf>
+    10a7:	90                   	nop
+    10a8:	eb fd                	jmp    10a7 <fdesctest+0x1f4>
+
+  if (strcmp("ppppppppp\n", buf))
+    10aa:	48 8d 45 f1          	lea    -0xf(%rbp),%rax
+    10ae:	48 89 c6             	mov    %rax,%rsi
+    10b1:	48 8d 05 b0 1b 00 00 	lea    0x1bb0(%rip),%rax        # 2c68 <malloc+0x5b2>
+    10b8:	48 89 c7             	mov    %rax,%rdi
+    10bb:	e8 49 11 00 00       	call   2209 <strcmp>
+    10c0:	85 c0                	test   %eax,%eax
+    10c2:	74 60                	je     1124 <fdesctest+0x271>
+    error("should have reead 9 p's (and a newline), instead: '%s'", buf);
+    10c4:	8b 05 36 22 00 00    	mov    0x2236(%rip),%eax        # 3300 <stdout>
+    10ca:	ba 42 01 00 00       	mov    $0x142,%edx
+    10cf:	48 8d 0d 68 17 00 00 	lea    0x1768(%rip),%rcx        # 283e <malloc+0x188>
+    10d6:	48 89 ce             	mov    %rcx,%rsi
+    10d9:	89 c7                	mov    %eax,%edi
+    10db:	b8 00 00 00 00       	mov    $0x0,%eax
+    10e0:	e8 e3 0d 00 00       	call   1ec8 <printf>
+    10e5:	8b 05 15 22 00 00    	mov    0x2215(%rip),%eax        # 3300 <stdout>
+    10eb:	48 8d 55 f1          	lea    -0xf(%rbp),%rdx
+    10ef:	48 8d 0d 82 1b 00 00 	lea    0x1b82(%rip),%rcx        # 2c78 <malloc+0x5c2>
+    10f6:	48 89 ce             	mov    %rcx,%rsi
+    10f9:	89 c7                	mov    %eax,%edi
+    10fb:	b8 00 00 00 00       	mov    $0x0,%eax
+    1100:	e8 c3 0d 00 00       	call   1ec8 <printf>
+    1105:	8b 05 f5 21 00 00    	mov    0x21f5(%rip),%eax        # 3300 <stdout>
+    110b:	48 8d 15 74 17 00 00 	lea    0x1774(%rip),%rdx        # 2886 <malloc+0x1d0>
+    1112:	48 89 d6             	mov    %rdx,%rsi
+    1115:	89 c7                	mov    %eax,%edi
+    1117:	b8 00 00 00 00       	mov    $0x0,%eax
+    111c:	e8 a7 0d 00 00       	call   1ec8 <printf>
+    1121:	90                   	nop
+    1122:	eb fd                	jmp    1121 <fdesctest+0x26e>
+
+  close(fd1);
+    1124:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1127:	89 c7                	mov    %eax,%edi
+    1129:	e8 69 13 00 00       	call   2497 <close>
+
+  // Make sure the correct file descriptor ints are maintained
+
+  assert(open("l2_share.txt", O_RDONLY) > -1);
+    112e:	be 00 00 00 00       	mov    $0x0,%esi
+    1133:	48 8d 05 76 1a 00 00 	lea    0x1a76(%rip),%rax        # 2bb0 <malloc+0x4fa>
+    113a:	48 89 c7             	mov    %rax,%rdi
+    113d:	e8 6d 13 00 00       	call   24af <open>
+    1142:	85 c0                	test   %eax,%eax
+    1144:	79 2b                	jns    1171 <fdesctest+0x2be>
+    1146:	8b 05 b4 21 00 00    	mov    0x21b4(%rip),%eax        # 3300 <stdout>
+    114c:	48 8d 15 5d 1b 00 00 	lea    0x1b5d(%rip),%rdx        # 2cb0 <malloc+0x5fa>
+    1153:	48 89 d1             	mov    %rdx,%rcx
+    1156:	ba 48 01 00 00       	mov    $0x148,%edx
+    115b:	48 8d 35 8e 1a 00 00 	lea    0x1a8e(%rip),%rsi        # 2bf0 <malloc+0x53a>
+    1162:	89 c7                	mov    %eax,%edi
+    1164:	b8 00 00 00 00       	mov    $0x0,%eax
+    1169:	e8 5a 0d 00 00       	call   1ec8 <printf>
+    116e:	90                   	nop
+    116f:	eb fd                	jmp    116e <fdesctest+0x2bb>
+  assert(open("l2_share.txt", O_RDONLY) > -1);
+    1171:	be 00 00 00 00       	mov    $0x0,%esi
+    1176:	48 8d 05 33 1a 00 00 	lea    0x1a33(%rip),%rax        # 2bb0 <malloc+0x4fa>
+    117d:	48 89 c7             	mov    %rax,%rdi
+    1180:	e8 2a 13 00 00       	call   24af <open>
+    1185:	85 c0                	test   %eax,%eax
+    1187:	79 2b                	jns    11b4 <fdesctest+0x301>
+    1189:	8b 05 71 21 00 00    	mov    0x2171(%rip),%eax        # 3300 <stdout>
+    118f:	48 8d 15 1a 1b 00 00 	lea    0x1b1a(%rip),%rdx        # 2cb0 <malloc+0x5fa>
+    1196:	48 89 d1             	mov    %rdx,%rcx
+    1199:	ba 49 01 00 00       	mov    $0x149,%edx
+    119e:	48 8d 35 4b 1a 00 00 	lea    0x1a4b(%rip),%rsi        # 2bf0 <malloc+0x53a>
+    11a5:	89 c7                	mov    %eax,%edi
+    11a7:	b8 00 00 00 00       	mov    $0x0,%eax
+    11ac:	e8 17 0d 00 00       	call   1ec8 <printf>
+    11b1:	90                   	nop
+    11b2:	eb fd                	jmp    11b1 <fdesctest+0x2fe>
+  assert(open("l2_share.txt", O_RDONLY) > -1);
+    11b4:	be 00 00 00 00       	mov    $0x0,%esi
+    11b9:	48 8d 05 f0 19 00 00 	lea    0x19f0(%rip),%rax        # 2bb0 <malloc+0x4fa>
+    11c0:	48 89 c7             	mov    %rax,%rdi
+    11c3:	e8 e7 12 00 00       	call   24af <open>
+    11c8:	85 c0                	test   %eax,%eax
+    11ca:	79 2b                	jns    11f7 <fdesctest+0x344>
+    11cc:	8b 05 2e 21 00 00    	mov    0x212e(%rip),%eax        # 3300 <stdout>
+    11d2:	48 8d 15 d7 1a 00 00 	lea    0x1ad7(%rip),%rdx        # 2cb0 <malloc+0x5fa>
+    11d9:	48 89 d1             	mov    %rdx,%rcx
+    11dc:	ba 4a 01 00 00       	mov    $0x14a,%edx
+    11e1:	48 8d 35 08 1a 00 00 	lea    0x1a08(%rip),%rsi        # 2bf0 <malloc+0x53a>
+    11e8:	89 c7                	mov    %eax,%edi
+    11ea:	b8 00 00 00 00       	mov    $0x0,%eax
+    11ef:	e8 d4 0c 00 00       	call   1ec8 <printf>
+    11f4:	90                   	nop
+    11f5:	eb fd                	jmp    11f4 <fdesctest+0x341>
+  assert(open("l2_share.txt", O_RDONLY) > -1);
+    11f7:	be 00 00 00 00       	mov    $0x0,%esi
+    11fc:	48 8d 05 ad 19 00 00 	lea    0x19ad(%rip),%rax        # 2bb0 <malloc+0x4fa>
+    1203:	48 89 c7             	mov    %rax,%rdi
+    1206:	e8 a4 12 00 00       	call   24af <open>
+    120b:	85 c0                	test   %eax,%eax
+    120d:	79 2b                	jns    123a <fdesctest+0x387>
+    120f:	8b 05 eb 20 00 00    	mov    0x20eb(%rip),%eax        # 3300 <stdout>
+    1215:	48 8d 15 94 1a 00 00 	lea    0x1a94(%rip),%rdx        # 2cb0 <malloc+0x5fa>
+    121c:	48 89 d1             	mov    %rdx,%rcx
+    121f:	ba 4b 01 00 00       	mov    $0x14b,%edx
+    1224:	48 8d 35 c5 19 00 00 	lea    0x19c5(%rip),%rsi        # 2bf0 <malloc+0x53a>
+    122b:	89 c7                	mov    %eax,%edi
+    122d:	b8 00 00 00 00       	mov    $0x0,%eax
+    1232:	e8 91 0c 00 00       	call   1ec8 <printf>
+    1237:	90                   	nop
+    1238:	eb fd                	jmp    1237 <fdesctest+0x384>
+
+  assert(close(4) != -1);
+    123a:	bf 04 00 00 00       	mov    $0x4,%edi
+    123f:	e8 53 12 00 00       	call   2497 <close>
+    1244:	83 f8 ff             	cmp    $0xffffffff,%eax
+    1247:	75 2b                	jne    1274 <fdesctest+0x3c1>
+    1249:	8b 05 b1 20 00 00    	mov    0x20b1(%rip),%eax        # 3300 <stdout>
+    124f:	48 8d 15 7e 1a 00 00 	lea    0x1a7e(%rip),%rdx        # 2cd4 <malloc+0x61e>
+    1256:	48 89 d1             	mov    %rdx,%rcx
+    1259:	ba 4d 01 00 00       	mov    $0x14d,%edx
+    125e:	48 8d 35 8b 19 00 00 	lea    0x198b(%rip),%rsi        # 2bf0 <malloc+0x53a>
+    1265:	89 c7                	mov    %eax,%edi
+    1267:	b8 00 00 00 00       	mov    $0x0,%eax
+    126c:	e8 57 0c 00 00       	call   1ec8 <printf>
+    1271:	90                   	nop
+    1272:	eb fd                	jmp    1271 <fdesctest+0x3be>
+  assert(close(5) != -1);
+    1274:	bf 05 00 00 00       	mov    $0x5,%edi
+    1279:	e8 19 12 00 00       	call   2497 <close>
+    127e:	83 f8 ff             	cmp    $0xffffffff,%eax
+    1281:	75 2b                	jne    12ae <fdesctest+0x3fb>
+    1283:	8b 05 77 20 00 00    	mov    0x2077(%rip),%eax        # 3300 <stdout>
+    1289:	48 8d 15 53 1a 00 00 	lea    0x1a53(%rip),%rdx        # 2ce3 <malloc+0x62d>
+    1290:	48 89 d1             	mov    %rdx,%rcx
+    1293:	ba 4e 01 00 00       	mov    $0x14e,%edx
+    1298:	48 8d 35 51 19 00 00 	lea    0x1951(%rip),%rsi        # 2bf0 <malloc+0x53a>
+    129f:	89 c7                	mov    %eax,%edi
+    12a1:	b8 00 00 00 00       	mov    $0x0,%eax
+    12a6:	e8 1d 0c 00 00       	call   1ec8 <printf>
+    12ab:	90                   	nop
+    12ac:	eb fd                	jmp    12ab <fdesctest+0x3f8>
+
+  if (!fork()) {
+    12ae:	e8 b4 11 00 00       	call   2467 <fork>
+    12b3:	85 c0                	test   %eax,%eax
+    12b5:	0f 85 1d 01 00 00    	jne    13d8 <fdesctest+0x525>
+    assert(read(3, buf, 10) == 10);
+    12bb:	48 8d 45 f1          	lea    -0xf(%rbp),%rax
+    12bf:	ba 0a 00 00 00       	mov    $0xa,%edx
+    12c4:	48 89 c6             	mov    %rax,%rsi
+    12c7:	bf 03 00 00 00       	mov    $0x3,%edi
+    12cc:	e8 b6 11 00 00       	call   2487 <read>
+    12d1:	83 f8 0a             	cmp    $0xa,%eax
+    12d4:	74 2b                	je     1301 <fdesctest+0x44e>
+    12d6:	8b 05 24 20 00 00    	mov    0x2024(%rip),%eax        # 3300 <stdout>
+    12dc:	48 8d 15 0f 1a 00 00 	lea    0x1a0f(%rip),%rdx        # 2cf2 <malloc+0x63c>
+    12e3:	48 89 d1             	mov    %rdx,%rcx
+    12e6:	ba 51 01 00 00       	mov    $0x151,%edx
+    12eb:	48 8d 35 fe 18 00 00 	lea    0x18fe(%rip),%rsi        # 2bf0 <malloc+0x53a>
+    12f2:	89 c7                	mov    %eax,%edi
+    12f4:	b8 00 00 00 00       	mov    $0x0,%eax
+    12f9:	e8 ca 0b 00 00       	call   1ec8 <printf>
+    12fe:	90                   	nop
+    12ff:	eb fd                	jmp    12fe <fdesctest+0x44b>
+    assert(read(4, buf, 10) == -1); // this fd shouldn't be open
+    1301:	48 8d 45 f1          	lea    -0xf(%rbp),%rax
+    1305:	ba 0a 00 00 00       	mov    $0xa,%edx
+    130a:	48 89 c6             	mov    %rax,%rsi
+    130d:	bf 04 00 00 00       	mov    $0x4,%edi
+    1312:	e8 70 11 00 00       	call   2487 <read>
+    1317:	83 f8 ff             	cmp    $0xffffffff,%eax
+    131a:	74 2b                	je     1347 <fdesctest+0x494>
+    131c:	8b 05 de 1f 00 00    	mov    0x1fde(%rip),%eax        # 3300 <stdout>
+    1322:	48 8d 15 e0 19 00 00 	lea    0x19e0(%rip),%rdx        # 2d09 <malloc+0x653>
+    1329:	48 89 d1             	mov    %rdx,%rcx
+    132c:	ba 52 01 00 00       	mov    $0x152,%edx
+    1331:	48 8d 35 b8 18 00 00 	lea    0x18b8(%rip),%rsi        # 2bf0 <malloc+0x53a>
+    1338:	89 c7                	mov    %eax,%edi
+    133a:	b8 00 00 00 00       	mov    $0x0,%eax
+    133f:	e8 84 0b 00 00       	call   1ec8 <printf>
+    1344:	90                   	nop
+    1345:	eb fd                	jmp    1344 <fdesctest+0x491>
+    assert(read(5, buf, 10) == -1); // this fd shouldn't be open
+    1347:	48 8d 45 f1          	lea    -0xf(%rbp),%rax
+    134b:	ba 0a 00 00 00       	mov    $0xa,%edx
+    1350:	48 89 c6             	mov    %rax,%rsi
+    1353:	bf 05 00 00 00       	mov    $0x5,%edi
+    1358:	e8 2a 11 00 00       	call   2487 <read>
+    135d:	83 f8 ff             	cmp    $0xffffffff,%eax
+    1360:	74 2b                	je     138d <fdesctest+0x4da>
+    1362:	8b 05 98 1f 00 00    	mov    0x1f98(%rip),%eax        # 3300 <stdout>
+    1368:	48 8d 15 b1 19 00 00 	lea    0x19b1(%rip),%rdx        # 2d20 <malloc+0x66a>
+    136f:	48 89 d1             	mov    %rdx,%rcx
+    1372:	ba 53 01 00 00       	mov    $0x153,%edx
+    1377:	48 8d 35 72 18 00 00 	lea    0x1872(%rip),%rsi        # 2bf0 <malloc+0x53a>
+    137e:	89 c7                	mov    %eax,%edi
+    1380:	b8 00 00 00 00       	mov    $0x0,%eax
+    1385:	e8 3e 0b 00 00       	call   1ec8 <printf>
+    138a:	90                   	nop
+    138b:	eb fd                	jmp    138a <fdesctest+0x4d7>
+    assert(read(6, buf, 10) == 10);
+    138d:	48 8d 45 f1          	lea    -0xf(%rbp),%rax
+    1391:	ba 0a 00 00 00       	mov    $0xa,%edx
+    1396:	48 89 c6             	mov    %rax,%rsi
+    1399:	bf 06 00 00 00       	mov    $0x6,%edi
+    139e:	e8 e4 10 00 00       	call   2487 <read>
+    13a3:	83 f8 0a             	cmp    $0xa,%eax
+    13a6:	74 2b                	je     13d3 <fdesctest+0x520>
+    13a8:	8b 05 52 1f 00 00    	mov    0x1f52(%rip),%eax        # 3300 <stdout>
+    13ae:	48 8d 15 82 19 00 00 	lea    0x1982(%rip),%rdx        # 2d37 <malloc+0x681>
+    13b5:	48 89 d1             	mov    %rdx,%rcx
+    13b8:	ba 54 01 00 00       	mov    $0x154,%edx
+    13bd:	48 8d 35 2c 18 00 00 	lea    0x182c(%rip),%rsi        # 2bf0 <malloc+0x53a>
+    13c4:	89 c7                	mov    %eax,%edi
+    13c6:	b8 00 00 00 00       	mov    $0x0,%eax
+    13cb:	e8 f8 0a 00 00       	call   1ec8 <printf>
+    13d0:	90                   	nop
+    13d1:	eb fd                	jmp    13d0 <fdesctest+0x51d>
+    exit();
+    13d3:	e8 97 10 00 00       	call   246f <exit>
+  } else {
+    wait();
+    13d8:	e8 9a 10 00 00       	call   2477 <wait>
+  }
+
+  printf(1, "fdesctest: ok\n");
+    13dd:	48 8d 05 6a 19 00 00 	lea    0x196a(%rip),%rax        # 2d4e <malloc+0x698>
+    13e4:	48 89 c6             	mov    %rax,%rsi
+    13e7:	bf 01 00 00 00       	mov    $0x1,%edi
+    13ec:	b8 00 00 00 00       	mov    $0x0,%eax
+    13f1:	e8 d2 0a 00 00       	call   1ec8 <printf>
+}
+    13f6:	90                   	nop
+    13f7:	c9                   	leave
+    13f8:	c3                   	ret
+
+00000000000013f9 <childpidtesthelper>:
+
+static void childpidtesthelper(int depth) {
+    13f9:	55                   	push   %rbp
+    13fa:	48 89 e5             	mov    %rsp,%rbp
+    13fd:	48 83 ec 30          	sub    $0x30,%rsp
+    1401:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  int pids[3];
+  int i, j, p;
+
+  if (depth == 0)
+    1404:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+    1408:	0f 84 c4 01 00 00    	je     15d2 <childpidtesthelper+0x1d9>
+    return;
+
+  for (i = 0; i < 3; i++) {
+    140e:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+    1415:	eb 6a                	jmp    1481 <childpidtesthelper+0x88>
+    pids[i] = fork();
+    1417:	e8 4b 10 00 00       	call   2467 <fork>
+    141c:	8b 55 fc             	mov    -0x4(%rbp),%edx
+    141f:	48 63 d2             	movslq %edx,%rdx
+    1422:	89 44 95 e8          	mov    %eax,-0x18(%rbp,%rdx,4)
+    assert(pids[i] >= 0);
+    1426:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1429:	48 98                	cltq
+    142b:	8b 44 85 e8          	mov    -0x18(%rbp,%rax,4),%eax
+    142f:	85 c0                	test   %eax,%eax
+    1431:	79 2b                	jns    145e <childpidtesthelper+0x65>
+    1433:	8b 05 c7 1e 00 00    	mov    0x1ec7(%rip),%eax        # 3300 <stdout>
+    1439:	48 8d 15 1d 19 00 00 	lea    0x191d(%rip),%rdx        # 2d5d <malloc+0x6a7>
+    1440:	48 89 d1             	mov    %rdx,%rcx
+    1443:	ba 66 01 00 00       	mov    $0x166,%edx
+    1448:	48 8d 35 a1 17 00 00 	lea    0x17a1(%rip),%rsi        # 2bf0 <malloc+0x53a>
+    144f:	89 c7                	mov    %eax,%edi
+    1451:	b8 00 00 00 00       	mov    $0x0,%eax
+    1456:	e8 6d 0a 00 00       	call   1ec8 <printf>
+    145b:	90                   	nop
+    145c:	eb fd                	jmp    145b <childpidtesthelper+0x62>
+    if (!pids[i]) {
+    145e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1461:	48 98                	cltq
+    1463:	8b 44 85 e8          	mov    -0x18(%rbp,%rax,4),%eax
+    1467:	85 c0                	test   %eax,%eax
+    1469:	75 12                	jne    147d <childpidtesthelper+0x84>
+      childpidtesthelper(depth - 1);
+    146b:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    146e:	83 e8 01             	sub    $0x1,%eax
+    1471:	89 c7                	mov    %eax,%edi
+    1473:	e8 81 ff ff ff       	call   13f9 <childpidtesthelper>
+      exit();
+    1478:	e8 f2 0f 00 00       	call   246f <exit>
+  for (i = 0; i < 3; i++) {
+    147d:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+    1481:	83 7d fc 02          	cmpl   $0x2,-0x4(%rbp)
+    1485:	7e 90                	jle    1417 <childpidtesthelper+0x1e>
+    }
+  }
+
+  for (i = 0; i < 3; i++) {
+    1487:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+    148e:	e9 cf 00 00 00       	jmp    1562 <childpidtesthelper+0x169>
+    p = wait();
+    1493:	e8 df 0f 00 00       	call   2477 <wait>
+    1498:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    assert(p > 0);
+    149b:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+    149f:	7f 2b                	jg     14cc <childpidtesthelper+0xd3>
+    14a1:	8b 05 59 1e 00 00    	mov    0x1e59(%rip),%eax        # 3300 <stdout>
+    14a7:	48 8d 15 bc 18 00 00 	lea    0x18bc(%rip),%rdx        # 2d6a <malloc+0x6b4>
+    14ae:	48 89 d1             	mov    %rdx,%rcx
+    14b1:	ba 6f 01 00 00       	mov    $0x16f,%edx
+    14b6:	48 8d 35 33 17 00 00 	lea    0x1733(%rip),%rsi        # 2bf0 <malloc+0x53a>
+    14bd:	89 c7                	mov    %eax,%edi
+    14bf:	b8 00 00 00 00       	mov    $0x0,%eax
+    14c4:	e8 ff 09 00 00       	call   1ec8 <printf>
+    14c9:	90                   	nop
+    14ca:	eb fd                	jmp    14c9 <childpidtesthelper+0xd0>
+    for (j = 0; j < 3; j++) {
+    14cc:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+    14d3:	eb 21                	jmp    14f6 <childpidtesthelper+0xfd>
+      if (p == pids[j]) {
+    14d5:	8b 45 f8             	mov    -0x8(%rbp),%eax
+    14d8:	48 98                	cltq
+    14da:	8b 44 85 e8          	mov    -0x18(%rbp,%rax,4),%eax
+    14de:	39 45 f4             	cmp    %eax,-0xc(%rbp)
+    14e1:	75 0f                	jne    14f2 <childpidtesthelper+0xf9>
+        pids[j] = -1; // make sure duplicates are not returned
+    14e3:	8b 45 f8             	mov    -0x8(%rbp),%eax
+    14e6:	48 98                	cltq
+    14e8:	c7 44 85 e8 ff ff ff 	movl   $0xffffffff,-0x18(%rbp,%rax,4)
+    14ef:	ff 
+        break;
+    14f0:	eb 0a                	jmp    14fc <childpidtesthelper+0x103>
+    for (j = 0; j < 3; j++) {
+    14f2:	83 45 f8 01          	addl   $0x1,-0x8(%rbp)
+    14f6:	83 7d f8 02          	cmpl   $0x2,-0x8(%rbp)
+    14fa:	7e d9                	jle    14d5 <childpidtesthelper+0xdc>
+      }
+    }
+    if (j == 3)
+    14fc:	83 7d f8 03          	cmpl   $0x3,-0x8(%rbp)
+    1500:	75 5c                	jne    155e <childpidtesthelper+0x165>
+      error("returned pid was not a child");
+    1502:	8b 05 f8 1d 00 00    	mov    0x1df8(%rip),%eax        # 3300 <stdout>
+    1508:	ba 77 01 00 00       	mov    $0x177,%edx
+    150d:	48 8d 0d 2a 13 00 00 	lea    0x132a(%rip),%rcx        # 283e <malloc+0x188>
+    1514:	48 89 ce             	mov    %rcx,%rsi
+    1517:	89 c7                	mov    %eax,%edi
+    1519:	b8 00 00 00 00       	mov    $0x0,%eax
+    151e:	e8 a5 09 00 00       	call   1ec8 <printf>
+    1523:	8b 05 d7 1d 00 00    	mov    0x1dd7(%rip),%eax        # 3300 <stdout>
+    1529:	48 8d 15 40 18 00 00 	lea    0x1840(%rip),%rdx        # 2d70 <malloc+0x6ba>
+    1530:	48 89 d6             	mov    %rdx,%rsi
+    1533:	89 c7                	mov    %eax,%edi
+    1535:	b8 00 00 00 00       	mov    $0x0,%eax
+    153a:	e8 89 09 00 00       	call   1ec8 <printf>
+    153f:	8b 05 bb 1d 00 00    	mov    0x1dbb(%rip),%eax        # 3300 <stdout>
+    1545:	48 8d 15 3a 13 00 00 	lea    0x133a(%rip),%rdx        # 2886 <malloc+0x1d0>
+    154c:	48 89 d6             	mov    %rdx,%rsi
+    154f:	89 c7                	mov    %eax,%edi
+    1551:	b8 00 00 00 00       	mov    $0x0,%eax
+    1556:	e8 6d 09 00 00       	call   1ec8 <printf>
+    155b:	90                   	nop
+    155c:	eb fd                	jmp    155b <childpidtesthelper+0x162>
+  for (i = 0; i < 3; i++) {
+    155e:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+    1562:	83 7d fc 02          	cmpl   $0x2,-0x4(%rbp)
+    1566:	0f 8e 27 ff ff ff    	jle    1493 <childpidtesthelper+0x9a>
+  }
+
+  // No more children
+  if (wait() != -1)
+    156c:	e8 06 0f 00 00       	call   2477 <wait>
+    1571:	83 f8 ff             	cmp    $0xffffffff,%eax
+    1574:	74 5d                	je     15d3 <childpidtesthelper+0x1da>
+    error("there should be no more children");
+    1576:	8b 05 84 1d 00 00    	mov    0x1d84(%rip),%eax        # 3300 <stdout>
+    157c:	ba 7c 01 00 00       	mov    $0x17c,%edx
+    1581:	48 8d 0d b6 12 00 00 	lea    0x12b6(%rip),%rcx        # 283e <malloc+0x188>
+    1588:	48 89 ce             	mov    %rcx,%rsi
+    158b:	89 c7                	mov    %eax,%edi
+    158d:	b8 00 00 00 00       	mov    $0x0,%eax
+    1592:	e8 31 09 00 00       	call   1ec8 <printf>
+    1597:	8b 05 63 1d 00 00    	mov    0x1d63(%rip),%eax        # 3300 <stdout>
+    159d:	48 8d 15 ec 17 00 00 	lea    0x17ec(%rip),%rdx        # 2d90 <malloc+0x6da>
+    15a4:	48 89 d6             	mov    %rdx,%rsi
+    15a7:	89 c7                	mov    %eax,%edi
+    15a9:	b8 00 00 00 00       	mov    $0x0,%eax
+    15ae:	e8 15 09 00 00       	call   1ec8 <printf>
+    15b3:	8b 05 47 1d 00 00    	mov    0x1d47(%rip),%eax        # 3300 <stdout>
+    15b9:	48 8d 15 c6 12 00 00 	lea    0x12c6(%rip),%rdx        # 2886 <malloc+0x1d0>
+    15c0:	48 89 d6             	mov    %rdx,%rsi
+    15c3:	89 c7                	mov    %eax,%edi
+    15c5:	b8 00 00 00 00       	mov    $0x0,%eax
+    15ca:	e8 f9 08 00 00       	call   1ec8 <printf>
+    15cf:	90                   	nop
+    15d0:	eb fd                	jmp    15cf <childpidtesthelper+0x1d6>
+    return;
+    15d2:	90                   	nop
+}
+    15d3:	c9                   	leave
+    15d4:	c3                   	ret
+
+00000000000015d5 <childpidtest>:
+
+void childpidtest() {
+    15d5:	55                   	push   %rbp
+    15d6:	48 89 e5             	mov    %rsp,%rbp
+  printf(1, "childpidtest\n");
+    15d9:	48 8d 05 d1 17 00 00 	lea    0x17d1(%rip),%rax        # 2db1 <malloc+0x6fb>
+    15e0:	48 89 c6             	mov    %rax,%rsi
+    15e3:	bf 01 00 00 00       	mov    $0x1,%edi
+    15e8:	b8 00 00 00 00       	mov    $0x0,%eax
+    15ed:	e8 d6 08 00 00       	call   1ec8 <printf>
+  childpidtesthelper(2);
+    15f2:	bf 02 00 00 00       	mov    $0x2,%edi
+    15f7:	e8 fd fd ff ff       	call   13f9 <childpidtesthelper>
+  printf(1, "childpidtest: ok\n");
+    15fc:	48 8d 05 bc 17 00 00 	lea    0x17bc(%rip),%rax        # 2dbf <malloc+0x709>
+    1603:	48 89 c6             	mov    %rax,%rsi
+    1606:	bf 01 00 00 00       	mov    $0x1,%edi
+    160b:	b8 00 00 00 00       	mov    $0x0,%eax
+    1610:	e8 b3 08 00 00       	call   1ec8 <printf>
+}
+    1615:	90                   	nop
+    1616:	5d                   	pop    %rbp
+    1617:	c3                   	ret
+
+0000000000001618 <exectest>:
+
+void exectest(void) {
+    1618:	55                   	push   %rbp
+    1619:	48 89 e5             	mov    %rsp,%rbp
+    161c:	48 81 ec 90 00 00 00 	sub    $0x90,%rsp
+  printf(1, "exectest\n");
+    1623:	48 8d 05 a7 17 00 00 	lea    0x17a7(%rip),%rax        # 2dd1 <malloc+0x71b>
+    162a:	48 89 c6             	mov    %rax,%rsi
+    162d:	bf 01 00 00 00       	mov    $0x1,%edi
+    1632:	b8 00 00 00 00       	mov    $0x0,%eax
+    1637:	e8 8c 08 00 00       	call   1ec8 <printf>
+
+
+
+
+ // exectest arg checking
+  int pid = fork();
+    163c:	e8 26 0e 00 00       	call   2467 <fork>
+    1641:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  if (pid < 0) {
+    1644:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+    1648:	79 5c                	jns    16a6 <exectest+0x8e>
+    error("exectest: fork failed\n");
+    164a:	8b 05 b0 1c 00 00    	mov    0x1cb0(%rip),%eax        # 3300 <stdout>
+    1650:	ba 91 01 00 00       	mov    $0x191,%edx
+    1655:	48 8d 0d e2 11 00 00 	lea    0x11e2(%rip),%rcx        # 283e <malloc+0x188>
+    165c:	48 89 ce             	mov    %rcx,%rsi
+    165f:	89 c7                	mov    %eax,%edi
+    1661:	b8 00 00 00 00       	mov    $0x0,%eax
+    1666:	e8 5d 08 00 00       	call   1ec8 <printf>
+    166b:	8b 05 8f 1c 00 00    	mov    0x1c8f(%rip),%eax        # 3300 <stdout>
+    1671:	48 8d 15 63 17 00 00 	lea    0x1763(%rip),%rdx        # 2ddb <malloc+0x725>
+    1678:	48 89 d6             	mov    %rdx,%rsi
+    167b:	89 c7                	mov    %eax,%edi
+    167d:	b8 00 00 00 00       	mov    $0x0,%eax
+    1682:	e8 41 08 00 00       	call   1ec8 <printf>
+    1687:	8b 05 73 1c 00 00    	mov    0x1c73(%rip),%eax        # 3300 <stdout>
+    168d:	48 8d 15 f2 11 00 00 	lea    0x11f2(%rip),%rdx        # 2886 <malloc+0x1d0>
+    1694:	48 89 d6             	mov    %rdx,%rsi
+    1697:	89 c7                	mov    %eax,%edi
+    1699:	b8 00 00 00 00       	mov    $0x0,%eax
+    169e:	e8 25 08 00 00       	call   1ec8 <printf>
+    16a3:	90                   	nop
+    16a4:	eb fd                	jmp    16a3 <exectest+0x8b>
+  }
+  if (pid == 0) {
+    16a6:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+    16aa:	0f 85 18 01 00 00    	jne    17c8 <exectest+0x1b0>
+    // test for invalid argv
+    char **argv1 = (char **)0xf00df00d;
+    16b0:	b8 0d f0 0d f0       	mov    $0xf00df00d,%eax
+    16b5:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+    if (exec("ls", argv1) != -1)
+    16b9:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    16bd:	48 89 c6             	mov    %rax,%rsi
+    16c0:	48 8d 05 2b 17 00 00 	lea    0x172b(%rip),%rax        # 2df2 <malloc+0x73c>
+    16c7:	48 89 c7             	mov    %rax,%rdi
+    16ca:	e8 d8 0d 00 00       	call   24a7 <exec>
+    16cf:	83 f8 ff             	cmp    $0xffffffff,%eax
+    16d2:	74 5c                	je     1730 <exectest+0x118>
+      error("exec test: invalid argv\n");
+    16d4:	8b 05 26 1c 00 00    	mov    0x1c26(%rip),%eax        # 3300 <stdout>
+    16da:	ba 97 01 00 00       	mov    $0x197,%edx
+    16df:	48 8d 0d 58 11 00 00 	lea    0x1158(%rip),%rcx        # 283e <malloc+0x188>
+    16e6:	48 89 ce             	mov    %rcx,%rsi
+    16e9:	89 c7                	mov    %eax,%edi
+    16eb:	b8 00 00 00 00       	mov    $0x0,%eax
+    16f0:	e8 d3 07 00 00       	call   1ec8 <printf>
+    16f5:	8b 05 05 1c 00 00    	mov    0x1c05(%rip),%eax        # 3300 <stdout>
+    16fb:	48 8d 15 f3 16 00 00 	lea    0x16f3(%rip),%rdx        # 2df5 <malloc+0x73f>
+    1702:	48 89 d6             	mov    %rdx,%rsi
+    1705:	89 c7                	mov    %eax,%edi
+    1707:	b8 00 00 00 00       	mov    $0x0,%eax
+    170c:	e8 b7 07 00 00       	call   1ec8 <printf>
+    1711:	8b 05 e9 1b 00 00    	mov    0x1be9(%rip),%eax        # 3300 <stdout>
+    1717:	48 8d 15 68 11 00 00 	lea    0x1168(%rip),%rdx        # 2886 <malloc+0x1d0>
+    171e:	48 89 d6             	mov    %rdx,%rsi
+    1721:	89 c7                	mov    %eax,%edi
+    1723:	b8 00 00 00 00       	mov    $0x0,%eax
+    1728:	e8 9b 07 00 00       	call   1ec8 <printf>
+    172d:	90                   	nop
+    172e:	eb fd                	jmp    172d <exectest+0x115>
+
+    // test for invalid argv[1]
+    char *argv3[] = { "ls", (char *) 0xf00df00d, 0 };
+    1730:	48 8d 05 bb 16 00 00 	lea    0x16bb(%rip),%rax        # 2df2 <malloc+0x73c>
+    1737:	48 89 45 88          	mov    %rax,-0x78(%rbp)
+    173b:	b8 0d f0 0d f0       	mov    $0xf00df00d,%eax
+    1740:	48 89 45 90          	mov    %rax,-0x70(%rbp)
+    1744:	48 c7 45 98 00 00 00 	movq   $0x0,-0x68(%rbp)
+    174b:	00 
+    if (exec("ls", argv3) != -1)
+    174c:	48 8d 45 88          	lea    -0x78(%rbp),%rax
+    1750:	48 89 c6             	mov    %rax,%rsi
+    1753:	48 8d 05 98 16 00 00 	lea    0x1698(%rip),%rax        # 2df2 <malloc+0x73c>
+    175a:	48 89 c7             	mov    %rax,%rdi
+    175d:	e8 45 0d 00 00       	call   24a7 <exec>
+    1762:	83 f8 ff             	cmp    $0xffffffff,%eax
+    1765:	74 5c                	je     17c3 <exectest+0x1ab>
+      error("exec test: argv[1] out of stack\n");
+    1767:	8b 05 93 1b 00 00    	mov    0x1b93(%rip),%eax        # 3300 <stdout>
+    176d:	ba 9c 01 00 00       	mov    $0x19c,%edx
+    1772:	48 8d 0d c5 10 00 00 	lea    0x10c5(%rip),%rcx        # 283e <malloc+0x188>
+    1779:	48 89 ce             	mov    %rcx,%rsi
+    177c:	89 c7                	mov    %eax,%edi
+    177e:	b8 00 00 00 00       	mov    $0x0,%eax
+    1783:	e8 40 07 00 00       	call   1ec8 <printf>
+    1788:	8b 05 72 1b 00 00    	mov    0x1b72(%rip),%eax        # 3300 <stdout>
+    178e:	48 8d 15 7b 16 00 00 	lea    0x167b(%rip),%rdx        # 2e10 <malloc+0x75a>
+    1795:	48 89 d6             	mov    %rdx,%rsi
+    1798:	89 c7                	mov    %eax,%edi
+    179a:	b8 00 00 00 00       	mov    $0x0,%eax
+    179f:	e8 24 07 00 00       	call   1ec8 <printf>
+    17a4:	8b 05 56 1b 00 00    	mov    0x1b56(%rip),%eax        # 3300 <stdout>
+    17aa:	48 8d 15 d5 10 00 00 	lea    0x10d5(%rip),%rdx        # 2886 <malloc+0x1d0>
+    17b1:	48 89 d6             	mov    %rdx,%rsi
+    17b4:	89 c7                	mov    %eax,%edi
+    17b6:	b8 00 00 00 00       	mov    $0x0,%eax
+    17bb:	e8 08 07 00 00       	call   1ec8 <printf>
+    17c0:	90                   	nop
+    17c1:	eb fd                	jmp    17c0 <exectest+0x1a8>
+
+    exit();
+    17c3:	e8 a7 0c 00 00       	call   246f <exit>
+  } else {
+    if (wait() != pid) {
+    17c8:	e8 aa 0c 00 00       	call   2477 <wait>
+    17cd:	39 45 f4             	cmp    %eax,-0xc(%rbp)
+    17d0:	74 5c                	je     182e <exectest+0x216>
+      error("exec test: wait wrong pid");
+    17d2:	8b 05 28 1b 00 00    	mov    0x1b28(%rip),%eax        # 3300 <stdout>
+    17d8:	ba a1 01 00 00       	mov    $0x1a1,%edx
+    17dd:	48 8d 0d 5a 10 00 00 	lea    0x105a(%rip),%rcx        # 283e <malloc+0x188>
+    17e4:	48 89 ce             	mov    %rcx,%rsi
+    17e7:	89 c7                	mov    %eax,%edi
+    17e9:	b8 00 00 00 00       	mov    $0x0,%eax
+    17ee:	e8 d5 06 00 00       	call   1ec8 <printf>
+    17f3:	8b 05 07 1b 00 00    	mov    0x1b07(%rip),%eax        # 3300 <stdout>
+    17f9:	48 8d 15 31 16 00 00 	lea    0x1631(%rip),%rdx        # 2e31 <malloc+0x77b>
+    1800:	48 89 d6             	mov    %rdx,%rsi
+    1803:	89 c7                	mov    %eax,%edi
+    1805:	b8 00 00 00 00       	mov    $0x0,%eax
+    180a:	e8 b9 06 00 00       	call   1ec8 <printf>
+    180f:	8b 05 eb 1a 00 00    	mov    0x1aeb(%rip),%eax        # 3300 <stdout>
+    1815:	48 8d 15 6a 10 00 00 	lea    0x106a(%rip),%rdx        # 2886 <malloc+0x1d0>
+    181c:	48 89 d6             	mov    %rdx,%rsi
+    181f:	89 c7                	mov    %eax,%edi
+    1821:	b8 00 00 00 00       	mov    $0x0,%eax
+    1826:	e8 9d 06 00 00       	call   1ec8 <printf>
+    182b:	90                   	nop
+    182c:	eb fd                	jmp    182b <exectest+0x213>
+    }
+  }
+	printf(1, "exectest: testing ls\n");
+    182e:	48 8d 05 16 16 00 00 	lea    0x1616(%rip),%rax        # 2e4b <malloc+0x795>
+    1835:	48 89 c6             	mov    %rax,%rsi
+    1838:	bf 01 00 00 00       	mov    $0x1,%edi
+    183d:	b8 00 00 00 00       	mov    $0x0,%eax
+    1842:	e8 81 06 00 00       	call   1ec8 <printf>
+  pid = fork();
+    1847:	e8 1b 0c 00 00       	call   2467 <fork>
+    184c:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  if (pid < 0) {
+    184f:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+    1853:	79 5c                	jns    18b1 <exectest+0x299>
+    error("exectest: fork failed\n");
+    1855:	8b 05 a5 1a 00 00    	mov    0x1aa5(%rip),%eax        # 3300 <stdout>
+    185b:	ba a7 01 00 00       	mov    $0x1a7,%edx
+    1860:	48 8d 0d d7 0f 00 00 	lea    0xfd7(%rip),%rcx        # 283e <malloc+0x188>
+    1867:	48 89 ce             	mov    %rcx,%rsi
+    186a:	89 c7                	mov    %eax,%edi
+    186c:	b8 00 00 00 00       	mov    $0x0,%eax
+    1871:	e8 52 06 00 00       	call   1ec8 <printf>
+    1876:	8b 05 84 1a 00 00    	mov    0x1a84(%rip),%eax        # 3300 <stdout>
+    187c:	48 8d 15 58 15 00 00 	lea    0x1558(%rip),%rdx        # 2ddb <malloc+0x725>
+    1883:	48 89 d6             	mov    %rdx,%rsi
+    1886:	89 c7                	mov    %eax,%edi
+    1888:	b8 00 00 00 00       	mov    $0x0,%eax
+    188d:	e8 36 06 00 00       	call   1ec8 <printf>
+    1892:	8b 05 68 1a 00 00    	mov    0x1a68(%rip),%eax        # 3300 <stdout>
+    1898:	48 8d 15 e7 0f 00 00 	lea    0xfe7(%rip),%rdx        # 2886 <malloc+0x1d0>
+    189f:	48 89 d6             	mov    %rdx,%rsi
+    18a2:	89 c7                	mov    %eax,%edi
+    18a4:	b8 00 00 00 00       	mov    $0x0,%eax
+    18a9:	e8 1a 06 00 00       	call   1ec8 <printf>
+    18ae:	90                   	nop
+    18af:	eb fd                	jmp    18ae <exectest+0x296>
+  }
+
+
+  char *argv[] = {"ls", 0};
+    18b1:	48 8d 05 3a 15 00 00 	lea    0x153a(%rip),%rax        # 2df2 <malloc+0x73c>
+    18b8:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    18bc:	48 c7 45 d0 00 00 00 	movq   $0x0,-0x30(%rbp)
+    18c3:	00 
+
+  if (pid == 0) {
+    18c4:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+    18c8:	75 72                	jne    193c <exectest+0x324>
+    exec("ls", argv);
+    18ca:	48 8d 45 c8          	lea    -0x38(%rbp),%rax
+    18ce:	48 89 c6             	mov    %rax,%rsi
+    18d1:	48 8d 05 1a 15 00 00 	lea    0x151a(%rip),%rax        # 2df2 <malloc+0x73c>
+    18d8:	48 89 c7             	mov    %rax,%rdi
+    18db:	e8 c7 0b 00 00       	call   24a7 <exec>
+    error("exectest: exec ls failed\n");
+    18e0:	8b 05 1a 1a 00 00    	mov    0x1a1a(%rip),%eax        # 3300 <stdout>
+    18e6:	ba af 01 00 00       	mov    $0x1af,%edx
+    18eb:	48 8d 0d 4c 0f 00 00 	lea    0xf4c(%rip),%rcx        # 283e <malloc+0x188>
+    18f2:	48 89 ce             	mov    %rcx,%rsi
+    18f5:	89 c7                	mov    %eax,%edi
+    18f7:	b8 00 00 00 00       	mov    $0x0,%eax
+    18fc:	e8 c7 05 00 00       	call   1ec8 <printf>
+    1901:	8b 05 f9 19 00 00    	mov    0x19f9(%rip),%eax        # 3300 <stdout>
+    1907:	48 8d 15 53 15 00 00 	lea    0x1553(%rip),%rdx        # 2e61 <malloc+0x7ab>
+    190e:	48 89 d6             	mov    %rdx,%rsi
+    1911:	89 c7                	mov    %eax,%edi
+    1913:	b8 00 00 00 00       	mov    $0x0,%eax
+    1918:	e8 ab 05 00 00       	call   1ec8 <printf>
+    191d:	8b 05 dd 19 00 00    	mov    0x19dd(%rip),%eax        # 3300 <stdout>
+    1923:	48 8d 15 5c 0f 00 00 	lea    0xf5c(%rip),%rdx        # 2886 <malloc+0x1d0>
+    192a:	48 89 d6             	mov    %rdx,%rsi
+    192d:	89 c7                	mov    %eax,%edi
+    192f:	b8 00 00 00 00       	mov    $0x0,%eax
+    1934:	e8 8f 05 00 00       	call   1ec8 <printf>
+    1939:	90                   	nop
+    193a:	eb fd                	jmp    1939 <exectest+0x321>
+  } else {
+    pid = wait();
+    193c:	e8 36 0b 00 00       	call   2477 <wait>
+    1941:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  }
+
+
+  char *echoargv[] = {"echo", "echotest", "ok", 0};
+    1944:	48 8d 05 30 15 00 00 	lea    0x1530(%rip),%rax        # 2e7b <malloc+0x7c5>
+    194b:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+    194f:	48 8d 05 2a 15 00 00 	lea    0x152a(%rip),%rax        # 2e80 <malloc+0x7ca>
+    1956:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+    195a:	48 8d 05 28 15 00 00 	lea    0x1528(%rip),%rax        # 2e89 <malloc+0x7d3>
+    1961:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+    1965:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+    196c:	00 
+  printf(stdout, "exectest: test argument\n");
+    196d:	8b 05 8d 19 00 00    	mov    0x198d(%rip),%eax        # 3300 <stdout>
+    1973:	48 8d 15 12 15 00 00 	lea    0x1512(%rip),%rdx        # 2e8c <malloc+0x7d6>
+    197a:	48 89 d6             	mov    %rdx,%rsi
+    197d:	89 c7                	mov    %eax,%edi
+    197f:	b8 00 00 00 00       	mov    $0x0,%eax
+    1984:	e8 3f 05 00 00       	call   1ec8 <printf>
+
+  int fds[2];
+  assert(pipe(fds) == 0);
+    1989:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+    198d:	48 89 c7             	mov    %rax,%rdi
+    1990:	e8 ea 0a 00 00       	call   247f <pipe>
+    1995:	85 c0                	test   %eax,%eax
+    1997:	74 2b                	je     19c4 <exectest+0x3ac>
+    1999:	8b 05 61 19 00 00    	mov    0x1961(%rip),%eax        # 3300 <stdout>
+    199f:	48 8d 15 ff 14 00 00 	lea    0x14ff(%rip),%rdx        # 2ea5 <malloc+0x7ef>
+    19a6:	48 89 d1             	mov    %rdx,%rcx
+    19a9:	ba b9 01 00 00       	mov    $0x1b9,%edx
+    19ae:	48 8d 35 3b 12 00 00 	lea    0x123b(%rip),%rsi        # 2bf0 <malloc+0x53a>
+    19b5:	89 c7                	mov    %eax,%edi
+    19b7:	b8 00 00 00 00       	mov    $0x0,%eax
+    19bc:	e8 07 05 00 00       	call   1ec8 <printf>
+    19c1:	90                   	nop
+    19c2:	eb fd                	jmp    19c1 <exectest+0x3a9>
+
+  pid = fork();
+    19c4:	e8 9e 0a 00 00       	call   2467 <fork>
+    19c9:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  if (pid < 0) {
+    19cc:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+    19d0:	79 5c                	jns    1a2e <exectest+0x416>
+    error("exectest: fork failed\n");
+    19d2:	8b 05 28 19 00 00    	mov    0x1928(%rip),%eax        # 3300 <stdout>
+    19d8:	ba bd 01 00 00       	mov    $0x1bd,%edx
+    19dd:	48 8d 0d 5a 0e 00 00 	lea    0xe5a(%rip),%rcx        # 283e <malloc+0x188>
+    19e4:	48 89 ce             	mov    %rcx,%rsi
+    19e7:	89 c7                	mov    %eax,%edi
+    19e9:	b8 00 00 00 00       	mov    $0x0,%eax
+    19ee:	e8 d5 04 00 00       	call   1ec8 <printf>
+    19f3:	8b 05 07 19 00 00    	mov    0x1907(%rip),%eax        # 3300 <stdout>
+    19f9:	48 8d 15 db 13 00 00 	lea    0x13db(%rip),%rdx        # 2ddb <malloc+0x725>
+    1a00:	48 89 d6             	mov    %rdx,%rsi
+    1a03:	89 c7                	mov    %eax,%edi
+    1a05:	b8 00 00 00 00       	mov    $0x0,%eax
+    1a0a:	e8 b9 04 00 00       	call   1ec8 <printf>
+    1a0f:	8b 05 eb 18 00 00    	mov    0x18eb(%rip),%eax        # 3300 <stdout>
+    1a15:	48 8d 15 6a 0e 00 00 	lea    0xe6a(%rip),%rdx        # 2886 <malloc+0x1d0>
+    1a1c:	48 89 d6             	mov    %rdx,%rsi
+    1a1f:	89 c7                	mov    %eax,%edi
+    1a21:	b8 00 00 00 00       	mov    $0x0,%eax
+    1a26:	e8 9d 04 00 00       	call   1ec8 <printf>
+    1a2b:	90                   	nop
+    1a2c:	eb fd                	jmp    1a2b <exectest+0x413>
+  }
+
+  if (pid == 0) {
+    1a2e:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+    1a32:	0f 85 c0 00 00 00    	jne    1af8 <exectest+0x4e0>
+    // send output to parent.
+    close(stdout);
+    1a38:	8b 05 c2 18 00 00    	mov    0x18c2(%rip),%eax        # 3300 <stdout>
+    1a3e:	89 c7                	mov    %eax,%edi
+    1a40:	e8 52 0a 00 00       	call   2497 <close>
+    assert(dup(fds[1]) == stdout);
+    1a45:	8b 45 a4             	mov    -0x5c(%rbp),%eax
+    1a48:	89 c7                	mov    %eax,%edi
+    1a4a:	e8 98 0a 00 00       	call   24e7 <dup>
+    1a4f:	89 c2                	mov    %eax,%edx
+    1a51:	8b 05 a9 18 00 00    	mov    0x18a9(%rip),%eax        # 3300 <stdout>
+    1a57:	39 c2                	cmp    %eax,%edx
+    1a59:	74 2b                	je     1a86 <exectest+0x46e>
+    1a5b:	8b 05 9f 18 00 00    	mov    0x189f(%rip),%eax        # 3300 <stdout>
+    1a61:	48 8d 15 4c 14 00 00 	lea    0x144c(%rip),%rdx        # 2eb4 <malloc+0x7fe>
+    1a68:	48 89 d1             	mov    %rdx,%rcx
+    1a6b:	ba c3 01 00 00       	mov    $0x1c3,%edx
+    1a70:	48 8d 35 79 11 00 00 	lea    0x1179(%rip),%rsi        # 2bf0 <malloc+0x53a>
+    1a77:	89 c7                	mov    %eax,%edi
+    1a79:	b8 00 00 00 00       	mov    $0x0,%eax
+    1a7e:	e8 45 04 00 00       	call   1ec8 <printf>
+    1a83:	90                   	nop
+    1a84:	eb fd                	jmp    1a83 <exectest+0x46b>
+
+   // write(myfd, mystr, 7);
+
+
+
+    exec("echo", echoargv);
+    1a86:	48 8d 45 a8          	lea    -0x58(%rbp),%rax
+    1a8a:	48 89 c6             	mov    %rax,%rsi
+    1a8d:	48 8d 05 e7 13 00 00 	lea    0x13e7(%rip),%rax        # 2e7b <malloc+0x7c5>
+    1a94:	48 89 c7             	mov    %rax,%rdi
+    1a97:	e8 0b 0a 00 00       	call   24a7 <exec>
+    error("exectest: exec echo failed\n");
+    1a9c:	8b 05 5e 18 00 00    	mov    0x185e(%rip),%eax        # 3300 <stdout>
+    1aa2:	ba d0 01 00 00       	mov    $0x1d0,%edx
+    1aa7:	48 8d 0d 90 0d 00 00 	lea    0xd90(%rip),%rcx        # 283e <malloc+0x188>
+    1aae:	48 89 ce             	mov    %rcx,%rsi
+    1ab1:	89 c7                	mov    %eax,%edi
+    1ab3:	b8 00 00 00 00       	mov    $0x0,%eax
+    1ab8:	e8 0b 04 00 00       	call   1ec8 <printf>
+    1abd:	8b 05 3d 18 00 00    	mov    0x183d(%rip),%eax        # 3300 <stdout>
+    1ac3:	48 8d 15 00 14 00 00 	lea    0x1400(%rip),%rdx        # 2eca <malloc+0x814>
+    1aca:	48 89 d6             	mov    %rdx,%rsi
+    1acd:	89 c7                	mov    %eax,%edi
+    1acf:	b8 00 00 00 00       	mov    $0x0,%eax
+    1ad4:	e8 ef 03 00 00       	call   1ec8 <printf>
+    1ad9:	8b 05 21 18 00 00    	mov    0x1821(%rip),%eax        # 3300 <stdout>
+    1adf:	48 8d 15 a0 0d 00 00 	lea    0xda0(%rip),%rdx        # 2886 <malloc+0x1d0>
+    1ae6:	48 89 d6             	mov    %rdx,%rsi
+    1ae9:	89 c7                	mov    %eax,%edi
+    1aeb:	b8 00 00 00 00       	mov    $0x0,%eax
+    1af0:	e8 d3 03 00 00       	call   1ec8 <printf>
+    1af5:	90                   	nop
+    1af6:	eb fd                	jmp    1af5 <exectest+0x4dd>
+  } else {
+    assert(wait() == pid);
+    1af8:	e8 7a 09 00 00       	call   2477 <wait>
+    1afd:	39 45 f4             	cmp    %eax,-0xc(%rbp)
+    1b00:	74 2b                	je     1b2d <exectest+0x515>
+    1b02:	8b 05 f8 17 00 00    	mov    0x17f8(%rip),%eax        # 3300 <stdout>
+    1b08:	48 8d 15 d7 13 00 00 	lea    0x13d7(%rip),%rdx        # 2ee6 <malloc+0x830>
+    1b0f:	48 89 d1             	mov    %rdx,%rcx
+    1b12:	ba d2 01 00 00       	mov    $0x1d2,%edx
+    1b17:	48 8d 35 d2 10 00 00 	lea    0x10d2(%rip),%rsi        # 2bf0 <malloc+0x53a>
+    1b1e:	89 c7                	mov    %eax,%edi
+    1b20:	b8 00 00 00 00       	mov    $0x0,%eax
+    1b25:	e8 9e 03 00 00       	call   1ec8 <printf>
+    1b2a:	90                   	nop
+    1b2b:	eb fd                	jmp    1b2a <exectest+0x512>
+
+    // read output from child.
+    printf(stdout, "exectest: test output\n");
+    1b2d:	8b 05 cd 17 00 00    	mov    0x17cd(%rip),%eax        # 3300 <stdout>
+    1b33:	48 8d 15 ba 13 00 00 	lea    0x13ba(%rip),%rdx        # 2ef4 <malloc+0x83e>
+    1b3a:	48 89 d6             	mov    %rdx,%rsi
+    1b3d:	89 c7                	mov    %eax,%edi
+    1b3f:	b8 00 00 00 00       	mov    $0x0,%eax
+    1b44:	e8 7f 03 00 00       	call   1ec8 <printf>
+    close(fds[1]); // close write end, read until EOF
+    1b49:	8b 45 a4             	mov    -0x5c(%rbp),%eax
+    1b4c:	89 c7                	mov    %eax,%edi
+    1b4e:	e8 44 09 00 00       	call   2497 <close>
+    char buf[16];
+    char *expected = "echotest ok\n";
+    1b53:	48 8d 05 b1 13 00 00 	lea    0x13b1(%rip),%rax        # 2f0b <malloc+0x855>
+    1b5a:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+
+    int byte_to_read = 15;
+    1b5e:	c7 45 fc 0f 00 00 00 	movl   $0xf,-0x4(%rbp)
+    int count = 0;
+    1b65:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+    while (count < 12) {
+    1b6c:	e9 97 00 00 00       	jmp    1c08 <exectest+0x5f0>
+      int ret = read(fds[0], buf + count, byte_to_read);
+    1b71:	8b 45 f8             	mov    -0x8(%rbp),%eax
+    1b74:	48 98                	cltq
+    1b76:	48 8d 95 78 ff ff ff 	lea    -0x88(%rbp),%rdx
+    1b7d:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+    1b81:	8b 45 a0             	mov    -0x60(%rbp),%eax
+    1b84:	8b 55 fc             	mov    -0x4(%rbp),%edx
+    1b87:	48 89 ce             	mov    %rcx,%rsi
+    1b8a:	89 c7                	mov    %eax,%edi
+    1b8c:	e8 f6 08 00 00       	call   2487 <read>
+    1b91:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+      if (ret == 0 || ret == -1)
+    1b94:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+    1b98:	74 06                	je     1ba0 <exectest+0x588>
+    1b9a:	83 7d e4 ff          	cmpl   $0xffffffff,-0x1c(%rbp)
+    1b9e:	75 5c                	jne    1bfc <exectest+0x5e4>
+        error("exectest: exec echotest no output");
+    1ba0:	8b 05 5a 17 00 00    	mov    0x175a(%rip),%eax        # 3300 <stdout>
+    1ba6:	ba df 01 00 00       	mov    $0x1df,%edx
+    1bab:	48 8d 0d 8c 0c 00 00 	lea    0xc8c(%rip),%rcx        # 283e <malloc+0x188>
+    1bb2:	48 89 ce             	mov    %rcx,%rsi
+    1bb5:	89 c7                	mov    %eax,%edi
+    1bb7:	b8 00 00 00 00       	mov    $0x0,%eax
+    1bbc:	e8 07 03 00 00       	call   1ec8 <printf>
+    1bc1:	8b 05 39 17 00 00    	mov    0x1739(%rip),%eax        # 3300 <stdout>
+    1bc7:	48 8d 15 4a 13 00 00 	lea    0x134a(%rip),%rdx        # 2f18 <malloc+0x862>
+    1bce:	48 89 d6             	mov    %rdx,%rsi
+    1bd1:	89 c7                	mov    %eax,%edi
+    1bd3:	b8 00 00 00 00       	mov    $0x0,%eax
+    1bd8:	e8 eb 02 00 00       	call   1ec8 <printf>
+    1bdd:	8b 05 1d 17 00 00    	mov    0x171d(%rip),%eax        # 3300 <stdout>
+    1be3:	48 8d 15 9c 0c 00 00 	lea    0xc9c(%rip),%rdx        # 2886 <malloc+0x1d0>
+    1bea:	48 89 d6             	mov    %rdx,%rsi
+    1bed:	89 c7                	mov    %eax,%edi
+    1bef:	b8 00 00 00 00       	mov    $0x0,%eax
+    1bf4:	e8 cf 02 00 00       	call   1ec8 <printf>
+    1bf9:	90                   	nop
+    1bfa:	eb fd                	jmp    1bf9 <exectest+0x5e1>
+      byte_to_read -= ret;
+    1bfc:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+    1bff:	29 45 fc             	sub    %eax,-0x4(%rbp)
+      count += ret;
+    1c02:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+    1c05:	01 45 f8             	add    %eax,-0x8(%rbp)
+    while (count < 12) {
+    1c08:	83 7d f8 0b          	cmpl   $0xb,-0x8(%rbp)
+    1c0c:	0f 8e 5f ff ff ff    	jle    1b71 <exectest+0x559>
+    }
+
+    buf[count] = 0;
+    1c12:	8b 45 f8             	mov    -0x8(%rbp),%eax
+    1c15:	48 98                	cltq
+    1c17:	c6 84 05 78 ff ff ff 	movb   $0x0,-0x88(%rbp,%rax,1)
+    1c1e:	00 
+    if (strcmp(buf, expected) != 0) {
+    1c1f:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    1c23:	48 8d 85 78 ff ff ff 	lea    -0x88(%rbp),%rax
+    1c2a:	48 89 d6             	mov    %rdx,%rsi
+    1c2d:	48 89 c7             	mov    %rax,%rdi
+    1c30:	e8 d4 05 00 00       	call   2209 <strcmp>
+    1c35:	85 c0                	test   %eax,%eax
+    1c37:	0f 84 94 00 00 00    	je     1cd1 <exectest+0x6b9>
+      printf(stdout, "exectest: bad output:\n");
+    1c3d:	8b 05 bd 16 00 00    	mov    0x16bd(%rip),%eax        # 3300 <stdout>
+    1c43:	48 8d 15 f0 12 00 00 	lea    0x12f0(%rip),%rdx        # 2f3a <malloc+0x884>
+    1c4a:	48 89 d6             	mov    %rdx,%rsi
+    1c4d:	89 c7                	mov    %eax,%edi
+    1c4f:	b8 00 00 00 00       	mov    $0x0,%eax
+    1c54:	e8 6f 02 00 00       	call   1ec8 <printf>
+      printf(stdout, buf);
+    1c59:	8b 05 a1 16 00 00    	mov    0x16a1(%rip),%eax        # 3300 <stdout>
+    1c5f:	48 8d 95 78 ff ff ff 	lea    -0x88(%rbp),%rdx
+    1c66:	48 89 d6             	mov    %rdx,%rsi
+    1c69:	89 c7                	mov    %eax,%edi
+    1c6b:	b8 00 00 00 00       	mov    $0x0,%eax
+    1c70:	e8 53 02 00 00       	call   1ec8 <printf>
+      error("exectest: output test failed");
+    1c75:	8b 05 85 16 00 00    	mov    0x1685(%rip),%eax        # 3300 <stdout>
+    1c7b:	ba e8 01 00 00       	mov    $0x1e8,%edx
+    1c80:	48 8d 0d b7 0b 00 00 	lea    0xbb7(%rip),%rcx        # 283e <malloc+0x188>
+    1c87:	48 89 ce             	mov    %rcx,%rsi
+    1c8a:	89 c7                	mov    %eax,%edi
+    1c8c:	b8 00 00 00 00       	mov    $0x0,%eax
+    1c91:	e8 32 02 00 00       	call   1ec8 <printf>
+    1c96:	8b 05 64 16 00 00    	mov    0x1664(%rip),%eax        # 3300 <stdout>
+    1c9c:	48 8d 15 ae 12 00 00 	lea    0x12ae(%rip),%rdx        # 2f51 <malloc+0x89b>
+    1ca3:	48 89 d6             	mov    %rdx,%rsi
+    1ca6:	89 c7                	mov    %eax,%edi
+    1ca8:	b8 00 00 00 00       	mov    $0x0,%eax
+    1cad:	e8 16 02 00 00       	call   1ec8 <printf>
+    1cb2:	8b 05 48 16 00 00    	mov    0x1648(%rip),%eax        # 3300 <stdout>
+    1cb8:	48 8d 15 c7 0b 00 00 	lea    0xbc7(%rip),%rdx        # 2886 <malloc+0x1d0>
+    1cbf:	48 89 d6             	mov    %rdx,%rsi
+    1cc2:	89 c7                	mov    %eax,%edi
+    1cc4:	b8 00 00 00 00       	mov    $0x0,%eax
+    1cc9:	e8 fa 01 00 00       	call   1ec8 <printf>
+    1cce:	90                   	nop
+    1ccf:	eb fd                	jmp    1cce <exectest+0x6b6>
+    }
+    printf(stdout, expected);
+    1cd1:	8b 05 29 16 00 00    	mov    0x1629(%rip),%eax        # 3300 <stdout>
+    1cd7:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    1cdb:	48 89 d6             	mov    %rdx,%rsi
+    1cde:	89 c7                	mov    %eax,%edi
+    1ce0:	b8 00 00 00 00       	mov    $0x0,%eax
+    1ce5:	e8 de 01 00 00       	call   1ec8 <printf>
+  }
+
+  printf(1, "exectest: ok\n");
+    1cea:	48 8d 05 7d 12 00 00 	lea    0x127d(%rip),%rax        # 2f6e <malloc+0x8b8>
+    1cf1:	48 89 c6             	mov    %rax,%rsi
+    1cf4:	bf 01 00 00 00       	mov    $0x1,%edi
+    1cf9:	b8 00 00 00 00       	mov    $0x0,%eax
+    1cfe:	e8 c5 01 00 00       	call   1ec8 <printf>
+}
+    1d03:	90                   	nop
+    1d04:	c9                   	leave
+    1d05:	c3                   	ret
+
+0000000000001d06 <putc>:
+#include <cdefs.h>
+#include <stat.h>
+#include <stdarg.h>
+#include <user.h>
+
+static void putc(int fd, char c) { write(fd, &c, 1); }
+    1d06:	55                   	push   %rbp
+    1d07:	48 89 e5             	mov    %rsp,%rbp
+    1d0a:	48 83 ec 10          	sub    $0x10,%rsp
+    1d0e:	89 7d fc             	mov    %edi,-0x4(%rbp)
+    1d11:	89 f0                	mov    %esi,%eax
+    1d13:	88 45 f8             	mov    %al,-0x8(%rbp)
+    1d16:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+    1d1a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1d1d:	ba 01 00 00 00       	mov    $0x1,%edx
+    1d22:	48 89 ce             	mov    %rcx,%rsi
+    1d25:	89 c7                	mov    %eax,%edi
+    1d27:	e8 63 07 00 00       	call   248f <write>
+    1d2c:	90                   	nop
+    1d2d:	c9                   	leave
+    1d2e:	c3                   	ret
+
+0000000000001d2f <printint64>:
+
+static void printint64(int fd, int xx, int base, int sgn) {
+    1d2f:	55                   	push   %rbp
+    1d30:	48 89 e5             	mov    %rsp,%rbp
+    1d33:	48 83 ec 40          	sub    $0x40,%rsp
+    1d37:	89 7d cc             	mov    %edi,-0x34(%rbp)
+    1d3a:	89 75 c8             	mov    %esi,-0x38(%rbp)
+    1d3d:	89 55 c4             	mov    %edx,-0x3c(%rbp)
+    1d40:	89 4d c0             	mov    %ecx,-0x40(%rbp)
+  static char digits[] = "0123456789abcdef";
+  char buf[32];
+  int i;
+  uint64_t x;
+
+  if (sgn && (sgn = xx < 0))
+    1d43:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+    1d47:	74 1f                	je     1d68 <printint64+0x39>
+    1d49:	8b 45 c8             	mov    -0x38(%rbp),%eax
+    1d4c:	c1 e8 1f             	shr    $0x1f,%eax
+    1d4f:	0f b6 c0             	movzbl %al,%eax
+    1d52:	89 45 c0             	mov    %eax,-0x40(%rbp)
+    1d55:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+    1d59:	74 0d                	je     1d68 <printint64+0x39>
+    x = -xx;
+    1d5b:	8b 45 c8             	mov    -0x38(%rbp),%eax
+    1d5e:	f7 d8                	neg    %eax
+    1d60:	48 98                	cltq
+    1d62:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    1d66:	eb 09                	jmp    1d71 <printint64+0x42>
+  else
+    x = xx;
+    1d68:	8b 45 c8             	mov    -0x38(%rbp),%eax
+    1d6b:	48 98                	cltq
+    1d6d:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+  i = 0;
+    1d71:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  do {
+    buf[i++] = digits[x % base];
+    1d78:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+    1d7b:	48 63 c8             	movslq %eax,%rcx
+    1d7e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1d82:	ba 00 00 00 00       	mov    $0x0,%edx
+    1d87:	48 f7 f1             	div    %rcx
+    1d8a:	48 89 d1             	mov    %rdx,%rcx
+    1d8d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1d90:	8d 50 01             	lea    0x1(%rax),%edx
+    1d93:	89 55 fc             	mov    %edx,-0x4(%rbp)
+    1d96:	48 8d 15 73 15 00 00 	lea    0x1573(%rip),%rdx        # 3310 <digits.1>
+    1d9d:	0f b6 14 11          	movzbl (%rcx,%rdx,1),%edx
+    1da1:	48 98                	cltq
+    1da3:	88 54 05 d0          	mov    %dl,-0x30(%rbp,%rax,1)
+  } while ((x /= base) != 0);
+    1da7:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+    1daa:	48 63 f0             	movslq %eax,%rsi
+    1dad:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1db1:	ba 00 00 00 00       	mov    $0x0,%edx
+    1db6:	48 f7 f6             	div    %rsi
+    1db9:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    1dbd:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+    1dc2:	75 b4                	jne    1d78 <printint64+0x49>
+
+  if (sgn)
+    1dc4:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+    1dc8:	74 2b                	je     1df5 <printint64+0xc6>
+    buf[i++] = '-';
+    1dca:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1dcd:	8d 50 01             	lea    0x1(%rax),%edx
+    1dd0:	89 55 fc             	mov    %edx,-0x4(%rbp)
+    1dd3:	48 98                	cltq
+    1dd5:	c6 44 05 d0 2d       	movb   $0x2d,-0x30(%rbp,%rax,1)
+
+  while (--i >= 0)
+    1dda:	eb 19                	jmp    1df5 <printint64+0xc6>
+    putc(fd, buf[i]);
+    1ddc:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1ddf:	48 98                	cltq
+    1de1:	0f b6 44 05 d0       	movzbl -0x30(%rbp,%rax,1),%eax
+    1de6:	0f be d0             	movsbl %al,%edx
+    1de9:	8b 45 cc             	mov    -0x34(%rbp),%eax
+    1dec:	89 d6                	mov    %edx,%esi
+    1dee:	89 c7                	mov    %eax,%edi
+    1df0:	e8 11 ff ff ff       	call   1d06 <putc>
+  while (--i >= 0)
+    1df5:	83 6d fc 01          	subl   $0x1,-0x4(%rbp)
+    1df9:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+    1dfd:	79 dd                	jns    1ddc <printint64+0xad>
+}
+    1dff:	90                   	nop
+    1e00:	90                   	nop
+    1e01:	c9                   	leave
+    1e02:	c3                   	ret
+
+0000000000001e03 <printint>:
+
+static void printint(int fd, int xx, int base, int sgn) {
+    1e03:	55                   	push   %rbp
+    1e04:	48 89 e5             	mov    %rsp,%rbp
+    1e07:	48 83 ec 30          	sub    $0x30,%rsp
+    1e0b:	89 7d dc             	mov    %edi,-0x24(%rbp)
+    1e0e:	89 75 d8             	mov    %esi,-0x28(%rbp)
+    1e11:	89 55 d4             	mov    %edx,-0x2c(%rbp)
+    1e14:	89 4d d0             	mov    %ecx,-0x30(%rbp)
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+    1e17:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+  if (sgn && xx < 0) {
+    1e1e:	83 7d d0 00          	cmpl   $0x0,-0x30(%rbp)
+    1e22:	74 17                	je     1e3b <printint+0x38>
+    1e24:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+    1e28:	79 11                	jns    1e3b <printint+0x38>
+    neg = 1;
+    1e2a:	c7 45 f8 01 00 00 00 	movl   $0x1,-0x8(%rbp)
+    x = -xx;
+    1e31:	8b 45 d8             	mov    -0x28(%rbp),%eax
+    1e34:	f7 d8                	neg    %eax
+    1e36:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    1e39:	eb 06                	jmp    1e41 <printint+0x3e>
+  } else {
+    x = xx;
+    1e3b:	8b 45 d8             	mov    -0x28(%rbp),%eax
+    1e3e:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  }
+
+  i = 0;
+    1e41:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  do {
+    buf[i++] = digits[x % base];
+    1e48:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+    1e4b:	8b 45 f4             	mov    -0xc(%rbp),%eax
+    1e4e:	ba 00 00 00 00       	mov    $0x0,%edx
+    1e53:	f7 f1                	div    %ecx
+    1e55:	89 d1                	mov    %edx,%ecx
+    1e57:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1e5a:	8d 50 01             	lea    0x1(%rax),%edx
+    1e5d:	89 55 fc             	mov    %edx,-0x4(%rbp)
+    1e60:	89 c9                	mov    %ecx,%ecx
+    1e62:	48 8d 15 c7 14 00 00 	lea    0x14c7(%rip),%rdx        # 3330 <digits.0>
+    1e69:	0f b6 14 11          	movzbl (%rcx,%rdx,1),%edx
+    1e6d:	48 98                	cltq
+    1e6f:	88 54 05 e4          	mov    %dl,-0x1c(%rbp,%rax,1)
+  } while ((x /= base) != 0);
+    1e73:	8b 75 d4             	mov    -0x2c(%rbp),%esi
+    1e76:	8b 45 f4             	mov    -0xc(%rbp),%eax
+    1e79:	ba 00 00 00 00       	mov    $0x0,%edx
+    1e7e:	f7 f6                	div    %esi
+    1e80:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    1e83:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+    1e87:	75 bf                	jne    1e48 <printint+0x45>
+  if (neg)
+    1e89:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+    1e8d:	74 2b                	je     1eba <printint+0xb7>
+    buf[i++] = '-';
+    1e8f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1e92:	8d 50 01             	lea    0x1(%rax),%edx
+    1e95:	89 55 fc             	mov    %edx,-0x4(%rbp)
+    1e98:	48 98                	cltq
+    1e9a:	c6 44 05 e4 2d       	movb   $0x2d,-0x1c(%rbp,%rax,1)
+
+  while (--i >= 0)
+    1e9f:	eb 19                	jmp    1eba <printint+0xb7>
+    putc(fd, buf[i]);
+    1ea1:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1ea4:	48 98                	cltq
+    1ea6:	0f b6 44 05 e4       	movzbl -0x1c(%rbp,%rax,1),%eax
+    1eab:	0f be d0             	movsbl %al,%edx
+    1eae:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1eb1:	89 d6                	mov    %edx,%esi
+    1eb3:	89 c7                	mov    %eax,%edi
+    1eb5:	e8 4c fe ff ff       	call   1d06 <putc>
+  while (--i >= 0)
+    1eba:	83 6d fc 01          	subl   $0x1,-0x4(%rbp)
+    1ebe:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+    1ec2:	79 dd                	jns    1ea1 <printint+0x9e>
+}
+    1ec4:	90                   	nop
+    1ec5:	90                   	nop
+    1ec6:	c9                   	leave
+    1ec7:	c3                   	ret
+
+0000000000001ec8 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void printf(int fd, char *fmt, ...) {
+    1ec8:	55                   	push   %rbp
+    1ec9:	48 89 e5             	mov    %rsp,%rbp
+    1ecc:	48 83 ec 70          	sub    $0x70,%rsp
+    1ed0:	89 7d 9c             	mov    %edi,-0x64(%rbp)
+    1ed3:	48 89 75 90          	mov    %rsi,-0x70(%rbp)
+    1ed7:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+    1edb:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+    1edf:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+    1ee3:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+  char *s;
+  int c, i, state;
+  int lflag;
+  va_list valist;
+  va_start(valist, fmt);
+    1ee7:	c7 45 a0 10 00 00 00 	movl   $0x10,-0x60(%rbp)
+    1eee:	48 8d 45 10          	lea    0x10(%rbp),%rax
+    1ef2:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+    1ef6:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+    1efa:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+
+  state = 0;
+    1efe:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%rbp)
+  for (i = 0; fmt[i]; i++) {
+    1f05:	c7 45 c4 00 00 00 00 	movl   $0x0,-0x3c(%rbp)
+    1f0c:	e9 6b 02 00 00       	jmp    217c <printf+0x2b4>
+    c = fmt[i] & 0xff;
+    1f11:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+    1f14:	48 63 d0             	movslq %eax,%rdx
+    1f17:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+    1f1b:	48 01 d0             	add    %rdx,%rax
+    1f1e:	0f b6 00             	movzbl (%rax),%eax
+    1f21:	0f be c0             	movsbl %al,%eax
+    1f24:	25 ff 00 00 00       	and    $0xff,%eax
+    1f29:	89 45 b8             	mov    %eax,-0x48(%rbp)
+    if (state == 0) {
+    1f2c:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+    1f30:	75 30                	jne    1f62 <printf+0x9a>
+      if (c == '%') {
+    1f32:	83 7d b8 25          	cmpl   $0x25,-0x48(%rbp)
+    1f36:	75 13                	jne    1f4b <printf+0x83>
+        state = '%';
+    1f38:	c7 45 c0 25 00 00 00 	movl   $0x25,-0x40(%rbp)
+        lflag = 0;
+    1f3f:	c7 45 bc 00 00 00 00 	movl   $0x0,-0x44(%rbp)
+    1f46:	e9 2d 02 00 00       	jmp    2178 <printf+0x2b0>
+      } else {
+        putc(fd, c);
+    1f4b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+    1f4e:	0f be d0             	movsbl %al,%edx
+    1f51:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    1f54:	89 d6                	mov    %edx,%esi
+    1f56:	89 c7                	mov    %eax,%edi
+    1f58:	e8 a9 fd ff ff       	call   1d06 <putc>
+    1f5d:	e9 16 02 00 00       	jmp    2178 <printf+0x2b0>
+      }
+    } else if (state == '%') {
+    1f62:	83 7d c0 25          	cmpl   $0x25,-0x40(%rbp)
+    1f66:	0f 85 0c 02 00 00    	jne    2178 <printf+0x2b0>
+      if (c == 'l') {
+    1f6c:	83 7d b8 6c          	cmpl   $0x6c,-0x48(%rbp)
+    1f70:	75 0c                	jne    1f7e <printf+0xb6>
+        lflag = 1;
+    1f72:	c7 45 bc 01 00 00 00 	movl   $0x1,-0x44(%rbp)
+        continue;
+    1f79:	e9 fa 01 00 00       	jmp    2178 <printf+0x2b0>
+      } else if (c == 'd') {
+    1f7e:	83 7d b8 64          	cmpl   $0x64,-0x48(%rbp)
+    1f82:	0f 85 95 00 00 00    	jne    201d <printf+0x155>
+        if (lflag == 1)
+    1f88:	83 7d bc 01          	cmpl   $0x1,-0x44(%rbp)
+    1f8c:	75 49                	jne    1fd7 <printf+0x10f>
+          printint64(fd, va_arg(valist, int64_t), 10, 1);
+    1f8e:	8b 45 a0             	mov    -0x60(%rbp),%eax
+    1f91:	83 f8 2f             	cmp    $0x2f,%eax
+    1f94:	77 17                	ja     1fad <printf+0xe5>
+    1f96:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    1f9a:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    1f9d:	89 d2                	mov    %edx,%edx
+    1f9f:	48 01 d0             	add    %rdx,%rax
+    1fa2:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    1fa5:	83 c2 08             	add    $0x8,%edx
+    1fa8:	89 55 a0             	mov    %edx,-0x60(%rbp)
+    1fab:	eb 0c                	jmp    1fb9 <printf+0xf1>
+    1fad:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+    1fb1:	48 8d 50 08          	lea    0x8(%rax),%rdx
+    1fb5:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    1fb9:	48 8b 00             	mov    (%rax),%rax
+    1fbc:	89 c6                	mov    %eax,%esi
+    1fbe:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    1fc1:	b9 01 00 00 00       	mov    $0x1,%ecx
+    1fc6:	ba 0a 00 00 00       	mov    $0xa,%edx
+    1fcb:	89 c7                	mov    %eax,%edi
+    1fcd:	e8 5d fd ff ff       	call   1d2f <printint64>
+    1fd2:	e9 9a 01 00 00       	jmp    2171 <printf+0x2a9>
+        else
+          printint(fd, va_arg(valist, int), 10, 1);
+    1fd7:	8b 45 a0             	mov    -0x60(%rbp),%eax
+    1fda:	83 f8 2f             	cmp    $0x2f,%eax
+    1fdd:	77 17                	ja     1ff6 <printf+0x12e>
+    1fdf:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    1fe3:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    1fe6:	89 d2                	mov    %edx,%edx
+    1fe8:	48 01 d0             	add    %rdx,%rax
+    1feb:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    1fee:	83 c2 08             	add    $0x8,%edx
+    1ff1:	89 55 a0             	mov    %edx,-0x60(%rbp)
+    1ff4:	eb 0c                	jmp    2002 <printf+0x13a>
+    1ff6:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+    1ffa:	48 8d 50 08          	lea    0x8(%rax),%rdx
+    1ffe:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    2002:	8b 30                	mov    (%rax),%esi
+    2004:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    2007:	b9 01 00 00 00       	mov    $0x1,%ecx
+    200c:	ba 0a 00 00 00       	mov    $0xa,%edx
+    2011:	89 c7                	mov    %eax,%edi
+    2013:	e8 eb fd ff ff       	call   1e03 <printint>
+    2018:	e9 54 01 00 00       	jmp    2171 <printf+0x2a9>
+      } else if (c == 'x' || c == 'p') {
+    201d:	83 7d b8 78          	cmpl   $0x78,-0x48(%rbp)
+    2021:	74 0a                	je     202d <printf+0x165>
+    2023:	83 7d b8 70          	cmpl   $0x70,-0x48(%rbp)
+    2027:	0f 85 95 00 00 00    	jne    20c2 <printf+0x1fa>
+        if (lflag == 1)
+    202d:	83 7d bc 01          	cmpl   $0x1,-0x44(%rbp)
+    2031:	75 49                	jne    207c <printf+0x1b4>
+          printint64(fd, va_arg(valist, int64_t), 16, 0);
+    2033:	8b 45 a0             	mov    -0x60(%rbp),%eax
+    2036:	83 f8 2f             	cmp    $0x2f,%eax
+    2039:	77 17                	ja     2052 <printf+0x18a>
+    203b:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    203f:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    2042:	89 d2                	mov    %edx,%edx
+    2044:	48 01 d0             	add    %rdx,%rax
+    2047:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    204a:	83 c2 08             	add    $0x8,%edx
+    204d:	89 55 a0             	mov    %edx,-0x60(%rbp)
+    2050:	eb 0c                	jmp    205e <printf+0x196>
+    2052:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+    2056:	48 8d 50 08          	lea    0x8(%rax),%rdx
+    205a:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    205e:	48 8b 00             	mov    (%rax),%rax
+    2061:	89 c6                	mov    %eax,%esi
+    2063:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    2066:	b9 00 00 00 00       	mov    $0x0,%ecx
+    206b:	ba 10 00 00 00       	mov    $0x10,%edx
+    2070:	89 c7                	mov    %eax,%edi
+    2072:	e8 b8 fc ff ff       	call   1d2f <printint64>
+        if (lflag == 1)
+    2077:	e9 f5 00 00 00       	jmp    2171 <printf+0x2a9>
+        else
+          printint(fd, va_arg(valist, int), 16, 0);
+    207c:	8b 45 a0             	mov    -0x60(%rbp),%eax
+    207f:	83 f8 2f             	cmp    $0x2f,%eax
+    2082:	77 17                	ja     209b <printf+0x1d3>
+    2084:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    2088:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    208b:	89 d2                	mov    %edx,%edx
+    208d:	48 01 d0             	add    %rdx,%rax
+    2090:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    2093:	83 c2 08             	add    $0x8,%edx
+    2096:	89 55 a0             	mov    %edx,-0x60(%rbp)
+    2099:	eb 0c                	jmp    20a7 <printf+0x1df>
+    209b:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+    209f:	48 8d 50 08          	lea    0x8(%rax),%rdx
+    20a3:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    20a7:	8b 30                	mov    (%rax),%esi
+    20a9:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    20ac:	b9 00 00 00 00       	mov    $0x0,%ecx
+    20b1:	ba 10 00 00 00       	mov    $0x10,%edx
+    20b6:	89 c7                	mov    %eax,%edi
+    20b8:	e8 46 fd ff ff       	call   1e03 <printint>
+        if (lflag == 1)
+    20bd:	e9 af 00 00 00       	jmp    2171 <printf+0x2a9>
+      } else if (c == 's') {
+    20c2:	83 7d b8 73          	cmpl   $0x73,-0x48(%rbp)
+    20c6:	75 6e                	jne    2136 <printf+0x26e>
+        if ((s = (char *)va_arg(valist, char *)) == 0)
+    20c8:	8b 45 a0             	mov    -0x60(%rbp),%eax
+    20cb:	83 f8 2f             	cmp    $0x2f,%eax
+    20ce:	77 17                	ja     20e7 <printf+0x21f>
+    20d0:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    20d4:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    20d7:	89 d2                	mov    %edx,%edx
+    20d9:	48 01 d0             	add    %rdx,%rax
+    20dc:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    20df:	83 c2 08             	add    $0x8,%edx
+    20e2:	89 55 a0             	mov    %edx,-0x60(%rbp)
+    20e5:	eb 0c                	jmp    20f3 <printf+0x22b>
+    20e7:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+    20eb:	48 8d 50 08          	lea    0x8(%rax),%rdx
+    20ef:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    20f3:	48 8b 00             	mov    (%rax),%rax
+    20f6:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    20fa:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+    20ff:	75 28                	jne    2129 <printf+0x261>
+          s = "(null)";
+    2101:	48 8d 05 74 0e 00 00 	lea    0xe74(%rip),%rax        # 2f7c <malloc+0x8c6>
+    2108:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        for (; *s; s++)
+    210c:	eb 1b                	jmp    2129 <printf+0x261>
+          putc(fd, *s);
+    210e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    2112:	0f b6 00             	movzbl (%rax),%eax
+    2115:	0f be d0             	movsbl %al,%edx
+    2118:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    211b:	89 d6                	mov    %edx,%esi
+    211d:	89 c7                	mov    %eax,%edi
+    211f:	e8 e2 fb ff ff       	call   1d06 <putc>
+        for (; *s; s++)
+    2124:	48 83 45 c8 01       	addq   $0x1,-0x38(%rbp)
+    2129:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    212d:	0f b6 00             	movzbl (%rax),%eax
+    2130:	84 c0                	test   %al,%al
+    2132:	75 da                	jne    210e <printf+0x246>
+    2134:	eb 3b                	jmp    2171 <printf+0x2a9>
+      } else if (c == '%') {
+    2136:	83 7d b8 25          	cmpl   $0x25,-0x48(%rbp)
+    213a:	75 14                	jne    2150 <printf+0x288>
+        putc(fd, c);
+    213c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+    213f:	0f be d0             	movsbl %al,%edx
+    2142:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    2145:	89 d6                	mov    %edx,%esi
+    2147:	89 c7                	mov    %eax,%edi
+    2149:	e8 b8 fb ff ff       	call   1d06 <putc>
+    214e:	eb 21                	jmp    2171 <printf+0x2a9>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+    2150:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    2153:	be 25 00 00 00       	mov    $0x25,%esi
+    2158:	89 c7                	mov    %eax,%edi
+    215a:	e8 a7 fb ff ff       	call   1d06 <putc>
+        putc(fd, c);
+    215f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+    2162:	0f be d0             	movsbl %al,%edx
+    2165:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    2168:	89 d6                	mov    %edx,%esi
+    216a:	89 c7                	mov    %eax,%edi
+    216c:	e8 95 fb ff ff       	call   1d06 <putc>
+      }
+      state = 0;
+    2171:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%rbp)
+  for (i = 0; fmt[i]; i++) {
+    2178:	83 45 c4 01          	addl   $0x1,-0x3c(%rbp)
+    217c:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+    217f:	48 63 d0             	movslq %eax,%rdx
+    2182:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+    2186:	48 01 d0             	add    %rdx,%rax
+    2189:	0f b6 00             	movzbl (%rax),%eax
+    218c:	84 c0                	test   %al,%al
+    218e:	0f 85 7d fd ff ff    	jne    1f11 <printf+0x49>
+    }
+  }
+
+  va_end(valist);
+}
+    2194:	90                   	nop
+    2195:	90                   	nop
+    2196:	c9                   	leave
+    2197:	c3                   	ret
+
+0000000000002198 <stosb>:
+      break;
+    buf[i++] = c;
+    if (c == '\n' || c == '\r')
+      break;
+  }
+  buf[i] = '\0';
+    2198:	55                   	push   %rbp
+    2199:	48 89 e5             	mov    %rsp,%rbp
+    219c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    21a0:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    21a3:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  return buf;
+    21a6:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+    21aa:	8b 55 f0             	mov    -0x10(%rbp),%edx
+    21ad:	8b 45 f4             	mov    -0xc(%rbp),%eax
+    21b0:	48 89 ce             	mov    %rcx,%rsi
+    21b3:	48 89 f7             	mov    %rsi,%rdi
+    21b6:	89 d1                	mov    %edx,%ecx
+    21b8:	fc                   	cld
+    21b9:	f3 aa                	rep stos %al,%es:(%rdi)
+    21bb:	89 ca                	mov    %ecx,%edx
+    21bd:	48 89 fe             	mov    %rdi,%rsi
+    21c0:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+    21c4:	89 55 f0             	mov    %edx,-0x10(%rbp)
+}
+
+int stat(char *n, struct stat *st) {
+  int fd;
+    21c7:	90                   	nop
+    21c8:	5d                   	pop    %rbp
+    21c9:	c3                   	ret
+
+00000000000021ca <strcpy>:
+char *strcpy(char *s, char *t) {
+    21ca:	55                   	push   %rbp
+    21cb:	48 89 e5             	mov    %rsp,%rbp
+    21ce:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    21d2:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  os = s;
+    21d6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    21da:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while ((*s++ = *t++) != 0)
+    21de:	90                   	nop
+    21df:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    21e3:	48 8d 42 01          	lea    0x1(%rdx),%rax
+    21e7:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    21eb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    21ef:	48 8d 48 01          	lea    0x1(%rax),%rcx
+    21f3:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+    21f7:	0f b6 12             	movzbl (%rdx),%edx
+    21fa:	88 10                	mov    %dl,(%rax)
+    21fc:	0f b6 00             	movzbl (%rax),%eax
+    21ff:	84 c0                	test   %al,%al
+    2201:	75 dc                	jne    21df <strcpy+0x15>
+  return os;
+    2203:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    2207:	5d                   	pop    %rbp
+    2208:	c3                   	ret
+
+0000000000002209 <strcmp>:
+int strcmp(const char *p, const char *q) {
+    2209:	55                   	push   %rbp
+    220a:	48 89 e5             	mov    %rsp,%rbp
+    220d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2211:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  while (*p && *p == *q)
+    2215:	eb 0a                	jmp    2221 <strcmp+0x18>
+    p++, q++;
+    2217:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    221c:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (*p && *p == *q)
+    2221:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2225:	0f b6 00             	movzbl (%rax),%eax
+    2228:	84 c0                	test   %al,%al
+    222a:	74 12                	je     223e <strcmp+0x35>
+    222c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2230:	0f b6 10             	movzbl (%rax),%edx
+    2233:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2237:	0f b6 00             	movzbl (%rax),%eax
+    223a:	38 c2                	cmp    %al,%dl
+    223c:	74 d9                	je     2217 <strcmp+0xe>
+  return (uchar)*p - (uchar)*q;
+    223e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2242:	0f b6 00             	movzbl (%rax),%eax
+    2245:	0f b6 d0             	movzbl %al,%edx
+    2248:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    224c:	0f b6 00             	movzbl (%rax),%eax
+    224f:	0f b6 c0             	movzbl %al,%eax
+    2252:	29 c2                	sub    %eax,%edx
+    2254:	89 d0                	mov    %edx,%eax
+}
+    2256:	5d                   	pop    %rbp
+    2257:	c3                   	ret
+
+0000000000002258 <strlen>:
+uint strlen(char *s) {
+    2258:	55                   	push   %rbp
+    2259:	48 89 e5             	mov    %rsp,%rbp
+    225c:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  for (n = 0; s[n]; n++)
+    2260:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+    2267:	eb 04                	jmp    226d <strlen+0x15>
+    2269:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+    226d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    2270:	48 63 d0             	movslq %eax,%rdx
+    2273:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2277:	48 01 d0             	add    %rdx,%rax
+    227a:	0f b6 00             	movzbl (%rax),%eax
+    227d:	84 c0                	test   %al,%al
+    227f:	75 e8                	jne    2269 <strlen+0x11>
+  return n;
+    2281:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+    2284:	5d                   	pop    %rbp
+    2285:	c3                   	ret
+
+0000000000002286 <memset>:
+void *memset(void *dst, int c, uint n) {
+    2286:	55                   	push   %rbp
+    2287:	48 89 e5             	mov    %rsp,%rbp
+    228a:	48 83 ec 10          	sub    $0x10,%rsp
+    228e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2292:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    2295:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  stosb(dst, c, n);
+    2298:	8b 55 f0             	mov    -0x10(%rbp),%edx
+    229b:	8b 4d f4             	mov    -0xc(%rbp),%ecx
+    229e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    22a2:	89 ce                	mov    %ecx,%esi
+    22a4:	48 89 c7             	mov    %rax,%rdi
+    22a7:	e8 ec fe ff ff       	call   2198 <stosb>
+  return dst;
+    22ac:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    22b0:	c9                   	leave
+    22b1:	c3                   	ret
+
+00000000000022b2 <strchr>:
+char *strchr(const char *s, char c) {
+    22b2:	55                   	push   %rbp
+    22b3:	48 89 e5             	mov    %rsp,%rbp
+    22b6:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    22ba:	89 f0                	mov    %esi,%eax
+    22bc:	88 45 f4             	mov    %al,-0xc(%rbp)
+  for (; *s; s++)
+    22bf:	eb 17                	jmp    22d8 <strchr+0x26>
+    if (*s == c)
+    22c1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    22c5:	0f b6 00             	movzbl (%rax),%eax
+    22c8:	38 45 f4             	cmp    %al,-0xc(%rbp)
+    22cb:	75 06                	jne    22d3 <strchr+0x21>
+      return (char *)s;
+    22cd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    22d1:	eb 15                	jmp    22e8 <strchr+0x36>
+  for (; *s; s++)
+    22d3:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    22d8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    22dc:	0f b6 00             	movzbl (%rax),%eax
+    22df:	84 c0                	test   %al,%al
+    22e1:	75 de                	jne    22c1 <strchr+0xf>
+  return 0;
+    22e3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    22e8:	5d                   	pop    %rbp
+    22e9:	c3                   	ret
+
+00000000000022ea <gets>:
+char *gets(char *buf, int max) {
+    22ea:	55                   	push   %rbp
+    22eb:	48 89 e5             	mov    %rsp,%rbp
+    22ee:	48 83 ec 20          	sub    $0x20,%rsp
+    22f2:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    22f6:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  for (i = 0; i + 1 < max;) {
+    22f9:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+    2300:	eb 48                	jmp    234a <gets+0x60>
+    cc = read(0, &c, 1);
+    2302:	48 8d 45 f7          	lea    -0x9(%rbp),%rax
+    2306:	ba 01 00 00 00       	mov    $0x1,%edx
+    230b:	48 89 c6             	mov    %rax,%rsi
+    230e:	bf 00 00 00 00       	mov    $0x0,%edi
+    2313:	e8 6f 01 00 00       	call   2487 <read>
+    2318:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    if (cc < 1)
+    231b:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+    231f:	7e 36                	jle    2357 <gets+0x6d>
+    buf[i++] = c;
+    2321:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    2324:	8d 50 01             	lea    0x1(%rax),%edx
+    2327:	89 55 fc             	mov    %edx,-0x4(%rbp)
+    232a:	48 63 d0             	movslq %eax,%rdx
+    232d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2331:	48 01 c2             	add    %rax,%rdx
+    2334:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+    2338:	88 02                	mov    %al,(%rdx)
+    if (c == '\n' || c == '\r')
+    233a:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+    233e:	3c 0a                	cmp    $0xa,%al
+    2340:	74 16                	je     2358 <gets+0x6e>
+    2342:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+    2346:	3c 0d                	cmp    $0xd,%al
+    2348:	74 0e                	je     2358 <gets+0x6e>
+  for (i = 0; i + 1 < max;) {
+    234a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    234d:	83 c0 01             	add    $0x1,%eax
+    2350:	39 45 e4             	cmp    %eax,-0x1c(%rbp)
+    2353:	7f ad                	jg     2302 <gets+0x18>
+    2355:	eb 01                	jmp    2358 <gets+0x6e>
+      break;
+    2357:	90                   	nop
+  buf[i] = '\0';
+    2358:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    235b:	48 63 d0             	movslq %eax,%rdx
+    235e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2362:	48 01 d0             	add    %rdx,%rax
+    2365:	c6 00 00             	movb   $0x0,(%rax)
+  return buf;
+    2368:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+    236c:	c9                   	leave
+    236d:	c3                   	ret
+
+000000000000236e <stat>:
+int stat(char *n, struct stat *st) {
+    236e:	55                   	push   %rbp
+    236f:	48 89 e5             	mov    %rsp,%rbp
+    2372:	48 83 ec 20          	sub    $0x20,%rsp
+    2376:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    237a:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int r;
+
+  fd = open(n, O_RDONLY);
+    237e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2382:	be 00 00 00 00       	mov    $0x0,%esi
+    2387:	48 89 c7             	mov    %rax,%rdi
+    238a:	e8 20 01 00 00       	call   24af <open>
+    238f:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  if (fd < 0)
+    2392:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+    2396:	79 07                	jns    239f <stat+0x31>
+    return -1;
+    2398:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    239d:	eb 21                	jmp    23c0 <stat+0x52>
+  r = fstat(fd, st);
+    239f:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    23a3:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    23a6:	48 89 d6             	mov    %rdx,%rsi
+    23a9:	89 c7                	mov    %eax,%edi
+    23ab:	e8 17 01 00 00       	call   24c7 <fstat>
+    23b0:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  close(fd);
+    23b3:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    23b6:	89 c7                	mov    %eax,%edi
+    23b8:	e8 da 00 00 00       	call   2497 <close>
+  return r;
+    23bd:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+    23c0:	c9                   	leave
+    23c1:	c3                   	ret
+
+00000000000023c2 <atoi>:
+
+int atoi(const char *s) {
+    23c2:	55                   	push   %rbp
+    23c3:	48 89 e5             	mov    %rsp,%rbp
+    23c6:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int n;
+
+  n = 0;
+    23ca:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  while ('0' <= *s && *s <= '9')
+    23d1:	eb 28                	jmp    23fb <atoi+0x39>
+    n = n * 10 + *s++ - '0';
+    23d3:	8b 55 fc             	mov    -0x4(%rbp),%edx
+    23d6:	89 d0                	mov    %edx,%eax
+    23d8:	c1 e0 02             	shl    $0x2,%eax
+    23db:	01 d0                	add    %edx,%eax
+    23dd:	01 c0                	add    %eax,%eax
+    23df:	89 c1                	mov    %eax,%ecx
+    23e1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    23e5:	48 8d 50 01          	lea    0x1(%rax),%rdx
+    23e9:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    23ed:	0f b6 00             	movzbl (%rax),%eax
+    23f0:	0f be c0             	movsbl %al,%eax
+    23f3:	01 c8                	add    %ecx,%eax
+    23f5:	83 e8 30             	sub    $0x30,%eax
+    23f8:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while ('0' <= *s && *s <= '9')
+    23fb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    23ff:	0f b6 00             	movzbl (%rax),%eax
+    2402:	3c 2f                	cmp    $0x2f,%al
+    2404:	7e 0b                	jle    2411 <atoi+0x4f>
+    2406:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    240a:	0f b6 00             	movzbl (%rax),%eax
+    240d:	3c 39                	cmp    $0x39,%al
+    240f:	7e c2                	jle    23d3 <atoi+0x11>
+  return n;
+    2411:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+    2414:	5d                   	pop    %rbp
+    2415:	c3                   	ret
+
+0000000000002416 <memmove>:
+
+void *memmove(void *vdst, void *vsrc, int n) {
+    2416:	55                   	push   %rbp
+    2417:	48 89 e5             	mov    %rsp,%rbp
+    241a:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    241e:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    2422:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  char *dst, *src;
+
+  dst = vdst;
+    2425:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2429:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  src = vsrc;
+    242d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2431:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  while (n-- > 0)
+    2435:	eb 1d                	jmp    2454 <memmove+0x3e>
+    *dst++ = *src++;
+    2437:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    243b:	48 8d 42 01          	lea    0x1(%rdx),%rax
+    243f:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    2443:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2447:	48 8d 48 01          	lea    0x1(%rax),%rcx
+    244b:	48 89 4d f8          	mov    %rcx,-0x8(%rbp)
+    244f:	0f b6 12             	movzbl (%rdx),%edx
+    2452:	88 10                	mov    %dl,(%rax)
+  while (n-- > 0)
+    2454:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    2457:	8d 50 ff             	lea    -0x1(%rax),%edx
+    245a:	89 55 dc             	mov    %edx,-0x24(%rbp)
+    245d:	85 c0                	test   %eax,%eax
+    245f:	7f d6                	jg     2437 <memmove+0x21>
+  return vdst;
+    2461:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2465:	5d                   	pop    %rbp
+    2466:	c3                   	ret
+
+0000000000002467 <fork>:
+  name:                                                                        \
+  movl $SYS_##name, % eax;                                                     \
+  int $TRAP_SYSCALL;                                                           \
+  ret
+
+SYSCALL(fork)
+    2467:	b8 01 00 00 00       	mov    $0x1,%eax
+    246c:	cd 40                	int    $0x40
+    246e:	c3                   	ret
+
+000000000000246f <exit>:
+SYSCALL(exit)
+    246f:	b8 02 00 00 00       	mov    $0x2,%eax
+    2474:	cd 40                	int    $0x40
+    2476:	c3                   	ret
+
+0000000000002477 <wait>:
+SYSCALL(wait)
+    2477:	b8 03 00 00 00       	mov    $0x3,%eax
+    247c:	cd 40                	int    $0x40
+    247e:	c3                   	ret
+
+000000000000247f <pipe>:
+SYSCALL(pipe)
+    247f:	b8 04 00 00 00       	mov    $0x4,%eax
+    2484:	cd 40                	int    $0x40
+    2486:	c3                   	ret
+
+0000000000002487 <read>:
+SYSCALL(read)
+    2487:	b8 05 00 00 00       	mov    $0x5,%eax
+    248c:	cd 40                	int    $0x40
+    248e:	c3                   	ret
+
+000000000000248f <write>:
+SYSCALL(write)
+    248f:	b8 10 00 00 00       	mov    $0x10,%eax
+    2494:	cd 40                	int    $0x40
+    2496:	c3                   	ret
+
+0000000000002497 <close>:
+SYSCALL(close)
+    2497:	b8 15 00 00 00       	mov    $0x15,%eax
+    249c:	cd 40                	int    $0x40
+    249e:	c3                   	ret
+
+000000000000249f <kill>:
+SYSCALL(kill)
+    249f:	b8 06 00 00 00       	mov    $0x6,%eax
+    24a4:	cd 40                	int    $0x40
+    24a6:	c3                   	ret
+
+00000000000024a7 <exec>:
+SYSCALL(exec)
+    24a7:	b8 07 00 00 00       	mov    $0x7,%eax
+    24ac:	cd 40                	int    $0x40
+    24ae:	c3                   	ret
+
+00000000000024af <open>:
+SYSCALL(open)
+    24af:	b8 0f 00 00 00       	mov    $0xf,%eax
+    24b4:	cd 40                	int    $0x40
+    24b6:	c3                   	ret
+
+00000000000024b7 <mknod>:
+SYSCALL(mknod)
+    24b7:	b8 11 00 00 00       	mov    $0x11,%eax
+    24bc:	cd 40                	int    $0x40
+    24be:	c3                   	ret
+
+00000000000024bf <unlink>:
+SYSCALL(unlink)
+    24bf:	b8 12 00 00 00       	mov    $0x12,%eax
+    24c4:	cd 40                	int    $0x40
+    24c6:	c3                   	ret
+
+00000000000024c7 <fstat>:
+SYSCALL(fstat)
+    24c7:	b8 08 00 00 00       	mov    $0x8,%eax
+    24cc:	cd 40                	int    $0x40
+    24ce:	c3                   	ret
+
+00000000000024cf <link>:
+SYSCALL(link)
+    24cf:	b8 13 00 00 00       	mov    $0x13,%eax
+    24d4:	cd 40                	int    $0x40
+    24d6:	c3                   	ret
+
+00000000000024d7 <mkdir>:
+SYSCALL(mkdir)
+    24d7:	b8 14 00 00 00       	mov    $0x14,%eax
+    24dc:	cd 40                	int    $0x40
+    24de:	c3                   	ret
+
+00000000000024df <chdir>:
+SYSCALL(chdir)
+    24df:	b8 09 00 00 00       	mov    $0x9,%eax
+    24e4:	cd 40                	int    $0x40
+    24e6:	c3                   	ret
+
+00000000000024e7 <dup>:
+SYSCALL(dup)
+    24e7:	b8 0a 00 00 00       	mov    $0xa,%eax
+    24ec:	cd 40                	int    $0x40
+    24ee:	c3                   	ret
+
+00000000000024ef <getpid>:
+SYSCALL(getpid)
+    24ef:	b8 0b 00 00 00       	mov    $0xb,%eax
+    24f4:	cd 40                	int    $0x40
+    24f6:	c3                   	ret
+
+00000000000024f7 <sbrk>:
+SYSCALL(sbrk)
+    24f7:	b8 0c 00 00 00       	mov    $0xc,%eax
+    24fc:	cd 40                	int    $0x40
+    24fe:	c3                   	ret
+
+00000000000024ff <sleep>:
+SYSCALL(sleep)
+    24ff:	b8 0d 00 00 00       	mov    $0xd,%eax
+    2504:	cd 40                	int    $0x40
+    2506:	c3                   	ret
+
+0000000000002507 <uptime>:
+SYSCALL(uptime)
+    2507:	b8 0e 00 00 00       	mov    $0xe,%eax
+    250c:	cd 40                	int    $0x40
+    250e:	c3                   	ret
+
+000000000000250f <sysinfo>:
+SYSCALL(sysinfo)
+    250f:	b8 16 00 00 00       	mov    $0x16,%eax
+    2514:	cd 40                	int    $0x40
+    2516:	c3                   	ret
+
+0000000000002517 <crashn>:
+SYSCALL(crashn)
+    2517:	b8 17 00 00 00       	mov    $0x17,%eax
+    251c:	cd 40                	int    $0x40
+    251e:	c3                   	ret
+
+000000000000251f <sync>:
+SYSCALL(sync)
+    251f:	b8 18 00 00 00       	mov    $0x18,%eax
+    2524:	cd 40                	int    $0x40
+    2526:	c3                   	ret
+
+0000000000002527 <fsync>:
+SYSCALL(fsync)
+    2527:	b8 19 00 00 00       	mov    $0x19,%eax
+    252c:	cd 40                	int    $0x40
+    252e:	c3                   	ret
+
+000000000000252f <free>:
+typedef union header Header;
+
+static Header base;
+static Header *freep;
+
+void free(void *ap) {
+    252f:	55                   	push   %rbp
+    2530:	48 89 e5             	mov    %rsp,%rbp
+    2533:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  Header *bp, *p;
+
+  bp = (Header *)ap - 1;
+    2537:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    253b:	48 83 e8 10          	sub    $0x10,%rax
+    253f:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  for (p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    2543:	48 8b 05 16 0e 00 00 	mov    0xe16(%rip),%rax        # 3360 <freep>
+    254a:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    254e:	eb 2f                	jmp    257f <free+0x50>
+    if (p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    2550:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2554:	48 8b 00             	mov    (%rax),%rax
+    2557:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+    255b:	72 17                	jb     2574 <free+0x45>
+    255d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2561:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+    2565:	72 2f                	jb     2596 <free+0x67>
+    2567:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    256b:	48 8b 00             	mov    (%rax),%rax
+    256e:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+    2572:	72 22                	jb     2596 <free+0x67>
+  for (p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    2574:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2578:	48 8b 00             	mov    (%rax),%rax
+    257b:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    257f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2583:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+    2587:	73 c7                	jae    2550 <free+0x21>
+    2589:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    258d:	48 8b 00             	mov    (%rax),%rax
+    2590:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+    2594:	73 ba                	jae    2550 <free+0x21>
+      break;
+  if (bp + bp->s.size == p->s.ptr) {
+    2596:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    259a:	8b 40 08             	mov    0x8(%rax),%eax
+    259d:	89 c0                	mov    %eax,%eax
+    259f:	48 c1 e0 04          	shl    $0x4,%rax
+    25a3:	48 89 c2             	mov    %rax,%rdx
+    25a6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    25aa:	48 01 c2             	add    %rax,%rdx
+    25ad:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    25b1:	48 8b 00             	mov    (%rax),%rax
+    25b4:	48 39 c2             	cmp    %rax,%rdx
+    25b7:	75 2d                	jne    25e6 <free+0xb7>
+    bp->s.size += p->s.ptr->s.size;
+    25b9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    25bd:	8b 50 08             	mov    0x8(%rax),%edx
+    25c0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    25c4:	48 8b 00             	mov    (%rax),%rax
+    25c7:	8b 40 08             	mov    0x8(%rax),%eax
+    25ca:	01 c2                	add    %eax,%edx
+    25cc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    25d0:	89 50 08             	mov    %edx,0x8(%rax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+    25d3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    25d7:	48 8b 00             	mov    (%rax),%rax
+    25da:	48 8b 10             	mov    (%rax),%rdx
+    25dd:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    25e1:	48 89 10             	mov    %rdx,(%rax)
+    25e4:	eb 0e                	jmp    25f4 <free+0xc5>
+  } else
+    bp->s.ptr = p->s.ptr;
+    25e6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    25ea:	48 8b 10             	mov    (%rax),%rdx
+    25ed:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    25f1:	48 89 10             	mov    %rdx,(%rax)
+  if (p + p->s.size == bp) {
+    25f4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    25f8:	8b 40 08             	mov    0x8(%rax),%eax
+    25fb:	89 c0                	mov    %eax,%eax
+    25fd:	48 c1 e0 04          	shl    $0x4,%rax
+    2601:	48 89 c2             	mov    %rax,%rdx
+    2604:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2608:	48 01 d0             	add    %rdx,%rax
+    260b:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+    260f:	75 27                	jne    2638 <free+0x109>
+    p->s.size += bp->s.size;
+    2611:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2615:	8b 50 08             	mov    0x8(%rax),%edx
+    2618:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    261c:	8b 40 08             	mov    0x8(%rax),%eax
+    261f:	01 c2                	add    %eax,%edx
+    2621:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2625:	89 50 08             	mov    %edx,0x8(%rax)
+    p->s.ptr = bp->s.ptr;
+    2628:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    262c:	48 8b 10             	mov    (%rax),%rdx
+    262f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2633:	48 89 10             	mov    %rdx,(%rax)
+    2636:	eb 0b                	jmp    2643 <free+0x114>
+  } else
+    p->s.ptr = bp;
+    2638:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    263c:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    2640:	48 89 10             	mov    %rdx,(%rax)
+  freep = p;
+    2643:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2647:	48 89 05 12 0d 00 00 	mov    %rax,0xd12(%rip)        # 3360 <freep>
+}
+    264e:	90                   	nop
+    264f:	5d                   	pop    %rbp
+    2650:	c3                   	ret
+
+0000000000002651 <morecore>:
+
+static Header *morecore(uint nu) {
+    2651:	55                   	push   %rbp
+    2652:	48 89 e5             	mov    %rsp,%rbp
+    2655:	48 83 ec 20          	sub    $0x20,%rsp
+    2659:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  char *p;
+  Header *hp;
+
+  if (nu < 4096)
+    265c:	81 7d ec ff 0f 00 00 	cmpl   $0xfff,-0x14(%rbp)
+    2663:	77 07                	ja     266c <morecore+0x1b>
+    nu = 4096;
+    2665:	c7 45 ec 00 10 00 00 	movl   $0x1000,-0x14(%rbp)
+  p = sbrk(nu * sizeof(Header));
+    266c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    266f:	c1 e0 04             	shl    $0x4,%eax
+    2672:	89 c7                	mov    %eax,%edi
+    2674:	e8 7e fe ff ff       	call   24f7 <sbrk>
+    2679:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (p == (char *)-1)
+    267d:	48 83 7d f8 ff       	cmpq   $0xffffffffffffffff,-0x8(%rbp)
+    2682:	75 07                	jne    268b <morecore+0x3a>
+    return 0;
+    2684:	b8 00 00 00 00       	mov    $0x0,%eax
+    2689:	eb 29                	jmp    26b4 <morecore+0x63>
+  hp = (Header *)p;
+    268b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    268f:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  hp->s.size = nu;
+    2693:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2697:	8b 55 ec             	mov    -0x14(%rbp),%edx
+    269a:	89 50 08             	mov    %edx,0x8(%rax)
+  free((void *)(hp + 1));
+    269d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    26a1:	48 83 c0 10          	add    $0x10,%rax
+    26a5:	48 89 c7             	mov    %rax,%rdi
+    26a8:	e8 82 fe ff ff       	call   252f <free>
+  return freep;
+    26ad:	48 8b 05 ac 0c 00 00 	mov    0xcac(%rip),%rax        # 3360 <freep>
+}
+    26b4:	c9                   	leave
+    26b5:	c3                   	ret
+
+00000000000026b6 <malloc>:
+
+void *malloc(uint nbytes) {
+    26b6:	55                   	push   %rbp
+    26b7:	48 89 e5             	mov    %rsp,%rbp
+    26ba:	48 83 ec 30          	sub    $0x30,%rsp
+    26be:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1) / sizeof(Header) + 1;
+    26c1:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    26c4:	48 83 c0 0f          	add    $0xf,%rax
+    26c8:	48 c1 e8 04          	shr    $0x4,%rax
+    26cc:	83 c0 01             	add    $0x1,%eax
+    26cf:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  if ((prevp = freep) == 0) {
+    26d2:	48 8b 05 87 0c 00 00 	mov    0xc87(%rip),%rax        # 3360 <freep>
+    26d9:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    26dd:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+    26e2:	75 2e                	jne    2712 <malloc+0x5c>
+    base.s.ptr = freep = prevp = &base;
+    26e4:	48 8d 05 65 0c 00 00 	lea    0xc65(%rip),%rax        # 3350 <base>
+    26eb:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    26ef:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    26f3:	48 89 05 66 0c 00 00 	mov    %rax,0xc66(%rip)        # 3360 <freep>
+    26fa:	48 8b 05 5f 0c 00 00 	mov    0xc5f(%rip),%rax        # 3360 <freep>
+    2701:	48 89 05 48 0c 00 00 	mov    %rax,0xc48(%rip)        # 3350 <base>
+    base.s.size = 0;
+    2708:	c7 05 46 0c 00 00 00 	movl   $0x0,0xc46(%rip)        # 3358 <base+0x8>
+    270f:	00 00 00 
+  }
+  for (p = prevp->s.ptr;; prevp = p, p = p->s.ptr) {
+    2712:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2716:	48 8b 00             	mov    (%rax),%rax
+    2719:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    if (p->s.size >= nunits) {
+    271d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2721:	8b 40 08             	mov    0x8(%rax),%eax
+    2724:	3b 45 ec             	cmp    -0x14(%rbp),%eax
+    2727:	72 5f                	jb     2788 <malloc+0xd2>
+      if (p->s.size == nunits)
+    2729:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    272d:	8b 40 08             	mov    0x8(%rax),%eax
+    2730:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+    2733:	75 10                	jne    2745 <malloc+0x8f>
+        prevp->s.ptr = p->s.ptr;
+    2735:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2739:	48 8b 10             	mov    (%rax),%rdx
+    273c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2740:	48 89 10             	mov    %rdx,(%rax)
+    2743:	eb 2e                	jmp    2773 <malloc+0xbd>
+      else {
+        p->s.size -= nunits;
+    2745:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2749:	8b 40 08             	mov    0x8(%rax),%eax
+    274c:	2b 45 ec             	sub    -0x14(%rbp),%eax
+    274f:	89 c2                	mov    %eax,%edx
+    2751:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2755:	89 50 08             	mov    %edx,0x8(%rax)
+        p += p->s.size;
+    2758:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    275c:	8b 40 08             	mov    0x8(%rax),%eax
+    275f:	89 c0                	mov    %eax,%eax
+    2761:	48 c1 e0 04          	shl    $0x4,%rax
+    2765:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+        p->s.size = nunits;
+    2769:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    276d:	8b 55 ec             	mov    -0x14(%rbp),%edx
+    2770:	89 50 08             	mov    %edx,0x8(%rax)
+      }
+      freep = prevp;
+    2773:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2777:	48 89 05 e2 0b 00 00 	mov    %rax,0xbe2(%rip)        # 3360 <freep>
+      return (void *)(p + 1);
+    277e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2782:	48 83 c0 10          	add    $0x10,%rax
+    2786:	eb 41                	jmp    27c9 <malloc+0x113>
+    }
+    if (p == freep)
+    2788:	48 8b 05 d1 0b 00 00 	mov    0xbd1(%rip),%rax        # 3360 <freep>
+    278f:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+    2793:	75 1c                	jne    27b1 <malloc+0xfb>
+      if ((p = morecore(nunits)) == 0)
+    2795:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    2798:	89 c7                	mov    %eax,%edi
+    279a:	e8 b2 fe ff ff       	call   2651 <morecore>
+    279f:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    27a3:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+    27a8:	75 07                	jne    27b1 <malloc+0xfb>
+        return 0;
+    27aa:	b8 00 00 00 00       	mov    $0x0,%eax
+    27af:	eb 18                	jmp    27c9 <malloc+0x113>
+  for (p = prevp->s.ptr;; prevp = p, p = p->s.ptr) {
+    27b1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    27b5:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    27b9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    27bd:	48 8b 00             	mov    (%rax),%rax
+    27c0:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    if (p->s.size >= nunits) {
+    27c4:	e9 54 ff ff ff       	jmp    271d <malloc+0x67>
+  }
+    27c9:	c9                   	leave
+    27ca:	c3                   	ret
@@ -0,0 +1,1296 @@
+
+out/user/_lab3init:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000000000 <main>:
+#include <stat.h>
+#include <user.h>
+
+char *argv[] = {"lab3test", 0};
+
+int main(void) {
+   0:	55                   	push   %rbp
+   1:	48 89 e5             	mov    %rsp,%rbp
+  if (open("console", O_RDWR) < 0) {
+   4:	be 02 00 00 00       	mov    $0x2,%esi
+   9:	48 8d 05 6b 0b 00 00 	lea    0xb6b(%rip),%rax        # b7b <malloc+0x11e>
+  10:	48 89 c7             	mov    %rax,%rdi
+  13:	e8 3e 08 00 00       	call   856 <open>
+  18:	85 c0                	test   %eax,%eax
+  1a:	79 2d                	jns    49 <main+0x49>
+    mknod("console", 1, 1);
+  1c:	ba 01 00 00 00       	mov    $0x1,%edx
+  21:	be 01 00 00 00       	mov    $0x1,%esi
+  26:	48 8d 05 4e 0b 00 00 	lea    0xb4e(%rip),%rax        # b7b <malloc+0x11e>
+  2d:	48 89 c7             	mov    %rax,%rdi
+  30:	e8 29 08 00 00       	call   85e <mknod>
+    open("console", O_RDWR);
+  35:	be 02 00 00 00       	mov    $0x2,%esi
+  3a:	48 8d 05 3a 0b 00 00 	lea    0xb3a(%rip),%rax        # b7b <malloc+0x11e>
+  41:	48 89 c7             	mov    %rax,%rdi
+  44:	e8 0d 08 00 00       	call   856 <open>
+  }
+  dup(0); // stdout
+  49:	bf 00 00 00 00       	mov    $0x0,%edi
+  4e:	e8 3b 08 00 00       	call   88e <dup>
+  dup(0); // stderr
+  53:	bf 00 00 00 00       	mov    $0x0,%edi
+  58:	e8 31 08 00 00       	call   88e <dup>
+  printf(1, "lab3init running\n");
+  5d:	48 8d 05 1f 0b 00 00 	lea    0xb1f(%rip),%rax        # b83 <malloc+0x126>
+  64:	48 89 c6             	mov    %rax,%rsi
+  67:	bf 01 00 00 00       	mov    $0x1,%edi
+  6c:	b8 00 00 00 00       	mov    $0x0,%eax
+  71:	e8 f9 01 00 00       	call   26f <printf>
+  exec("lab3test", argv);
+  76:	48 8d 05 93 0d 00 00 	lea    0xd93(%rip),%rax        # e10 <argv>
+  7d:	48 89 c6             	mov    %rax,%rsi
+  80:	48 8d 05 eb 0a 00 00 	lea    0xaeb(%rip),%rax        # b72 <malloc+0x115>
+  87:	48 89 c7             	mov    %rax,%rdi
+  8a:	e8 bf 07 00 00       	call   84e <exec>
+  printf(1, "lab3init: exec failed\n");
+  8f:	48 8d 05 ff 0a 00 00 	lea    0xaff(%rip),%rax        # b95 <malloc+0x138>
+  96:	48 89 c6             	mov    %rax,%rsi
+  99:	bf 01 00 00 00       	mov    $0x1,%edi
+  9e:	b8 00 00 00 00       	mov    $0x0,%eax
+  a3:	e8 c7 01 00 00       	call   26f <printf>
+  exit();
+  a8:	e8 69 07 00 00       	call   816 <exit>
+
+00000000000000ad <putc>:
+#include <cdefs.h>
+#include <stat.h>
+#include <stdarg.h>
+#include <user.h>
+
+static void putc(int fd, char c) { write(fd, &c, 1); }
+  ad:	55                   	push   %rbp
+  ae:	48 89 e5             	mov    %rsp,%rbp
+  b1:	48 83 ec 10          	sub    $0x10,%rsp
+  b5:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  b8:	89 f0                	mov    %esi,%eax
+  ba:	88 45 f8             	mov    %al,-0x8(%rbp)
+  bd:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+  c1:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  c4:	ba 01 00 00 00       	mov    $0x1,%edx
+  c9:	48 89 ce             	mov    %rcx,%rsi
+  cc:	89 c7                	mov    %eax,%edi
+  ce:	e8 63 07 00 00       	call   836 <write>
+  d3:	90                   	nop
+  d4:	c9                   	leave
+  d5:	c3                   	ret
+
+00000000000000d6 <printint64>:
+
+static void printint64(int fd, int xx, int base, int sgn) {
+  d6:	55                   	push   %rbp
+  d7:	48 89 e5             	mov    %rsp,%rbp
+  da:	48 83 ec 40          	sub    $0x40,%rsp
+  de:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  e1:	89 75 c8             	mov    %esi,-0x38(%rbp)
+  e4:	89 55 c4             	mov    %edx,-0x3c(%rbp)
+  e7:	89 4d c0             	mov    %ecx,-0x40(%rbp)
+  static char digits[] = "0123456789abcdef";
+  char buf[32];
+  int i;
+  uint64_t x;
+
+  if (sgn && (sgn = xx < 0))
+  ea:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+  ee:	74 1f                	je     10f <printint64+0x39>
+  f0:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  f3:	c1 e8 1f             	shr    $0x1f,%eax
+  f6:	0f b6 c0             	movzbl %al,%eax
+  f9:	89 45 c0             	mov    %eax,-0x40(%rbp)
+  fc:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+ 100:	74 0d                	je     10f <printint64+0x39>
+    x = -xx;
+ 102:	8b 45 c8             	mov    -0x38(%rbp),%eax
+ 105:	f7 d8                	neg    %eax
+ 107:	48 98                	cltq
+ 109:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+ 10d:	eb 09                	jmp    118 <printint64+0x42>
+  else
+    x = xx;
+ 10f:	8b 45 c8             	mov    -0x38(%rbp),%eax
+ 112:	48 98                	cltq
+ 114:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+  i = 0;
+ 118:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  do {
+    buf[i++] = digits[x % base];
+ 11f:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+ 122:	48 63 c8             	movslq %eax,%rcx
+ 125:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ 129:	ba 00 00 00 00       	mov    $0x0,%edx
+ 12e:	48 f7 f1             	div    %rcx
+ 131:	48 89 d1             	mov    %rdx,%rcx
+ 134:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 137:	8d 50 01             	lea    0x1(%rax),%edx
+ 13a:	89 55 fc             	mov    %edx,-0x4(%rbp)
+ 13d:	48 8d 15 dc 0c 00 00 	lea    0xcdc(%rip),%rdx        # e20 <digits.1>
+ 144:	0f b6 14 11          	movzbl (%rcx,%rdx,1),%edx
+ 148:	48 98                	cltq
+ 14a:	88 54 05 d0          	mov    %dl,-0x30(%rbp,%rax,1)
+  } while ((x /= base) != 0);
+ 14e:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+ 151:	48 63 f0             	movslq %eax,%rsi
+ 154:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ 158:	ba 00 00 00 00       	mov    $0x0,%edx
+ 15d:	48 f7 f6             	div    %rsi
+ 160:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+ 164:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+ 169:	75 b4                	jne    11f <printint64+0x49>
+
+  if (sgn)
+ 16b:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+ 16f:	74 2b                	je     19c <printint64+0xc6>
+    buf[i++] = '-';
+ 171:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 174:	8d 50 01             	lea    0x1(%rax),%edx
+ 177:	89 55 fc             	mov    %edx,-0x4(%rbp)
+ 17a:	48 98                	cltq
+ 17c:	c6 44 05 d0 2d       	movb   $0x2d,-0x30(%rbp,%rax,1)
+
+  while (--i >= 0)
+ 181:	eb 19                	jmp    19c <printint64+0xc6>
+    putc(fd, buf[i]);
+ 183:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 186:	48 98                	cltq
+ 188:	0f b6 44 05 d0       	movzbl -0x30(%rbp,%rax,1),%eax
+ 18d:	0f be d0             	movsbl %al,%edx
+ 190:	8b 45 cc             	mov    -0x34(%rbp),%eax
+ 193:	89 d6                	mov    %edx,%esi
+ 195:	89 c7                	mov    %eax,%edi
+ 197:	e8 11 ff ff ff       	call   ad <putc>
+  while (--i >= 0)
+ 19c:	83 6d fc 01          	subl   $0x1,-0x4(%rbp)
+ 1a0:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+ 1a4:	79 dd                	jns    183 <printint64+0xad>
+}
+ 1a6:	90                   	nop
+ 1a7:	90                   	nop
+ 1a8:	c9                   	leave
+ 1a9:	c3                   	ret
+
+00000000000001aa <printint>:
+
+static void printint(int fd, int xx, int base, int sgn) {
+ 1aa:	55                   	push   %rbp
+ 1ab:	48 89 e5             	mov    %rsp,%rbp
+ 1ae:	48 83 ec 30          	sub    $0x30,%rsp
+ 1b2:	89 7d dc             	mov    %edi,-0x24(%rbp)
+ 1b5:	89 75 d8             	mov    %esi,-0x28(%rbp)
+ 1b8:	89 55 d4             	mov    %edx,-0x2c(%rbp)
+ 1bb:	89 4d d0             	mov    %ecx,-0x30(%rbp)
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+ 1be:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+  if (sgn && xx < 0) {
+ 1c5:	83 7d d0 00          	cmpl   $0x0,-0x30(%rbp)
+ 1c9:	74 17                	je     1e2 <printint+0x38>
+ 1cb:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+ 1cf:	79 11                	jns    1e2 <printint+0x38>
+    neg = 1;
+ 1d1:	c7 45 f8 01 00 00 00 	movl   $0x1,-0x8(%rbp)
+    x = -xx;
+ 1d8:	8b 45 d8             	mov    -0x28(%rbp),%eax
+ 1db:	f7 d8                	neg    %eax
+ 1dd:	89 45 f4             	mov    %eax,-0xc(%rbp)
+ 1e0:	eb 06                	jmp    1e8 <printint+0x3e>
+  } else {
+    x = xx;
+ 1e2:	8b 45 d8             	mov    -0x28(%rbp),%eax
+ 1e5:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  }
+
+  i = 0;
+ 1e8:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  do {
+    buf[i++] = digits[x % base];
+ 1ef:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+ 1f2:	8b 45 f4             	mov    -0xc(%rbp),%eax
+ 1f5:	ba 00 00 00 00       	mov    $0x0,%edx
+ 1fa:	f7 f1                	div    %ecx
+ 1fc:	89 d1                	mov    %edx,%ecx
+ 1fe:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 201:	8d 50 01             	lea    0x1(%rax),%edx
+ 204:	89 55 fc             	mov    %edx,-0x4(%rbp)
+ 207:	89 c9                	mov    %ecx,%ecx
+ 209:	48 8d 15 30 0c 00 00 	lea    0xc30(%rip),%rdx        # e40 <digits.0>
+ 210:	0f b6 14 11          	movzbl (%rcx,%rdx,1),%edx
+ 214:	48 98                	cltq
+ 216:	88 54 05 e4          	mov    %dl,-0x1c(%rbp,%rax,1)
+  } while ((x /= base) != 0);
+ 21a:	8b 75 d4             	mov    -0x2c(%rbp),%esi
+ 21d:	8b 45 f4             	mov    -0xc(%rbp),%eax
+ 220:	ba 00 00 00 00       	mov    $0x0,%edx
+ 225:	f7 f6                	div    %esi
+ 227:	89 45 f4             	mov    %eax,-0xc(%rbp)
+ 22a:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+ 22e:	75 bf                	jne    1ef <printint+0x45>
+  if (neg)
+ 230:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+ 234:	74 2b                	je     261 <printint+0xb7>
+    buf[i++] = '-';
+ 236:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 239:	8d 50 01             	lea    0x1(%rax),%edx
+ 23c:	89 55 fc             	mov    %edx,-0x4(%rbp)
+ 23f:	48 98                	cltq
+ 241:	c6 44 05 e4 2d       	movb   $0x2d,-0x1c(%rbp,%rax,1)
+
+  while (--i >= 0)
+ 246:	eb 19                	jmp    261 <printint+0xb7>
+    putc(fd, buf[i]);
+ 248:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 24b:	48 98                	cltq
+ 24d:	0f b6 44 05 e4       	movzbl -0x1c(%rbp,%rax,1),%eax
+ 252:	0f be d0             	movsbl %al,%edx
+ 255:	8b 45 dc             	mov    -0x24(%rbp),%eax
+ 258:	89 d6                	mov    %edx,%esi
+ 25a:	89 c7                	mov    %eax,%edi
+ 25c:	e8 4c fe ff ff       	call   ad <putc>
+  while (--i >= 0)
+ 261:	83 6d fc 01          	subl   $0x1,-0x4(%rbp)
+ 265:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+ 269:	79 dd                	jns    248 <printint+0x9e>
+}
+ 26b:	90                   	nop
+ 26c:	90                   	nop
+ 26d:	c9                   	leave
+ 26e:	c3                   	ret
+
+000000000000026f <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void printf(int fd, char *fmt, ...) {
+ 26f:	55                   	push   %rbp
+ 270:	48 89 e5             	mov    %rsp,%rbp
+ 273:	48 83 ec 70          	sub    $0x70,%rsp
+ 277:	89 7d 9c             	mov    %edi,-0x64(%rbp)
+ 27a:	48 89 75 90          	mov    %rsi,-0x70(%rbp)
+ 27e:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+ 282:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+ 286:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+ 28a:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+  char *s;
+  int c, i, state;
+  int lflag;
+  va_list valist;
+  va_start(valist, fmt);
+ 28e:	c7 45 a0 10 00 00 00 	movl   $0x10,-0x60(%rbp)
+ 295:	48 8d 45 10          	lea    0x10(%rbp),%rax
+ 299:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+ 29d:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+ 2a1:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+
+  state = 0;
+ 2a5:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%rbp)
+  for (i = 0; fmt[i]; i++) {
+ 2ac:	c7 45 c4 00 00 00 00 	movl   $0x0,-0x3c(%rbp)
+ 2b3:	e9 6b 02 00 00       	jmp    523 <printf+0x2b4>
+    c = fmt[i] & 0xff;
+ 2b8:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+ 2bb:	48 63 d0             	movslq %eax,%rdx
+ 2be:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+ 2c2:	48 01 d0             	add    %rdx,%rax
+ 2c5:	0f b6 00             	movzbl (%rax),%eax
+ 2c8:	0f be c0             	movsbl %al,%eax
+ 2cb:	25 ff 00 00 00       	and    $0xff,%eax
+ 2d0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+    if (state == 0) {
+ 2d3:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+ 2d7:	75 30                	jne    309 <printf+0x9a>
+      if (c == '%') {
+ 2d9:	83 7d b8 25          	cmpl   $0x25,-0x48(%rbp)
+ 2dd:	75 13                	jne    2f2 <printf+0x83>
+        state = '%';
+ 2df:	c7 45 c0 25 00 00 00 	movl   $0x25,-0x40(%rbp)
+        lflag = 0;
+ 2e6:	c7 45 bc 00 00 00 00 	movl   $0x0,-0x44(%rbp)
+ 2ed:	e9 2d 02 00 00       	jmp    51f <printf+0x2b0>
+      } else {
+        putc(fd, c);
+ 2f2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+ 2f5:	0f be d0             	movsbl %al,%edx
+ 2f8:	8b 45 9c             	mov    -0x64(%rbp),%eax
+ 2fb:	89 d6                	mov    %edx,%esi
+ 2fd:	89 c7                	mov    %eax,%edi
+ 2ff:	e8 a9 fd ff ff       	call   ad <putc>
+ 304:	e9 16 02 00 00       	jmp    51f <printf+0x2b0>
+      }
+    } else if (state == '%') {
+ 309:	83 7d c0 25          	cmpl   $0x25,-0x40(%rbp)
+ 30d:	0f 85 0c 02 00 00    	jne    51f <printf+0x2b0>
+      if (c == 'l') {
+ 313:	83 7d b8 6c          	cmpl   $0x6c,-0x48(%rbp)
+ 317:	75 0c                	jne    325 <printf+0xb6>
+        lflag = 1;
+ 319:	c7 45 bc 01 00 00 00 	movl   $0x1,-0x44(%rbp)
+        continue;
+ 320:	e9 fa 01 00 00       	jmp    51f <printf+0x2b0>
+      } else if (c == 'd') {
+ 325:	83 7d b8 64          	cmpl   $0x64,-0x48(%rbp)
+ 329:	0f 85 95 00 00 00    	jne    3c4 <printf+0x155>
+        if (lflag == 1)
+ 32f:	83 7d bc 01          	cmpl   $0x1,-0x44(%rbp)
+ 333:	75 49                	jne    37e <printf+0x10f>
+          printint64(fd, va_arg(valist, int64_t), 10, 1);
+ 335:	8b 45 a0             	mov    -0x60(%rbp),%eax
+ 338:	83 f8 2f             	cmp    $0x2f,%eax
+ 33b:	77 17                	ja     354 <printf+0xe5>
+ 33d:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+ 341:	8b 55 a0             	mov    -0x60(%rbp),%edx
+ 344:	89 d2                	mov    %edx,%edx
+ 346:	48 01 d0             	add    %rdx,%rax
+ 349:	8b 55 a0             	mov    -0x60(%rbp),%edx
+ 34c:	83 c2 08             	add    $0x8,%edx
+ 34f:	89 55 a0             	mov    %edx,-0x60(%rbp)
+ 352:	eb 0c                	jmp    360 <printf+0xf1>
+ 354:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+ 358:	48 8d 50 08          	lea    0x8(%rax),%rdx
+ 35c:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+ 360:	48 8b 00             	mov    (%rax),%rax
+ 363:	89 c6                	mov    %eax,%esi
+ 365:	8b 45 9c             	mov    -0x64(%rbp),%eax
+ 368:	b9 01 00 00 00       	mov    $0x1,%ecx
+ 36d:	ba 0a 00 00 00       	mov    $0xa,%edx
+ 372:	89 c7                	mov    %eax,%edi
+ 374:	e8 5d fd ff ff       	call   d6 <printint64>
+ 379:	e9 9a 01 00 00       	jmp    518 <printf+0x2a9>
+        else
+          printint(fd, va_arg(valist, int), 10, 1);
+ 37e:	8b 45 a0             	mov    -0x60(%rbp),%eax
+ 381:	83 f8 2f             	cmp    $0x2f,%eax
+ 384:	77 17                	ja     39d <printf+0x12e>
+ 386:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+ 38a:	8b 55 a0             	mov    -0x60(%rbp),%edx
+ 38d:	89 d2                	mov    %edx,%edx
+ 38f:	48 01 d0             	add    %rdx,%rax
+ 392:	8b 55 a0             	mov    -0x60(%rbp),%edx
+ 395:	83 c2 08             	add    $0x8,%edx
+ 398:	89 55 a0             	mov    %edx,-0x60(%rbp)
+ 39b:	eb 0c                	jmp    3a9 <printf+0x13a>
+ 39d:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+ 3a1:	48 8d 50 08          	lea    0x8(%rax),%rdx
+ 3a5:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+ 3a9:	8b 30                	mov    (%rax),%esi
+ 3ab:	8b 45 9c             	mov    -0x64(%rbp),%eax
+ 3ae:	b9 01 00 00 00       	mov    $0x1,%ecx
+ 3b3:	ba 0a 00 00 00       	mov    $0xa,%edx
+ 3b8:	89 c7                	mov    %eax,%edi
+ 3ba:	e8 eb fd ff ff       	call   1aa <printint>
+ 3bf:	e9 54 01 00 00       	jmp    518 <printf+0x2a9>
+      } else if (c == 'x' || c == 'p') {
+ 3c4:	83 7d b8 78          	cmpl   $0x78,-0x48(%rbp)
+ 3c8:	74 0a                	je     3d4 <printf+0x165>
+ 3ca:	83 7d b8 70          	cmpl   $0x70,-0x48(%rbp)
+ 3ce:	0f 85 95 00 00 00    	jne    469 <printf+0x1fa>
+        if (lflag == 1)
+ 3d4:	83 7d bc 01          	cmpl   $0x1,-0x44(%rbp)
+ 3d8:	75 49                	jne    423 <printf+0x1b4>
+          printint64(fd, va_arg(valist, int64_t), 16, 0);
+ 3da:	8b 45 a0             	mov    -0x60(%rbp),%eax
+ 3dd:	83 f8 2f             	cmp    $0x2f,%eax
+ 3e0:	77 17                	ja     3f9 <printf+0x18a>
+ 3e2:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+ 3e6:	8b 55 a0             	mov    -0x60(%rbp),%edx
+ 3e9:	89 d2                	mov    %edx,%edx
+ 3eb:	48 01 d0             	add    %rdx,%rax
+ 3ee:	8b 55 a0             	mov    -0x60(%rbp),%edx
+ 3f1:	83 c2 08             	add    $0x8,%edx
+ 3f4:	89 55 a0             	mov    %edx,-0x60(%rbp)
+ 3f7:	eb 0c                	jmp    405 <printf+0x196>
+ 3f9:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+ 3fd:	48 8d 50 08          	lea    0x8(%rax),%rdx
+ 401:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+ 405:	48 8b 00             	mov    (%rax),%rax
+ 408:	89 c6                	mov    %eax,%esi
+ 40a:	8b 45 9c             	mov    -0x64(%rbp),%eax
+ 40d:	b9 00 00 00 00       	mov    $0x0,%ecx
+ 412:	ba 10 00 00 00       	mov    $0x10,%edx
+ 417:	89 c7                	mov    %eax,%edi
+ 419:	e8 b8 fc ff ff       	call   d6 <printint64>
+        if (lflag == 1)
+ 41e:	e9 f5 00 00 00       	jmp    518 <printf+0x2a9>
+        else
+          printint(fd, va_arg(valist, int), 16, 0);
+ 423:	8b 45 a0             	mov    -0x60(%rbp),%eax
+ 426:	83 f8 2f             	cmp    $0x2f,%eax
+ 429:	77 17                	ja     442 <printf+0x1d3>
+ 42b:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+ 42f:	8b 55 a0             	mov    -0x60(%rbp),%edx
+ 432:	89 d2                	mov    %edx,%edx
+ 434:	48 01 d0             	add    %rdx,%rax
+ 437:	8b 55 a0             	mov    -0x60(%rbp),%edx
+ 43a:	83 c2 08             	add    $0x8,%edx
+ 43d:	89 55 a0             	mov    %edx,-0x60(%rbp)
+ 440:	eb 0c                	jmp    44e <printf+0x1df>
+ 442:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+ 446:	48 8d 50 08          	lea    0x8(%rax),%rdx
+ 44a:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+ 44e:	8b 30                	mov    (%rax),%esi
+ 450:	8b 45 9c             	mov    -0x64(%rbp),%eax
+ 453:	b9 00 00 00 00       	mov    $0x0,%ecx
+ 458:	ba 10 00 00 00       	mov    $0x10,%edx
+ 45d:	89 c7                	mov    %eax,%edi
+ 45f:	e8 46 fd ff ff       	call   1aa <printint>
+        if (lflag == 1)
+ 464:	e9 af 00 00 00       	jmp    518 <printf+0x2a9>
+      } else if (c == 's') {
+ 469:	83 7d b8 73          	cmpl   $0x73,-0x48(%rbp)
+ 46d:	75 6e                	jne    4dd <printf+0x26e>
+        if ((s = (char *)va_arg(valist, char *)) == 0)
+ 46f:	8b 45 a0             	mov    -0x60(%rbp),%eax
+ 472:	83 f8 2f             	cmp    $0x2f,%eax
+ 475:	77 17                	ja     48e <printf+0x21f>
+ 477:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+ 47b:	8b 55 a0             	mov    -0x60(%rbp),%edx
+ 47e:	89 d2                	mov    %edx,%edx
+ 480:	48 01 d0             	add    %rdx,%rax
+ 483:	8b 55 a0             	mov    -0x60(%rbp),%edx
+ 486:	83 c2 08             	add    $0x8,%edx
+ 489:	89 55 a0             	mov    %edx,-0x60(%rbp)
+ 48c:	eb 0c                	jmp    49a <printf+0x22b>
+ 48e:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+ 492:	48 8d 50 08          	lea    0x8(%rax),%rdx
+ 496:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+ 49a:	48 8b 00             	mov    (%rax),%rax
+ 49d:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+ 4a1:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+ 4a6:	75 28                	jne    4d0 <printf+0x261>
+          s = "(null)";
+ 4a8:	48 8d 05 fd 06 00 00 	lea    0x6fd(%rip),%rax        # bac <malloc+0x14f>
+ 4af:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        for (; *s; s++)
+ 4b3:	eb 1b                	jmp    4d0 <printf+0x261>
+          putc(fd, *s);
+ 4b5:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+ 4b9:	0f b6 00             	movzbl (%rax),%eax
+ 4bc:	0f be d0             	movsbl %al,%edx
+ 4bf:	8b 45 9c             	mov    -0x64(%rbp),%eax
+ 4c2:	89 d6                	mov    %edx,%esi
+ 4c4:	89 c7                	mov    %eax,%edi
+ 4c6:	e8 e2 fb ff ff       	call   ad <putc>
+        for (; *s; s++)
+ 4cb:	48 83 45 c8 01       	addq   $0x1,-0x38(%rbp)
+ 4d0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+ 4d4:	0f b6 00             	movzbl (%rax),%eax
+ 4d7:	84 c0                	test   %al,%al
+ 4d9:	75 da                	jne    4b5 <printf+0x246>
+ 4db:	eb 3b                	jmp    518 <printf+0x2a9>
+      } else if (c == '%') {
+ 4dd:	83 7d b8 25          	cmpl   $0x25,-0x48(%rbp)
+ 4e1:	75 14                	jne    4f7 <printf+0x288>
+        putc(fd, c);
+ 4e3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+ 4e6:	0f be d0             	movsbl %al,%edx
+ 4e9:	8b 45 9c             	mov    -0x64(%rbp),%eax
+ 4ec:	89 d6                	mov    %edx,%esi
+ 4ee:	89 c7                	mov    %eax,%edi
+ 4f0:	e8 b8 fb ff ff       	call   ad <putc>
+ 4f5:	eb 21                	jmp    518 <printf+0x2a9>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+ 4f7:	8b 45 9c             	mov    -0x64(%rbp),%eax
+ 4fa:	be 25 00 00 00       	mov    $0x25,%esi
+ 4ff:	89 c7                	mov    %eax,%edi
+ 501:	e8 a7 fb ff ff       	call   ad <putc>
+        putc(fd, c);
+ 506:	8b 45 b8             	mov    -0x48(%rbp),%eax
+ 509:	0f be d0             	movsbl %al,%edx
+ 50c:	8b 45 9c             	mov    -0x64(%rbp),%eax
+ 50f:	89 d6                	mov    %edx,%esi
+ 511:	89 c7                	mov    %eax,%edi
+ 513:	e8 95 fb ff ff       	call   ad <putc>
+      }
+      state = 0;
+ 518:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%rbp)
+  for (i = 0; fmt[i]; i++) {
+ 51f:	83 45 c4 01          	addl   $0x1,-0x3c(%rbp)
+ 523:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+ 526:	48 63 d0             	movslq %eax,%rdx
+ 529:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+ 52d:	48 01 d0             	add    %rdx,%rax
+ 530:	0f b6 00             	movzbl (%rax),%eax
+ 533:	84 c0                	test   %al,%al
+ 535:	0f 85 7d fd ff ff    	jne    2b8 <printf+0x49>
+    }
+  }
+
+  va_end(valist);
+}
+ 53b:	90                   	nop
+ 53c:	90                   	nop
+ 53d:	c9                   	leave
+ 53e:	c3                   	ret
+
+000000000000053f <stosb>:
+      break;
+    buf[i++] = c;
+    if (c == '\n' || c == '\r')
+      break;
+  }
+  buf[i] = '\0';
+ 53f:	55                   	push   %rbp
+ 540:	48 89 e5             	mov    %rsp,%rbp
+ 543:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+ 547:	89 75 f4             	mov    %esi,-0xc(%rbp)
+ 54a:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  return buf;
+ 54d:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+ 551:	8b 55 f0             	mov    -0x10(%rbp),%edx
+ 554:	8b 45 f4             	mov    -0xc(%rbp),%eax
+ 557:	48 89 ce             	mov    %rcx,%rsi
+ 55a:	48 89 f7             	mov    %rsi,%rdi
+ 55d:	89 d1                	mov    %edx,%ecx
+ 55f:	fc                   	cld
+ 560:	f3 aa                	rep stos %al,%es:(%rdi)
+ 562:	89 ca                	mov    %ecx,%edx
+ 564:	48 89 fe             	mov    %rdi,%rsi
+ 567:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+ 56b:	89 55 f0             	mov    %edx,-0x10(%rbp)
+}
+
+int stat(char *n, struct stat *st) {
+  int fd;
+ 56e:	90                   	nop
+ 56f:	5d                   	pop    %rbp
+ 570:	c3                   	ret
+
+0000000000000571 <strcpy>:
+char *strcpy(char *s, char *t) {
+ 571:	55                   	push   %rbp
+ 572:	48 89 e5             	mov    %rsp,%rbp
+ 575:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+ 579:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  os = s;
+ 57d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 581:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while ((*s++ = *t++) != 0)
+ 585:	90                   	nop
+ 586:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+ 58a:	48 8d 42 01          	lea    0x1(%rdx),%rax
+ 58e:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+ 592:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 596:	48 8d 48 01          	lea    0x1(%rax),%rcx
+ 59a:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+ 59e:	0f b6 12             	movzbl (%rdx),%edx
+ 5a1:	88 10                	mov    %dl,(%rax)
+ 5a3:	0f b6 00             	movzbl (%rax),%eax
+ 5a6:	84 c0                	test   %al,%al
+ 5a8:	75 dc                	jne    586 <strcpy+0x15>
+  return os;
+ 5aa:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+ 5ae:	5d                   	pop    %rbp
+ 5af:	c3                   	ret
+
+00000000000005b0 <strcmp>:
+int strcmp(const char *p, const char *q) {
+ 5b0:	55                   	push   %rbp
+ 5b1:	48 89 e5             	mov    %rsp,%rbp
+ 5b4:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+ 5b8:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  while (*p && *p == *q)
+ 5bc:	eb 0a                	jmp    5c8 <strcmp+0x18>
+    p++, q++;
+ 5be:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+ 5c3:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (*p && *p == *q)
+ 5c8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 5cc:	0f b6 00             	movzbl (%rax),%eax
+ 5cf:	84 c0                	test   %al,%al
+ 5d1:	74 12                	je     5e5 <strcmp+0x35>
+ 5d3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 5d7:	0f b6 10             	movzbl (%rax),%edx
+ 5da:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ 5de:	0f b6 00             	movzbl (%rax),%eax
+ 5e1:	38 c2                	cmp    %al,%dl
+ 5e3:	74 d9                	je     5be <strcmp+0xe>
+  return (uchar)*p - (uchar)*q;
+ 5e5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 5e9:	0f b6 00             	movzbl (%rax),%eax
+ 5ec:	0f b6 d0             	movzbl %al,%edx
+ 5ef:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ 5f3:	0f b6 00             	movzbl (%rax),%eax
+ 5f6:	0f b6 c0             	movzbl %al,%eax
+ 5f9:	29 c2                	sub    %eax,%edx
+ 5fb:	89 d0                	mov    %edx,%eax
+}
+ 5fd:	5d                   	pop    %rbp
+ 5fe:	c3                   	ret
+
+00000000000005ff <strlen>:
+uint strlen(char *s) {
+ 5ff:	55                   	push   %rbp
+ 600:	48 89 e5             	mov    %rsp,%rbp
+ 603:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  for (n = 0; s[n]; n++)
+ 607:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+ 60e:	eb 04                	jmp    614 <strlen+0x15>
+ 610:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+ 614:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 617:	48 63 d0             	movslq %eax,%rdx
+ 61a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 61e:	48 01 d0             	add    %rdx,%rax
+ 621:	0f b6 00             	movzbl (%rax),%eax
+ 624:	84 c0                	test   %al,%al
+ 626:	75 e8                	jne    610 <strlen+0x11>
+  return n;
+ 628:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+ 62b:	5d                   	pop    %rbp
+ 62c:	c3                   	ret
+
+000000000000062d <memset>:
+void *memset(void *dst, int c, uint n) {
+ 62d:	55                   	push   %rbp
+ 62e:	48 89 e5             	mov    %rsp,%rbp
+ 631:	48 83 ec 10          	sub    $0x10,%rsp
+ 635:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+ 639:	89 75 f4             	mov    %esi,-0xc(%rbp)
+ 63c:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  stosb(dst, c, n);
+ 63f:	8b 55 f0             	mov    -0x10(%rbp),%edx
+ 642:	8b 4d f4             	mov    -0xc(%rbp),%ecx
+ 645:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 649:	89 ce                	mov    %ecx,%esi
+ 64b:	48 89 c7             	mov    %rax,%rdi
+ 64e:	e8 ec fe ff ff       	call   53f <stosb>
+  return dst;
+ 653:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+ 657:	c9                   	leave
+ 658:	c3                   	ret
+
+0000000000000659 <strchr>:
+char *strchr(const char *s, char c) {
+ 659:	55                   	push   %rbp
+ 65a:	48 89 e5             	mov    %rsp,%rbp
+ 65d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+ 661:	89 f0                	mov    %esi,%eax
+ 663:	88 45 f4             	mov    %al,-0xc(%rbp)
+  for (; *s; s++)
+ 666:	eb 17                	jmp    67f <strchr+0x26>
+    if (*s == c)
+ 668:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 66c:	0f b6 00             	movzbl (%rax),%eax
+ 66f:	38 45 f4             	cmp    %al,-0xc(%rbp)
+ 672:	75 06                	jne    67a <strchr+0x21>
+      return (char *)s;
+ 674:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 678:	eb 15                	jmp    68f <strchr+0x36>
+  for (; *s; s++)
+ 67a:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+ 67f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 683:	0f b6 00             	movzbl (%rax),%eax
+ 686:	84 c0                	test   %al,%al
+ 688:	75 de                	jne    668 <strchr+0xf>
+  return 0;
+ 68a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 68f:	5d                   	pop    %rbp
+ 690:	c3                   	ret
+
+0000000000000691 <gets>:
+char *gets(char *buf, int max) {
+ 691:	55                   	push   %rbp
+ 692:	48 89 e5             	mov    %rsp,%rbp
+ 695:	48 83 ec 20          	sub    $0x20,%rsp
+ 699:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+ 69d:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  for (i = 0; i + 1 < max;) {
+ 6a0:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+ 6a7:	eb 48                	jmp    6f1 <gets+0x60>
+    cc = read(0, &c, 1);
+ 6a9:	48 8d 45 f7          	lea    -0x9(%rbp),%rax
+ 6ad:	ba 01 00 00 00       	mov    $0x1,%edx
+ 6b2:	48 89 c6             	mov    %rax,%rsi
+ 6b5:	bf 00 00 00 00       	mov    $0x0,%edi
+ 6ba:	e8 6f 01 00 00       	call   82e <read>
+ 6bf:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    if (cc < 1)
+ 6c2:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+ 6c6:	7e 36                	jle    6fe <gets+0x6d>
+    buf[i++] = c;
+ 6c8:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 6cb:	8d 50 01             	lea    0x1(%rax),%edx
+ 6ce:	89 55 fc             	mov    %edx,-0x4(%rbp)
+ 6d1:	48 63 d0             	movslq %eax,%rdx
+ 6d4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 6d8:	48 01 c2             	add    %rax,%rdx
+ 6db:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+ 6df:	88 02                	mov    %al,(%rdx)
+    if (c == '\n' || c == '\r')
+ 6e1:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+ 6e5:	3c 0a                	cmp    $0xa,%al
+ 6e7:	74 16                	je     6ff <gets+0x6e>
+ 6e9:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+ 6ed:	3c 0d                	cmp    $0xd,%al
+ 6ef:	74 0e                	je     6ff <gets+0x6e>
+  for (i = 0; i + 1 < max;) {
+ 6f1:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 6f4:	83 c0 01             	add    $0x1,%eax
+ 6f7:	39 45 e4             	cmp    %eax,-0x1c(%rbp)
+ 6fa:	7f ad                	jg     6a9 <gets+0x18>
+ 6fc:	eb 01                	jmp    6ff <gets+0x6e>
+      break;
+ 6fe:	90                   	nop
+  buf[i] = '\0';
+ 6ff:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 702:	48 63 d0             	movslq %eax,%rdx
+ 705:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 709:	48 01 d0             	add    %rdx,%rax
+ 70c:	c6 00 00             	movb   $0x0,(%rax)
+  return buf;
+ 70f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+ 713:	c9                   	leave
+ 714:	c3                   	ret
+
+0000000000000715 <stat>:
+int stat(char *n, struct stat *st) {
+ 715:	55                   	push   %rbp
+ 716:	48 89 e5             	mov    %rsp,%rbp
+ 719:	48 83 ec 20          	sub    $0x20,%rsp
+ 71d:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+ 721:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 725:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 729:	be 00 00 00 00       	mov    $0x0,%esi
+ 72e:	48 89 c7             	mov    %rax,%rdi
+ 731:	e8 20 01 00 00       	call   856 <open>
+ 736:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  if (fd < 0)
+ 739:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+ 73d:	79 07                	jns    746 <stat+0x31>
+    return -1;
+ 73f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 744:	eb 21                	jmp    767 <stat+0x52>
+  r = fstat(fd, st);
+ 746:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+ 74a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 74d:	48 89 d6             	mov    %rdx,%rsi
+ 750:	89 c7                	mov    %eax,%edi
+ 752:	e8 17 01 00 00       	call   86e <fstat>
+ 757:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  close(fd);
+ 75a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 75d:	89 c7                	mov    %eax,%edi
+ 75f:	e8 da 00 00 00       	call   83e <close>
+  return r;
+ 764:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+ 767:	c9                   	leave
+ 768:	c3                   	ret
+
+0000000000000769 <atoi>:
+
+int atoi(const char *s) {
+ 769:	55                   	push   %rbp
+ 76a:	48 89 e5             	mov    %rsp,%rbp
+ 76d:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int n;
+
+  n = 0;
+ 771:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  while ('0' <= *s && *s <= '9')
+ 778:	eb 28                	jmp    7a2 <atoi+0x39>
+    n = n * 10 + *s++ - '0';
+ 77a:	8b 55 fc             	mov    -0x4(%rbp),%edx
+ 77d:	89 d0                	mov    %edx,%eax
+ 77f:	c1 e0 02             	shl    $0x2,%eax
+ 782:	01 d0                	add    %edx,%eax
+ 784:	01 c0                	add    %eax,%eax
+ 786:	89 c1                	mov    %eax,%ecx
+ 788:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 78c:	48 8d 50 01          	lea    0x1(%rax),%rdx
+ 790:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+ 794:	0f b6 00             	movzbl (%rax),%eax
+ 797:	0f be c0             	movsbl %al,%eax
+ 79a:	01 c8                	add    %ecx,%eax
+ 79c:	83 e8 30             	sub    $0x30,%eax
+ 79f:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while ('0' <= *s && *s <= '9')
+ 7a2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 7a6:	0f b6 00             	movzbl (%rax),%eax
+ 7a9:	3c 2f                	cmp    $0x2f,%al
+ 7ab:	7e 0b                	jle    7b8 <atoi+0x4f>
+ 7ad:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 7b1:	0f b6 00             	movzbl (%rax),%eax
+ 7b4:	3c 39                	cmp    $0x39,%al
+ 7b6:	7e c2                	jle    77a <atoi+0x11>
+  return n;
+ 7b8:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+ 7bb:	5d                   	pop    %rbp
+ 7bc:	c3                   	ret
+
+00000000000007bd <memmove>:
+
+void *memmove(void *vdst, void *vsrc, int n) {
+ 7bd:	55                   	push   %rbp
+ 7be:	48 89 e5             	mov    %rsp,%rbp
+ 7c1:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+ 7c5:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+ 7c9:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  char *dst, *src;
+
+  dst = vdst;
+ 7cc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 7d0:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  src = vsrc;
+ 7d4:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+ 7d8:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  while (n-- > 0)
+ 7dc:	eb 1d                	jmp    7fb <memmove+0x3e>
+    *dst++ = *src++;
+ 7de:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+ 7e2:	48 8d 42 01          	lea    0x1(%rdx),%rax
+ 7e6:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+ 7ea:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 7ee:	48 8d 48 01          	lea    0x1(%rax),%rcx
+ 7f2:	48 89 4d f8          	mov    %rcx,-0x8(%rbp)
+ 7f6:	0f b6 12             	movzbl (%rdx),%edx
+ 7f9:	88 10                	mov    %dl,(%rax)
+  while (n-- > 0)
+ 7fb:	8b 45 dc             	mov    -0x24(%rbp),%eax
+ 7fe:	8d 50 ff             	lea    -0x1(%rax),%edx
+ 801:	89 55 dc             	mov    %edx,-0x24(%rbp)
+ 804:	85 c0                	test   %eax,%eax
+ 806:	7f d6                	jg     7de <memmove+0x21>
+  return vdst;
+ 808:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 80c:	5d                   	pop    %rbp
+ 80d:	c3                   	ret
+
+000000000000080e <fork>:
+  name:                                                                        \
+  movl $SYS_##name, % eax;                                                     \
+  int $TRAP_SYSCALL;                                                           \
+  ret
+
+SYSCALL(fork)
+ 80e:	b8 01 00 00 00       	mov    $0x1,%eax
+ 813:	cd 40                	int    $0x40
+ 815:	c3                   	ret
+
+0000000000000816 <exit>:
+SYSCALL(exit)
+ 816:	b8 02 00 00 00       	mov    $0x2,%eax
+ 81b:	cd 40                	int    $0x40
+ 81d:	c3                   	ret
+
+000000000000081e <wait>:
+SYSCALL(wait)
+ 81e:	b8 03 00 00 00       	mov    $0x3,%eax
+ 823:	cd 40                	int    $0x40
+ 825:	c3                   	ret
+
+0000000000000826 <pipe>:
+SYSCALL(pipe)
+ 826:	b8 04 00 00 00       	mov    $0x4,%eax
+ 82b:	cd 40                	int    $0x40
+ 82d:	c3                   	ret
+
+000000000000082e <read>:
+SYSCALL(read)
+ 82e:	b8 05 00 00 00       	mov    $0x5,%eax
+ 833:	cd 40                	int    $0x40
+ 835:	c3                   	ret
+
+0000000000000836 <write>:
+SYSCALL(write)
+ 836:	b8 10 00 00 00       	mov    $0x10,%eax
+ 83b:	cd 40                	int    $0x40
+ 83d:	c3                   	ret
+
+000000000000083e <close>:
+SYSCALL(close)
+ 83e:	b8 15 00 00 00       	mov    $0x15,%eax
+ 843:	cd 40                	int    $0x40
+ 845:	c3                   	ret
+
+0000000000000846 <kill>:
+SYSCALL(kill)
+ 846:	b8 06 00 00 00       	mov    $0x6,%eax
+ 84b:	cd 40                	int    $0x40
+ 84d:	c3                   	ret
+
+000000000000084e <exec>:
+SYSCALL(exec)
+ 84e:	b8 07 00 00 00       	mov    $0x7,%eax
+ 853:	cd 40                	int    $0x40
+ 855:	c3                   	ret
+
+0000000000000856 <open>:
+SYSCALL(open)
+ 856:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 85b:	cd 40                	int    $0x40
+ 85d:	c3                   	ret
+
+000000000000085e <mknod>:
+SYSCALL(mknod)
+ 85e:	b8 11 00 00 00       	mov    $0x11,%eax
+ 863:	cd 40                	int    $0x40
+ 865:	c3                   	ret
+
+0000000000000866 <unlink>:
+SYSCALL(unlink)
+ 866:	b8 12 00 00 00       	mov    $0x12,%eax
+ 86b:	cd 40                	int    $0x40
+ 86d:	c3                   	ret
+
+000000000000086e <fstat>:
+SYSCALL(fstat)
+ 86e:	b8 08 00 00 00       	mov    $0x8,%eax
+ 873:	cd 40                	int    $0x40
+ 875:	c3                   	ret
+
+0000000000000876 <link>:
+SYSCALL(link)
+ 876:	b8 13 00 00 00       	mov    $0x13,%eax
+ 87b:	cd 40                	int    $0x40
+ 87d:	c3                   	ret
+
+000000000000087e <mkdir>:
+SYSCALL(mkdir)
+ 87e:	b8 14 00 00 00       	mov    $0x14,%eax
+ 883:	cd 40                	int    $0x40
+ 885:	c3                   	ret
+
+0000000000000886 <chdir>:
+SYSCALL(chdir)
+ 886:	b8 09 00 00 00       	mov    $0x9,%eax
+ 88b:	cd 40                	int    $0x40
+ 88d:	c3                   	ret
+
+000000000000088e <dup>:
+SYSCALL(dup)
+ 88e:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 893:	cd 40                	int    $0x40
+ 895:	c3                   	ret
+
+0000000000000896 <getpid>:
+SYSCALL(getpid)
+ 896:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 89b:	cd 40                	int    $0x40
+ 89d:	c3                   	ret
+
+000000000000089e <sbrk>:
+SYSCALL(sbrk)
+ 89e:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 8a3:	cd 40                	int    $0x40
+ 8a5:	c3                   	ret
+
+00000000000008a6 <sleep>:
+SYSCALL(sleep)
+ 8a6:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 8ab:	cd 40                	int    $0x40
+ 8ad:	c3                   	ret
+
+00000000000008ae <uptime>:
+SYSCALL(uptime)
+ 8ae:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 8b3:	cd 40                	int    $0x40
+ 8b5:	c3                   	ret
+
+00000000000008b6 <sysinfo>:
+SYSCALL(sysinfo)
+ 8b6:	b8 16 00 00 00       	mov    $0x16,%eax
+ 8bb:	cd 40                	int    $0x40
+ 8bd:	c3                   	ret
+
+00000000000008be <crashn>:
+SYSCALL(crashn)
+ 8be:	b8 17 00 00 00       	mov    $0x17,%eax
+ 8c3:	cd 40                	int    $0x40
+ 8c5:	c3                   	ret
+
+00000000000008c6 <sync>:
+SYSCALL(sync)
+ 8c6:	b8 18 00 00 00       	mov    $0x18,%eax
+ 8cb:	cd 40                	int    $0x40
+ 8cd:	c3                   	ret
+
+00000000000008ce <fsync>:
+SYSCALL(fsync)
+ 8ce:	b8 19 00 00 00       	mov    $0x19,%eax
+ 8d3:	cd 40                	int    $0x40
+ 8d5:	c3                   	ret
+
+00000000000008d6 <free>:
+typedef union header Header;
+
+static Header base;
+static Header *freep;
+
+void free(void *ap) {
+ 8d6:	55                   	push   %rbp
+ 8d7:	48 89 e5             	mov    %rsp,%rbp
+ 8da:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  Header *bp, *p;
+
+  bp = (Header *)ap - 1;
+ 8de:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 8e2:	48 83 e8 10          	sub    $0x10,%rax
+ 8e6:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  for (p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 8ea:	48 8b 05 7f 05 00 00 	mov    0x57f(%rip),%rax        # e70 <freep>
+ 8f1:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+ 8f5:	eb 2f                	jmp    926 <free+0x50>
+    if (p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 8f7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 8fb:	48 8b 00             	mov    (%rax),%rax
+ 8fe:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+ 902:	72 17                	jb     91b <free+0x45>
+ 904:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ 908:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+ 90c:	72 2f                	jb     93d <free+0x67>
+ 90e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 912:	48 8b 00             	mov    (%rax),%rax
+ 915:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+ 919:	72 22                	jb     93d <free+0x67>
+  for (p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 91b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 91f:	48 8b 00             	mov    (%rax),%rax
+ 922:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+ 926:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ 92a:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+ 92e:	73 c7                	jae    8f7 <free+0x21>
+ 930:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 934:	48 8b 00             	mov    (%rax),%rax
+ 937:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+ 93b:	73 ba                	jae    8f7 <free+0x21>
+      break;
+  if (bp + bp->s.size == p->s.ptr) {
+ 93d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ 941:	8b 40 08             	mov    0x8(%rax),%eax
+ 944:	89 c0                	mov    %eax,%eax
+ 946:	48 c1 e0 04          	shl    $0x4,%rax
+ 94a:	48 89 c2             	mov    %rax,%rdx
+ 94d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ 951:	48 01 c2             	add    %rax,%rdx
+ 954:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 958:	48 8b 00             	mov    (%rax),%rax
+ 95b:	48 39 c2             	cmp    %rax,%rdx
+ 95e:	75 2d                	jne    98d <free+0xb7>
+    bp->s.size += p->s.ptr->s.size;
+ 960:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ 964:	8b 50 08             	mov    0x8(%rax),%edx
+ 967:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 96b:	48 8b 00             	mov    (%rax),%rax
+ 96e:	8b 40 08             	mov    0x8(%rax),%eax
+ 971:	01 c2                	add    %eax,%edx
+ 973:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ 977:	89 50 08             	mov    %edx,0x8(%rax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 97a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 97e:	48 8b 00             	mov    (%rax),%rax
+ 981:	48 8b 10             	mov    (%rax),%rdx
+ 984:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ 988:	48 89 10             	mov    %rdx,(%rax)
+ 98b:	eb 0e                	jmp    99b <free+0xc5>
+  } else
+    bp->s.ptr = p->s.ptr;
+ 98d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 991:	48 8b 10             	mov    (%rax),%rdx
+ 994:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ 998:	48 89 10             	mov    %rdx,(%rax)
+  if (p + p->s.size == bp) {
+ 99b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 99f:	8b 40 08             	mov    0x8(%rax),%eax
+ 9a2:	89 c0                	mov    %eax,%eax
+ 9a4:	48 c1 e0 04          	shl    $0x4,%rax
+ 9a8:	48 89 c2             	mov    %rax,%rdx
+ 9ab:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 9af:	48 01 d0             	add    %rdx,%rax
+ 9b2:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+ 9b6:	75 27                	jne    9df <free+0x109>
+    p->s.size += bp->s.size;
+ 9b8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 9bc:	8b 50 08             	mov    0x8(%rax),%edx
+ 9bf:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ 9c3:	8b 40 08             	mov    0x8(%rax),%eax
+ 9c6:	01 c2                	add    %eax,%edx
+ 9c8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 9cc:	89 50 08             	mov    %edx,0x8(%rax)
+    p->s.ptr = bp->s.ptr;
+ 9cf:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ 9d3:	48 8b 10             	mov    (%rax),%rdx
+ 9d6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 9da:	48 89 10             	mov    %rdx,(%rax)
+ 9dd:	eb 0b                	jmp    9ea <free+0x114>
+  } else
+    p->s.ptr = bp;
+ 9df:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 9e3:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+ 9e7:	48 89 10             	mov    %rdx,(%rax)
+  freep = p;
+ 9ea:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 9ee:	48 89 05 7b 04 00 00 	mov    %rax,0x47b(%rip)        # e70 <freep>
+}
+ 9f5:	90                   	nop
+ 9f6:	5d                   	pop    %rbp
+ 9f7:	c3                   	ret
+
+00000000000009f8 <morecore>:
+
+static Header *morecore(uint nu) {
+ 9f8:	55                   	push   %rbp
+ 9f9:	48 89 e5             	mov    %rsp,%rbp
+ 9fc:	48 83 ec 20          	sub    $0x20,%rsp
+ a00:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  char *p;
+  Header *hp;
+
+  if (nu < 4096)
+ a03:	81 7d ec ff 0f 00 00 	cmpl   $0xfff,-0x14(%rbp)
+ a0a:	77 07                	ja     a13 <morecore+0x1b>
+    nu = 4096;
+ a0c:	c7 45 ec 00 10 00 00 	movl   $0x1000,-0x14(%rbp)
+  p = sbrk(nu * sizeof(Header));
+ a13:	8b 45 ec             	mov    -0x14(%rbp),%eax
+ a16:	c1 e0 04             	shl    $0x4,%eax
+ a19:	89 c7                	mov    %eax,%edi
+ a1b:	e8 7e fe ff ff       	call   89e <sbrk>
+ a20:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (p == (char *)-1)
+ a24:	48 83 7d f8 ff       	cmpq   $0xffffffffffffffff,-0x8(%rbp)
+ a29:	75 07                	jne    a32 <morecore+0x3a>
+    return 0;
+ a2b:	b8 00 00 00 00       	mov    $0x0,%eax
+ a30:	eb 29                	jmp    a5b <morecore+0x63>
+  hp = (Header *)p;
+ a32:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ a36:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  hp->s.size = nu;
+ a3a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ a3e:	8b 55 ec             	mov    -0x14(%rbp),%edx
+ a41:	89 50 08             	mov    %edx,0x8(%rax)
+  free((void *)(hp + 1));
+ a44:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ a48:	48 83 c0 10          	add    $0x10,%rax
+ a4c:	48 89 c7             	mov    %rax,%rdi
+ a4f:	e8 82 fe ff ff       	call   8d6 <free>
+  return freep;
+ a54:	48 8b 05 15 04 00 00 	mov    0x415(%rip),%rax        # e70 <freep>
+}
+ a5b:	c9                   	leave
+ a5c:	c3                   	ret
+
+0000000000000a5d <malloc>:
+
+void *malloc(uint nbytes) {
+ a5d:	55                   	push   %rbp
+ a5e:	48 89 e5             	mov    %rsp,%rbp
+ a61:	48 83 ec 30          	sub    $0x30,%rsp
+ a65:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1) / sizeof(Header) + 1;
+ a68:	8b 45 dc             	mov    -0x24(%rbp),%eax
+ a6b:	48 83 c0 0f          	add    $0xf,%rax
+ a6f:	48 c1 e8 04          	shr    $0x4,%rax
+ a73:	83 c0 01             	add    $0x1,%eax
+ a76:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  if ((prevp = freep) == 0) {
+ a79:	48 8b 05 f0 03 00 00 	mov    0x3f0(%rip),%rax        # e70 <freep>
+ a80:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+ a84:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+ a89:	75 2e                	jne    ab9 <malloc+0x5c>
+    base.s.ptr = freep = prevp = &base;
+ a8b:	48 8d 05 ce 03 00 00 	lea    0x3ce(%rip),%rax        # e60 <base>
+ a92:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+ a96:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ a9a:	48 89 05 cf 03 00 00 	mov    %rax,0x3cf(%rip)        # e70 <freep>
+ aa1:	48 8b 05 c8 03 00 00 	mov    0x3c8(%rip),%rax        # e70 <freep>
+ aa8:	48 89 05 b1 03 00 00 	mov    %rax,0x3b1(%rip)        # e60 <base>
+    base.s.size = 0;
+ aaf:	c7 05 af 03 00 00 00 	movl   $0x0,0x3af(%rip)        # e68 <base+0x8>
+ ab6:	00 00 00 
+  }
+  for (p = prevp->s.ptr;; prevp = p, p = p->s.ptr) {
+ ab9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ abd:	48 8b 00             	mov    (%rax),%rax
+ ac0:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    if (p->s.size >= nunits) {
+ ac4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ ac8:	8b 40 08             	mov    0x8(%rax),%eax
+ acb:	3b 45 ec             	cmp    -0x14(%rbp),%eax
+ ace:	72 5f                	jb     b2f <malloc+0xd2>
+      if (p->s.size == nunits)
+ ad0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ ad4:	8b 40 08             	mov    0x8(%rax),%eax
+ ad7:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+ ada:	75 10                	jne    aec <malloc+0x8f>
+        prevp->s.ptr = p->s.ptr;
+ adc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ ae0:	48 8b 10             	mov    (%rax),%rdx
+ ae3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ ae7:	48 89 10             	mov    %rdx,(%rax)
+ aea:	eb 2e                	jmp    b1a <malloc+0xbd>
+      else {
+        p->s.size -= nunits;
+ aec:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ af0:	8b 40 08             	mov    0x8(%rax),%eax
+ af3:	2b 45 ec             	sub    -0x14(%rbp),%eax
+ af6:	89 c2                	mov    %eax,%edx
+ af8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ afc:	89 50 08             	mov    %edx,0x8(%rax)
+        p += p->s.size;
+ aff:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ b03:	8b 40 08             	mov    0x8(%rax),%eax
+ b06:	89 c0                	mov    %eax,%eax
+ b08:	48 c1 e0 04          	shl    $0x4,%rax
+ b0c:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+        p->s.size = nunits;
+ b10:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ b14:	8b 55 ec             	mov    -0x14(%rbp),%edx
+ b17:	89 50 08             	mov    %edx,0x8(%rax)
+      }
+      freep = prevp;
+ b1a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ b1e:	48 89 05 4b 03 00 00 	mov    %rax,0x34b(%rip)        # e70 <freep>
+      return (void *)(p + 1);
+ b25:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ b29:	48 83 c0 10          	add    $0x10,%rax
+ b2d:	eb 41                	jmp    b70 <malloc+0x113>
+    }
+    if (p == freep)
+ b2f:	48 8b 05 3a 03 00 00 	mov    0x33a(%rip),%rax        # e70 <freep>
+ b36:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+ b3a:	75 1c                	jne    b58 <malloc+0xfb>
+      if ((p = morecore(nunits)) == 0)
+ b3c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+ b3f:	89 c7                	mov    %eax,%edi
+ b41:	e8 b2 fe ff ff       	call   9f8 <morecore>
+ b46:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+ b4a:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+ b4f:	75 07                	jne    b58 <malloc+0xfb>
+        return 0;
+ b51:	b8 00 00 00 00       	mov    $0x0,%eax
+ b56:	eb 18                	jmp    b70 <malloc+0x113>
+  for (p = prevp->s.ptr;; prevp = p, p = p->s.ptr) {
+ b58:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ b5c:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+ b60:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ b64:	48 8b 00             	mov    (%rax),%rax
+ b67:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    if (p->s.size >= nunits) {
+ b6b:	e9 54 ff ff ff       	jmp    ac4 <malloc+0x67>
+  }
+ b70:	c9                   	leave
+ b71:	c3                   	ret
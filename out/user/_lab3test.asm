@@ -0,0 +1,2688 @@
+
+out/user/_lab3test:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000000000 <main>:
+void sbrktest(void);
+void growstacktest(void);
+void growstacktest_edgecase(void);
+void copyonwriteforktest(void);
+
+int main(int argc, char *argv[]) {
+       0:	55                   	push   %rbp
+       1:	48 89 e5             	mov    %rsp,%rbp
+       4:	48 83 ec 10          	sub    $0x10,%rsp
+       8:	89 7d fc             	mov    %edi,-0x4(%rbp)
+       b:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+
+//  printf(stdout, "pages_in_use start of lab 3 tests = %d\n",
+  //       info1.pages_in_use);
+
+
+  memtest();
+       f:	e8 35 00 00 00       	call   49 <memtest>
+ // sysinfo(&info1);
+ // printf(stdout, "pages_in_use after memtest  = %d\n",
+   //      info1.pages_in_use);
+
+  sbrktest();
+      14:	e8 8c 01 00 00       	call   1a5 <sbrktest>
+ // sysinfo(&info1);
+ // printf(stdout, "pages_in_use after sbrktest  = %d\n",
+   //      info1.pages_in_use);
+  growstacktest();
+      19:	e8 02 0a 00 00       	call   a20 <growstacktest>
+ // sysinfo(&info1);
+ // printf(stdout, "pages_in_use after growstacktest  = %d\n",
+   //      info1.pages_in_use);
+  growstacktest_edgecase();
+      1e:	e8 18 0c 00 00       	call   c3b <growstacktest_edgecase>
+ // sysinfo(&info1);
+ // printf(stdout, "pages_in_use after growstackedgecasetest  = %d\n",
+   //      info1.pages_in_use);
+  copyonwriteforktest();
+      23:	e8 33 0e 00 00       	call   e5b <copyonwriteforktest>
+ // sysinfo(&info1);
+ // printf(stdout, "pages_in_use after copyonwriteforktest  = %d\n",
+   //      info1.pages_in_use);
+
+  printf(stdout, "lab3 tests passed!!\n");
+      28:	8b 05 32 27 00 00    	mov    0x2732(%rip),%eax        # 2760 <stdout>
+      2e:	48 8d 15 73 1c 00 00 	lea    0x1c73(%rip),%rdx        # 1ca8 <malloc+0x11c>
+      35:	48 89 d6             	mov    %rdx,%rsi
+      38:	89 c7                	mov    %eax,%edi
+      3a:	b8 00 00 00 00       	mov    $0x0,%eax
+      3f:	e8 5a 13 00 00       	call   139e <printf>
+
+ // printf(stdout, "pages_in_use end of lab 3 tests = %d\n",
+   //      info2.pages_in_use);
+
+
+  exit();
+      44:	e8 fc 18 00 00       	call   1945 <exit>
+
+0000000000000049 <memtest>:
+  return 0;
+}
+
+void memtest() {
+      49:	55                   	push   %rbp
+      4a:	48 89 e5             	mov    %rsp,%rbp
+      4d:	48 83 ec 20          	sub    $0x20,%rsp
+
+  void *m1, *m2;
+  int pid;
+  int i;
+
+  printf(stdout, "memtest\n");
+      51:	8b 05 09 27 00 00    	mov    0x2709(%rip),%eax        # 2760 <stdout>
+      57:	48 8d 15 5f 1c 00 00 	lea    0x1c5f(%rip),%rdx        # 1cbd <malloc+0x131>
+      5e:	48 89 d6             	mov    %rdx,%rsi
+      61:	89 c7                	mov    %eax,%edi
+      63:	b8 00 00 00 00       	mov    $0x0,%eax
+      68:	e8 31 13 00 00       	call   139e <printf>
+  if ((pid = fork()) == 0) {
+      6d:	e8 cb 18 00 00       	call   193d <fork>
+      72:	89 45 f0             	mov    %eax,-0x10(%rbp)
+      75:	83 7d f0 00          	cmpl   $0x0,-0x10(%rbp)
+      79:	0f 85 02 01 00 00    	jne    181 <memtest+0x138>
+    m1 = 0;
+      7f:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+      86:	00 
+    for (i = 0; i < 10; i++) {
+      87:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+      8e:	eb 25                	jmp    b5 <memtest+0x6c>
+      m2 = malloc(10001);
+      90:	bf 11 27 00 00       	mov    $0x2711,%edi
+      95:	e8 f2 1a 00 00       	call   1b8c <malloc>
+      9a:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      *(char **)m2 = m1;
+      9e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+      a2:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+      a6:	48 89 10             	mov    %rdx,(%rax)
+      m1 = m2;
+      a9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+      ad:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    for (i = 0; i < 10; i++) {
+      b1:	83 45 f4 01          	addl   $0x1,-0xc(%rbp)
+      b5:	83 7d f4 09          	cmpl   $0x9,-0xc(%rbp)
+      b9:	7e d5                	jle    90 <memtest+0x47>
+    }
+    while (m1) {
+      bb:	eb 1f                	jmp    dc <memtest+0x93>
+      m2 = *(char **)m1;
+      bd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+      c1:	48 8b 00             	mov    (%rax),%rax
+      c4:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      free(m1);
+      c8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+      cc:	48 89 c7             	mov    %rax,%rdi
+      cf:	e8 31 19 00 00       	call   1a05 <free>
+      m1 = m2;
+      d4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+      d8:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    while (m1) {
+      dc:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+      e1:	75 da                	jne    bd <memtest+0x74>
+    }
+    m1 = malloc(1024 * 20);
+      e3:	bf 00 50 00 00       	mov    $0x5000,%edi
+      e8:	e8 9f 1a 00 00       	call   1b8c <malloc>
+      ed:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    if (m1 == 0) {
+      f1:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+      f6:	75 5c                	jne    154 <memtest+0x10b>
+      error("couldn't allocate mem?!!\n");
+      f8:	8b 05 62 26 00 00    	mov    0x2662(%rip),%eax        # 2760 <stdout>
+      fe:	ba 5d 00 00 00       	mov    $0x5d,%edx
+     103:	48 8d 0d bc 1b 00 00 	lea    0x1bbc(%rip),%rcx        # 1cc6 <malloc+0x13a>
+     10a:	48 89 ce             	mov    %rcx,%rsi
+     10d:	89 c7                	mov    %eax,%edi
+     10f:	b8 00 00 00 00       	mov    $0x0,%eax
+     114:	e8 85 12 00 00       	call   139e <printf>
+     119:	8b 05 41 26 00 00    	mov    0x2641(%rip),%eax        # 2760 <stdout>
+     11f:	48 8d 15 b2 1b 00 00 	lea    0x1bb2(%rip),%rdx        # 1cd8 <malloc+0x14c>
+     126:	48 89 d6             	mov    %rdx,%rsi
+     129:	89 c7                	mov    %eax,%edi
+     12b:	b8 00 00 00 00       	mov    $0x0,%eax
+     130:	e8 69 12 00 00       	call   139e <printf>
+     135:	8b 05 25 26 00 00    	mov    0x2625(%rip),%eax        # 2760 <stdout>
+     13b:	48 8d 15 b0 1b 00 00 	lea    0x1bb0(%rip),%rdx        # 1cf2 <malloc+0x166>
+     142:	48 89 d6             	mov    %rdx,%rsi
+     145:	89 c7                	mov    %eax,%edi
+     147:	b8 00 00 00 00       	mov    $0x0,%eax
+     14c:	e8 4d 12 00 00       	call   139e <printf>
+     151:	90                   	nop
+     152:	eb fd                	jmp    151 <memtest+0x108>
+    }
+    free(m1);
+     154:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     158:	48 89 c7             	mov    %rax,%rdi
+     15b:	e8 a5 18 00 00       	call   1a05 <free>
+    printf(stdout, "mem ok\n");
+     160:	8b 05 fa 25 00 00    	mov    0x25fa(%rip),%eax        # 2760 <stdout>
+     166:	48 8d 15 87 1b 00 00 	lea    0x1b87(%rip),%rdx        # 1cf4 <malloc+0x168>
+     16d:	48 89 d6             	mov    %rdx,%rsi
+     170:	89 c7                	mov    %eax,%edi
+     172:	b8 00 00 00 00       	mov    $0x0,%eax
+     177:	e8 22 12 00 00       	call   139e <printf>
+    exit();
+     17c:	e8 c4 17 00 00       	call   1945 <exit>
+  } else {
+    wait();
+     181:	e8 c7 17 00 00       	call   194d <wait>
+  }
+  printf(stdout, "memtest passed\n");
+     186:	8b 05 d4 25 00 00    	mov    0x25d4(%rip),%eax        # 2760 <stdout>
+     18c:	48 8d 15 69 1b 00 00 	lea    0x1b69(%rip),%rdx        # 1cfc <malloc+0x170>
+     193:	48 89 d6             	mov    %rdx,%rsi
+     196:	89 c7                	mov    %eax,%edi
+     198:	b8 00 00 00 00       	mov    $0x0,%eax
+     19d:	e8 fc 11 00 00       	call   139e <printf>
+}
+     1a2:	90                   	nop
+     1a3:	c9                   	leave
+     1a4:	c3                   	ret
+
+00000000000001a5 <sbrktest>:
+
+void sbrktest(void) {
+     1a5:	55                   	push   %rbp
+     1a6:	48 89 e5             	mov    %rsp,%rbp
+     1a9:	48 81 ec d0 00 00 00 	sub    $0xd0,%rsp
+  uint64_t amt;
+  struct sys_info info;
+
+  struct sys_info info1, info2;
+
+  printf(stdout, "sbrktest\n");
+     1b0:	8b 05 aa 25 00 00    	mov    0x25aa(%rip),%eax        # 2760 <stdout>
+     1b6:	48 8d 15 4f 1b 00 00 	lea    0x1b4f(%rip),%rdx        # 1d0c <malloc+0x180>
+     1bd:	48 89 d6             	mov    %rdx,%rsi
+     1c0:	89 c7                	mov    %eax,%edi
+     1c2:	b8 00 00 00 00       	mov    $0x0,%eax
+     1c7:	e8 d2 11 00 00       	call   139e <printf>
+  oldbrk = sbrk(0);
+     1cc:	bf 00 00 00 00       	mov    $0x0,%edi
+     1d1:	e8 f7 17 00 00       	call   19cd <sbrk>
+     1d6:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+
+  sysinfo(&info1);
+     1da:	48 8d 85 58 ff ff ff 	lea    -0xa8(%rbp),%rax
+     1e1:	48 89 c7             	mov    %rax,%rdi
+     1e4:	e8 fc 17 00 00       	call   19e5 <sysinfo>
+  printf(stdout, "loop of 500  = %d\n",
+     1e9:	8b 95 58 ff ff ff    	mov    -0xa8(%rbp),%edx
+     1ef:	8b 05 6b 25 00 00    	mov    0x256b(%rip),%eax        # 2760 <stdout>
+     1f5:	48 8d 0d 1a 1b 00 00 	lea    0x1b1a(%rip),%rcx        # 1d16 <malloc+0x18a>
+     1fc:	48 89 ce             	mov    %rcx,%rsi
+     1ff:	89 c7                	mov    %eax,%edi
+     201:	b8 00 00 00 00       	mov    $0x0,%eax
+     206:	e8 93 11 00 00       	call   139e <printf>
+         info1.pages_in_use);
+
+  // can one sbrk() less than a page?
+  a = sbrk(0);
+     20b:	bf 00 00 00 00       	mov    $0x0,%edi
+     210:	e8 b8 17 00 00       	call   19cd <sbrk>
+     215:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  int i;
+  for (i = 0; i < 5000; i++) {
+     219:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+     220:	e9 96 00 00 00       	jmp    2bb <sbrktest+0x116>
+    b = sbrk(1);
+     225:	bf 01 00 00 00       	mov    $0x1,%edi
+     22a:	e8 9e 17 00 00       	call   19cd <sbrk>
+     22f:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+    if (b != a) {
+     233:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+     237:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+     23b:	74 67                	je     2a4 <sbrktest+0xff>
+      error("sbrk test failed %d %x %x\n", i, a, b);
+     23d:	8b 05 1d 25 00 00    	mov    0x251d(%rip),%eax        # 2760 <stdout>
+     243:	ba 7d 00 00 00       	mov    $0x7d,%edx
+     248:	48 8d 0d 77 1a 00 00 	lea    0x1a77(%rip),%rcx        # 1cc6 <malloc+0x13a>
+     24f:	48 89 ce             	mov    %rcx,%rsi
+     252:	89 c7                	mov    %eax,%edi
+     254:	b8 00 00 00 00       	mov    $0x0,%eax
+     259:	e8 40 11 00 00       	call   139e <printf>
+     25e:	8b 05 fc 24 00 00    	mov    0x24fc(%rip),%eax        # 2760 <stdout>
+     264:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+     268:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+     26c:	8b 55 f4             	mov    -0xc(%rbp),%edx
+     26f:	49 89 f0             	mov    %rsi,%r8
+     272:	48 8d 35 b0 1a 00 00 	lea    0x1ab0(%rip),%rsi        # 1d29 <malloc+0x19d>
+     279:	89 c7                	mov    %eax,%edi
+     27b:	b8 00 00 00 00       	mov    $0x0,%eax
+     280:	e8 19 11 00 00       	call   139e <printf>
+     285:	8b 05 d5 24 00 00    	mov    0x24d5(%rip),%eax        # 2760 <stdout>
+     28b:	48 8d 15 60 1a 00 00 	lea    0x1a60(%rip),%rdx        # 1cf2 <malloc+0x166>
+     292:	48 89 d6             	mov    %rdx,%rsi
+     295:	89 c7                	mov    %eax,%edi
+     297:	b8 00 00 00 00       	mov    $0x0,%eax
+     29c:	e8 fd 10 00 00       	call   139e <printf>
+     2a1:	90                   	nop
+     2a2:	eb fd                	jmp    2a1 <sbrktest+0xfc>
+    }
+    *b = 1;
+     2a4:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+     2a8:	c6 00 01             	movb   $0x1,(%rax)
+    a = b + 1;
+     2ab:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+     2af:	48 83 c0 01          	add    $0x1,%rax
+     2b3:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  for (i = 0; i < 5000; i++) {
+     2b7:	83 45 f4 01          	addl   $0x1,-0xc(%rbp)
+     2bb:	81 7d f4 87 13 00 00 	cmpl   $0x1387,-0xc(%rbp)
+     2c2:	0f 8e 5d ff ff ff    	jle    225 <sbrktest+0x80>
+  }
+  pid = fork();
+     2c8:	e8 70 16 00 00       	call   193d <fork>
+     2cd:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  if (pid < 0) {
+     2d0:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+     2d4:	79 5c                	jns    332 <sbrktest+0x18d>
+    error("sbrk test fork failed\n");
+     2d6:	8b 05 84 24 00 00    	mov    0x2484(%rip),%eax        # 2760 <stdout>
+     2dc:	ba 84 00 00 00       	mov    $0x84,%edx
+     2e1:	48 8d 0d de 19 00 00 	lea    0x19de(%rip),%rcx        # 1cc6 <malloc+0x13a>
+     2e8:	48 89 ce             	mov    %rcx,%rsi
+     2eb:	89 c7                	mov    %eax,%edi
+     2ed:	b8 00 00 00 00       	mov    $0x0,%eax
+     2f2:	e8 a7 10 00 00       	call   139e <printf>
+     2f7:	8b 05 63 24 00 00    	mov    0x2463(%rip),%eax        # 2760 <stdout>
+     2fd:	48 8d 15 40 1a 00 00 	lea    0x1a40(%rip),%rdx        # 1d44 <malloc+0x1b8>
+     304:	48 89 d6             	mov    %rdx,%rsi
+     307:	89 c7                	mov    %eax,%edi
+     309:	b8 00 00 00 00       	mov    $0x0,%eax
+     30e:	e8 8b 10 00 00       	call   139e <printf>
+     313:	8b 05 47 24 00 00    	mov    0x2447(%rip),%eax        # 2760 <stdout>
+     319:	48 8d 15 d2 19 00 00 	lea    0x19d2(%rip),%rdx        # 1cf2 <malloc+0x166>
+     320:	48 89 d6             	mov    %rdx,%rsi
+     323:	89 c7                	mov    %eax,%edi
+     325:	b8 00 00 00 00       	mov    $0x0,%eax
+     32a:	e8 6f 10 00 00       	call   139e <printf>
+     32f:	90                   	nop
+     330:	eb fd                	jmp    32f <sbrktest+0x18a>
+  }
+  c = sbrk(1);
+     332:	bf 01 00 00 00       	mov    $0x1,%edi
+     337:	e8 91 16 00 00       	call   19cd <sbrk>
+     33c:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  c = sbrk(1);
+     340:	bf 01 00 00 00       	mov    $0x1,%edi
+     345:	e8 83 16 00 00       	call   19cd <sbrk>
+     34a:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  if (c != a + 1) {
+     34e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     352:	48 83 c0 01          	add    $0x1,%rax
+     356:	48 39 45 d8          	cmp    %rax,-0x28(%rbp)
+     35a:	74 5c                	je     3b8 <sbrktest+0x213>
+    error("sbrk test failed post-fork\n");
+     35c:	8b 05 fe 23 00 00    	mov    0x23fe(%rip),%eax        # 2760 <stdout>
+     362:	ba 89 00 00 00       	mov    $0x89,%edx
+     367:	48 8d 0d 58 19 00 00 	lea    0x1958(%rip),%rcx        # 1cc6 <malloc+0x13a>
+     36e:	48 89 ce             	mov    %rcx,%rsi
+     371:	89 c7                	mov    %eax,%edi
+     373:	b8 00 00 00 00       	mov    $0x0,%eax
+     378:	e8 21 10 00 00       	call   139e <printf>
+     37d:	8b 05 dd 23 00 00    	mov    0x23dd(%rip),%eax        # 2760 <stdout>
+     383:	48 8d 15 d1 19 00 00 	lea    0x19d1(%rip),%rdx        # 1d5b <malloc+0x1cf>
+     38a:	48 89 d6             	mov    %rdx,%rsi
+     38d:	89 c7                	mov    %eax,%edi
+     38f:	b8 00 00 00 00       	mov    $0x0,%eax
+     394:	e8 05 10 00 00       	call   139e <printf>
+     399:	8b 05 c1 23 00 00    	mov    0x23c1(%rip),%eax        # 2760 <stdout>
+     39f:	48 8d 15 4c 19 00 00 	lea    0x194c(%rip),%rdx        # 1cf2 <malloc+0x166>
+     3a6:	48 89 d6             	mov    %rdx,%rsi
+     3a9:	89 c7                	mov    %eax,%edi
+     3ab:	b8 00 00 00 00       	mov    $0x0,%eax
+     3b0:	e8 e9 0f 00 00       	call   139e <printf>
+     3b5:	90                   	nop
+     3b6:	eb fd                	jmp    3b5 <sbrktest+0x210>
+  }
+  if (pid == 0)
+     3b8:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+     3bc:	75 05                	jne    3c3 <sbrktest+0x21e>
+    exit();
+     3be:	e8 82 15 00 00       	call   1945 <exit>
+  wait();
+     3c3:	e8 85 15 00 00       	call   194d <wait>
+
+  // can one grow address space to something big?
+  sysinfo(&info1);
+     3c8:	48 8d 85 58 ff ff ff 	lea    -0xa8(%rbp),%rax
+     3cf:	48 89 c7             	mov    %rax,%rdi
+     3d2:	e8 0e 16 00 00       	call   19e5 <sysinfo>
+  printf(stdout, "pages_in_use before grow address big = %d\n",
+     3d7:	8b 95 58 ff ff ff    	mov    -0xa8(%rbp),%edx
+     3dd:	8b 05 7d 23 00 00    	mov    0x237d(%rip),%eax        # 2760 <stdout>
+     3e3:	48 8d 0d 8e 19 00 00 	lea    0x198e(%rip),%rcx        # 1d78 <malloc+0x1ec>
+     3ea:	48 89 ce             	mov    %rcx,%rsi
+     3ed:	89 c7                	mov    %eax,%edi
+     3ef:	b8 00 00 00 00       	mov    $0x0,%eax
+     3f4:	e8 a5 0f 00 00       	call   139e <printf>
+         info1.pages_in_use);
+#define BIG (1 * 1024 * 1024)
+  a = sbrk(0);
+     3f9:	bf 00 00 00 00       	mov    $0x0,%edi
+     3fe:	e8 ca 15 00 00       	call   19cd <sbrk>
+     403:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  amt = (BIG) - (uint64_t)a;
+     407:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     40b:	ba 00 00 10 00       	mov    $0x100000,%edx
+     410:	48 29 c2             	sub    %rax,%rdx
+     413:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  p = sbrk(amt);
+     417:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+     41b:	89 c7                	mov    %eax,%edi
+     41d:	e8 ab 15 00 00       	call   19cd <sbrk>
+     422:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  if (p != a) {
+     426:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+     42a:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+     42e:	74 5c                	je     48c <sbrktest+0x2e7>
+    error("sbrk test failed to grow big address space; enough phys mem?\n");
+     430:	8b 05 2a 23 00 00    	mov    0x232a(%rip),%eax        # 2760 <stdout>
+     436:	ba 98 00 00 00       	mov    $0x98,%edx
+     43b:	48 8d 0d 84 18 00 00 	lea    0x1884(%rip),%rcx        # 1cc6 <malloc+0x13a>
+     442:	48 89 ce             	mov    %rcx,%rsi
+     445:	89 c7                	mov    %eax,%edi
+     447:	b8 00 00 00 00       	mov    $0x0,%eax
+     44c:	e8 4d 0f 00 00       	call   139e <printf>
+     451:	8b 05 09 23 00 00    	mov    0x2309(%rip),%eax        # 2760 <stdout>
+     457:	48 8d 15 4a 19 00 00 	lea    0x194a(%rip),%rdx        # 1da8 <malloc+0x21c>
+     45e:	48 89 d6             	mov    %rdx,%rsi
+     461:	89 c7                	mov    %eax,%edi
+     463:	b8 00 00 00 00       	mov    $0x0,%eax
+     468:	e8 31 0f 00 00       	call   139e <printf>
+     46d:	8b 05 ed 22 00 00    	mov    0x22ed(%rip),%eax        # 2760 <stdout>
+     473:	48 8d 15 78 18 00 00 	lea    0x1878(%rip),%rdx        # 1cf2 <malloc+0x166>
+     47a:	48 89 d6             	mov    %rdx,%rsi
+     47d:	89 c7                	mov    %eax,%edi
+     47f:	b8 00 00 00 00       	mov    $0x0,%eax
+     484:	e8 15 0f 00 00       	call   139e <printf>
+     489:	90                   	nop
+     48a:	eb fd                	jmp    489 <sbrktest+0x2e4>
+  }
+  lastaddr = (char *)(BIG - 1);
+     48c:	48 c7 45 c0 ff ff 0f 	movq   $0xfffff,-0x40(%rbp)
+     493:	00 
+  *lastaddr = 99;
+     494:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+     498:	c6 00 63             	movb   $0x63,(%rax)
+
+  sysinfo(&info1);
+     49b:	48 8d 85 58 ff ff ff 	lea    -0xa8(%rbp),%rax
+     4a2:	48 89 c7             	mov    %rax,%rdi
+     4a5:	e8 3b 15 00 00       	call   19e5 <sysinfo>
+  printf(stdout, "pages_in_use before read kernel memory = %d\n",
+     4aa:	8b 95 58 ff ff ff    	mov    -0xa8(%rbp),%edx
+     4b0:	8b 05 aa 22 00 00    	mov    0x22aa(%rip),%eax        # 2760 <stdout>
+     4b6:	48 8d 0d 2b 19 00 00 	lea    0x192b(%rip),%rcx        # 1de8 <malloc+0x25c>
+     4bd:	48 89 ce             	mov    %rcx,%rsi
+     4c0:	89 c7                	mov    %eax,%edi
+     4c2:	b8 00 00 00 00       	mov    $0x0,%eax
+     4c7:	e8 d2 0e 00 00       	call   139e <printf>
+         info1.pages_in_use);
+
+  // can we read the kernel's memory?
+  printf(stdout, "pids 4-43 (6-45 if ran after sh) should be killed with trap 14 err 5\n");
+     4cc:	8b 05 8e 22 00 00    	mov    0x228e(%rip),%eax        # 2760 <stdout>
+     4d2:	48 8d 15 3f 19 00 00 	lea    0x193f(%rip),%rdx        # 1e18 <malloc+0x28c>
+     4d9:	48 89 d6             	mov    %rdx,%rsi
+     4dc:	89 c7                	mov    %eax,%edi
+     4de:	b8 00 00 00 00       	mov    $0x0,%eax
+     4e3:	e8 b6 0e 00 00       	call   139e <printf>
+  for (a = (char *)(KERNBASE); a < (char *)(KERNBASE + 2000000); a += 50000) {
+     4e8:	48 c7 45 f8 00 00 00 	movq   $0xffffffff80000000,-0x8(%rbp)
+     4ef:	80 
+     4f0:	e9 04 01 00 00       	jmp    5f9 <sbrktest+0x454>
+    pid = fork();
+     4f5:	e8 43 14 00 00       	call   193d <fork>
+     4fa:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+    if (pid < 0) {
+     4fd:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+     501:	79 5c                	jns    55f <sbrktest+0x3ba>
+      error("fork failed\n");
+     503:	8b 05 57 22 00 00    	mov    0x2257(%rip),%eax        # 2760 <stdout>
+     509:	ba a6 00 00 00       	mov    $0xa6,%edx
+     50e:	48 8d 0d b1 17 00 00 	lea    0x17b1(%rip),%rcx        # 1cc6 <malloc+0x13a>
+     515:	48 89 ce             	mov    %rcx,%rsi
+     518:	89 c7                	mov    %eax,%edi
+     51a:	b8 00 00 00 00       	mov    $0x0,%eax
+     51f:	e8 7a 0e 00 00       	call   139e <printf>
+     524:	8b 05 36 22 00 00    	mov    0x2236(%rip),%eax        # 2760 <stdout>
+     52a:	48 8d 15 2d 19 00 00 	lea    0x192d(%rip),%rdx        # 1e5e <malloc+0x2d2>
+     531:	48 89 d6             	mov    %rdx,%rsi
+     534:	89 c7                	mov    %eax,%edi
+     536:	b8 00 00 00 00       	mov    $0x0,%eax
+     53b:	e8 5e 0e 00 00       	call   139e <printf>
+     540:	8b 05 1a 22 00 00    	mov    0x221a(%rip),%eax        # 2760 <stdout>
+     546:	48 8d 15 a5 17 00 00 	lea    0x17a5(%rip),%rdx        # 1cf2 <malloc+0x166>
+     54d:	48 89 d6             	mov    %rdx,%rsi
+     550:	89 c7                	mov    %eax,%edi
+     552:	b8 00 00 00 00       	mov    $0x0,%eax
+     557:	e8 42 0e 00 00       	call   139e <printf>
+     55c:	90                   	nop
+     55d:	eb fd                	jmp    55c <sbrktest+0x3b7>
+    }
+    if (pid == 0) {
+     55f:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+     563:	0f 85 83 00 00 00    	jne    5ec <sbrktest+0x447>
+      printf(stdout, "oops could read %x = %x\n", a, *a);
+     569:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     56d:	0f b6 00             	movzbl (%rax),%eax
+     570:	0f be c8             	movsbl %al,%ecx
+     573:	8b 05 e7 21 00 00    	mov    0x21e7(%rip),%eax        # 2760 <stdout>
+     579:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+     57d:	48 8d 35 e7 18 00 00 	lea    0x18e7(%rip),%rsi        # 1e6b <malloc+0x2df>
+     584:	89 c7                	mov    %eax,%edi
+     586:	b8 00 00 00 00       	mov    $0x0,%eax
+     58b:	e8 0e 0e 00 00       	call   139e <printf>
+      error("a bad process is not killed!");
+     590:	8b 05 ca 21 00 00    	mov    0x21ca(%rip),%eax        # 2760 <stdout>
+     596:	ba aa 00 00 00       	mov    $0xaa,%edx
+     59b:	48 8d 0d 24 17 00 00 	lea    0x1724(%rip),%rcx        # 1cc6 <malloc+0x13a>
+     5a2:	48 89 ce             	mov    %rcx,%rsi
+     5a5:	89 c7                	mov    %eax,%edi
+     5a7:	b8 00 00 00 00       	mov    $0x0,%eax
+     5ac:	e8 ed 0d 00 00       	call   139e <printf>
+     5b1:	8b 05 a9 21 00 00    	mov    0x21a9(%rip),%eax        # 2760 <stdout>
+     5b7:	48 8d 15 c6 18 00 00 	lea    0x18c6(%rip),%rdx        # 1e84 <malloc+0x2f8>
+     5be:	48 89 d6             	mov    %rdx,%rsi
+     5c1:	89 c7                	mov    %eax,%edi
+     5c3:	b8 00 00 00 00       	mov    $0x0,%eax
+     5c8:	e8 d1 0d 00 00       	call   139e <printf>
+     5cd:	8b 05 8d 21 00 00    	mov    0x218d(%rip),%eax        # 2760 <stdout>
+     5d3:	48 8d 15 18 17 00 00 	lea    0x1718(%rip),%rdx        # 1cf2 <malloc+0x166>
+     5da:	48 89 d6             	mov    %rdx,%rsi
+     5dd:	89 c7                	mov    %eax,%edi
+     5df:	b8 00 00 00 00       	mov    $0x0,%eax
+     5e4:	e8 b5 0d 00 00       	call   139e <printf>
+     5e9:	90                   	nop
+     5ea:	eb fd                	jmp    5e9 <sbrktest+0x444>
+    }
+    wait();
+     5ec:	e8 5c 13 00 00       	call   194d <wait>
+  for (a = (char *)(KERNBASE); a < (char *)(KERNBASE + 2000000); a += 50000) {
+     5f1:	48 81 45 f8 50 c3 00 	addq   $0xc350,-0x8(%rbp)
+     5f8:	00 
+     5f9:	48 81 7d f8 7f 84 1e 	cmpq   $0xffffffff801e847f,-0x8(%rbp)
+     600:	80 
+     601:	0f 86 ee fe ff ff    	jbe    4f5 <sbrktest+0x350>
+  }
+
+  
+  sysinfo(&info1);
+     607:	48 8d 85 58 ff ff ff 	lea    -0xa8(%rbp),%rax
+     60e:	48 89 c7             	mov    %rax,%rdi
+     611:	e8 cf 13 00 00       	call   19e5 <sysinfo>
+  printf(stdout, "pages_in_use before sbrk run out of memory = %d\n",
+     616:	8b 95 58 ff ff ff    	mov    -0xa8(%rbp),%edx
+     61c:	8b 05 3e 21 00 00    	mov    0x213e(%rip),%eax        # 2760 <stdout>
+     622:	48 8d 0d 7f 18 00 00 	lea    0x187f(%rip),%rcx        # 1ea8 <malloc+0x31c>
+     629:	48 89 ce             	mov    %rcx,%rsi
+     62c:	89 c7                	mov    %eax,%edi
+     62e:	b8 00 00 00 00       	mov    $0x0,%eax
+     633:	e8 66 0d 00 00       	call   139e <printf>
+  
+
+
+  // if we run the system out of memory, does it clean up the last
+  // failed allocation?
+  if (fork() == 0) {
+     638:	e8 00 13 00 00       	call   193d <fork>
+     63d:	85 c0                	test   %eax,%eax
+     63f:	0f 85 e2 00 00 00    	jne    727 <sbrktest+0x582>
+    do {
+      sysinfo(&info);
+     645:	48 8d 85 7c ff ff ff 	lea    -0x84(%rbp),%rax
+     64c:	48 89 c7             	mov    %rax,%rdi
+     64f:	e8 91 13 00 00       	call   19e5 <sysinfo>
+      free_pages = info.free_pages;
+     654:	8b 45 84             	mov    -0x7c(%rbp),%eax
+     657:	89 45 ac             	mov    %eax,-0x54(%rbp)
+      // printf(stdout, "free pages before sbrk: %d\n", free_pages);
+      c = sbrk(BIG);
+     65a:	bf 00 00 10 00       	mov    $0x100000,%edi
+     65f:	e8 69 13 00 00       	call   19cd <sbrk>
+     664:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+    } while ((c = sbrk(BIG)) != (char *) -1);
+     668:	bf 00 00 10 00       	mov    $0x100000,%edi
+     66d:	e8 5b 13 00 00       	call   19cd <sbrk>
+     672:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+     676:	48 83 7d d8 ff       	cmpq   $0xffffffffffffffff,-0x28(%rbp)
+     67b:	75 c8                	jne    645 <sbrktest+0x4a0>
+    sysinfo(&info);
+     67d:	48 8d 85 7c ff ff ff 	lea    -0x84(%rbp),%rax
+     684:	48 89 c7             	mov    %rax,%rdi
+     687:	e8 59 13 00 00       	call   19e5 <sysinfo>
+    printf(stdout, "free pages after out-of-memory(shouldn't be 0): %d\n", info.free_pages);
+     68c:	8b 55 84             	mov    -0x7c(%rbp),%edx
+     68f:	8b 05 cb 20 00 00    	mov    0x20cb(%rip),%eax        # 2760 <stdout>
+     695:	48 8d 0d 44 18 00 00 	lea    0x1844(%rip),%rcx        # 1ee0 <malloc+0x354>
+     69c:	48 89 ce             	mov    %rcx,%rsi
+     69f:	89 c7                	mov    %eax,%edi
+     6a1:	b8 00 00 00 00       	mov    $0x0,%eax
+     6a6:	e8 f3 0c 00 00       	call   139e <printf>
+
+    // if those failed allocations freed up the pages they did allocate,
+    // we'll be able to allocate here
+    c = sbrk(4096);
+     6ab:	bf 00 10 00 00       	mov    $0x1000,%edi
+     6b0:	e8 18 13 00 00       	call   19cd <sbrk>
+     6b5:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+    if (free_pages != 0 && c == (char *) -1) {
+     6b9:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+     6bd:	74 63                	je     722 <sbrktest+0x57d>
+     6bf:	48 83 7d d8 ff       	cmpq   $0xffffffffffffffff,-0x28(%rbp)
+     6c4:	75 5c                	jne    722 <sbrktest+0x57d>
+      error("failed sbrk leaked memory. Uncomment lines 136 for more information.\n");
+     6c6:	8b 05 94 20 00 00    	mov    0x2094(%rip),%eax        # 2760 <stdout>
+     6cc:	ba c6 00 00 00       	mov    $0xc6,%edx
+     6d1:	48 8d 0d ee 15 00 00 	lea    0x15ee(%rip),%rcx        # 1cc6 <malloc+0x13a>
+     6d8:	48 89 ce             	mov    %rcx,%rsi
+     6db:	89 c7                	mov    %eax,%edi
+     6dd:	b8 00 00 00 00       	mov    $0x0,%eax
+     6e2:	e8 b7 0c 00 00       	call   139e <printf>
+     6e7:	8b 05 73 20 00 00    	mov    0x2073(%rip),%eax        # 2760 <stdout>
+     6ed:	48 8d 15 24 18 00 00 	lea    0x1824(%rip),%rdx        # 1f18 <malloc+0x38c>
+     6f4:	48 89 d6             	mov    %rdx,%rsi
+     6f7:	89 c7                	mov    %eax,%edi
+     6f9:	b8 00 00 00 00       	mov    $0x0,%eax
+     6fe:	e8 9b 0c 00 00       	call   139e <printf>
+     703:	8b 05 57 20 00 00    	mov    0x2057(%rip),%eax        # 2760 <stdout>
+     709:	48 8d 15 e2 15 00 00 	lea    0x15e2(%rip),%rdx        # 1cf2 <malloc+0x166>
+     710:	48 89 d6             	mov    %rdx,%rsi
+     713:	89 c7                	mov    %eax,%edi
+     715:	b8 00 00 00 00       	mov    $0x0,%eax
+     71a:	e8 7f 0c 00 00       	call   139e <printf>
+     71f:	90                   	nop
+     720:	eb fd                	jmp    71f <sbrktest+0x57a>
+    }
+    exit();
+     722:	e8 1e 12 00 00       	call   1945 <exit>
+  } else {
+    wait();
+     727:	e8 21 12 00 00       	call   194d <wait>
+  }
+
+
+  
+  sysinfo(&info1);
+     72c:	48 8d 85 58 ff ff ff 	lea    -0xa8(%rbp),%rax
+     733:	48 89 c7             	mov    %rax,%rdi
+     736:	e8 aa 12 00 00       	call   19e5 <sysinfo>
+
+  printf(stdout, "pages_in_use before sbrk decrement = %d\n",
+     73b:	8b 95 58 ff ff ff    	mov    -0xa8(%rbp),%edx
+     741:	8b 05 19 20 00 00    	mov    0x2019(%rip),%eax        # 2760 <stdout>
+     747:	48 8d 0d 12 18 00 00 	lea    0x1812(%rip),%rcx        # 1f60 <malloc+0x3d4>
+     74e:	48 89 ce             	mov    %rcx,%rsi
+     751:	89 c7                	mov    %eax,%edi
+     753:	b8 00 00 00 00       	mov    $0x0,%eax
+     758:	e8 41 0c 00 00       	call   139e <printf>
+         info1.pages_in_use);
+
+  char *d = sbrk(0);
+     75d:	bf 00 00 00 00       	mov    $0x0,%edi
+     762:	e8 66 12 00 00       	call   19cd <sbrk>
+     767:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  if (d > oldbrk) {
+     76b:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+     76f:	48 39 45 e8          	cmp    %rax,-0x18(%rbp)
+     773:	0f 83 88 02 00 00    	jae    a01 <sbrktest+0x85c>
+    if (sbrk(-(d - oldbrk)) != d)
+     779:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     77d:	48 2b 45 b8          	sub    -0x48(%rbp),%rax
+     781:	89 c7                	mov    %eax,%edi
+     783:	e8 45 12 00 00       	call   19cd <sbrk>
+     788:	48 39 45 b8          	cmp    %rax,-0x48(%rbp)
+     78c:	74 5c                	je     7ea <sbrktest+0x645>
+      error("sbrk negative number doesn't return prev break\n");
+     78e:	8b 05 cc 1f 00 00    	mov    0x1fcc(%rip),%eax        # 2760 <stdout>
+     794:	ba d7 00 00 00       	mov    $0xd7,%edx
+     799:	48 8d 0d 26 15 00 00 	lea    0x1526(%rip),%rcx        # 1cc6 <malloc+0x13a>
+     7a0:	48 89 ce             	mov    %rcx,%rsi
+     7a3:	89 c7                	mov    %eax,%edi
+     7a5:	b8 00 00 00 00       	mov    $0x0,%eax
+     7aa:	e8 ef 0b 00 00       	call   139e <printf>
+     7af:	8b 05 ab 1f 00 00    	mov    0x1fab(%rip),%eax        # 2760 <stdout>
+     7b5:	48 8d 15 d4 17 00 00 	lea    0x17d4(%rip),%rdx        # 1f90 <malloc+0x404>
+     7bc:	48 89 d6             	mov    %rdx,%rsi
+     7bf:	89 c7                	mov    %eax,%edi
+     7c1:	b8 00 00 00 00       	mov    $0x0,%eax
+     7c6:	e8 d3 0b 00 00       	call   139e <printf>
+     7cb:	8b 05 8f 1f 00 00    	mov    0x1f8f(%rip),%eax        # 2760 <stdout>
+     7d1:	48 8d 15 1a 15 00 00 	lea    0x151a(%rip),%rdx        # 1cf2 <malloc+0x166>
+     7d8:	48 89 d6             	mov    %rdx,%rsi
+     7db:	89 c7                	mov    %eax,%edi
+     7dd:	b8 00 00 00 00       	mov    $0x0,%eax
+     7e2:	e8 b7 0b 00 00       	call   139e <printf>
+     7e7:	90                   	nop
+     7e8:	eb fd                	jmp    7e7 <sbrktest+0x642>
+
+    sysinfo(&info1);
+     7ea:	48 8d 85 58 ff ff ff 	lea    -0xa8(%rbp),%rax
+     7f1:	48 89 c7             	mov    %rax,%rdi
+     7f4:	e8 ec 11 00 00       	call   19e5 <sysinfo>
+
+    printf(stdout, "pages_in_use after sbrk decrement = %d\n",
+     7f9:	8b 95 58 ff ff ff    	mov    -0xa8(%rbp),%edx
+     7ff:	8b 05 5b 1f 00 00    	mov    0x1f5b(%rip),%eax        # 2760 <stdout>
+     805:	48 8d 0d b4 17 00 00 	lea    0x17b4(%rip),%rcx        # 1fc0 <malloc+0x434>
+     80c:	48 89 ce             	mov    %rcx,%rsi
+     80f:	89 c7                	mov    %eax,%edi
+     811:	b8 00 00 00 00       	mov    $0x0,%eax
+     816:	e8 83 0b 00 00       	call   139e <printf>
+         info1.pages_in_use);
+
+    // OPTIONAL TESTS FOR SBRK DECREMENT
+    if (sbrk(0) == oldbrk) {
+     81b:	bf 00 00 00 00       	mov    $0x0,%edi
+     820:	e8 a8 11 00 00       	call   19cd <sbrk>
+     825:	48 39 45 e8          	cmp    %rax,-0x18(%rbp)
+     829:	0f 85 d2 01 00 00    	jne    a01 <sbrktest+0x85c>
+      printf(stdout, "Good job! sbrk decrement implemented!\n");
+     82f:	8b 05 2b 1f 00 00    	mov    0x1f2b(%rip),%eax        # 2760 <stdout>
+     835:	48 8d 15 ac 17 00 00 	lea    0x17ac(%rip),%rdx        # 1fe8 <malloc+0x45c>
+     83c:	48 89 d6             	mov    %rdx,%rsi
+     83f:	89 c7                	mov    %eax,%edi
+     841:	b8 00 00 00 00       	mov    $0x0,%eax
+     846:	e8 53 0b 00 00       	call   139e <printf>
+      if (sbrk(-1) != oldbrk) {
+     84b:	bf ff ff ff ff       	mov    $0xffffffff,%edi
+     850:	e8 78 11 00 00       	call   19cd <sbrk>
+     855:	48 39 45 e8          	cmp    %rax,-0x18(%rbp)
+     859:	74 5c                	je     8b7 <sbrktest+0x712>
+        error("sbrk decrement more than allocated should do nothing\n");
+     85b:	8b 05 ff 1e 00 00    	mov    0x1eff(%rip),%eax        # 2760 <stdout>
+     861:	ba e2 00 00 00       	mov    $0xe2,%edx
+     866:	48 8d 0d 59 14 00 00 	lea    0x1459(%rip),%rcx        # 1cc6 <malloc+0x13a>
+     86d:	48 89 ce             	mov    %rcx,%rsi
+     870:	89 c7                	mov    %eax,%edi
+     872:	b8 00 00 00 00       	mov    $0x0,%eax
+     877:	e8 22 0b 00 00       	call   139e <printf>
+     87c:	8b 05 de 1e 00 00    	mov    0x1ede(%rip),%eax        # 2760 <stdout>
+     882:	48 8d 15 87 17 00 00 	lea    0x1787(%rip),%rdx        # 2010 <malloc+0x484>
+     889:	48 89 d6             	mov    %rdx,%rsi
+     88c:	89 c7                	mov    %eax,%edi
+     88e:	b8 00 00 00 00       	mov    $0x0,%eax
+     893:	e8 06 0b 00 00       	call   139e <printf>
+     898:	8b 05 c2 1e 00 00    	mov    0x1ec2(%rip),%eax        # 2760 <stdout>
+     89e:	48 8d 15 4d 14 00 00 	lea    0x144d(%rip),%rdx        # 1cf2 <malloc+0x166>
+     8a5:	48 89 d6             	mov    %rdx,%rsi
+     8a8:	89 c7                	mov    %eax,%edi
+     8aa:	b8 00 00 00 00       	mov    $0x0,%eax
+     8af:	e8 ea 0a 00 00       	call   139e <printf>
+     8b4:	90                   	nop
+     8b5:	eb fd                	jmp    8b4 <sbrktest+0x70f>
+      }
+      sbrk(10);
+     8b7:	bf 0a 00 00 00       	mov    $0xa,%edi
+     8bc:	e8 0c 11 00 00       	call   19cd <sbrk>
+      char *newbrk = sbrk(0);
+     8c1:	bf 00 00 00 00       	mov    $0x0,%edi
+     8c6:	e8 02 11 00 00       	call   19cd <sbrk>
+     8cb:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+      if (sbrk(-100) != newbrk) {
+     8cf:	bf 9c ff ff ff       	mov    $0xffffff9c,%edi
+     8d4:	e8 f4 10 00 00       	call   19cd <sbrk>
+     8d9:	48 39 45 b0          	cmp    %rax,-0x50(%rbp)
+     8dd:	74 5c                	je     93b <sbrktest+0x796>
+        error("sbrk decrement more than allocated should do nothing\n");
+     8df:	8b 05 7b 1e 00 00    	mov    0x1e7b(%rip),%eax        # 2760 <stdout>
+     8e5:	ba e7 00 00 00       	mov    $0xe7,%edx
+     8ea:	48 8d 0d d5 13 00 00 	lea    0x13d5(%rip),%rcx        # 1cc6 <malloc+0x13a>
+     8f1:	48 89 ce             	mov    %rcx,%rsi
+     8f4:	89 c7                	mov    %eax,%edi
+     8f6:	b8 00 00 00 00       	mov    $0x0,%eax
+     8fb:	e8 9e 0a 00 00       	call   139e <printf>
+     900:	8b 05 5a 1e 00 00    	mov    0x1e5a(%rip),%eax        # 2760 <stdout>
+     906:	48 8d 15 03 17 00 00 	lea    0x1703(%rip),%rdx        # 2010 <malloc+0x484>
+     90d:	48 89 d6             	mov    %rdx,%rsi
+     910:	89 c7                	mov    %eax,%edi
+     912:	b8 00 00 00 00       	mov    $0x0,%eax
+     917:	e8 82 0a 00 00       	call   139e <printf>
+     91c:	8b 05 3e 1e 00 00    	mov    0x1e3e(%rip),%eax        # 2760 <stdout>
+     922:	48 8d 15 c9 13 00 00 	lea    0x13c9(%rip),%rdx        # 1cf2 <malloc+0x166>
+     929:	48 89 d6             	mov    %rdx,%rsi
+     92c:	89 c7                	mov    %eax,%edi
+     92e:	b8 00 00 00 00       	mov    $0x0,%eax
+     933:	e8 66 0a 00 00       	call   139e <printf>
+     938:	90                   	nop
+     939:	eb fd                	jmp    938 <sbrktest+0x793>
+      }
+      sbrk(-10);
+     93b:	bf f6 ff ff ff       	mov    $0xfffffff6,%edi
+     940:	e8 88 10 00 00       	call   19cd <sbrk>
+      if (sbrk(0) != oldbrk ) {
+     945:	bf 00 00 00 00       	mov    $0x0,%edi
+     94a:	e8 7e 10 00 00       	call   19cd <sbrk>
+     94f:	48 39 45 e8          	cmp    %rax,-0x18(%rbp)
+     953:	0f 84 8c 00 00 00    	je     9e5 <sbrktest+0x840>
+        printf(stdout, "sbrk(0) == %d and oldbrk == %d \n", sbrk(0), oldbrk);
+     959:	bf 00 00 00 00       	mov    $0x0,%edi
+     95e:	e8 6a 10 00 00       	call   19cd <sbrk>
+     963:	48 89 c6             	mov    %rax,%rsi
+     966:	8b 05 f4 1d 00 00    	mov    0x1df4(%rip),%eax        # 2760 <stdout>
+     96c:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+     970:	48 89 d1             	mov    %rdx,%rcx
+     973:	48 89 f2             	mov    %rsi,%rdx
+     976:	48 8d 35 cb 16 00 00 	lea    0x16cb(%rip),%rsi        # 2048 <malloc+0x4bc>
+     97d:	89 c7                	mov    %eax,%edi
+     97f:	b8 00 00 00 00       	mov    $0x0,%eax
+     984:	e8 15 0a 00 00       	call   139e <printf>
+        error("not releasing all heap memoery\n");
+     989:	8b 05 d1 1d 00 00    	mov    0x1dd1(%rip),%eax        # 2760 <stdout>
+     98f:	ba ec 00 00 00       	mov    $0xec,%edx
+     994:	48 8d 0d 2b 13 00 00 	lea    0x132b(%rip),%rcx        # 1cc6 <malloc+0x13a>
+     99b:	48 89 ce             	mov    %rcx,%rsi
+     99e:	89 c7                	mov    %eax,%edi
+     9a0:	b8 00 00 00 00       	mov    $0x0,%eax
+     9a5:	e8 f4 09 00 00       	call   139e <printf>
+     9aa:	8b 05 b0 1d 00 00    	mov    0x1db0(%rip),%eax        # 2760 <stdout>
+     9b0:	48 8d 15 b9 16 00 00 	lea    0x16b9(%rip),%rdx        # 2070 <malloc+0x4e4>
+     9b7:	48 89 d6             	mov    %rdx,%rsi
+     9ba:	89 c7                	mov    %eax,%edi
+     9bc:	b8 00 00 00 00       	mov    $0x0,%eax
+     9c1:	e8 d8 09 00 00       	call   139e <printf>
+     9c6:	8b 05 94 1d 00 00    	mov    0x1d94(%rip),%eax        # 2760 <stdout>
+     9cc:	48 8d 15 1f 13 00 00 	lea    0x131f(%rip),%rdx        # 1cf2 <malloc+0x166>
+     9d3:	48 89 d6             	mov    %rdx,%rsi
+     9d6:	89 c7                	mov    %eax,%edi
+     9d8:	b8 00 00 00 00       	mov    $0x0,%eax
+     9dd:	e8 bc 09 00 00       	call   139e <printf>
+     9e2:	90                   	nop
+     9e3:	eb fd                	jmp    9e2 <sbrktest+0x83d>
+      }
+      printf(stdout, "sbrk decrement test passed!\n");
+     9e5:	8b 05 75 1d 00 00    	mov    0x1d75(%rip),%eax        # 2760 <stdout>
+     9eb:	48 8d 15 9e 16 00 00 	lea    0x169e(%rip),%rdx        # 2090 <malloc+0x504>
+     9f2:	48 89 d6             	mov    %rdx,%rsi
+     9f5:	89 c7                	mov    %eax,%edi
+     9f7:	b8 00 00 00 00       	mov    $0x0,%eax
+     9fc:	e8 9d 09 00 00       	call   139e <printf>
+    }
+  }
+
+  printf(stdout, "sbrktest passed\n");
+     a01:	8b 05 59 1d 00 00    	mov    0x1d59(%rip),%eax        # 2760 <stdout>
+     a07:	48 8d 15 9f 16 00 00 	lea    0x169f(%rip),%rdx        # 20ad <malloc+0x521>
+     a0e:	48 89 d6             	mov    %rdx,%rsi
+     a11:	89 c7                	mov    %eax,%edi
+     a13:	b8 00 00 00 00       	mov    $0x0,%eax
+     a18:	e8 81 09 00 00       	call   139e <printf>
+}
+     a1d:	90                   	nop
+     a1e:	c9                   	leave
+     a1f:	c3                   	ret
+
+0000000000000a20 <growstacktest>:
+
+void growstacktest() {
+     a20:	55                   	push   %rbp
+     a21:	48 89 e5             	mov    %rsp,%rbp
+     a24:	41 57                	push   %r15
+     a26:	41 56                	push   %r14
+     a28:	41 55                	push   %r13
+     a2a:	41 54                	push   %r12
+     a2c:	53                   	push   %rbx
+     a2d:	48 83 ec 68          	sub    $0x68,%rsp
+     a31:	48 89 e0             	mov    %rsp,%rax
+     a34:	48 89 c3             	mov    %rax,%rbx
+  int i;
+  struct sys_info info1, info2;
+  printf(stdout, "growstacktest\n");
+     a37:	8b 05 23 1d 00 00    	mov    0x1d23(%rip),%eax        # 2760 <stdout>
+     a3d:	48 8d 15 7a 16 00 00 	lea    0x167a(%rip),%rdx        # 20be <malloc+0x532>
+     a44:	48 89 d6             	mov    %rdx,%rsi
+     a47:	89 c7                	mov    %eax,%edi
+     a49:	b8 00 00 00 00       	mov    $0x0,%eax
+     a4e:	e8 4b 09 00 00       	call   139e <printf>
+  sysinfo(&info1);
+     a53:	48 8d 45 94          	lea    -0x6c(%rbp),%rax
+     a57:	48 89 c7             	mov    %rax,%rdi
+     a5a:	e8 86 0f 00 00       	call   19e5 <sysinfo>
+
+  printf(stdout, "pages_in_use before stack allocation = %d\n",
+     a5f:	8b 55 94             	mov    -0x6c(%rbp),%edx
+     a62:	8b 05 f8 1c 00 00    	mov    0x1cf8(%rip),%eax        # 2760 <stdout>
+     a68:	48 8d 0d 61 16 00 00 	lea    0x1661(%rip),%rcx        # 20d0 <malloc+0x544>
+     a6f:	48 89 ce             	mov    %rcx,%rsi
+     a72:	89 c7                	mov    %eax,%edi
+     a74:	b8 00 00 00 00       	mov    $0x0,%eax
+     a79:	e8 20 09 00 00       	call   139e <printf>
+         info1.pages_in_use);
+  printf(stdout, "pages_in_swap before stack allocation = %d\n",
+     a7e:	8b 55 98             	mov    -0x68(%rbp),%edx
+     a81:	8b 05 d9 1c 00 00    	mov    0x1cd9(%rip),%eax        # 2760 <stdout>
+     a87:	48 8d 0d 72 16 00 00 	lea    0x1672(%rip),%rcx        # 2100 <malloc+0x574>
+     a8e:	48 89 ce             	mov    %rcx,%rsi
+     a91:	89 c7                	mov    %eax,%edi
+     a93:	b8 00 00 00 00       	mov    $0x0,%eax
+     a98:	e8 01 09 00 00       	call   139e <printf>
+         info1.pages_in_swap);
+
+  int page8 = 8 * 4096;
+     a9d:	c7 45 c8 00 80 00 00 	movl   $0x8000,-0x38(%rbp)
+  char buf[page8];
+     aa4:	8b 45 c8             	mov    -0x38(%rbp),%eax
+     aa7:	48 63 d0             	movslq %eax,%rdx
+     aaa:	48 83 ea 01          	sub    $0x1,%rdx
+     aae:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+     ab2:	48 63 d0             	movslq %eax,%rdx
+     ab5:	49 89 d6             	mov    %rdx,%r14
+     ab8:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+     abe:	48 63 d0             	movslq %eax,%rdx
+     ac1:	49 89 d4             	mov    %rdx,%r12
+     ac4:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+     aca:	48 98                	cltq
+     acc:	ba 10 00 00 00       	mov    $0x10,%edx
+     ad1:	48 83 ea 01          	sub    $0x1,%rdx
+     ad5:	48 01 d0             	add    %rdx,%rax
+     ad8:	be 10 00 00 00       	mov    $0x10,%esi
+     add:	ba 00 00 00 00       	mov    $0x0,%edx
+     ae2:	48 f7 f6             	div    %rsi
+     ae5:	48 6b c0 10          	imul   $0x10,%rax,%rax
+     ae9:	48 29 c4             	sub    %rax,%rsp
+     aec:	48 89 e0             	mov    %rsp,%rax
+     aef:	48 83 c0 00          	add    $0x0,%rax
+     af3:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  for (i = 0; i < 8; i++) {
+     af7:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%rbp)
+     afe:	eb 3a                	jmp    b3a <growstacktest+0x11a>
+    buf[i * 4096] = 'a';
+     b00:	8b 45 cc             	mov    -0x34(%rbp),%eax
+     b03:	c1 e0 0c             	shl    $0xc,%eax
+     b06:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+     b0a:	48 98                	cltq
+     b0c:	c6 04 02 61          	movb   $0x61,(%rdx,%rax,1)
+    buf[i * 4096 - 1] = buf[i * 4096];
+     b10:	8b 45 cc             	mov    -0x34(%rbp),%eax
+     b13:	c1 e0 0c             	shl    $0xc,%eax
+     b16:	89 c1                	mov    %eax,%ecx
+     b18:	8b 45 cc             	mov    -0x34(%rbp),%eax
+     b1b:	c1 e0 0c             	shl    $0xc,%eax
+     b1e:	8d 70 ff             	lea    -0x1(%rax),%esi
+     b21:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+     b25:	48 63 c1             	movslq %ecx,%rax
+     b28:	0f b6 0c 02          	movzbl (%rdx,%rax,1),%ecx
+     b2c:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+     b30:	48 63 c6             	movslq %esi,%rax
+     b33:	88 0c 02             	mov    %cl,(%rdx,%rax,1)
+  for (i = 0; i < 8; i++) {
+     b36:	83 45 cc 01          	addl   $0x1,-0x34(%rbp)
+     b3a:	83 7d cc 07          	cmpl   $0x7,-0x34(%rbp)
+     b3e:	7e c0                	jle    b00 <growstacktest+0xe0>
+  }
+  sysinfo(&info2);
+     b40:	48 8d 85 70 ff ff ff 	lea    -0x90(%rbp),%rax
+     b47:	48 89 c7             	mov    %rax,%rdi
+     b4a:	e8 96 0e 00 00       	call   19e5 <sysinfo>
+
+  printf(stdout, "pages_in_use after stack allocation = %d\n",
+     b4f:	8b 95 70 ff ff ff    	mov    -0x90(%rbp),%edx
+     b55:	8b 05 05 1c 00 00    	mov    0x1c05(%rip),%eax        # 2760 <stdout>
+     b5b:	48 8d 0d ce 15 00 00 	lea    0x15ce(%rip),%rcx        # 2130 <malloc+0x5a4>
+     b62:	48 89 ce             	mov    %rcx,%rsi
+     b65:	89 c7                	mov    %eax,%edi
+     b67:	b8 00 00 00 00       	mov    $0x0,%eax
+     b6c:	e8 2d 08 00 00       	call   139e <printf>
+         info2.pages_in_use);
+  printf(stdout, "pages_in_swap after stack allocation = %d\n",
+     b71:	8b 95 74 ff ff ff    	mov    -0x8c(%rbp),%edx
+     b77:	8b 05 e3 1b 00 00    	mov    0x1be3(%rip),%eax        # 2760 <stdout>
+     b7d:	48 8d 0d dc 15 00 00 	lea    0x15dc(%rip),%rcx        # 2160 <malloc+0x5d4>
+     b84:	48 89 ce             	mov    %rcx,%rsi
+     b87:	89 c7                	mov    %eax,%edi
+     b89:	b8 00 00 00 00       	mov    $0x0,%eax
+     b8e:	e8 0b 08 00 00       	call   139e <printf>
+         info2.pages_in_swap);
+
+  // if grow ustack on-demand is implemented, then the 8 pages are allocated at
+  // run-time
+  if (info2.pages_in_use - info1.pages_in_use + info1.pages_in_swap -
+     b93:	8b 95 70 ff ff ff    	mov    -0x90(%rbp),%edx
+     b99:	8b 45 94             	mov    -0x6c(%rbp),%eax
+     b9c:	29 c2                	sub    %eax,%edx
+     b9e:	8b 45 98             	mov    -0x68(%rbp),%eax
+     ba1:	01 c2                	add    %eax,%edx
+          info2.pages_in_swap !=
+     ba3:	8b 85 74 ff ff ff    	mov    -0x8c(%rbp),%eax
+  if (info2.pages_in_use - info1.pages_in_use + info1.pages_in_swap -
+     ba9:	29 c2                	sub    %eax,%edx
+     bab:	83 fa 08             	cmp    $0x8,%edx
+     bae:	74 5c                	je     c0c <growstacktest+0x1ec>
+      8)
+    error("user stack is not growing");
+     bb0:	8b 05 aa 1b 00 00    	mov    0x1baa(%rip),%eax        # 2760 <stdout>
+     bb6:	ba 12 01 00 00       	mov    $0x112,%edx
+     bbb:	48 8d 0d 04 11 00 00 	lea    0x1104(%rip),%rcx        # 1cc6 <malloc+0x13a>
+     bc2:	48 89 ce             	mov    %rcx,%rsi
+     bc5:	89 c7                	mov    %eax,%edi
+     bc7:	b8 00 00 00 00       	mov    $0x0,%eax
+     bcc:	e8 cd 07 00 00       	call   139e <printf>
+     bd1:	8b 05 89 1b 00 00    	mov    0x1b89(%rip),%eax        # 2760 <stdout>
+     bd7:	48 8d 15 ad 15 00 00 	lea    0x15ad(%rip),%rdx        # 218b <malloc+0x5ff>
+     bde:	48 89 d6             	mov    %rdx,%rsi
+     be1:	89 c7                	mov    %eax,%edi
+     be3:	b8 00 00 00 00       	mov    $0x0,%eax
+     be8:	e8 b1 07 00 00       	call   139e <printf>
+     bed:	8b 05 6d 1b 00 00    	mov    0x1b6d(%rip),%eax        # 2760 <stdout>
+     bf3:	48 8d 15 f8 10 00 00 	lea    0x10f8(%rip),%rdx        # 1cf2 <malloc+0x166>
+     bfa:	48 89 d6             	mov    %rdx,%rsi
+     bfd:	89 c7                	mov    %eax,%edi
+     bff:	b8 00 00 00 00       	mov    $0x0,%eax
+     c04:	e8 95 07 00 00       	call   139e <printf>
+     c09:	90                   	nop
+     c0a:	eb fd                	jmp    c09 <growstacktest+0x1e9>
+
+  printf(stdout, "growstacktest passed\n");
+     c0c:	8b 05 4e 1b 00 00    	mov    0x1b4e(%rip),%eax        # 2760 <stdout>
+     c12:	48 8d 15 8c 15 00 00 	lea    0x158c(%rip),%rdx        # 21a5 <malloc+0x619>
+     c19:	48 89 d6             	mov    %rdx,%rsi
+     c1c:	89 c7                	mov    %eax,%edi
+     c1e:	b8 00 00 00 00       	mov    $0x0,%eax
+     c23:	e8 76 07 00 00       	call   139e <printf>
+     c28:	48 89 dc             	mov    %rbx,%rsp
+}
+     c2b:	90                   	nop
+     c2c:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+     c30:	5b                   	pop    %rbx
+     c31:	41 5c                	pop    %r12
+     c33:	41 5d                	pop    %r13
+     c35:	41 5e                	pop    %r14
+     c37:	41 5f                	pop    %r15
+     c39:	5d                   	pop    %rbp
+     c3a:	c3                   	ret
+
+0000000000000c3b <growstacktest_edgecase>:
+
+void growstacktest_edgecase() {
+     c3b:	55                   	push   %rbp
+     c3c:	48 89 e5             	mov    %rsp,%rbp
+     c3f:	48 83 ec 20          	sub    $0x20,%rsp
+  printf(stdout, "growstacktest_edgecase\n");
+     c43:	8b 05 17 1b 00 00    	mov    0x1b17(%rip),%eax        # 2760 <stdout>
+     c49:	48 8d 15 6b 15 00 00 	lea    0x156b(%rip),%rdx        # 21bb <malloc+0x62f>
+     c50:	48 89 d6             	mov    %rdx,%rsi
+     c53:	89 c7                	mov    %eax,%edi
+     c55:	b8 00 00 00 00       	mov    $0x0,%eax
+     c5a:	e8 3f 07 00 00       	call   139e <printf>
+  printf(stdout, "next 2 processes should be killed with trap 14 err 6\n");
+     c5f:	8b 05 fb 1a 00 00    	mov    0x1afb(%rip),%eax        # 2760 <stdout>
+     c65:	48 8d 15 6c 15 00 00 	lea    0x156c(%rip),%rdx        # 21d8 <malloc+0x64c>
+     c6c:	48 89 d6             	mov    %rdx,%rsi
+     c6f:	89 c7                	mov    %eax,%edi
+     c71:	b8 00 00 00 00       	mov    $0x0,%eax
+     c76:	e8 23 07 00 00       	call   139e <printf>
+
+  int pid = fork();
+     c7b:	e8 bd 0c 00 00       	call   193d <fork>
+     c80:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  if (pid == 0) {
+     c83:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     c87:	75 6b                	jne    cf4 <growstacktest_edgecase+0xb9>
+    char *buf = (char *) STACKBASE - 11 * 4096;
+     c89:	48 c7 45 e8 00 50 ff 	movq   $0x7fff5000,-0x18(%rbp)
+     c90:	7f 
+    // can we get 11 pages on the stack?
+    *buf = 0;
+     c91:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     c95:	c6 00 00             	movb   $0x0,(%rax)
+    error("we can get 11 pages on stack");
+     c98:	8b 05 c2 1a 00 00    	mov    0x1ac2(%rip),%eax        # 2760 <stdout>
+     c9e:	ba 20 01 00 00       	mov    $0x120,%edx
+     ca3:	48 8d 0d 1c 10 00 00 	lea    0x101c(%rip),%rcx        # 1cc6 <malloc+0x13a>
+     caa:	48 89 ce             	mov    %rcx,%rsi
+     cad:	89 c7                	mov    %eax,%edi
+     caf:	b8 00 00 00 00       	mov    $0x0,%eax
+     cb4:	e8 e5 06 00 00       	call   139e <printf>
+     cb9:	8b 05 a1 1a 00 00    	mov    0x1aa1(%rip),%eax        # 2760 <stdout>
+     cbf:	48 8d 15 48 15 00 00 	lea    0x1548(%rip),%rdx        # 220e <malloc+0x682>
+     cc6:	48 89 d6             	mov    %rdx,%rsi
+     cc9:	89 c7                	mov    %eax,%edi
+     ccb:	b8 00 00 00 00       	mov    $0x0,%eax
+     cd0:	e8 c9 06 00 00       	call   139e <printf>
+     cd5:	8b 05 85 1a 00 00    	mov    0x1a85(%rip),%eax        # 2760 <stdout>
+     cdb:	48 8d 15 10 10 00 00 	lea    0x1010(%rip),%rdx        # 1cf2 <malloc+0x166>
+     ce2:	48 89 d6             	mov    %rdx,%rsi
+     ce5:	89 c7                	mov    %eax,%edi
+     ce7:	b8 00 00 00 00       	mov    $0x0,%eax
+     cec:	e8 ad 06 00 00       	call   139e <printf>
+     cf1:	90                   	nop
+     cf2:	eb fd                	jmp    cf1 <growstacktest_edgecase+0xb6>
+  } else if (pid < 0) {
+     cf4:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     cf8:	79 5c                	jns    d56 <growstacktest_edgecase+0x11b>
+    error("fork() failed!\n");
+     cfa:	8b 05 60 1a 00 00    	mov    0x1a60(%rip),%eax        # 2760 <stdout>
+     d00:	ba 22 01 00 00       	mov    $0x122,%edx
+     d05:	48 8d 0d ba 0f 00 00 	lea    0xfba(%rip),%rcx        # 1cc6 <malloc+0x13a>
+     d0c:	48 89 ce             	mov    %rcx,%rsi
+     d0f:	89 c7                	mov    %eax,%edi
+     d11:	b8 00 00 00 00       	mov    $0x0,%eax
+     d16:	e8 83 06 00 00       	call   139e <printf>
+     d1b:	8b 05 3f 1a 00 00    	mov    0x1a3f(%rip),%eax        # 2760 <stdout>
+     d21:	48 8d 15 03 15 00 00 	lea    0x1503(%rip),%rdx        # 222b <malloc+0x69f>
+     d28:	48 89 d6             	mov    %rdx,%rsi
+     d2b:	89 c7                	mov    %eax,%edi
+     d2d:	b8 00 00 00 00       	mov    $0x0,%eax
+     d32:	e8 67 06 00 00       	call   139e <printf>
+     d37:	8b 05 23 1a 00 00    	mov    0x1a23(%rip),%eax        # 2760 <stdout>
+     d3d:	48 8d 15 ae 0f 00 00 	lea    0xfae(%rip),%rdx        # 1cf2 <malloc+0x166>
+     d44:	48 89 d6             	mov    %rdx,%rsi
+     d47:	89 c7                	mov    %eax,%edi
+     d49:	b8 00 00 00 00       	mov    $0x0,%eax
+     d4e:	e8 4b 06 00 00       	call   139e <printf>
+     d53:	90                   	nop
+     d54:	eb fd                	jmp    d53 <growstacktest_edgecase+0x118>
+  } else {
+    wait();
+     d56:	e8 f2 0b 00 00       	call   194d <wait>
+  }
+
+  pid = fork();
+     d5b:	e8 dd 0b 00 00       	call   193d <fork>
+     d60:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  if (pid == 0) {
+     d63:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     d67:	75 6c                	jne    dd5 <growstacktest_edgecase+0x19a>
+    char *buf = (char *) STACKBASE;
+     d69:	b8 00 00 00 80       	mov    $0x80000000,%eax
+     d6e:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    // can the stack grow upwards?
+    *buf = 0;
+     d72:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     d76:	c6 00 00             	movb   $0x0,(%rax)
+    error("stack can grow upwards!");
+     d79:	8b 05 e1 19 00 00    	mov    0x19e1(%rip),%eax        # 2760 <stdout>
+     d7f:	ba 2c 01 00 00       	mov    $0x12c,%edx
+     d84:	48 8d 0d 3b 0f 00 00 	lea    0xf3b(%rip),%rcx        # 1cc6 <malloc+0x13a>
+     d8b:	48 89 ce             	mov    %rcx,%rsi
+     d8e:	89 c7                	mov    %eax,%edi
+     d90:	b8 00 00 00 00       	mov    $0x0,%eax
+     d95:	e8 04 06 00 00       	call   139e <printf>
+     d9a:	8b 05 c0 19 00 00    	mov    0x19c0(%rip),%eax        # 2760 <stdout>
+     da0:	48 8d 15 94 14 00 00 	lea    0x1494(%rip),%rdx        # 223b <malloc+0x6af>
+     da7:	48 89 d6             	mov    %rdx,%rsi
+     daa:	89 c7                	mov    %eax,%edi
+     dac:	b8 00 00 00 00       	mov    $0x0,%eax
+     db1:	e8 e8 05 00 00       	call   139e <printf>
+     db6:	8b 05 a4 19 00 00    	mov    0x19a4(%rip),%eax        # 2760 <stdout>
+     dbc:	48 8d 15 2f 0f 00 00 	lea    0xf2f(%rip),%rdx        # 1cf2 <malloc+0x166>
+     dc3:	48 89 d6             	mov    %rdx,%rsi
+     dc6:	89 c7                	mov    %eax,%edi
+     dc8:	b8 00 00 00 00       	mov    $0x0,%eax
+     dcd:	e8 cc 05 00 00       	call   139e <printf>
+     dd2:	90                   	nop
+     dd3:	eb fd                	jmp    dd2 <growstacktest_edgecase+0x197>
+  } else if (pid < 0) {
+     dd5:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     dd9:	79 5c                	jns    e37 <growstacktest_edgecase+0x1fc>
+    error("fork() failed!\n");
+     ddb:	8b 05 7f 19 00 00    	mov    0x197f(%rip),%eax        # 2760 <stdout>
+     de1:	ba 2e 01 00 00       	mov    $0x12e,%edx
+     de6:	48 8d 0d d9 0e 00 00 	lea    0xed9(%rip),%rcx        # 1cc6 <malloc+0x13a>
+     ded:	48 89 ce             	mov    %rcx,%rsi
+     df0:	89 c7                	mov    %eax,%edi
+     df2:	b8 00 00 00 00       	mov    $0x0,%eax
+     df7:	e8 a2 05 00 00       	call   139e <printf>
+     dfc:	8b 05 5e 19 00 00    	mov    0x195e(%rip),%eax        # 2760 <stdout>
+     e02:	48 8d 15 22 14 00 00 	lea    0x1422(%rip),%rdx        # 222b <malloc+0x69f>
+     e09:	48 89 d6             	mov    %rdx,%rsi
+     e0c:	89 c7                	mov    %eax,%edi
+     e0e:	b8 00 00 00 00       	mov    $0x0,%eax
+     e13:	e8 86 05 00 00       	call   139e <printf>
+     e18:	8b 05 42 19 00 00    	mov    0x1942(%rip),%eax        # 2760 <stdout>
+     e1e:	48 8d 15 cd 0e 00 00 	lea    0xecd(%rip),%rdx        # 1cf2 <malloc+0x166>
+     e25:	48 89 d6             	mov    %rdx,%rsi
+     e28:	89 c7                	mov    %eax,%edi
+     e2a:	b8 00 00 00 00       	mov    $0x0,%eax
+     e2f:	e8 6a 05 00 00       	call   139e <printf>
+     e34:	90                   	nop
+     e35:	eb fd                	jmp    e34 <growstacktest_edgecase+0x1f9>
+  } else {
+    wait();
+     e37:	e8 11 0b 00 00       	call   194d <wait>
+  }
+
+  printf(stdout, "growstacktest_edgecase passed\n");
+     e3c:	8b 05 1e 19 00 00    	mov    0x191e(%rip),%eax        # 2760 <stdout>
+     e42:	48 8d 15 0f 14 00 00 	lea    0x140f(%rip),%rdx        # 2258 <malloc+0x6cc>
+     e49:	48 89 d6             	mov    %rdx,%rsi
+     e4c:	89 c7                	mov    %eax,%edi
+     e4e:	b8 00 00 00 00       	mov    $0x0,%eax
+     e53:	e8 46 05 00 00       	call   139e <printf>
+}
+     e58:	90                   	nop
+     e59:	c9                   	leave
+     e5a:	c3                   	ret
+
+0000000000000e5b <copyonwriteforktest>:
+
+void copyonwriteforktest() {
+     e5b:	55                   	push   %rbp
+     e5c:	48 89 e5             	mov    %rsp,%rbp
+     e5f:	48 81 ec b0 00 00 00 	sub    $0xb0,%rsp
+  struct sys_info info1, info2, info3, info4;
+  int page200 = 200 * 4096;
+     e66:	c7 45 f4 00 80 0c 00 	movl   $0xc8000,-0xc(%rbp)
+  char *a = sbrk(page200);
+     e6d:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     e70:	89 c7                	mov    %eax,%edi
+     e72:	e8 56 0b 00 00       	call   19cd <sbrk>
+     e77:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  char b;
+  int j;
+
+  a[0] = 0;
+     e7b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     e7f:	c6 00 00             	movb   $0x0,(%rax)
+  printf(stdout, "copyonwriteforktest\n");
+     e82:	8b 05 d8 18 00 00    	mov    0x18d8(%rip),%eax        # 2760 <stdout>
+     e88:	48 8d 15 e8 13 00 00 	lea    0x13e8(%rip),%rdx        # 2277 <malloc+0x6eb>
+     e8f:	48 89 d6             	mov    %rdx,%rsi
+     e92:	89 c7                	mov    %eax,%edi
+     e94:	b8 00 00 00 00       	mov    $0x0,%eax
+     e99:	e8 00 05 00 00       	call   139e <printf>
+  sysinfo(&info1);
+     e9e:	48 8d 45 c0          	lea    -0x40(%rbp),%rax
+     ea2:	48 89 c7             	mov    %rax,%rdi
+     ea5:	e8 3b 0b 00 00       	call   19e5 <sysinfo>
+  printf(stdout, "pages_in_use before copy-on-write fork = %d\n",
+     eaa:	8b 55 c0             	mov    -0x40(%rbp),%edx
+     ead:	8b 05 ad 18 00 00    	mov    0x18ad(%rip),%eax        # 2760 <stdout>
+     eb3:	48 8d 0d d6 13 00 00 	lea    0x13d6(%rip),%rcx        # 2290 <malloc+0x704>
+     eba:	48 89 ce             	mov    %rcx,%rsi
+     ebd:	89 c7                	mov    %eax,%edi
+     ebf:	b8 00 00 00 00       	mov    $0x0,%eax
+     ec4:	e8 d5 04 00 00       	call   139e <printf>
+         info1.pages_in_use);
+  printf(stdout, "pages_in_swap before copy-on-write fork = %d\n",
+     ec9:	8b 55 c4             	mov    -0x3c(%rbp),%edx
+     ecc:	8b 05 8e 18 00 00    	mov    0x188e(%rip),%eax        # 2760 <stdout>
+     ed2:	48 8d 0d e7 13 00 00 	lea    0x13e7(%rip),%rcx        # 22c0 <malloc+0x734>
+     ed9:	48 89 ce             	mov    %rcx,%rsi
+     edc:	89 c7                	mov    %eax,%edi
+     ede:	b8 00 00 00 00       	mov    $0x0,%eax
+     ee3:	e8 b6 04 00 00       	call   139e <printf>
+         info1.pages_in_swap);
+  int pid = fork();
+     ee8:	e8 50 0a 00 00       	call   193d <fork>
+     eed:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  if (pid == 0) {
+     ef0:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+     ef4:	75 0f                	jne    f05 <copyonwriteforktest+0xaa>
+    sleep(100);
+     ef6:	bf 64 00 00 00       	mov    $0x64,%edi
+     efb:	e8 d5 0a 00 00       	call   19d5 <sleep>
+    exit();
+     f00:	e8 40 0a 00 00       	call   1945 <exit>
+  } else {
+    sysinfo(&info2);
+     f05:	48 8d 45 9c          	lea    -0x64(%rbp),%rax
+     f09:	48 89 c7             	mov    %rax,%rdi
+     f0c:	e8 d4 0a 00 00       	call   19e5 <sysinfo>
+    printf(stdout, "pages_in_use after copy-on-write fork = %d\n",
+     f11:	8b 55 9c             	mov    -0x64(%rbp),%edx
+     f14:	8b 05 46 18 00 00    	mov    0x1846(%rip),%eax        # 2760 <stdout>
+     f1a:	48 8d 0d cf 13 00 00 	lea    0x13cf(%rip),%rcx        # 22f0 <malloc+0x764>
+     f21:	48 89 ce             	mov    %rcx,%rsi
+     f24:	89 c7                	mov    %eax,%edi
+     f26:	b8 00 00 00 00       	mov    $0x0,%eax
+     f2b:	e8 6e 04 00 00       	call   139e <printf>
+           info2.pages_in_use);
+    printf(stdout, "pages_in_swap after copy-on-write fork = %d\n",
+     f30:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     f33:	8b 05 27 18 00 00    	mov    0x1827(%rip),%eax        # 2760 <stdout>
+     f39:	48 8d 0d e0 13 00 00 	lea    0x13e0(%rip),%rcx        # 2320 <malloc+0x794>
+     f40:	48 89 ce             	mov    %rcx,%rsi
+     f43:	89 c7                	mov    %eax,%edi
+     f45:	b8 00 00 00 00       	mov    $0x0,%eax
+     f4a:	e8 4f 04 00 00       	call   139e <printf>
+           info2.pages_in_swap);
+
+    // if copy-on-write is implemented, there is no way a new process can take
+    // more than 100 pages
+    if (info2.pages_in_use - info1.pages_in_use + info1.pages_in_swap -
+     f4f:	8b 55 9c             	mov    -0x64(%rbp),%edx
+     f52:	8b 45 c0             	mov    -0x40(%rbp),%eax
+     f55:	29 c2                	sub    %eax,%edx
+     f57:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+     f5a:	01 c2                	add    %eax,%edx
+            info2.pages_in_swap >
+     f5c:	8b 45 a0             	mov    -0x60(%rbp),%eax
+    if (info2.pages_in_use - info1.pages_in_use + info1.pages_in_swap -
+     f5f:	29 c2                	sub    %eax,%edx
+     f61:	83 fa 64             	cmp    $0x64,%edx
+     f64:	7e 5c                	jle    fc2 <copyonwriteforktest+0x167>
+        100)
+      error("too much memory is used for fork");
+     f66:	8b 05 f4 17 00 00    	mov    0x17f4(%rip),%eax        # 2760 <stdout>
+     f6c:	ba 54 01 00 00       	mov    $0x154,%edx
+     f71:	48 8d 0d 4e 0d 00 00 	lea    0xd4e(%rip),%rcx        # 1cc6 <malloc+0x13a>
+     f78:	48 89 ce             	mov    %rcx,%rsi
+     f7b:	89 c7                	mov    %eax,%edi
+     f7d:	b8 00 00 00 00       	mov    $0x0,%eax
+     f82:	e8 17 04 00 00       	call   139e <printf>
+     f87:	8b 05 d3 17 00 00    	mov    0x17d3(%rip),%eax        # 2760 <stdout>
+     f8d:	48 8d 15 bc 13 00 00 	lea    0x13bc(%rip),%rdx        # 2350 <malloc+0x7c4>
+     f94:	48 89 d6             	mov    %rdx,%rsi
+     f97:	89 c7                	mov    %eax,%edi
+     f99:	b8 00 00 00 00       	mov    $0x0,%eax
+     f9e:	e8 fb 03 00 00       	call   139e <printf>
+     fa3:	8b 05 b7 17 00 00    	mov    0x17b7(%rip),%eax        # 2760 <stdout>
+     fa9:	48 8d 15 42 0d 00 00 	lea    0xd42(%rip),%rdx        # 1cf2 <malloc+0x166>
+     fb0:	48 89 d6             	mov    %rdx,%rsi
+     fb3:	89 c7                	mov    %eax,%edi
+     fb5:	b8 00 00 00 00       	mov    $0x0,%eax
+     fba:	e8 df 03 00 00       	call   139e <printf>
+     fbf:	90                   	nop
+     fc0:	eb fd                	jmp    fbf <copyonwriteforktest+0x164>
+
+    for (j = 0; j < 200; j++) {
+     fc2:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+     fc9:	eb 1a                	jmp    fe5 <copyonwriteforktest+0x18a>
+      b = a[j * 4096];
+     fcb:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     fce:	c1 e0 0c             	shl    $0xc,%eax
+     fd1:	48 63 d0             	movslq %eax,%rdx
+     fd4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     fd8:	48 01 d0             	add    %rdx,%rax
+     fdb:	0f b6 00             	movzbl (%rax),%eax
+     fde:	88 45 ff             	mov    %al,-0x1(%rbp)
+    for (j = 0; j < 200; j++) {
+     fe1:	83 45 f8 01          	addl   $0x1,-0x8(%rbp)
+     fe5:	81 7d f8 c7 00 00 00 	cmpl   $0xc7,-0x8(%rbp)
+     fec:	7e dd                	jle    fcb <copyonwriteforktest+0x170>
+    }
+
+    sysinfo(&info3);
+     fee:	48 8d 85 78 ff ff ff 	lea    -0x88(%rbp),%rax
+     ff5:	48 89 c7             	mov    %rax,%rdi
+     ff8:	e8 e8 09 00 00       	call   19e5 <sysinfo>
+    printf(stdout, "pages_in_use after read = %d\n", info3.pages_in_use);
+     ffd:	8b 95 78 ff ff ff    	mov    -0x88(%rbp),%edx
+    1003:	8b 05 57 17 00 00    	mov    0x1757(%rip),%eax        # 2760 <stdout>
+    1009:	48 8d 0d 61 13 00 00 	lea    0x1361(%rip),%rcx        # 2371 <malloc+0x7e5>
+    1010:	48 89 ce             	mov    %rcx,%rsi
+    1013:	89 c7                	mov    %eax,%edi
+    1015:	b8 00 00 00 00       	mov    $0x0,%eax
+    101a:	e8 7f 03 00 00       	call   139e <printf>
+    printf(stdout, "pages_in_swap after read = %d\n", info3.pages_in_swap);
+    101f:	8b 95 7c ff ff ff    	mov    -0x84(%rbp),%edx
+    1025:	8b 05 35 17 00 00    	mov    0x1735(%rip),%eax        # 2760 <stdout>
+    102b:	48 8d 0d 5e 13 00 00 	lea    0x135e(%rip),%rcx        # 2390 <malloc+0x804>
+    1032:	48 89 ce             	mov    %rcx,%rsi
+    1035:	89 c7                	mov    %eax,%edi
+    1037:	b8 00 00 00 00       	mov    $0x0,%eax
+    103c:	e8 5d 03 00 00       	call   139e <printf>
+
+    // Read should not increase the amount of memory allocated
+    if (info3.pages_in_use - info2.pages_in_use + info3.pages_in_swap -
+    1041:	8b 95 78 ff ff ff    	mov    -0x88(%rbp),%edx
+    1047:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    104a:	29 c2                	sub    %eax,%edx
+    104c:	8b 85 7c ff ff ff    	mov    -0x84(%rbp),%eax
+    1052:	01 c2                	add    %eax,%edx
+            info2.pages_in_swap >
+    1054:	8b 45 a0             	mov    -0x60(%rbp),%eax
+    if (info3.pages_in_use - info2.pages_in_use + info3.pages_in_swap -
+    1057:	29 c2                	sub    %eax,%edx
+    1059:	83 fa 64             	cmp    $0x64,%edx
+    105c:	7e 5c                	jle    10ba <copyonwriteforktest+0x25f>
+        100)
+      error("too much memory is used for read");
+    105e:	8b 05 fc 16 00 00    	mov    0x16fc(%rip),%eax        # 2760 <stdout>
+    1064:	ba 62 01 00 00       	mov    $0x162,%edx
+    1069:	48 8d 0d 56 0c 00 00 	lea    0xc56(%rip),%rcx        # 1cc6 <malloc+0x13a>
+    1070:	48 89 ce             	mov    %rcx,%rsi
+    1073:	89 c7                	mov    %eax,%edi
+    1075:	b8 00 00 00 00       	mov    $0x0,%eax
+    107a:	e8 1f 03 00 00       	call   139e <printf>
+    107f:	8b 05 db 16 00 00    	mov    0x16db(%rip),%eax        # 2760 <stdout>
+    1085:	48 8d 15 24 13 00 00 	lea    0x1324(%rip),%rdx        # 23b0 <malloc+0x824>
+    108c:	48 89 d6             	mov    %rdx,%rsi
+    108f:	89 c7                	mov    %eax,%edi
+    1091:	b8 00 00 00 00       	mov    $0x0,%eax
+    1096:	e8 03 03 00 00       	call   139e <printf>
+    109b:	8b 05 bf 16 00 00    	mov    0x16bf(%rip),%eax        # 2760 <stdout>
+    10a1:	48 8d 15 4a 0c 00 00 	lea    0xc4a(%rip),%rdx        # 1cf2 <malloc+0x166>
+    10a8:	48 89 d6             	mov    %rdx,%rsi
+    10ab:	89 c7                	mov    %eax,%edi
+    10ad:	b8 00 00 00 00       	mov    $0x0,%eax
+    10b2:	e8 e7 02 00 00       	call   139e <printf>
+    10b7:	90                   	nop
+    10b8:	eb fd                	jmp    10b7 <copyonwriteforktest+0x25c>
+
+    for (j = 0; j < 200; j++) {
+    10ba:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+    10c1:	eb 1a                	jmp    10dd <copyonwriteforktest+0x282>
+      a[j * 4096] = b;
+    10c3:	8b 45 f8             	mov    -0x8(%rbp),%eax
+    10c6:	c1 e0 0c             	shl    $0xc,%eax
+    10c9:	48 63 d0             	movslq %eax,%rdx
+    10cc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    10d0:	48 01 c2             	add    %rax,%rdx
+    10d3:	0f b6 45 ff          	movzbl -0x1(%rbp),%eax
+    10d7:	88 02                	mov    %al,(%rdx)
+    for (j = 0; j < 200; j++) {
+    10d9:	83 45 f8 01          	addl   $0x1,-0x8(%rbp)
+    10dd:	81 7d f8 c7 00 00 00 	cmpl   $0xc7,-0x8(%rbp)
+    10e4:	7e dd                	jle    10c3 <copyonwriteforktest+0x268>
+    }
+
+    sysinfo(&info4);
+    10e6:	48 8d 85 54 ff ff ff 	lea    -0xac(%rbp),%rax
+    10ed:	48 89 c7             	mov    %rax,%rdi
+    10f0:	e8 f0 08 00 00       	call   19e5 <sysinfo>
+    printf(stdout, "pages_in_use after write = %d\n", info4.pages_in_use);
+    10f5:	8b 95 54 ff ff ff    	mov    -0xac(%rbp),%edx
+    10fb:	8b 05 5f 16 00 00    	mov    0x165f(%rip),%eax        # 2760 <stdout>
+    1101:	48 8d 0d d0 12 00 00 	lea    0x12d0(%rip),%rcx        # 23d8 <malloc+0x84c>
+    1108:	48 89 ce             	mov    %rcx,%rsi
+    110b:	89 c7                	mov    %eax,%edi
+    110d:	b8 00 00 00 00       	mov    $0x0,%eax
+    1112:	e8 87 02 00 00       	call   139e <printf>
+    printf(stdout, "pages_in_swap after write = %d\n", info4.pages_in_swap);
+    1117:	8b 95 58 ff ff ff    	mov    -0xa8(%rbp),%edx
+    111d:	8b 05 3d 16 00 00    	mov    0x163d(%rip),%eax        # 2760 <stdout>
+    1123:	48 8d 0d ce 12 00 00 	lea    0x12ce(%rip),%rcx        # 23f8 <malloc+0x86c>
+    112a:	48 89 ce             	mov    %rcx,%rsi
+    112d:	89 c7                	mov    %eax,%edi
+    112f:	b8 00 00 00 00       	mov    $0x0,%eax
+    1134:	e8 65 02 00 00       	call   139e <printf>
+
+    // Write should allocate the 200 pages of memory
+    if (info4.pages_in_use - info3.pages_in_use + info4.pages_in_swap -
+    1139:	8b 95 54 ff ff ff    	mov    -0xac(%rbp),%edx
+    113f:	8b 85 78 ff ff ff    	mov    -0x88(%rbp),%eax
+    1145:	29 c2                	sub    %eax,%edx
+    1147:	8b 85 58 ff ff ff    	mov    -0xa8(%rbp),%eax
+    114d:	01 c2                	add    %eax,%edx
+            info3.pages_in_swap <
+    114f:	8b 85 7c ff ff ff    	mov    -0x84(%rbp),%eax
+    if (info4.pages_in_use - info3.pages_in_use + info4.pages_in_swap -
+    1155:	29 c2                	sub    %eax,%edx
+    1157:	83 fa 63             	cmp    $0x63,%edx
+    115a:	7f 5c                	jg     11b8 <copyonwriteforktest+0x35d>
+        100)
+      error("too less memory is used for write");
+    115c:	8b 05 fe 15 00 00    	mov    0x15fe(%rip),%eax        # 2760 <stdout>
+    1162:	ba 70 01 00 00       	mov    $0x170,%edx
+    1167:	48 8d 0d 58 0b 00 00 	lea    0xb58(%rip),%rcx        # 1cc6 <malloc+0x13a>
+    116e:	48 89 ce             	mov    %rcx,%rsi
+    1171:	89 c7                	mov    %eax,%edi
+    1173:	b8 00 00 00 00       	mov    $0x0,%eax
+    1178:	e8 21 02 00 00       	call   139e <printf>
+    117d:	8b 05 dd 15 00 00    	mov    0x15dd(%rip),%eax        # 2760 <stdout>
+    1183:	48 8d 15 8e 12 00 00 	lea    0x128e(%rip),%rdx        # 2418 <malloc+0x88c>
+    118a:	48 89 d6             	mov    %rdx,%rsi
+    118d:	89 c7                	mov    %eax,%edi
+    118f:	b8 00 00 00 00       	mov    $0x0,%eax
+    1194:	e8 05 02 00 00       	call   139e <printf>
+    1199:	8b 05 c1 15 00 00    	mov    0x15c1(%rip),%eax        # 2760 <stdout>
+    119f:	48 8d 15 4c 0b 00 00 	lea    0xb4c(%rip),%rdx        # 1cf2 <malloc+0x166>
+    11a6:	48 89 d6             	mov    %rdx,%rsi
+    11a9:	89 c7                	mov    %eax,%edi
+    11ab:	b8 00 00 00 00       	mov    $0x0,%eax
+    11b0:	e8 e9 01 00 00       	call   139e <printf>
+    11b5:	90                   	nop
+    11b6:	eb fd                	jmp    11b5 <copyonwriteforktest+0x35a>
+
+    wait();
+    11b8:	e8 90 07 00 00       	call   194d <wait>
+  }
+
+  printf(stdout, "copyonwriteforktest passed\n");
+    11bd:	8b 05 9d 15 00 00    	mov    0x159d(%rip),%eax        # 2760 <stdout>
+    11c3:	48 8d 15 70 12 00 00 	lea    0x1270(%rip),%rdx        # 243a <malloc+0x8ae>
+    11ca:	48 89 d6             	mov    %rdx,%rsi
+    11cd:	89 c7                	mov    %eax,%edi
+    11cf:	b8 00 00 00 00       	mov    $0x0,%eax
+    11d4:	e8 c5 01 00 00       	call   139e <printf>
+}
+    11d9:	90                   	nop
+    11da:	c9                   	leave
+    11db:	c3                   	ret
+
+00000000000011dc <putc>:
+#include <cdefs.h>
+#include <stat.h>
+#include <stdarg.h>
+#include <user.h>
+
+static void putc(int fd, char c) { write(fd, &c, 1); }
+    11dc:	55                   	push   %rbp
+    11dd:	48 89 e5             	mov    %rsp,%rbp
+    11e0:	48 83 ec 10          	sub    $0x10,%rsp
+    11e4:	89 7d fc             	mov    %edi,-0x4(%rbp)
+    11e7:	89 f0                	mov    %esi,%eax
+    11e9:	88 45 f8             	mov    %al,-0x8(%rbp)
+    11ec:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+    11f0:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    11f3:	ba 01 00 00 00       	mov    $0x1,%edx
+    11f8:	48 89 ce             	mov    %rcx,%rsi
+    11fb:	89 c7                	mov    %eax,%edi
+    11fd:	e8 63 07 00 00       	call   1965 <write>
+    1202:	90                   	nop
+    1203:	c9                   	leave
+    1204:	c3                   	ret
+
+0000000000001205 <printint64>:
+
+static void printint64(int fd, int xx, int base, int sgn) {
+    1205:	55                   	push   %rbp
+    1206:	48 89 e5             	mov    %rsp,%rbp
+    1209:	48 83 ec 40          	sub    $0x40,%rsp
+    120d:	89 7d cc             	mov    %edi,-0x34(%rbp)
+    1210:	89 75 c8             	mov    %esi,-0x38(%rbp)
+    1213:	89 55 c4             	mov    %edx,-0x3c(%rbp)
+    1216:	89 4d c0             	mov    %ecx,-0x40(%rbp)
+  static char digits[] = "0123456789abcdef";
+  char buf[32];
+  int i;
+  uint64_t x;
+
+  if (sgn && (sgn = xx < 0))
+    1219:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+    121d:	74 1f                	je     123e <printint64+0x39>
+    121f:	8b 45 c8             	mov    -0x38(%rbp),%eax
+    1222:	c1 e8 1f             	shr    $0x1f,%eax
+    1225:	0f b6 c0             	movzbl %al,%eax
+    1228:	89 45 c0             	mov    %eax,-0x40(%rbp)
+    122b:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+    122f:	74 0d                	je     123e <printint64+0x39>
+    x = -xx;
+    1231:	8b 45 c8             	mov    -0x38(%rbp),%eax
+    1234:	f7 d8                	neg    %eax
+    1236:	48 98                	cltq
+    1238:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    123c:	eb 09                	jmp    1247 <printint64+0x42>
+  else
+    x = xx;
+    123e:	8b 45 c8             	mov    -0x38(%rbp),%eax
+    1241:	48 98                	cltq
+    1243:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+  i = 0;
+    1247:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  do {
+    buf[i++] = digits[x % base];
+    124e:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+    1251:	48 63 c8             	movslq %eax,%rcx
+    1254:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1258:	ba 00 00 00 00       	mov    $0x0,%edx
+    125d:	48 f7 f1             	div    %rcx
+    1260:	48 89 d1             	mov    %rdx,%rcx
+    1263:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1266:	8d 50 01             	lea    0x1(%rax),%edx
+    1269:	89 55 fc             	mov    %edx,-0x4(%rbp)
+    126c:	48 8d 15 fd 14 00 00 	lea    0x14fd(%rip),%rdx        # 2770 <digits.1>
+    1273:	0f b6 14 11          	movzbl (%rcx,%rdx,1),%edx
+    1277:	48 98                	cltq
+    1279:	88 54 05 d0          	mov    %dl,-0x30(%rbp,%rax,1)
+  } while ((x /= base) != 0);
+    127d:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+    1280:	48 63 f0             	movslq %eax,%rsi
+    1283:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1287:	ba 00 00 00 00       	mov    $0x0,%edx
+    128c:	48 f7 f6             	div    %rsi
+    128f:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    1293:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+    1298:	75 b4                	jne    124e <printint64+0x49>
+
+  if (sgn)
+    129a:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+    129e:	74 2b                	je     12cb <printint64+0xc6>
+    buf[i++] = '-';
+    12a0:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    12a3:	8d 50 01             	lea    0x1(%rax),%edx
+    12a6:	89 55 fc             	mov    %edx,-0x4(%rbp)
+    12a9:	48 98                	cltq
+    12ab:	c6 44 05 d0 2d       	movb   $0x2d,-0x30(%rbp,%rax,1)
+
+  while (--i >= 0)
+    12b0:	eb 19                	jmp    12cb <printint64+0xc6>
+    putc(fd, buf[i]);
+    12b2:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    12b5:	48 98                	cltq
+    12b7:	0f b6 44 05 d0       	movzbl -0x30(%rbp,%rax,1),%eax
+    12bc:	0f be d0             	movsbl %al,%edx
+    12bf:	8b 45 cc             	mov    -0x34(%rbp),%eax
+    12c2:	89 d6                	mov    %edx,%esi
+    12c4:	89 c7                	mov    %eax,%edi
+    12c6:	e8 11 ff ff ff       	call   11dc <putc>
+  while (--i >= 0)
+    12cb:	83 6d fc 01          	subl   $0x1,-0x4(%rbp)
+    12cf:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+    12d3:	79 dd                	jns    12b2 <printint64+0xad>
+}
+    12d5:	90                   	nop
+    12d6:	90                   	nop
+    12d7:	c9                   	leave
+    12d8:	c3                   	ret
+
+00000000000012d9 <printint>:
+
+static void printint(int fd, int xx, int base, int sgn) {
+    12d9:	55                   	push   %rbp
+    12da:	48 89 e5             	mov    %rsp,%rbp
+    12dd:	48 83 ec 30          	sub    $0x30,%rsp
+    12e1:	89 7d dc             	mov    %edi,-0x24(%rbp)
+    12e4:	89 75 d8             	mov    %esi,-0x28(%rbp)
+    12e7:	89 55 d4             	mov    %edx,-0x2c(%rbp)
+    12ea:	89 4d d0             	mov    %ecx,-0x30(%rbp)
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+    12ed:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+  if (sgn && xx < 0) {
+    12f4:	83 7d d0 00          	cmpl   $0x0,-0x30(%rbp)
+    12f8:	74 17                	je     1311 <printint+0x38>
+    12fa:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+    12fe:	79 11                	jns    1311 <printint+0x38>
+    neg = 1;
+    1300:	c7 45 f8 01 00 00 00 	movl   $0x1,-0x8(%rbp)
+    x = -xx;
+    1307:	8b 45 d8             	mov    -0x28(%rbp),%eax
+    130a:	f7 d8                	neg    %eax
+    130c:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    130f:	eb 06                	jmp    1317 <printint+0x3e>
+  } else {
+    x = xx;
+    1311:	8b 45 d8             	mov    -0x28(%rbp),%eax
+    1314:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  }
+
+  i = 0;
+    1317:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  do {
+    buf[i++] = digits[x % base];
+    131e:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+    1321:	8b 45 f4             	mov    -0xc(%rbp),%eax
+    1324:	ba 00 00 00 00       	mov    $0x0,%edx
+    1329:	f7 f1                	div    %ecx
+    132b:	89 d1                	mov    %edx,%ecx
+    132d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1330:	8d 50 01             	lea    0x1(%rax),%edx
+    1333:	89 55 fc             	mov    %edx,-0x4(%rbp)
+    1336:	89 c9                	mov    %ecx,%ecx
+    1338:	48 8d 15 51 14 00 00 	lea    0x1451(%rip),%rdx        # 2790 <digits.0>
+    133f:	0f b6 14 11          	movzbl (%rcx,%rdx,1),%edx
+    1343:	48 98                	cltq
+    1345:	88 54 05 e4          	mov    %dl,-0x1c(%rbp,%rax,1)
+  } while ((x /= base) != 0);
+    1349:	8b 75 d4             	mov    -0x2c(%rbp),%esi
+    134c:	8b 45 f4             	mov    -0xc(%rbp),%eax
+    134f:	ba 00 00 00 00       	mov    $0x0,%edx
+    1354:	f7 f6                	div    %esi
+    1356:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    1359:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+    135d:	75 bf                	jne    131e <printint+0x45>
+  if (neg)
+    135f:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+    1363:	74 2b                	je     1390 <printint+0xb7>
+    buf[i++] = '-';
+    1365:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1368:	8d 50 01             	lea    0x1(%rax),%edx
+    136b:	89 55 fc             	mov    %edx,-0x4(%rbp)
+    136e:	48 98                	cltq
+    1370:	c6 44 05 e4 2d       	movb   $0x2d,-0x1c(%rbp,%rax,1)
+
+  while (--i >= 0)
+    1375:	eb 19                	jmp    1390 <printint+0xb7>
+    putc(fd, buf[i]);
+    1377:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    137a:	48 98                	cltq
+    137c:	0f b6 44 05 e4       	movzbl -0x1c(%rbp,%rax,1),%eax
+    1381:	0f be d0             	movsbl %al,%edx
+    1384:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1387:	89 d6                	mov    %edx,%esi
+    1389:	89 c7                	mov    %eax,%edi
+    138b:	e8 4c fe ff ff       	call   11dc <putc>
+  while (--i >= 0)
+    1390:	83 6d fc 01          	subl   $0x1,-0x4(%rbp)
+    1394:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+    1398:	79 dd                	jns    1377 <printint+0x9e>
+}
+    139a:	90                   	nop
+    139b:	90                   	nop
+    139c:	c9                   	leave
+    139d:	c3                   	ret
+
+000000000000139e <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void printf(int fd, char *fmt, ...) {
+    139e:	55                   	push   %rbp
+    139f:	48 89 e5             	mov    %rsp,%rbp
+    13a2:	48 83 ec 70          	sub    $0x70,%rsp
+    13a6:	89 7d 9c             	mov    %edi,-0x64(%rbp)
+    13a9:	48 89 75 90          	mov    %rsi,-0x70(%rbp)
+    13ad:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+    13b1:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+    13b5:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+    13b9:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+  char *s;
+  int c, i, state;
+  int lflag;
+  va_list valist;
+  va_start(valist, fmt);
+    13bd:	c7 45 a0 10 00 00 00 	movl   $0x10,-0x60(%rbp)
+    13c4:	48 8d 45 10          	lea    0x10(%rbp),%rax
+    13c8:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+    13cc:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+    13d0:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+
+  state = 0;
+    13d4:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%rbp)
+  for (i = 0; fmt[i]; i++) {
+    13db:	c7 45 c4 00 00 00 00 	movl   $0x0,-0x3c(%rbp)
+    13e2:	e9 6b 02 00 00       	jmp    1652 <printf+0x2b4>
+    c = fmt[i] & 0xff;
+    13e7:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+    13ea:	48 63 d0             	movslq %eax,%rdx
+    13ed:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+    13f1:	48 01 d0             	add    %rdx,%rax
+    13f4:	0f b6 00             	movzbl (%rax),%eax
+    13f7:	0f be c0             	movsbl %al,%eax
+    13fa:	25 ff 00 00 00       	and    $0xff,%eax
+    13ff:	89 45 b8             	mov    %eax,-0x48(%rbp)
+    if (state == 0) {
+    1402:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+    1406:	75 30                	jne    1438 <printf+0x9a>
+      if (c == '%') {
+    1408:	83 7d b8 25          	cmpl   $0x25,-0x48(%rbp)
+    140c:	75 13                	jne    1421 <printf+0x83>
+        state = '%';
+    140e:	c7 45 c0 25 00 00 00 	movl   $0x25,-0x40(%rbp)
+        lflag = 0;
+    1415:	c7 45 bc 00 00 00 00 	movl   $0x0,-0x44(%rbp)
+    141c:	e9 2d 02 00 00       	jmp    164e <printf+0x2b0>
+      } else {
+        putc(fd, c);
+    1421:	8b 45 b8             	mov    -0x48(%rbp),%eax
+    1424:	0f be d0             	movsbl %al,%edx
+    1427:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    142a:	89 d6                	mov    %edx,%esi
+    142c:	89 c7                	mov    %eax,%edi
+    142e:	e8 a9 fd ff ff       	call   11dc <putc>
+    1433:	e9 16 02 00 00       	jmp    164e <printf+0x2b0>
+      }
+    } else if (state == '%') {
+    1438:	83 7d c0 25          	cmpl   $0x25,-0x40(%rbp)
+    143c:	0f 85 0c 02 00 00    	jne    164e <printf+0x2b0>
+      if (c == 'l') {
+    1442:	83 7d b8 6c          	cmpl   $0x6c,-0x48(%rbp)
+    1446:	75 0c                	jne    1454 <printf+0xb6>
+        lflag = 1;
+    1448:	c7 45 bc 01 00 00 00 	movl   $0x1,-0x44(%rbp)
+        continue;
+    144f:	e9 fa 01 00 00       	jmp    164e <printf+0x2b0>
+      } else if (c == 'd') {
+    1454:	83 7d b8 64          	cmpl   $0x64,-0x48(%rbp)
+    1458:	0f 85 95 00 00 00    	jne    14f3 <printf+0x155>
+        if (lflag == 1)
+    145e:	83 7d bc 01          	cmpl   $0x1,-0x44(%rbp)
+    1462:	75 49                	jne    14ad <printf+0x10f>
+          printint64(fd, va_arg(valist, int64_t), 10, 1);
+    1464:	8b 45 a0             	mov    -0x60(%rbp),%eax
+    1467:	83 f8 2f             	cmp    $0x2f,%eax
+    146a:	77 17                	ja     1483 <printf+0xe5>
+    146c:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    1470:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    1473:	89 d2                	mov    %edx,%edx
+    1475:	48 01 d0             	add    %rdx,%rax
+    1478:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    147b:	83 c2 08             	add    $0x8,%edx
+    147e:	89 55 a0             	mov    %edx,-0x60(%rbp)
+    1481:	eb 0c                	jmp    148f <printf+0xf1>
+    1483:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+    1487:	48 8d 50 08          	lea    0x8(%rax),%rdx
+    148b:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    148f:	48 8b 00             	mov    (%rax),%rax
+    1492:	89 c6                	mov    %eax,%esi
+    1494:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    1497:	b9 01 00 00 00       	mov    $0x1,%ecx
+    149c:	ba 0a 00 00 00       	mov    $0xa,%edx
+    14a1:	89 c7                	mov    %eax,%edi
+    14a3:	e8 5d fd ff ff       	call   1205 <printint64>
+    14a8:	e9 9a 01 00 00       	jmp    1647 <printf+0x2a9>
+        else
+          printint(fd, va_arg(valist, int), 10, 1);
+    14ad:	8b 45 a0             	mov    -0x60(%rbp),%eax
+    14b0:	83 f8 2f             	cmp    $0x2f,%eax
+    14b3:	77 17                	ja     14cc <printf+0x12e>
+    14b5:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    14b9:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    14bc:	89 d2                	mov    %edx,%edx
+    14be:	48 01 d0             	add    %rdx,%rax
+    14c1:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    14c4:	83 c2 08             	add    $0x8,%edx
+    14c7:	89 55 a0             	mov    %edx,-0x60(%rbp)
+    14ca:	eb 0c                	jmp    14d8 <printf+0x13a>
+    14cc:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+    14d0:	48 8d 50 08          	lea    0x8(%rax),%rdx
+    14d4:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    14d8:	8b 30                	mov    (%rax),%esi
+    14da:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    14dd:	b9 01 00 00 00       	mov    $0x1,%ecx
+    14e2:	ba 0a 00 00 00       	mov    $0xa,%edx
+    14e7:	89 c7                	mov    %eax,%edi
+    14e9:	e8 eb fd ff ff       	call   12d9 <printint>
+    14ee:	e9 54 01 00 00       	jmp    1647 <printf+0x2a9>
+      } else if (c == 'x' || c == 'p') {
+    14f3:	83 7d b8 78          	cmpl   $0x78,-0x48(%rbp)
+    14f7:	74 0a                	je     1503 <printf+0x165>
+    14f9:	83 7d b8 70          	cmpl   $0x70,-0x48(%rbp)
+    14fd:	0f 85 95 00 00 00    	jne    1598 <printf+0x1fa>
+        if (lflag == 1)
+    1503:	83 7d bc 01          	cmpl   $0x1,-0x44(%rbp)
+    1507:	75 49                	jne    1552 <printf+0x1b4>
+          printint64(fd, va_arg(valist, int64_t), 16, 0);
+    1509:	8b 45 a0             	mov    -0x60(%rbp),%eax
+    150c:	83 f8 2f             	cmp    $0x2f,%eax
+    150f:	77 17                	ja     1528 <printf+0x18a>
+    1511:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    1515:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    1518:	89 d2                	mov    %edx,%edx
+    151a:	48 01 d0             	add    %rdx,%rax
+    151d:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    1520:	83 c2 08             	add    $0x8,%edx
+    1523:	89 55 a0             	mov    %edx,-0x60(%rbp)
+    1526:	eb 0c                	jmp    1534 <printf+0x196>
+    1528:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+    152c:	48 8d 50 08          	lea    0x8(%rax),%rdx
+    1530:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    1534:	48 8b 00             	mov    (%rax),%rax
+    1537:	89 c6                	mov    %eax,%esi
+    1539:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    153c:	b9 00 00 00 00       	mov    $0x0,%ecx
+    1541:	ba 10 00 00 00       	mov    $0x10,%edx
+    1546:	89 c7                	mov    %eax,%edi
+    1548:	e8 b8 fc ff ff       	call   1205 <printint64>
+        if (lflag == 1)
+    154d:	e9 f5 00 00 00       	jmp    1647 <printf+0x2a9>
+        else
+          printint(fd, va_arg(valist, int), 16, 0);
+    1552:	8b 45 a0             	mov    -0x60(%rbp),%eax
+    1555:	83 f8 2f             	cmp    $0x2f,%eax
+    1558:	77 17                	ja     1571 <printf+0x1d3>
+    155a:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    155e:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    1561:	89 d2                	mov    %edx,%edx
+    1563:	48 01 d0             	add    %rdx,%rax
+    1566:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    1569:	83 c2 08             	add    $0x8,%edx
+    156c:	89 55 a0             	mov    %edx,-0x60(%rbp)
+    156f:	eb 0c                	jmp    157d <printf+0x1df>
+    1571:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+    1575:	48 8d 50 08          	lea    0x8(%rax),%rdx
+    1579:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    157d:	8b 30                	mov    (%rax),%esi
+    157f:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    1582:	b9 00 00 00 00       	mov    $0x0,%ecx
+    1587:	ba 10 00 00 00       	mov    $0x10,%edx
+    158c:	89 c7                	mov    %eax,%edi
+    158e:	e8 46 fd ff ff       	call   12d9 <printint>
+        if (lflag == 1)
+    1593:	e9 af 00 00 00       	jmp    1647 <printf+0x2a9>
+      } else if (c == 's') {
+    1598:	83 7d b8 73          	cmpl   $0x73,-0x48(%rbp)
+    159c:	75 6e                	jne    160c <printf+0x26e>
+        if ((s = (char *)va_arg(valist, char *)) == 0)
+    159e:	8b 45 a0             	mov    -0x60(%rbp),%eax
+    15a1:	83 f8 2f             	cmp    $0x2f,%eax
+    15a4:	77 17                	ja     15bd <printf+0x21f>
+    15a6:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    15aa:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    15ad:	89 d2                	mov    %edx,%edx
+    15af:	48 01 d0             	add    %rdx,%rax
+    15b2:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    15b5:	83 c2 08             	add    $0x8,%edx
+    15b8:	89 55 a0             	mov    %edx,-0x60(%rbp)
+    15bb:	eb 0c                	jmp    15c9 <printf+0x22b>
+    15bd:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+    15c1:	48 8d 50 08          	lea    0x8(%rax),%rdx
+    15c5:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    15c9:	48 8b 00             	mov    (%rax),%rax
+    15cc:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    15d0:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+    15d5:	75 28                	jne    15ff <printf+0x261>
+          s = "(null)";
+    15d7:	48 8d 05 78 0e 00 00 	lea    0xe78(%rip),%rax        # 2456 <malloc+0x8ca>
+    15de:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        for (; *s; s++)
+    15e2:	eb 1b                	jmp    15ff <printf+0x261>
+          putc(fd, *s);
+    15e4:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    15e8:	0f b6 00             	movzbl (%rax),%eax
+    15eb:	0f be d0             	movsbl %al,%edx
+    15ee:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    15f1:	89 d6                	mov    %edx,%esi
+    15f3:	89 c7                	mov    %eax,%edi
+    15f5:	e8 e2 fb ff ff       	call   11dc <putc>
+        for (; *s; s++)
+    15fa:	48 83 45 c8 01       	addq   $0x1,-0x38(%rbp)
+    15ff:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    1603:	0f b6 00             	movzbl (%rax),%eax
+    1606:	84 c0                	test   %al,%al
+    1608:	75 da                	jne    15e4 <printf+0x246>
+    160a:	eb 3b                	jmp    1647 <printf+0x2a9>
+      } else if (c == '%') {
+    160c:	83 7d b8 25          	cmpl   $0x25,-0x48(%rbp)
+    1610:	75 14                	jne    1626 <printf+0x288>
+        putc(fd, c);
+    1612:	8b 45 b8             	mov    -0x48(%rbp),%eax
+    1615:	0f be d0             	movsbl %al,%edx
+    1618:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    161b:	89 d6                	mov    %edx,%esi
+    161d:	89 c7                	mov    %eax,%edi
+    161f:	e8 b8 fb ff ff       	call   11dc <putc>
+    1624:	eb 21                	jmp    1647 <printf+0x2a9>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+    1626:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    1629:	be 25 00 00 00       	mov    $0x25,%esi
+    162e:	89 c7                	mov    %eax,%edi
+    1630:	e8 a7 fb ff ff       	call   11dc <putc>
+        putc(fd, c);
+    1635:	8b 45 b8             	mov    -0x48(%rbp),%eax
+    1638:	0f be d0             	movsbl %al,%edx
+    163b:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    163e:	89 d6                	mov    %edx,%esi
+    1640:	89 c7                	mov    %eax,%edi
+    1642:	e8 95 fb ff ff       	call   11dc <putc>
+      }
+      state = 0;
+    1647:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%rbp)
+  for (i = 0; fmt[i]; i++) {
+    164e:	83 45 c4 01          	addl   $0x1,-0x3c(%rbp)
+    1652:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+    1655:	48 63 d0             	movslq %eax,%rdx
+    1658:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+    165c:	48 01 d0             	add    %rdx,%rax
+    165f:	0f b6 00             	movzbl (%rax),%eax
+    1662:	84 c0                	test   %al,%al
+    1664:	0f 85 7d fd ff ff    	jne    13e7 <printf+0x49>
+    }
+  }
+
+  va_end(valist);
+}
+    166a:	90                   	nop
+    166b:	90                   	nop
+    166c:	c9                   	leave
+    166d:	c3                   	ret
+
+000000000000166e <stosb>:
+      break;
+    buf[i++] = c;
+    if (c == '\n' || c == '\r')
+      break;
+  }
+  buf[i] = '\0';
+    166e:	55                   	push   %rbp
+    166f:	48 89 e5             	mov    %rsp,%rbp
+    1672:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1676:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    1679:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  return buf;
+    167c:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+    1680:	8b 55 f0             	mov    -0x10(%rbp),%edx
+    1683:	8b 45 f4             	mov    -0xc(%rbp),%eax
+    1686:	48 89 ce             	mov    %rcx,%rsi
+    1689:	48 89 f7             	mov    %rsi,%rdi
+    168c:	89 d1                	mov    %edx,%ecx
+    168e:	fc                   	cld
+    168f:	f3 aa                	rep stos %al,%es:(%rdi)
+    1691:	89 ca                	mov    %ecx,%edx
+    1693:	48 89 fe             	mov    %rdi,%rsi
+    1696:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+    169a:	89 55 f0             	mov    %edx,-0x10(%rbp)
+}
+
+int stat(char *n, struct stat *st) {
+  int fd;
+    169d:	90                   	nop
+    169e:	5d                   	pop    %rbp
+    169f:	c3                   	ret
+
+00000000000016a0 <strcpy>:
+char *strcpy(char *s, char *t) {
+    16a0:	55                   	push   %rbp
+    16a1:	48 89 e5             	mov    %rsp,%rbp
+    16a4:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    16a8:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  os = s;
+    16ac:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    16b0:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while ((*s++ = *t++) != 0)
+    16b4:	90                   	nop
+    16b5:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    16b9:	48 8d 42 01          	lea    0x1(%rdx),%rax
+    16bd:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    16c1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    16c5:	48 8d 48 01          	lea    0x1(%rax),%rcx
+    16c9:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+    16cd:	0f b6 12             	movzbl (%rdx),%edx
+    16d0:	88 10                	mov    %dl,(%rax)
+    16d2:	0f b6 00             	movzbl (%rax),%eax
+    16d5:	84 c0                	test   %al,%al
+    16d7:	75 dc                	jne    16b5 <strcpy+0x15>
+  return os;
+    16d9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    16dd:	5d                   	pop    %rbp
+    16de:	c3                   	ret
+
+00000000000016df <strcmp>:
+int strcmp(const char *p, const char *q) {
+    16df:	55                   	push   %rbp
+    16e0:	48 89 e5             	mov    %rsp,%rbp
+    16e3:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    16e7:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  while (*p && *p == *q)
+    16eb:	eb 0a                	jmp    16f7 <strcmp+0x18>
+    p++, q++;
+    16ed:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    16f2:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (*p && *p == *q)
+    16f7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    16fb:	0f b6 00             	movzbl (%rax),%eax
+    16fe:	84 c0                	test   %al,%al
+    1700:	74 12                	je     1714 <strcmp+0x35>
+    1702:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1706:	0f b6 10             	movzbl (%rax),%edx
+    1709:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    170d:	0f b6 00             	movzbl (%rax),%eax
+    1710:	38 c2                	cmp    %al,%dl
+    1712:	74 d9                	je     16ed <strcmp+0xe>
+  return (uchar)*p - (uchar)*q;
+    1714:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1718:	0f b6 00             	movzbl (%rax),%eax
+    171b:	0f b6 d0             	movzbl %al,%edx
+    171e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1722:	0f b6 00             	movzbl (%rax),%eax
+    1725:	0f b6 c0             	movzbl %al,%eax
+    1728:	29 c2                	sub    %eax,%edx
+    172a:	89 d0                	mov    %edx,%eax
+}
+    172c:	5d                   	pop    %rbp
+    172d:	c3                   	ret
+
+000000000000172e <strlen>:
+uint strlen(char *s) {
+    172e:	55                   	push   %rbp
+    172f:	48 89 e5             	mov    %rsp,%rbp
+    1732:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  for (n = 0; s[n]; n++)
+    1736:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+    173d:	eb 04                	jmp    1743 <strlen+0x15>
+    173f:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+    1743:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1746:	48 63 d0             	movslq %eax,%rdx
+    1749:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    174d:	48 01 d0             	add    %rdx,%rax
+    1750:	0f b6 00             	movzbl (%rax),%eax
+    1753:	84 c0                	test   %al,%al
+    1755:	75 e8                	jne    173f <strlen+0x11>
+  return n;
+    1757:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+    175a:	5d                   	pop    %rbp
+    175b:	c3                   	ret
+
+000000000000175c <memset>:
+void *memset(void *dst, int c, uint n) {
+    175c:	55                   	push   %rbp
+    175d:	48 89 e5             	mov    %rsp,%rbp
+    1760:	48 83 ec 10          	sub    $0x10,%rsp
+    1764:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1768:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    176b:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  stosb(dst, c, n);
+    176e:	8b 55 f0             	mov    -0x10(%rbp),%edx
+    1771:	8b 4d f4             	mov    -0xc(%rbp),%ecx
+    1774:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1778:	89 ce                	mov    %ecx,%esi
+    177a:	48 89 c7             	mov    %rax,%rdi
+    177d:	e8 ec fe ff ff       	call   166e <stosb>
+  return dst;
+    1782:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    1786:	c9                   	leave
+    1787:	c3                   	ret
+
+0000000000001788 <strchr>:
+char *strchr(const char *s, char c) {
+    1788:	55                   	push   %rbp
+    1789:	48 89 e5             	mov    %rsp,%rbp
+    178c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1790:	89 f0                	mov    %esi,%eax
+    1792:	88 45 f4             	mov    %al,-0xc(%rbp)
+  for (; *s; s++)
+    1795:	eb 17                	jmp    17ae <strchr+0x26>
+    if (*s == c)
+    1797:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    179b:	0f b6 00             	movzbl (%rax),%eax
+    179e:	38 45 f4             	cmp    %al,-0xc(%rbp)
+    17a1:	75 06                	jne    17a9 <strchr+0x21>
+      return (char *)s;
+    17a3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    17a7:	eb 15                	jmp    17be <strchr+0x36>
+  for (; *s; s++)
+    17a9:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    17ae:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    17b2:	0f b6 00             	movzbl (%rax),%eax
+    17b5:	84 c0                	test   %al,%al
+    17b7:	75 de                	jne    1797 <strchr+0xf>
+  return 0;
+    17b9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    17be:	5d                   	pop    %rbp
+    17bf:	c3                   	ret
+
+00000000000017c0 <gets>:
+char *gets(char *buf, int max) {
+    17c0:	55                   	push   %rbp
+    17c1:	48 89 e5             	mov    %rsp,%rbp
+    17c4:	48 83 ec 20          	sub    $0x20,%rsp
+    17c8:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    17cc:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  for (i = 0; i + 1 < max;) {
+    17cf:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+    17d6:	eb 48                	jmp    1820 <gets+0x60>
+    cc = read(0, &c, 1);
+    17d8:	48 8d 45 f7          	lea    -0x9(%rbp),%rax
+    17dc:	ba 01 00 00 00       	mov    $0x1,%edx
+    17e1:	48 89 c6             	mov    %rax,%rsi
+    17e4:	bf 00 00 00 00       	mov    $0x0,%edi
+    17e9:	e8 6f 01 00 00       	call   195d <read>
+    17ee:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    if (cc < 1)
+    17f1:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+    17f5:	7e 36                	jle    182d <gets+0x6d>
+    buf[i++] = c;
+    17f7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    17fa:	8d 50 01             	lea    0x1(%rax),%edx
+    17fd:	89 55 fc             	mov    %edx,-0x4(%rbp)
+    1800:	48 63 d0             	movslq %eax,%rdx
+    1803:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1807:	48 01 c2             	add    %rax,%rdx
+    180a:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+    180e:	88 02                	mov    %al,(%rdx)
+    if (c == '\n' || c == '\r')
+    1810:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+    1814:	3c 0a                	cmp    $0xa,%al
+    1816:	74 16                	je     182e <gets+0x6e>
+    1818:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+    181c:	3c 0d                	cmp    $0xd,%al
+    181e:	74 0e                	je     182e <gets+0x6e>
+  for (i = 0; i + 1 < max;) {
+    1820:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1823:	83 c0 01             	add    $0x1,%eax
+    1826:	39 45 e4             	cmp    %eax,-0x1c(%rbp)
+    1829:	7f ad                	jg     17d8 <gets+0x18>
+    182b:	eb 01                	jmp    182e <gets+0x6e>
+      break;
+    182d:	90                   	nop
+  buf[i] = '\0';
+    182e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1831:	48 63 d0             	movslq %eax,%rdx
+    1834:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1838:	48 01 d0             	add    %rdx,%rax
+    183b:	c6 00 00             	movb   $0x0,(%rax)
+  return buf;
+    183e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+    1842:	c9                   	leave
+    1843:	c3                   	ret
+
+0000000000001844 <stat>:
+int stat(char *n, struct stat *st) {
+    1844:	55                   	push   %rbp
+    1845:	48 89 e5             	mov    %rsp,%rbp
+    1848:	48 83 ec 20          	sub    $0x20,%rsp
+    184c:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    1850:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int r;
+
+  fd = open(n, O_RDONLY);
+    1854:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1858:	be 00 00 00 00       	mov    $0x0,%esi
+    185d:	48 89 c7             	mov    %rax,%rdi
+    1860:	e8 20 01 00 00       	call   1985 <open>
+    1865:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  if (fd < 0)
+    1868:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+    186c:	79 07                	jns    1875 <stat+0x31>
+    return -1;
+    186e:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1873:	eb 21                	jmp    1896 <stat+0x52>
+  r = fstat(fd, st);
+    1875:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    1879:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    187c:	48 89 d6             	mov    %rdx,%rsi
+    187f:	89 c7                	mov    %eax,%edi
+    1881:	e8 17 01 00 00       	call   199d <fstat>
+    1886:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  close(fd);
+    1889:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    188c:	89 c7                	mov    %eax,%edi
+    188e:	e8 da 00 00 00       	call   196d <close>
+  return r;
+    1893:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+    1896:	c9                   	leave
+    1897:	c3                   	ret
+
+0000000000001898 <atoi>:
+
+int atoi(const char *s) {
+    1898:	55                   	push   %rbp
+    1899:	48 89 e5             	mov    %rsp,%rbp
+    189c:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int n;
+
+  n = 0;
+    18a0:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  while ('0' <= *s && *s <= '9')
+    18a7:	eb 28                	jmp    18d1 <atoi+0x39>
+    n = n * 10 + *s++ - '0';
+    18a9:	8b 55 fc             	mov    -0x4(%rbp),%edx
+    18ac:	89 d0                	mov    %edx,%eax
+    18ae:	c1 e0 02             	shl    $0x2,%eax
+    18b1:	01 d0                	add    %edx,%eax
+    18b3:	01 c0                	add    %eax,%eax
+    18b5:	89 c1                	mov    %eax,%ecx
+    18b7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    18bb:	48 8d 50 01          	lea    0x1(%rax),%rdx
+    18bf:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    18c3:	0f b6 00             	movzbl (%rax),%eax
+    18c6:	0f be c0             	movsbl %al,%eax
+    18c9:	01 c8                	add    %ecx,%eax
+    18cb:	83 e8 30             	sub    $0x30,%eax
+    18ce:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while ('0' <= *s && *s <= '9')
+    18d1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    18d5:	0f b6 00             	movzbl (%rax),%eax
+    18d8:	3c 2f                	cmp    $0x2f,%al
+    18da:	7e 0b                	jle    18e7 <atoi+0x4f>
+    18dc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    18e0:	0f b6 00             	movzbl (%rax),%eax
+    18e3:	3c 39                	cmp    $0x39,%al
+    18e5:	7e c2                	jle    18a9 <atoi+0x11>
+  return n;
+    18e7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+    18ea:	5d                   	pop    %rbp
+    18eb:	c3                   	ret
+
+00000000000018ec <memmove>:
+
+void *memmove(void *vdst, void *vsrc, int n) {
+    18ec:	55                   	push   %rbp
+    18ed:	48 89 e5             	mov    %rsp,%rbp
+    18f0:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    18f4:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    18f8:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  char *dst, *src;
+
+  dst = vdst;
+    18fb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    18ff:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  src = vsrc;
+    1903:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1907:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  while (n-- > 0)
+    190b:	eb 1d                	jmp    192a <memmove+0x3e>
+    *dst++ = *src++;
+    190d:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    1911:	48 8d 42 01          	lea    0x1(%rdx),%rax
+    1915:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    1919:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    191d:	48 8d 48 01          	lea    0x1(%rax),%rcx
+    1921:	48 89 4d f8          	mov    %rcx,-0x8(%rbp)
+    1925:	0f b6 12             	movzbl (%rdx),%edx
+    1928:	88 10                	mov    %dl,(%rax)
+  while (n-- > 0)
+    192a:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    192d:	8d 50 ff             	lea    -0x1(%rax),%edx
+    1930:	89 55 dc             	mov    %edx,-0x24(%rbp)
+    1933:	85 c0                	test   %eax,%eax
+    1935:	7f d6                	jg     190d <memmove+0x21>
+  return vdst;
+    1937:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    193b:	5d                   	pop    %rbp
+    193c:	c3                   	ret
+
+000000000000193d <fork>:
+  name:                                                                        \
+  movl $SYS_##name, % eax;                                                     \
+  int $TRAP_SYSCALL;                                                           \
+  ret
+
+SYSCALL(fork)
+    193d:	b8 01 00 00 00       	mov    $0x1,%eax
+    1942:	cd 40                	int    $0x40
+    1944:	c3                   	ret
+
+0000000000001945 <exit>:
+SYSCALL(exit)
+    1945:	b8 02 00 00 00       	mov    $0x2,%eax
+    194a:	cd 40                	int    $0x40
+    194c:	c3                   	ret
+
+000000000000194d <wait>:
+SYSCALL(wait)
+    194d:	b8 03 00 00 00       	mov    $0x3,%eax
+    1952:	cd 40                	int    $0x40
+    1954:	c3                   	ret
+
+0000000000001955 <pipe>:
+SYSCALL(pipe)
+    1955:	b8 04 00 00 00       	mov    $0x4,%eax
+    195a:	cd 40                	int    $0x40
+    195c:	c3                   	ret
+
+000000000000195d <read>:
+SYSCALL(read)
+    195d:	b8 05 00 00 00       	mov    $0x5,%eax
+    1962:	cd 40                	int    $0x40
+    1964:	c3                   	ret
+
+0000000000001965 <write>:
+SYSCALL(write)
+    1965:	b8 10 00 00 00       	mov    $0x10,%eax
+    196a:	cd 40                	int    $0x40
+    196c:	c3                   	ret
+
+000000000000196d <close>:
+SYSCALL(close)
+    196d:	b8 15 00 00 00       	mov    $0x15,%eax
+    1972:	cd 40                	int    $0x40
+    1974:	c3                   	ret
+
+0000000000001975 <kill>:
+SYSCALL(kill)
+    1975:	b8 06 00 00 00       	mov    $0x6,%eax
+    197a:	cd 40                	int    $0x40
+    197c:	c3                   	ret
+
+000000000000197d <exec>:
+SYSCALL(exec)
+    197d:	b8 07 00 00 00       	mov    $0x7,%eax
+    1982:	cd 40                	int    $0x40
+    1984:	c3                   	ret
+
+0000000000001985 <open>:
+SYSCALL(open)
+    1985:	b8 0f 00 00 00       	mov    $0xf,%eax
+    198a:	cd 40                	int    $0x40
+    198c:	c3                   	ret
+
+000000000000198d <mknod>:
+SYSCALL(mknod)
+    198d:	b8 11 00 00 00       	mov    $0x11,%eax
+    1992:	cd 40                	int    $0x40
+    1994:	c3                   	ret
+
+0000000000001995 <unlink>:
+SYSCALL(unlink)
+    1995:	b8 12 00 00 00       	mov    $0x12,%eax
+    199a:	cd 40                	int    $0x40
+    199c:	c3                   	ret
+
+000000000000199d <fstat>:
+SYSCALL(fstat)
+    199d:	b8 08 00 00 00       	mov    $0x8,%eax
+    19a2:	cd 40                	int    $0x40
+    19a4:	c3                   	ret
+
+00000000000019a5 <link>:
+SYSCALL(link)
+    19a5:	b8 13 00 00 00       	mov    $0x13,%eax
+    19aa:	cd 40                	int    $0x40
+    19ac:	c3                   	ret
+
+00000000000019ad <mkdir>:
+SYSCALL(mkdir)
+    19ad:	b8 14 00 00 00       	mov    $0x14,%eax
+    19b2:	cd 40                	int    $0x40
+    19b4:	c3                   	ret
+
+00000000000019b5 <chdir>:
+SYSCALL(chdir)
+    19b5:	b8 09 00 00 00       	mov    $0x9,%eax
+    19ba:	cd 40                	int    $0x40
+    19bc:	c3                   	ret
+
+00000000000019bd <dup>:
+SYSCALL(dup)
+    19bd:	b8 0a 00 00 00       	mov    $0xa,%eax
+    19c2:	cd 40                	int    $0x40
+    19c4:	c3                   	ret
+
+00000000000019c5 <getpid>:
+SYSCALL(getpid)
+    19c5:	b8 0b 00 00 00       	mov    $0xb,%eax
+    19ca:	cd 40                	int    $0x40
+    19cc:	c3                   	ret
+
+00000000000019cd <sbrk>:
+SYSCALL(sbrk)
+    19cd:	b8 0c 00 00 00       	mov    $0xc,%eax
+    19d2:	cd 40                	int    $0x40
+    19d4:	c3                   	ret
+
+00000000000019d5 <sleep>:
+SYSCALL(sleep)
+    19d5:	b8 0d 00 00 00       	mov    $0xd,%eax
+    19da:	cd 40                	int    $0x40
+    19dc:	c3                   	ret
+
+00000000000019dd <uptime>:
+SYSCALL(uptime)
+    19dd:	b8 0e 00 00 00       	mov    $0xe,%eax
+    19e2:	cd 40                	int    $0x40
+    19e4:	c3                   	ret
+
+00000000000019e5 <sysinfo>:
+SYSCALL(sysinfo)
+    19e5:	b8 16 00 00 00       	mov    $0x16,%eax
+    19ea:	cd 40                	int    $0x40
+    19ec:	c3                   	ret
+
+00000000000019ed <crashn>:
+SYSCALL(crashn)
+    19ed:	b8 17 00 00 00       	mov    $0x17,%eax
+    19f2:	cd 40                	int    $0x40
+    19f4:	c3                   	ret
+
+00000000000019f5 <sync>:
+SYSCALL(sync)
+    19f5:	b8 18 00 00 00       	mov    $0x18,%eax
+    19fa:	cd 40                	int    $0x40
+    19fc:	c3                   	ret
+
+00000000000019fd <fsync>:
+SYSCALL(fsync)
+    19fd:	b8 19 00 00 00       	mov    $0x19,%eax
+    1a02:	cd 40                	int    $0x40
+    1a04:	c3                   	ret
+
+0000000000001a05 <free>:
+typedef union header Header;
+
+static Header base;
+static Header *freep;
+
+void free(void *ap) {
+    1a05:	55                   	push   %rbp
+    1a06:	48 89 e5             	mov    %rsp,%rbp
+    1a09:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  Header *bp, *p;
+
+  bp = (Header *)ap - 1;
+    1a0d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1a11:	48 83 e8 10          	sub    $0x10,%rax
+    1a15:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  for (p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    1a19:	48 8b 05 a0 0d 00 00 	mov    0xda0(%rip),%rax        # 27c0 <freep>
+    1a20:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    1a24:	eb 2f                	jmp    1a55 <free+0x50>
+    if (p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    1a26:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1a2a:	48 8b 00             	mov    (%rax),%rax
+    1a2d:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+    1a31:	72 17                	jb     1a4a <free+0x45>
+    1a33:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1a37:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+    1a3b:	72 2f                	jb     1a6c <free+0x67>
+    1a3d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1a41:	48 8b 00             	mov    (%rax),%rax
+    1a44:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+    1a48:	72 22                	jb     1a6c <free+0x67>
+  for (p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    1a4a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1a4e:	48 8b 00             	mov    (%rax),%rax
+    1a51:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    1a55:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1a59:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+    1a5d:	73 c7                	jae    1a26 <free+0x21>
+    1a5f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1a63:	48 8b 00             	mov    (%rax),%rax
+    1a66:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+    1a6a:	73 ba                	jae    1a26 <free+0x21>
+      break;
+  if (bp + bp->s.size == p->s.ptr) {
+    1a6c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1a70:	8b 40 08             	mov    0x8(%rax),%eax
+    1a73:	89 c0                	mov    %eax,%eax
+    1a75:	48 c1 e0 04          	shl    $0x4,%rax
+    1a79:	48 89 c2             	mov    %rax,%rdx
+    1a7c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1a80:	48 01 c2             	add    %rax,%rdx
+    1a83:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1a87:	48 8b 00             	mov    (%rax),%rax
+    1a8a:	48 39 c2             	cmp    %rax,%rdx
+    1a8d:	75 2d                	jne    1abc <free+0xb7>
+    bp->s.size += p->s.ptr->s.size;
+    1a8f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1a93:	8b 50 08             	mov    0x8(%rax),%edx
+    1a96:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1a9a:	48 8b 00             	mov    (%rax),%rax
+    1a9d:	8b 40 08             	mov    0x8(%rax),%eax
+    1aa0:	01 c2                	add    %eax,%edx
+    1aa2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1aa6:	89 50 08             	mov    %edx,0x8(%rax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+    1aa9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1aad:	48 8b 00             	mov    (%rax),%rax
+    1ab0:	48 8b 10             	mov    (%rax),%rdx
+    1ab3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1ab7:	48 89 10             	mov    %rdx,(%rax)
+    1aba:	eb 0e                	jmp    1aca <free+0xc5>
+  } else
+    bp->s.ptr = p->s.ptr;
+    1abc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1ac0:	48 8b 10             	mov    (%rax),%rdx
+    1ac3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1ac7:	48 89 10             	mov    %rdx,(%rax)
+  if (p + p->s.size == bp) {
+    1aca:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1ace:	8b 40 08             	mov    0x8(%rax),%eax
+    1ad1:	89 c0                	mov    %eax,%eax
+    1ad3:	48 c1 e0 04          	shl    $0x4,%rax
+    1ad7:	48 89 c2             	mov    %rax,%rdx
+    1ada:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1ade:	48 01 d0             	add    %rdx,%rax
+    1ae1:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+    1ae5:	75 27                	jne    1b0e <free+0x109>
+    p->s.size += bp->s.size;
+    1ae7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1aeb:	8b 50 08             	mov    0x8(%rax),%edx
+    1aee:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1af2:	8b 40 08             	mov    0x8(%rax),%eax
+    1af5:	01 c2                	add    %eax,%edx
+    1af7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1afb:	89 50 08             	mov    %edx,0x8(%rax)
+    p->s.ptr = bp->s.ptr;
+    1afe:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1b02:	48 8b 10             	mov    (%rax),%rdx
+    1b05:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1b09:	48 89 10             	mov    %rdx,(%rax)
+    1b0c:	eb 0b                	jmp    1b19 <free+0x114>
+  } else
+    p->s.ptr = bp;
+    1b0e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1b12:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    1b16:	48 89 10             	mov    %rdx,(%rax)
+  freep = p;
+    1b19:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1b1d:	48 89 05 9c 0c 00 00 	mov    %rax,0xc9c(%rip)        # 27c0 <freep>
+}
+    1b24:	90                   	nop
+    1b25:	5d                   	pop    %rbp
+    1b26:	c3                   	ret
+
+0000000000001b27 <morecore>:
+
+static Header *morecore(uint nu) {
+    1b27:	55                   	push   %rbp
+    1b28:	48 89 e5             	mov    %rsp,%rbp
+    1b2b:	48 83 ec 20          	sub    $0x20,%rsp
+    1b2f:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  char *p;
+  Header *hp;
+
+  if (nu < 4096)
+    1b32:	81 7d ec ff 0f 00 00 	cmpl   $0xfff,-0x14(%rbp)
+    1b39:	77 07                	ja     1b42 <morecore+0x1b>
+    nu = 4096;
+    1b3b:	c7 45 ec 00 10 00 00 	movl   $0x1000,-0x14(%rbp)
+  p = sbrk(nu * sizeof(Header));
+    1b42:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    1b45:	c1 e0 04             	shl    $0x4,%eax
+    1b48:	89 c7                	mov    %eax,%edi
+    1b4a:	e8 7e fe ff ff       	call   19cd <sbrk>
+    1b4f:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (p == (char *)-1)
+    1b53:	48 83 7d f8 ff       	cmpq   $0xffffffffffffffff,-0x8(%rbp)
+    1b58:	75 07                	jne    1b61 <morecore+0x3a>
+    return 0;
+    1b5a:	b8 00 00 00 00       	mov    $0x0,%eax
+    1b5f:	eb 29                	jmp    1b8a <morecore+0x63>
+  hp = (Header *)p;
+    1b61:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1b65:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  hp->s.size = nu;
+    1b69:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1b6d:	8b 55 ec             	mov    -0x14(%rbp),%edx
+    1b70:	89 50 08             	mov    %edx,0x8(%rax)
+  free((void *)(hp + 1));
+    1b73:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1b77:	48 83 c0 10          	add    $0x10,%rax
+    1b7b:	48 89 c7             	mov    %rax,%rdi
+    1b7e:	e8 82 fe ff ff       	call   1a05 <free>
+  return freep;
+    1b83:	48 8b 05 36 0c 00 00 	mov    0xc36(%rip),%rax        # 27c0 <freep>
+}
+    1b8a:	c9                   	leave
+    1b8b:	c3                   	ret
+
+0000000000001b8c <malloc>:
+
+void *malloc(uint nbytes) {
+    1b8c:	55                   	push   %rbp
+    1b8d:	48 89 e5             	mov    %rsp,%rbp
+    1b90:	48 83 ec 30          	sub    $0x30,%rsp
+    1b94:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1) / sizeof(Header) + 1;
+    1b97:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1b9a:	48 83 c0 0f          	add    $0xf,%rax
+    1b9e:	48 c1 e8 04          	shr    $0x4,%rax
+    1ba2:	83 c0 01             	add    $0x1,%eax
+    1ba5:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  if ((prevp = freep) == 0) {
+    1ba8:	48 8b 05 11 0c 00 00 	mov    0xc11(%rip),%rax        # 27c0 <freep>
+    1baf:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    1bb3:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+    1bb8:	75 2e                	jne    1be8 <malloc+0x5c>
+    base.s.ptr = freep = prevp = &base;
+    1bba:	48 8d 05 ef 0b 00 00 	lea    0xbef(%rip),%rax        # 27b0 <base>
+    1bc1:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    1bc5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1bc9:	48 89 05 f0 0b 00 00 	mov    %rax,0xbf0(%rip)        # 27c0 <freep>
+    1bd0:	48 8b 05 e9 0b 00 00 	mov    0xbe9(%rip),%rax        # 27c0 <freep>
+    1bd7:	48 89 05 d2 0b 00 00 	mov    %rax,0xbd2(%rip)        # 27b0 <base>
+    base.s.size = 0;
+    1bde:	c7 05 d0 0b 00 00 00 	movl   $0x0,0xbd0(%rip)        # 27b8 <base+0x8>
+    1be5:	00 00 00 
+  }
+  for (p = prevp->s.ptr;; prevp = p, p = p->s.ptr) {
+    1be8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1bec:	48 8b 00             	mov    (%rax),%rax
+    1bef:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    if (p->s.size >= nunits) {
+    1bf3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1bf7:	8b 40 08             	mov    0x8(%rax),%eax
+    1bfa:	3b 45 ec             	cmp    -0x14(%rbp),%eax
+    1bfd:	72 5f                	jb     1c5e <malloc+0xd2>
+      if (p->s.size == nunits)
+    1bff:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1c03:	8b 40 08             	mov    0x8(%rax),%eax
+    1c06:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+    1c09:	75 10                	jne    1c1b <malloc+0x8f>
+        prevp->s.ptr = p->s.ptr;
+    1c0b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1c0f:	48 8b 10             	mov    (%rax),%rdx
+    1c12:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1c16:	48 89 10             	mov    %rdx,(%rax)
+    1c19:	eb 2e                	jmp    1c49 <malloc+0xbd>
+      else {
+        p->s.size -= nunits;
+    1c1b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1c1f:	8b 40 08             	mov    0x8(%rax),%eax
+    1c22:	2b 45 ec             	sub    -0x14(%rbp),%eax
+    1c25:	89 c2                	mov    %eax,%edx
+    1c27:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1c2b:	89 50 08             	mov    %edx,0x8(%rax)
+        p += p->s.size;
+    1c2e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1c32:	8b 40 08             	mov    0x8(%rax),%eax
+    1c35:	89 c0                	mov    %eax,%eax
+    1c37:	48 c1 e0 04          	shl    $0x4,%rax
+    1c3b:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+        p->s.size = nunits;
+    1c3f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1c43:	8b 55 ec             	mov    -0x14(%rbp),%edx
+    1c46:	89 50 08             	mov    %edx,0x8(%rax)
+      }
+      freep = prevp;
+    1c49:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1c4d:	48 89 05 6c 0b 00 00 	mov    %rax,0xb6c(%rip)        # 27c0 <freep>
+      return (void *)(p + 1);
+    1c54:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1c58:	48 83 c0 10          	add    $0x10,%rax
+    1c5c:	eb 41                	jmp    1c9f <malloc+0x113>
+    }
+    if (p == freep)
+    1c5e:	48 8b 05 5b 0b 00 00 	mov    0xb5b(%rip),%rax        # 27c0 <freep>
+    1c65:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+    1c69:	75 1c                	jne    1c87 <malloc+0xfb>
+      if ((p = morecore(nunits)) == 0)
+    1c6b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    1c6e:	89 c7                	mov    %eax,%edi
+    1c70:	e8 b2 fe ff ff       	call   1b27 <morecore>
+    1c75:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    1c79:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+    1c7e:	75 07                	jne    1c87 <malloc+0xfb>
+        return 0;
+    1c80:	b8 00 00 00 00       	mov    $0x0,%eax
+    1c85:	eb 18                	jmp    1c9f <malloc+0x113>
+  for (p = prevp->s.ptr;; prevp = p, p = p->s.ptr) {
+    1c87:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1c8b:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    1c8f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1c93:	48 8b 00             	mov    (%rax),%rax
+    1c96:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    if (p->s.size >= nunits) {
+    1c9a:	e9 54 ff ff ff       	jmp    1bf3 <malloc+0x67>
+  }
+    1c9f:	c9                   	leave
+    1ca0:	c3                   	ret
@@ -0,0 +1,4147 @@
+
+out/user/_lab4test_a:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000000000 <overwrite>:
+      while (1)                                                                \
+        ;                                                                      \
+    }                                                                          \
+  } while (0)
+
+void overwrite(void) {
+       0:	55                   	push   %rbp
+       1:	48 89 e5             	mov    %rsp,%rbp
+       4:	48 83 ec 10          	sub    $0x10,%rsp
+  int fd;
+
+  printf(stdout, "overwrite...\n");
+       8:	8b 05 32 42 00 00    	mov    0x4232(%rip),%eax        # 4240 <stdout>
+       e:	48 8d 15 3b 34 00 00 	lea    0x343b(%rip),%rdx        # 3450 <malloc+0x115>
+      15:	48 89 d6             	mov    %rdx,%rsi
+      18:	89 c7                	mov    %eax,%edi
+      1a:	b8 00 00 00 00       	mov    $0x0,%eax
+      1f:	e8 29 2b 00 00       	call   2b4d <printf>
+  strcpy(buf, "lab5 is the last 451 lab\n");
+      24:	48 8d 05 33 34 00 00 	lea    0x3433(%rip),%rax        # 345e <malloc+0x123>
+      2b:	48 89 c6             	mov    %rax,%rsi
+      2e:	48 8d 05 8b 42 00 00 	lea    0x428b(%rip),%rax        # 42c0 <buf>
+      35:	48 89 c7             	mov    %rax,%rdi
+      38:	e8 12 2e 00 00       	call   2e4f <strcpy>
+  fd = open("small.txt", O_RDWR);
+      3d:	be 02 00 00 00       	mov    $0x2,%esi
+      42:	48 8d 05 2f 34 00 00 	lea    0x342f(%rip),%rax        # 3478 <malloc+0x13d>
+      49:	48 89 c7             	mov    %rax,%rdi
+      4c:	e8 e3 30 00 00       	call   3134 <open>
+      51:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  if (fd < 0) {
+      54:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+      58:	79 5e                	jns    b8 <overwrite+0xb8>
+    error("Could not open small.txt with RW permissions");
+      5a:	8b 05 e0 41 00 00    	mov    0x41e0(%rip),%eax        # 4240 <stdout>
+      60:	ba 28 00 00 00       	mov    $0x28,%edx
+      65:	48 8d 0d 16 34 00 00 	lea    0x3416(%rip),%rcx        # 3482 <malloc+0x147>
+      6c:	48 89 ce             	mov    %rcx,%rsi
+      6f:	89 c7                	mov    %eax,%edi
+      71:	b8 00 00 00 00       	mov    $0x0,%eax
+      76:	e8 d2 2a 00 00       	call   2b4d <printf>
+      7b:	8b 05 bf 41 00 00    	mov    0x41bf(%rip),%eax        # 4240 <stdout>
+      81:	48 8d 15 10 34 00 00 	lea    0x3410(%rip),%rdx        # 3498 <malloc+0x15d>
+      88:	48 89 d6             	mov    %rdx,%rsi
+      8b:	89 c7                	mov    %eax,%edi
+      8d:	b8 00 00 00 00       	mov    $0x0,%eax
+      92:	e8 b6 2a 00 00       	call   2b4d <printf>
+      97:	8b 05 a3 41 00 00    	mov    0x41a3(%rip),%eax        # 4240 <stdout>
+      9d:	48 8d 15 21 34 00 00 	lea    0x3421(%rip),%rdx        # 34c5 <malloc+0x18a>
+      a4:	48 89 d6             	mov    %rdx,%rsi
+      a7:	89 c7                	mov    %eax,%edi
+      a9:	b8 00 00 00 00       	mov    $0x0,%eax
+      ae:	e8 9a 2a 00 00       	call   2b4d <printf>
+      b3:	e8 3c 30 00 00       	call   30f4 <exit>
+  }
+  printf(stdout, "the fd for small.txt = %d \n", fd);
+      b8:	8b 05 82 41 00 00    	mov    0x4182(%rip),%eax        # 4240 <stdout>
+      be:	8b 55 fc             	mov    -0x4(%rbp),%edx
+      c1:	48 8d 0d ff 33 00 00 	lea    0x33ff(%rip),%rcx        # 34c7 <malloc+0x18c>
+      c8:	48 89 ce             	mov    %rcx,%rsi
+      cb:	89 c7                	mov    %eax,%edi
+      cd:	b8 00 00 00 00       	mov    $0x0,%eax
+      d2:	e8 76 2a 00 00       	call   2b4d <printf>
+  // overwrite the original data.
+  int n = write(fd, buf, strlen(buf) + 1);
+      d7:	48 8d 05 e2 41 00 00 	lea    0x41e2(%rip),%rax        # 42c0 <buf>
+      de:	48 89 c7             	mov    %rax,%rdi
+      e1:	e8 f7 2d 00 00       	call   2edd <strlen>
+      e6:	83 c0 01             	add    $0x1,%eax
+      e9:	89 c2                	mov    %eax,%edx
+      eb:	8b 45 fc             	mov    -0x4(%rbp),%eax
+      ee:	48 8d 0d cb 41 00 00 	lea    0x41cb(%rip),%rcx        # 42c0 <buf>
+      f5:	48 89 ce             	mov    %rcx,%rsi
+      f8:	89 c7                	mov    %eax,%edi
+      fa:	e8 15 30 00 00       	call   3114 <write>
+      ff:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  if (n != strlen(buf) + 1) {
+     102:	48 8d 05 b7 41 00 00 	lea    0x41b7(%rip),%rax        # 42c0 <buf>
+     109:	48 89 c7             	mov    %rax,%rdi
+     10c:	e8 cc 2d 00 00       	call   2edd <strlen>
+     111:	8d 50 01             	lea    0x1(%rax),%edx
+     114:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     117:	39 c2                	cmp    %eax,%edx
+     119:	74 74                	je     18f <overwrite+0x18f>
+    error("Did not write entire buffer. Wanted: %d, Wrote: %d\n", strlen(buf) + 1, n);
+     11b:	8b 05 1f 41 00 00    	mov    0x411f(%rip),%eax        # 4240 <stdout>
+     121:	ba 2e 00 00 00       	mov    $0x2e,%edx
+     126:	48 8d 0d 55 33 00 00 	lea    0x3355(%rip),%rcx        # 3482 <malloc+0x147>
+     12d:	48 89 ce             	mov    %rcx,%rsi
+     130:	89 c7                	mov    %eax,%edi
+     132:	b8 00 00 00 00       	mov    $0x0,%eax
+     137:	e8 11 2a 00 00       	call   2b4d <printf>
+     13c:	48 8d 05 7d 41 00 00 	lea    0x417d(%rip),%rax        # 42c0 <buf>
+     143:	48 89 c7             	mov    %rax,%rdi
+     146:	e8 92 2d 00 00       	call   2edd <strlen>
+     14b:	8d 70 01             	lea    0x1(%rax),%esi
+     14e:	8b 05 ec 40 00 00    	mov    0x40ec(%rip),%eax        # 4240 <stdout>
+     154:	8b 55 f8             	mov    -0x8(%rbp),%edx
+     157:	89 d1                	mov    %edx,%ecx
+     159:	89 f2                	mov    %esi,%edx
+     15b:	48 8d 35 86 33 00 00 	lea    0x3386(%rip),%rsi        # 34e8 <malloc+0x1ad>
+     162:	89 c7                	mov    %eax,%edi
+     164:	b8 00 00 00 00       	mov    $0x0,%eax
+     169:	e8 df 29 00 00       	call   2b4d <printf>
+     16e:	8b 05 cc 40 00 00    	mov    0x40cc(%rip),%eax        # 4240 <stdout>
+     174:	48 8d 15 4a 33 00 00 	lea    0x334a(%rip),%rdx        # 34c5 <malloc+0x18a>
+     17b:	48 89 d6             	mov    %rdx,%rsi
+     17e:	89 c7                	mov    %eax,%edi
+     180:	b8 00 00 00 00       	mov    $0x0,%eax
+     185:	e8 c3 29 00 00       	call   2b4d <printf>
+     18a:	e8 65 2f 00 00       	call   30f4 <exit>
+  }
+  close(fd);
+     18f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     192:	89 c7                	mov    %eax,%edi
+     194:	e8 83 2f 00 00       	call   311c <close>
+
+  fd = open("small.txt", O_RDONLY);
+     199:	be 00 00 00 00       	mov    $0x0,%esi
+     19e:	48 8d 05 d3 32 00 00 	lea    0x32d3(%rip),%rax        # 3478 <malloc+0x13d>
+     1a5:	48 89 c7             	mov    %rax,%rdi
+     1a8:	e8 87 2f 00 00       	call   3134 <open>
+     1ad:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  read(fd, buf, 50);
+     1b0:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     1b3:	ba 32 00 00 00       	mov    $0x32,%edx
+     1b8:	48 8d 0d 01 41 00 00 	lea    0x4101(%rip),%rcx        # 42c0 <buf>
+     1bf:	48 89 ce             	mov    %rcx,%rsi
+     1c2:	89 c7                	mov    %eax,%edi
+     1c4:	e8 43 2f 00 00       	call   310c <read>
+
+  if (strcmp(buf, "lab5 is the last 451 lab\n") != 0)
+     1c9:	48 8d 05 8e 32 00 00 	lea    0x328e(%rip),%rax        # 345e <malloc+0x123>
+     1d0:	48 89 c6             	mov    %rax,%rsi
+     1d3:	48 8d 05 e6 40 00 00 	lea    0x40e6(%rip),%rax        # 42c0 <buf>
+     1da:	48 89 c7             	mov    %rax,%rdi
+     1dd:	e8 ac 2c 00 00       	call   2e8e <strcmp>
+     1e2:	85 c0                	test   %eax,%eax
+     1e4:	74 65                	je     24b <overwrite+0x24b>
+    error("file content was not 'lab5 is the last 451 lab', was: '%s'", buf);
+     1e6:	8b 05 54 40 00 00    	mov    0x4054(%rip),%eax        # 4240 <stdout>
+     1ec:	ba 36 00 00 00       	mov    $0x36,%edx
+     1f1:	48 8d 0d 8a 32 00 00 	lea    0x328a(%rip),%rcx        # 3482 <malloc+0x147>
+     1f8:	48 89 ce             	mov    %rcx,%rsi
+     1fb:	89 c7                	mov    %eax,%edi
+     1fd:	b8 00 00 00 00       	mov    $0x0,%eax
+     202:	e8 46 29 00 00       	call   2b4d <printf>
+     207:	8b 05 33 40 00 00    	mov    0x4033(%rip),%eax        # 4240 <stdout>
+     20d:	48 8d 15 ac 40 00 00 	lea    0x40ac(%rip),%rdx        # 42c0 <buf>
+     214:	48 8d 0d 05 33 00 00 	lea    0x3305(%rip),%rcx        # 3520 <malloc+0x1e5>
+     21b:	48 89 ce             	mov    %rcx,%rsi
+     21e:	89 c7                	mov    %eax,%edi
+     220:	b8 00 00 00 00       	mov    $0x0,%eax
+     225:	e8 23 29 00 00       	call   2b4d <printf>
+     22a:	8b 05 10 40 00 00    	mov    0x4010(%rip),%eax        # 4240 <stdout>
+     230:	48 8d 15 8e 32 00 00 	lea    0x328e(%rip),%rdx        # 34c5 <malloc+0x18a>
+     237:	48 89 d6             	mov    %rdx,%rsi
+     23a:	89 c7                	mov    %eax,%edi
+     23c:	b8 00 00 00 00       	mov    $0x0,%eax
+     241:	e8 07 29 00 00       	call   2b4d <printf>
+     246:	e8 a9 2e 00 00       	call   30f4 <exit>
+
+  close(fd);
+     24b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     24e:	89 c7                	mov    %eax,%edi
+     250:	e8 c7 2e 00 00       	call   311c <close>
+
+  printf(stdout, "overwrite ok\n");
+     255:	8b 05 e5 3f 00 00    	mov    0x3fe5(%rip),%eax        # 4240 <stdout>
+     25b:	48 8d 15 f9 32 00 00 	lea    0x32f9(%rip),%rdx        # 355b <malloc+0x220>
+     262:	48 89 d6             	mov    %rdx,%rsi
+     265:	89 c7                	mov    %eax,%edi
+     267:	b8 00 00 00 00       	mov    $0x0,%eax
+     26c:	e8 dc 28 00 00       	call   2b4d <printf>
+}
+     271:	90                   	nop
+     272:	c9                   	leave
+     273:	c3                   	ret
+
+0000000000000274 <append>:
+
+void append(void) {
+     274:	55                   	push   %rbp
+     275:	48 89 e5             	mov    %rsp,%rbp
+     278:	41 57                	push   %r15
+     27a:	41 56                	push   %r14
+     27c:	41 55                	push   %r13
+     27e:	41 54                	push   %r12
+     280:	53                   	push   %rbx
+     281:	48 83 ec 28          	sub    $0x28,%rsp
+     285:	48 89 e0             	mov    %rsp,%rax
+     288:	48 89 c3             	mov    %rax,%rbx
+  int fd;
+  int old_size;
+
+  printf(stdout, "append...\n");
+     28b:	8b 05 af 3f 00 00    	mov    0x3faf(%rip),%eax        # 4240 <stdout>
+     291:	48 8d 15 d1 32 00 00 	lea    0x32d1(%rip),%rdx        # 3569 <malloc+0x22e>
+     298:	48 89 d6             	mov    %rdx,%rsi
+     29b:	89 c7                	mov    %eax,%edi
+     29d:	b8 00 00 00 00       	mov    $0x0,%eax
+     2a2:	e8 a6 28 00 00       	call   2b4d <printf>
+
+  old_size = strlen(buf);
+     2a7:	48 8d 05 12 40 00 00 	lea    0x4012(%rip),%rax        # 42c0 <buf>
+     2ae:	48 89 c7             	mov    %rax,%rdi
+     2b1:	e8 27 2c 00 00       	call   2edd <strlen>
+     2b6:	89 45 cc             	mov    %eax,-0x34(%rbp)
+
+  printf(stdout, "old size = %d \n", old_size);
+     2b9:	8b 05 81 3f 00 00    	mov    0x3f81(%rip),%eax        # 4240 <stdout>
+     2bf:	8b 55 cc             	mov    -0x34(%rbp),%edx
+     2c2:	48 8d 0d ab 32 00 00 	lea    0x32ab(%rip),%rcx        # 3574 <malloc+0x239>
+     2c9:	48 89 ce             	mov    %rcx,%rsi
+     2cc:	89 c7                	mov    %eax,%edi
+     2ce:	b8 00 00 00 00       	mov    $0x0,%eax
+     2d3:	e8 75 28 00 00       	call   2b4d <printf>
+
+  fd = open("small.txt", O_RDWR);
+     2d8:	be 02 00 00 00       	mov    $0x2,%esi
+     2dd:	48 8d 05 94 31 00 00 	lea    0x3194(%rip),%rax        # 3478 <malloc+0x13d>
+     2e4:	48 89 c7             	mov    %rax,%rdi
+     2e7:	e8 48 2e 00 00       	call   3134 <open>
+     2ec:	89 45 c8             	mov    %eax,-0x38(%rbp)
+  if (fd < 0) {
+     2ef:	83 7d c8 00          	cmpl   $0x0,-0x38(%rbp)
+     2f3:	79 5e                	jns    353 <append+0xdf>
+    error("Could not open small.txt with RW permissions");
+     2f5:	8b 05 45 3f 00 00    	mov    0x3f45(%rip),%eax        # 4240 <stdout>
+     2fb:	ba 49 00 00 00       	mov    $0x49,%edx
+     300:	48 8d 0d 7b 31 00 00 	lea    0x317b(%rip),%rcx        # 3482 <malloc+0x147>
+     307:	48 89 ce             	mov    %rcx,%rsi
+     30a:	89 c7                	mov    %eax,%edi
+     30c:	b8 00 00 00 00       	mov    $0x0,%eax
+     311:	e8 37 28 00 00       	call   2b4d <printf>
+     316:	8b 05 24 3f 00 00    	mov    0x3f24(%rip),%eax        # 4240 <stdout>
+     31c:	48 8d 15 75 31 00 00 	lea    0x3175(%rip),%rdx        # 3498 <malloc+0x15d>
+     323:	48 89 d6             	mov    %rdx,%rsi
+     326:	89 c7                	mov    %eax,%edi
+     328:	b8 00 00 00 00       	mov    $0x0,%eax
+     32d:	e8 1b 28 00 00       	call   2b4d <printf>
+     332:	8b 05 08 3f 00 00    	mov    0x3f08(%rip),%eax        # 4240 <stdout>
+     338:	48 8d 15 86 31 00 00 	lea    0x3186(%rip),%rdx        # 34c5 <malloc+0x18a>
+     33f:	48 89 d6             	mov    %rdx,%rsi
+     342:	89 c7                	mov    %eax,%edi
+     344:	b8 00 00 00 00       	mov    $0x0,%eax
+     349:	e8 ff 27 00 00       	call   2b4d <printf>
+     34e:	e8 a1 2d 00 00       	call   30f4 <exit>
+  }
+
+  printf(stdout, "fd for append small.txt = %d \n", fd);
+     353:	8b 05 e7 3e 00 00    	mov    0x3ee7(%rip),%eax        # 4240 <stdout>
+     359:	8b 55 c8             	mov    -0x38(%rbp),%edx
+     35c:	48 8d 0d 25 32 00 00 	lea    0x3225(%rip),%rcx        # 3588 <malloc+0x24d>
+     363:	48 89 ce             	mov    %rcx,%rsi
+     366:	89 c7                	mov    %eax,%edi
+     368:	b8 00 00 00 00       	mov    $0x0,%eax
+     36d:	e8 db 27 00 00       	call   2b4d <printf>
+
+  // Advance the fd offset to 1 less than the size of file.
+  char garbo[old_size];
+     372:	8b 45 cc             	mov    -0x34(%rbp),%eax
+     375:	48 63 d0             	movslq %eax,%rdx
+     378:	48 83 ea 01          	sub    $0x1,%rdx
+     37c:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+     380:	48 63 d0             	movslq %eax,%rdx
+     383:	49 89 d6             	mov    %rdx,%r14
+     386:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+     38c:	48 63 d0             	movslq %eax,%rdx
+     38f:	49 89 d4             	mov    %rdx,%r12
+     392:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+     398:	48 98                	cltq
+     39a:	ba 10 00 00 00       	mov    $0x10,%edx
+     39f:	48 83 ea 01          	sub    $0x1,%rdx
+     3a3:	48 01 d0             	add    %rdx,%rax
+     3a6:	b9 10 00 00 00       	mov    $0x10,%ecx
+     3ab:	ba 00 00 00 00       	mov    $0x0,%edx
+     3b0:	48 f7 f1             	div    %rcx
+     3b3:	48 6b c0 10          	imul   $0x10,%rax,%rax
+     3b7:	48 29 c4             	sub    %rax,%rsp
+     3ba:	48 89 e0             	mov    %rsp,%rax
+     3bd:	48 83 c0 00          	add    $0x0,%rax
+     3c1:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  int n = read(fd, &garbo, old_size - 1);
+     3c5:	8b 45 cc             	mov    -0x34(%rbp),%eax
+     3c8:	8d 50 ff             	lea    -0x1(%rax),%edx
+     3cb:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+     3cf:	8b 45 c8             	mov    -0x38(%rbp),%eax
+     3d2:	48 89 ce             	mov    %rcx,%rsi
+     3d5:	89 c7                	mov    %eax,%edi
+     3d7:	e8 30 2d 00 00       	call   310c <read>
+     3dc:	89 45 b4             	mov    %eax,-0x4c(%rbp)
+  if (n != old_size - 1) {
+     3df:	8b 45 cc             	mov    -0x34(%rbp),%eax
+     3e2:	83 e8 01             	sub    $0x1,%eax
+     3e5:	39 45 b4             	cmp    %eax,-0x4c(%rbp)
+     3e8:	74 5e                	je     448 <append+0x1d4>
+    error("read failed");
+     3ea:	8b 05 50 3e 00 00    	mov    0x3e50(%rip),%eax        # 4240 <stdout>
+     3f0:	ba 52 00 00 00       	mov    $0x52,%edx
+     3f5:	48 8d 0d 86 30 00 00 	lea    0x3086(%rip),%rcx        # 3482 <malloc+0x147>
+     3fc:	48 89 ce             	mov    %rcx,%rsi
+     3ff:	89 c7                	mov    %eax,%edi
+     401:	b8 00 00 00 00       	mov    $0x0,%eax
+     406:	e8 42 27 00 00       	call   2b4d <printf>
+     40b:	8b 05 2f 3e 00 00    	mov    0x3e2f(%rip),%eax        # 4240 <stdout>
+     411:	48 8d 15 8f 31 00 00 	lea    0x318f(%rip),%rdx        # 35a7 <malloc+0x26c>
+     418:	48 89 d6             	mov    %rdx,%rsi
+     41b:	89 c7                	mov    %eax,%edi
+     41d:	b8 00 00 00 00       	mov    $0x0,%eax
+     422:	e8 26 27 00 00       	call   2b4d <printf>
+     427:	8b 05 13 3e 00 00    	mov    0x3e13(%rip),%eax        # 4240 <stdout>
+     42d:	48 8d 15 91 30 00 00 	lea    0x3091(%rip),%rdx        # 34c5 <malloc+0x18a>
+     434:	48 89 d6             	mov    %rdx,%rsi
+     437:	89 c7                	mov    %eax,%edi
+     439:	b8 00 00 00 00       	mov    $0x0,%eax
+     43e:	e8 0a 27 00 00       	call   2b4d <printf>
+     443:	e8 ac 2c 00 00       	call   30f4 <exit>
+  }
+  strcpy(buf, ", but this is just the beginning :(\n");
+     448:	48 8d 05 69 31 00 00 	lea    0x3169(%rip),%rax        # 35b8 <malloc+0x27d>
+     44f:	48 89 c6             	mov    %rax,%rsi
+     452:	48 8d 05 67 3e 00 00 	lea    0x3e67(%rip),%rax        # 42c0 <buf>
+     459:	48 89 c7             	mov    %rax,%rdi
+     45c:	e8 ee 29 00 00       	call   2e4f <strcpy>
+
+  // overwrite the last char, and append data.
+  n = write(fd, buf, strlen(buf) + 1);
+     461:	48 8d 05 58 3e 00 00 	lea    0x3e58(%rip),%rax        # 42c0 <buf>
+     468:	48 89 c7             	mov    %rax,%rdi
+     46b:	e8 6d 2a 00 00       	call   2edd <strlen>
+     470:	83 c0 01             	add    $0x1,%eax
+     473:	89 c2                	mov    %eax,%edx
+     475:	8b 45 c8             	mov    -0x38(%rbp),%eax
+     478:	48 8d 0d 41 3e 00 00 	lea    0x3e41(%rip),%rcx        # 42c0 <buf>
+     47f:	48 89 ce             	mov    %rcx,%rsi
+     482:	89 c7                	mov    %eax,%edi
+     484:	e8 8b 2c 00 00       	call   3114 <write>
+     489:	89 45 b4             	mov    %eax,-0x4c(%rbp)
+  if (n != strlen(buf) + 1) {
+     48c:	48 8d 05 2d 3e 00 00 	lea    0x3e2d(%rip),%rax        # 42c0 <buf>
+     493:	48 89 c7             	mov    %rax,%rdi
+     496:	e8 42 2a 00 00       	call   2edd <strlen>
+     49b:	8d 50 01             	lea    0x1(%rax),%edx
+     49e:	8b 45 b4             	mov    -0x4c(%rbp),%eax
+     4a1:	39 c2                	cmp    %eax,%edx
+     4a3:	74 74                	je     519 <append+0x2a5>
+    error("Did not write entire buffer. Wanted: %d, Wrote: %d\n", strlen(buf) + 1, n);
+     4a5:	8b 05 95 3d 00 00    	mov    0x3d95(%rip),%eax        # 4240 <stdout>
+     4ab:	ba 59 00 00 00       	mov    $0x59,%edx
+     4b0:	48 8d 0d cb 2f 00 00 	lea    0x2fcb(%rip),%rcx        # 3482 <malloc+0x147>
+     4b7:	48 89 ce             	mov    %rcx,%rsi
+     4ba:	89 c7                	mov    %eax,%edi
+     4bc:	b8 00 00 00 00       	mov    $0x0,%eax
+     4c1:	e8 87 26 00 00       	call   2b4d <printf>
+     4c6:	48 8d 05 f3 3d 00 00 	lea    0x3df3(%rip),%rax        # 42c0 <buf>
+     4cd:	48 89 c7             	mov    %rax,%rdi
+     4d0:	e8 08 2a 00 00       	call   2edd <strlen>
+     4d5:	8d 70 01             	lea    0x1(%rax),%esi
+     4d8:	8b 05 62 3d 00 00    	mov    0x3d62(%rip),%eax        # 4240 <stdout>
+     4de:	8b 55 b4             	mov    -0x4c(%rbp),%edx
+     4e1:	89 d1                	mov    %edx,%ecx
+     4e3:	89 f2                	mov    %esi,%edx
+     4e5:	48 8d 35 fc 2f 00 00 	lea    0x2ffc(%rip),%rsi        # 34e8 <malloc+0x1ad>
+     4ec:	89 c7                	mov    %eax,%edi
+     4ee:	b8 00 00 00 00       	mov    $0x0,%eax
+     4f3:	e8 55 26 00 00       	call   2b4d <printf>
+     4f8:	8b 05 42 3d 00 00    	mov    0x3d42(%rip),%eax        # 4240 <stdout>
+     4fe:	48 8d 15 c0 2f 00 00 	lea    0x2fc0(%rip),%rdx        # 34c5 <malloc+0x18a>
+     505:	48 89 d6             	mov    %rdx,%rsi
+     508:	89 c7                	mov    %eax,%edi
+     50a:	b8 00 00 00 00       	mov    $0x0,%eax
+     50f:	e8 39 26 00 00       	call   2b4d <printf>
+     514:	e8 db 2b 00 00       	call   30f4 <exit>
+  }
+  close(fd);
+     519:	8b 45 c8             	mov    -0x38(%rbp),%eax
+     51c:	89 c7                	mov    %eax,%edi
+     51e:	e8 f9 2b 00 00       	call   311c <close>
+
+  fd = open("small.txt", O_RDWR);
+     523:	be 02 00 00 00       	mov    $0x2,%esi
+     528:	48 8d 05 49 2f 00 00 	lea    0x2f49(%rip),%rax        # 3478 <malloc+0x13d>
+     52f:	48 89 c7             	mov    %rax,%rdi
+     532:	e8 fd 2b 00 00       	call   3134 <open>
+     537:	89 45 c8             	mov    %eax,-0x38(%rbp)
+  read(fd, buf, 62);
+     53a:	8b 45 c8             	mov    -0x38(%rbp),%eax
+     53d:	ba 3e 00 00 00       	mov    $0x3e,%edx
+     542:	48 8d 0d 77 3d 00 00 	lea    0x3d77(%rip),%rcx        # 42c0 <buf>
+     549:	48 89 ce             	mov    %rcx,%rsi
+     54c:	89 c7                	mov    %eax,%edi
+     54e:	e8 b9 2b 00 00       	call   310c <read>
+
+  // If the content hasn't changed, then the dinode size is not being
+  // updated for the file.
+  if (strcmp(buf, "lab5 is the last 451 lab, but this is just the beginning :(\n") != 0)
+     553:	48 8d 05 86 30 00 00 	lea    0x3086(%rip),%rax        # 35e0 <malloc+0x2a5>
+     55a:	48 89 c6             	mov    %rax,%rsi
+     55d:	48 8d 05 5c 3d 00 00 	lea    0x3d5c(%rip),%rax        # 42c0 <buf>
+     564:	48 89 c7             	mov    %rax,%rdi
+     567:	e8 22 29 00 00       	call   2e8e <strcmp>
+     56c:	85 c0                	test   %eax,%eax
+     56e:	74 65                	je     5d5 <append+0x361>
+    error("file content did not match expected, was: '%s'", buf);
+     570:	8b 05 ca 3c 00 00    	mov    0x3cca(%rip),%eax        # 4240 <stdout>
+     576:	ba 63 00 00 00       	mov    $0x63,%edx
+     57b:	48 8d 0d 00 2f 00 00 	lea    0x2f00(%rip),%rcx        # 3482 <malloc+0x147>
+     582:	48 89 ce             	mov    %rcx,%rsi
+     585:	89 c7                	mov    %eax,%edi
+     587:	b8 00 00 00 00       	mov    $0x0,%eax
+     58c:	e8 bc 25 00 00       	call   2b4d <printf>
+     591:	8b 05 a9 3c 00 00    	mov    0x3ca9(%rip),%eax        # 4240 <stdout>
+     597:	48 8d 15 22 3d 00 00 	lea    0x3d22(%rip),%rdx        # 42c0 <buf>
+     59e:	48 8d 0d 7b 30 00 00 	lea    0x307b(%rip),%rcx        # 3620 <malloc+0x2e5>
+     5a5:	48 89 ce             	mov    %rcx,%rsi
+     5a8:	89 c7                	mov    %eax,%edi
+     5aa:	b8 00 00 00 00       	mov    $0x0,%eax
+     5af:	e8 99 25 00 00       	call   2b4d <printf>
+     5b4:	8b 05 86 3c 00 00    	mov    0x3c86(%rip),%eax        # 4240 <stdout>
+     5ba:	48 8d 15 04 2f 00 00 	lea    0x2f04(%rip),%rdx        # 34c5 <malloc+0x18a>
+     5c1:	48 89 d6             	mov    %rdx,%rsi
+     5c4:	89 c7                	mov    %eax,%edi
+     5c6:	b8 00 00 00 00       	mov    $0x0,%eax
+     5cb:	e8 7d 25 00 00       	call   2b4d <printf>
+     5d0:	e8 1f 2b 00 00       	call   30f4 <exit>
+
+  close(fd);
+     5d5:	8b 45 c8             	mov    -0x38(%rbp),%eax
+     5d8:	89 c7                	mov    %eax,%edi
+     5da:	e8 3d 2b 00 00       	call   311c <close>
+
+  printf(stdout, "append ok\n");
+     5df:	8b 05 5b 3c 00 00    	mov    0x3c5b(%rip),%eax        # 4240 <stdout>
+     5e5:	48 8d 15 63 30 00 00 	lea    0x3063(%rip),%rdx        # 364f <malloc+0x314>
+     5ec:	48 89 d6             	mov    %rdx,%rsi
+     5ef:	89 c7                	mov    %eax,%edi
+     5f1:	b8 00 00 00 00       	mov    $0x0,%eax
+     5f6:	e8 52 25 00 00       	call   2b4d <printf>
+     5fb:	48 89 dc             	mov    %rbx,%rsp
+}
+     5fe:	90                   	nop
+     5ff:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+     603:	5b                   	pop    %rbx
+     604:	41 5c                	pop    %r12
+     606:	41 5d                	pop    %r13
+     608:	41 5e                	pop    %r14
+     60a:	41 5f                	pop    %r15
+     60c:	5d                   	pop    %rbp
+     60d:	c3                   	ret
+
+000000000000060e <filecreation>:
+
+
+// Creates a new file.
+// Writes 1 byte to it, reads 1 byte from it.
+void filecreation(void) {
+     60e:	55                   	push   %rbp
+     60f:	48 89 e5             	mov    %rsp,%rbp
+     612:	48 83 ec 10          	sub    $0x10,%rsp
+  int fd, n;
+  printf(1, "filecreation...\n");
+     616:	48 8d 05 3d 30 00 00 	lea    0x303d(%rip),%rax        # 365a <malloc+0x31f>
+     61d:	48 89 c6             	mov    %rax,%rsi
+     620:	bf 01 00 00 00       	mov    $0x1,%edi
+     625:	b8 00 00 00 00       	mov    $0x0,%eax
+     62a:	e8 1e 25 00 00       	call   2b4d <printf>
+
+  if ((fd = open("create.txt", O_CREATE|O_RDWR)) < 0)
+     62f:	be 02 02 00 00       	mov    $0x202,%esi
+     634:	48 8d 05 30 30 00 00 	lea    0x3030(%rip),%rax        # 366b <malloc+0x330>
+     63b:	48 89 c7             	mov    %rax,%rdi
+     63e:	e8 f1 2a 00 00       	call   3134 <open>
+     643:	89 45 fc             	mov    %eax,-0x4(%rbp)
+     646:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     64a:	79 5e                	jns    6aa <filecreation+0x9c>
+    error("create 'create.txt' failed");
+     64c:	8b 05 ee 3b 00 00    	mov    0x3bee(%rip),%eax        # 4240 <stdout>
+     652:	ba 72 00 00 00       	mov    $0x72,%edx
+     657:	48 8d 0d 24 2e 00 00 	lea    0x2e24(%rip),%rcx        # 3482 <malloc+0x147>
+     65e:	48 89 ce             	mov    %rcx,%rsi
+     661:	89 c7                	mov    %eax,%edi
+     663:	b8 00 00 00 00       	mov    $0x0,%eax
+     668:	e8 e0 24 00 00       	call   2b4d <printf>
+     66d:	8b 05 cd 3b 00 00    	mov    0x3bcd(%rip),%eax        # 4240 <stdout>
+     673:	48 8d 15 fc 2f 00 00 	lea    0x2ffc(%rip),%rdx        # 3676 <malloc+0x33b>
+     67a:	48 89 d6             	mov    %rdx,%rsi
+     67d:	89 c7                	mov    %eax,%edi
+     67f:	b8 00 00 00 00       	mov    $0x0,%eax
+     684:	e8 c4 24 00 00       	call   2b4d <printf>
+     689:	8b 05 b1 3b 00 00    	mov    0x3bb1(%rip),%eax        # 4240 <stdout>
+     68f:	48 8d 15 2f 2e 00 00 	lea    0x2e2f(%rip),%rdx        # 34c5 <malloc+0x18a>
+     696:	48 89 d6             	mov    %rdx,%rsi
+     699:	89 c7                	mov    %eax,%edi
+     69b:	b8 00 00 00 00       	mov    $0x0,%eax
+     6a0:	e8 a8 24 00 00       	call   2b4d <printf>
+     6a5:	e8 4a 2a 00 00       	call   30f4 <exit>
+
+  close(fd);
+     6aa:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     6ad:	89 c7                	mov    %eax,%edi
+     6af:	e8 68 2a 00 00       	call   311c <close>
+
+  // Reopen and write 1 byte.
+  if ((fd = open("create.txt", O_RDWR)) < 0)
+     6b4:	be 02 00 00 00       	mov    $0x2,%esi
+     6b9:	48 8d 05 ab 2f 00 00 	lea    0x2fab(%rip),%rax        # 366b <malloc+0x330>
+     6c0:	48 89 c7             	mov    %rax,%rdi
+     6c3:	e8 6c 2a 00 00       	call   3134 <open>
+     6c8:	89 45 fc             	mov    %eax,-0x4(%rbp)
+     6cb:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     6cf:	79 5e                	jns    72f <filecreation+0x121>
+    error("open 'create.txt' after creation failed");
+     6d1:	8b 05 69 3b 00 00    	mov    0x3b69(%rip),%eax        # 4240 <stdout>
+     6d7:	ba 78 00 00 00       	mov    $0x78,%edx
+     6dc:	48 8d 0d 9f 2d 00 00 	lea    0x2d9f(%rip),%rcx        # 3482 <malloc+0x147>
+     6e3:	48 89 ce             	mov    %rcx,%rsi
+     6e6:	89 c7                	mov    %eax,%edi
+     6e8:	b8 00 00 00 00       	mov    $0x0,%eax
+     6ed:	e8 5b 24 00 00       	call   2b4d <printf>
+     6f2:	8b 05 48 3b 00 00    	mov    0x3b48(%rip),%eax        # 4240 <stdout>
+     6f8:	48 8d 15 99 2f 00 00 	lea    0x2f99(%rip),%rdx        # 3698 <malloc+0x35d>
+     6ff:	48 89 d6             	mov    %rdx,%rsi
+     702:	89 c7                	mov    %eax,%edi
+     704:	b8 00 00 00 00       	mov    $0x0,%eax
+     709:	e8 3f 24 00 00       	call   2b4d <printf>
+     70e:	8b 05 2c 3b 00 00    	mov    0x3b2c(%rip),%eax        # 4240 <stdout>
+     714:	48 8d 15 aa 2d 00 00 	lea    0x2daa(%rip),%rdx        # 34c5 <malloc+0x18a>
+     71b:	48 89 d6             	mov    %rdx,%rsi
+     71e:	89 c7                	mov    %eax,%edi
+     720:	b8 00 00 00 00       	mov    $0x0,%eax
+     725:	e8 23 24 00 00       	call   2b4d <printf>
+     72a:	e8 c5 29 00 00       	call   30f4 <exit>
+  memset(buf, 1, 1);
+     72f:	ba 01 00 00 00       	mov    $0x1,%edx
+     734:	be 01 00 00 00       	mov    $0x1,%esi
+     739:	48 8d 05 80 3b 00 00 	lea    0x3b80(%rip),%rax        # 42c0 <buf>
+     740:	48 89 c7             	mov    %rax,%rdi
+     743:	e8 c3 27 00 00       	call   2f0b <memset>
+  n = write(fd, buf, 1);
+     748:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     74b:	ba 01 00 00 00       	mov    $0x1,%edx
+     750:	48 8d 0d 69 3b 00 00 	lea    0x3b69(%rip),%rcx        # 42c0 <buf>
+     757:	48 89 ce             	mov    %rcx,%rsi
+     75a:	89 c7                	mov    %eax,%edi
+     75c:	e8 b3 29 00 00       	call   3114 <write>
+     761:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  if (n != 1) {
+     764:	83 7d f8 01          	cmpl   $0x1,-0x8(%rbp)
+     768:	74 5e                	je     7c8 <filecreation+0x1ba>
+    error("error writing to created file.\n");
+     76a:	8b 05 d0 3a 00 00    	mov    0x3ad0(%rip),%eax        # 4240 <stdout>
+     770:	ba 7c 00 00 00       	mov    $0x7c,%edx
+     775:	48 8d 0d 06 2d 00 00 	lea    0x2d06(%rip),%rcx        # 3482 <malloc+0x147>
+     77c:	48 89 ce             	mov    %rcx,%rsi
+     77f:	89 c7                	mov    %eax,%edi
+     781:	b8 00 00 00 00       	mov    $0x0,%eax
+     786:	e8 c2 23 00 00       	call   2b4d <printf>
+     78b:	8b 05 af 3a 00 00    	mov    0x3aaf(%rip),%eax        # 4240 <stdout>
+     791:	48 8d 15 28 2f 00 00 	lea    0x2f28(%rip),%rdx        # 36c0 <malloc+0x385>
+     798:	48 89 d6             	mov    %rdx,%rsi
+     79b:	89 c7                	mov    %eax,%edi
+     79d:	b8 00 00 00 00       	mov    $0x0,%eax
+     7a2:	e8 a6 23 00 00       	call   2b4d <printf>
+     7a7:	8b 05 93 3a 00 00    	mov    0x3a93(%rip),%eax        # 4240 <stdout>
+     7ad:	48 8d 15 11 2d 00 00 	lea    0x2d11(%rip),%rdx        # 34c5 <malloc+0x18a>
+     7b4:	48 89 d6             	mov    %rdx,%rsi
+     7b7:	89 c7                	mov    %eax,%edi
+     7b9:	b8 00 00 00 00       	mov    $0x0,%eax
+     7be:	e8 8a 23 00 00       	call   2b4d <printf>
+     7c3:	e8 2c 29 00 00       	call   30f4 <exit>
+  }
+  close(fd);
+     7c8:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     7cb:	89 c7                	mov    %eax,%edi
+     7cd:	e8 4a 29 00 00       	call   311c <close>
+
+
+  // Reopen and read 1 byte.
+  if ((fd = open("create.txt", O_RDWR)) < 0)
+     7d2:	be 02 00 00 00       	mov    $0x2,%esi
+     7d7:	48 8d 05 8d 2e 00 00 	lea    0x2e8d(%rip),%rax        # 366b <malloc+0x330>
+     7de:	48 89 c7             	mov    %rax,%rdi
+     7e1:	e8 4e 29 00 00       	call   3134 <open>
+     7e6:	89 45 fc             	mov    %eax,-0x4(%rbp)
+     7e9:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     7ed:	79 5e                	jns    84d <filecreation+0x23f>
+    error("open 'create.txt' after creation failed");
+     7ef:	8b 05 4b 3a 00 00    	mov    0x3a4b(%rip),%eax        # 4240 <stdout>
+     7f5:	ba 83 00 00 00       	mov    $0x83,%edx
+     7fa:	48 8d 0d 81 2c 00 00 	lea    0x2c81(%rip),%rcx        # 3482 <malloc+0x147>
+     801:	48 89 ce             	mov    %rcx,%rsi
+     804:	89 c7                	mov    %eax,%edi
+     806:	b8 00 00 00 00       	mov    $0x0,%eax
+     80b:	e8 3d 23 00 00       	call   2b4d <printf>
+     810:	8b 05 2a 3a 00 00    	mov    0x3a2a(%rip),%eax        # 4240 <stdout>
+     816:	48 8d 15 7b 2e 00 00 	lea    0x2e7b(%rip),%rdx        # 3698 <malloc+0x35d>
+     81d:	48 89 d6             	mov    %rdx,%rsi
+     820:	89 c7                	mov    %eax,%edi
+     822:	b8 00 00 00 00       	mov    $0x0,%eax
+     827:	e8 21 23 00 00       	call   2b4d <printf>
+     82c:	8b 05 0e 3a 00 00    	mov    0x3a0e(%rip),%eax        # 4240 <stdout>
+     832:	48 8d 15 8c 2c 00 00 	lea    0x2c8c(%rip),%rdx        # 34c5 <malloc+0x18a>
+     839:	48 89 d6             	mov    %rdx,%rsi
+     83c:	89 c7                	mov    %eax,%edi
+     83e:	b8 00 00 00 00       	mov    $0x0,%eax
+     843:	e8 05 23 00 00       	call   2b4d <printf>
+     848:	e8 a7 28 00 00       	call   30f4 <exit>
+  memset(buf, 0, 1);
+     84d:	ba 01 00 00 00       	mov    $0x1,%edx
+     852:	be 00 00 00 00       	mov    $0x0,%esi
+     857:	48 8d 05 62 3a 00 00 	lea    0x3a62(%rip),%rax        # 42c0 <buf>
+     85e:	48 89 c7             	mov    %rax,%rdi
+     861:	e8 a5 26 00 00       	call   2f0b <memset>
+  n = read(fd, buf, 1);
+     866:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     869:	ba 01 00 00 00       	mov    $0x1,%edx
+     86e:	48 8d 0d 4b 3a 00 00 	lea    0x3a4b(%rip),%rcx        # 42c0 <buf>
+     875:	48 89 ce             	mov    %rcx,%rsi
+     878:	89 c7                	mov    %eax,%edi
+     87a:	e8 8d 28 00 00       	call   310c <read>
+     87f:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  if (n != 1) {
+     882:	83 7d f8 01          	cmpl   $0x1,-0x8(%rbp)
+     886:	74 5e                	je     8e6 <filecreation+0x2d8>
+    error("error reading from created file.\n");
+     888:	8b 05 b2 39 00 00    	mov    0x39b2(%rip),%eax        # 4240 <stdout>
+     88e:	ba 87 00 00 00       	mov    $0x87,%edx
+     893:	48 8d 0d e8 2b 00 00 	lea    0x2be8(%rip),%rcx        # 3482 <malloc+0x147>
+     89a:	48 89 ce             	mov    %rcx,%rsi
+     89d:	89 c7                	mov    %eax,%edi
+     89f:	b8 00 00 00 00       	mov    $0x0,%eax
+     8a4:	e8 a4 22 00 00       	call   2b4d <printf>
+     8a9:	8b 05 91 39 00 00    	mov    0x3991(%rip),%eax        # 4240 <stdout>
+     8af:	48 8d 15 2a 2e 00 00 	lea    0x2e2a(%rip),%rdx        # 36e0 <malloc+0x3a5>
+     8b6:	48 89 d6             	mov    %rdx,%rsi
+     8b9:	89 c7                	mov    %eax,%edi
+     8bb:	b8 00 00 00 00       	mov    $0x0,%eax
+     8c0:	e8 88 22 00 00       	call   2b4d <printf>
+     8c5:	8b 05 75 39 00 00    	mov    0x3975(%rip),%eax        # 4240 <stdout>
+     8cb:	48 8d 15 f3 2b 00 00 	lea    0x2bf3(%rip),%rdx        # 34c5 <malloc+0x18a>
+     8d2:	48 89 d6             	mov    %rdx,%rsi
+     8d5:	89 c7                	mov    %eax,%edi
+     8d7:	b8 00 00 00 00       	mov    $0x0,%eax
+     8dc:	e8 6c 22 00 00       	call   2b4d <printf>
+     8e1:	e8 0e 28 00 00       	call   30f4 <exit>
+  }
+
+  // Ensure read got the correct value.
+  assert(buf[0] == 1);
+     8e6:	0f b6 05 d3 39 00 00 	movzbl 0x39d3(%rip),%eax        # 42c0 <buf>
+     8ed:	3c 01                	cmp    $0x1,%al
+     8ef:	74 2b                	je     91c <filecreation+0x30e>
+     8f1:	8b 05 49 39 00 00    	mov    0x3949(%rip),%eax        # 4240 <stdout>
+     8f7:	48 8d 15 04 2e 00 00 	lea    0x2e04(%rip),%rdx        # 3702 <malloc+0x3c7>
+     8fe:	48 89 d1             	mov    %rdx,%rcx
+     901:	ba 8b 00 00 00       	mov    $0x8b,%edx
+     906:	48 8d 35 03 2e 00 00 	lea    0x2e03(%rip),%rsi        # 3710 <malloc+0x3d5>
+     90d:	89 c7                	mov    %eax,%edi
+     90f:	b8 00 00 00 00       	mov    $0x0,%eax
+     914:	e8 34 22 00 00       	call   2b4d <printf>
+     919:	90                   	nop
+     91a:	eb fd                	jmp    919 <filecreation+0x30b>
+
+  printf(1, "filecreation ok\n");
+     91c:	48 8d 05 0d 2e 00 00 	lea    0x2e0d(%rip),%rax        # 3730 <malloc+0x3f5>
+     923:	48 89 c6             	mov    %rax,%rsi
+     926:	bf 01 00 00 00       	mov    $0x1,%edi
+     92b:	b8 00 00 00 00       	mov    $0x0,%eax
+     930:	e8 18 22 00 00       	call   2b4d <printf>
+
+}
+     935:	90                   	nop
+     936:	c9                   	leave
+     937:	c3                   	ret
+
+0000000000000938 <manyfiles>:
+
+
+// Creates many files one after another, so their creations commit
+// in separate log transactions and grow the inode file and the root
+// directory. Checks each file, then deletes them all.
+void manyfiles(void) {
+     938:	55                   	push   %rbp
+     939:	48 89 e5             	mov    %rsp,%rbp
+     93c:	48 83 ec 10          	sub    $0x10,%rsp
+  char name[4];
+  int fd, i;
+  printf(1, "manyfiles...\n");
+     940:	48 8d 05 fa 2d 00 00 	lea    0x2dfa(%rip),%rax        # 3741 <malloc+0x406>
+     947:	48 89 c6             	mov    %rax,%rsi
+     94a:	bf 01 00 00 00       	mov    $0x1,%edi
+     94f:	b8 00 00 00 00       	mov    $0x0,%eax
+     954:	e8 f4 21 00 00       	call   2b4d <printf>
+
+  name[0] = 'm';
+     959:	c6 45 f4 6d          	movb   $0x6d,-0xc(%rbp)
+  name[1] = 'f';
+     95d:	c6 45 f5 66          	movb   $0x66,-0xb(%rbp)
+  name[3] = 0;
+     961:	c6 45 f7 00          	movb   $0x0,-0x9(%rbp)
+  for (i = 0; i < 26; i++) {
+     965:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     96c:	e9 1c 01 00 00       	jmp    a8d <manyfiles+0x155>
+    name[2] = 'a' + i;
+     971:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     974:	83 c0 61             	add    $0x61,%eax
+     977:	88 45 f6             	mov    %al,-0xa(%rbp)
+    if ((fd = open(name, O_CREATE|O_RDWR)) < 0)
+     97a:	48 8d 45 f4          	lea    -0xc(%rbp),%rax
+     97e:	be 02 02 00 00       	mov    $0x202,%esi
+     983:	48 89 c7             	mov    %rax,%rdi
+     986:	e8 a9 27 00 00       	call   3134 <open>
+     98b:	89 45 f8             	mov    %eax,-0x8(%rbp)
+     98e:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+     992:	79 62                	jns    9f6 <manyfiles+0xbe>
+      error("create '%s' failed", name);
+     994:	8b 05 a6 38 00 00    	mov    0x38a6(%rip),%eax        # 4240 <stdout>
+     99a:	ba a0 00 00 00       	mov    $0xa0,%edx
+     99f:	48 8d 0d dc 2a 00 00 	lea    0x2adc(%rip),%rcx        # 3482 <malloc+0x147>
+     9a6:	48 89 ce             	mov    %rcx,%rsi
+     9a9:	89 c7                	mov    %eax,%edi
+     9ab:	b8 00 00 00 00       	mov    $0x0,%eax
+     9b0:	e8 98 21 00 00       	call   2b4d <printf>
+     9b5:	8b 05 85 38 00 00    	mov    0x3885(%rip),%eax        # 4240 <stdout>
+     9bb:	48 8d 55 f4          	lea    -0xc(%rbp),%rdx
+     9bf:	48 8d 0d 89 2d 00 00 	lea    0x2d89(%rip),%rcx        # 374f <malloc+0x414>
+     9c6:	48 89 ce             	mov    %rcx,%rsi
+     9c9:	89 c7                	mov    %eax,%edi
+     9cb:	b8 00 00 00 00       	mov    $0x0,%eax
+     9d0:	e8 78 21 00 00       	call   2b4d <printf>
+     9d5:	8b 05 65 38 00 00    	mov    0x3865(%rip),%eax        # 4240 <stdout>
+     9db:	48 8d 15 e3 2a 00 00 	lea    0x2ae3(%rip),%rdx        # 34c5 <malloc+0x18a>
+     9e2:	48 89 d6             	mov    %rdx,%rsi
+     9e5:	89 c7                	mov    %eax,%edi
+     9e7:	b8 00 00 00 00       	mov    $0x0,%eax
+     9ec:	e8 5c 21 00 00       	call   2b4d <printf>
+     9f1:	e8 fe 26 00 00       	call   30f4 <exit>
+    buf[0] = i;
+     9f6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     9f9:	88 05 c1 38 00 00    	mov    %al,0x38c1(%rip)        # 42c0 <buf>
+    if (write(fd, buf, 1) != 1)
+     9ff:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     a02:	ba 01 00 00 00       	mov    $0x1,%edx
+     a07:	48 8d 0d b2 38 00 00 	lea    0x38b2(%rip),%rcx        # 42c0 <buf>
+     a0e:	48 89 ce             	mov    %rcx,%rsi
+     a11:	89 c7                	mov    %eax,%edi
+     a13:	e8 fc 26 00 00       	call   3114 <write>
+     a18:	83 f8 01             	cmp    $0x1,%eax
+     a1b:	74 62                	je     a7f <manyfiles+0x147>
+      error("write to '%s' failed", name);
+     a1d:	8b 05 1d 38 00 00    	mov    0x381d(%rip),%eax        # 4240 <stdout>
+     a23:	ba a3 00 00 00       	mov    $0xa3,%edx
+     a28:	48 8d 0d 53 2a 00 00 	lea    0x2a53(%rip),%rcx        # 3482 <malloc+0x147>
+     a2f:	48 89 ce             	mov    %rcx,%rsi
+     a32:	89 c7                	mov    %eax,%edi
+     a34:	b8 00 00 00 00       	mov    $0x0,%eax
+     a39:	e8 0f 21 00 00       	call   2b4d <printf>
+     a3e:	8b 05 fc 37 00 00    	mov    0x37fc(%rip),%eax        # 4240 <stdout>
+     a44:	48 8d 55 f4          	lea    -0xc(%rbp),%rdx
+     a48:	48 8d 0d 13 2d 00 00 	lea    0x2d13(%rip),%rcx        # 3762 <malloc+0x427>
+     a4f:	48 89 ce             	mov    %rcx,%rsi
+     a52:	89 c7                	mov    %eax,%edi
+     a54:	b8 00 00 00 00       	mov    $0x0,%eax
+     a59:	e8 ef 20 00 00       	call   2b4d <printf>
+     a5e:	8b 05 dc 37 00 00    	mov    0x37dc(%rip),%eax        # 4240 <stdout>
+     a64:	48 8d 15 5a 2a 00 00 	lea    0x2a5a(%rip),%rdx        # 34c5 <malloc+0x18a>
+     a6b:	48 89 d6             	mov    %rdx,%rsi
+     a6e:	89 c7                	mov    %eax,%edi
+     a70:	b8 00 00 00 00       	mov    $0x0,%eax
+     a75:	e8 d3 20 00 00       	call   2b4d <printf>
+     a7a:	e8 75 26 00 00       	call   30f4 <exit>
+    close(fd);
+     a7f:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     a82:	89 c7                	mov    %eax,%edi
+     a84:	e8 93 26 00 00       	call   311c <close>
+  for (i = 0; i < 26; i++) {
+     a89:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     a8d:	83 7d fc 19          	cmpl   $0x19,-0x4(%rbp)
+     a91:	0f 8e da fe ff ff    	jle    971 <manyfiles+0x39>
+  }
+
+  for (i = 0; i < 26; i++) {
+     a97:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     a9e:	e9 9b 01 00 00       	jmp    c3e <manyfiles+0x306>
+    name[2] = 'a' + i;
+     aa3:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     aa6:	83 c0 61             	add    $0x61,%eax
+     aa9:	88 45 f6             	mov    %al,-0xa(%rbp)
+    if ((fd = open(name, O_RDONLY)) < 0)
+     aac:	48 8d 45 f4          	lea    -0xc(%rbp),%rax
+     ab0:	be 00 00 00 00       	mov    $0x0,%esi
+     ab5:	48 89 c7             	mov    %rax,%rdi
+     ab8:	e8 77 26 00 00       	call   3134 <open>
+     abd:	89 45 f8             	mov    %eax,-0x8(%rbp)
+     ac0:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+     ac4:	79 62                	jns    b28 <manyfiles+0x1f0>
+      error("open '%s' after creation failed", name);
+     ac6:	8b 05 74 37 00 00    	mov    0x3774(%rip),%eax        # 4240 <stdout>
+     acc:	ba aa 00 00 00       	mov    $0xaa,%edx
+     ad1:	48 8d 0d aa 29 00 00 	lea    0x29aa(%rip),%rcx        # 3482 <malloc+0x147>
+     ad8:	48 89 ce             	mov    %rcx,%rsi
+     adb:	89 c7                	mov    %eax,%edi
+     add:	b8 00 00 00 00       	mov    $0x0,%eax
+     ae2:	e8 66 20 00 00       	call   2b4d <printf>
+     ae7:	8b 05 53 37 00 00    	mov    0x3753(%rip),%eax        # 4240 <stdout>
+     aed:	48 8d 55 f4          	lea    -0xc(%rbp),%rdx
+     af1:	48 8d 0d 80 2c 00 00 	lea    0x2c80(%rip),%rcx        # 3778 <malloc+0x43d>
+     af8:	48 89 ce             	mov    %rcx,%rsi
+     afb:	89 c7                	mov    %eax,%edi
+     afd:	b8 00 00 00 00       	mov    $0x0,%eax
+     b02:	e8 46 20 00 00       	call   2b4d <printf>
+     b07:	8b 05 33 37 00 00    	mov    0x3733(%rip),%eax        # 4240 <stdout>
+     b0d:	48 8d 15 b1 29 00 00 	lea    0x29b1(%rip),%rdx        # 34c5 <malloc+0x18a>
+     b14:	48 89 d6             	mov    %rdx,%rsi
+     b17:	89 c7                	mov    %eax,%edi
+     b19:	b8 00 00 00 00       	mov    $0x0,%eax
+     b1e:	e8 2a 20 00 00       	call   2b4d <printf>
+     b23:	e8 cc 25 00 00       	call   30f4 <exit>
+    buf[0] = -1;
+     b28:	c6 05 91 37 00 00 ff 	movb   $0xff,0x3791(%rip)        # 42c0 <buf>
+    if (read(fd, buf, 1) != 1 || buf[0] != i)
+     b2f:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     b32:	ba 01 00 00 00       	mov    $0x1,%edx
+     b37:	48 8d 0d 82 37 00 00 	lea    0x3782(%rip),%rcx        # 42c0 <buf>
+     b3e:	48 89 ce             	mov    %rcx,%rsi
+     b41:	89 c7                	mov    %eax,%edi
+     b43:	e8 c4 25 00 00       	call   310c <read>
+     b48:	83 f8 01             	cmp    $0x1,%eax
+     b4b:	75 0f                	jne    b5c <manyfiles+0x224>
+     b4d:	0f b6 05 6c 37 00 00 	movzbl 0x376c(%rip),%eax        # 42c0 <buf>
+     b54:	0f be c0             	movsbl %al,%eax
+     b57:	39 45 fc             	cmp    %eax,-0x4(%rbp)
+     b5a:	74 62                	je     bbe <manyfiles+0x286>
+      error("'%s' has the wrong contents", name);
+     b5c:	8b 05 de 36 00 00    	mov    0x36de(%rip),%eax        # 4240 <stdout>
+     b62:	ba ad 00 00 00       	mov    $0xad,%edx
+     b67:	48 8d 0d 14 29 00 00 	lea    0x2914(%rip),%rcx        # 3482 <malloc+0x147>
+     b6e:	48 89 ce             	mov    %rcx,%rsi
+     b71:	89 c7                	mov    %eax,%edi
+     b73:	b8 00 00 00 00       	mov    $0x0,%eax
+     b78:	e8 d0 1f 00 00       	call   2b4d <printf>
+     b7d:	8b 05 bd 36 00 00    	mov    0x36bd(%rip),%eax        # 4240 <stdout>
+     b83:	48 8d 55 f4          	lea    -0xc(%rbp),%rdx
+     b87:	48 8d 0d 0a 2c 00 00 	lea    0x2c0a(%rip),%rcx        # 3798 <malloc+0x45d>
+     b8e:	48 89 ce             	mov    %rcx,%rsi
+     b91:	89 c7                	mov    %eax,%edi
+     b93:	b8 00 00 00 00       	mov    $0x0,%eax
+     b98:	e8 b0 1f 00 00       	call   2b4d <printf>
+     b9d:	8b 05 9d 36 00 00    	mov    0x369d(%rip),%eax        # 4240 <stdout>
+     ba3:	48 8d 15 1b 29 00 00 	lea    0x291b(%rip),%rdx        # 34c5 <malloc+0x18a>
+     baa:	48 89 d6             	mov    %rdx,%rsi
+     bad:	89 c7                	mov    %eax,%edi
+     baf:	b8 00 00 00 00       	mov    $0x0,%eax
+     bb4:	e8 94 1f 00 00       	call   2b4d <printf>
+     bb9:	e8 36 25 00 00       	call   30f4 <exit>
+    close(fd);
+     bbe:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     bc1:	89 c7                	mov    %eax,%edi
+     bc3:	e8 54 25 00 00       	call   311c <close>
+    if (unlink(name) != 0)
+     bc8:	48 8d 45 f4          	lea    -0xc(%rbp),%rax
+     bcc:	48 89 c7             	mov    %rax,%rdi
+     bcf:	e8 70 25 00 00       	call   3144 <unlink>
+     bd4:	85 c0                	test   %eax,%eax
+     bd6:	74 62                	je     c3a <manyfiles+0x302>
+      error("unlink '%s' failed", name);
+     bd8:	8b 05 62 36 00 00    	mov    0x3662(%rip),%eax        # 4240 <stdout>
+     bde:	ba b0 00 00 00       	mov    $0xb0,%edx
+     be3:	48 8d 0d 98 28 00 00 	lea    0x2898(%rip),%rcx        # 3482 <malloc+0x147>
+     bea:	48 89 ce             	mov    %rcx,%rsi
+     bed:	89 c7                	mov    %eax,%edi
+     bef:	b8 00 00 00 00       	mov    $0x0,%eax
+     bf4:	e8 54 1f 00 00       	call   2b4d <printf>
+     bf9:	8b 05 41 36 00 00    	mov    0x3641(%rip),%eax        # 4240 <stdout>
+     bff:	48 8d 55 f4          	lea    -0xc(%rbp),%rdx
+     c03:	48 8d 0d aa 2b 00 00 	lea    0x2baa(%rip),%rcx        # 37b4 <malloc+0x479>
+     c0a:	48 89 ce             	mov    %rcx,%rsi
+     c0d:	89 c7                	mov    %eax,%edi
+     c0f:	b8 00 00 00 00       	mov    $0x0,%eax
+     c14:	e8 34 1f 00 00       	call   2b4d <printf>
+     c19:	8b 05 21 36 00 00    	mov    0x3621(%rip),%eax        # 4240 <stdout>
+     c1f:	48 8d 15 9f 28 00 00 	lea    0x289f(%rip),%rdx        # 34c5 <malloc+0x18a>
+     c26:	48 89 d6             	mov    %rdx,%rsi
+     c29:	89 c7                	mov    %eax,%edi
+     c2b:	b8 00 00 00 00       	mov    $0x0,%eax
+     c30:	e8 18 1f 00 00       	call   2b4d <printf>
+     c35:	e8 ba 24 00 00       	call   30f4 <exit>
+  for (i = 0; i < 26; i++) {
+     c3a:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     c3e:	83 7d fc 19          	cmpl   $0x19,-0x4(%rbp)
+     c42:	0f 8e 5b fe ff ff    	jle    aa3 <manyfiles+0x16b>
+  }
+
+  printf(1, "manyfiles ok\n");
+     c48:	48 8d 05 78 2b 00 00 	lea    0x2b78(%rip),%rax        # 37c7 <malloc+0x48c>
+     c4f:	48 89 c6             	mov    %rax,%rsi
+     c52:	bf 01 00 00 00       	mov    $0x1,%edi
+     c57:	b8 00 00 00 00       	mov    $0x0,%eax
+     c5c:	e8 ec 1e 00 00       	call   2b4d <printf>
+}
+     c61:	90                   	nop
+     c62:	c9                   	leave
+     c63:	c3                   	ret
+
+0000000000000c64 <syncfile>:
+
+// Writes a file and flushes it with fsync and sync.
+// Checks the data is still there and that fsync rejects a closed fd.
+void syncfile(void) {
+     c64:	55                   	push   %rbp
+     c65:	48 89 e5             	mov    %rsp,%rbp
+     c68:	48 83 ec 10          	sub    $0x10,%rsp
+  int fd, i;
+  printf(1, "syncfile...\n");
+     c6c:	48 8d 05 62 2b 00 00 	lea    0x2b62(%rip),%rax        # 37d5 <malloc+0x49a>
+     c73:	48 89 c6             	mov    %rax,%rsi
+     c76:	bf 01 00 00 00       	mov    $0x1,%edi
+     c7b:	b8 00 00 00 00       	mov    $0x0,%eax
+     c80:	e8 c8 1e 00 00       	call   2b4d <printf>
+
+  if ((fd = open("sync.txt", O_CREATE|O_RDWR)) < 0)
+     c85:	be 02 02 00 00       	mov    $0x202,%esi
+     c8a:	48 8d 05 51 2b 00 00 	lea    0x2b51(%rip),%rax        # 37e2 <malloc+0x4a7>
+     c91:	48 89 c7             	mov    %rax,%rdi
+     c94:	e8 9b 24 00 00       	call   3134 <open>
+     c99:	89 45 f8             	mov    %eax,-0x8(%rbp)
+     c9c:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+     ca0:	79 5e                	jns    d00 <syncfile+0x9c>
+    error("create 'sync.txt' failed");
+     ca2:	8b 05 98 35 00 00    	mov    0x3598(%rip),%eax        # 4240 <stdout>
+     ca8:	ba bd 00 00 00       	mov    $0xbd,%edx
+     cad:	48 8d 0d ce 27 00 00 	lea    0x27ce(%rip),%rcx        # 3482 <malloc+0x147>
+     cb4:	48 89 ce             	mov    %rcx,%rsi
+     cb7:	89 c7                	mov    %eax,%edi
+     cb9:	b8 00 00 00 00       	mov    $0x0,%eax
+     cbe:	e8 8a 1e 00 00       	call   2b4d <printf>
+     cc3:	8b 05 77 35 00 00    	mov    0x3577(%rip),%eax        # 4240 <stdout>
+     cc9:	48 8d 15 1b 2b 00 00 	lea    0x2b1b(%rip),%rdx        # 37eb <malloc+0x4b0>
+     cd0:	48 89 d6             	mov    %rdx,%rsi
+     cd3:	89 c7                	mov    %eax,%edi
+     cd5:	b8 00 00 00 00       	mov    $0x0,%eax
+     cda:	e8 6e 1e 00 00       	call   2b4d <printf>
+     cdf:	8b 05 5b 35 00 00    	mov    0x355b(%rip),%eax        # 4240 <stdout>
+     ce5:	48 8d 15 d9 27 00 00 	lea    0x27d9(%rip),%rdx        # 34c5 <malloc+0x18a>
+     cec:	48 89 d6             	mov    %rdx,%rsi
+     cef:	89 c7                	mov    %eax,%edi
+     cf1:	b8 00 00 00 00       	mov    $0x0,%eax
+     cf6:	e8 52 1e 00 00       	call   2b4d <printf>
+     cfb:	e8 f4 23 00 00       	call   30f4 <exit>
+  for (i = 0; i < 2000; i++)
+     d00:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     d07:	eb 3c                	jmp    d45 <syncfile+0xe1>
+    buf[i] = 'a' + i % 26;
+     d09:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     d0c:	48 63 d0             	movslq %eax,%rdx
+     d0f:	48 69 d2 4f ec c4 4e 	imul   $0x4ec4ec4f,%rdx,%rdx
+     d16:	48 c1 ea 20          	shr    $0x20,%rdx
+     d1a:	c1 fa 03             	sar    $0x3,%edx
+     d1d:	89 c1                	mov    %eax,%ecx
+     d1f:	c1 f9 1f             	sar    $0x1f,%ecx
+     d22:	29 ca                	sub    %ecx,%edx
+     d24:	6b ca 1a             	imul   $0x1a,%edx,%ecx
+     d27:	29 c8                	sub    %ecx,%eax
+     d29:	89 c2                	mov    %eax,%edx
+     d2b:	89 d0                	mov    %edx,%eax
+     d2d:	83 c0 61             	add    $0x61,%eax
+     d30:	89 c1                	mov    %eax,%ecx
+     d32:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     d35:	48 98                	cltq
+     d37:	48 8d 15 82 35 00 00 	lea    0x3582(%rip),%rdx        # 42c0 <buf>
+     d3e:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  for (i = 0; i < 2000; i++)
+     d41:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     d45:	81 7d fc cf 07 00 00 	cmpl   $0x7cf,-0x4(%rbp)
+     d4c:	7e bb                	jle    d09 <syncfile+0xa5>
+  if (write(fd, buf, 2000) != 2000)
+     d4e:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     d51:	ba d0 07 00 00       	mov    $0x7d0,%edx
+     d56:	48 8d 0d 63 35 00 00 	lea    0x3563(%rip),%rcx        # 42c0 <buf>
+     d5d:	48 89 ce             	mov    %rcx,%rsi
+     d60:	89 c7                	mov    %eax,%edi
+     d62:	e8 ad 23 00 00       	call   3114 <write>
+     d67:	3d d0 07 00 00       	cmp    $0x7d0,%eax
+     d6c:	74 5e                	je     dcc <syncfile+0x168>
+    error("write to 'sync.txt' failed");
+     d6e:	8b 05 cc 34 00 00    	mov    0x34cc(%rip),%eax        # 4240 <stdout>
+     d74:	ba c1 00 00 00       	mov    $0xc1,%edx
+     d79:	48 8d 0d 02 27 00 00 	lea    0x2702(%rip),%rcx        # 3482 <malloc+0x147>
+     d80:	48 89 ce             	mov    %rcx,%rsi
+     d83:	89 c7                	mov    %eax,%edi
+     d85:	b8 00 00 00 00       	mov    $0x0,%eax
+     d8a:	e8 be 1d 00 00       	call   2b4d <printf>
+     d8f:	8b 05 ab 34 00 00    	mov    0x34ab(%rip),%eax        # 4240 <stdout>
+     d95:	48 8d 15 68 2a 00 00 	lea    0x2a68(%rip),%rdx        # 3804 <malloc+0x4c9>
+     d9c:	48 89 d6             	mov    %rdx,%rsi
+     d9f:	89 c7                	mov    %eax,%edi
+     da1:	b8 00 00 00 00       	mov    $0x0,%eax
+     da6:	e8 a2 1d 00 00       	call   2b4d <printf>
+     dab:	8b 05 8f 34 00 00    	mov    0x348f(%rip),%eax        # 4240 <stdout>
+     db1:	48 8d 15 0d 27 00 00 	lea    0x270d(%rip),%rdx        # 34c5 <malloc+0x18a>
+     db8:	48 89 d6             	mov    %rdx,%rsi
+     dbb:	89 c7                	mov    %eax,%edi
+     dbd:	b8 00 00 00 00       	mov    $0x0,%eax
+     dc2:	e8 86 1d 00 00       	call   2b4d <printf>
+     dc7:	e8 28 23 00 00       	call   30f4 <exit>
+  if (fsync(fd) != 0)
+     dcc:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     dcf:	89 c7                	mov    %eax,%edi
+     dd1:	e8 d6 23 00 00       	call   31ac <fsync>
+     dd6:	85 c0                	test   %eax,%eax
+     dd8:	74 5e                	je     e38 <syncfile+0x1d4>
+    error("fsync of 'sync.txt' failed");
+     dda:	8b 05 60 34 00 00    	mov    0x3460(%rip),%eax        # 4240 <stdout>
+     de0:	ba c3 00 00 00       	mov    $0xc3,%edx
+     de5:	48 8d 0d 96 26 00 00 	lea    0x2696(%rip),%rcx        # 3482 <malloc+0x147>
+     dec:	48 89 ce             	mov    %rcx,%rsi
+     def:	89 c7                	mov    %eax,%edi
+     df1:	b8 00 00 00 00       	mov    $0x0,%eax
+     df6:	e8 52 1d 00 00       	call   2b4d <printf>
+     dfb:	8b 05 3f 34 00 00    	mov    0x343f(%rip),%eax        # 4240 <stdout>
+     e01:	48 8d 15 17 2a 00 00 	lea    0x2a17(%rip),%rdx        # 381f <malloc+0x4e4>
+     e08:	48 89 d6             	mov    %rdx,%rsi
+     e0b:	89 c7                	mov    %eax,%edi
+     e0d:	b8 00 00 00 00       	mov    $0x0,%eax
+     e12:	e8 36 1d 00 00       	call   2b4d <printf>
+     e17:	8b 05 23 34 00 00    	mov    0x3423(%rip),%eax        # 4240 <stdout>
+     e1d:	48 8d 15 a1 26 00 00 	lea    0x26a1(%rip),%rdx        # 34c5 <malloc+0x18a>
+     e24:	48 89 d6             	mov    %rdx,%rsi
+     e27:	89 c7                	mov    %eax,%edi
+     e29:	b8 00 00 00 00       	mov    $0x0,%eax
+     e2e:	e8 1a 1d 00 00       	call   2b4d <printf>
+     e33:	e8 bc 22 00 00       	call   30f4 <exit>
+  if (sync() != 0)
+     e38:	e8 67 23 00 00       	call   31a4 <sync>
+     e3d:	85 c0                	test   %eax,%eax
+     e3f:	74 5e                	je     e9f <syncfile+0x23b>
+    error("sync failed");
+     e41:	8b 05 f9 33 00 00    	mov    0x33f9(%rip),%eax        # 4240 <stdout>
+     e47:	ba c5 00 00 00       	mov    $0xc5,%edx
+     e4c:	48 8d 0d 2f 26 00 00 	lea    0x262f(%rip),%rcx        # 3482 <malloc+0x147>
+     e53:	48 89 ce             	mov    %rcx,%rsi
+     e56:	89 c7                	mov    %eax,%edi
+     e58:	b8 00 00 00 00       	mov    $0x0,%eax
+     e5d:	e8 eb 1c 00 00       	call   2b4d <printf>
+     e62:	8b 05 d8 33 00 00    	mov    0x33d8(%rip),%eax        # 4240 <stdout>
+     e68:	48 8d 15 cb 29 00 00 	lea    0x29cb(%rip),%rdx        # 383a <malloc+0x4ff>
+     e6f:	48 89 d6             	mov    %rdx,%rsi
+     e72:	89 c7                	mov    %eax,%edi
+     e74:	b8 00 00 00 00       	mov    $0x0,%eax
+     e79:	e8 cf 1c 00 00       	call   2b4d <printf>
+     e7e:	8b 05 bc 33 00 00    	mov    0x33bc(%rip),%eax        # 4240 <stdout>
+     e84:	48 8d 15 3a 26 00 00 	lea    0x263a(%rip),%rdx        # 34c5 <malloc+0x18a>
+     e8b:	48 89 d6             	mov    %rdx,%rsi
+     e8e:	89 c7                	mov    %eax,%edi
+     e90:	b8 00 00 00 00       	mov    $0x0,%eax
+     e95:	e8 b3 1c 00 00       	call   2b4d <printf>
+     e9a:	e8 55 22 00 00       	call   30f4 <exit>
+  close(fd);
+     e9f:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     ea2:	89 c7                	mov    %eax,%edi
+     ea4:	e8 73 22 00 00       	call   311c <close>
+
+  if (fsync(fd) != -1)
+     ea9:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     eac:	89 c7                	mov    %eax,%edi
+     eae:	e8 f9 22 00 00       	call   31ac <fsync>
+     eb3:	83 f8 ff             	cmp    $0xffffffff,%eax
+     eb6:	74 5e                	je     f16 <syncfile+0x2b2>
+    error("fsync of a closed fd succeeded");
+     eb8:	8b 05 82 33 00 00    	mov    0x3382(%rip),%eax        # 4240 <stdout>
+     ebe:	ba c9 00 00 00       	mov    $0xc9,%edx
+     ec3:	48 8d 0d b8 25 00 00 	lea    0x25b8(%rip),%rcx        # 3482 <malloc+0x147>
+     eca:	48 89 ce             	mov    %rcx,%rsi
+     ecd:	89 c7                	mov    %eax,%edi
+     ecf:	b8 00 00 00 00       	mov    $0x0,%eax
+     ed4:	e8 74 1c 00 00       	call   2b4d <printf>
+     ed9:	8b 05 61 33 00 00    	mov    0x3361(%rip),%eax        # 4240 <stdout>
+     edf:	48 8d 15 62 29 00 00 	lea    0x2962(%rip),%rdx        # 3848 <malloc+0x50d>
+     ee6:	48 89 d6             	mov    %rdx,%rsi
+     ee9:	89 c7                	mov    %eax,%edi
+     eeb:	b8 00 00 00 00       	mov    $0x0,%eax
+     ef0:	e8 58 1c 00 00       	call   2b4d <printf>
+     ef5:	8b 05 45 33 00 00    	mov    0x3345(%rip),%eax        # 4240 <stdout>
+     efb:	48 8d 15 c3 25 00 00 	lea    0x25c3(%rip),%rdx        # 34c5 <malloc+0x18a>
+     f02:	48 89 d6             	mov    %rdx,%rsi
+     f05:	89 c7                	mov    %eax,%edi
+     f07:	b8 00 00 00 00       	mov    $0x0,%eax
+     f0c:	e8 3c 1c 00 00       	call   2b4d <printf>
+     f11:	e8 de 21 00 00       	call   30f4 <exit>
+
+  if ((fd = open("sync.txt", O_RDONLY)) < 0)
+     f16:	be 00 00 00 00       	mov    $0x0,%esi
+     f1b:	48 8d 05 c0 28 00 00 	lea    0x28c0(%rip),%rax        # 37e2 <malloc+0x4a7>
+     f22:	48 89 c7             	mov    %rax,%rdi
+     f25:	e8 0a 22 00 00       	call   3134 <open>
+     f2a:	89 45 f8             	mov    %eax,-0x8(%rbp)
+     f2d:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+     f31:	79 5e                	jns    f91 <syncfile+0x32d>
+    error("open 'sync.txt' after sync failed");
+     f33:	8b 05 07 33 00 00    	mov    0x3307(%rip),%eax        # 4240 <stdout>
+     f39:	ba cc 00 00 00       	mov    $0xcc,%edx
+     f3e:	48 8d 0d 3d 25 00 00 	lea    0x253d(%rip),%rcx        # 3482 <malloc+0x147>
+     f45:	48 89 ce             	mov    %rcx,%rsi
+     f48:	89 c7                	mov    %eax,%edi
+     f4a:	b8 00 00 00 00       	mov    $0x0,%eax
+     f4f:	e8 f9 1b 00 00       	call   2b4d <printf>
+     f54:	8b 05 e6 32 00 00    	mov    0x32e6(%rip),%eax        # 4240 <stdout>
+     f5a:	48 8d 15 07 29 00 00 	lea    0x2907(%rip),%rdx        # 3868 <malloc+0x52d>
+     f61:	48 89 d6             	mov    %rdx,%rsi
+     f64:	89 c7                	mov    %eax,%edi
+     f66:	b8 00 00 00 00       	mov    $0x0,%eax
+     f6b:	e8 dd 1b 00 00       	call   2b4d <printf>
+     f70:	8b 05 ca 32 00 00    	mov    0x32ca(%rip),%eax        # 4240 <stdout>
+     f76:	48 8d 15 48 25 00 00 	lea    0x2548(%rip),%rdx        # 34c5 <malloc+0x18a>
+     f7d:	48 89 d6             	mov    %rdx,%rsi
+     f80:	89 c7                	mov    %eax,%edi
+     f82:	b8 00 00 00 00       	mov    $0x0,%eax
+     f87:	e8 c1 1b 00 00       	call   2b4d <printf>
+     f8c:	e8 63 21 00 00       	call   30f4 <exit>
+  memset(buf, 0, 2000);
+     f91:	ba d0 07 00 00       	mov    $0x7d0,%edx
+     f96:	be 00 00 00 00       	mov    $0x0,%esi
+     f9b:	48 8d 05 1e 33 00 00 	lea    0x331e(%rip),%rax        # 42c0 <buf>
+     fa2:	48 89 c7             	mov    %rax,%rdi
+     fa5:	e8 61 1f 00 00       	call   2f0b <memset>
+  if (read(fd, buf, 2000) != 2000)
+     faa:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     fad:	ba d0 07 00 00       	mov    $0x7d0,%edx
+     fb2:	48 8d 0d 07 33 00 00 	lea    0x3307(%rip),%rcx        # 42c0 <buf>
+     fb9:	48 89 ce             	mov    %rcx,%rsi
+     fbc:	89 c7                	mov    %eax,%edi
+     fbe:	e8 49 21 00 00       	call   310c <read>
+     fc3:	3d d0 07 00 00       	cmp    $0x7d0,%eax
+     fc8:	74 5e                	je     1028 <syncfile+0x3c4>
+    error("read of 'sync.txt' failed");
+     fca:	8b 05 70 32 00 00    	mov    0x3270(%rip),%eax        # 4240 <stdout>
+     fd0:	ba cf 00 00 00       	mov    $0xcf,%edx
+     fd5:	48 8d 0d a6 24 00 00 	lea    0x24a6(%rip),%rcx        # 3482 <malloc+0x147>
+     fdc:	48 89 ce             	mov    %rcx,%rsi
+     fdf:	89 c7                	mov    %eax,%edi
+     fe1:	b8 00 00 00 00       	mov    $0x0,%eax
+     fe6:	e8 62 1b 00 00       	call   2b4d <printf>
+     feb:	8b 05 4f 32 00 00    	mov    0x324f(%rip),%eax        # 4240 <stdout>
+     ff1:	48 8d 15 92 28 00 00 	lea    0x2892(%rip),%rdx        # 388a <malloc+0x54f>
+     ff8:	48 89 d6             	mov    %rdx,%rsi
+     ffb:	89 c7                	mov    %eax,%edi
+     ffd:	b8 00 00 00 00       	mov    $0x0,%eax
+    1002:	e8 46 1b 00 00       	call   2b4d <printf>
+    1007:	8b 05 33 32 00 00    	mov    0x3233(%rip),%eax        # 4240 <stdout>
+    100d:	48 8d 15 b1 24 00 00 	lea    0x24b1(%rip),%rdx        # 34c5 <malloc+0x18a>
+    1014:	48 89 d6             	mov    %rdx,%rsi
+    1017:	89 c7                	mov    %eax,%edi
+    1019:	b8 00 00 00 00       	mov    $0x0,%eax
+    101e:	e8 2a 1b 00 00       	call   2b4d <printf>
+    1023:	e8 cc 20 00 00       	call   30f4 <exit>
+  for (i = 0; i < 2000; i++)
+    1028:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+    102f:	e9 a1 00 00 00       	jmp    10d5 <syncfile+0x471>
+    if (buf[i] != 'a' + i % 26)
+    1034:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1037:	48 98                	cltq
+    1039:	48 8d 15 80 32 00 00 	lea    0x3280(%rip),%rdx        # 42c0 <buf>
+    1040:	0f b6 04 10          	movzbl (%rax,%rdx,1),%eax
+    1044:	0f be f0             	movsbl %al,%esi
+    1047:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    104a:	48 63 d0             	movslq %eax,%rdx
+    104d:	48 69 d2 4f ec c4 4e 	imul   $0x4ec4ec4f,%rdx,%rdx
+    1054:	48 c1 ea 20          	shr    $0x20,%rdx
+    1058:	c1 fa 03             	sar    $0x3,%edx
+    105b:	89 c1                	mov    %eax,%ecx
+    105d:	c1 f9 1f             	sar    $0x1f,%ecx
+    1060:	29 ca                	sub    %ecx,%edx
+    1062:	6b ca 1a             	imul   $0x1a,%edx,%ecx
+    1065:	29 c8                	sub    %ecx,%eax
+    1067:	89 c2                	mov    %eax,%edx
+    1069:	8d 42 61             	lea    0x61(%rdx),%eax
+    106c:	39 c6                	cmp    %eax,%esi
+    106e:	74 61                	je     10d1 <syncfile+0x46d>
+      error("'sync.txt' byte %d is wrong after sync", i);
+    1070:	8b 05 ca 31 00 00    	mov    0x31ca(%rip),%eax        # 4240 <stdout>
+    1076:	ba d2 00 00 00       	mov    $0xd2,%edx
+    107b:	48 8d 0d 00 24 00 00 	lea    0x2400(%rip),%rcx        # 3482 <malloc+0x147>
+    1082:	48 89 ce             	mov    %rcx,%rsi
+    1085:	89 c7                	mov    %eax,%edi
+    1087:	b8 00 00 00 00       	mov    $0x0,%eax
+    108c:	e8 bc 1a 00 00       	call   2b4d <printf>
+    1091:	8b 05 a9 31 00 00    	mov    0x31a9(%rip),%eax        # 4240 <stdout>
+    1097:	8b 55 fc             	mov    -0x4(%rbp),%edx
+    109a:	48 8d 0d 07 28 00 00 	lea    0x2807(%rip),%rcx        # 38a8 <malloc+0x56d>
+    10a1:	48 89 ce             	mov    %rcx,%rsi
+    10a4:	89 c7                	mov    %eax,%edi
+    10a6:	b8 00 00 00 00       	mov    $0x0,%eax
+    10ab:	e8 9d 1a 00 00       	call   2b4d <printf>
+    10b0:	8b 05 8a 31 00 00    	mov    0x318a(%rip),%eax        # 4240 <stdout>
+    10b6:	48 8d 15 08 24 00 00 	lea    0x2408(%rip),%rdx        # 34c5 <malloc+0x18a>
+    10bd:	48 89 d6             	mov    %rdx,%rsi
+    10c0:	89 c7                	mov    %eax,%edi
+    10c2:	b8 00 00 00 00       	mov    $0x0,%eax
+    10c7:	e8 81 1a 00 00       	call   2b4d <printf>
+    10cc:	e8 23 20 00 00       	call   30f4 <exit>
+  for (i = 0; i < 2000; i++)
+    10d1:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+    10d5:	81 7d fc cf 07 00 00 	cmpl   $0x7cf,-0x4(%rbp)
+    10dc:	0f 8e 52 ff ff ff    	jle    1034 <syncfile+0x3d0>
+  close(fd);
+    10e2:	8b 45 f8             	mov    -0x8(%rbp),%eax
+    10e5:	89 c7                	mov    %eax,%edi
+    10e7:	e8 30 20 00 00       	call   311c <close>
+  if (unlink("sync.txt") != 0)
+    10ec:	48 8d 05 ef 26 00 00 	lea    0x26ef(%rip),%rax        # 37e2 <malloc+0x4a7>
+    10f3:	48 89 c7             	mov    %rax,%rdi
+    10f6:	e8 49 20 00 00       	call   3144 <unlink>
+    10fb:	85 c0                	test   %eax,%eax
+    10fd:	74 5e                	je     115d <syncfile+0x4f9>
+    error("unlink 'sync.txt' failed");
+    10ff:	8b 05 3b 31 00 00    	mov    0x313b(%rip),%eax        # 4240 <stdout>
+    1105:	ba d5 00 00 00       	mov    $0xd5,%edx
+    110a:	48 8d 0d 71 23 00 00 	lea    0x2371(%rip),%rcx        # 3482 <malloc+0x147>
+    1111:	48 89 ce             	mov    %rcx,%rsi
+    1114:	89 c7                	mov    %eax,%edi
+    1116:	b8 00 00 00 00       	mov    $0x0,%eax
+    111b:	e8 2d 1a 00 00       	call   2b4d <printf>
+    1120:	8b 05 1a 31 00 00    	mov    0x311a(%rip),%eax        # 4240 <stdout>
+    1126:	48 8d 15 a2 27 00 00 	lea    0x27a2(%rip),%rdx        # 38cf <malloc+0x594>
+    112d:	48 89 d6             	mov    %rdx,%rsi
+    1130:	89 c7                	mov    %eax,%edi
+    1132:	b8 00 00 00 00       	mov    $0x0,%eax
+    1137:	e8 11 1a 00 00       	call   2b4d <printf>
+    113c:	8b 05 fe 30 00 00    	mov    0x30fe(%rip),%eax        # 4240 <stdout>
+    1142:	48 8d 15 7c 23 00 00 	lea    0x237c(%rip),%rdx        # 34c5 <malloc+0x18a>
+    1149:	48 89 d6             	mov    %rdx,%rsi
+    114c:	89 c7                	mov    %eax,%edi
+    114e:	b8 00 00 00 00       	mov    $0x0,%eax
+    1153:	e8 f5 19 00 00       	call   2b4d <printf>
+    1158:	e8 97 1f 00 00       	call   30f4 <exit>
+
+  printf(1, "syncfile ok\n");
+    115d:	48 8d 05 84 27 00 00 	lea    0x2784(%rip),%rax        # 38e8 <malloc+0x5ad>
+    1164:	48 89 c6             	mov    %rax,%rsi
+    1167:	bf 01 00 00 00       	mov    $0x1,%edi
+    116c:	b8 00 00 00 00       	mov    $0x0,%eax
+    1171:	e8 d7 19 00 00       	call   2b4d <printf>
+}
+    1176:	90                   	nop
+    1177:	c9                   	leave
+    1178:	c3                   	ret
+
+0000000000001179 <onefile>:
+
+// Creates a file, writes and reads data.
+// Data is written and read by 500 bytes to try
+// and catch errors in writing.
+void onefile(void) {
+    1179:	55                   	push   %rbp
+    117a:	48 89 e5             	mov    %rsp,%rbp
+    117d:	48 83 ec 10          	sub    $0x10,%rsp
+  int fd, i, j;
+  printf(1, "onefile...\n");
+    1181:	48 8d 05 6d 27 00 00 	lea    0x276d(%rip),%rax        # 38f5 <malloc+0x5ba>
+    1188:	48 89 c6             	mov    %rax,%rsi
+    118b:	bf 01 00 00 00       	mov    $0x1,%edi
+    1190:	b8 00 00 00 00       	mov    $0x0,%eax
+    1195:	e8 b3 19 00 00       	call   2b4d <printf>
+
+  if ((fd = open("onefile.txt", O_CREATE|O_RDWR)) < 0)
+    119a:	be 02 02 00 00       	mov    $0x202,%esi
+    119f:	48 8d 05 5b 27 00 00 	lea    0x275b(%rip),%rax        # 3901 <malloc+0x5c6>
+    11a6:	48 89 c7             	mov    %rax,%rdi
+    11a9:	e8 86 1f 00 00       	call   3134 <open>
+    11ae:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    11b1:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+    11b5:	79 5e                	jns    1215 <onefile+0x9c>
+    error("create 'onefile.txt' failed");
+    11b7:	8b 05 83 30 00 00    	mov    0x3083(%rip),%eax        # 4240 <stdout>
+    11bd:	ba e2 00 00 00       	mov    $0xe2,%edx
+    11c2:	48 8d 0d b9 22 00 00 	lea    0x22b9(%rip),%rcx        # 3482 <malloc+0x147>
+    11c9:	48 89 ce             	mov    %rcx,%rsi
+    11cc:	89 c7                	mov    %eax,%edi
+    11ce:	b8 00 00 00 00       	mov    $0x0,%eax
+    11d3:	e8 75 19 00 00       	call   2b4d <printf>
+    11d8:	8b 05 62 30 00 00    	mov    0x3062(%rip),%eax        # 4240 <stdout>
+    11de:	48 8d 15 28 27 00 00 	lea    0x2728(%rip),%rdx        # 390d <malloc+0x5d2>
+    11e5:	48 89 d6             	mov    %rdx,%rsi
+    11e8:	89 c7                	mov    %eax,%edi
+    11ea:	b8 00 00 00 00       	mov    $0x0,%eax
+    11ef:	e8 59 19 00 00       	call   2b4d <printf>
+    11f4:	8b 05 46 30 00 00    	mov    0x3046(%rip),%eax        # 4240 <stdout>
+    11fa:	48 8d 15 c4 22 00 00 	lea    0x22c4(%rip),%rdx        # 34c5 <malloc+0x18a>
+    1201:	48 89 d6             	mov    %rdx,%rsi
+    1204:	89 c7                	mov    %eax,%edi
+    1206:	b8 00 00 00 00       	mov    $0x0,%eax
+    120b:	e8 3d 19 00 00       	call   2b4d <printf>
+    1210:	e8 df 1e 00 00       	call   30f4 <exit>
+
+  close(fd);
+    1215:	8b 45 f4             	mov    -0xc(%rbp),%eax
+    1218:	89 c7                	mov    %eax,%edi
+    121a:	e8 fd 1e 00 00       	call   311c <close>
+  if ((fd = open("onefile.txt", O_RDWR)) < 0)
+    121f:	be 02 00 00 00       	mov    $0x2,%esi
+    1224:	48 8d 05 d6 26 00 00 	lea    0x26d6(%rip),%rax        # 3901 <malloc+0x5c6>
+    122b:	48 89 c7             	mov    %rax,%rdi
+    122e:	e8 01 1f 00 00       	call   3134 <open>
+    1233:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    1236:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+    123a:	79 5e                	jns    129a <onefile+0x121>
+    error("open 'onefile.txt' after creation failed");
+    123c:	8b 05 fe 2f 00 00    	mov    0x2ffe(%rip),%eax        # 4240 <stdout>
+    1242:	ba e6 00 00 00       	mov    $0xe6,%edx
+    1247:	48 8d 0d 34 22 00 00 	lea    0x2234(%rip),%rcx        # 3482 <malloc+0x147>
+    124e:	48 89 ce             	mov    %rcx,%rsi
+    1251:	89 c7                	mov    %eax,%edi
+    1253:	b8 00 00 00 00       	mov    $0x0,%eax
+    1258:	e8 f0 18 00 00       	call   2b4d <printf>
+    125d:	8b 05 dd 2f 00 00    	mov    0x2fdd(%rip),%eax        # 4240 <stdout>
+    1263:	48 8d 15 c6 26 00 00 	lea    0x26c6(%rip),%rdx        # 3930 <malloc+0x5f5>
+    126a:	48 89 d6             	mov    %rdx,%rsi
+    126d:	89 c7                	mov    %eax,%edi
+    126f:	b8 00 00 00 00       	mov    $0x0,%eax
+    1274:	e8 d4 18 00 00       	call   2b4d <printf>
+    1279:	8b 05 c1 2f 00 00    	mov    0x2fc1(%rip),%eax        # 4240 <stdout>
+    127f:	48 8d 15 3f 22 00 00 	lea    0x223f(%rip),%rdx        # 34c5 <malloc+0x18a>
+    1286:	48 89 d6             	mov    %rdx,%rsi
+    1289:	89 c7                	mov    %eax,%edi
+    128b:	b8 00 00 00 00       	mov    $0x0,%eax
+    1290:	e8 b8 18 00 00       	call   2b4d <printf>
+    1295:	e8 5a 1e 00 00       	call   30f4 <exit>
+
+
+  memset(buf, 0, sizeof(buf));
+    129a:	ba 00 20 00 00       	mov    $0x2000,%edx
+    129f:	be 00 00 00 00       	mov    $0x0,%esi
+    12a4:	48 8d 05 15 30 00 00 	lea    0x3015(%rip),%rax        # 42c0 <buf>
+    12ab:	48 89 c7             	mov    %rax,%rdi
+    12ae:	e8 58 1c 00 00       	call   2f0b <memset>
+  for (i = 0; i < 10; i++) {
+    12b3:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+    12ba:	eb 36                	jmp    12f2 <onefile+0x179>
+    memset(buf, i, 500);
+    12bc:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    12bf:	ba f4 01 00 00       	mov    $0x1f4,%edx
+    12c4:	89 c6                	mov    %eax,%esi
+    12c6:	48 8d 05 f3 2f 00 00 	lea    0x2ff3(%rip),%rax        # 42c0 <buf>
+    12cd:	48 89 c7             	mov    %rax,%rdi
+    12d0:	e8 36 1c 00 00       	call   2f0b <memset>
+    write(fd, buf, 500);
+    12d5:	8b 45 f4             	mov    -0xc(%rbp),%eax
+    12d8:	ba f4 01 00 00       	mov    $0x1f4,%edx
+    12dd:	48 8d 0d dc 2f 00 00 	lea    0x2fdc(%rip),%rcx        # 42c0 <buf>
+    12e4:	48 89 ce             	mov    %rcx,%rsi
+    12e7:	89 c7                	mov    %eax,%edi
+    12e9:	e8 26 1e 00 00       	call   3114 <write>
+  for (i = 0; i < 10; i++) {
+    12ee:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+    12f2:	83 7d fc 09          	cmpl   $0x9,-0x4(%rbp)
+    12f6:	7e c4                	jle    12bc <onefile+0x143>
+  }
+  close(fd);
+    12f8:	8b 45 f4             	mov    -0xc(%rbp),%eax
+    12fb:	89 c7                	mov    %eax,%edi
+    12fd:	e8 1a 1e 00 00       	call   311c <close>
+  if ((fd = open("onefile.txt", O_RDONLY)) < 0)
+    1302:	be 00 00 00 00       	mov    $0x0,%esi
+    1307:	48 8d 05 f3 25 00 00 	lea    0x25f3(%rip),%rax        # 3901 <malloc+0x5c6>
+    130e:	48 89 c7             	mov    %rax,%rdi
+    1311:	e8 1e 1e 00 00       	call   3134 <open>
+    1316:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    1319:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+    131d:	79 5e                	jns    137d <onefile+0x204>
+    error("couldn't reopen 'onefile.txt'");
+    131f:	8b 05 1b 2f 00 00    	mov    0x2f1b(%rip),%eax        # 4240 <stdout>
+    1325:	ba f0 00 00 00       	mov    $0xf0,%edx
+    132a:	48 8d 0d 51 21 00 00 	lea    0x2151(%rip),%rcx        # 3482 <malloc+0x147>
+    1331:	48 89 ce             	mov    %rcx,%rsi
+    1334:	89 c7                	mov    %eax,%edi
+    1336:	b8 00 00 00 00       	mov    $0x0,%eax
+    133b:	e8 0d 18 00 00       	call   2b4d <printf>
+    1340:	8b 05 fa 2e 00 00    	mov    0x2efa(%rip),%eax        # 4240 <stdout>
+    1346:	48 8d 15 0c 26 00 00 	lea    0x260c(%rip),%rdx        # 3959 <malloc+0x61e>
+    134d:	48 89 d6             	mov    %rdx,%rsi
+    1350:	89 c7                	mov    %eax,%edi
+    1352:	b8 00 00 00 00       	mov    $0x0,%eax
+    1357:	e8 f1 17 00 00       	call   2b4d <printf>
+    135c:	8b 05 de 2e 00 00    	mov    0x2ede(%rip),%eax        # 4240 <stdout>
+    1362:	48 8d 15 5c 21 00 00 	lea    0x215c(%rip),%rdx        # 34c5 <malloc+0x18a>
+    1369:	48 89 d6             	mov    %rdx,%rsi
+    136c:	89 c7                	mov    %eax,%edi
+    136e:	b8 00 00 00 00       	mov    $0x0,%eax
+    1373:	e8 d5 17 00 00       	call   2b4d <printf>
+    1378:	e8 77 1d 00 00       	call   30f4 <exit>
+
+  memset(buf, 0, sizeof(buf));
+    137d:	ba 00 20 00 00       	mov    $0x2000,%edx
+    1382:	be 00 00 00 00       	mov    $0x0,%esi
+    1387:	48 8d 05 32 2f 00 00 	lea    0x2f32(%rip),%rax        # 42c0 <buf>
+    138e:	48 89 c7             	mov    %rax,%rdi
+    1391:	e8 75 1b 00 00       	call   2f0b <memset>
+  for (i = 0; i < 10; i++) {
+    1396:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+    139d:	e9 de 00 00 00       	jmp    1480 <onefile+0x307>
+    if (read(fd, buf, 500) != 500)
+    13a2:	8b 45 f4             	mov    -0xc(%rbp),%eax
+    13a5:	ba f4 01 00 00       	mov    $0x1f4,%edx
+    13aa:	48 8d 0d 0f 2f 00 00 	lea    0x2f0f(%rip),%rcx        # 42c0 <buf>
+    13b1:	48 89 ce             	mov    %rcx,%rsi
+    13b4:	89 c7                	mov    %eax,%edi
+    13b6:	e8 51 1d 00 00       	call   310c <read>
+    13bb:	3d f4 01 00 00       	cmp    $0x1f4,%eax
+    13c0:	74 61                	je     1423 <onefile+0x2aa>
+      error("couldn't read the bytes for iteration %d", i);
+    13c2:	8b 05 78 2e 00 00    	mov    0x2e78(%rip),%eax        # 4240 <stdout>
+    13c8:	ba f5 00 00 00       	mov    $0xf5,%edx
+    13cd:	48 8d 0d ae 20 00 00 	lea    0x20ae(%rip),%rcx        # 3482 <malloc+0x147>
+    13d4:	48 89 ce             	mov    %rcx,%rsi
+    13d7:	89 c7                	mov    %eax,%edi
+    13d9:	b8 00 00 00 00       	mov    $0x0,%eax
+    13de:	e8 6a 17 00 00       	call   2b4d <printf>
+    13e3:	8b 05 57 2e 00 00    	mov    0x2e57(%rip),%eax        # 4240 <stdout>
+    13e9:	8b 55 fc             	mov    -0x4(%rbp),%edx
+    13ec:	48 8d 0d 85 25 00 00 	lea    0x2585(%rip),%rcx        # 3978 <malloc+0x63d>
+    13f3:	48 89 ce             	mov    %rcx,%rsi
+    13f6:	89 c7                	mov    %eax,%edi
+    13f8:	b8 00 00 00 00       	mov    $0x0,%eax
+    13fd:	e8 4b 17 00 00       	call   2b4d <printf>
+    1402:	8b 05 38 2e 00 00    	mov    0x2e38(%rip),%eax        # 4240 <stdout>
+    1408:	48 8d 15 b6 20 00 00 	lea    0x20b6(%rip),%rdx        # 34c5 <malloc+0x18a>
+    140f:	48 89 d6             	mov    %rdx,%rsi
+    1412:	89 c7                	mov    %eax,%edi
+    1414:	b8 00 00 00 00       	mov    $0x0,%eax
+    1419:	e8 2f 17 00 00       	call   2b4d <printf>
+    141e:	e8 d1 1c 00 00       	call   30f4 <exit>
+
+    for (j = 0; j < 500; j++) {
+    1423:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+    142a:	eb 47                	jmp    1473 <onefile+0x2fa>
+      assert(i == buf[j]);
+    142c:	8b 45 f8             	mov    -0x8(%rbp),%eax
+    142f:	48 98                	cltq
+    1431:	48 8d 15 88 2e 00 00 	lea    0x2e88(%rip),%rdx        # 42c0 <buf>
+    1438:	0f b6 04 10          	movzbl (%rax,%rdx,1),%eax
+    143c:	0f be c0             	movsbl %al,%eax
+    143f:	39 45 fc             	cmp    %eax,-0x4(%rbp)
+    1442:	74 2b                	je     146f <onefile+0x2f6>
+    1444:	8b 05 f6 2d 00 00    	mov    0x2df6(%rip),%eax        # 4240 <stdout>
+    144a:	48 8d 15 50 25 00 00 	lea    0x2550(%rip),%rdx        # 39a1 <malloc+0x666>
+    1451:	48 89 d1             	mov    %rdx,%rcx
+    1454:	ba f8 00 00 00       	mov    $0xf8,%edx
+    1459:	48 8d 35 b0 22 00 00 	lea    0x22b0(%rip),%rsi        # 3710 <malloc+0x3d5>
+    1460:	89 c7                	mov    %eax,%edi
+    1462:	b8 00 00 00 00       	mov    $0x0,%eax
+    1467:	e8 e1 16 00 00       	call   2b4d <printf>
+    146c:	90                   	nop
+    146d:	eb fd                	jmp    146c <onefile+0x2f3>
+    for (j = 0; j < 500; j++) {
+    146f:	83 45 f8 01          	addl   $0x1,-0x8(%rbp)
+    1473:	81 7d f8 f3 01 00 00 	cmpl   $0x1f3,-0x8(%rbp)
+    147a:	7e b0                	jle    142c <onefile+0x2b3>
+  for (i = 0; i < 10; i++) {
+    147c:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+    1480:	83 7d fc 09          	cmpl   $0x9,-0x4(%rbp)
+    1484:	0f 8e 18 ff ff ff    	jle    13a2 <onefile+0x229>
+    }
+  }
+
+  printf(1, "onefile ok\n");
+    148a:	48 8d 05 1c 25 00 00 	lea    0x251c(%rip),%rax        # 39ad <malloc+0x672>
+    1491:	48 89 c6             	mov    %rax,%rsi
+    1494:	bf 01 00 00 00       	mov    $0x1,%edi
+    1499:	b8 00 00 00 00       	mov    $0x0,%eax
+    149e:	e8 aa 16 00 00       	call   2b4d <printf>
+}
+    14a3:	90                   	nop
+    14a4:	c9                   	leave
+    14a5:	c3                   	ret
+
+00000000000014a6 <fourfiles>:
+
+// four processes write different files at the same
+// time, to test concurrent block allocation.
+void fourfiles(void) {
+    14a6:	55                   	push   %rbp
+    14a7:	48 89 e5             	mov    %rsp,%rbp
+    14aa:	48 83 ec 50          	sub    $0x50,%rsp
+  int fd, pid, i, j, n, total, pi;
+  int num = 4;
+    14ae:	c7 45 ec 04 00 00 00 	movl   $0x4,-0x14(%rbp)
+  char *names[] = {"f0", "f1", "f2", "f3"};
+    14b5:	48 8d 05 fd 24 00 00 	lea    0x24fd(%rip),%rax        # 39b9 <malloc+0x67e>
+    14bc:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+    14c0:	48 8d 05 f5 24 00 00 	lea    0x24f5(%rip),%rax        # 39bc <malloc+0x681>
+    14c7:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+    14cb:	48 8d 05 ed 24 00 00 	lea    0x24ed(%rip),%rax        # 39bf <malloc+0x684>
+    14d2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+    14d6:	48 8d 05 e5 24 00 00 	lea    0x24e5(%rip),%rax        # 39c2 <malloc+0x687>
+    14dd:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  char *fname;
+
+  printf(1, "fourfiles...\n");
+    14e1:	48 8d 05 dd 24 00 00 	lea    0x24dd(%rip),%rax        # 39c5 <malloc+0x68a>
+    14e8:	48 89 c6             	mov    %rax,%rsi
+    14eb:	bf 01 00 00 00       	mov    $0x1,%edi
+    14f0:	b8 00 00 00 00       	mov    $0x0,%eax
+    14f5:	e8 53 16 00 00       	call   2b4d <printf>
+
+  for (pi = 0; pi < num; pi++) {
+    14fa:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%rbp)
+    1501:	e9 c1 01 00 00       	jmp    16c7 <fourfiles+0x221>
+    fname = names[pi];
+    1506:	8b 45 f0             	mov    -0x10(%rbp),%eax
+    1509:	48 98                	cltq
+    150b:	48 8b 44 c5 b0       	mov    -0x50(%rbp,%rax,8),%rax
+    1510:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    pid = fork();
+    1514:	e8 d3 1b 00 00       	call   30ec <fork>
+    1519:	89 45 d4             	mov    %eax,-0x2c(%rbp)
+    if (pid < 0) {
+    151c:	83 7d d4 00          	cmpl   $0x0,-0x2c(%rbp)
+    1520:	79 5e                	jns    1580 <fourfiles+0xda>
+      error("fork failed.");
+    1522:	8b 05 18 2d 00 00    	mov    0x2d18(%rip),%eax        # 4240 <stdout>
+    1528:	ba 0d 01 00 00       	mov    $0x10d,%edx
+    152d:	48 8d 0d 4e 1f 00 00 	lea    0x1f4e(%rip),%rcx        # 3482 <malloc+0x147>
+    1534:	48 89 ce             	mov    %rcx,%rsi
+    1537:	89 c7                	mov    %eax,%edi
+    1539:	b8 00 00 00 00       	mov    $0x0,%eax
+    153e:	e8 0a 16 00 00       	call   2b4d <printf>
+    1543:	8b 05 f7 2c 00 00    	mov    0x2cf7(%rip),%eax        # 4240 <stdout>
+    1549:	48 8d 15 83 24 00 00 	lea    0x2483(%rip),%rdx        # 39d3 <malloc+0x698>
+    1550:	48 89 d6             	mov    %rdx,%rsi
+    1553:	89 c7                	mov    %eax,%edi
+    1555:	b8 00 00 00 00       	mov    $0x0,%eax
+    155a:	e8 ee 15 00 00       	call   2b4d <printf>
+    155f:	8b 05 db 2c 00 00    	mov    0x2cdb(%rip),%eax        # 4240 <stdout>
+    1565:	48 8d 15 59 1f 00 00 	lea    0x1f59(%rip),%rdx        # 34c5 <malloc+0x18a>
+    156c:	48 89 d6             	mov    %rdx,%rsi
+    156f:	89 c7                	mov    %eax,%edi
+    1571:	b8 00 00 00 00       	mov    $0x0,%eax
+    1576:	e8 d2 15 00 00       	call   2b4d <printf>
+    157b:	e8 74 1b 00 00       	call   30f4 <exit>
+    }
+
+    if (pid == 0) {
+    1580:	83 7d d4 00          	cmpl   $0x0,-0x2c(%rbp)
+    1584:	0f 85 39 01 00 00    	jne    16c3 <fourfiles+0x21d>
+      fd = open(fname, O_CREATE | O_RDWR);
+    158a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    158e:	be 02 02 00 00       	mov    $0x202,%esi
+    1593:	48 89 c7             	mov    %rax,%rdi
+    1596:	e8 99 1b 00 00       	call   3134 <open>
+    159b:	89 45 dc             	mov    %eax,-0x24(%rbp)
+      if (fd < 0) {
+    159e:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+    15a2:	79 5e                	jns    1602 <fourfiles+0x15c>
+        error("create failed\n");
+    15a4:	8b 05 96 2c 00 00    	mov    0x2c96(%rip),%eax        # 4240 <stdout>
+    15aa:	ba 13 01 00 00       	mov    $0x113,%edx
+    15af:	48 8d 0d cc 1e 00 00 	lea    0x1ecc(%rip),%rcx        # 3482 <malloc+0x147>
+    15b6:	48 89 ce             	mov    %rcx,%rsi
+    15b9:	89 c7                	mov    %eax,%edi
+    15bb:	b8 00 00 00 00       	mov    $0x0,%eax
+    15c0:	e8 88 15 00 00       	call   2b4d <printf>
+    15c5:	8b 05 75 2c 00 00    	mov    0x2c75(%rip),%eax        # 4240 <stdout>
+    15cb:	48 8d 15 0e 24 00 00 	lea    0x240e(%rip),%rdx        # 39e0 <malloc+0x6a5>
+    15d2:	48 89 d6             	mov    %rdx,%rsi
+    15d5:	89 c7                	mov    %eax,%edi
+    15d7:	b8 00 00 00 00       	mov    $0x0,%eax
+    15dc:	e8 6c 15 00 00       	call   2b4d <printf>
+    15e1:	8b 05 59 2c 00 00    	mov    0x2c59(%rip),%eax        # 4240 <stdout>
+    15e7:	48 8d 15 d7 1e 00 00 	lea    0x1ed7(%rip),%rdx        # 34c5 <malloc+0x18a>
+    15ee:	48 89 d6             	mov    %rdx,%rsi
+    15f1:	89 c7                	mov    %eax,%edi
+    15f3:	b8 00 00 00 00       	mov    $0x0,%eax
+    15f8:	e8 50 15 00 00       	call   2b4d <printf>
+    15fd:	e8 f2 1a 00 00       	call   30f4 <exit>
+      }
+
+      memset(buf, '0' + pi, 512);
+    1602:	8b 45 f0             	mov    -0x10(%rbp),%eax
+    1605:	83 c0 30             	add    $0x30,%eax
+    1608:	ba 00 02 00 00       	mov    $0x200,%edx
+    160d:	89 c6                	mov    %eax,%esi
+    160f:	48 8d 05 aa 2c 00 00 	lea    0x2caa(%rip),%rax        # 42c0 <buf>
+    1616:	48 89 c7             	mov    %rax,%rdi
+    1619:	e8 ed 18 00 00       	call   2f0b <memset>
+      for (i = 0; i < 12; i++) {
+    161e:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+    1625:	e9 8a 00 00 00       	jmp    16b4 <fourfiles+0x20e>
+        if ((n = write(fd, buf, 500)) != 500) {
+    162a:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    162d:	ba f4 01 00 00       	mov    $0x1f4,%edx
+    1632:	48 8d 0d 87 2c 00 00 	lea    0x2c87(%rip),%rcx        # 42c0 <buf>
+    1639:	48 89 ce             	mov    %rcx,%rsi
+    163c:	89 c7                	mov    %eax,%edi
+    163e:	e8 d1 1a 00 00       	call   3114 <write>
+    1643:	89 45 d8             	mov    %eax,-0x28(%rbp)
+    1646:	81 7d d8 f4 01 00 00 	cmpl   $0x1f4,-0x28(%rbp)
+    164d:	74 61                	je     16b0 <fourfiles+0x20a>
+          error("write failed %d\n", n);
+    164f:	8b 05 eb 2b 00 00    	mov    0x2beb(%rip),%eax        # 4240 <stdout>
+    1655:	ba 19 01 00 00       	mov    $0x119,%edx
+    165a:	48 8d 0d 21 1e 00 00 	lea    0x1e21(%rip),%rcx        # 3482 <malloc+0x147>
+    1661:	48 89 ce             	mov    %rcx,%rsi
+    1664:	89 c7                	mov    %eax,%edi
+    1666:	b8 00 00 00 00       	mov    $0x0,%eax
+    166b:	e8 dd 14 00 00       	call   2b4d <printf>
+    1670:	8b 05 ca 2b 00 00    	mov    0x2bca(%rip),%eax        # 4240 <stdout>
+    1676:	8b 55 d8             	mov    -0x28(%rbp),%edx
+    1679:	48 8d 0d 6f 23 00 00 	lea    0x236f(%rip),%rcx        # 39ef <malloc+0x6b4>
+    1680:	48 89 ce             	mov    %rcx,%rsi
+    1683:	89 c7                	mov    %eax,%edi
+    1685:	b8 00 00 00 00       	mov    $0x0,%eax
+    168a:	e8 be 14 00 00       	call   2b4d <printf>
+    168f:	8b 05 ab 2b 00 00    	mov    0x2bab(%rip),%eax        # 4240 <stdout>
+    1695:	48 8d 15 29 1e 00 00 	lea    0x1e29(%rip),%rdx        # 34c5 <malloc+0x18a>
+    169c:	48 89 d6             	mov    %rdx,%rsi
+    169f:	89 c7                	mov    %eax,%edi
+    16a1:	b8 00 00 00 00       	mov    $0x0,%eax
+    16a6:	e8 a2 14 00 00       	call   2b4d <printf>
+    16ab:	e8 44 1a 00 00       	call   30f4 <exit>
+      for (i = 0; i < 12; i++) {
+    16b0:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+    16b4:	83 7d fc 0b          	cmpl   $0xb,-0x4(%rbp)
+    16b8:	0f 8e 6c ff ff ff    	jle    162a <fourfiles+0x184>
+        }
+      }
+      exit();
+    16be:	e8 31 1a 00 00       	call   30f4 <exit>
+  for (pi = 0; pi < num; pi++) {
+    16c3:	83 45 f0 01          	addl   $0x1,-0x10(%rbp)
+    16c7:	8b 45 f0             	mov    -0x10(%rbp),%eax
+    16ca:	3b 45 ec             	cmp    -0x14(%rbp),%eax
+    16cd:	0f 8c 33 fe ff ff    	jl     1506 <fourfiles+0x60>
+    }
+  }
+
+  for (pi = 0; pi < num; pi++) {
+    16d3:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%rbp)
+    16da:	eb 09                	jmp    16e5 <fourfiles+0x23f>
+    wait();
+    16dc:	e8 1b 1a 00 00       	call   30fc <wait>
+  for (pi = 0; pi < num; pi++) {
+    16e1:	83 45 f0 01          	addl   $0x1,-0x10(%rbp)
+    16e5:	8b 45 f0             	mov    -0x10(%rbp),%eax
+    16e8:	3b 45 ec             	cmp    -0x14(%rbp),%eax
+    16eb:	7c ef                	jl     16dc <fourfiles+0x236>
+  }
+
+  for (i = 0; i < num; i++) {
+    16ed:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+    16f4:	e9 ef 01 00 00       	jmp    18e8 <fourfiles+0x442>
+    fname = names[i];
+    16f9:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    16fc:	48 98                	cltq
+    16fe:	48 8b 44 c5 b0       	mov    -0x50(%rbp,%rax,8),%rax
+    1703:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    fd = open(fname, O_RDONLY);
+    1707:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    170b:	be 00 00 00 00       	mov    $0x0,%esi
+    1710:	48 89 c7             	mov    %rax,%rdi
+    1713:	e8 1c 1a 00 00       	call   3134 <open>
+    1718:	89 45 dc             	mov    %eax,-0x24(%rbp)
+    if (fd < 0) {
+    171b:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+    171f:	79 62                	jns    1783 <fourfiles+0x2dd>
+      error("file open failed for fname=%s\n", fname);
+    1721:	8b 05 19 2b 00 00    	mov    0x2b19(%rip),%eax        # 4240 <stdout>
+    1727:	ba 28 01 00 00       	mov    $0x128,%edx
+    172c:	48 8d 0d 4f 1d 00 00 	lea    0x1d4f(%rip),%rcx        # 3482 <malloc+0x147>
+    1733:	48 89 ce             	mov    %rcx,%rsi
+    1736:	89 c7                	mov    %eax,%edi
+    1738:	b8 00 00 00 00       	mov    $0x0,%eax
+    173d:	e8 0b 14 00 00       	call   2b4d <printf>
+    1742:	8b 05 f8 2a 00 00    	mov    0x2af8(%rip),%eax        # 4240 <stdout>
+    1748:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    174c:	48 8d 0d ad 22 00 00 	lea    0x22ad(%rip),%rcx        # 3a00 <malloc+0x6c5>
+    1753:	48 89 ce             	mov    %rcx,%rsi
+    1756:	89 c7                	mov    %eax,%edi
+    1758:	b8 00 00 00 00       	mov    $0x0,%eax
+    175d:	e8 eb 13 00 00       	call   2b4d <printf>
+    1762:	8b 05 d8 2a 00 00    	mov    0x2ad8(%rip),%eax        # 4240 <stdout>
+    1768:	48 8d 15 56 1d 00 00 	lea    0x1d56(%rip),%rdx        # 34c5 <malloc+0x18a>
+    176f:	48 89 d6             	mov    %rdx,%rsi
+    1772:	89 c7                	mov    %eax,%edi
+    1774:	b8 00 00 00 00       	mov    $0x0,%eax
+    1779:	e8 cf 13 00 00       	call   2b4d <printf>
+    177e:	e8 71 19 00 00       	call   30f4 <exit>
+    }
+    total = 0;
+    1783:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+    while ((n = read(fd, buf, sizeof(buf))) > 0) {
+    178a:	e9 b3 00 00 00       	jmp    1842 <fourfiles+0x39c>
+      for (j = 0; j < n; j++) {
+    178f:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+    1796:	e9 95 00 00 00       	jmp    1830 <fourfiles+0x38a>
+        if (buf[j] != '0' + i) {
+    179b:	8b 45 f8             	mov    -0x8(%rbp),%eax
+    179e:	48 98                	cltq
+    17a0:	48 8d 15 19 2b 00 00 	lea    0x2b19(%rip),%rdx        # 42c0 <buf>
+    17a7:	0f b6 04 10          	movzbl (%rax,%rdx,1),%eax
+    17ab:	0f be d0             	movsbl %al,%edx
+    17ae:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    17b1:	83 c0 30             	add    $0x30,%eax
+    17b4:	39 c2                	cmp    %eax,%edx
+    17b6:	74 74                	je     182c <fourfiles+0x386>
+          error("wrong char, was %d should be %d\n", buf[j], '0' + i);
+    17b8:	8b 05 82 2a 00 00    	mov    0x2a82(%rip),%eax        # 4240 <stdout>
+    17be:	ba 2e 01 00 00       	mov    $0x12e,%edx
+    17c3:	48 8d 0d b8 1c 00 00 	lea    0x1cb8(%rip),%rcx        # 3482 <malloc+0x147>
+    17ca:	48 89 ce             	mov    %rcx,%rsi
+    17cd:	89 c7                	mov    %eax,%edi
+    17cf:	b8 00 00 00 00       	mov    $0x0,%eax
+    17d4:	e8 74 13 00 00       	call   2b4d <printf>
+    17d9:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    17dc:	8d 48 30             	lea    0x30(%rax),%ecx
+    17df:	8b 45 f8             	mov    -0x8(%rbp),%eax
+    17e2:	48 98                	cltq
+    17e4:	48 8d 15 d5 2a 00 00 	lea    0x2ad5(%rip),%rdx        # 42c0 <buf>
+    17eb:	0f b6 04 10          	movzbl (%rax,%rdx,1),%eax
+    17ef:	0f be d0             	movsbl %al,%edx
+    17f2:	8b 05 48 2a 00 00    	mov    0x2a48(%rip),%eax        # 4240 <stdout>
+    17f8:	48 8d 35 21 22 00 00 	lea    0x2221(%rip),%rsi        # 3a20 <malloc+0x6e5>
+    17ff:	89 c7                	mov    %eax,%edi
+    1801:	b8 00 00 00 00       	mov    $0x0,%eax
+    1806:	e8 42 13 00 00       	call   2b4d <printf>
+    180b:	8b 05 2f 2a 00 00    	mov    0x2a2f(%rip),%eax        # 4240 <stdout>
+    1811:	48 8d 15 ad 1c 00 00 	lea    0x1cad(%rip),%rdx        # 34c5 <malloc+0x18a>
+    1818:	48 89 d6             	mov    %rdx,%rsi
+    181b:	89 c7                	mov    %eax,%edi
+    181d:	b8 00 00 00 00       	mov    $0x0,%eax
+    1822:	e8 26 13 00 00       	call   2b4d <printf>
+    1827:	e8 c8 18 00 00       	call   30f4 <exit>
+      for (j = 0; j < n; j++) {
+    182c:	83 45 f8 01          	addl   $0x1,-0x8(%rbp)
+    1830:	8b 45 f8             	mov    -0x8(%rbp),%eax
+    1833:	3b 45 d8             	cmp    -0x28(%rbp),%eax
+    1836:	0f 8c 5f ff ff ff    	jl     179b <fourfiles+0x2f5>
+        }
+      }
+      total += n;
+    183c:	8b 45 d8             	mov    -0x28(%rbp),%eax
+    183f:	01 45 f4             	add    %eax,-0xc(%rbp)
+    while ((n = read(fd, buf, sizeof(buf))) > 0) {
+    1842:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1845:	ba 00 20 00 00       	mov    $0x2000,%edx
+    184a:	48 8d 0d 6f 2a 00 00 	lea    0x2a6f(%rip),%rcx        # 42c0 <buf>
+    1851:	48 89 ce             	mov    %rcx,%rsi
+    1854:	89 c7                	mov    %eax,%edi
+    1856:	e8 b1 18 00 00       	call   310c <read>
+    185b:	89 45 d8             	mov    %eax,-0x28(%rbp)
+    185e:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+    1862:	0f 8f 27 ff ff ff    	jg     178f <fourfiles+0x2e9>
+    }
+    close(fd);
+    1868:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    186b:	89 c7                	mov    %eax,%edi
+    186d:	e8 aa 18 00 00       	call   311c <close>
+    if (total != 12 * 500) {
+    1872:	81 7d f4 70 17 00 00 	cmpl   $0x1770,-0xc(%rbp)
+    1879:	74 69                	je     18e4 <fourfiles+0x43e>
+      error("wrong length i:%d, wanted:%d, %d\n", i, 12 * 500, total);
+    187b:	8b 05 bf 29 00 00    	mov    0x29bf(%rip),%eax        # 4240 <stdout>
+    1881:	ba 35 01 00 00       	mov    $0x135,%edx
+    1886:	48 8d 0d f5 1b 00 00 	lea    0x1bf5(%rip),%rcx        # 3482 <malloc+0x147>
+    188d:	48 89 ce             	mov    %rcx,%rsi
+    1890:	89 c7                	mov    %eax,%edi
+    1892:	b8 00 00 00 00       	mov    $0x0,%eax
+    1897:	e8 b1 12 00 00       	call   2b4d <printf>
+    189c:	8b 05 9e 29 00 00    	mov    0x299e(%rip),%eax        # 4240 <stdout>
+    18a2:	8b 4d f4             	mov    -0xc(%rbp),%ecx
+    18a5:	8b 55 fc             	mov    -0x4(%rbp),%edx
+    18a8:	41 89 c8             	mov    %ecx,%r8d
+    18ab:	b9 70 17 00 00       	mov    $0x1770,%ecx
+    18b0:	48 8d 35 91 21 00 00 	lea    0x2191(%rip),%rsi        # 3a48 <malloc+0x70d>
+    18b7:	89 c7                	mov    %eax,%edi
+    18b9:	b8 00 00 00 00       	mov    $0x0,%eax
+    18be:	e8 8a 12 00 00       	call   2b4d <printf>
+    18c3:	8b 05 77 29 00 00    	mov    0x2977(%rip),%eax        # 4240 <stdout>
+    18c9:	48 8d 15 f5 1b 00 00 	lea    0x1bf5(%rip),%rdx        # 34c5 <malloc+0x18a>
+    18d0:	48 89 d6             	mov    %rdx,%rsi
+    18d3:	89 c7                	mov    %eax,%edi
+    18d5:	b8 00 00 00 00       	mov    $0x0,%eax
+    18da:	e8 6e 12 00 00       	call   2b4d <printf>
+    18df:	e8 10 18 00 00       	call   30f4 <exit>
+  for (i = 0; i < num; i++) {
+    18e4:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+    18e8:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    18eb:	3b 45 ec             	cmp    -0x14(%rbp),%eax
+    18ee:	0f 8c 05 fe ff ff    	jl     16f9 <fourfiles+0x253>
+    }
+  }
+
+  printf(1, "fourfiles ok\n");
+    18f4:	48 8d 05 6f 21 00 00 	lea    0x216f(%rip),%rax        # 3a6a <malloc+0x72f>
+    18fb:	48 89 c6             	mov    %rax,%rsi
+    18fe:	bf 01 00 00 00       	mov    $0x1,%edi
+    1903:	b8 00 00 00 00       	mov    $0x0,%eax
+    1908:	e8 40 12 00 00       	call   2b4d <printf>
+}
+    190d:	90                   	nop
+    190e:	c9                   	leave
+    190f:	c3                   	ret
+
+0000000000001910 <simpledelete>:
+
+void simpledelete() {
+    1910:	55                   	push   %rbp
+    1911:	48 89 e5             	mov    %rsp,%rbp
+    1914:	48 83 ec 70          	sub    $0x70,%rsp
+  printf(1, "Starting delete test...\n");
+    1918:	48 8d 05 59 21 00 00 	lea    0x2159(%rip),%rax        # 3a78 <malloc+0x73d>
+    191f:	48 89 c6             	mov    %rax,%rsi
+    1922:	bf 01 00 00 00       	mov    $0x1,%edi
+    1927:	b8 00 00 00 00       	mov    $0x0,%eax
+    192c:	e8 1c 12 00 00       	call   2b4d <printf>
+  // Check a couple cases of things you should never be able to delete
+  if (unlink("file_not_existing") != -1) {
+    1931:	48 8d 05 59 21 00 00 	lea    0x2159(%rip),%rax        # 3a91 <malloc+0x756>
+    1938:	48 89 c7             	mov    %rax,%rdi
+    193b:	e8 04 18 00 00       	call   3144 <unlink>
+    1940:	83 f8 ff             	cmp    $0xffffffff,%eax
+    1943:	74 5e                	je     19a3 <simpledelete+0x93>
+    error("Able to delete file that doesn't exist");
+    1945:	8b 05 f5 28 00 00    	mov    0x28f5(%rip),%eax        # 4240 <stdout>
+    194b:	ba 40 01 00 00       	mov    $0x140,%edx
+    1950:	48 8d 0d 2b 1b 00 00 	lea    0x1b2b(%rip),%rcx        # 3482 <malloc+0x147>
+    1957:	48 89 ce             	mov    %rcx,%rsi
+    195a:	89 c7                	mov    %eax,%edi
+    195c:	b8 00 00 00 00       	mov    $0x0,%eax
+    1961:	e8 e7 11 00 00       	call   2b4d <printf>
+    1966:	8b 05 d4 28 00 00    	mov    0x28d4(%rip),%eax        # 4240 <stdout>
+    196c:	48 8d 15 35 21 00 00 	lea    0x2135(%rip),%rdx        # 3aa8 <malloc+0x76d>
+    1973:	48 89 d6             	mov    %rdx,%rsi
+    1976:	89 c7                	mov    %eax,%edi
+    1978:	b8 00 00 00 00       	mov    $0x0,%eax
+    197d:	e8 cb 11 00 00       	call   2b4d <printf>
+    1982:	8b 05 b8 28 00 00    	mov    0x28b8(%rip),%eax        # 4240 <stdout>
+    1988:	48 8d 15 36 1b 00 00 	lea    0x1b36(%rip),%rdx        # 34c5 <malloc+0x18a>
+    198f:	48 89 d6             	mov    %rdx,%rsi
+    1992:	89 c7                	mov    %eax,%edi
+    1994:	b8 00 00 00 00       	mov    $0x0,%eax
+    1999:	e8 af 11 00 00       	call   2b4d <printf>
+    199e:	e8 51 17 00 00       	call   30f4 <exit>
+  }
+  if (unlink("..") != -1 || unlink(".") != -1)
+    19a3:	48 8d 05 25 21 00 00 	lea    0x2125(%rip),%rax        # 3acf <malloc+0x794>
+    19aa:	48 89 c7             	mov    %rax,%rdi
+    19ad:	e8 92 17 00 00       	call   3144 <unlink>
+    19b2:	83 f8 ff             	cmp    $0xffffffff,%eax
+    19b5:	75 14                	jne    19cb <simpledelete+0xbb>
+    19b7:	48 8d 05 14 21 00 00 	lea    0x2114(%rip),%rax        # 3ad2 <malloc+0x797>
+    19be:	48 89 c7             	mov    %rax,%rdi
+    19c1:	e8 7e 17 00 00       	call   3144 <unlink>
+    19c6:	83 f8 ff             	cmp    $0xffffffff,%eax
+    19c9:	74 5e                	je     1a29 <simpledelete+0x119>
+    error("Able to unlink directories");
+    19cb:	8b 05 6f 28 00 00    	mov    0x286f(%rip),%eax        # 4240 <stdout>
+    19d1:	ba 43 01 00 00       	mov    $0x143,%edx
+    19d6:	48 8d 0d a5 1a 00 00 	lea    0x1aa5(%rip),%rcx        # 3482 <malloc+0x147>
+    19dd:	48 89 ce             	mov    %rcx,%rsi
+    19e0:	89 c7                	mov    %eax,%edi
+    19e2:	b8 00 00 00 00       	mov    $0x0,%eax
+    19e7:	e8 61 11 00 00       	call   2b4d <printf>
+    19ec:	8b 05 4e 28 00 00    	mov    0x284e(%rip),%eax        # 4240 <stdout>
+    19f2:	48 8d 15 db 20 00 00 	lea    0x20db(%rip),%rdx        # 3ad4 <malloc+0x799>
+    19f9:	48 89 d6             	mov    %rdx,%rsi
+    19fc:	89 c7                	mov    %eax,%edi
+    19fe:	b8 00 00 00 00       	mov    $0x0,%eax
+    1a03:	e8 45 11 00 00       	call   2b4d <printf>
+    1a08:	8b 05 32 28 00 00    	mov    0x2832(%rip),%eax        # 4240 <stdout>
+    1a0e:	48 8d 15 b0 1a 00 00 	lea    0x1ab0(%rip),%rdx        # 34c5 <malloc+0x18a>
+    1a15:	48 89 d6             	mov    %rdx,%rsi
+    1a18:	89 c7                	mov    %eax,%edi
+    1a1a:	b8 00 00 00 00       	mov    $0x0,%eax
+    1a1f:	e8 29 11 00 00       	call   2b4d <printf>
+    1a24:	e8 cb 16 00 00       	call   30f4 <exit>
+
+  // Can't delete open file (in this process or another)
+  char* name = "some_other_file";
+    1a29:	48 8d 05 bf 20 00 00 	lea    0x20bf(%rip),%rax        # 3aef <malloc+0x7b4>
+    1a30:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  int fd = open(name, O_RDWR | O_CREATE);
+    1a34:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1a38:	be 02 02 00 00       	mov    $0x202,%esi
+    1a3d:	48 89 c7             	mov    %rax,%rdi
+    1a40:	e8 ef 16 00 00       	call   3134 <open>
+    1a45:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  if (fd == -1)
+    1a48:	83 7d ec ff          	cmpl   $0xffffffff,-0x14(%rbp)
+    1a4c:	75 5e                	jne    1aac <simpledelete+0x19c>
+    error("Unable to create file");
+    1a4e:	8b 05 ec 27 00 00    	mov    0x27ec(%rip),%eax        # 4240 <stdout>
+    1a54:	ba 49 01 00 00       	mov    $0x149,%edx
+    1a59:	48 8d 0d 22 1a 00 00 	lea    0x1a22(%rip),%rcx        # 3482 <malloc+0x147>
+    1a60:	48 89 ce             	mov    %rcx,%rsi
+    1a63:	89 c7                	mov    %eax,%edi
+    1a65:	b8 00 00 00 00       	mov    $0x0,%eax
+    1a6a:	e8 de 10 00 00       	call   2b4d <printf>
+    1a6f:	8b 05 cb 27 00 00    	mov    0x27cb(%rip),%eax        # 4240 <stdout>
+    1a75:	48 8d 15 83 20 00 00 	lea    0x2083(%rip),%rdx        # 3aff <malloc+0x7c4>
+    1a7c:	48 89 d6             	mov    %rdx,%rsi
+    1a7f:	89 c7                	mov    %eax,%edi
+    1a81:	b8 00 00 00 00       	mov    $0x0,%eax
+    1a86:	e8 c2 10 00 00       	call   2b4d <printf>
+    1a8b:	8b 05 af 27 00 00    	mov    0x27af(%rip),%eax        # 4240 <stdout>
+    1a91:	48 8d 15 2d 1a 00 00 	lea    0x1a2d(%rip),%rdx        # 34c5 <malloc+0x18a>
+    1a98:	48 89 d6             	mov    %rdx,%rsi
+    1a9b:	89 c7                	mov    %eax,%edi
+    1a9d:	b8 00 00 00 00       	mov    $0x0,%eax
+    1aa2:	e8 a6 10 00 00       	call   2b4d <printf>
+    1aa7:	e8 48 16 00 00       	call   30f4 <exit>
+  if (unlink(name) != -1)
+    1aac:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1ab0:	48 89 c7             	mov    %rax,%rdi
+    1ab3:	e8 8c 16 00 00       	call   3144 <unlink>
+    1ab8:	83 f8 ff             	cmp    $0xffffffff,%eax
+    1abb:	74 5e                	je     1b1b <simpledelete+0x20b>
+    error("Able to delete file that's currently open");
+    1abd:	8b 05 7d 27 00 00    	mov    0x277d(%rip),%eax        # 4240 <stdout>
+    1ac3:	ba 4b 01 00 00       	mov    $0x14b,%edx
+    1ac8:	48 8d 0d b3 19 00 00 	lea    0x19b3(%rip),%rcx        # 3482 <malloc+0x147>
+    1acf:	48 89 ce             	mov    %rcx,%rsi
+    1ad2:	89 c7                	mov    %eax,%edi
+    1ad4:	b8 00 00 00 00       	mov    $0x0,%eax
+    1ad9:	e8 6f 10 00 00       	call   2b4d <printf>
+    1ade:	8b 05 5c 27 00 00    	mov    0x275c(%rip),%eax        # 4240 <stdout>
+    1ae4:	48 8d 15 2d 20 00 00 	lea    0x202d(%rip),%rdx        # 3b18 <malloc+0x7dd>
+    1aeb:	48 89 d6             	mov    %rdx,%rsi
+    1aee:	89 c7                	mov    %eax,%edi
+    1af0:	b8 00 00 00 00       	mov    $0x0,%eax
+    1af5:	e8 53 10 00 00       	call   2b4d <printf>
+    1afa:	8b 05 40 27 00 00    	mov    0x2740(%rip),%eax        # 4240 <stdout>
+    1b00:	48 8d 15 be 19 00 00 	lea    0x19be(%rip),%rdx        # 34c5 <malloc+0x18a>
+    1b07:	48 89 d6             	mov    %rdx,%rsi
+    1b0a:	89 c7                	mov    %eax,%edi
+    1b0c:	b8 00 00 00 00       	mov    $0x0,%eax
+    1b11:	e8 37 10 00 00       	call   2b4d <printf>
+    1b16:	e8 d9 15 00 00       	call   30f4 <exit>
+  if (close(fd) == -1)
+    1b1b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    1b1e:	89 c7                	mov    %eax,%edi
+    1b20:	e8 f7 15 00 00       	call   311c <close>
+    1b25:	83 f8 ff             	cmp    $0xffffffff,%eax
+    1b28:	75 5e                	jne    1b88 <simpledelete+0x278>
+      error("Unable to close file");
+    1b2a:	8b 05 10 27 00 00    	mov    0x2710(%rip),%eax        # 4240 <stdout>
+    1b30:	ba 4d 01 00 00       	mov    $0x14d,%edx
+    1b35:	48 8d 0d 46 19 00 00 	lea    0x1946(%rip),%rcx        # 3482 <malloc+0x147>
+    1b3c:	48 89 ce             	mov    %rcx,%rsi
+    1b3f:	89 c7                	mov    %eax,%edi
+    1b41:	b8 00 00 00 00       	mov    $0x0,%eax
+    1b46:	e8 02 10 00 00       	call   2b4d <printf>
+    1b4b:	8b 05 ef 26 00 00    	mov    0x26ef(%rip),%eax        # 4240 <stdout>
+    1b51:	48 8d 15 ea 1f 00 00 	lea    0x1fea(%rip),%rdx        # 3b42 <malloc+0x807>
+    1b58:	48 89 d6             	mov    %rdx,%rsi
+    1b5b:	89 c7                	mov    %eax,%edi
+    1b5d:	b8 00 00 00 00       	mov    $0x0,%eax
+    1b62:	e8 e6 0f 00 00       	call   2b4d <printf>
+    1b67:	8b 05 d3 26 00 00    	mov    0x26d3(%rip),%eax        # 4240 <stdout>
+    1b6d:	48 8d 15 51 19 00 00 	lea    0x1951(%rip),%rdx        # 34c5 <malloc+0x18a>
+    1b74:	48 89 d6             	mov    %rdx,%rsi
+    1b77:	89 c7                	mov    %eax,%edi
+    1b79:	b8 00 00 00 00       	mov    $0x0,%eax
+    1b7e:	e8 ca 0f 00 00       	call   2b4d <printf>
+    1b83:	e8 6c 15 00 00       	call   30f4 <exit>
+
+  int pid = fork();
+    1b88:	e8 5f 15 00 00       	call   30ec <fork>
+    1b8d:	89 45 e8             	mov    %eax,-0x18(%rbp)
+  if (pid == 0) {
+    1b90:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+    1b94:	75 20                	jne    1bb6 <simpledelete+0x2a6>
+    open(name, O_RDWR);
+    1b96:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1b9a:	be 02 00 00 00       	mov    $0x2,%esi
+    1b9f:	48 89 c7             	mov    %rax,%rdi
+    1ba2:	e8 8d 15 00 00       	call   3134 <open>
+    sleep(999999999);
+    1ba7:	bf ff c9 9a 3b       	mov    $0x3b9ac9ff,%edi
+    1bac:	e8 d3 15 00 00       	call   3184 <sleep>
+    exit();
+    1bb1:	e8 3e 15 00 00       	call   30f4 <exit>
+  } else {
+    sleep(20); // Should be enough time
+    1bb6:	bf 14 00 00 00       	mov    $0x14,%edi
+    1bbb:	e8 c4 15 00 00       	call   3184 <sleep>
+    if (unlink(name) != -1)
+    1bc0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1bc4:	48 89 c7             	mov    %rax,%rdi
+    1bc7:	e8 78 15 00 00       	call   3144 <unlink>
+    1bcc:	83 f8 ff             	cmp    $0xffffffff,%eax
+    1bcf:	74 5e                	je     1c2f <simpledelete+0x31f>
+      error("Able to delete file that's open in another process");
+    1bd1:	8b 05 69 26 00 00    	mov    0x2669(%rip),%eax        # 4240 <stdout>
+    1bd7:	ba 57 01 00 00       	mov    $0x157,%edx
+    1bdc:	48 8d 0d 9f 18 00 00 	lea    0x189f(%rip),%rcx        # 3482 <malloc+0x147>
+    1be3:	48 89 ce             	mov    %rcx,%rsi
+    1be6:	89 c7                	mov    %eax,%edi
+    1be8:	b8 00 00 00 00       	mov    $0x0,%eax
+    1bed:	e8 5b 0f 00 00       	call   2b4d <printf>
+    1bf2:	8b 05 48 26 00 00    	mov    0x2648(%rip),%eax        # 4240 <stdout>
+    1bf8:	48 8d 15 59 1f 00 00 	lea    0x1f59(%rip),%rdx        # 3b58 <malloc+0x81d>
+    1bff:	48 89 d6             	mov    %rdx,%rsi
+    1c02:	89 c7                	mov    %eax,%edi
+    1c04:	b8 00 00 00 00       	mov    $0x0,%eax
+    1c09:	e8 3f 0f 00 00       	call   2b4d <printf>
+    1c0e:	8b 05 2c 26 00 00    	mov    0x262c(%rip),%eax        # 4240 <stdout>
+    1c14:	48 8d 15 aa 18 00 00 	lea    0x18aa(%rip),%rdx        # 34c5 <malloc+0x18a>
+    1c1b:	48 89 d6             	mov    %rdx,%rsi
+    1c1e:	89 c7                	mov    %eax,%edi
+    1c20:	b8 00 00 00 00       	mov    $0x0,%eax
+    1c25:	e8 23 0f 00 00       	call   2b4d <printf>
+    1c2a:	e8 c5 14 00 00       	call   30f4 <exit>
+    kill(pid);
+    1c2f:	8b 45 e8             	mov    -0x18(%rbp),%eax
+    1c32:	89 c7                	mov    %eax,%edi
+    1c34:	e8 eb 14 00 00       	call   3124 <kill>
+    wait();
+    1c39:	e8 be 14 00 00       	call   30fc <wait>
+  }
+  if (unlink(name) == -1)
+    1c3e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1c42:	48 89 c7             	mov    %rax,%rdi
+    1c45:	e8 fa 14 00 00       	call   3144 <unlink>
+    1c4a:	83 f8 ff             	cmp    $0xffffffff,%eax
+    1c4d:	75 5e                	jne    1cad <simpledelete+0x39d>
+    error("Unable to delete file once all references closed");
+    1c4f:	8b 05 eb 25 00 00    	mov    0x25eb(%rip),%eax        # 4240 <stdout>
+    1c55:	ba 5c 01 00 00       	mov    $0x15c,%edx
+    1c5a:	48 8d 0d 21 18 00 00 	lea    0x1821(%rip),%rcx        # 3482 <malloc+0x147>
+    1c61:	48 89 ce             	mov    %rcx,%rsi
+    1c64:	89 c7                	mov    %eax,%edi
+    1c66:	b8 00 00 00 00       	mov    $0x0,%eax
+    1c6b:	e8 dd 0e 00 00       	call   2b4d <printf>
+    1c70:	8b 05 ca 25 00 00    	mov    0x25ca(%rip),%eax        # 4240 <stdout>
+    1c76:	48 8d 15 13 1f 00 00 	lea    0x1f13(%rip),%rdx        # 3b90 <malloc+0x855>
+    1c7d:	48 89 d6             	mov    %rdx,%rsi
+    1c80:	89 c7                	mov    %eax,%edi
+    1c82:	b8 00 00 00 00       	mov    $0x0,%eax
+    1c87:	e8 c1 0e 00 00       	call   2b4d <printf>
+    1c8c:	8b 05 ae 25 00 00    	mov    0x25ae(%rip),%eax        # 4240 <stdout>
+    1c92:	48 8d 15 2c 18 00 00 	lea    0x182c(%rip),%rdx        # 34c5 <malloc+0x18a>
+    1c99:	48 89 d6             	mov    %rdx,%rsi
+    1c9c:	89 c7                	mov    %eax,%edi
+    1c9e:	b8 00 00 00 00       	mov    $0x0,%eax
+    1ca3:	e8 a5 0e 00 00       	call   2b4d <printf>
+    1ca8:	e8 47 14 00 00       	call   30f4 <exit>
+  if (open(name, O_RDWR) != -1)
+    1cad:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1cb1:	be 02 00 00 00       	mov    $0x2,%esi
+    1cb6:	48 89 c7             	mov    %rax,%rdi
+    1cb9:	e8 76 14 00 00       	call   3134 <open>
+    1cbe:	83 f8 ff             	cmp    $0xffffffff,%eax
+    1cc1:	74 5e                	je     1d21 <simpledelete+0x411>
+    error("Able to open already-deleted file");
+    1cc3:	8b 05 77 25 00 00    	mov    0x2577(%rip),%eax        # 4240 <stdout>
+    1cc9:	ba 5e 01 00 00       	mov    $0x15e,%edx
+    1cce:	48 8d 0d ad 17 00 00 	lea    0x17ad(%rip),%rcx        # 3482 <malloc+0x147>
+    1cd5:	48 89 ce             	mov    %rcx,%rsi
+    1cd8:	89 c7                	mov    %eax,%edi
+    1cda:	b8 00 00 00 00       	mov    $0x0,%eax
+    1cdf:	e8 69 0e 00 00       	call   2b4d <printf>
+    1ce4:	8b 05 56 25 00 00    	mov    0x2556(%rip),%eax        # 4240 <stdout>
+    1cea:	48 8d 15 d7 1e 00 00 	lea    0x1ed7(%rip),%rdx        # 3bc8 <malloc+0x88d>
+    1cf1:	48 89 d6             	mov    %rdx,%rsi
+    1cf4:	89 c7                	mov    %eax,%edi
+    1cf6:	b8 00 00 00 00       	mov    $0x0,%eax
+    1cfb:	e8 4d 0e 00 00       	call   2b4d <printf>
+    1d00:	8b 05 3a 25 00 00    	mov    0x253a(%rip),%eax        # 4240 <stdout>
+    1d06:	48 8d 15 b8 17 00 00 	lea    0x17b8(%rip),%rdx        # 34c5 <malloc+0x18a>
+    1d0d:	48 89 d6             	mov    %rdx,%rsi
+    1d10:	89 c7                	mov    %eax,%edi
+    1d12:	b8 00 00 00 00       	mov    $0x0,%eax
+    1d17:	e8 31 0e 00 00       	call   2b4d <printf>
+    1d1c:	e8 d3 13 00 00       	call   30f4 <exit>
+
+  printf(1, "  delete open ok\n");
+    1d21:	48 8d 05 c2 1e 00 00 	lea    0x1ec2(%rip),%rax        # 3bea <malloc+0x8af>
+    1d28:	48 89 c6             	mov    %rax,%rsi
+    1d2b:	bf 01 00 00 00       	mov    $0x1,%edi
+    1d30:	b8 00 00 00 00       	mov    $0x0,%eax
+    1d35:	e8 13 0e 00 00       	call   2b4d <printf>
+
+  // Make sure deleting one file doesn't interfere with other open ones
+  char* n1 = "small.txt";
+    1d3a:	48 8d 05 37 17 00 00 	lea    0x1737(%rip),%rax        # 3478 <malloc+0x13d>
+    1d41:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  char* n2 = "arbitrary";
+    1d45:	48 8d 05 b0 1e 00 00 	lea    0x1eb0(%rip),%rax        # 3bfc <malloc+0x8c1>
+    1d4c:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  int fdn1 = open(n1, O_RDWR);
+    1d50:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1d54:	be 02 00 00 00       	mov    $0x2,%esi
+    1d59:	48 89 c7             	mov    %rax,%rdi
+    1d5c:	e8 d3 13 00 00       	call   3134 <open>
+    1d61:	89 45 d4             	mov    %eax,-0x2c(%rbp)
+  int fdn2 = open(n2, O_RDWR | O_CREATE);
+    1d64:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    1d68:	be 02 02 00 00       	mov    $0x202,%esi
+    1d6d:	48 89 c7             	mov    %rax,%rdi
+    1d70:	e8 bf 13 00 00       	call   3134 <open>
+    1d75:	89 45 d0             	mov    %eax,-0x30(%rbp)
+  if (fdn1 == -1 || fdn2 == -1)
+    1d78:	83 7d d4 ff          	cmpl   $0xffffffff,-0x2c(%rbp)
+    1d7c:	74 06                	je     1d84 <simpledelete+0x474>
+    1d7e:	83 7d d0 ff          	cmpl   $0xffffffff,-0x30(%rbp)
+    1d82:	75 5e                	jne    1de2 <simpledelete+0x4d2>
+    error("error opening files");
+    1d84:	8b 05 b6 24 00 00    	mov    0x24b6(%rip),%eax        # 4240 <stdout>
+    1d8a:	ba 68 01 00 00       	mov    $0x168,%edx
+    1d8f:	48 8d 0d ec 16 00 00 	lea    0x16ec(%rip),%rcx        # 3482 <malloc+0x147>
+    1d96:	48 89 ce             	mov    %rcx,%rsi
+    1d99:	89 c7                	mov    %eax,%edi
+    1d9b:	b8 00 00 00 00       	mov    $0x0,%eax
+    1da0:	e8 a8 0d 00 00       	call   2b4d <printf>
+    1da5:	8b 05 95 24 00 00    	mov    0x2495(%rip),%eax        # 4240 <stdout>
+    1dab:	48 8d 15 54 1e 00 00 	lea    0x1e54(%rip),%rdx        # 3c06 <malloc+0x8cb>
+    1db2:	48 89 d6             	mov    %rdx,%rsi
+    1db5:	89 c7                	mov    %eax,%edi
+    1db7:	b8 00 00 00 00       	mov    $0x0,%eax
+    1dbc:	e8 8c 0d 00 00       	call   2b4d <printf>
+    1dc1:	8b 05 79 24 00 00    	mov    0x2479(%rip),%eax        # 4240 <stdout>
+    1dc7:	48 8d 15 f7 16 00 00 	lea    0x16f7(%rip),%rdx        # 34c5 <malloc+0x18a>
+    1dce:	48 89 d6             	mov    %rdx,%rsi
+    1dd1:	89 c7                	mov    %eax,%edi
+    1dd3:	b8 00 00 00 00       	mov    $0x0,%eax
+    1dd8:	e8 70 0d 00 00       	call   2b4d <printf>
+    1ddd:	e8 12 13 00 00       	call   30f4 <exit>
+  if (close(fdn2) == -1)
+    1de2:	8b 45 d0             	mov    -0x30(%rbp),%eax
+    1de5:	89 c7                	mov    %eax,%edi
+    1de7:	e8 30 13 00 00       	call   311c <close>
+    1dec:	83 f8 ff             	cmp    $0xffffffff,%eax
+    1def:	75 5e                	jne    1e4f <simpledelete+0x53f>
+    error("error closing arbitrary");
+    1df1:	8b 05 49 24 00 00    	mov    0x2449(%rip),%eax        # 4240 <stdout>
+    1df7:	ba 6a 01 00 00       	mov    $0x16a,%edx
+    1dfc:	48 8d 0d 7f 16 00 00 	lea    0x167f(%rip),%rcx        # 3482 <malloc+0x147>
+    1e03:	48 89 ce             	mov    %rcx,%rsi
+    1e06:	89 c7                	mov    %eax,%edi
+    1e08:	b8 00 00 00 00       	mov    $0x0,%eax
+    1e0d:	e8 3b 0d 00 00       	call   2b4d <printf>
+    1e12:	8b 05 28 24 00 00    	mov    0x2428(%rip),%eax        # 4240 <stdout>
+    1e18:	48 8d 15 fb 1d 00 00 	lea    0x1dfb(%rip),%rdx        # 3c1a <malloc+0x8df>
+    1e1f:	48 89 d6             	mov    %rdx,%rsi
+    1e22:	89 c7                	mov    %eax,%edi
+    1e24:	b8 00 00 00 00       	mov    $0x0,%eax
+    1e29:	e8 1f 0d 00 00       	call   2b4d <printf>
+    1e2e:	8b 05 0c 24 00 00    	mov    0x240c(%rip),%eax        # 4240 <stdout>
+    1e34:	48 8d 15 8a 16 00 00 	lea    0x168a(%rip),%rdx        # 34c5 <malloc+0x18a>
+    1e3b:	48 89 d6             	mov    %rdx,%rsi
+    1e3e:	89 c7                	mov    %eax,%edi
+    1e40:	b8 00 00 00 00       	mov    $0x0,%eax
+    1e45:	e8 03 0d 00 00       	call   2b4d <printf>
+    1e4a:	e8 a5 12 00 00       	call   30f4 <exit>
+  if (unlink(n2) == -1)
+    1e4f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    1e53:	48 89 c7             	mov    %rax,%rdi
+    1e56:	e8 e9 12 00 00       	call   3144 <unlink>
+    1e5b:	83 f8 ff             	cmp    $0xffffffff,%eax
+    1e5e:	75 5e                	jne    1ebe <simpledelete+0x5ae>
+    error("error unlinking arbitrary");
+    1e60:	8b 05 da 23 00 00    	mov    0x23da(%rip),%eax        # 4240 <stdout>
+    1e66:	ba 6c 01 00 00       	mov    $0x16c,%edx
+    1e6b:	48 8d 0d 10 16 00 00 	lea    0x1610(%rip),%rcx        # 3482 <malloc+0x147>
+    1e72:	48 89 ce             	mov    %rcx,%rsi
+    1e75:	89 c7                	mov    %eax,%edi
+    1e77:	b8 00 00 00 00       	mov    $0x0,%eax
+    1e7c:	e8 cc 0c 00 00       	call   2b4d <printf>
+    1e81:	8b 05 b9 23 00 00    	mov    0x23b9(%rip),%eax        # 4240 <stdout>
+    1e87:	48 8d 15 a4 1d 00 00 	lea    0x1da4(%rip),%rdx        # 3c32 <malloc+0x8f7>
+    1e8e:	48 89 d6             	mov    %rdx,%rsi
+    1e91:	89 c7                	mov    %eax,%edi
+    1e93:	b8 00 00 00 00       	mov    $0x0,%eax
+    1e98:	e8 b0 0c 00 00       	call   2b4d <printf>
+    1e9d:	8b 05 9d 23 00 00    	mov    0x239d(%rip),%eax        # 4240 <stdout>
+    1ea3:	48 8d 15 1b 16 00 00 	lea    0x161b(%rip),%rdx        # 34c5 <malloc+0x18a>
+    1eaa:	48 89 d6             	mov    %rdx,%rsi
+    1ead:	89 c7                	mov    %eax,%edi
+    1eaf:	b8 00 00 00 00       	mov    $0x0,%eax
+    1eb4:	e8 94 0c 00 00       	call   2b4d <printf>
+    1eb9:	e8 36 12 00 00       	call   30f4 <exit>
+  if (read(fdn1, buf, 62) == -1)
+    1ebe:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+    1ec1:	ba 3e 00 00 00       	mov    $0x3e,%edx
+    1ec6:	48 8d 0d f3 23 00 00 	lea    0x23f3(%rip),%rcx        # 42c0 <buf>
+    1ecd:	48 89 ce             	mov    %rcx,%rsi
+    1ed0:	89 c7                	mov    %eax,%edi
+    1ed2:	e8 35 12 00 00       	call   310c <read>
+    1ed7:	83 f8 ff             	cmp    $0xffffffff,%eax
+    1eda:	75 5e                	jne    1f3a <simpledelete+0x62a>
+    error("couldn't read from small after unlink");
+    1edc:	8b 05 5e 23 00 00    	mov    0x235e(%rip),%eax        # 4240 <stdout>
+    1ee2:	ba 6e 01 00 00       	mov    $0x16e,%edx
+    1ee7:	48 8d 0d 94 15 00 00 	lea    0x1594(%rip),%rcx        # 3482 <malloc+0x147>
+    1eee:	48 89 ce             	mov    %rcx,%rsi
+    1ef1:	89 c7                	mov    %eax,%edi
+    1ef3:	b8 00 00 00 00       	mov    $0x0,%eax
+    1ef8:	e8 50 0c 00 00       	call   2b4d <printf>
+    1efd:	8b 05 3d 23 00 00    	mov    0x233d(%rip),%eax        # 4240 <stdout>
+    1f03:	48 8d 15 46 1d 00 00 	lea    0x1d46(%rip),%rdx        # 3c50 <malloc+0x915>
+    1f0a:	48 89 d6             	mov    %rdx,%rsi
+    1f0d:	89 c7                	mov    %eax,%edi
+    1f0f:	b8 00 00 00 00       	mov    $0x0,%eax
+    1f14:	e8 34 0c 00 00       	call   2b4d <printf>
+    1f19:	8b 05 21 23 00 00    	mov    0x2321(%rip),%eax        # 4240 <stdout>
+    1f1f:	48 8d 15 9f 15 00 00 	lea    0x159f(%rip),%rdx        # 34c5 <malloc+0x18a>
+    1f26:	48 89 d6             	mov    %rdx,%rsi
+    1f29:	89 c7                	mov    %eax,%edi
+    1f2b:	b8 00 00 00 00       	mov    $0x0,%eax
+    1f30:	e8 18 0c 00 00       	call   2b4d <printf>
+    1f35:	e8 ba 11 00 00       	call   30f4 <exit>
+  if (strcmp(buf, "lab5 is the last 451 lab, but this is just the beginning :(\n") != 0)
+    1f3a:	48 8d 05 9f 16 00 00 	lea    0x169f(%rip),%rax        # 35e0 <malloc+0x2a5>
+    1f41:	48 89 c6             	mov    %rax,%rsi
+    1f44:	48 8d 05 75 23 00 00 	lea    0x2375(%rip),%rax        # 42c0 <buf>
+    1f4b:	48 89 c7             	mov    %rax,%rdi
+    1f4e:	e8 3b 0f 00 00       	call   2e8e <strcmp>
+    1f53:	85 c0                	test   %eax,%eax
+    1f55:	74 65                	je     1fbc <simpledelete+0x6ac>
+    error("file content did not match expected after unlink, was: '%s'", buf);
+    1f57:	8b 05 e3 22 00 00    	mov    0x22e3(%rip),%eax        # 4240 <stdout>
+    1f5d:	ba 70 01 00 00       	mov    $0x170,%edx
+    1f62:	48 8d 0d 19 15 00 00 	lea    0x1519(%rip),%rcx        # 3482 <malloc+0x147>
+    1f69:	48 89 ce             	mov    %rcx,%rsi
+    1f6c:	89 c7                	mov    %eax,%edi
+    1f6e:	b8 00 00 00 00       	mov    $0x0,%eax
+    1f73:	e8 d5 0b 00 00       	call   2b4d <printf>
+    1f78:	8b 05 c2 22 00 00    	mov    0x22c2(%rip),%eax        # 4240 <stdout>
+    1f7e:	48 8d 15 3b 23 00 00 	lea    0x233b(%rip),%rdx        # 42c0 <buf>
+    1f85:	48 8d 0d ec 1c 00 00 	lea    0x1cec(%rip),%rcx        # 3c78 <malloc+0x93d>
+    1f8c:	48 89 ce             	mov    %rcx,%rsi
+    1f8f:	89 c7                	mov    %eax,%edi
+    1f91:	b8 00 00 00 00       	mov    $0x0,%eax
+    1f96:	e8 b2 0b 00 00       	call   2b4d <printf>
+    1f9b:	8b 05 9f 22 00 00    	mov    0x229f(%rip),%eax        # 4240 <stdout>
+    1fa1:	48 8d 15 1d 15 00 00 	lea    0x151d(%rip),%rdx        # 34c5 <malloc+0x18a>
+    1fa8:	48 89 d6             	mov    %rdx,%rsi
+    1fab:	89 c7                	mov    %eax,%edi
+    1fad:	b8 00 00 00 00       	mov    $0x0,%eax
+    1fb2:	e8 96 0b 00 00       	call   2b4d <printf>
+    1fb7:	e8 38 11 00 00       	call   30f4 <exit>
+
+  // Check inum usage/reuse and ordering
+  struct stat ss;
+  int fd1 = open("df1", O_RDWR | O_CREATE);
+    1fbc:	be 02 02 00 00       	mov    $0x202,%esi
+    1fc1:	48 8d 05 ec 1c 00 00 	lea    0x1cec(%rip),%rax        # 3cb4 <malloc+0x979>
+    1fc8:	48 89 c7             	mov    %rax,%rdi
+    1fcb:	e8 64 11 00 00       	call   3134 <open>
+    1fd0:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  if (fd1 == -1)
+    1fd3:	83 7d cc ff          	cmpl   $0xffffffff,-0x34(%rbp)
+    1fd7:	75 5e                	jne    2037 <simpledelete+0x727>
+    error("Unable to open df1");
+    1fd9:	8b 05 61 22 00 00    	mov    0x2261(%rip),%eax        # 4240 <stdout>
+    1fdf:	ba 76 01 00 00       	mov    $0x176,%edx
+    1fe4:	48 8d 0d 97 14 00 00 	lea    0x1497(%rip),%rcx        # 3482 <malloc+0x147>
+    1feb:	48 89 ce             	mov    %rcx,%rsi
+    1fee:	89 c7                	mov    %eax,%edi
+    1ff0:	b8 00 00 00 00       	mov    $0x0,%eax
+    1ff5:	e8 53 0b 00 00       	call   2b4d <printf>
+    1ffa:	8b 05 40 22 00 00    	mov    0x2240(%rip),%eax        # 4240 <stdout>
+    2000:	48 8d 15 b1 1c 00 00 	lea    0x1cb1(%rip),%rdx        # 3cb8 <malloc+0x97d>
+    2007:	48 89 d6             	mov    %rdx,%rsi
+    200a:	89 c7                	mov    %eax,%edi
+    200c:	b8 00 00 00 00       	mov    $0x0,%eax
+    2011:	e8 37 0b 00 00       	call   2b4d <printf>
+    2016:	8b 05 24 22 00 00    	mov    0x2224(%rip),%eax        # 4240 <stdout>
+    201c:	48 8d 15 a2 14 00 00 	lea    0x14a2(%rip),%rdx        # 34c5 <malloc+0x18a>
+    2023:	48 89 d6             	mov    %rdx,%rsi
+    2026:	89 c7                	mov    %eax,%edi
+    2028:	b8 00 00 00 00       	mov    $0x0,%eax
+    202d:	e8 1b 0b 00 00       	call   2b4d <printf>
+    2032:	e8 bd 10 00 00       	call   30f4 <exit>
+  if (fstat(fd1, &ss) == -1)
+    2037:	48 8d 55 9c          	lea    -0x64(%rbp),%rdx
+    203b:	8b 45 cc             	mov    -0x34(%rbp),%eax
+    203e:	48 89 d6             	mov    %rdx,%rsi
+    2041:	89 c7                	mov    %eax,%edi
+    2043:	e8 04 11 00 00       	call   314c <fstat>
+    2048:	83 f8 ff             	cmp    $0xffffffff,%eax
+    204b:	75 5e                	jne    20ab <simpledelete+0x79b>
+    error("Unable to stat open df1");
+    204d:	8b 05 ed 21 00 00    	mov    0x21ed(%rip),%eax        # 4240 <stdout>
+    2053:	ba 78 01 00 00       	mov    $0x178,%edx
+    2058:	48 8d 0d 23 14 00 00 	lea    0x1423(%rip),%rcx        # 3482 <malloc+0x147>
+    205f:	48 89 ce             	mov    %rcx,%rsi
+    2062:	89 c7                	mov    %eax,%edi
+    2064:	b8 00 00 00 00       	mov    $0x0,%eax
+    2069:	e8 df 0a 00 00       	call   2b4d <printf>
+    206e:	8b 05 cc 21 00 00    	mov    0x21cc(%rip),%eax        # 4240 <stdout>
+    2074:	48 8d 15 50 1c 00 00 	lea    0x1c50(%rip),%rdx        # 3ccb <malloc+0x990>
+    207b:	48 89 d6             	mov    %rdx,%rsi
+    207e:	89 c7                	mov    %eax,%edi
+    2080:	b8 00 00 00 00       	mov    $0x0,%eax
+    2085:	e8 c3 0a 00 00       	call   2b4d <printf>
+    208a:	8b 05 b0 21 00 00    	mov    0x21b0(%rip),%eax        # 4240 <stdout>
+    2090:	48 8d 15 2e 14 00 00 	lea    0x142e(%rip),%rdx        # 34c5 <malloc+0x18a>
+    2097:	48 89 d6             	mov    %rdx,%rsi
+    209a:	89 c7                	mov    %eax,%edi
+    209c:	b8 00 00 00 00       	mov    $0x0,%eax
+    20a1:	e8 a7 0a 00 00       	call   2b4d <printf>
+    20a6:	e8 49 10 00 00       	call   30f4 <exit>
+  int in1 = ss.ino;
+    20ab:	8b 45 a4             	mov    -0x5c(%rbp),%eax
+    20ae:	89 45 c8             	mov    %eax,-0x38(%rbp)
+  int fd2 = open("df2", O_RDWR | O_CREATE);
+    20b1:	be 02 02 00 00       	mov    $0x202,%esi
+    20b6:	48 8d 05 26 1c 00 00 	lea    0x1c26(%rip),%rax        # 3ce3 <malloc+0x9a8>
+    20bd:	48 89 c7             	mov    %rax,%rdi
+    20c0:	e8 6f 10 00 00       	call   3134 <open>
+    20c5:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+  if (fd2 == -1)
+    20c8:	83 7d c4 ff          	cmpl   $0xffffffff,-0x3c(%rbp)
+    20cc:	75 5e                	jne    212c <simpledelete+0x81c>
+    error("Unable to open df2");
+    20ce:	8b 05 6c 21 00 00    	mov    0x216c(%rip),%eax        # 4240 <stdout>
+    20d4:	ba 7c 01 00 00       	mov    $0x17c,%edx
+    20d9:	48 8d 0d a2 13 00 00 	lea    0x13a2(%rip),%rcx        # 3482 <malloc+0x147>
+    20e0:	48 89 ce             	mov    %rcx,%rsi
+    20e3:	89 c7                	mov    %eax,%edi
+    20e5:	b8 00 00 00 00       	mov    $0x0,%eax
+    20ea:	e8 5e 0a 00 00       	call   2b4d <printf>
+    20ef:	8b 05 4b 21 00 00    	mov    0x214b(%rip),%eax        # 4240 <stdout>
+    20f5:	48 8d 15 eb 1b 00 00 	lea    0x1beb(%rip),%rdx        # 3ce7 <malloc+0x9ac>
+    20fc:	48 89 d6             	mov    %rdx,%rsi
+    20ff:	89 c7                	mov    %eax,%edi
+    2101:	b8 00 00 00 00       	mov    $0x0,%eax
+    2106:	e8 42 0a 00 00       	call   2b4d <printf>
+    210b:	8b 05 2f 21 00 00    	mov    0x212f(%rip),%eax        # 4240 <stdout>
+    2111:	48 8d 15 ad 13 00 00 	lea    0x13ad(%rip),%rdx        # 34c5 <malloc+0x18a>
+    2118:	48 89 d6             	mov    %rdx,%rsi
+    211b:	89 c7                	mov    %eax,%edi
+    211d:	b8 00 00 00 00       	mov    $0x0,%eax
+    2122:	e8 26 0a 00 00       	call   2b4d <printf>
+    2127:	e8 c8 0f 00 00       	call   30f4 <exit>
+  if (fstat(fd2, &ss) == -1)
+    212c:	48 8d 55 9c          	lea    -0x64(%rbp),%rdx
+    2130:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+    2133:	48 89 d6             	mov    %rdx,%rsi
+    2136:	89 c7                	mov    %eax,%edi
+    2138:	e8 0f 10 00 00       	call   314c <fstat>
+    213d:	83 f8 ff             	cmp    $0xffffffff,%eax
+    2140:	75 5e                	jne    21a0 <simpledelete+0x890>
+    error("Unable to stat open df2");
+    2142:	8b 05 f8 20 00 00    	mov    0x20f8(%rip),%eax        # 4240 <stdout>
+    2148:	ba 7e 01 00 00       	mov    $0x17e,%edx
+    214d:	48 8d 0d 2e 13 00 00 	lea    0x132e(%rip),%rcx        # 3482 <malloc+0x147>
+    2154:	48 89 ce             	mov    %rcx,%rsi
+    2157:	89 c7                	mov    %eax,%edi
+    2159:	b8 00 00 00 00       	mov    $0x0,%eax
+    215e:	e8 ea 09 00 00       	call   2b4d <printf>
+    2163:	8b 05 d7 20 00 00    	mov    0x20d7(%rip),%eax        # 4240 <stdout>
+    2169:	48 8d 15 8a 1b 00 00 	lea    0x1b8a(%rip),%rdx        # 3cfa <malloc+0x9bf>
+    2170:	48 89 d6             	mov    %rdx,%rsi
+    2173:	89 c7                	mov    %eax,%edi
+    2175:	b8 00 00 00 00       	mov    $0x0,%eax
+    217a:	e8 ce 09 00 00       	call   2b4d <printf>
+    217f:	8b 05 bb 20 00 00    	mov    0x20bb(%rip),%eax        # 4240 <stdout>
+    2185:	48 8d 15 39 13 00 00 	lea    0x1339(%rip),%rdx        # 34c5 <malloc+0x18a>
+    218c:	48 89 d6             	mov    %rdx,%rsi
+    218f:	89 c7                	mov    %eax,%edi
+    2191:	b8 00 00 00 00       	mov    $0x0,%eax
+    2196:	e8 b2 09 00 00       	call   2b4d <printf>
+    219b:	e8 54 0f 00 00       	call   30f4 <exit>
+  int in2 = ss.ino;
+    21a0:	8b 45 a4             	mov    -0x5c(%rbp),%eax
+    21a3:	89 45 c0             	mov    %eax,-0x40(%rbp)
+  if (close(fd1) == -1)
+    21a6:	8b 45 cc             	mov    -0x34(%rbp),%eax
+    21a9:	89 c7                	mov    %eax,%edi
+    21ab:	e8 6c 0f 00 00       	call   311c <close>
+    21b0:	83 f8 ff             	cmp    $0xffffffff,%eax
+    21b3:	75 5e                	jne    2213 <simpledelete+0x903>
+    error("unable to close df1");
+    21b5:	8b 05 85 20 00 00    	mov    0x2085(%rip),%eax        # 4240 <stdout>
+    21bb:	ba 81 01 00 00       	mov    $0x181,%edx
+    21c0:	48 8d 0d bb 12 00 00 	lea    0x12bb(%rip),%rcx        # 3482 <malloc+0x147>
+    21c7:	48 89 ce             	mov    %rcx,%rsi
+    21ca:	89 c7                	mov    %eax,%edi
+    21cc:	b8 00 00 00 00       	mov    $0x0,%eax
+    21d1:	e8 77 09 00 00       	call   2b4d <printf>
+    21d6:	8b 05 64 20 00 00    	mov    0x2064(%rip),%eax        # 4240 <stdout>
+    21dc:	48 8d 15 2f 1b 00 00 	lea    0x1b2f(%rip),%rdx        # 3d12 <malloc+0x9d7>
+    21e3:	48 89 d6             	mov    %rdx,%rsi
+    21e6:	89 c7                	mov    %eax,%edi
+    21e8:	b8 00 00 00 00       	mov    $0x0,%eax
+    21ed:	e8 5b 09 00 00       	call   2b4d <printf>
+    21f2:	8b 05 48 20 00 00    	mov    0x2048(%rip),%eax        # 4240 <stdout>
+    21f8:	48 8d 15 c6 12 00 00 	lea    0x12c6(%rip),%rdx        # 34c5 <malloc+0x18a>
+    21ff:	48 89 d6             	mov    %rdx,%rsi
+    2202:	89 c7                	mov    %eax,%edi
+    2204:	b8 00 00 00 00       	mov    $0x0,%eax
+    2209:	e8 3f 09 00 00       	call   2b4d <printf>
+    220e:	e8 e1 0e 00 00       	call   30f4 <exit>
+  if (unlink("df1") == -1)
+    2213:	48 8d 05 9a 1a 00 00 	lea    0x1a9a(%rip),%rax        # 3cb4 <malloc+0x979>
+    221a:	48 89 c7             	mov    %rax,%rdi
+    221d:	e8 22 0f 00 00       	call   3144 <unlink>
+    2222:	83 f8 ff             	cmp    $0xffffffff,%eax
+    2225:	75 5e                	jne    2285 <simpledelete+0x975>
+    error("unable to unlink df1");
+    2227:	8b 05 13 20 00 00    	mov    0x2013(%rip),%eax        # 4240 <stdout>
+    222d:	ba 83 01 00 00       	mov    $0x183,%edx
+    2232:	48 8d 0d 49 12 00 00 	lea    0x1249(%rip),%rcx        # 3482 <malloc+0x147>
+    2239:	48 89 ce             	mov    %rcx,%rsi
+    223c:	89 c7                	mov    %eax,%edi
+    223e:	b8 00 00 00 00       	mov    $0x0,%eax
+    2243:	e8 05 09 00 00       	call   2b4d <printf>
+    2248:	8b 05 f2 1f 00 00    	mov    0x1ff2(%rip),%eax        # 4240 <stdout>
+    224e:	48 8d 15 d1 1a 00 00 	lea    0x1ad1(%rip),%rdx        # 3d26 <malloc+0x9eb>
+    2255:	48 89 d6             	mov    %rdx,%rsi
+    2258:	89 c7                	mov    %eax,%edi
+    225a:	b8 00 00 00 00       	mov    $0x0,%eax
+    225f:	e8 e9 08 00 00       	call   2b4d <printf>
+    2264:	8b 05 d6 1f 00 00    	mov    0x1fd6(%rip),%eax        # 4240 <stdout>
+    226a:	48 8d 15 54 12 00 00 	lea    0x1254(%rip),%rdx        # 34c5 <malloc+0x18a>
+    2271:	48 89 d6             	mov    %rdx,%rsi
+    2274:	89 c7                	mov    %eax,%edi
+    2276:	b8 00 00 00 00       	mov    $0x0,%eax
+    227b:	e8 cd 08 00 00       	call   2b4d <printf>
+    2280:	e8 6f 0e 00 00       	call   30f4 <exit>
+  int fd3 = open("df3", O_RDWR | O_CREATE);
+    2285:	be 02 02 00 00       	mov    $0x202,%esi
+    228a:	48 8d 05 aa 1a 00 00 	lea    0x1aaa(%rip),%rax        # 3d3b <malloc+0xa00>
+    2291:	48 89 c7             	mov    %rax,%rdi
+    2294:	e8 9b 0e 00 00       	call   3134 <open>
+    2299:	89 45 bc             	mov    %eax,-0x44(%rbp)
+  if (fd3 == -1)
+    229c:	83 7d bc ff          	cmpl   $0xffffffff,-0x44(%rbp)
+    22a0:	75 5e                	jne    2300 <simpledelete+0x9f0>
+    error("Unable to open df3");
+    22a2:	8b 05 98 1f 00 00    	mov    0x1f98(%rip),%eax        # 4240 <stdout>
+    22a8:	ba 86 01 00 00       	mov    $0x186,%edx
+    22ad:	48 8d 0d ce 11 00 00 	lea    0x11ce(%rip),%rcx        # 3482 <malloc+0x147>
+    22b4:	48 89 ce             	mov    %rcx,%rsi
+    22b7:	89 c7                	mov    %eax,%edi
+    22b9:	b8 00 00 00 00       	mov    $0x0,%eax
+    22be:	e8 8a 08 00 00       	call   2b4d <printf>
+    22c3:	8b 05 77 1f 00 00    	mov    0x1f77(%rip),%eax        # 4240 <stdout>
+    22c9:	48 8d 15 6f 1a 00 00 	lea    0x1a6f(%rip),%rdx        # 3d3f <malloc+0xa04>
+    22d0:	48 89 d6             	mov    %rdx,%rsi
+    22d3:	89 c7                	mov    %eax,%edi
+    22d5:	b8 00 00 00 00       	mov    $0x0,%eax
+    22da:	e8 6e 08 00 00       	call   2b4d <printf>
+    22df:	8b 05 5b 1f 00 00    	mov    0x1f5b(%rip),%eax        # 4240 <stdout>
+    22e5:	48 8d 15 d9 11 00 00 	lea    0x11d9(%rip),%rdx        # 34c5 <malloc+0x18a>
+    22ec:	48 89 d6             	mov    %rdx,%rsi
+    22ef:	89 c7                	mov    %eax,%edi
+    22f1:	b8 00 00 00 00       	mov    $0x0,%eax
+    22f6:	e8 52 08 00 00       	call   2b4d <printf>
+    22fb:	e8 f4 0d 00 00       	call   30f4 <exit>
+  if (fstat(fd3, &ss) == -1)
+    2300:	48 8d 55 9c          	lea    -0x64(%rbp),%rdx
+    2304:	8b 45 bc             	mov    -0x44(%rbp),%eax
+    2307:	48 89 d6             	mov    %rdx,%rsi
+    230a:	89 c7                	mov    %eax,%edi
+    230c:	e8 3b 0e 00 00       	call   314c <fstat>
+    2311:	83 f8 ff             	cmp    $0xffffffff,%eax
+    2314:	75 5e                	jne    2374 <simpledelete+0xa64>
+    error("Unable to stat open file");
+    2316:	8b 05 24 1f 00 00    	mov    0x1f24(%rip),%eax        # 4240 <stdout>
+    231c:	ba 88 01 00 00       	mov    $0x188,%edx
+    2321:	48 8d 0d 5a 11 00 00 	lea    0x115a(%rip),%rcx        # 3482 <malloc+0x147>
+    2328:	48 89 ce             	mov    %rcx,%rsi
+    232b:	89 c7                	mov    %eax,%edi
+    232d:	b8 00 00 00 00       	mov    $0x0,%eax
+    2332:	e8 16 08 00 00       	call   2b4d <printf>
+    2337:	8b 05 03 1f 00 00    	mov    0x1f03(%rip),%eax        # 4240 <stdout>
+    233d:	48 8d 15 0e 1a 00 00 	lea    0x1a0e(%rip),%rdx        # 3d52 <malloc+0xa17>
+    2344:	48 89 d6             	mov    %rdx,%rsi
+    2347:	89 c7                	mov    %eax,%edi
+    2349:	b8 00 00 00 00       	mov    $0x0,%eax
+    234e:	e8 fa 07 00 00       	call   2b4d <printf>
+    2353:	8b 05 e7 1e 00 00    	mov    0x1ee7(%rip),%eax        # 4240 <stdout>
+    2359:	48 8d 15 65 11 00 00 	lea    0x1165(%rip),%rdx        # 34c5 <malloc+0x18a>
+    2360:	48 89 d6             	mov    %rdx,%rsi
+    2363:	89 c7                	mov    %eax,%edi
+    2365:	b8 00 00 00 00       	mov    $0x0,%eax
+    236a:	e8 de 07 00 00       	call   2b4d <printf>
+    236f:	e8 80 0d 00 00       	call   30f4 <exit>
+  int in3 = ss.ino;
+    2374:	8b 45 a4             	mov    -0x5c(%rbp),%eax
+    2377:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  if (in3 != in1 || in3 == in2)
+    237a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+    237d:	3b 45 c8             	cmp    -0x38(%rbp),%eax
+    2380:	75 08                	jne    238a <simpledelete+0xa7a>
+    2382:	8b 45 b8             	mov    -0x48(%rbp),%eax
+    2385:	3b 45 c0             	cmp    -0x40(%rbp),%eax
+    2388:	75 5e                	jne    23e8 <simpledelete+0xad8>
+    error("File allocation does not reuse inums");
+    238a:	8b 05 b0 1e 00 00    	mov    0x1eb0(%rip),%eax        # 4240 <stdout>
+    2390:	ba 8b 01 00 00       	mov    $0x18b,%edx
+    2395:	48 8d 0d e6 10 00 00 	lea    0x10e6(%rip),%rcx        # 3482 <malloc+0x147>
+    239c:	48 89 ce             	mov    %rcx,%rsi
+    239f:	89 c7                	mov    %eax,%edi
+    23a1:	b8 00 00 00 00       	mov    $0x0,%eax
+    23a6:	e8 a2 07 00 00       	call   2b4d <printf>
+    23ab:	8b 05 8f 1e 00 00    	mov    0x1e8f(%rip),%eax        # 4240 <stdout>
+    23b1:	48 8d 15 b8 19 00 00 	lea    0x19b8(%rip),%rdx        # 3d70 <malloc+0xa35>
+    23b8:	48 89 d6             	mov    %rdx,%rsi
+    23bb:	89 c7                	mov    %eax,%edi
+    23bd:	b8 00 00 00 00       	mov    $0x0,%eax
+    23c2:	e8 86 07 00 00       	call   2b4d <printf>
+    23c7:	8b 05 73 1e 00 00    	mov    0x1e73(%rip),%eax        # 4240 <stdout>
+    23cd:	48 8d 15 f1 10 00 00 	lea    0x10f1(%rip),%rdx        # 34c5 <malloc+0x18a>
+    23d4:	48 89 d6             	mov    %rdx,%rsi
+    23d7:	89 c7                	mov    %eax,%edi
+    23d9:	b8 00 00 00 00       	mov    $0x0,%eax
+    23de:	e8 6a 07 00 00       	call   2b4d <printf>
+    23e3:	e8 0c 0d 00 00       	call   30f4 <exit>
+  int fd4 = open("df4", O_RDWR | O_CREATE);
+    23e8:	be 02 02 00 00       	mov    $0x202,%esi
+    23ed:	48 8d 05 a1 19 00 00 	lea    0x19a1(%rip),%rax        # 3d95 <malloc+0xa5a>
+    23f4:	48 89 c7             	mov    %rax,%rdi
+    23f7:	e8 38 0d 00 00       	call   3134 <open>
+    23fc:	89 45 b4             	mov    %eax,-0x4c(%rbp)
+  if (fd4 == -1)
+    23ff:	83 7d b4 ff          	cmpl   $0xffffffff,-0x4c(%rbp)
+    2403:	75 5e                	jne    2463 <simpledelete+0xb53>
+    error("Unable to open df4");
+    2405:	8b 05 35 1e 00 00    	mov    0x1e35(%rip),%eax        # 4240 <stdout>
+    240b:	ba 8e 01 00 00       	mov    $0x18e,%edx
+    2410:	48 8d 0d 6b 10 00 00 	lea    0x106b(%rip),%rcx        # 3482 <malloc+0x147>
+    2417:	48 89 ce             	mov    %rcx,%rsi
+    241a:	89 c7                	mov    %eax,%edi
+    241c:	b8 00 00 00 00       	mov    $0x0,%eax
+    2421:	e8 27 07 00 00       	call   2b4d <printf>
+    2426:	8b 05 14 1e 00 00    	mov    0x1e14(%rip),%eax        # 4240 <stdout>
+    242c:	48 8d 15 66 19 00 00 	lea    0x1966(%rip),%rdx        # 3d99 <malloc+0xa5e>
+    2433:	48 89 d6             	mov    %rdx,%rsi
+    2436:	89 c7                	mov    %eax,%edi
+    2438:	b8 00 00 00 00       	mov    $0x0,%eax
+    243d:	e8 0b 07 00 00       	call   2b4d <printf>
+    2442:	8b 05 f8 1d 00 00    	mov    0x1df8(%rip),%eax        # 4240 <stdout>
+    2448:	48 8d 15 76 10 00 00 	lea    0x1076(%rip),%rdx        # 34c5 <malloc+0x18a>
+    244f:	48 89 d6             	mov    %rdx,%rsi
+    2452:	89 c7                	mov    %eax,%edi
+    2454:	b8 00 00 00 00       	mov    $0x0,%eax
+    2459:	e8 ef 06 00 00       	call   2b4d <printf>
+    245e:	e8 91 0c 00 00       	call   30f4 <exit>
+  if (fstat(fd4, &ss) == -1)
+    2463:	48 8d 55 9c          	lea    -0x64(%rbp),%rdx
+    2467:	8b 45 b4             	mov    -0x4c(%rbp),%eax
+    246a:	48 89 d6             	mov    %rdx,%rsi
+    246d:	89 c7                	mov    %eax,%edi
+    246f:	e8 d8 0c 00 00       	call   314c <fstat>
+    2474:	83 f8 ff             	cmp    $0xffffffff,%eax
+    2477:	75 5e                	jne    24d7 <simpledelete+0xbc7>
+    error("Unable to stat open file");
+    2479:	8b 05 c1 1d 00 00    	mov    0x1dc1(%rip),%eax        # 4240 <stdout>
+    247f:	ba 90 01 00 00       	mov    $0x190,%edx
+    2484:	48 8d 0d f7 0f 00 00 	lea    0xff7(%rip),%rcx        # 3482 <malloc+0x147>
+    248b:	48 89 ce             	mov    %rcx,%rsi
+    248e:	89 c7                	mov    %eax,%edi
+    2490:	b8 00 00 00 00       	mov    $0x0,%eax
+    2495:	e8 b3 06 00 00       	call   2b4d <printf>
+    249a:	8b 05 a0 1d 00 00    	mov    0x1da0(%rip),%eax        # 4240 <stdout>
+    24a0:	48 8d 15 ab 18 00 00 	lea    0x18ab(%rip),%rdx        # 3d52 <malloc+0xa17>
+    24a7:	48 89 d6             	mov    %rdx,%rsi
+    24aa:	89 c7                	mov    %eax,%edi
+    24ac:	b8 00 00 00 00       	mov    $0x0,%eax
+    24b1:	e8 97 06 00 00       	call   2b4d <printf>
+    24b6:	8b 05 84 1d 00 00    	mov    0x1d84(%rip),%eax        # 4240 <stdout>
+    24bc:	48 8d 15 02 10 00 00 	lea    0x1002(%rip),%rdx        # 34c5 <malloc+0x18a>
+    24c3:	48 89 d6             	mov    %rdx,%rsi
+    24c6:	89 c7                	mov    %eax,%edi
+    24c8:	b8 00 00 00 00       	mov    $0x0,%eax
+    24cd:	e8 7b 06 00 00       	call   2b4d <printf>
+    24d2:	e8 1d 0c 00 00       	call   30f4 <exit>
+  int in4 = ss.ino;
+    24d7:	8b 45 a4             	mov    -0x5c(%rbp),%eax
+    24da:	89 45 b0             	mov    %eax,-0x50(%rbp)
+  if (in4 == in3 || in4 == in1 || in4 != in2 + 1)
+    24dd:	8b 45 b0             	mov    -0x50(%rbp),%eax
+    24e0:	3b 45 b8             	cmp    -0x48(%rbp),%eax
+    24e3:	74 13                	je     24f8 <simpledelete+0xbe8>
+    24e5:	8b 45 b0             	mov    -0x50(%rbp),%eax
+    24e8:	3b 45 c8             	cmp    -0x38(%rbp),%eax
+    24eb:	74 0b                	je     24f8 <simpledelete+0xbe8>
+    24ed:	8b 45 c0             	mov    -0x40(%rbp),%eax
+    24f0:	83 c0 01             	add    $0x1,%eax
+    24f3:	39 45 b0             	cmp    %eax,-0x50(%rbp)
+    24f6:	74 5e                	je     2556 <simpledelete+0xc46>
+    error("File allocation improperly finds inums");
+    24f8:	8b 05 42 1d 00 00    	mov    0x1d42(%rip),%eax        # 4240 <stdout>
+    24fe:	ba 93 01 00 00       	mov    $0x193,%edx
+    2503:	48 8d 0d 78 0f 00 00 	lea    0xf78(%rip),%rcx        # 3482 <malloc+0x147>
+    250a:	48 89 ce             	mov    %rcx,%rsi
+    250d:	89 c7                	mov    %eax,%edi
+    250f:	b8 00 00 00 00       	mov    $0x0,%eax
+    2514:	e8 34 06 00 00       	call   2b4d <printf>
+    2519:	8b 05 21 1d 00 00    	mov    0x1d21(%rip),%eax        # 4240 <stdout>
+    251f:	48 8d 15 8a 18 00 00 	lea    0x188a(%rip),%rdx        # 3db0 <malloc+0xa75>
+    2526:	48 89 d6             	mov    %rdx,%rsi
+    2529:	89 c7                	mov    %eax,%edi
+    252b:	b8 00 00 00 00       	mov    $0x0,%eax
+    2530:	e8 18 06 00 00       	call   2b4d <printf>
+    2535:	8b 05 05 1d 00 00    	mov    0x1d05(%rip),%eax        # 4240 <stdout>
+    253b:	48 8d 15 83 0f 00 00 	lea    0xf83(%rip),%rdx        # 34c5 <malloc+0x18a>
+    2542:	48 89 d6             	mov    %rdx,%rsi
+    2545:	89 c7                	mov    %eax,%edi
+    2547:	b8 00 00 00 00       	mov    $0x0,%eax
+    254c:	e8 fc 05 00 00       	call   2b4d <printf>
+    2551:	e8 9e 0b 00 00       	call   30f4 <exit>
+  if (close(fd2) != 0 || close(fd3) != 0 || close(fd4) != 0 || unlink("df2") != 0 || unlink("df3") != 0 || unlink("df4") != 0)
+    2556:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+    2559:	89 c7                	mov    %eax,%edi
+    255b:	e8 bc 0b 00 00       	call   311c <close>
+    2560:	85 c0                	test   %eax,%eax
+    2562:	75 55                	jne    25b9 <simpledelete+0xca9>
+    2564:	8b 45 bc             	mov    -0x44(%rbp),%eax
+    2567:	89 c7                	mov    %eax,%edi
+    2569:	e8 ae 0b 00 00       	call   311c <close>
+    256e:	85 c0                	test   %eax,%eax
+    2570:	75 47                	jne    25b9 <simpledelete+0xca9>
+    2572:	8b 45 b4             	mov    -0x4c(%rbp),%eax
+    2575:	89 c7                	mov    %eax,%edi
+    2577:	e8 a0 0b 00 00       	call   311c <close>
+    257c:	85 c0                	test   %eax,%eax
+    257e:	75 39                	jne    25b9 <simpledelete+0xca9>
+    2580:	48 8d 05 5c 17 00 00 	lea    0x175c(%rip),%rax        # 3ce3 <malloc+0x9a8>
+    2587:	48 89 c7             	mov    %rax,%rdi
+    258a:	e8 b5 0b 00 00       	call   3144 <unlink>
+    258f:	85 c0                	test   %eax,%eax
+    2591:	75 26                	jne    25b9 <simpledelete+0xca9>
+    2593:	48 8d 05 a1 17 00 00 	lea    0x17a1(%rip),%rax        # 3d3b <malloc+0xa00>
+    259a:	48 89 c7             	mov    %rax,%rdi
+    259d:	e8 a2 0b 00 00       	call   3144 <unlink>
+    25a2:	85 c0                	test   %eax,%eax
+    25a4:	75 13                	jne    25b9 <simpledelete+0xca9>
+    25a6:	48 8d 05 e8 17 00 00 	lea    0x17e8(%rip),%rax        # 3d95 <malloc+0xa5a>
+    25ad:	48 89 c7             	mov    %rax,%rdi
+    25b0:	e8 8f 0b 00 00       	call   3144 <unlink>
+    25b5:	85 c0                	test   %eax,%eax
+    25b7:	74 5e                	je     2617 <simpledelete+0xd07>
+    error("Unable to clean up after inum allocation test");
+    25b9:	8b 05 81 1c 00 00    	mov    0x1c81(%rip),%eax        # 4240 <stdout>
+    25bf:	ba 95 01 00 00       	mov    $0x195,%edx
+    25c4:	48 8d 0d b7 0e 00 00 	lea    0xeb7(%rip),%rcx        # 3482 <malloc+0x147>
+    25cb:	48 89 ce             	mov    %rcx,%rsi
+    25ce:	89 c7                	mov    %eax,%edi
+    25d0:	b8 00 00 00 00       	mov    $0x0,%eax
+    25d5:	e8 73 05 00 00       	call   2b4d <printf>
+    25da:	8b 05 60 1c 00 00    	mov    0x1c60(%rip),%eax        # 4240 <stdout>
+    25e0:	48 8d 15 f1 17 00 00 	lea    0x17f1(%rip),%rdx        # 3dd8 <malloc+0xa9d>
+    25e7:	48 89 d6             	mov    %rdx,%rsi
+    25ea:	89 c7                	mov    %eax,%edi
+    25ec:	b8 00 00 00 00       	mov    $0x0,%eax
+    25f1:	e8 57 05 00 00       	call   2b4d <printf>
+    25f6:	8b 05 44 1c 00 00    	mov    0x1c44(%rip),%eax        # 4240 <stdout>
+    25fc:	48 8d 15 c2 0e 00 00 	lea    0xec2(%rip),%rdx        # 34c5 <malloc+0x18a>
+    2603:	48 89 d6             	mov    %rdx,%rsi
+    2606:	89 c7                	mov    %eax,%edi
+    2608:	b8 00 00 00 00       	mov    $0x0,%eax
+    260d:	e8 3b 05 00 00       	call   2b4d <printf>
+    2612:	e8 dd 0a 00 00       	call   30f4 <exit>
+
+  // You should not be able to read from a deleted file
+  for (int i = 0; i < 8; ++i)
+    2617:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+    261e:	eb 1b                	jmp    263b <simpledelete+0xd2b>
+    buf[i] = i + 1;
+    2620:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    2623:	83 c0 01             	add    $0x1,%eax
+    2626:	89 c1                	mov    %eax,%ecx
+    2628:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    262b:	48 98                	cltq
+    262d:	48 8d 15 8c 1c 00 00 	lea    0x1c8c(%rip),%rdx        # 42c0 <buf>
+    2634:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  for (int i = 0; i < 8; ++i)
+    2637:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+    263b:	83 7d fc 07          	cmpl   $0x7,-0x4(%rbp)
+    263f:	7e df                	jle    2620 <simpledelete+0xd10>
+  fd = open("file", O_RDWR | O_CREATE);
+    2641:	be 02 02 00 00       	mov    $0x202,%esi
+    2646:	48 8d 05 b9 17 00 00 	lea    0x17b9(%rip),%rax        # 3e06 <malloc+0xacb>
+    264d:	48 89 c7             	mov    %rax,%rdi
+    2650:	e8 df 0a 00 00       	call   3134 <open>
+    2655:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  if (fd == -1 || write(fd, buf, 8) != 8)
+    2658:	83 7d ec ff          	cmpl   $0xffffffff,-0x14(%rbp)
+    265c:	74 1e                	je     267c <simpledelete+0xd6c>
+    265e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    2661:	ba 08 00 00 00       	mov    $0x8,%edx
+    2666:	48 8d 0d 53 1c 00 00 	lea    0x1c53(%rip),%rcx        # 42c0 <buf>
+    266d:	48 89 ce             	mov    %rcx,%rsi
+    2670:	89 c7                	mov    %eax,%edi
+    2672:	e8 9d 0a 00 00       	call   3114 <write>
+    2677:	83 f8 08             	cmp    $0x8,%eax
+    267a:	74 5e                	je     26da <simpledelete+0xdca>
+    error("Unable to open/write to file");
+    267c:	8b 05 be 1b 00 00    	mov    0x1bbe(%rip),%eax        # 4240 <stdout>
+    2682:	ba 9c 01 00 00       	mov    $0x19c,%edx
+    2687:	48 8d 0d f4 0d 00 00 	lea    0xdf4(%rip),%rcx        # 3482 <malloc+0x147>
+    268e:	48 89 ce             	mov    %rcx,%rsi
+    2691:	89 c7                	mov    %eax,%edi
+    2693:	b8 00 00 00 00       	mov    $0x0,%eax
+    2698:	e8 b0 04 00 00       	call   2b4d <printf>
+    269d:	8b 05 9d 1b 00 00    	mov    0x1b9d(%rip),%eax        # 4240 <stdout>
+    26a3:	48 8d 15 61 17 00 00 	lea    0x1761(%rip),%rdx        # 3e0b <malloc+0xad0>
+    26aa:	48 89 d6             	mov    %rdx,%rsi
+    26ad:	89 c7                	mov    %eax,%edi
+    26af:	b8 00 00 00 00       	mov    $0x0,%eax
+    26b4:	e8 94 04 00 00       	call   2b4d <printf>
+    26b9:	8b 05 81 1b 00 00    	mov    0x1b81(%rip),%eax        # 4240 <stdout>
+    26bf:	48 8d 15 ff 0d 00 00 	lea    0xdff(%rip),%rdx        # 34c5 <malloc+0x18a>
+    26c6:	48 89 d6             	mov    %rdx,%rsi
+    26c9:	89 c7                	mov    %eax,%edi
+    26cb:	b8 00 00 00 00       	mov    $0x0,%eax
+    26d0:	e8 78 04 00 00       	call   2b4d <printf>
+    26d5:	e8 1a 0a 00 00       	call   30f4 <exit>
+  for (int i = 0; i < 8; ++i)
+    26da:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+    26e1:	eb 14                	jmp    26f7 <simpledelete+0xde7>
+    buf[i] = 0;
+    26e3:	8b 45 f8             	mov    -0x8(%rbp),%eax
+    26e6:	48 98                	cltq
+    26e8:	48 8d 15 d1 1b 00 00 	lea    0x1bd1(%rip),%rdx        # 42c0 <buf>
+    26ef:	c6 04 10 00          	movb   $0x0,(%rax,%rdx,1)
+  for (int i = 0; i < 8; ++i)
+    26f3:	83 45 f8 01          	addl   $0x1,-0x8(%rbp)
+    26f7:	83 7d f8 07          	cmpl   $0x7,-0x8(%rbp)
+    26fb:	7e e6                	jle    26e3 <simpledelete+0xdd3>
+  if (close(fd) != 0 || unlink("file") != 0)
+    26fd:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    2700:	89 c7                	mov    %eax,%edi
+    2702:	e8 15 0a 00 00       	call   311c <close>
+    2707:	85 c0                	test   %eax,%eax
+    2709:	75 13                	jne    271e <simpledelete+0xe0e>
+    270b:	48 8d 05 f4 16 00 00 	lea    0x16f4(%rip),%rax        # 3e06 <malloc+0xacb>
+    2712:	48 89 c7             	mov    %rax,%rdi
+    2715:	e8 2a 0a 00 00       	call   3144 <unlink>
+    271a:	85 c0                	test   %eax,%eax
+    271c:	74 5e                	je     277c <simpledelete+0xe6c>
+    error("Unable to clean up file (1)");
+    271e:	8b 05 1c 1b 00 00    	mov    0x1b1c(%rip),%eax        # 4240 <stdout>
+    2724:	ba a0 01 00 00       	mov    $0x1a0,%edx
+    2729:	48 8d 0d 52 0d 00 00 	lea    0xd52(%rip),%rcx        # 3482 <malloc+0x147>
+    2730:	48 89 ce             	mov    %rcx,%rsi
+    2733:	89 c7                	mov    %eax,%edi
+    2735:	b8 00 00 00 00       	mov    $0x0,%eax
+    273a:	e8 0e 04 00 00       	call   2b4d <printf>
+    273f:	8b 05 fb 1a 00 00    	mov    0x1afb(%rip),%eax        # 4240 <stdout>
+    2745:	48 8d 15 dc 16 00 00 	lea    0x16dc(%rip),%rdx        # 3e28 <malloc+0xaed>
+    274c:	48 89 d6             	mov    %rdx,%rsi
+    274f:	89 c7                	mov    %eax,%edi
+    2751:	b8 00 00 00 00       	mov    $0x0,%eax
+    2756:	e8 f2 03 00 00       	call   2b4d <printf>
+    275b:	8b 05 df 1a 00 00    	mov    0x1adf(%rip),%eax        # 4240 <stdout>
+    2761:	48 8d 15 5d 0d 00 00 	lea    0xd5d(%rip),%rdx        # 34c5 <malloc+0x18a>
+    2768:	48 89 d6             	mov    %rdx,%rsi
+    276b:	89 c7                	mov    %eax,%edi
+    276d:	b8 00 00 00 00       	mov    $0x0,%eax
+    2772:	e8 d6 03 00 00       	call   2b4d <printf>
+    2777:	e8 78 09 00 00       	call   30f4 <exit>
+  fd = open("file", O_RDWR | O_CREATE);
+    277c:	be 02 02 00 00       	mov    $0x202,%esi
+    2781:	48 8d 05 7e 16 00 00 	lea    0x167e(%rip),%rax        # 3e06 <malloc+0xacb>
+    2788:	48 89 c7             	mov    %rax,%rdi
+    278b:	e8 a4 09 00 00       	call   3134 <open>
+    2790:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  if (fd == -1)
+    2793:	83 7d ec ff          	cmpl   $0xffffffff,-0x14(%rbp)
+    2797:	75 5e                	jne    27f7 <simpledelete+0xee7>
+    error("Unable to reopen file");
+    2799:	8b 05 a1 1a 00 00    	mov    0x1aa1(%rip),%eax        # 4240 <stdout>
+    279f:	ba a3 01 00 00       	mov    $0x1a3,%edx
+    27a4:	48 8d 0d d7 0c 00 00 	lea    0xcd7(%rip),%rcx        # 3482 <malloc+0x147>
+    27ab:	48 89 ce             	mov    %rcx,%rsi
+    27ae:	89 c7                	mov    %eax,%edi
+    27b0:	b8 00 00 00 00       	mov    $0x0,%eax
+    27b5:	e8 93 03 00 00       	call   2b4d <printf>
+    27ba:	8b 05 80 1a 00 00    	mov    0x1a80(%rip),%eax        # 4240 <stdout>
+    27c0:	48 8d 15 7d 16 00 00 	lea    0x167d(%rip),%rdx        # 3e44 <malloc+0xb09>
+    27c7:	48 89 d6             	mov    %rdx,%rsi
+    27ca:	89 c7                	mov    %eax,%edi
+    27cc:	b8 00 00 00 00       	mov    $0x0,%eax
+    27d1:	e8 77 03 00 00       	call   2b4d <printf>
+    27d6:	8b 05 64 1a 00 00    	mov    0x1a64(%rip),%eax        # 4240 <stdout>
+    27dc:	48 8d 15 e2 0c 00 00 	lea    0xce2(%rip),%rdx        # 34c5 <malloc+0x18a>
+    27e3:	48 89 d6             	mov    %rdx,%rsi
+    27e6:	89 c7                	mov    %eax,%edi
+    27e8:	b8 00 00 00 00       	mov    $0x0,%eax
+    27ed:	e8 5b 03 00 00       	call   2b4d <printf>
+    27f2:	e8 fd 08 00 00       	call   30f4 <exit>
+  int r = read(fd, buf, 8);
+    27f7:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    27fa:	ba 08 00 00 00       	mov    $0x8,%edx
+    27ff:	48 8d 0d ba 1a 00 00 	lea    0x1aba(%rip),%rcx        # 42c0 <buf>
+    2806:	48 89 ce             	mov    %rcx,%rsi
+    2809:	89 c7                	mov    %eax,%edi
+    280b:	e8 fc 08 00 00       	call   310c <read>
+    2810:	89 45 ac             	mov    %eax,-0x54(%rbp)
+  if (r > 0)
+    2813:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+    2817:	7e 5e                	jle    2877 <simpledelete+0xf67>
+    error("Able to read from fresh file");
+    2819:	8b 05 21 1a 00 00    	mov    0x1a21(%rip),%eax        # 4240 <stdout>
+    281f:	ba a6 01 00 00       	mov    $0x1a6,%edx
+    2824:	48 8d 0d 57 0c 00 00 	lea    0xc57(%rip),%rcx        # 3482 <malloc+0x147>
+    282b:	48 89 ce             	mov    %rcx,%rsi
+    282e:	89 c7                	mov    %eax,%edi
+    2830:	b8 00 00 00 00       	mov    $0x0,%eax
+    2835:	e8 13 03 00 00       	call   2b4d <printf>
+    283a:	8b 05 00 1a 00 00    	mov    0x1a00(%rip),%eax        # 4240 <stdout>
+    2840:	48 8d 15 13 16 00 00 	lea    0x1613(%rip),%rdx        # 3e5a <malloc+0xb1f>
+    2847:	48 89 d6             	mov    %rdx,%rsi
+    284a:	89 c7                	mov    %eax,%edi
+    284c:	b8 00 00 00 00       	mov    $0x0,%eax
+    2851:	e8 f7 02 00 00       	call   2b4d <printf>
+    2856:	8b 05 e4 19 00 00    	mov    0x19e4(%rip),%eax        # 4240 <stdout>
+    285c:	48 8d 15 62 0c 00 00 	lea    0xc62(%rip),%rdx        # 34c5 <malloc+0x18a>
+    2863:	48 89 d6             	mov    %rdx,%rsi
+    2866:	89 c7                	mov    %eax,%edi
+    2868:	b8 00 00 00 00       	mov    $0x0,%eax
+    286d:	e8 db 02 00 00       	call   2b4d <printf>
+    2872:	e8 7d 08 00 00       	call   30f4 <exit>
+  if (close(fd) != 0 || unlink("file") != 0)
+    2877:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    287a:	89 c7                	mov    %eax,%edi
+    287c:	e8 9b 08 00 00       	call   311c <close>
+    2881:	85 c0                	test   %eax,%eax
+    2883:	75 13                	jne    2898 <simpledelete+0xf88>
+    2885:	48 8d 05 7a 15 00 00 	lea    0x157a(%rip),%rax        # 3e06 <malloc+0xacb>
+    288c:	48 89 c7             	mov    %rax,%rdi
+    288f:	e8 b0 08 00 00       	call   3144 <unlink>
+    2894:	85 c0                	test   %eax,%eax
+    2896:	74 5e                	je     28f6 <simpledelete+0xfe6>
+    error("Unable to clean up file");
+    2898:	8b 05 a2 19 00 00    	mov    0x19a2(%rip),%eax        # 4240 <stdout>
+    289e:	ba a8 01 00 00       	mov    $0x1a8,%edx
+    28a3:	48 8d 0d d8 0b 00 00 	lea    0xbd8(%rip),%rcx        # 3482 <malloc+0x147>
+    28aa:	48 89 ce             	mov    %rcx,%rsi
+    28ad:	89 c7                	mov    %eax,%edi
+    28af:	b8 00 00 00 00       	mov    $0x0,%eax
+    28b4:	e8 94 02 00 00       	call   2b4d <printf>
+    28b9:	8b 05 81 19 00 00    	mov    0x1981(%rip),%eax        # 4240 <stdout>
+    28bf:	48 8d 15 b1 15 00 00 	lea    0x15b1(%rip),%rdx        # 3e77 <malloc+0xb3c>
+    28c6:	48 89 d6             	mov    %rdx,%rsi
+    28c9:	89 c7                	mov    %eax,%edi
+    28cb:	b8 00 00 00 00       	mov    $0x0,%eax
+    28d0:	e8 78 02 00 00       	call   2b4d <printf>
+    28d5:	8b 05 65 19 00 00    	mov    0x1965(%rip),%eax        # 4240 <stdout>
+    28db:	48 8d 15 e3 0b 00 00 	lea    0xbe3(%rip),%rdx        # 34c5 <malloc+0x18a>
+    28e2:	48 89 d6             	mov    %rdx,%rsi
+    28e5:	89 c7                	mov    %eax,%edi
+    28e7:	b8 00 00 00 00       	mov    $0x0,%eax
+    28ec:	e8 5c 02 00 00       	call   2b4d <printf>
+    28f1:	e8 fe 07 00 00       	call   30f4 <exit>
+  printf(1, "  simple deletion ok\n");
+    28f6:	48 8d 05 92 15 00 00 	lea    0x1592(%rip),%rax        # 3e8f <malloc+0xb54>
+    28fd:	48 89 c6             	mov    %rax,%rsi
+    2900:	bf 01 00 00 00       	mov    $0x1,%edi
+    2905:	b8 00 00 00 00       	mov    $0x0,%eax
+    290a:	e8 3e 02 00 00       	call   2b4d <printf>
+}
+    290f:	90                   	nop
+    2910:	c9                   	leave
+    2911:	c3                   	ret
+
+0000000000002912 <main>:
+
+int main(int argc, char *argv[]) {
+    2912:	55                   	push   %rbp
+    2913:	48 89 e5             	mov    %rsp,%rbp
+    2916:	48 83 ec 10          	sub    $0x10,%rsp
+    291a:	89 7d fc             	mov    %edi,-0x4(%rbp)
+    291d:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  printf(stdout, "lab4test_a starting\n");
+    2921:	8b 05 19 19 00 00    	mov    0x1919(%rip),%eax        # 4240 <stdout>
+    2927:	48 8d 15 77 15 00 00 	lea    0x1577(%rip),%rdx        # 3ea5 <malloc+0xb6a>
+    292e:	48 89 d6             	mov    %rdx,%rsi
+    2931:	89 c7                	mov    %eax,%edi
+    2933:	b8 00 00 00 00       	mov    $0x0,%eax
+    2938:	e8 10 02 00 00       	call   2b4d <printf>
+  overwrite();
+    293d:	e8 be d6 ff ff       	call   0 <overwrite>
+  append();
+    2942:	e8 2d d9 ff ff       	call   274 <append>
+  filecreation();
+    2947:	e8 c2 dc ff ff       	call   60e <filecreation>
+  manyfiles();
+    294c:	e8 e7 df ff ff       	call   938 <manyfiles>
+  syncfile();
+    2951:	e8 0e e3 ff ff       	call   c64 <syncfile>
+  onefile();
+    2956:	e8 1e e8 ff ff       	call   1179 <onefile>
+  fourfiles();
+    295b:	e8 46 eb ff ff       	call   14a6 <fourfiles>
+  simpledelete();
+    2960:	b8 00 00 00 00       	mov    $0x0,%eax
+    2965:	e8 a6 ef ff ff       	call   1910 <simpledelete>
+  printf(stdout, "lab4test_a passed!\n");
+    296a:	8b 05 d0 18 00 00    	mov    0x18d0(%rip),%eax        # 4240 <stdout>
+    2970:	48 8d 15 43 15 00 00 	lea    0x1543(%rip),%rdx        # 3eba <malloc+0xb7f>
+    2977:	48 89 d6             	mov    %rdx,%rsi
+    297a:	89 c7                	mov    %eax,%edi
+    297c:	b8 00 00 00 00       	mov    $0x0,%eax
+    2981:	e8 c7 01 00 00       	call   2b4d <printf>
+  exit();
+    2986:	e8 69 07 00 00       	call   30f4 <exit>
+
+000000000000298b <putc>:
+#include <cdefs.h>
+#include <stat.h>
+#include <stdarg.h>
+#include <user.h>
+
+static void putc(int fd, char c) { write(fd, &c, 1); }
+    298b:	55                   	push   %rbp
+    298c:	48 89 e5             	mov    %rsp,%rbp
+    298f:	48 83 ec 10          	sub    $0x10,%rsp
+    2993:	89 7d fc             	mov    %edi,-0x4(%rbp)
+    2996:	89 f0                	mov    %esi,%eax
+    2998:	88 45 f8             	mov    %al,-0x8(%rbp)
+    299b:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+    299f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    29a2:	ba 01 00 00 00       	mov    $0x1,%edx
+    29a7:	48 89 ce             	mov    %rcx,%rsi
+    29aa:	89 c7                	mov    %eax,%edi
+    29ac:	e8 63 07 00 00       	call   3114 <write>
+    29b1:	90                   	nop
+    29b2:	c9                   	leave
+    29b3:	c3                   	ret
+
+00000000000029b4 <printint64>:
+
+static void printint64(int fd, int xx, int base, int sgn) {
+    29b4:	55                   	push   %rbp
+    29b5:	48 89 e5             	mov    %rsp,%rbp
+    29b8:	48 83 ec 40          	sub    $0x40,%rsp
+    29bc:	89 7d cc             	mov    %edi,-0x34(%rbp)
+    29bf:	89 75 c8             	mov    %esi,-0x38(%rbp)
+    29c2:	89 55 c4             	mov    %edx,-0x3c(%rbp)
+    29c5:	89 4d c0             	mov    %ecx,-0x40(%rbp)
+  static char digits[] = "0123456789abcdef";
+  char buf[32];
+  int i;
+  uint64_t x;
+
+  if (sgn && (sgn = xx < 0))
+    29c8:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+    29cc:	74 1f                	je     29ed <printint64+0x39>
+    29ce:	8b 45 c8             	mov    -0x38(%rbp),%eax
+    29d1:	c1 e8 1f             	shr    $0x1f,%eax
+    29d4:	0f b6 c0             	movzbl %al,%eax
+    29d7:	89 45 c0             	mov    %eax,-0x40(%rbp)
+    29da:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+    29de:	74 0d                	je     29ed <printint64+0x39>
+    x = -xx;
+    29e0:	8b 45 c8             	mov    -0x38(%rbp),%eax
+    29e3:	f7 d8                	neg    %eax
+    29e5:	48 98                	cltq
+    29e7:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    29eb:	eb 09                	jmp    29f6 <printint64+0x42>
+  else
+    x = xx;
+    29ed:	8b 45 c8             	mov    -0x38(%rbp),%eax
+    29f0:	48 98                	cltq
+    29f2:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+  i = 0;
+    29f6:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  do {
+    buf[i++] = digits[x % base];
+    29fd:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+    2a00:	48 63 c8             	movslq %eax,%rcx
+    2a03:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2a07:	ba 00 00 00 00       	mov    $0x0,%edx
+    2a0c:	48 f7 f1             	div    %rcx
+    2a0f:	48 89 d1             	mov    %rdx,%rcx
+    2a12:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    2a15:	8d 50 01             	lea    0x1(%rax),%edx
+    2a18:	89 55 fc             	mov    %edx,-0x4(%rbp)
+    2a1b:	48 8d 15 2e 18 00 00 	lea    0x182e(%rip),%rdx        # 4250 <digits.1>
+    2a22:	0f b6 14 11          	movzbl (%rcx,%rdx,1),%edx
+    2a26:	48 98                	cltq
+    2a28:	88 54 05 d0          	mov    %dl,-0x30(%rbp,%rax,1)
+  } while ((x /= base) != 0);
+    2a2c:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+    2a2f:	48 63 f0             	movslq %eax,%rsi
+    2a32:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2a36:	ba 00 00 00 00       	mov    $0x0,%edx
+    2a3b:	48 f7 f6             	div    %rsi
+    2a3e:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    2a42:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+    2a47:	75 b4                	jne    29fd <printint64+0x49>
+
+  if (sgn)
+    2a49:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+    2a4d:	74 2b                	je     2a7a <printint64+0xc6>
+    buf[i++] = '-';
+    2a4f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    2a52:	8d 50 01             	lea    0x1(%rax),%edx
+    2a55:	89 55 fc             	mov    %edx,-0x4(%rbp)
+    2a58:	48 98                	cltq
+    2a5a:	c6 44 05 d0 2d       	movb   $0x2d,-0x30(%rbp,%rax,1)
+
+  while (--i >= 0)
+    2a5f:	eb 19                	jmp    2a7a <printint64+0xc6>
+    putc(fd, buf[i]);
+    2a61:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    2a64:	48 98                	cltq
+    2a66:	0f b6 44 05 d0       	movzbl -0x30(%rbp,%rax,1),%eax
+    2a6b:	0f be d0             	movsbl %al,%edx
+    2a6e:	8b 45 cc             	mov    -0x34(%rbp),%eax
+    2a71:	89 d6                	mov    %edx,%esi
+    2a73:	89 c7                	mov    %eax,%edi
+    2a75:	e8 11 ff ff ff       	call   298b <putc>
+  while (--i >= 0)
+    2a7a:	83 6d fc 01          	subl   $0x1,-0x4(%rbp)
+    2a7e:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+    2a82:	79 dd                	jns    2a61 <printint64+0xad>
+}
+    2a84:	90                   	nop
+    2a85:	90                   	nop
+    2a86:	c9                   	leave
+    2a87:	c3                   	ret
+
+0000000000002a88 <printint>:
+
+static void printint(int fd, int xx, int base, int sgn) {
+    2a88:	55                   	push   %rbp
+    2a89:	48 89 e5             	mov    %rsp,%rbp
+    2a8c:	48 83 ec 30          	sub    $0x30,%rsp
+    2a90:	89 7d dc             	mov    %edi,-0x24(%rbp)
+    2a93:	89 75 d8             	mov    %esi,-0x28(%rbp)
+    2a96:	89 55 d4             	mov    %edx,-0x2c(%rbp)
+    2a99:	89 4d d0             	mov    %ecx,-0x30(%rbp)
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+    2a9c:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+  if (sgn && xx < 0) {
+    2aa3:	83 7d d0 00          	cmpl   $0x0,-0x30(%rbp)
+    2aa7:	74 17                	je     2ac0 <printint+0x38>
+    2aa9:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+    2aad:	79 11                	jns    2ac0 <printint+0x38>
+    neg = 1;
+    2aaf:	c7 45 f8 01 00 00 00 	movl   $0x1,-0x8(%rbp)
+    x = -xx;
+    2ab6:	8b 45 d8             	mov    -0x28(%rbp),%eax
+    2ab9:	f7 d8                	neg    %eax
+    2abb:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    2abe:	eb 06                	jmp    2ac6 <printint+0x3e>
+  } else {
+    x = xx;
+    2ac0:	8b 45 d8             	mov    -0x28(%rbp),%eax
+    2ac3:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  }
+
+  i = 0;
+    2ac6:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  do {
+    buf[i++] = digits[x % base];
+    2acd:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+    2ad0:	8b 45 f4             	mov    -0xc(%rbp),%eax
+    2ad3:	ba 00 00 00 00       	mov    $0x0,%edx
+    2ad8:	f7 f1                	div    %ecx
+    2ada:	89 d1                	mov    %edx,%ecx
+    2adc:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    2adf:	8d 50 01             	lea    0x1(%rax),%edx
+    2ae2:	89 55 fc             	mov    %edx,-0x4(%rbp)
+    2ae5:	89 c9                	mov    %ecx,%ecx
+    2ae7:	48 8d 15 82 17 00 00 	lea    0x1782(%rip),%rdx        # 4270 <digits.0>
+    2aee:	0f b6 14 11          	movzbl (%rcx,%rdx,1),%edx
+    2af2:	48 98                	cltq
+    2af4:	88 54 05 e4          	mov    %dl,-0x1c(%rbp,%rax,1)
+  } while ((x /= base) != 0);
+    2af8:	8b 75 d4             	mov    -0x2c(%rbp),%esi
+    2afb:	8b 45 f4             	mov    -0xc(%rbp),%eax
+    2afe:	ba 00 00 00 00       	mov    $0x0,%edx
+    2b03:	f7 f6                	div    %esi
+    2b05:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    2b08:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+    2b0c:	75 bf                	jne    2acd <printint+0x45>
+  if (neg)
+    2b0e:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+    2b12:	74 2b                	je     2b3f <printint+0xb7>
+    buf[i++] = '-';
+    2b14:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    2b17:	8d 50 01             	lea    0x1(%rax),%edx
+    2b1a:	89 55 fc             	mov    %edx,-0x4(%rbp)
+    2b1d:	48 98                	cltq
+    2b1f:	c6 44 05 e4 2d       	movb   $0x2d,-0x1c(%rbp,%rax,1)
+
+  while (--i >= 0)
+    2b24:	eb 19                	jmp    2b3f <printint+0xb7>
+    putc(fd, buf[i]);
+    2b26:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    2b29:	48 98                	cltq
+    2b2b:	0f b6 44 05 e4       	movzbl -0x1c(%rbp,%rax,1),%eax
+    2b30:	0f be d0             	movsbl %al,%edx
+    2b33:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    2b36:	89 d6                	mov    %edx,%esi
+    2b38:	89 c7                	mov    %eax,%edi
+    2b3a:	e8 4c fe ff ff       	call   298b <putc>
+  while (--i >= 0)
+    2b3f:	83 6d fc 01          	subl   $0x1,-0x4(%rbp)
+    2b43:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+    2b47:	79 dd                	jns    2b26 <printint+0x9e>
+}
+    2b49:	90                   	nop
+    2b4a:	90                   	nop
+    2b4b:	c9                   	leave
+    2b4c:	c3                   	ret
+
+0000000000002b4d <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void printf(int fd, char *fmt, ...) {
+    2b4d:	55                   	push   %rbp
+    2b4e:	48 89 e5             	mov    %rsp,%rbp
+    2b51:	48 83 ec 70          	sub    $0x70,%rsp
+    2b55:	89 7d 9c             	mov    %edi,-0x64(%rbp)
+    2b58:	48 89 75 90          	mov    %rsi,-0x70(%rbp)
+    2b5c:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+    2b60:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+    2b64:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+    2b68:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+  char *s;
+  int c, i, state;
+  int lflag;
+  va_list valist;
+  va_start(valist, fmt);
+    2b6c:	c7 45 a0 10 00 00 00 	movl   $0x10,-0x60(%rbp)
+    2b73:	48 8d 45 10          	lea    0x10(%rbp),%rax
+    2b77:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+    2b7b:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+    2b7f:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+
+  state = 0;
+    2b83:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%rbp)
+  for (i = 0; fmt[i]; i++) {
+    2b8a:	c7 45 c4 00 00 00 00 	movl   $0x0,-0x3c(%rbp)
+    2b91:	e9 6b 02 00 00       	jmp    2e01 <printf+0x2b4>
+    c = fmt[i] & 0xff;
+    2b96:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+    2b99:	48 63 d0             	movslq %eax,%rdx
+    2b9c:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+    2ba0:	48 01 d0             	add    %rdx,%rax
+    2ba3:	0f b6 00             	movzbl (%rax),%eax
+    2ba6:	0f be c0             	movsbl %al,%eax
+    2ba9:	25 ff 00 00 00       	and    $0xff,%eax
+    2bae:	89 45 b8             	mov    %eax,-0x48(%rbp)
+    if (state == 0) {
+    2bb1:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+    2bb5:	75 30                	jne    2be7 <printf+0x9a>
+      if (c == '%') {
+    2bb7:	83 7d b8 25          	cmpl   $0x25,-0x48(%rbp)
+    2bbb:	75 13                	jne    2bd0 <printf+0x83>
+        state = '%';
+    2bbd:	c7 45 c0 25 00 00 00 	movl   $0x25,-0x40(%rbp)
+        lflag = 0;
+    2bc4:	c7 45 bc 00 00 00 00 	movl   $0x0,-0x44(%rbp)
+    2bcb:	e9 2d 02 00 00       	jmp    2dfd <printf+0x2b0>
+      } else {
+        putc(fd, c);
+    2bd0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+    2bd3:	0f be d0             	movsbl %al,%edx
+    2bd6:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    2bd9:	89 d6                	mov    %edx,%esi
+    2bdb:	89 c7                	mov    %eax,%edi
+    2bdd:	e8 a9 fd ff ff       	call   298b <putc>
+    2be2:	e9 16 02 00 00       	jmp    2dfd <printf+0x2b0>
+      }
+    } else if (state == '%') {
+    2be7:	83 7d c0 25          	cmpl   $0x25,-0x40(%rbp)
+    2beb:	0f 85 0c 02 00 00    	jne    2dfd <printf+0x2b0>
+      if (c == 'l') {
+    2bf1:	83 7d b8 6c          	cmpl   $0x6c,-0x48(%rbp)
+    2bf5:	75 0c                	jne    2c03 <printf+0xb6>
+        lflag = 1;
+    2bf7:	c7 45 bc 01 00 00 00 	movl   $0x1,-0x44(%rbp)
+        continue;
+    2bfe:	e9 fa 01 00 00       	jmp    2dfd <printf+0x2b0>
+      } else if (c == 'd') {
+    2c03:	83 7d b8 64          	cmpl   $0x64,-0x48(%rbp)
+    2c07:	0f 85 95 00 00 00    	jne    2ca2 <printf+0x155>
+        if (lflag == 1)
+    2c0d:	83 7d bc 01          	cmpl   $0x1,-0x44(%rbp)
+    2c11:	75 49                	jne    2c5c <printf+0x10f>
+          printint64(fd, va_arg(valist, int64_t), 10, 1);
+    2c13:	8b 45 a0             	mov    -0x60(%rbp),%eax
+    2c16:	83 f8 2f             	cmp    $0x2f,%eax
+    2c19:	77 17                	ja     2c32 <printf+0xe5>
+    2c1b:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    2c1f:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    2c22:	89 d2                	mov    %edx,%edx
+    2c24:	48 01 d0             	add    %rdx,%rax
+    2c27:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    2c2a:	83 c2 08             	add    $0x8,%edx
+    2c2d:	89 55 a0             	mov    %edx,-0x60(%rbp)
+    2c30:	eb 0c                	jmp    2c3e <printf+0xf1>
+    2c32:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+    2c36:	48 8d 50 08          	lea    0x8(%rax),%rdx
+    2c3a:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    2c3e:	48 8b 00             	mov    (%rax),%rax
+    2c41:	89 c6                	mov    %eax,%esi
+    2c43:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    2c46:	b9 01 00 00 00       	mov    $0x1,%ecx
+    2c4b:	ba 0a 00 00 00       	mov    $0xa,%edx
+    2c50:	89 c7                	mov    %eax,%edi
+    2c52:	e8 5d fd ff ff       	call   29b4 <printint64>
+    2c57:	e9 9a 01 00 00       	jmp    2df6 <printf+0x2a9>
+        else
+          printint(fd, va_arg(valist, int), 10, 1);
+    2c5c:	8b 45 a0             	mov    -0x60(%rbp),%eax
+    2c5f:	83 f8 2f             	cmp    $0x2f,%eax
+    2c62:	77 17                	ja     2c7b <printf+0x12e>
+    2c64:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    2c68:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    2c6b:	89 d2                	mov    %edx,%edx
+    2c6d:	48 01 d0             	add    %rdx,%rax
+    2c70:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    2c73:	83 c2 08             	add    $0x8,%edx
+    2c76:	89 55 a0             	mov    %edx,-0x60(%rbp)
+    2c79:	eb 0c                	jmp    2c87 <printf+0x13a>
+    2c7b:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+    2c7f:	48 8d 50 08          	lea    0x8(%rax),%rdx
+    2c83:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    2c87:	8b 30                	mov    (%rax),%esi
+    2c89:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    2c8c:	b9 01 00 00 00       	mov    $0x1,%ecx
+    2c91:	ba 0a 00 00 00       	mov    $0xa,%edx
+    2c96:	89 c7                	mov    %eax,%edi
+    2c98:	e8 eb fd ff ff       	call   2a88 <printint>
+    2c9d:	e9 54 01 00 00       	jmp    2df6 <printf+0x2a9>
+      } else if (c == 'x' || c == 'p') {
+    2ca2:	83 7d b8 78          	cmpl   $0x78,-0x48(%rbp)
+    2ca6:	74 0a                	je     2cb2 <printf+0x165>
+    2ca8:	83 7d b8 70          	cmpl   $0x70,-0x48(%rbp)
+    2cac:	0f 85 95 00 00 00    	jne    2d47 <printf+0x1fa>
+        if (lflag == 1)
+    2cb2:	83 7d bc 01          	cmpl   $0x1,-0x44(%rbp)
+    2cb6:	75 49                	jne    2d01 <printf+0x1b4>
+          printint64(fd, va_arg(valist, int64_t), 16, 0);
+    2cb8:	8b 45 a0             	mov    -0x60(%rbp),%eax
+    2cbb:	83 f8 2f             	cmp    $0x2f,%eax
+    2cbe:	77 17                	ja     2cd7 <printf+0x18a>
+    2cc0:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    2cc4:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    2cc7:	89 d2                	mov    %edx,%edx
+    2cc9:	48 01 d0             	add    %rdx,%rax
+    2ccc:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    2ccf:	83 c2 08             	add    $0x8,%edx
+    2cd2:	89 55 a0             	mov    %edx,-0x60(%rbp)
+    2cd5:	eb 0c                	jmp    2ce3 <printf+0x196>
+    2cd7:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+    2cdb:	48 8d 50 08          	lea    0x8(%rax),%rdx
+    2cdf:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    2ce3:	48 8b 00             	mov    (%rax),%rax
+    2ce6:	89 c6                	mov    %eax,%esi
+    2ce8:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    2ceb:	b9 00 00 00 00       	mov    $0x0,%ecx
+    2cf0:	ba 10 00 00 00       	mov    $0x10,%edx
+    2cf5:	89 c7                	mov    %eax,%edi
+    2cf7:	e8 b8 fc ff ff       	call   29b4 <printint64>
+        if (lflag == 1)
+    2cfc:	e9 f5 00 00 00       	jmp    2df6 <printf+0x2a9>
+        else
+          printint(fd, va_arg(valist, int), 16, 0);
+    2d01:	8b 45 a0             	mov    -0x60(%rbp),%eax
+    2d04:	83 f8 2f             	cmp    $0x2f,%eax
+    2d07:	77 17                	ja     2d20 <printf+0x1d3>
+    2d09:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    2d0d:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    2d10:	89 d2                	mov    %edx,%edx
+    2d12:	48 01 d0             	add    %rdx,%rax
+    2d15:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    2d18:	83 c2 08             	add    $0x8,%edx
+    2d1b:	89 55 a0             	mov    %edx,-0x60(%rbp)
+    2d1e:	eb 0c                	jmp    2d2c <printf+0x1df>
+    2d20:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+    2d24:	48 8d 50 08          	lea    0x8(%rax),%rdx
+    2d28:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    2d2c:	8b 30                	mov    (%rax),%esi
+    2d2e:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    2d31:	b9 00 00 00 00       	mov    $0x0,%ecx
+    2d36:	ba 10 00 00 00       	mov    $0x10,%edx
+    2d3b:	89 c7                	mov    %eax,%edi
+    2d3d:	e8 46 fd ff ff       	call   2a88 <printint>
+        if (lflag == 1)
+    2d42:	e9 af 00 00 00       	jmp    2df6 <printf+0x2a9>
+      } else if (c == 's') {
+    2d47:	83 7d b8 73          	cmpl   $0x73,-0x48(%rbp)
+    2d4b:	75 6e                	jne    2dbb <printf+0x26e>
+        if ((s = (char *)va_arg(valist, char *)) == 0)
+    2d4d:	8b 45 a0             	mov    -0x60(%rbp),%eax
+    2d50:	83 f8 2f             	cmp    $0x2f,%eax
+    2d53:	77 17                	ja     2d6c <printf+0x21f>
+    2d55:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    2d59:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    2d5c:	89 d2                	mov    %edx,%edx
+    2d5e:	48 01 d0             	add    %rdx,%rax
+    2d61:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    2d64:	83 c2 08             	add    $0x8,%edx
+    2d67:	89 55 a0             	mov    %edx,-0x60(%rbp)
+    2d6a:	eb 0c                	jmp    2d78 <printf+0x22b>
+    2d6c:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+    2d70:	48 8d 50 08          	lea    0x8(%rax),%rdx
+    2d74:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    2d78:	48 8b 00             	mov    (%rax),%rax
+    2d7b:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    2d7f:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+    2d84:	75 28                	jne    2dae <printf+0x261>
+          s = "(null)";
+    2d86:	48 8d 05 41 11 00 00 	lea    0x1141(%rip),%rax        # 3ece <malloc+0xb93>
+    2d8d:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        for (; *s; s++)
+    2d91:	eb 1b                	jmp    2dae <printf+0x261>
+          putc(fd, *s);
+    2d93:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    2d97:	0f b6 00             	movzbl (%rax),%eax
+    2d9a:	0f be d0             	movsbl %al,%edx
+    2d9d:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    2da0:	89 d6                	mov    %edx,%esi
+    2da2:	89 c7                	mov    %eax,%edi
+    2da4:	e8 e2 fb ff ff       	call   298b <putc>
+        for (; *s; s++)
+    2da9:	48 83 45 c8 01       	addq   $0x1,-0x38(%rbp)
+    2dae:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    2db2:	0f b6 00             	movzbl (%rax),%eax
+    2db5:	84 c0                	test   %al,%al
+    2db7:	75 da                	jne    2d93 <printf+0x246>
+    2db9:	eb 3b                	jmp    2df6 <printf+0x2a9>
+      } else if (c == '%') {
+    2dbb:	83 7d b8 25          	cmpl   $0x25,-0x48(%rbp)
+    2dbf:	75 14                	jne    2dd5 <printf+0x288>
+        putc(fd, c);
+    2dc1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+    2dc4:	0f be d0             	movsbl %al,%edx
+    2dc7:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    2dca:	89 d6                	mov    %edx,%esi
+    2dcc:	89 c7                	mov    %eax,%edi
+    2dce:	e8 b8 fb ff ff       	call   298b <putc>
+    2dd3:	eb 21                	jmp    2df6 <printf+0x2a9>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+    2dd5:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    2dd8:	be 25 00 00 00       	mov    $0x25,%esi
+    2ddd:	89 c7                	mov    %eax,%edi
+    2ddf:	e8 a7 fb ff ff       	call   298b <putc>
+        putc(fd, c);
+    2de4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+    2de7:	0f be d0             	movsbl %al,%edx
+    2dea:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    2ded:	89 d6                	mov    %edx,%esi
+    2def:	89 c7                	mov    %eax,%edi
+    2df1:	e8 95 fb ff ff       	call   298b <putc>
+      }
+      state = 0;
+    2df6:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%rbp)
+  for (i = 0; fmt[i]; i++) {
+    2dfd:	83 45 c4 01          	addl   $0x1,-0x3c(%rbp)
+    2e01:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+    2e04:	48 63 d0             	movslq %eax,%rdx
+    2e07:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+    2e0b:	48 01 d0             	add    %rdx,%rax
+    2e0e:	0f b6 00             	movzbl (%rax),%eax
+    2e11:	84 c0                	test   %al,%al
+    2e13:	0f 85 7d fd ff ff    	jne    2b96 <printf+0x49>
+    }
+  }
+
+  va_end(valist);
+}
+    2e19:	90                   	nop
+    2e1a:	90                   	nop
+    2e1b:	c9                   	leave
+    2e1c:	c3                   	ret
+
+0000000000002e1d <stosb>:
+      break;
+    buf[i++] = c;
+    if (c == '\n' || c == '\r')
+      break;
+  }
+  buf[i] = '\0';
+    2e1d:	55                   	push   %rbp
+    2e1e:	48 89 e5             	mov    %rsp,%rbp
+    2e21:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2e25:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    2e28:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  return buf;
+    2e2b:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+    2e2f:	8b 55 f0             	mov    -0x10(%rbp),%edx
+    2e32:	8b 45 f4             	mov    -0xc(%rbp),%eax
+    2e35:	48 89 ce             	mov    %rcx,%rsi
+    2e38:	48 89 f7             	mov    %rsi,%rdi
+    2e3b:	89 d1                	mov    %edx,%ecx
+    2e3d:	fc                   	cld
+    2e3e:	f3 aa                	rep stos %al,%es:(%rdi)
+    2e40:	89 ca                	mov    %ecx,%edx
+    2e42:	48 89 fe             	mov    %rdi,%rsi
+    2e45:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+    2e49:	89 55 f0             	mov    %edx,-0x10(%rbp)
+}
+
+int stat(char *n, struct stat *st) {
+  int fd;
+    2e4c:	90                   	nop
+    2e4d:	5d                   	pop    %rbp
+    2e4e:	c3                   	ret
+
+0000000000002e4f <strcpy>:
+char *strcpy(char *s, char *t) {
+    2e4f:	55                   	push   %rbp
+    2e50:	48 89 e5             	mov    %rsp,%rbp
+    2e53:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    2e57:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  os = s;
+    2e5b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2e5f:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while ((*s++ = *t++) != 0)
+    2e63:	90                   	nop
+    2e64:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    2e68:	48 8d 42 01          	lea    0x1(%rdx),%rax
+    2e6c:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    2e70:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2e74:	48 8d 48 01          	lea    0x1(%rax),%rcx
+    2e78:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+    2e7c:	0f b6 12             	movzbl (%rdx),%edx
+    2e7f:	88 10                	mov    %dl,(%rax)
+    2e81:	0f b6 00             	movzbl (%rax),%eax
+    2e84:	84 c0                	test   %al,%al
+    2e86:	75 dc                	jne    2e64 <strcpy+0x15>
+  return os;
+    2e88:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    2e8c:	5d                   	pop    %rbp
+    2e8d:	c3                   	ret
+
+0000000000002e8e <strcmp>:
+int strcmp(const char *p, const char *q) {
+    2e8e:	55                   	push   %rbp
+    2e8f:	48 89 e5             	mov    %rsp,%rbp
+    2e92:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2e96:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  while (*p && *p == *q)
+    2e9a:	eb 0a                	jmp    2ea6 <strcmp+0x18>
+    p++, q++;
+    2e9c:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    2ea1:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (*p && *p == *q)
+    2ea6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2eaa:	0f b6 00             	movzbl (%rax),%eax
+    2ead:	84 c0                	test   %al,%al
+    2eaf:	74 12                	je     2ec3 <strcmp+0x35>
+    2eb1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2eb5:	0f b6 10             	movzbl (%rax),%edx
+    2eb8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2ebc:	0f b6 00             	movzbl (%rax),%eax
+    2ebf:	38 c2                	cmp    %al,%dl
+    2ec1:	74 d9                	je     2e9c <strcmp+0xe>
+  return (uchar)*p - (uchar)*q;
+    2ec3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2ec7:	0f b6 00             	movzbl (%rax),%eax
+    2eca:	0f b6 d0             	movzbl %al,%edx
+    2ecd:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2ed1:	0f b6 00             	movzbl (%rax),%eax
+    2ed4:	0f b6 c0             	movzbl %al,%eax
+    2ed7:	29 c2                	sub    %eax,%edx
+    2ed9:	89 d0                	mov    %edx,%eax
+}
+    2edb:	5d                   	pop    %rbp
+    2edc:	c3                   	ret
+
+0000000000002edd <strlen>:
+uint strlen(char *s) {
+    2edd:	55                   	push   %rbp
+    2ede:	48 89 e5             	mov    %rsp,%rbp
+    2ee1:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  for (n = 0; s[n]; n++)
+    2ee5:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+    2eec:	eb 04                	jmp    2ef2 <strlen+0x15>
+    2eee:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+    2ef2:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    2ef5:	48 63 d0             	movslq %eax,%rdx
+    2ef8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2efc:	48 01 d0             	add    %rdx,%rax
+    2eff:	0f b6 00             	movzbl (%rax),%eax
+    2f02:	84 c0                	test   %al,%al
+    2f04:	75 e8                	jne    2eee <strlen+0x11>
+  return n;
+    2f06:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+    2f09:	5d                   	pop    %rbp
+    2f0a:	c3                   	ret
+
+0000000000002f0b <memset>:
+void *memset(void *dst, int c, uint n) {
+    2f0b:	55                   	push   %rbp
+    2f0c:	48 89 e5             	mov    %rsp,%rbp
+    2f0f:	48 83 ec 10          	sub    $0x10,%rsp
+    2f13:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2f17:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    2f1a:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  stosb(dst, c, n);
+    2f1d:	8b 55 f0             	mov    -0x10(%rbp),%edx
+    2f20:	8b 4d f4             	mov    -0xc(%rbp),%ecx
+    2f23:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2f27:	89 ce                	mov    %ecx,%esi
+    2f29:	48 89 c7             	mov    %rax,%rdi
+    2f2c:	e8 ec fe ff ff       	call   2e1d <stosb>
+  return dst;
+    2f31:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    2f35:	c9                   	leave
+    2f36:	c3                   	ret
+
+0000000000002f37 <strchr>:
+char *strchr(const char *s, char c) {
+    2f37:	55                   	push   %rbp
+    2f38:	48 89 e5             	mov    %rsp,%rbp
+    2f3b:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2f3f:	89 f0                	mov    %esi,%eax
+    2f41:	88 45 f4             	mov    %al,-0xc(%rbp)
+  for (; *s; s++)
+    2f44:	eb 17                	jmp    2f5d <strchr+0x26>
+    if (*s == c)
+    2f46:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2f4a:	0f b6 00             	movzbl (%rax),%eax
+    2f4d:	38 45 f4             	cmp    %al,-0xc(%rbp)
+    2f50:	75 06                	jne    2f58 <strchr+0x21>
+      return (char *)s;
+    2f52:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2f56:	eb 15                	jmp    2f6d <strchr+0x36>
+  for (; *s; s++)
+    2f58:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    2f5d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2f61:	0f b6 00             	movzbl (%rax),%eax
+    2f64:	84 c0                	test   %al,%al
+    2f66:	75 de                	jne    2f46 <strchr+0xf>
+  return 0;
+    2f68:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    2f6d:	5d                   	pop    %rbp
+    2f6e:	c3                   	ret
+
+0000000000002f6f <gets>:
+char *gets(char *buf, int max) {
+    2f6f:	55                   	push   %rbp
+    2f70:	48 89 e5             	mov    %rsp,%rbp
+    2f73:	48 83 ec 20          	sub    $0x20,%rsp
+    2f77:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    2f7b:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  for (i = 0; i + 1 < max;) {
+    2f7e:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+    2f85:	eb 48                	jmp    2fcf <gets+0x60>
+    cc = read(0, &c, 1);
+    2f87:	48 8d 45 f7          	lea    -0x9(%rbp),%rax
+    2f8b:	ba 01 00 00 00       	mov    $0x1,%edx
+    2f90:	48 89 c6             	mov    %rax,%rsi
+    2f93:	bf 00 00 00 00       	mov    $0x0,%edi
+    2f98:	e8 6f 01 00 00       	call   310c <read>
+    2f9d:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    if (cc < 1)
+    2fa0:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+    2fa4:	7e 36                	jle    2fdc <gets+0x6d>
+    buf[i++] = c;
+    2fa6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    2fa9:	8d 50 01             	lea    0x1(%rax),%edx
+    2fac:	89 55 fc             	mov    %edx,-0x4(%rbp)
+    2faf:	48 63 d0             	movslq %eax,%rdx
+    2fb2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2fb6:	48 01 c2             	add    %rax,%rdx
+    2fb9:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+    2fbd:	88 02                	mov    %al,(%rdx)
+    if (c == '\n' || c == '\r')
+    2fbf:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+    2fc3:	3c 0a                	cmp    $0xa,%al
+    2fc5:	74 16                	je     2fdd <gets+0x6e>
+    2fc7:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+    2fcb:	3c 0d                	cmp    $0xd,%al
+    2fcd:	74 0e                	je     2fdd <gets+0x6e>
+  for (i = 0; i + 1 < max;) {
+    2fcf:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    2fd2:	83 c0 01             	add    $0x1,%eax
+    2fd5:	39 45 e4             	cmp    %eax,-0x1c(%rbp)
+    2fd8:	7f ad                	jg     2f87 <gets+0x18>
+    2fda:	eb 01                	jmp    2fdd <gets+0x6e>
+      break;
+    2fdc:	90                   	nop
+  buf[i] = '\0';
+    2fdd:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    2fe0:	48 63 d0             	movslq %eax,%rdx
+    2fe3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2fe7:	48 01 d0             	add    %rdx,%rax
+    2fea:	c6 00 00             	movb   $0x0,(%rax)
+  return buf;
+    2fed:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+    2ff1:	c9                   	leave
+    2ff2:	c3                   	ret
+
+0000000000002ff3 <stat>:
+int stat(char *n, struct stat *st) {
+    2ff3:	55                   	push   %rbp
+    2ff4:	48 89 e5             	mov    %rsp,%rbp
+    2ff7:	48 83 ec 20          	sub    $0x20,%rsp
+    2ffb:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    2fff:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int r;
+
+  fd = open(n, O_RDONLY);
+    3003:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3007:	be 00 00 00 00       	mov    $0x0,%esi
+    300c:	48 89 c7             	mov    %rax,%rdi
+    300f:	e8 20 01 00 00       	call   3134 <open>
+    3014:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  if (fd < 0)
+    3017:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+    301b:	79 07                	jns    3024 <stat+0x31>
+    return -1;
+    301d:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    3022:	eb 21                	jmp    3045 <stat+0x52>
+  r = fstat(fd, st);
+    3024:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    3028:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    302b:	48 89 d6             	mov    %rdx,%rsi
+    302e:	89 c7                	mov    %eax,%edi
+    3030:	e8 17 01 00 00       	call   314c <fstat>
+    3035:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  close(fd);
+    3038:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    303b:	89 c7                	mov    %eax,%edi
+    303d:	e8 da 00 00 00       	call   311c <close>
+  return r;
+    3042:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+    3045:	c9                   	leave
+    3046:	c3                   	ret
+
+0000000000003047 <atoi>:
+
+int atoi(const char *s) {
+    3047:	55                   	push   %rbp
+    3048:	48 89 e5             	mov    %rsp,%rbp
+    304b:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int n;
+
+  n = 0;
+    304f:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  while ('0' <= *s && *s <= '9')
+    3056:	eb 28                	jmp    3080 <atoi+0x39>
+    n = n * 10 + *s++ - '0';
+    3058:	8b 55 fc             	mov    -0x4(%rbp),%edx
+    305b:	89 d0                	mov    %edx,%eax
+    305d:	c1 e0 02             	shl    $0x2,%eax
+    3060:	01 d0                	add    %edx,%eax
+    3062:	01 c0                	add    %eax,%eax
+    3064:	89 c1                	mov    %eax,%ecx
+    3066:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    306a:	48 8d 50 01          	lea    0x1(%rax),%rdx
+    306e:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    3072:	0f b6 00             	movzbl (%rax),%eax
+    3075:	0f be c0             	movsbl %al,%eax
+    3078:	01 c8                	add    %ecx,%eax
+    307a:	83 e8 30             	sub    $0x30,%eax
+    307d:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while ('0' <= *s && *s <= '9')
+    3080:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3084:	0f b6 00             	movzbl (%rax),%eax
+    3087:	3c 2f                	cmp    $0x2f,%al
+    3089:	7e 0b                	jle    3096 <atoi+0x4f>
+    308b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    308f:	0f b6 00             	movzbl (%rax),%eax
+    3092:	3c 39                	cmp    $0x39,%al
+    3094:	7e c2                	jle    3058 <atoi+0x11>
+  return n;
+    3096:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+    3099:	5d                   	pop    %rbp
+    309a:	c3                   	ret
+
+000000000000309b <memmove>:
+
+void *memmove(void *vdst, void *vsrc, int n) {
+    309b:	55                   	push   %rbp
+    309c:	48 89 e5             	mov    %rsp,%rbp
+    309f:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    30a3:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    30a7:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  char *dst, *src;
+
+  dst = vdst;
+    30aa:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    30ae:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  src = vsrc;
+    30b2:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    30b6:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  while (n-- > 0)
+    30ba:	eb 1d                	jmp    30d9 <memmove+0x3e>
+    *dst++ = *src++;
+    30bc:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    30c0:	48 8d 42 01          	lea    0x1(%rdx),%rax
+    30c4:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    30c8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    30cc:	48 8d 48 01          	lea    0x1(%rax),%rcx
+    30d0:	48 89 4d f8          	mov    %rcx,-0x8(%rbp)
+    30d4:	0f b6 12             	movzbl (%rdx),%edx
+    30d7:	88 10                	mov    %dl,(%rax)
+  while (n-- > 0)
+    30d9:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    30dc:	8d 50 ff             	lea    -0x1(%rax),%edx
+    30df:	89 55 dc             	mov    %edx,-0x24(%rbp)
+    30e2:	85 c0                	test   %eax,%eax
+    30e4:	7f d6                	jg     30bc <memmove+0x21>
+  return vdst;
+    30e6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    30ea:	5d                   	pop    %rbp
+    30eb:	c3                   	ret
+
+00000000000030ec <fork>:
+  name:                                                                        \
+  movl $SYS_##name, % eax;                                                     \
+  int $TRAP_SYSCALL;                                                           \
+  ret
+
+SYSCALL(fork)
+    30ec:	b8 01 00 00 00       	mov    $0x1,%eax
+    30f1:	cd 40                	int    $0x40
+    30f3:	c3                   	ret
+
+00000000000030f4 <exit>:
+SYSCALL(exit)
+    30f4:	b8 02 00 00 00       	mov    $0x2,%eax
+    30f9:	cd 40                	int    $0x40
+    30fb:	c3                   	ret
+
+00000000000030fc <wait>:
+SYSCALL(wait)
+    30fc:	b8 03 00 00 00       	mov    $0x3,%eax
+    3101:	cd 40                	int    $0x40
+    3103:	c3                   	ret
+
+0000000000003104 <pipe>:
+SYSCALL(pipe)
+    3104:	b8 04 00 00 00       	mov    $0x4,%eax
+    3109:	cd 40                	int    $0x40
+    310b:	c3                   	ret
+
+000000000000310c <read>:
+SYSCALL(read)
+    310c:	b8 05 00 00 00       	mov    $0x5,%eax
+    3111:	cd 40                	int    $0x40
+    3113:	c3                   	ret
+
+0000000000003114 <write>:
+SYSCALL(write)
+    3114:	b8 10 00 00 00       	mov    $0x10,%eax
+    3119:	cd 40                	int    $0x40
+    311b:	c3                   	ret
+
+000000000000311c <close>:
+SYSCALL(close)
+    311c:	b8 15 00 00 00       	mov    $0x15,%eax
+    3121:	cd 40                	int    $0x40
+    3123:	c3                   	ret
+
+0000000000003124 <kill>:
+SYSCALL(kill)
+    3124:	b8 06 00 00 00       	mov    $0x6,%eax
+    3129:	cd 40                	int    $0x40
+    312b:	c3                   	ret
+
+000000000000312c <exec>:
+SYSCALL(exec)
+    312c:	b8 07 00 00 00       	mov    $0x7,%eax
+    3131:	cd 40                	int    $0x40
+    3133:	c3                   	ret
+
+0000000000003134 <open>:
+SYSCALL(open)
+    3134:	b8 0f 00 00 00       	mov    $0xf,%eax
+    3139:	cd 40                	int    $0x40
+    313b:	c3                   	ret
+
+000000000000313c <mknod>:
+SYSCALL(mknod)
+    313c:	b8 11 00 00 00       	mov    $0x11,%eax
+    3141:	cd 40                	int    $0x40
+    3143:	c3                   	ret
+
+0000000000003144 <unlink>:
+SYSCALL(unlink)
+    3144:	b8 12 00 00 00       	mov    $0x12,%eax
+    3149:	cd 40                	int    $0x40
+    314b:	c3                   	ret
+
+000000000000314c <fstat>:
+SYSCALL(fstat)
+    314c:	b8 08 00 00 00       	mov    $0x8,%eax
+    3151:	cd 40                	int    $0x40
+    3153:	c3                   	ret
+
+0000000000003154 <link>:
+SYSCALL(link)
+    3154:	b8 13 00 00 00       	mov    $0x13,%eax
+    3159:	cd 40                	int    $0x40
+    315b:	c3                   	ret
+
+000000000000315c <mkdir>:
+SYSCALL(mkdir)
+    315c:	b8 14 00 00 00       	mov    $0x14,%eax
+    3161:	cd 40                	int    $0x40
+    3163:	c3                   	ret
+
+0000000000003164 <chdir>:
+SYSCALL(chdir)
+    3164:	b8 09 00 00 00       	mov    $0x9,%eax
+    3169:	cd 40                	int    $0x40
+    316b:	c3                   	ret
+
+000000000000316c <dup>:
+SYSCALL(dup)
+    316c:	b8 0a 00 00 00       	mov    $0xa,%eax
+    3171:	cd 40                	int    $0x40
+    3173:	c3                   	ret
+
+0000000000003174 <getpid>:
+SYSCALL(getpid)
+    3174:	b8 0b 00 00 00       	mov    $0xb,%eax
+    3179:	cd 40                	int    $0x40
+    317b:	c3                   	ret
+
+000000000000317c <sbrk>:
+SYSCALL(sbrk)
+    317c:	b8 0c 00 00 00       	mov    $0xc,%eax
+    3181:	cd 40                	int    $0x40
+    3183:	c3                   	ret
+
+0000000000003184 <sleep>:
+SYSCALL(sleep)
+    3184:	b8 0d 00 00 00       	mov    $0xd,%eax
+    3189:	cd 40                	int    $0x40
+    318b:	c3                   	ret
+
+000000000000318c <uptime>:
+SYSCALL(uptime)
+    318c:	b8 0e 00 00 00       	mov    $0xe,%eax
+    3191:	cd 40                	int    $0x40
+    3193:	c3                   	ret
+
+0000000000003194 <sysinfo>:
+SYSCALL(sysinfo)
+    3194:	b8 16 00 00 00       	mov    $0x16,%eax
+    3199:	cd 40                	int    $0x40
+    319b:	c3                   	ret
+
+000000000000319c <crashn>:
+SYSCALL(crashn)
+    319c:	b8 17 00 00 00       	mov    $0x17,%eax
+    31a1:	cd 40                	int    $0x40
+    31a3:	c3                   	ret
+
+00000000000031a4 <sync>:
+SYSCALL(sync)
+    31a4:	b8 18 00 00 00       	mov    $0x18,%eax
+    31a9:	cd 40                	int    $0x40
+    31ab:	c3                   	ret
+
+00000000000031ac <fsync>:
+SYSCALL(fsync)
+    31ac:	b8 19 00 00 00       	mov    $0x19,%eax
+    31b1:	cd 40                	int    $0x40
+    31b3:	c3                   	ret
+
+00000000000031b4 <free>:
+typedef union header Header;
+
+static Header base;
+static Header *freep;
+
+void free(void *ap) {
+    31b4:	55                   	push   %rbp
+    31b5:	48 89 e5             	mov    %rsp,%rbp
+    31b8:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  Header *bp, *p;
+
+  bp = (Header *)ap - 1;
+    31bc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    31c0:	48 83 e8 10          	sub    $0x10,%rax
+    31c4:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  for (p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    31c8:	48 8b 05 e1 10 00 00 	mov    0x10e1(%rip),%rax        # 42b0 <freep>
+    31cf:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    31d3:	eb 2f                	jmp    3204 <free+0x50>
+    if (p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    31d5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    31d9:	48 8b 00             	mov    (%rax),%rax
+    31dc:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+    31e0:	72 17                	jb     31f9 <free+0x45>
+    31e2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    31e6:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+    31ea:	72 2f                	jb     321b <free+0x67>
+    31ec:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    31f0:	48 8b 00             	mov    (%rax),%rax
+    31f3:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+    31f7:	72 22                	jb     321b <free+0x67>
+  for (p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    31f9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    31fd:	48 8b 00             	mov    (%rax),%rax
+    3200:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    3204:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    3208:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+    320c:	73 c7                	jae    31d5 <free+0x21>
+    320e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3212:	48 8b 00             	mov    (%rax),%rax
+    3215:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+    3219:	73 ba                	jae    31d5 <free+0x21>
+      break;
+  if (bp + bp->s.size == p->s.ptr) {
+    321b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    321f:	8b 40 08             	mov    0x8(%rax),%eax
+    3222:	89 c0                	mov    %eax,%eax
+    3224:	48 c1 e0 04          	shl    $0x4,%rax
+    3228:	48 89 c2             	mov    %rax,%rdx
+    322b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    322f:	48 01 c2             	add    %rax,%rdx
+    3232:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3236:	48 8b 00             	mov    (%rax),%rax
+    3239:	48 39 c2             	cmp    %rax,%rdx
+    323c:	75 2d                	jne    326b <free+0xb7>
+    bp->s.size += p->s.ptr->s.size;
+    323e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    3242:	8b 50 08             	mov    0x8(%rax),%edx
+    3245:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3249:	48 8b 00             	mov    (%rax),%rax
+    324c:	8b 40 08             	mov    0x8(%rax),%eax
+    324f:	01 c2                	add    %eax,%edx
+    3251:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    3255:	89 50 08             	mov    %edx,0x8(%rax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+    3258:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    325c:	48 8b 00             	mov    (%rax),%rax
+    325f:	48 8b 10             	mov    (%rax),%rdx
+    3262:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    3266:	48 89 10             	mov    %rdx,(%rax)
+    3269:	eb 0e                	jmp    3279 <free+0xc5>
+  } else
+    bp->s.ptr = p->s.ptr;
+    326b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    326f:	48 8b 10             	mov    (%rax),%rdx
+    3272:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    3276:	48 89 10             	mov    %rdx,(%rax)
+  if (p + p->s.size == bp) {
+    3279:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    327d:	8b 40 08             	mov    0x8(%rax),%eax
+    3280:	89 c0                	mov    %eax,%eax
+    3282:	48 c1 e0 04          	shl    $0x4,%rax
+    3286:	48 89 c2             	mov    %rax,%rdx
+    3289:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    328d:	48 01 d0             	add    %rdx,%rax
+    3290:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+    3294:	75 27                	jne    32bd <free+0x109>
+    p->s.size += bp->s.size;
+    3296:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    329a:	8b 50 08             	mov    0x8(%rax),%edx
+    329d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    32a1:	8b 40 08             	mov    0x8(%rax),%eax
+    32a4:	01 c2                	add    %eax,%edx
+    32a6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    32aa:	89 50 08             	mov    %edx,0x8(%rax)
+    p->s.ptr = bp->s.ptr;
+    32ad:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    32b1:	48 8b 10             	mov    (%rax),%rdx
+    32b4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    32b8:	48 89 10             	mov    %rdx,(%rax)
+    32bb:	eb 0b                	jmp    32c8 <free+0x114>
+  } else
+    p->s.ptr = bp;
+    32bd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    32c1:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    32c5:	48 89 10             	mov    %rdx,(%rax)
+  freep = p;
+    32c8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    32cc:	48 89 05 dd 0f 00 00 	mov    %rax,0xfdd(%rip)        # 42b0 <freep>
+}
+    32d3:	90                   	nop
+    32d4:	5d                   	pop    %rbp
+    32d5:	c3                   	ret
+
+00000000000032d6 <morecore>:
+
+static Header *morecore(uint nu) {
+    32d6:	55                   	push   %rbp
+    32d7:	48 89 e5             	mov    %rsp,%rbp
+    32da:	48 83 ec 20          	sub    $0x20,%rsp
+    32de:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  char *p;
+  Header *hp;
+
+  if (nu < 4096)
+    32e1:	81 7d ec ff 0f 00 00 	cmpl   $0xfff,-0x14(%rbp)
+    32e8:	77 07                	ja     32f1 <morecore+0x1b>
+    nu = 4096;
+    32ea:	c7 45 ec 00 10 00 00 	movl   $0x1000,-0x14(%rbp)
+  p = sbrk(nu * sizeof(Header));
+    32f1:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    32f4:	c1 e0 04             	shl    $0x4,%eax
+    32f7:	89 c7                	mov    %eax,%edi
+    32f9:	e8 7e fe ff ff       	call   317c <sbrk>
+    32fe:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (p == (char *)-1)
+    3302:	48 83 7d f8 ff       	cmpq   $0xffffffffffffffff,-0x8(%rbp)
+    3307:	75 07                	jne    3310 <morecore+0x3a>
+    return 0;
+    3309:	b8 00 00 00 00       	mov    $0x0,%eax
+    330e:	eb 29                	jmp    3339 <morecore+0x63>
+  hp = (Header *)p;
+    3310:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3314:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  hp->s.size = nu;
+    3318:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    331c:	8b 55 ec             	mov    -0x14(%rbp),%edx
+    331f:	89 50 08             	mov    %edx,0x8(%rax)
+  free((void *)(hp + 1));
+    3322:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    3326:	48 83 c0 10          	add    $0x10,%rax
+    332a:	48 89 c7             	mov    %rax,%rdi
+    332d:	e8 82 fe ff ff       	call   31b4 <free>
+  return freep;
+    3332:	48 8b 05 77 0f 00 00 	mov    0xf77(%rip),%rax        # 42b0 <freep>
+}
+    3339:	c9                   	leave
+    333a:	c3                   	ret
+
+000000000000333b <malloc>:
+
+void *malloc(uint nbytes) {
+    333b:	55                   	push   %rbp
+    333c:	48 89 e5             	mov    %rsp,%rbp
+    333f:	48 83 ec 30          	sub    $0x30,%rsp
+    3343:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1) / sizeof(Header) + 1;
+    3346:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    3349:	48 83 c0 0f          	add    $0xf,%rax
+    334d:	48 c1 e8 04          	shr    $0x4,%rax
+    3351:	83 c0 01             	add    $0x1,%eax
+    3354:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  if ((prevp = freep) == 0) {
+    3357:	48 8b 05 52 0f 00 00 	mov    0xf52(%rip),%rax        # 42b0 <freep>
+    335e:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    3362:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+    3367:	75 2e                	jne    3397 <malloc+0x5c>
+    base.s.ptr = freep = prevp = &base;
+    3369:	48 8d 05 30 0f 00 00 	lea    0xf30(%rip),%rax        # 42a0 <base>
+    3370:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    3374:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    3378:	48 89 05 31 0f 00 00 	mov    %rax,0xf31(%rip)        # 42b0 <freep>
+    337f:	48 8b 05 2a 0f 00 00 	mov    0xf2a(%rip),%rax        # 42b0 <freep>
+    3386:	48 89 05 13 0f 00 00 	mov    %rax,0xf13(%rip)        # 42a0 <base>
+    base.s.size = 0;
+    338d:	c7 05 11 0f 00 00 00 	movl   $0x0,0xf11(%rip)        # 42a8 <base+0x8>
+    3394:	00 00 00 
+  }
+  for (p = prevp->s.ptr;; prevp = p, p = p->s.ptr) {
+    3397:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    339b:	48 8b 00             	mov    (%rax),%rax
+    339e:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    if (p->s.size >= nunits) {
+    33a2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    33a6:	8b 40 08             	mov    0x8(%rax),%eax
+    33a9:	3b 45 ec             	cmp    -0x14(%rbp),%eax
+    33ac:	72 5f                	jb     340d <malloc+0xd2>
+      if (p->s.size == nunits)
+    33ae:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    33b2:	8b 40 08             	mov    0x8(%rax),%eax
+    33b5:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+    33b8:	75 10                	jne    33ca <malloc+0x8f>
+        prevp->s.ptr = p->s.ptr;
+    33ba:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    33be:	48 8b 10             	mov    (%rax),%rdx
+    33c1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    33c5:	48 89 10             	mov    %rdx,(%rax)
+    33c8:	eb 2e                	jmp    33f8 <malloc+0xbd>
+      else {
+        p->s.size -= nunits;
+    33ca:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    33ce:	8b 40 08             	mov    0x8(%rax),%eax
+    33d1:	2b 45 ec             	sub    -0x14(%rbp),%eax
+    33d4:	89 c2                	mov    %eax,%edx
+    33d6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    33da:	89 50 08             	mov    %edx,0x8(%rax)
+        p += p->s.size;
+    33dd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    33e1:	8b 40 08             	mov    0x8(%rax),%eax
+    33e4:	89 c0                	mov    %eax,%eax
+    33e6:	48 c1 e0 04          	shl    $0x4,%rax
+    33ea:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+        p->s.size = nunits;
+    33ee:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    33f2:	8b 55 ec             	mov    -0x14(%rbp),%edx
+    33f5:	89 50 08             	mov    %edx,0x8(%rax)
+      }
+      freep = prevp;
+    33f8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    33fc:	48 89 05 ad 0e 00 00 	mov    %rax,0xead(%rip)        # 42b0 <freep>
+      return (void *)(p + 1);
+    3403:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3407:	48 83 c0 10          	add    $0x10,%rax
+    340b:	eb 41                	jmp    344e <malloc+0x113>
+    }
+    if (p == freep)
+    340d:	48 8b 05 9c 0e 00 00 	mov    0xe9c(%rip),%rax        # 42b0 <freep>
+    3414:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+    3418:	75 1c                	jne    3436 <malloc+0xfb>
+      if ((p = morecore(nunits)) == 0)
+    341a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    341d:	89 c7                	mov    %eax,%edi
+    341f:	e8 b2 fe ff ff       	call   32d6 <morecore>
+    3424:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    3428:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+    342d:	75 07                	jne    3436 <malloc+0xfb>
+        return 0;
+    342f:	b8 00 00 00 00       	mov    $0x0,%eax
+    3434:	eb 18                	jmp    344e <malloc+0x113>
+  for (p = prevp->s.ptr;; prevp = p, p = p->s.ptr) {
+    3436:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    343a:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    343e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3442:	48 8b 00             	mov    (%rax),%rax
+    3445:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    if (p->s.size >= nunits) {
+    3449:	e9 54 ff ff ff       	jmp    33a2 <malloc+0x67>
+  }
+    344e:	c9                   	leave
+    344f:	c3                   	ret
@@ -0,0 +1,3050 @@
+
+out/user/_lab4test_b:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000000000 <concurrent_dup_test>:
+      while (1)                                                                \
+        ;                                                                      \
+    }                                                                          \
+  } while (0)
+
+void concurrent_dup_test() {
+       0:	55                   	push   %rbp
+       1:	48 89 e5             	mov    %rsp,%rbp
+       4:	48 83 ec 20          	sub    $0x20,%rsp
+  int i, pid, fd1, fd2, fd3, fd4;
+
+  fd1 = open("concurrent_dup.txt", O_CREATE | O_RDWR);
+       8:	be 02 02 00 00       	mov    $0x202,%esi
+       d:	48 8d 05 f4 21 00 00 	lea    0x21f4(%rip),%rax        # 2208 <malloc+0x115>
+      14:	48 89 c7             	mov    %rax,%rdi
+      17:	e8 d0 1e 00 00       	call   1eec <open>
+      1c:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  assert(fd1 == 3);
+      1f:	83 7d f8 03          	cmpl   $0x3,-0x8(%rbp)
+      23:	74 2b                	je     50 <concurrent_dup_test+0x50>
+      25:	8b 05 e5 28 00 00    	mov    0x28e5(%rip),%eax        # 2910 <stdout>
+      2b:	48 8d 15 e9 21 00 00 	lea    0x21e9(%rip),%rdx        # 221b <malloc+0x128>
+      32:	48 89 d1             	mov    %rdx,%rcx
+      35:	ba 1f 00 00 00       	mov    $0x1f,%edx
+      3a:	48 8d 35 e7 21 00 00 	lea    0x21e7(%rip),%rsi        # 2228 <malloc+0x135>
+      41:	89 c7                	mov    %eax,%edi
+      43:	b8 00 00 00 00       	mov    $0x0,%eax
+      48:	e8 b8 18 00 00       	call   1905 <printf>
+      4d:	90                   	nop
+      4e:	eb fd                	jmp    4d <concurrent_dup_test+0x4d>
+
+  for (i = 0; i < 50; i++) {
+      50:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+      57:	e9 27 02 00 00       	jmp    283 <concurrent_dup_test+0x283>
+    pid = fork();
+      5c:	e8 43 1e 00 00       	call   1ea4 <fork>
+      61:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    if (pid == 0) {
+      64:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+      68:	0f 85 ad 01 00 00    	jne    21b <concurrent_dup_test+0x21b>
+      fd2 = dup(fd1);
+      6e:	8b 45 f8             	mov    -0x8(%rbp),%eax
+      71:	89 c7                	mov    %eax,%edi
+      73:	e8 ac 1e 00 00       	call   1f24 <dup>
+      78:	89 45 f0             	mov    %eax,-0x10(%rbp)
+      assert(fd2 == 4);
+      7b:	83 7d f0 04          	cmpl   $0x4,-0x10(%rbp)
+      7f:	74 2b                	je     ac <concurrent_dup_test+0xac>
+      81:	8b 05 89 28 00 00    	mov    0x2889(%rip),%eax        # 2910 <stdout>
+      87:	48 8d 15 ba 21 00 00 	lea    0x21ba(%rip),%rdx        # 2248 <malloc+0x155>
+      8e:	48 89 d1             	mov    %rdx,%rcx
+      91:	ba 25 00 00 00       	mov    $0x25,%edx
+      96:	48 8d 35 8b 21 00 00 	lea    0x218b(%rip),%rsi        # 2228 <malloc+0x135>
+      9d:	89 c7                	mov    %eax,%edi
+      9f:	b8 00 00 00 00       	mov    $0x0,%eax
+      a4:	e8 5c 18 00 00       	call   1905 <printf>
+      a9:	90                   	nop
+      aa:	eb fd                	jmp    a9 <concurrent_dup_test+0xa9>
+      fd3 = dup(fd1);
+      ac:	8b 45 f8             	mov    -0x8(%rbp),%eax
+      af:	89 c7                	mov    %eax,%edi
+      b1:	e8 6e 1e 00 00       	call   1f24 <dup>
+      b6:	89 45 ec             	mov    %eax,-0x14(%rbp)
+      assert(fd3 == 5);
+      b9:	83 7d ec 05          	cmpl   $0x5,-0x14(%rbp)
+      bd:	74 2b                	je     ea <concurrent_dup_test+0xea>
+      bf:	8b 05 4b 28 00 00    	mov    0x284b(%rip),%eax        # 2910 <stdout>
+      c5:	48 8d 15 85 21 00 00 	lea    0x2185(%rip),%rdx        # 2251 <malloc+0x15e>
+      cc:	48 89 d1             	mov    %rdx,%rcx
+      cf:	ba 27 00 00 00       	mov    $0x27,%edx
+      d4:	48 8d 35 4d 21 00 00 	lea    0x214d(%rip),%rsi        # 2228 <malloc+0x135>
+      db:	89 c7                	mov    %eax,%edi
+      dd:	b8 00 00 00 00       	mov    $0x0,%eax
+      e2:	e8 1e 18 00 00       	call   1905 <printf>
+      e7:	90                   	nop
+      e8:	eb fd                	jmp    e7 <concurrent_dup_test+0xe7>
+      fd4 = dup(fd1);
+      ea:	8b 45 f8             	mov    -0x8(%rbp),%eax
+      ed:	89 c7                	mov    %eax,%edi
+      ef:	e8 30 1e 00 00       	call   1f24 <dup>
+      f4:	89 45 e8             	mov    %eax,-0x18(%rbp)
+      assert(fd4 == 6);
+      f7:	83 7d e8 06          	cmpl   $0x6,-0x18(%rbp)
+      fb:	74 2b                	je     128 <concurrent_dup_test+0x128>
+      fd:	8b 05 0d 28 00 00    	mov    0x280d(%rip),%eax        # 2910 <stdout>
+     103:	48 8d 15 50 21 00 00 	lea    0x2150(%rip),%rdx        # 225a <malloc+0x167>
+     10a:	48 89 d1             	mov    %rdx,%rcx
+     10d:	ba 29 00 00 00       	mov    $0x29,%edx
+     112:	48 8d 35 0f 21 00 00 	lea    0x210f(%rip),%rsi        # 2228 <malloc+0x135>
+     119:	89 c7                	mov    %eax,%edi
+     11b:	b8 00 00 00 00       	mov    $0x0,%eax
+     120:	e8 e0 17 00 00       	call   1905 <printf>
+     125:	90                   	nop
+     126:	eb fd                	jmp    125 <concurrent_dup_test+0x125>
+
+      sleep(50);
+     128:	bf 32 00 00 00       	mov    $0x32,%edi
+     12d:	e8 0a 1e 00 00       	call   1f3c <sleep>
+
+      assert(close(fd1) >= 0);
+     132:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     135:	89 c7                	mov    %eax,%edi
+     137:	e8 98 1d 00 00       	call   1ed4 <close>
+     13c:	85 c0                	test   %eax,%eax
+     13e:	79 2b                	jns    16b <concurrent_dup_test+0x16b>
+     140:	8b 05 ca 27 00 00    	mov    0x27ca(%rip),%eax        # 2910 <stdout>
+     146:	48 8d 15 16 21 00 00 	lea    0x2116(%rip),%rdx        # 2263 <malloc+0x170>
+     14d:	48 89 d1             	mov    %rdx,%rcx
+     150:	ba 2d 00 00 00       	mov    $0x2d,%edx
+     155:	48 8d 35 cc 20 00 00 	lea    0x20cc(%rip),%rsi        # 2228 <malloc+0x135>
+     15c:	89 c7                	mov    %eax,%edi
+     15e:	b8 00 00 00 00       	mov    $0x0,%eax
+     163:	e8 9d 17 00 00       	call   1905 <printf>
+     168:	90                   	nop
+     169:	eb fd                	jmp    168 <concurrent_dup_test+0x168>
+      assert(close(fd2) >= 0);
+     16b:	8b 45 f0             	mov    -0x10(%rbp),%eax
+     16e:	89 c7                	mov    %eax,%edi
+     170:	e8 5f 1d 00 00       	call   1ed4 <close>
+     175:	85 c0                	test   %eax,%eax
+     177:	79 2b                	jns    1a4 <concurrent_dup_test+0x1a4>
+     179:	8b 05 91 27 00 00    	mov    0x2791(%rip),%eax        # 2910 <stdout>
+     17f:	48 8d 15 ed 20 00 00 	lea    0x20ed(%rip),%rdx        # 2273 <malloc+0x180>
+     186:	48 89 d1             	mov    %rdx,%rcx
+     189:	ba 2e 00 00 00       	mov    $0x2e,%edx
+     18e:	48 8d 35 93 20 00 00 	lea    0x2093(%rip),%rsi        # 2228 <malloc+0x135>
+     195:	89 c7                	mov    %eax,%edi
+     197:	b8 00 00 00 00       	mov    $0x0,%eax
+     19c:	e8 64 17 00 00       	call   1905 <printf>
+     1a1:	90                   	nop
+     1a2:	eb fd                	jmp    1a1 <concurrent_dup_test+0x1a1>
+      assert(close(fd3) >= 0);
+     1a4:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     1a7:	89 c7                	mov    %eax,%edi
+     1a9:	e8 26 1d 00 00       	call   1ed4 <close>
+     1ae:	85 c0                	test   %eax,%eax
+     1b0:	79 2b                	jns    1dd <concurrent_dup_test+0x1dd>
+     1b2:	8b 05 58 27 00 00    	mov    0x2758(%rip),%eax        # 2910 <stdout>
+     1b8:	48 8d 15 c4 20 00 00 	lea    0x20c4(%rip),%rdx        # 2283 <malloc+0x190>
+     1bf:	48 89 d1             	mov    %rdx,%rcx
+     1c2:	ba 2f 00 00 00       	mov    $0x2f,%edx
+     1c7:	48 8d 35 5a 20 00 00 	lea    0x205a(%rip),%rsi        # 2228 <malloc+0x135>
+     1ce:	89 c7                	mov    %eax,%edi
+     1d0:	b8 00 00 00 00       	mov    $0x0,%eax
+     1d5:	e8 2b 17 00 00       	call   1905 <printf>
+     1da:	90                   	nop
+     1db:	eb fd                	jmp    1da <concurrent_dup_test+0x1da>
+      assert(close(fd4) >= 0);
+     1dd:	8b 45 e8             	mov    -0x18(%rbp),%eax
+     1e0:	89 c7                	mov    %eax,%edi
+     1e2:	e8 ed 1c 00 00       	call   1ed4 <close>
+     1e7:	85 c0                	test   %eax,%eax
+     1e9:	79 2b                	jns    216 <concurrent_dup_test+0x216>
+     1eb:	8b 05 1f 27 00 00    	mov    0x271f(%rip),%eax        # 2910 <stdout>
+     1f1:	48 8d 15 9b 20 00 00 	lea    0x209b(%rip),%rdx        # 2293 <malloc+0x1a0>
+     1f8:	48 89 d1             	mov    %rdx,%rcx
+     1fb:	ba 30 00 00 00       	mov    $0x30,%edx
+     200:	48 8d 35 21 20 00 00 	lea    0x2021(%rip),%rsi        # 2228 <malloc+0x135>
+     207:	89 c7                	mov    %eax,%edi
+     209:	b8 00 00 00 00       	mov    $0x0,%eax
+     20e:	e8 f2 16 00 00       	call   1905 <printf>
+     213:	90                   	nop
+     214:	eb fd                	jmp    213 <concurrent_dup_test+0x213>
+      exit();
+     216:	e8 91 1c 00 00       	call   1eac <exit>
+    } else if (pid < 0) {
+     21b:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+     21f:	79 5e                	jns    27f <concurrent_dup_test+0x27f>
+      error("fork() failed");
+     221:	8b 05 e9 26 00 00    	mov    0x26e9(%rip),%eax        # 2910 <stdout>
+     227:	ba 33 00 00 00       	mov    $0x33,%edx
+     22c:	48 8d 0d 70 20 00 00 	lea    0x2070(%rip),%rcx        # 22a3 <malloc+0x1b0>
+     233:	48 89 ce             	mov    %rcx,%rsi
+     236:	89 c7                	mov    %eax,%edi
+     238:	b8 00 00 00 00       	mov    $0x0,%eax
+     23d:	e8 c3 16 00 00       	call   1905 <printf>
+     242:	8b 05 c8 26 00 00    	mov    0x26c8(%rip),%eax        # 2910 <stdout>
+     248:	48 8d 15 66 20 00 00 	lea    0x2066(%rip),%rdx        # 22b5 <malloc+0x1c2>
+     24f:	48 89 d6             	mov    %rdx,%rsi
+     252:	89 c7                	mov    %eax,%edi
+     254:	b8 00 00 00 00       	mov    $0x0,%eax
+     259:	e8 a7 16 00 00       	call   1905 <printf>
+     25e:	8b 05 ac 26 00 00    	mov    0x26ac(%rip),%eax        # 2910 <stdout>
+     264:	48 8d 15 58 20 00 00 	lea    0x2058(%rip),%rdx        # 22c3 <malloc+0x1d0>
+     26b:	48 89 d6             	mov    %rdx,%rsi
+     26e:	89 c7                	mov    %eax,%edi
+     270:	b8 00 00 00 00       	mov    $0x0,%eax
+     275:	e8 8b 16 00 00       	call   1905 <printf>
+     27a:	e8 2d 1c 00 00       	call   1eac <exit>
+  for (i = 0; i < 50; i++) {
+     27f:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     283:	83 7d fc 31          	cmpl   $0x31,-0x4(%rbp)
+     287:	0f 8e cf fd ff ff    	jle    5c <concurrent_dup_test+0x5c>
+    }
+  }
+
+  for (i = 0; i < 50; i++) {
+     28d:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     294:	eb 09                	jmp    29f <concurrent_dup_test+0x29f>
+    wait();
+     296:	e8 19 1c 00 00       	call   1eb4 <wait>
+  for (i = 0; i < 50; i++) {
+     29b:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     29f:	83 7d fc 31          	cmpl   $0x31,-0x4(%rbp)
+     2a3:	7e f1                	jle    296 <concurrent_dup_test+0x296>
+  }
+
+  // no more children
+  if (wait() >= 0) {
+     2a5:	e8 0a 1c 00 00       	call   1eb4 <wait>
+     2aa:	85 c0                	test   %eax,%eax
+     2ac:	78 5e                	js     30c <concurrent_dup_test+0x30c>
+    error("ghost child!");
+     2ae:	8b 05 5c 26 00 00    	mov    0x265c(%rip),%eax        # 2910 <stdout>
+     2b4:	ba 3d 00 00 00       	mov    $0x3d,%edx
+     2b9:	48 8d 0d e3 1f 00 00 	lea    0x1fe3(%rip),%rcx        # 22a3 <malloc+0x1b0>
+     2c0:	48 89 ce             	mov    %rcx,%rsi
+     2c3:	89 c7                	mov    %eax,%edi
+     2c5:	b8 00 00 00 00       	mov    $0x0,%eax
+     2ca:	e8 36 16 00 00       	call   1905 <printf>
+     2cf:	8b 05 3b 26 00 00    	mov    0x263b(%rip),%eax        # 2910 <stdout>
+     2d5:	48 8d 15 e9 1f 00 00 	lea    0x1fe9(%rip),%rdx        # 22c5 <malloc+0x1d2>
+     2dc:	48 89 d6             	mov    %rdx,%rsi
+     2df:	89 c7                	mov    %eax,%edi
+     2e1:	b8 00 00 00 00       	mov    $0x0,%eax
+     2e6:	e8 1a 16 00 00       	call   1905 <printf>
+     2eb:	8b 05 1f 26 00 00    	mov    0x261f(%rip),%eax        # 2910 <stdout>
+     2f1:	48 8d 15 cb 1f 00 00 	lea    0x1fcb(%rip),%rdx        # 22c3 <malloc+0x1d0>
+     2f8:	48 89 d6             	mov    %rdx,%rsi
+     2fb:	89 c7                	mov    %eax,%edi
+     2fd:	b8 00 00 00 00       	mov    $0x0,%eax
+     302:	e8 fe 15 00 00       	call   1905 <printf>
+     307:	e8 a0 1b 00 00       	call   1eac <exit>
+  }
+
+  assert(close(fd1) >= 0);
+     30c:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     30f:	89 c7                	mov    %eax,%edi
+     311:	e8 be 1b 00 00       	call   1ed4 <close>
+     316:	85 c0                	test   %eax,%eax
+     318:	79 2b                	jns    345 <concurrent_dup_test+0x345>
+     31a:	8b 05 f0 25 00 00    	mov    0x25f0(%rip),%eax        # 2910 <stdout>
+     320:	48 8d 15 3c 1f 00 00 	lea    0x1f3c(%rip),%rdx        # 2263 <malloc+0x170>
+     327:	48 89 d1             	mov    %rdx,%rcx
+     32a:	ba 40 00 00 00       	mov    $0x40,%edx
+     32f:	48 8d 35 f2 1e 00 00 	lea    0x1ef2(%rip),%rsi        # 2228 <malloc+0x135>
+     336:	89 c7                	mov    %eax,%edi
+     338:	b8 00 00 00 00       	mov    $0x0,%eax
+     33d:	e8 c3 15 00 00       	call   1905 <printf>
+     342:	90                   	nop
+     343:	eb fd                	jmp    342 <concurrent_dup_test+0x342>
+  printf(stdout, "concurrent dup test OK\n");
+     345:	8b 05 c5 25 00 00    	mov    0x25c5(%rip),%eax        # 2910 <stdout>
+     34b:	48 8d 15 80 1f 00 00 	lea    0x1f80(%rip),%rdx        # 22d2 <malloc+0x1df>
+     352:	48 89 d6             	mov    %rdx,%rsi
+     355:	89 c7                	mov    %eax,%edi
+     357:	b8 00 00 00 00       	mov    $0x0,%eax
+     35c:	e8 a4 15 00 00       	call   1905 <printf>
+}
+     361:	90                   	nop
+     362:	c9                   	leave
+     363:	c3                   	ret
+
+0000000000000364 <concurrent_create_test>:
+
+void concurrent_create_test() {
+     364:	55                   	push   %rbp
+     365:	48 89 e5             	mov    %rsp,%rbp
+     368:	48 83 ec 20          	sub    $0x20,%rsp
+  int i, j, pid, fd, ret;
+  char buf[5];
+
+  fd = open("cc_create.txt", O_CREATE | O_WRONLY);
+     36c:	be 01 02 00 00       	mov    $0x201,%esi
+     371:	48 8d 05 72 1f 00 00 	lea    0x1f72(%rip),%rax        # 22ea <malloc+0x1f7>
+     378:	48 89 c7             	mov    %rax,%rdi
+     37b:	e8 6c 1b 00 00       	call   1eec <open>
+     380:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  assert(fd == 3);
+     383:	83 7d f4 03          	cmpl   $0x3,-0xc(%rbp)
+     387:	74 2b                	je     3b4 <concurrent_create_test+0x50>
+     389:	8b 05 81 25 00 00    	mov    0x2581(%rip),%eax        # 2910 <stdout>
+     38f:	48 8d 15 62 1f 00 00 	lea    0x1f62(%rip),%rdx        # 22f8 <malloc+0x205>
+     396:	48 89 d1             	mov    %rdx,%rcx
+     399:	ba 49 00 00 00       	mov    $0x49,%edx
+     39e:	48 8d 35 83 1e 00 00 	lea    0x1e83(%rip),%rsi        # 2228 <malloc+0x135>
+     3a5:	89 c7                	mov    %eax,%edi
+     3a7:	b8 00 00 00 00       	mov    $0x0,%eax
+     3ac:	e8 54 15 00 00       	call   1905 <printf>
+     3b1:	90                   	nop
+     3b2:	eb fd                	jmp    3b1 <concurrent_create_test+0x4d>
+
+  memset(buf, 0, 5);
+     3b4:	48 8d 45 e7          	lea    -0x19(%rbp),%rax
+     3b8:	ba 05 00 00 00       	mov    $0x5,%edx
+     3bd:	be 00 00 00 00       	mov    $0x0,%esi
+     3c2:	48 89 c7             	mov    %rax,%rdi
+     3c5:	e8 f9 18 00 00       	call   1cc3 <memset>
+  for (i = 0; i < 1000; i++) {
+     3ca:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     3d1:	eb 4a                	jmp    41d <concurrent_create_test+0xb9>
+    assert(write(fd, buf, 5) == 5);
+     3d3:	48 8d 4d e7          	lea    -0x19(%rbp),%rcx
+     3d7:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     3da:	ba 05 00 00 00       	mov    $0x5,%edx
+     3df:	48 89 ce             	mov    %rcx,%rsi
+     3e2:	89 c7                	mov    %eax,%edi
+     3e4:	e8 e3 1a 00 00       	call   1ecc <write>
+     3e9:	83 f8 05             	cmp    $0x5,%eax
+     3ec:	74 2b                	je     419 <concurrent_create_test+0xb5>
+     3ee:	8b 05 1c 25 00 00    	mov    0x251c(%rip),%eax        # 2910 <stdout>
+     3f4:	48 8d 15 05 1f 00 00 	lea    0x1f05(%rip),%rdx        # 2300 <malloc+0x20d>
+     3fb:	48 89 d1             	mov    %rdx,%rcx
+     3fe:	ba 4d 00 00 00       	mov    $0x4d,%edx
+     403:	48 8d 35 1e 1e 00 00 	lea    0x1e1e(%rip),%rsi        # 2228 <malloc+0x135>
+     40a:	89 c7                	mov    %eax,%edi
+     40c:	b8 00 00 00 00       	mov    $0x0,%eax
+     411:	e8 ef 14 00 00       	call   1905 <printf>
+     416:	90                   	nop
+     417:	eb fd                	jmp    416 <concurrent_create_test+0xb2>
+  for (i = 0; i < 1000; i++) {
+     419:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     41d:	81 7d fc e7 03 00 00 	cmpl   $0x3e7,-0x4(%rbp)
+     424:	7e ad                	jle    3d3 <concurrent_create_test+0x6f>
+  }
+
+  assert(close(fd) >= 0);
+     426:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     429:	89 c7                	mov    %eax,%edi
+     42b:	e8 a4 1a 00 00       	call   1ed4 <close>
+     430:	85 c0                	test   %eax,%eax
+     432:	79 2b                	jns    45f <concurrent_create_test+0xfb>
+     434:	8b 05 d6 24 00 00    	mov    0x24d6(%rip),%eax        # 2910 <stdout>
+     43a:	48 8d 15 d6 1e 00 00 	lea    0x1ed6(%rip),%rdx        # 2317 <malloc+0x224>
+     441:	48 89 d1             	mov    %rdx,%rcx
+     444:	ba 50 00 00 00       	mov    $0x50,%edx
+     449:	48 8d 35 d8 1d 00 00 	lea    0x1dd8(%rip),%rsi        # 2228 <malloc+0x135>
+     450:	89 c7                	mov    %eax,%edi
+     452:	b8 00 00 00 00       	mov    $0x0,%eax
+     457:	e8 a9 14 00 00       	call   1905 <printf>
+     45c:	90                   	nop
+     45d:	eb fd                	jmp    45c <concurrent_create_test+0xf8>
+
+  for (i = 0; i < 50; i++) {
+     45f:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     466:	e9 d3 01 00 00       	jmp    63e <concurrent_create_test+0x2da>
+    pid = fork();
+     46b:	e8 34 1a 00 00       	call   1ea4 <fork>
+     470:	89 45 f0             	mov    %eax,-0x10(%rbp)
+    if (pid == 0) {
+     473:	83 7d f0 00          	cmpl   $0x0,-0x10(%rbp)
+     477:	0f 85 59 01 00 00    	jne    5d6 <concurrent_create_test+0x272>
+      fd = open("cc_create.txt", O_CREATE | O_RDWR);
+     47d:	be 02 02 00 00       	mov    $0x202,%esi
+     482:	48 8d 05 61 1e 00 00 	lea    0x1e61(%rip),%rax        # 22ea <malloc+0x1f7>
+     489:	48 89 c7             	mov    %rax,%rdi
+     48c:	e8 5b 1a 00 00       	call   1eec <open>
+     491:	89 45 f4             	mov    %eax,-0xc(%rbp)
+      assert(fd == 3);
+     494:	83 7d f4 03          	cmpl   $0x3,-0xc(%rbp)
+     498:	74 2b                	je     4c5 <concurrent_create_test+0x161>
+     49a:	8b 05 70 24 00 00    	mov    0x2470(%rip),%eax        # 2910 <stdout>
+     4a0:	48 8d 15 51 1e 00 00 	lea    0x1e51(%rip),%rdx        # 22f8 <malloc+0x205>
+     4a7:	48 89 d1             	mov    %rdx,%rcx
+     4aa:	ba 56 00 00 00       	mov    $0x56,%edx
+     4af:	48 8d 35 72 1d 00 00 	lea    0x1d72(%rip),%rsi        # 2228 <malloc+0x135>
+     4b6:	89 c7                	mov    %eax,%edi
+     4b8:	b8 00 00 00 00       	mov    $0x0,%eax
+     4bd:	e8 43 14 00 00       	call   1905 <printf>
+     4c2:	90                   	nop
+     4c3:	eb fd                	jmp    4c2 <concurrent_create_test+0x15e>
+
+      j = 100 * i;
+     4c5:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     4c8:	6b c0 64             	imul   $0x64,%eax,%eax
+     4cb:	89 45 f8             	mov    %eax,-0x8(%rbp)
+      while (j > 0) {
+     4ce:	eb 50                	jmp    520 <concurrent_create_test+0x1bc>
+        assert((ret = read(fd, buf, 5)) >= 0);
+     4d0:	48 8d 4d e7          	lea    -0x19(%rbp),%rcx
+     4d4:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     4d7:	ba 05 00 00 00       	mov    $0x5,%edx
+     4dc:	48 89 ce             	mov    %rcx,%rsi
+     4df:	89 c7                	mov    %eax,%edi
+     4e1:	e8 de 19 00 00       	call   1ec4 <read>
+     4e6:	89 45 ec             	mov    %eax,-0x14(%rbp)
+     4e9:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+     4ed:	79 2b                	jns    51a <concurrent_create_test+0x1b6>
+     4ef:	8b 05 1b 24 00 00    	mov    0x241b(%rip),%eax        # 2910 <stdout>
+     4f5:	48 8d 15 2a 1e 00 00 	lea    0x1e2a(%rip),%rdx        # 2326 <malloc+0x233>
+     4fc:	48 89 d1             	mov    %rdx,%rcx
+     4ff:	ba 5a 00 00 00       	mov    $0x5a,%edx
+     504:	48 8d 35 1d 1d 00 00 	lea    0x1d1d(%rip),%rsi        # 2228 <malloc+0x135>
+     50b:	89 c7                	mov    %eax,%edi
+     50d:	b8 00 00 00 00       	mov    $0x0,%eax
+     512:	e8 ee 13 00 00       	call   1905 <printf>
+     517:	90                   	nop
+     518:	eb fd                	jmp    517 <concurrent_create_test+0x1b3>
+        j -= ret;
+     51a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     51d:	29 45 f8             	sub    %eax,-0x8(%rbp)
+      while (j > 0) {
+     520:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+     524:	7f aa                	jg     4d0 <concurrent_create_test+0x16c>
+      }
+
+      memset(buf, 65 + i, 5);
+     526:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     529:	8d 48 41             	lea    0x41(%rax),%ecx
+     52c:	48 8d 45 e7          	lea    -0x19(%rbp),%rax
+     530:	ba 05 00 00 00       	mov    $0x5,%edx
+     535:	89 ce                	mov    %ecx,%esi
+     537:	48 89 c7             	mov    %rax,%rdi
+     53a:	e8 84 17 00 00       	call   1cc3 <memset>
+      for (j = 0; j < 20; j++) {
+     53f:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+     546:	eb 4a                	jmp    592 <concurrent_create_test+0x22e>
+        assert(write(fd, buf, 5) == 5);
+     548:	48 8d 4d e7          	lea    -0x19(%rbp),%rcx
+     54c:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     54f:	ba 05 00 00 00       	mov    $0x5,%edx
+     554:	48 89 ce             	mov    %rcx,%rsi
+     557:	89 c7                	mov    %eax,%edi
+     559:	e8 6e 19 00 00       	call   1ecc <write>
+     55e:	83 f8 05             	cmp    $0x5,%eax
+     561:	74 2b                	je     58e <concurrent_create_test+0x22a>
+     563:	8b 05 a7 23 00 00    	mov    0x23a7(%rip),%eax        # 2910 <stdout>
+     569:	48 8d 15 90 1d 00 00 	lea    0x1d90(%rip),%rdx        # 2300 <malloc+0x20d>
+     570:	48 89 d1             	mov    %rdx,%rcx
+     573:	ba 60 00 00 00       	mov    $0x60,%edx
+     578:	48 8d 35 a9 1c 00 00 	lea    0x1ca9(%rip),%rsi        # 2228 <malloc+0x135>
+     57f:	89 c7                	mov    %eax,%edi
+     581:	b8 00 00 00 00       	mov    $0x0,%eax
+     586:	e8 7a 13 00 00       	call   1905 <printf>
+     58b:	90                   	nop
+     58c:	eb fd                	jmp    58b <concurrent_create_test+0x227>
+      for (j = 0; j < 20; j++) {
+     58e:	83 45 f8 01          	addl   $0x1,-0x8(%rbp)
+     592:	83 7d f8 13          	cmpl   $0x13,-0x8(%rbp)
+     596:	7e b0                	jle    548 <concurrent_create_test+0x1e4>
+      }
+
+      assert(close(fd) >= 0);
+     598:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     59b:	89 c7                	mov    %eax,%edi
+     59d:	e8 32 19 00 00       	call   1ed4 <close>
+     5a2:	85 c0                	test   %eax,%eax
+     5a4:	79 2b                	jns    5d1 <concurrent_create_test+0x26d>
+     5a6:	8b 05 64 23 00 00    	mov    0x2364(%rip),%eax        # 2910 <stdout>
+     5ac:	48 8d 15 64 1d 00 00 	lea    0x1d64(%rip),%rdx        # 2317 <malloc+0x224>
+     5b3:	48 89 d1             	mov    %rdx,%rcx
+     5b6:	ba 63 00 00 00       	mov    $0x63,%edx
+     5bb:	48 8d 35 66 1c 00 00 	lea    0x1c66(%rip),%rsi        # 2228 <malloc+0x135>
+     5c2:	89 c7                	mov    %eax,%edi
+     5c4:	b8 00 00 00 00       	mov    $0x0,%eax
+     5c9:	e8 37 13 00 00       	call   1905 <printf>
+     5ce:	90                   	nop
+     5cf:	eb fd                	jmp    5ce <concurrent_create_test+0x26a>
+      exit();
+     5d1:	e8 d6 18 00 00       	call   1eac <exit>
+    } else if (pid < 0) {
+     5d6:	83 7d f0 00          	cmpl   $0x0,-0x10(%rbp)
+     5da:	79 5e                	jns    63a <concurrent_create_test+0x2d6>
+      error("fork() failed");
+     5dc:	8b 05 2e 23 00 00    	mov    0x232e(%rip),%eax        # 2910 <stdout>
+     5e2:	ba 66 00 00 00       	mov    $0x66,%edx
+     5e7:	48 8d 0d b5 1c 00 00 	lea    0x1cb5(%rip),%rcx        # 22a3 <malloc+0x1b0>
+     5ee:	48 89 ce             	mov    %rcx,%rsi
+     5f1:	89 c7                	mov    %eax,%edi
+     5f3:	b8 00 00 00 00       	mov    $0x0,%eax
+     5f8:	e8 08 13 00 00       	call   1905 <printf>
+     5fd:	8b 05 0d 23 00 00    	mov    0x230d(%rip),%eax        # 2910 <stdout>
+     603:	48 8d 15 ab 1c 00 00 	lea    0x1cab(%rip),%rdx        # 22b5 <malloc+0x1c2>
+     60a:	48 89 d6             	mov    %rdx,%rsi
+     60d:	89 c7                	mov    %eax,%edi
+     60f:	b8 00 00 00 00       	mov    $0x0,%eax
+     614:	e8 ec 12 00 00       	call   1905 <printf>
+     619:	8b 05 f1 22 00 00    	mov    0x22f1(%rip),%eax        # 2910 <stdout>
+     61f:	48 8d 15 9d 1c 00 00 	lea    0x1c9d(%rip),%rdx        # 22c3 <malloc+0x1d0>
+     626:	48 89 d6             	mov    %rdx,%rsi
+     629:	89 c7                	mov    %eax,%edi
+     62b:	b8 00 00 00 00       	mov    $0x0,%eax
+     630:	e8 d0 12 00 00       	call   1905 <printf>
+     635:	e8 72 18 00 00       	call   1eac <exit>
+  for (i = 0; i < 50; i++) {
+     63a:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     63e:	83 7d fc 31          	cmpl   $0x31,-0x4(%rbp)
+     642:	0f 8e 23 fe ff ff    	jle    46b <concurrent_create_test+0x107>
+    }
+  }
+
+  for (i = 0; i < 50; i++) {
+     648:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     64f:	eb 09                	jmp    65a <concurrent_create_test+0x2f6>
+    wait();
+     651:	e8 5e 18 00 00       	call   1eb4 <wait>
+  for (i = 0; i < 50; i++) {
+     656:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     65a:	83 7d fc 31          	cmpl   $0x31,-0x4(%rbp)
+     65e:	7e f1                	jle    651 <concurrent_create_test+0x2ed>
+  }
+
+  // no more children
+  if (wait() >= 0) {
+     660:	e8 4f 18 00 00       	call   1eb4 <wait>
+     665:	85 c0                	test   %eax,%eax
+     667:	78 5e                	js     6c7 <concurrent_create_test+0x363>
+    error("ghost child!");
+     669:	8b 05 a1 22 00 00    	mov    0x22a1(%rip),%eax        # 2910 <stdout>
+     66f:	ba 70 00 00 00       	mov    $0x70,%edx
+     674:	48 8d 0d 28 1c 00 00 	lea    0x1c28(%rip),%rcx        # 22a3 <malloc+0x1b0>
+     67b:	48 89 ce             	mov    %rcx,%rsi
+     67e:	89 c7                	mov    %eax,%edi
+     680:	b8 00 00 00 00       	mov    $0x0,%eax
+     685:	e8 7b 12 00 00       	call   1905 <printf>
+     68a:	8b 05 80 22 00 00    	mov    0x2280(%rip),%eax        # 2910 <stdout>
+     690:	48 8d 15 2e 1c 00 00 	lea    0x1c2e(%rip),%rdx        # 22c5 <malloc+0x1d2>
+     697:	48 89 d6             	mov    %rdx,%rsi
+     69a:	89 c7                	mov    %eax,%edi
+     69c:	b8 00 00 00 00       	mov    $0x0,%eax
+     6a1:	e8 5f 12 00 00       	call   1905 <printf>
+     6a6:	8b 05 64 22 00 00    	mov    0x2264(%rip),%eax        # 2910 <stdout>
+     6ac:	48 8d 15 10 1c 00 00 	lea    0x1c10(%rip),%rdx        # 22c3 <malloc+0x1d0>
+     6b3:	48 89 d6             	mov    %rdx,%rsi
+     6b6:	89 c7                	mov    %eax,%edi
+     6b8:	b8 00 00 00 00       	mov    $0x0,%eax
+     6bd:	e8 43 12 00 00       	call   1905 <printf>
+     6c2:	e8 e5 17 00 00       	call   1eac <exit>
+  }
+
+  fd = open("cc_create.txt", O_RDONLY);
+     6c7:	be 00 00 00 00       	mov    $0x0,%esi
+     6cc:	48 8d 05 17 1c 00 00 	lea    0x1c17(%rip),%rax        # 22ea <malloc+0x1f7>
+     6d3:	48 89 c7             	mov    %rax,%rdi
+     6d6:	e8 11 18 00 00       	call   1eec <open>
+     6db:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  assert(fd == 3);
+     6de:	83 7d f4 03          	cmpl   $0x3,-0xc(%rbp)
+     6e2:	74 2b                	je     70f <concurrent_create_test+0x3ab>
+     6e4:	8b 05 26 22 00 00    	mov    0x2226(%rip),%eax        # 2910 <stdout>
+     6ea:	48 8d 15 07 1c 00 00 	lea    0x1c07(%rip),%rdx        # 22f8 <malloc+0x205>
+     6f1:	48 89 d1             	mov    %rdx,%rcx
+     6f4:	ba 74 00 00 00       	mov    $0x74,%edx
+     6f9:	48 8d 35 28 1b 00 00 	lea    0x1b28(%rip),%rsi        # 2228 <malloc+0x135>
+     700:	89 c7                	mov    %eax,%edi
+     702:	b8 00 00 00 00       	mov    $0x0,%eax
+     707:	e8 f9 11 00 00       	call   1905 <printf>
+     70c:	90                   	nop
+     70d:	eb fd                	jmp    70c <concurrent_create_test+0x3a8>
+
+  for (i = 0; i < 50; i++) {
+     70f:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     716:	eb 6e                	jmp    786 <concurrent_create_test+0x422>
+    for (j = 0; j < 100; j++) {
+     718:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+     71f:	eb 5b                	jmp    77c <concurrent_create_test+0x418>
+      while (read(fd, buf, 1) <= 0);
+     721:	90                   	nop
+     722:	48 8d 4d e7          	lea    -0x19(%rbp),%rcx
+     726:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     729:	ba 01 00 00 00       	mov    $0x1,%edx
+     72e:	48 89 ce             	mov    %rcx,%rsi
+     731:	89 c7                	mov    %eax,%edi
+     733:	e8 8c 17 00 00       	call   1ec4 <read>
+     738:	85 c0                	test   %eax,%eax
+     73a:	7e e6                	jle    722 <concurrent_create_test+0x3be>
+      assert(buf[0] == (i + 65));
+     73c:	0f b6 45 e7          	movzbl -0x19(%rbp),%eax
+     740:	0f be d0             	movsbl %al,%edx
+     743:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     746:	83 c0 41             	add    $0x41,%eax
+     749:	39 c2                	cmp    %eax,%edx
+     74b:	74 2b                	je     778 <concurrent_create_test+0x414>
+     74d:	8b 05 bd 21 00 00    	mov    0x21bd(%rip),%eax        # 2910 <stdout>
+     753:	48 8d 15 ea 1b 00 00 	lea    0x1bea(%rip),%rdx        # 2344 <malloc+0x251>
+     75a:	48 89 d1             	mov    %rdx,%rcx
+     75d:	ba 79 00 00 00       	mov    $0x79,%edx
+     762:	48 8d 35 bf 1a 00 00 	lea    0x1abf(%rip),%rsi        # 2228 <malloc+0x135>
+     769:	89 c7                	mov    %eax,%edi
+     76b:	b8 00 00 00 00       	mov    $0x0,%eax
+     770:	e8 90 11 00 00       	call   1905 <printf>
+     775:	90                   	nop
+     776:	eb fd                	jmp    775 <concurrent_create_test+0x411>
+    for (j = 0; j < 100; j++) {
+     778:	83 45 f8 01          	addl   $0x1,-0x8(%rbp)
+     77c:	83 7d f8 63          	cmpl   $0x63,-0x8(%rbp)
+     780:	7e 9f                	jle    721 <concurrent_create_test+0x3bd>
+  for (i = 0; i < 50; i++) {
+     782:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     786:	83 7d fc 31          	cmpl   $0x31,-0x4(%rbp)
+     78a:	7e 8c                	jle    718 <concurrent_create_test+0x3b4>
+    }
+  }
+
+  // EOF
+  assert(read(fd, buf, 1) == 0);
+     78c:	48 8d 4d e7          	lea    -0x19(%rbp),%rcx
+     790:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     793:	ba 01 00 00 00       	mov    $0x1,%edx
+     798:	48 89 ce             	mov    %rcx,%rsi
+     79b:	89 c7                	mov    %eax,%edi
+     79d:	e8 22 17 00 00       	call   1ec4 <read>
+     7a2:	85 c0                	test   %eax,%eax
+     7a4:	74 2b                	je     7d1 <concurrent_create_test+0x46d>
+     7a6:	8b 05 64 21 00 00    	mov    0x2164(%rip),%eax        # 2910 <stdout>
+     7ac:	48 8d 15 a4 1b 00 00 	lea    0x1ba4(%rip),%rdx        # 2357 <malloc+0x264>
+     7b3:	48 89 d1             	mov    %rdx,%rcx
+     7b6:	ba 7e 00 00 00       	mov    $0x7e,%edx
+     7bb:	48 8d 35 66 1a 00 00 	lea    0x1a66(%rip),%rsi        # 2228 <malloc+0x135>
+     7c2:	89 c7                	mov    %eax,%edi
+     7c4:	b8 00 00 00 00       	mov    $0x0,%eax
+     7c9:	e8 37 11 00 00       	call   1905 <printf>
+     7ce:	90                   	nop
+     7cf:	eb fd                	jmp    7ce <concurrent_create_test+0x46a>
+  assert(close(fd) >= 0);
+     7d1:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     7d4:	89 c7                	mov    %eax,%edi
+     7d6:	e8 f9 16 00 00       	call   1ed4 <close>
+     7db:	85 c0                	test   %eax,%eax
+     7dd:	79 2b                	jns    80a <concurrent_create_test+0x4a6>
+     7df:	8b 05 2b 21 00 00    	mov    0x212b(%rip),%eax        # 2910 <stdout>
+     7e5:	48 8d 15 2b 1b 00 00 	lea    0x1b2b(%rip),%rdx        # 2317 <malloc+0x224>
+     7ec:	48 89 d1             	mov    %rdx,%rcx
+     7ef:	ba 7f 00 00 00       	mov    $0x7f,%edx
+     7f4:	48 8d 35 2d 1a 00 00 	lea    0x1a2d(%rip),%rsi        # 2228 <malloc+0x135>
+     7fb:	89 c7                	mov    %eax,%edi
+     7fd:	b8 00 00 00 00       	mov    $0x0,%eax
+     802:	e8 fe 10 00 00       	call   1905 <printf>
+     807:	90                   	nop
+     808:	eb fd                	jmp    807 <concurrent_create_test+0x4a3>
+
+  printf(stdout, "concurrent create test OK\n");
+     80a:	8b 05 00 21 00 00    	mov    0x2100(%rip),%eax        # 2910 <stdout>
+     810:	48 8d 15 56 1b 00 00 	lea    0x1b56(%rip),%rdx        # 236d <malloc+0x27a>
+     817:	48 89 d6             	mov    %rdx,%rsi
+     81a:	89 c7                	mov    %eax,%edi
+     81c:	b8 00 00 00 00       	mov    $0x0,%eax
+     821:	e8 df 10 00 00       	call   1905 <printf>
+}
+     826:	90                   	nop
+     827:	c9                   	leave
+     828:	c3                   	ret
+
+0000000000000829 <concurrent_write_test>:
+
+void concurrent_write_test() {
+     829:	55                   	push   %rbp
+     82a:	48 89 e5             	mov    %rsp,%rbp
+     82d:	48 81 ec e0 00 00 00 	sub    $0xe0,%rsp
+  int i, j, pid, fd;
+  int map[50];
+  char buf[5];
+
+  fd = open("cc_write.txt", O_CREATE | O_WRONLY);
+     834:	be 01 02 00 00       	mov    $0x201,%esi
+     839:	48 8d 05 48 1b 00 00 	lea    0x1b48(%rip),%rax        # 2388 <malloc+0x295>
+     840:	48 89 c7             	mov    %rax,%rdi
+     843:	e8 a4 16 00 00       	call   1eec <open>
+     848:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  assert(fd == 3);
+     84b:	83 7d f4 03          	cmpl   $0x3,-0xc(%rbp)
+     84f:	74 2b                	je     87c <concurrent_write_test+0x53>
+     851:	8b 05 b9 20 00 00    	mov    0x20b9(%rip),%eax        # 2910 <stdout>
+     857:	48 8d 15 9a 1a 00 00 	lea    0x1a9a(%rip),%rdx        # 22f8 <malloc+0x205>
+     85e:	48 89 d1             	mov    %rdx,%rcx
+     861:	ba 8a 00 00 00       	mov    $0x8a,%edx
+     866:	48 8d 35 bb 19 00 00 	lea    0x19bb(%rip),%rsi        # 2228 <malloc+0x135>
+     86d:	89 c7                	mov    %eax,%edi
+     86f:	b8 00 00 00 00       	mov    $0x0,%eax
+     874:	e8 8c 10 00 00       	call   1905 <printf>
+     879:	90                   	nop
+     87a:	eb fd                	jmp    879 <concurrent_write_test+0x50>
+
+  for (i = 0; i < 50; i++) {
+     87c:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     883:	e9 02 01 00 00       	jmp    98a <concurrent_write_test+0x161>
+    pid = fork();
+     888:	e8 17 16 00 00       	call   1ea4 <fork>
+     88d:	89 45 f0             	mov    %eax,-0x10(%rbp)
+    if (pid == 0) {
+     890:	83 7d f0 00          	cmpl   $0x0,-0x10(%rbp)
+     894:	0f 85 88 00 00 00    	jne    922 <concurrent_write_test+0xf9>
+      for (j = 0; j < 5; j++) {
+     89a:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+     8a1:	eb 18                	jmp    8bb <concurrent_write_test+0x92>
+        buf[j] = i + 65;
+     8a3:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     8a6:	83 c0 41             	add    $0x41,%eax
+     8a9:	89 c2                	mov    %eax,%edx
+     8ab:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     8ae:	48 98                	cltq
+     8b0:	88 94 05 23 ff ff ff 	mov    %dl,-0xdd(%rbp,%rax,1)
+      for (j = 0; j < 5; j++) {
+     8b7:	83 45 f8 01          	addl   $0x1,-0x8(%rbp)
+     8bb:	83 7d f8 04          	cmpl   $0x4,-0x8(%rbp)
+     8bf:	7e e2                	jle    8a3 <concurrent_write_test+0x7a>
+      }
+
+//      printf(stdout, "i = %d and buf = %d %d %d %d %d \n", i, buf[0],buf[1],buf[2],buf[3],buf[4]);
+      for (j = 0; j < 20; j++) {
+     8c1:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+     8c8:	eb 4d                	jmp    917 <concurrent_write_test+0xee>
+        assert(write(fd, buf, 5) == 5);
+     8ca:	48 8d 8d 23 ff ff ff 	lea    -0xdd(%rbp),%rcx
+     8d1:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     8d4:	ba 05 00 00 00       	mov    $0x5,%edx
+     8d9:	48 89 ce             	mov    %rcx,%rsi
+     8dc:	89 c7                	mov    %eax,%edi
+     8de:	e8 e9 15 00 00       	call   1ecc <write>
+     8e3:	83 f8 05             	cmp    $0x5,%eax
+     8e6:	74 2b                	je     913 <concurrent_write_test+0xea>
+     8e8:	8b 05 22 20 00 00    	mov    0x2022(%rip),%eax        # 2910 <stdout>
+     8ee:	48 8d 15 0b 1a 00 00 	lea    0x1a0b(%rip),%rdx        # 2300 <malloc+0x20d>
+     8f5:	48 89 d1             	mov    %rdx,%rcx
+     8f8:	ba 95 00 00 00       	mov    $0x95,%edx
+     8fd:	48 8d 35 24 19 00 00 	lea    0x1924(%rip),%rsi        # 2228 <malloc+0x135>
+     904:	89 c7                	mov    %eax,%edi
+     906:	b8 00 00 00 00       	mov    $0x0,%eax
+     90b:	e8 f5 0f 00 00       	call   1905 <printf>
+     910:	90                   	nop
+     911:	eb fd                	jmp    910 <concurrent_write_test+0xe7>
+      for (j = 0; j < 20; j++) {
+     913:	83 45 f8 01          	addl   $0x1,-0x8(%rbp)
+     917:	83 7d f8 13          	cmpl   $0x13,-0x8(%rbp)
+     91b:	7e ad                	jle    8ca <concurrent_write_test+0xa1>
+      }
+
+      exit();
+     91d:	e8 8a 15 00 00       	call   1eac <exit>
+    } else if (pid < 0) {
+     922:	83 7d f0 00          	cmpl   $0x0,-0x10(%rbp)
+     926:	79 5e                	jns    986 <concurrent_write_test+0x15d>
+      error("fork() failed");
+     928:	8b 05 e2 1f 00 00    	mov    0x1fe2(%rip),%eax        # 2910 <stdout>
+     92e:	ba 9a 00 00 00       	mov    $0x9a,%edx
+     933:	48 8d 0d 69 19 00 00 	lea    0x1969(%rip),%rcx        # 22a3 <malloc+0x1b0>
+     93a:	48 89 ce             	mov    %rcx,%rsi
+     93d:	89 c7                	mov    %eax,%edi
+     93f:	b8 00 00 00 00       	mov    $0x0,%eax
+     944:	e8 bc 0f 00 00       	call   1905 <printf>
+     949:	8b 05 c1 1f 00 00    	mov    0x1fc1(%rip),%eax        # 2910 <stdout>
+     94f:	48 8d 15 5f 19 00 00 	lea    0x195f(%rip),%rdx        # 22b5 <malloc+0x1c2>
+     956:	48 89 d6             	mov    %rdx,%rsi
+     959:	89 c7                	mov    %eax,%edi
+     95b:	b8 00 00 00 00       	mov    $0x0,%eax
+     960:	e8 a0 0f 00 00       	call   1905 <printf>
+     965:	8b 05 a5 1f 00 00    	mov    0x1fa5(%rip),%eax        # 2910 <stdout>
+     96b:	48 8d 15 51 19 00 00 	lea    0x1951(%rip),%rdx        # 22c3 <malloc+0x1d0>
+     972:	48 89 d6             	mov    %rdx,%rsi
+     975:	89 c7                	mov    %eax,%edi
+     977:	b8 00 00 00 00       	mov    $0x0,%eax
+     97c:	e8 84 0f 00 00       	call   1905 <printf>
+     981:	e8 26 15 00 00       	call   1eac <exit>
+  for (i = 0; i < 50; i++) {
+     986:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     98a:	83 7d fc 31          	cmpl   $0x31,-0x4(%rbp)
+     98e:	0f 8e f4 fe ff ff    	jle    888 <concurrent_write_test+0x5f>
+    }
+  }
+
+  for (i = 0; i < 50; i++) {
+     994:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     99b:	eb 09                	jmp    9a6 <concurrent_write_test+0x17d>
+    wait();
+     99d:	e8 12 15 00 00       	call   1eb4 <wait>
+  for (i = 0; i < 50; i++) {
+     9a2:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     9a6:	83 7d fc 31          	cmpl   $0x31,-0x4(%rbp)
+     9aa:	7e f1                	jle    99d <concurrent_write_test+0x174>
+  }
+
+  // no more children
+  if (wait() >= 0) {
+     9ac:	e8 03 15 00 00       	call   1eb4 <wait>
+     9b1:	85 c0                	test   %eax,%eax
+     9b3:	78 5e                	js     a13 <concurrent_write_test+0x1ea>
+    error("ghost child!");
+     9b5:	8b 05 55 1f 00 00    	mov    0x1f55(%rip),%eax        # 2910 <stdout>
+     9bb:	ba a4 00 00 00       	mov    $0xa4,%edx
+     9c0:	48 8d 0d dc 18 00 00 	lea    0x18dc(%rip),%rcx        # 22a3 <malloc+0x1b0>
+     9c7:	48 89 ce             	mov    %rcx,%rsi
+     9ca:	89 c7                	mov    %eax,%edi
+     9cc:	b8 00 00 00 00       	mov    $0x0,%eax
+     9d1:	e8 2f 0f 00 00       	call   1905 <printf>
+     9d6:	8b 05 34 1f 00 00    	mov    0x1f34(%rip),%eax        # 2910 <stdout>
+     9dc:	48 8d 15 e2 18 00 00 	lea    0x18e2(%rip),%rdx        # 22c5 <malloc+0x1d2>
+     9e3:	48 89 d6             	mov    %rdx,%rsi
+     9e6:	89 c7                	mov    %eax,%edi
+     9e8:	b8 00 00 00 00       	mov    $0x0,%eax
+     9ed:	e8 13 0f 00 00       	call   1905 <printf>
+     9f2:	8b 05 18 1f 00 00    	mov    0x1f18(%rip),%eax        # 2910 <stdout>
+     9f8:	48 8d 15 c4 18 00 00 	lea    0x18c4(%rip),%rdx        # 22c3 <malloc+0x1d0>
+     9ff:	48 89 d6             	mov    %rdx,%rsi
+     a02:	89 c7                	mov    %eax,%edi
+     a04:	b8 00 00 00 00       	mov    $0x0,%eax
+     a09:	e8 f7 0e 00 00       	call   1905 <printf>
+     a0e:	e8 99 14 00 00       	call   1eac <exit>
+  }
+
+  assert(close(fd) >= 0);
+     a13:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     a16:	89 c7                	mov    %eax,%edi
+     a18:	e8 b7 14 00 00       	call   1ed4 <close>
+     a1d:	85 c0                	test   %eax,%eax
+     a1f:	79 2b                	jns    a4c <concurrent_write_test+0x223>
+     a21:	8b 05 e9 1e 00 00    	mov    0x1ee9(%rip),%eax        # 2910 <stdout>
+     a27:	48 8d 15 e9 18 00 00 	lea    0x18e9(%rip),%rdx        # 2317 <malloc+0x224>
+     a2e:	48 89 d1             	mov    %rdx,%rcx
+     a31:	ba a7 00 00 00       	mov    $0xa7,%edx
+     a36:	48 8d 35 eb 17 00 00 	lea    0x17eb(%rip),%rsi        # 2228 <malloc+0x135>
+     a3d:	89 c7                	mov    %eax,%edi
+     a3f:	b8 00 00 00 00       	mov    $0x0,%eax
+     a44:	e8 bc 0e 00 00       	call   1905 <printf>
+     a49:	90                   	nop
+     a4a:	eb fd                	jmp    a49 <concurrent_write_test+0x220>
+  fd = open("cc_write.txt", O_RDONLY);
+     a4c:	be 00 00 00 00       	mov    $0x0,%esi
+     a51:	48 8d 05 30 19 00 00 	lea    0x1930(%rip),%rax        # 2388 <malloc+0x295>
+     a58:	48 89 c7             	mov    %rax,%rdi
+     a5b:	e8 8c 14 00 00       	call   1eec <open>
+     a60:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  assert(fd == 3);
+     a63:	83 7d f4 03          	cmpl   $0x3,-0xc(%rbp)
+     a67:	74 2b                	je     a94 <concurrent_write_test+0x26b>
+     a69:	8b 05 a1 1e 00 00    	mov    0x1ea1(%rip),%eax        # 2910 <stdout>
+     a6f:	48 8d 15 82 18 00 00 	lea    0x1882(%rip),%rdx        # 22f8 <malloc+0x205>
+     a76:	48 89 d1             	mov    %rdx,%rcx
+     a79:	ba a9 00 00 00       	mov    $0xa9,%edx
+     a7e:	48 8d 35 a3 17 00 00 	lea    0x17a3(%rip),%rsi        # 2228 <malloc+0x135>
+     a85:	89 c7                	mov    %eax,%edi
+     a87:	b8 00 00 00 00       	mov    $0x0,%eax
+     a8c:	e8 74 0e 00 00       	call   1905 <printf>
+     a91:	90                   	nop
+     a92:	eb fd                	jmp    a91 <concurrent_write_test+0x268>
+
+  for (i = 0; i < 50; i++) {
+     a94:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     a9b:	eb 14                	jmp    ab1 <concurrent_write_test+0x288>
+    map[i] = 0;
+     a9d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     aa0:	48 98                	cltq
+     aa2:	c7 84 85 28 ff ff ff 	movl   $0x0,-0xd8(%rbp,%rax,4)
+     aa9:	00 00 00 00 
+  for (i = 0; i < 50; i++) {
+     aad:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     ab1:	83 7d fc 31          	cmpl   $0x31,-0x4(%rbp)
+     ab5:	7e e6                	jle    a9d <concurrent_write_test+0x274>
+  }
+
+  for (i = 0; i < 5000; i++) {
+     ab7:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     abe:	eb 45                	jmp    b05 <concurrent_write_test+0x2dc>
+    while (read(fd, buf, 1) <= 0);
+     ac0:	90                   	nop
+     ac1:	48 8d 8d 23 ff ff ff 	lea    -0xdd(%rbp),%rcx
+     ac8:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     acb:	ba 01 00 00 00       	mov    $0x1,%edx
+     ad0:	48 89 ce             	mov    %rcx,%rsi
+     ad3:	89 c7                	mov    %eax,%edi
+     ad5:	e8 ea 13 00 00       	call   1ec4 <read>
+     ada:	85 c0                	test   %eax,%eax
+     adc:	7e e3                	jle    ac1 <concurrent_write_test+0x298>
+    map[buf[0] - 65]++;
+     ade:	0f b6 85 23 ff ff ff 	movzbl -0xdd(%rbp),%eax
+     ae5:	0f be c0             	movsbl %al,%eax
+     ae8:	83 e8 41             	sub    $0x41,%eax
+     aeb:	48 63 d0             	movslq %eax,%rdx
+     aee:	8b 94 95 28 ff ff ff 	mov    -0xd8(%rbp,%rdx,4),%edx
+     af5:	83 c2 01             	add    $0x1,%edx
+     af8:	48 98                	cltq
+     afa:	89 94 85 28 ff ff ff 	mov    %edx,-0xd8(%rbp,%rax,4)
+  for (i = 0; i < 5000; i++) {
+     b01:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     b05:	81 7d fc 87 13 00 00 	cmpl   $0x1387,-0x4(%rbp)
+     b0c:	7e b2                	jle    ac0 <concurrent_write_test+0x297>
+  }
+
+  // EOF
+  assert(read(fd, buf, 1) == 0);
+     b0e:	48 8d 8d 23 ff ff ff 	lea    -0xdd(%rbp),%rcx
+     b15:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     b18:	ba 01 00 00 00       	mov    $0x1,%edx
+     b1d:	48 89 ce             	mov    %rcx,%rsi
+     b20:	89 c7                	mov    %eax,%edi
+     b22:	e8 9d 13 00 00       	call   1ec4 <read>
+     b27:	85 c0                	test   %eax,%eax
+     b29:	74 2b                	je     b56 <concurrent_write_test+0x32d>
+     b2b:	8b 05 df 1d 00 00    	mov    0x1ddf(%rip),%eax        # 2910 <stdout>
+     b31:	48 8d 15 1f 18 00 00 	lea    0x181f(%rip),%rdx        # 2357 <malloc+0x264>
+     b38:	48 89 d1             	mov    %rdx,%rcx
+     b3b:	ba b5 00 00 00       	mov    $0xb5,%edx
+     b40:	48 8d 35 e1 16 00 00 	lea    0x16e1(%rip),%rsi        # 2228 <malloc+0x135>
+     b47:	89 c7                	mov    %eax,%edi
+     b49:	b8 00 00 00 00       	mov    $0x0,%eax
+     b4e:	e8 b2 0d 00 00       	call   1905 <printf>
+     b53:	90                   	nop
+     b54:	eb fd                	jmp    b53 <concurrent_write_test+0x32a>
+  assert(close(fd) >= 0);
+     b56:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     b59:	89 c7                	mov    %eax,%edi
+     b5b:	e8 74 13 00 00       	call   1ed4 <close>
+     b60:	85 c0                	test   %eax,%eax
+     b62:	79 2b                	jns    b8f <concurrent_write_test+0x366>
+     b64:	8b 05 a6 1d 00 00    	mov    0x1da6(%rip),%eax        # 2910 <stdout>
+     b6a:	48 8d 15 a6 17 00 00 	lea    0x17a6(%rip),%rdx        # 2317 <malloc+0x224>
+     b71:	48 89 d1             	mov    %rdx,%rcx
+     b74:	ba b6 00 00 00       	mov    $0xb6,%edx
+     b79:	48 8d 35 a8 16 00 00 	lea    0x16a8(%rip),%rsi        # 2228 <malloc+0x135>
+     b80:	89 c7                	mov    %eax,%edi
+     b82:	b8 00 00 00 00       	mov    $0x0,%eax
+     b87:	e8 79 0d 00 00       	call   1905 <printf>
+     b8c:	90                   	nop
+     b8d:	eb fd                	jmp    b8c <concurrent_write_test+0x363>
+
+  for (i = 0; i < 50; i++) {
+     b8f:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     b96:	eb 76                	jmp    c0e <concurrent_write_test+0x3e5>
+    if (map[i] != 100)
+     b98:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     b9b:	48 98                	cltq
+     b9d:	8b 84 85 28 ff ff ff 	mov    -0xd8(%rbp,%rax,4),%eax
+     ba4:	83 f8 64             	cmp    $0x64,%eax
+     ba7:	74 61                	je     c0a <concurrent_write_test+0x3e1>
+      error("missing byte from child %d", i);
+     ba9:	8b 05 61 1d 00 00    	mov    0x1d61(%rip),%eax        # 2910 <stdout>
+     baf:	ba ba 00 00 00       	mov    $0xba,%edx
+     bb4:	48 8d 0d e8 16 00 00 	lea    0x16e8(%rip),%rcx        # 22a3 <malloc+0x1b0>
+     bbb:	48 89 ce             	mov    %rcx,%rsi
+     bbe:	89 c7                	mov    %eax,%edi
+     bc0:	b8 00 00 00 00       	mov    $0x0,%eax
+     bc5:	e8 3b 0d 00 00       	call   1905 <printf>
+     bca:	8b 05 40 1d 00 00    	mov    0x1d40(%rip),%eax        # 2910 <stdout>
+     bd0:	8b 55 fc             	mov    -0x4(%rbp),%edx
+     bd3:	48 8d 0d bb 17 00 00 	lea    0x17bb(%rip),%rcx        # 2395 <malloc+0x2a2>
+     bda:	48 89 ce             	mov    %rcx,%rsi
+     bdd:	89 c7                	mov    %eax,%edi
+     bdf:	b8 00 00 00 00       	mov    $0x0,%eax
+     be4:	e8 1c 0d 00 00       	call   1905 <printf>
+     be9:	8b 05 21 1d 00 00    	mov    0x1d21(%rip),%eax        # 2910 <stdout>
+     bef:	48 8d 15 cd 16 00 00 	lea    0x16cd(%rip),%rdx        # 22c3 <malloc+0x1d0>
+     bf6:	48 89 d6             	mov    %rdx,%rsi
+     bf9:	89 c7                	mov    %eax,%edi
+     bfb:	b8 00 00 00 00       	mov    $0x0,%eax
+     c00:	e8 00 0d 00 00       	call   1905 <printf>
+     c05:	e8 a2 12 00 00       	call   1eac <exit>
+  for (i = 0; i < 50; i++) {
+     c0a:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     c0e:	83 7d fc 31          	cmpl   $0x31,-0x4(%rbp)
+     c12:	7e 84                	jle    b98 <concurrent_write_test+0x36f>
+  }
+  printf(stdout, "concurrent write test OK\n");
+     c14:	8b 05 f6 1c 00 00    	mov    0x1cf6(%rip),%eax        # 2910 <stdout>
+     c1a:	48 8d 15 8f 17 00 00 	lea    0x178f(%rip),%rdx        # 23b0 <malloc+0x2bd>
+     c21:	48 89 d6             	mov    %rdx,%rsi
+     c24:	89 c7                	mov    %eax,%edi
+     c26:	b8 00 00 00 00       	mov    $0x0,%eax
+     c2b:	e8 d5 0c 00 00       	call   1905 <printf>
+}
+     c30:	90                   	nop
+     c31:	c9                   	leave
+     c32:	c3                   	ret
+
+0000000000000c33 <concurrent_read_test>:
+
+void concurrent_read_test() {
+     c33:	55                   	push   %rbp
+     c34:	48 89 e5             	mov    %rsp,%rbp
+     c37:	48 83 ec 20          	sub    $0x20,%rsp
+  int i, j, pid, fd;
+  uchar buf[5];
+
+  fd = open("cc_write.txt", O_CREATE | O_WRONLY);
+     c3b:	be 01 02 00 00       	mov    $0x201,%esi
+     c40:	48 8d 05 41 17 00 00 	lea    0x1741(%rip),%rax        # 2388 <malloc+0x295>
+     c47:	48 89 c7             	mov    %rax,%rdi
+     c4a:	e8 9d 12 00 00       	call   1eec <open>
+     c4f:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  assert(fd == 3);
+     c52:	83 7d f4 03          	cmpl   $0x3,-0xc(%rbp)
+     c56:	74 2b                	je     c83 <concurrent_read_test+0x50>
+     c58:	8b 05 b2 1c 00 00    	mov    0x1cb2(%rip),%eax        # 2910 <stdout>
+     c5e:	48 8d 15 93 16 00 00 	lea    0x1693(%rip),%rdx        # 22f8 <malloc+0x205>
+     c65:	48 89 d1             	mov    %rdx,%rcx
+     c68:	ba c4 00 00 00       	mov    $0xc4,%edx
+     c6d:	48 8d 35 b4 15 00 00 	lea    0x15b4(%rip),%rsi        # 2228 <malloc+0x135>
+     c74:	89 c7                	mov    %eax,%edi
+     c76:	b8 00 00 00 00       	mov    $0x0,%eax
+     c7b:	e8 85 0c 00 00       	call   1905 <printf>
+     c80:	90                   	nop
+     c81:	eb fd                	jmp    c80 <concurrent_read_test+0x4d>
+
+  for (i = 0; i < 250; i++) {
+     c83:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     c8a:	eb 7e                	jmp    d0a <concurrent_read_test+0xd7>
+    for (j = 0; j < 5; j++) {
+     c8c:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+     c93:	eb 12                	jmp    ca7 <concurrent_read_test+0x74>
+      buf[j] = i;
+     c95:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     c98:	89 c2                	mov    %eax,%edx
+     c9a:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     c9d:	48 98                	cltq
+     c9f:	88 54 05 eb          	mov    %dl,-0x15(%rbp,%rax,1)
+    for (j = 0; j < 5; j++) {
+     ca3:	83 45 f8 01          	addl   $0x1,-0x8(%rbp)
+     ca7:	83 7d f8 04          	cmpl   $0x4,-0x8(%rbp)
+     cab:	7e e8                	jle    c95 <concurrent_read_test+0x62>
+    }
+    for (j = 0; j < 4; j++) {
+     cad:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+     cb4:	eb 4a                	jmp    d00 <concurrent_read_test+0xcd>
+      assert(write(fd, buf, 5) == 5);
+     cb6:	48 8d 4d eb          	lea    -0x15(%rbp),%rcx
+     cba:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     cbd:	ba 05 00 00 00       	mov    $0x5,%edx
+     cc2:	48 89 ce             	mov    %rcx,%rsi
+     cc5:	89 c7                	mov    %eax,%edi
+     cc7:	e8 00 12 00 00       	call   1ecc <write>
+     ccc:	83 f8 05             	cmp    $0x5,%eax
+     ccf:	74 2b                	je     cfc <concurrent_read_test+0xc9>
+     cd1:	8b 05 39 1c 00 00    	mov    0x1c39(%rip),%eax        # 2910 <stdout>
+     cd7:	48 8d 15 22 16 00 00 	lea    0x1622(%rip),%rdx        # 2300 <malloc+0x20d>
+     cde:	48 89 d1             	mov    %rdx,%rcx
+     ce1:	ba cb 00 00 00       	mov    $0xcb,%edx
+     ce6:	48 8d 35 3b 15 00 00 	lea    0x153b(%rip),%rsi        # 2228 <malloc+0x135>
+     ced:	89 c7                	mov    %eax,%edi
+     cef:	b8 00 00 00 00       	mov    $0x0,%eax
+     cf4:	e8 0c 0c 00 00       	call   1905 <printf>
+     cf9:	90                   	nop
+     cfa:	eb fd                	jmp    cf9 <concurrent_read_test+0xc6>
+    for (j = 0; j < 4; j++) {
+     cfc:	83 45 f8 01          	addl   $0x1,-0x8(%rbp)
+     d00:	83 7d f8 03          	cmpl   $0x3,-0x8(%rbp)
+     d04:	7e b0                	jle    cb6 <concurrent_read_test+0x83>
+  for (i = 0; i < 250; i++) {
+     d06:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     d0a:	81 7d fc f9 00 00 00 	cmpl   $0xf9,-0x4(%rbp)
+     d11:	0f 8e 75 ff ff ff    	jle    c8c <concurrent_read_test+0x59>
+    }
+  }
+
+  assert(close(fd) >= 0);
+     d17:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     d1a:	89 c7                	mov    %eax,%edi
+     d1c:	e8 b3 11 00 00       	call   1ed4 <close>
+     d21:	85 c0                	test   %eax,%eax
+     d23:	79 2b                	jns    d50 <concurrent_read_test+0x11d>
+     d25:	8b 05 e5 1b 00 00    	mov    0x1be5(%rip),%eax        # 2910 <stdout>
+     d2b:	48 8d 15 e5 15 00 00 	lea    0x15e5(%rip),%rdx        # 2317 <malloc+0x224>
+     d32:	48 89 d1             	mov    %rdx,%rcx
+     d35:	ba cf 00 00 00       	mov    $0xcf,%edx
+     d3a:	48 8d 35 e7 14 00 00 	lea    0x14e7(%rip),%rsi        # 2228 <malloc+0x135>
+     d41:	89 c7                	mov    %eax,%edi
+     d43:	b8 00 00 00 00       	mov    $0x0,%eax
+     d48:	e8 b8 0b 00 00       	call   1905 <printf>
+     d4d:	90                   	nop
+     d4e:	eb fd                	jmp    d4d <concurrent_read_test+0x11a>
+  fd = open("cc_write.txt", O_RDONLY);
+     d50:	be 00 00 00 00       	mov    $0x0,%esi
+     d55:	48 8d 05 2c 16 00 00 	lea    0x162c(%rip),%rax        # 2388 <malloc+0x295>
+     d5c:	48 89 c7             	mov    %rax,%rdi
+     d5f:	e8 88 11 00 00       	call   1eec <open>
+     d64:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  assert(fd == 3);
+     d67:	83 7d f4 03          	cmpl   $0x3,-0xc(%rbp)
+     d6b:	74 2b                	je     d98 <concurrent_read_test+0x165>
+     d6d:	8b 05 9d 1b 00 00    	mov    0x1b9d(%rip),%eax        # 2910 <stdout>
+     d73:	48 8d 15 7e 15 00 00 	lea    0x157e(%rip),%rdx        # 22f8 <malloc+0x205>
+     d7a:	48 89 d1             	mov    %rdx,%rcx
+     d7d:	ba d1 00 00 00       	mov    $0xd1,%edx
+     d82:	48 8d 35 9f 14 00 00 	lea    0x149f(%rip),%rsi        # 2228 <malloc+0x135>
+     d89:	89 c7                	mov    %eax,%edi
+     d8b:	b8 00 00 00 00       	mov    $0x0,%eax
+     d90:	e8 70 0b 00 00       	call   1905 <printf>
+     d95:	90                   	nop
+     d96:	eb fd                	jmp    d95 <concurrent_read_test+0x162>
+
+  buf[0] = 0;
+     d98:	c6 45 eb 00          	movb   $0x0,-0x15(%rbp)
+  for (i = 0; i < 50; i++) {
+     d9c:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     da3:	e9 3c 01 00 00       	jmp    ee4 <concurrent_read_test+0x2b1>
+    pid = fork();
+     da8:	e8 f7 10 00 00       	call   1ea4 <fork>
+     dad:	89 45 f0             	mov    %eax,-0x10(%rbp)
+    if (pid == 0) {
+     db0:	83 7d f0 00          	cmpl   $0x0,-0x10(%rbp)
+     db4:	0f 85 c2 00 00 00    	jne    e7c <concurrent_read_test+0x249>
+      for (j = 0; j < 100; j++) {
+     dba:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+     dc1:	e9 a7 00 00 00       	jmp    e6d <concurrent_read_test+0x23a>
+        while (read(fd, buf + 1, 1) <= 0);
+     dc6:	90                   	nop
+     dc7:	48 8d 45 eb          	lea    -0x15(%rbp),%rax
+     dcb:	48 83 c0 01          	add    $0x1,%rax
+     dcf:	8b 4d f4             	mov    -0xc(%rbp),%ecx
+     dd2:	ba 01 00 00 00       	mov    $0x1,%edx
+     dd7:	48 89 c6             	mov    %rax,%rsi
+     dda:	89 cf                	mov    %ecx,%edi
+     ddc:	e8 e3 10 00 00       	call   1ec4 <read>
+     de1:	85 c0                	test   %eax,%eax
+     de3:	7e e2                	jle    dc7 <concurrent_read_test+0x194>
+        if (buf[1] >= buf[0]) {
+     de5:	0f b6 55 ec          	movzbl -0x14(%rbp),%edx
+     de9:	0f b6 45 eb          	movzbl -0x15(%rbp),%eax
+     ded:	38 c2                	cmp    %al,%dl
+     def:	72 09                	jb     dfa <concurrent_read_test+0x1c7>
+          buf[0] = buf[1];
+     df1:	0f b6 45 ec          	movzbl -0x14(%rbp),%eax
+     df5:	88 45 eb             	mov    %al,-0x15(%rbp)
+     df8:	eb 6f                	jmp    e69 <concurrent_read_test+0x236>
+        } else {
+          error("read out of order: read %d before %d in child %d", buf[0], buf[1], i);
+     dfa:	8b 05 10 1b 00 00    	mov    0x1b10(%rip),%eax        # 2910 <stdout>
+     e00:	ba dc 00 00 00       	mov    $0xdc,%edx
+     e05:	48 8d 0d 97 14 00 00 	lea    0x1497(%rip),%rcx        # 22a3 <malloc+0x1b0>
+     e0c:	48 89 ce             	mov    %rcx,%rsi
+     e0f:	89 c7                	mov    %eax,%edi
+     e11:	b8 00 00 00 00       	mov    $0x0,%eax
+     e16:	e8 ea 0a 00 00       	call   1905 <printf>
+     e1b:	0f b6 45 ec          	movzbl -0x14(%rbp),%eax
+     e1f:	0f b6 c8             	movzbl %al,%ecx
+     e22:	0f b6 45 eb          	movzbl -0x15(%rbp),%eax
+     e26:	0f b6 d0             	movzbl %al,%edx
+     e29:	8b 05 e1 1a 00 00    	mov    0x1ae1(%rip),%eax        # 2910 <stdout>
+     e2f:	8b 75 fc             	mov    -0x4(%rbp),%esi
+     e32:	41 89 f0             	mov    %esi,%r8d
+     e35:	48 8d 35 94 15 00 00 	lea    0x1594(%rip),%rsi        # 23d0 <malloc+0x2dd>
+     e3c:	89 c7                	mov    %eax,%edi
+     e3e:	b8 00 00 00 00       	mov    $0x0,%eax
+     e43:	e8 bd 0a 00 00       	call   1905 <printf>
+     e48:	8b 05 c2 1a 00 00    	mov    0x1ac2(%rip),%eax        # 2910 <stdout>
+     e4e:	48 8d 15 6e 14 00 00 	lea    0x146e(%rip),%rdx        # 22c3 <malloc+0x1d0>
+     e55:	48 89 d6             	mov    %rdx,%rsi
+     e58:	89 c7                	mov    %eax,%edi
+     e5a:	b8 00 00 00 00       	mov    $0x0,%eax
+     e5f:	e8 a1 0a 00 00       	call   1905 <printf>
+     e64:	e8 43 10 00 00       	call   1eac <exit>
+      for (j = 0; j < 100; j++) {
+     e69:	83 45 f8 01          	addl   $0x1,-0x8(%rbp)
+     e6d:	83 7d f8 63          	cmpl   $0x63,-0x8(%rbp)
+     e71:	0f 8e 4f ff ff ff    	jle    dc6 <concurrent_read_test+0x193>
+        }
+      }
+      exit();
+     e77:	e8 30 10 00 00       	call   1eac <exit>
+    } else if (pid < 0) {
+     e7c:	83 7d f0 00          	cmpl   $0x0,-0x10(%rbp)
+     e80:	79 5e                	jns    ee0 <concurrent_read_test+0x2ad>
+      error("fork() failed");
+     e82:	8b 05 88 1a 00 00    	mov    0x1a88(%rip),%eax        # 2910 <stdout>
+     e88:	ba e1 00 00 00       	mov    $0xe1,%edx
+     e8d:	48 8d 0d 0f 14 00 00 	lea    0x140f(%rip),%rcx        # 22a3 <malloc+0x1b0>
+     e94:	48 89 ce             	mov    %rcx,%rsi
+     e97:	89 c7                	mov    %eax,%edi
+     e99:	b8 00 00 00 00       	mov    $0x0,%eax
+     e9e:	e8 62 0a 00 00       	call   1905 <printf>
+     ea3:	8b 05 67 1a 00 00    	mov    0x1a67(%rip),%eax        # 2910 <stdout>
+     ea9:	48 8d 15 05 14 00 00 	lea    0x1405(%rip),%rdx        # 22b5 <malloc+0x1c2>
+     eb0:	48 89 d6             	mov    %rdx,%rsi
+     eb3:	89 c7                	mov    %eax,%edi
+     eb5:	b8 00 00 00 00       	mov    $0x0,%eax
+     eba:	e8 46 0a 00 00       	call   1905 <printf>
+     ebf:	8b 05 4b 1a 00 00    	mov    0x1a4b(%rip),%eax        # 2910 <stdout>
+     ec5:	48 8d 15 f7 13 00 00 	lea    0x13f7(%rip),%rdx        # 22c3 <malloc+0x1d0>
+     ecc:	48 89 d6             	mov    %rdx,%rsi
+     ecf:	89 c7                	mov    %eax,%edi
+     ed1:	b8 00 00 00 00       	mov    $0x0,%eax
+     ed6:	e8 2a 0a 00 00       	call   1905 <printf>
+     edb:	e8 cc 0f 00 00       	call   1eac <exit>
+  for (i = 0; i < 50; i++) {
+     ee0:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     ee4:	83 7d fc 31          	cmpl   $0x31,-0x4(%rbp)
+     ee8:	0f 8e ba fe ff ff    	jle    da8 <concurrent_read_test+0x175>
+    }
+  }
+
+  for (i = 0; i < 50; i++) {
+     eee:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     ef5:	eb 09                	jmp    f00 <concurrent_read_test+0x2cd>
+    wait();
+     ef7:	e8 b8 0f 00 00       	call   1eb4 <wait>
+  for (i = 0; i < 50; i++) {
+     efc:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     f00:	83 7d fc 31          	cmpl   $0x31,-0x4(%rbp)
+     f04:	7e f1                	jle    ef7 <concurrent_read_test+0x2c4>
+  }
+
+  // no more children
+  if (wait() >= 0) {
+     f06:	e8 a9 0f 00 00       	call   1eb4 <wait>
+     f0b:	85 c0                	test   %eax,%eax
+     f0d:	78 5e                	js     f6d <concurrent_read_test+0x33a>
+    error("ghost child!");
+     f0f:	8b 05 fb 19 00 00    	mov    0x19fb(%rip),%eax        # 2910 <stdout>
+     f15:	ba eb 00 00 00       	mov    $0xeb,%edx
+     f1a:	48 8d 0d 82 13 00 00 	lea    0x1382(%rip),%rcx        # 22a3 <malloc+0x1b0>
+     f21:	48 89 ce             	mov    %rcx,%rsi
+     f24:	89 c7                	mov    %eax,%edi
+     f26:	b8 00 00 00 00       	mov    $0x0,%eax
+     f2b:	e8 d5 09 00 00       	call   1905 <printf>
+     f30:	8b 05 da 19 00 00    	mov    0x19da(%rip),%eax        # 2910 <stdout>
+     f36:	48 8d 15 88 13 00 00 	lea    0x1388(%rip),%rdx        # 22c5 <malloc+0x1d2>
+     f3d:	48 89 d6             	mov    %rdx,%rsi
+     f40:	89 c7                	mov    %eax,%edi
+     f42:	b8 00 00 00 00       	mov    $0x0,%eax
+     f47:	e8 b9 09 00 00       	call   1905 <printf>
+     f4c:	8b 05 be 19 00 00    	mov    0x19be(%rip),%eax        # 2910 <stdout>
+     f52:	48 8d 15 6a 13 00 00 	lea    0x136a(%rip),%rdx        # 22c3 <malloc+0x1d0>
+     f59:	48 89 d6             	mov    %rdx,%rsi
+     f5c:	89 c7                	mov    %eax,%edi
+     f5e:	b8 00 00 00 00       	mov    $0x0,%eax
+     f63:	e8 9d 09 00 00       	call   1905 <printf>
+     f68:	e8 3f 0f 00 00       	call   1eac <exit>
+  }
+
+  assert(read(fd, buf, 1) == 0);
+     f6d:	48 8d 4d eb          	lea    -0x15(%rbp),%rcx
+     f71:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     f74:	ba 01 00 00 00       	mov    $0x1,%edx
+     f79:	48 89 ce             	mov    %rcx,%rsi
+     f7c:	89 c7                	mov    %eax,%edi
+     f7e:	e8 41 0f 00 00       	call   1ec4 <read>
+     f83:	85 c0                	test   %eax,%eax
+     f85:	74 2b                	je     fb2 <concurrent_read_test+0x37f>
+     f87:	8b 05 83 19 00 00    	mov    0x1983(%rip),%eax        # 2910 <stdout>
+     f8d:	48 8d 15 c3 13 00 00 	lea    0x13c3(%rip),%rdx        # 2357 <malloc+0x264>
+     f94:	48 89 d1             	mov    %rdx,%rcx
+     f97:	ba ee 00 00 00       	mov    $0xee,%edx
+     f9c:	48 8d 35 85 12 00 00 	lea    0x1285(%rip),%rsi        # 2228 <malloc+0x135>
+     fa3:	89 c7                	mov    %eax,%edi
+     fa5:	b8 00 00 00 00       	mov    $0x0,%eax
+     faa:	e8 56 09 00 00       	call   1905 <printf>
+     faf:	90                   	nop
+     fb0:	eb fd                	jmp    faf <concurrent_read_test+0x37c>
+  assert(close(fd) >= 0);
+     fb2:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     fb5:	89 c7                	mov    %eax,%edi
+     fb7:	e8 18 0f 00 00       	call   1ed4 <close>
+     fbc:	85 c0                	test   %eax,%eax
+     fbe:	79 2b                	jns    feb <concurrent_read_test+0x3b8>
+     fc0:	8b 05 4a 19 00 00    	mov    0x194a(%rip),%eax        # 2910 <stdout>
+     fc6:	48 8d 15 4a 13 00 00 	lea    0x134a(%rip),%rdx        # 2317 <malloc+0x224>
+     fcd:	48 89 d1             	mov    %rdx,%rcx
+     fd0:	ba ef 00 00 00       	mov    $0xef,%edx
+     fd5:	48 8d 35 4c 12 00 00 	lea    0x124c(%rip),%rsi        # 2228 <malloc+0x135>
+     fdc:	89 c7                	mov    %eax,%edi
+     fde:	b8 00 00 00 00       	mov    $0x0,%eax
+     fe3:	e8 1d 09 00 00       	call   1905 <printf>
+     fe8:	90                   	nop
+     fe9:	eb fd                	jmp    fe8 <concurrent_read_test+0x3b5>
+
+  printf(stdout, "concurrent read test OK\n");
+     feb:	8b 05 1f 19 00 00    	mov    0x191f(%rip),%eax        # 2910 <stdout>
+     ff1:	48 8d 15 09 14 00 00 	lea    0x1409(%rip),%rdx        # 2401 <malloc+0x30e>
+     ff8:	48 89 d6             	mov    %rdx,%rsi
+     ffb:	89 c7                	mov    %eax,%edi
+     ffd:	b8 00 00 00 00       	mov    $0x0,%eax
+    1002:	e8 fe 08 00 00       	call   1905 <printf>
+}
+    1007:	90                   	nop
+    1008:	c9                   	leave
+    1009:	c3                   	ret
+
+000000000000100a <concurrent_delete_test>:
+
+void concurrent_delete_test() {
+    100a:	55                   	push   %rbp
+    100b:	48 89 e5             	mov    %rsp,%rbp
+    100e:	48 83 ec 20          	sub    $0x20,%rsp
+  int pipes[2];
+  pipe(pipes);
+    1012:	48 8d 45 e8          	lea    -0x18(%rbp),%rax
+    1016:	48 89 c7             	mov    %rax,%rdi
+    1019:	e8 9e 0e 00 00       	call   1ebc <pipe>
+  char buf[2];
+  int fd = open("cc_del", O_RDWR | O_CREATE);
+    101e:	be 02 02 00 00       	mov    $0x202,%esi
+    1023:	48 8d 05 f0 13 00 00 	lea    0x13f0(%rip),%rax        # 241a <malloc+0x327>
+    102a:	48 89 c7             	mov    %rax,%rdi
+    102d:	e8 ba 0e 00 00       	call   1eec <open>
+    1032:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  if (fd < 0)
+    1035:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+    1039:	79 5e                	jns    1099 <concurrent_delete_test+0x8f>
+    error("open failed");
+    103b:	8b 05 cf 18 00 00    	mov    0x18cf(%rip),%eax        # 2910 <stdout>
+    1041:	ba fa 00 00 00       	mov    $0xfa,%edx
+    1046:	48 8d 0d 56 12 00 00 	lea    0x1256(%rip),%rcx        # 22a3 <malloc+0x1b0>
+    104d:	48 89 ce             	mov    %rcx,%rsi
+    1050:	89 c7                	mov    %eax,%edi
+    1052:	b8 00 00 00 00       	mov    $0x0,%eax
+    1057:	e8 a9 08 00 00       	call   1905 <printf>
+    105c:	8b 05 ae 18 00 00    	mov    0x18ae(%rip),%eax        # 2910 <stdout>
+    1062:	48 8d 15 b8 13 00 00 	lea    0x13b8(%rip),%rdx        # 2421 <malloc+0x32e>
+    1069:	48 89 d6             	mov    %rdx,%rsi
+    106c:	89 c7                	mov    %eax,%edi
+    106e:	b8 00 00 00 00       	mov    $0x0,%eax
+    1073:	e8 8d 08 00 00       	call   1905 <printf>
+    1078:	8b 05 92 18 00 00    	mov    0x1892(%rip),%eax        # 2910 <stdout>
+    107e:	48 8d 15 3e 12 00 00 	lea    0x123e(%rip),%rdx        # 22c3 <malloc+0x1d0>
+    1085:	48 89 d6             	mov    %rdx,%rsi
+    1088:	89 c7                	mov    %eax,%edi
+    108a:	b8 00 00 00 00       	mov    $0x0,%eax
+    108f:	e8 71 08 00 00       	call   1905 <printf>
+    1094:	e8 13 0e 00 00       	call   1eac <exit>
+
+  for (int i = 0; i < 50; ++i) {
+    1099:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+    10a0:	eb 42                	jmp    10e4 <concurrent_delete_test+0xda>
+    int pid = fork();
+    10a2:	e8 fd 0d 00 00       	call   1ea4 <fork>
+    10a7:	89 45 f0             	mov    %eax,-0x10(%rbp)
+    if (pid != 0)
+    10aa:	83 7d f0 00          	cmpl   $0x0,-0x10(%rbp)
+    10ae:	75 2f                	jne    10df <concurrent_delete_test+0xd5>
+      continue;
+    if (unlink("cc_del") != -1)
+    10b0:	48 8d 05 63 13 00 00 	lea    0x1363(%rip),%rax        # 241a <malloc+0x327>
+    10b7:	48 89 c7             	mov    %rax,%rdi
+    10ba:	e8 3d 0e 00 00       	call   1efc <unlink>
+    10bf:	83 f8 ff             	cmp    $0xffffffff,%eax
+    10c2:	74 16                	je     10da <concurrent_delete_test+0xd0>
+      write(pipes[1], &buf, 1);
+    10c4:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    10c7:	48 8d 4d e6          	lea    -0x1a(%rbp),%rcx
+    10cb:	ba 01 00 00 00       	mov    $0x1,%edx
+    10d0:	48 89 ce             	mov    %rcx,%rsi
+    10d3:	89 c7                	mov    %eax,%edi
+    10d5:	e8 f2 0d 00 00       	call   1ecc <write>
+    exit();
+    10da:	e8 cd 0d 00 00       	call   1eac <exit>
+      continue;
+    10df:	90                   	nop
+  for (int i = 0; i < 50; ++i) {
+    10e0:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+    10e4:	83 7d fc 31          	cmpl   $0x31,-0x4(%rbp)
+    10e8:	7e b8                	jle    10a2 <concurrent_delete_test+0x98>
+  }
+  for (int i = 0; i < 50; ++i)
+    10ea:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+    10f1:	eb 09                	jmp    10fc <concurrent_delete_test+0xf2>
+    wait();
+    10f3:	e8 bc 0d 00 00       	call   1eb4 <wait>
+  for (int i = 0; i < 50; ++i)
+    10f8:	83 45 f8 01          	addl   $0x1,-0x8(%rbp)
+    10fc:	83 7d f8 31          	cmpl   $0x31,-0x8(%rbp)
+    1100:	7e f1                	jle    10f3 <concurrent_delete_test+0xe9>
+  close(pipes[1]);
+    1102:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    1105:	89 c7                	mov    %eax,%edi
+    1107:	e8 c8 0d 00 00       	call   1ed4 <close>
+  if (2 == read(pipes[0], &buf, 2))
+    110c:	8b 45 e8             	mov    -0x18(%rbp),%eax
+    110f:	48 8d 4d e6          	lea    -0x1a(%rbp),%rcx
+    1113:	ba 02 00 00 00       	mov    $0x2,%edx
+    1118:	48 89 ce             	mov    %rcx,%rsi
+    111b:	89 c7                	mov    %eax,%edi
+    111d:	e8 a2 0d 00 00       	call   1ec4 <read>
+    1122:	83 f8 02             	cmp    $0x2,%eax
+    1125:	75 5e                	jne    1185 <concurrent_delete_test+0x17b>
+    error("File deleted multiple times");
+    1127:	8b 05 e3 17 00 00    	mov    0x17e3(%rip),%eax        # 2910 <stdout>
+    112d:	ba 08 01 00 00       	mov    $0x108,%edx
+    1132:	48 8d 0d 6a 11 00 00 	lea    0x116a(%rip),%rcx        # 22a3 <malloc+0x1b0>
+    1139:	48 89 ce             	mov    %rcx,%rsi
+    113c:	89 c7                	mov    %eax,%edi
+    113e:	b8 00 00 00 00       	mov    $0x0,%eax
+    1143:	e8 bd 07 00 00       	call   1905 <printf>
+    1148:	8b 05 c2 17 00 00    	mov    0x17c2(%rip),%eax        # 2910 <stdout>
+    114e:	48 8d 15 d8 12 00 00 	lea    0x12d8(%rip),%rdx        # 242d <malloc+0x33a>
+    1155:	48 89 d6             	mov    %rdx,%rsi
+    1158:	89 c7                	mov    %eax,%edi
+    115a:	b8 00 00 00 00       	mov    $0x0,%eax
+    115f:	e8 a1 07 00 00       	call   1905 <printf>
+    1164:	8b 05 a6 17 00 00    	mov    0x17a6(%rip),%eax        # 2910 <stdout>
+    116a:	48 8d 15 52 11 00 00 	lea    0x1152(%rip),%rdx        # 22c3 <malloc+0x1d0>
+    1171:	48 89 d6             	mov    %rdx,%rsi
+    1174:	89 c7                	mov    %eax,%edi
+    1176:	b8 00 00 00 00       	mov    $0x0,%eax
+    117b:	e8 85 07 00 00       	call   1905 <printf>
+    1180:	e8 27 0d 00 00       	call   1eac <exit>
+ printf(stdout, "concurrent delete test OK\n");
+    1185:	8b 05 85 17 00 00    	mov    0x1785(%rip),%eax        # 2910 <stdout>
+    118b:	48 8d 15 b7 12 00 00 	lea    0x12b7(%rip),%rdx        # 2449 <malloc+0x356>
+    1192:	48 89 d6             	mov    %rdx,%rsi
+    1195:	89 c7                	mov    %eax,%edi
+    1197:	b8 00 00 00 00       	mov    $0x0,%eax
+    119c:	e8 64 07 00 00       	call   1905 <printf>
+
+}
+    11a1:	90                   	nop
+    11a2:	c9                   	leave
+    11a3:	c3                   	ret
+
+00000000000011a4 <printBar>:
+
+void printBar(int count, bool backspace) {
+    11a4:	55                   	push   %rbp
+    11a5:	48 89 e5             	mov    %rsp,%rbp
+    11a8:	48 83 ec 20          	sub    $0x20,%rsp
+    11ac:	89 7d ec             	mov    %edi,-0x14(%rbp)
+    11af:	89 f0                	mov    %esi,%eax
+    11b1:	88 45 e8             	mov    %al,-0x18(%rbp)
+  if (backspace)
+    11b4:	80 7d e8 00          	cmpb   $0x0,-0x18(%rbp)
+    11b8:	74 2c                	je     11e6 <printBar+0x42>
+    for (int i = 0; i < 100 + 2; ++i)
+    11ba:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+    11c1:	eb 1d                	jmp    11e0 <printBar+0x3c>
+      printf(1, "\b");
+    11c3:	48 8d 05 9a 12 00 00 	lea    0x129a(%rip),%rax        # 2464 <malloc+0x371>
+    11ca:	48 89 c6             	mov    %rax,%rsi
+    11cd:	bf 01 00 00 00       	mov    $0x1,%edi
+    11d2:	b8 00 00 00 00       	mov    $0x0,%eax
+    11d7:	e8 29 07 00 00       	call   1905 <printf>
+    for (int i = 0; i < 100 + 2; ++i)
+    11dc:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+    11e0:	83 7d fc 65          	cmpl   $0x65,-0x4(%rbp)
+    11e4:	7e dd                	jle    11c3 <printBar+0x1f>
+  printf(1, "[");
+    11e6:	48 8d 05 79 12 00 00 	lea    0x1279(%rip),%rax        # 2466 <malloc+0x373>
+    11ed:	48 89 c6             	mov    %rax,%rsi
+    11f0:	bf 01 00 00 00       	mov    $0x1,%edi
+    11f5:	b8 00 00 00 00       	mov    $0x0,%eax
+    11fa:	e8 06 07 00 00       	call   1905 <printf>
+  for (int i = 0; i < 100; ++i)
+    11ff:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+    1206:	eb 40                	jmp    1248 <printBar+0xa4>
+    if (i < count)
+    1208:	8b 45 f8             	mov    -0x8(%rbp),%eax
+    120b:	3b 45 ec             	cmp    -0x14(%rbp),%eax
+    120e:	7d 1b                	jge    122b <printBar+0x87>
+      printf(1, "#");
+    1210:	48 8d 05 51 12 00 00 	lea    0x1251(%rip),%rax        # 2468 <malloc+0x375>
+    1217:	48 89 c6             	mov    %rax,%rsi
+    121a:	bf 01 00 00 00       	mov    $0x1,%edi
+    121f:	b8 00 00 00 00       	mov    $0x0,%eax
+    1224:	e8 dc 06 00 00       	call   1905 <printf>
+    1229:	eb 19                	jmp    1244 <printBar+0xa0>
+    else printf(1, " ");
+    122b:	48 8d 05 38 12 00 00 	lea    0x1238(%rip),%rax        # 246a <malloc+0x377>
+    1232:	48 89 c6             	mov    %rax,%rsi
+    1235:	bf 01 00 00 00       	mov    $0x1,%edi
+    123a:	b8 00 00 00 00       	mov    $0x0,%eax
+    123f:	e8 c1 06 00 00       	call   1905 <printf>
+  for (int i = 0; i < 100; ++i)
+    1244:	83 45 f8 01          	addl   $0x1,-0x8(%rbp)
+    1248:	83 7d f8 63          	cmpl   $0x63,-0x8(%rbp)
+    124c:	7e ba                	jle    1208 <printBar+0x64>
+  printf(1, "]");
+    124e:	48 8d 05 17 12 00 00 	lea    0x1217(%rip),%rax        # 246c <malloc+0x379>
+    1255:	48 89 c6             	mov    %rax,%rsi
+    1258:	bf 01 00 00 00       	mov    $0x1,%edi
+    125d:	b8 00 00 00 00       	mov    $0x0,%eax
+    1262:	e8 9e 06 00 00       	call   1905 <printf>
+
+}
+    1267:	90                   	nop
+    1268:	c9                   	leave
+    1269:	c3                   	ret
+
+000000000000126a <delete_stress_test>:
+
+void delete_stress_test() {
+    126a:	55                   	push   %rbp
+    126b:	48 89 e5             	mov    %rsp,%rbp
+    126e:	48 81 ec a0 00 00 00 	sub    $0xa0,%rsp
+  int fd0 = open("ddf1", O_RDWR | O_CREATE);
+    1275:	be 02 02 00 00       	mov    $0x202,%esi
+    127a:	48 8d 05 ed 11 00 00 	lea    0x11ed(%rip),%rax        # 246e <malloc+0x37b>
+    1281:	48 89 c7             	mov    %rax,%rdi
+    1284:	e8 63 0c 00 00       	call   1eec <open>
+    1289:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  char buf[128];
+  char* text = "This is the data that goes into the file created here.";
+    128c:	48 8d 05 e5 11 00 00 	lea    0x11e5(%rip),%rax        # 2478 <malloc+0x385>
+    1293:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  // overwrite the last char, and append data.
+  int n = write(fd0, text, strlen(text));
+    1297:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    129b:	48 89 c7             	mov    %rax,%rdi
+    129e:	e8 f2 09 00 00       	call   1c95 <strlen>
+    12a3:	89 c2                	mov    %eax,%edx
+    12a5:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    12a9:	8b 45 f8             	mov    -0x8(%rbp),%eax
+    12ac:	48 89 ce             	mov    %rcx,%rsi
+    12af:	89 c7                	mov    %eax,%edi
+    12b1:	e8 16 0c 00 00       	call   1ecc <write>
+    12b6:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  if (n < 0)
+    12b9:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+    12bd:	79 5e                	jns    131d <delete_stress_test+0xb3>
+    error("write failed");
+    12bf:	8b 05 4b 16 00 00    	mov    0x164b(%rip),%eax        # 2910 <stdout>
+    12c5:	ba 21 01 00 00       	mov    $0x121,%edx
+    12ca:	48 8d 0d d2 0f 00 00 	lea    0xfd2(%rip),%rcx        # 22a3 <malloc+0x1b0>
+    12d1:	48 89 ce             	mov    %rcx,%rsi
+    12d4:	89 c7                	mov    %eax,%edi
+    12d6:	b8 00 00 00 00       	mov    $0x0,%eax
+    12db:	e8 25 06 00 00       	call   1905 <printf>
+    12e0:	8b 05 2a 16 00 00    	mov    0x162a(%rip),%eax        # 2910 <stdout>
+    12e6:	48 8d 15 c2 11 00 00 	lea    0x11c2(%rip),%rdx        # 24af <malloc+0x3bc>
+    12ed:	48 89 d6             	mov    %rdx,%rsi
+    12f0:	89 c7                	mov    %eax,%edi
+    12f2:	b8 00 00 00 00       	mov    $0x0,%eax
+    12f7:	e8 09 06 00 00       	call   1905 <printf>
+    12fc:	8b 05 0e 16 00 00    	mov    0x160e(%rip),%eax        # 2910 <stdout>
+    1302:	48 8d 15 ba 0f 00 00 	lea    0xfba(%rip),%rdx        # 22c3 <malloc+0x1d0>
+    1309:	48 89 d6             	mov    %rdx,%rsi
+    130c:	89 c7                	mov    %eax,%edi
+    130e:	b8 00 00 00 00       	mov    $0x0,%eax
+    1313:	e8 ed 05 00 00       	call   1905 <printf>
+    1318:	e8 8f 0b 00 00       	call   1eac <exit>
+
+  if (close(fd0) == -1)
+    131d:	8b 45 f8             	mov    -0x8(%rbp),%eax
+    1320:	89 c7                	mov    %eax,%edi
+    1322:	e8 ad 0b 00 00       	call   1ed4 <close>
+    1327:	83 f8 ff             	cmp    $0xffffffff,%eax
+    132a:	75 5e                	jne    138a <delete_stress_test+0x120>
+    error("unable to close");
+    132c:	8b 05 de 15 00 00    	mov    0x15de(%rip),%eax        # 2910 <stdout>
+    1332:	ba 24 01 00 00       	mov    $0x124,%edx
+    1337:	48 8d 0d 65 0f 00 00 	lea    0xf65(%rip),%rcx        # 22a3 <malloc+0x1b0>
+    133e:	48 89 ce             	mov    %rcx,%rsi
+    1341:	89 c7                	mov    %eax,%edi
+    1343:	b8 00 00 00 00       	mov    $0x0,%eax
+    1348:	e8 b8 05 00 00       	call   1905 <printf>
+    134d:	8b 05 bd 15 00 00    	mov    0x15bd(%rip),%eax        # 2910 <stdout>
+    1353:	48 8d 15 62 11 00 00 	lea    0x1162(%rip),%rdx        # 24bc <malloc+0x3c9>
+    135a:	48 89 d6             	mov    %rdx,%rsi
+    135d:	89 c7                	mov    %eax,%edi
+    135f:	b8 00 00 00 00       	mov    $0x0,%eax
+    1364:	e8 9c 05 00 00       	call   1905 <printf>
+    1369:	8b 05 a1 15 00 00    	mov    0x15a1(%rip),%eax        # 2910 <stdout>
+    136f:	48 8d 15 4d 0f 00 00 	lea    0xf4d(%rip),%rdx        # 22c3 <malloc+0x1d0>
+    1376:	48 89 d6             	mov    %rdx,%rsi
+    1379:	89 c7                	mov    %eax,%edi
+    137b:	b8 00 00 00 00       	mov    $0x0,%eax
+    1380:	e8 80 05 00 00       	call   1905 <printf>
+    1385:	e8 22 0b 00 00       	call   1eac <exit>
+  fd0 = open("ddf1", O_RDONLY);
+    138a:	be 00 00 00 00       	mov    $0x0,%esi
+    138f:	48 8d 05 d8 10 00 00 	lea    0x10d8(%rip),%rax        # 246e <malloc+0x37b>
+    1396:	48 89 c7             	mov    %rax,%rdi
+    1399:	e8 4e 0b 00 00       	call   1eec <open>
+    139e:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  if (fd0 == -1)
+    13a1:	83 7d f8 ff          	cmpl   $0xffffffff,-0x8(%rbp)
+    13a5:	75 5e                	jne    1405 <delete_stress_test+0x19b>
+    error("unable to reopen");
+    13a7:	8b 05 63 15 00 00    	mov    0x1563(%rip),%eax        # 2910 <stdout>
+    13ad:	ba 27 01 00 00       	mov    $0x127,%edx
+    13b2:	48 8d 0d ea 0e 00 00 	lea    0xeea(%rip),%rcx        # 22a3 <malloc+0x1b0>
+    13b9:	48 89 ce             	mov    %rcx,%rsi
+    13bc:	89 c7                	mov    %eax,%edi
+    13be:	b8 00 00 00 00       	mov    $0x0,%eax
+    13c3:	e8 3d 05 00 00       	call   1905 <printf>
+    13c8:	8b 05 42 15 00 00    	mov    0x1542(%rip),%eax        # 2910 <stdout>
+    13ce:	48 8d 15 f7 10 00 00 	lea    0x10f7(%rip),%rdx        # 24cc <malloc+0x3d9>
+    13d5:	48 89 d6             	mov    %rdx,%rsi
+    13d8:	89 c7                	mov    %eax,%edi
+    13da:	b8 00 00 00 00       	mov    $0x0,%eax
+    13df:	e8 21 05 00 00       	call   1905 <printf>
+    13e4:	8b 05 26 15 00 00    	mov    0x1526(%rip),%eax        # 2910 <stdout>
+    13ea:	48 8d 15 d2 0e 00 00 	lea    0xed2(%rip),%rdx        # 22c3 <malloc+0x1d0>
+    13f1:	48 89 d6             	mov    %rdx,%rsi
+    13f4:	89 c7                	mov    %eax,%edi
+    13f6:	b8 00 00 00 00       	mov    $0x0,%eax
+    13fb:	e8 05 05 00 00       	call   1905 <printf>
+    1400:	e8 a7 0a 00 00       	call   1eac <exit>
+  // You better be reclaiming everything......
+  printf(1, "starting delete stress test (this should take around 5-10 min)...\n");
+    1405:	48 8d 05 d4 10 00 00 	lea    0x10d4(%rip),%rax        # 24e0 <malloc+0x3ed>
+    140c:	48 89 c6             	mov    %rax,%rsi
+    140f:	bf 01 00 00 00       	mov    $0x1,%edi
+    1414:	b8 00 00 00 00       	mov    $0x0,%eax
+    1419:	e8 e7 04 00 00       	call   1905 <printf>
+  printBar(0, false);
+    141e:	be 00 00 00 00       	mov    $0x0,%esi
+    1423:	bf 00 00 00 00       	mov    $0x0,%edi
+    1428:	e8 77 fd ff ff       	call   11a4 <printBar>
+  // 2) change the number of loop iterations to (FSSIZE / min_file_blocks) * 2
+  //    (so if you always allocate 20 blocks per file, and drop FSSIZE to 10k,
+  //     you could try dropping this down to 1k iterations)
+  //
+  // Just make sure you test on the original parameters before submission!
+  for (int i = 1; i <= 100000; ++i) {
+    142d:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+    1434:	e9 b7 01 00 00       	jmp    15f0 <delete_stress_test+0x386>
+    int fd = open("file", O_RDWR | O_CREATE);
+    1439:	be 02 02 00 00       	mov    $0x202,%esi
+    143e:	48 8d 05 de 10 00 00 	lea    0x10de(%rip),%rax        # 2523 <malloc+0x430>
+    1445:	48 89 c7             	mov    %rax,%rdi
+    1448:	e8 9f 0a 00 00       	call   1eec <open>
+    144d:	89 45 e8             	mov    %eax,-0x18(%rbp)
+    if (fd == -1)
+    1450:	83 7d e8 ff          	cmpl   $0xffffffff,-0x18(%rbp)
+    1454:	75 61                	jne    14b7 <delete_stress_test+0x24d>
+      error("Unable to open file on %d", i);
+    1456:	8b 05 b4 14 00 00    	mov    0x14b4(%rip),%eax        # 2910 <stdout>
+    145c:	ba 3a 01 00 00       	mov    $0x13a,%edx
+    1461:	48 8d 0d 3b 0e 00 00 	lea    0xe3b(%rip),%rcx        # 22a3 <malloc+0x1b0>
+    1468:	48 89 ce             	mov    %rcx,%rsi
+    146b:	89 c7                	mov    %eax,%edi
+    146d:	b8 00 00 00 00       	mov    $0x0,%eax
+    1472:	e8 8e 04 00 00       	call   1905 <printf>
+    1477:	8b 05 93 14 00 00    	mov    0x1493(%rip),%eax        # 2910 <stdout>
+    147d:	8b 55 fc             	mov    -0x4(%rbp),%edx
+    1480:	48 8d 0d a1 10 00 00 	lea    0x10a1(%rip),%rcx        # 2528 <malloc+0x435>
+    1487:	48 89 ce             	mov    %rcx,%rsi
+    148a:	89 c7                	mov    %eax,%edi
+    148c:	b8 00 00 00 00       	mov    $0x0,%eax
+    1491:	e8 6f 04 00 00       	call   1905 <printf>
+    1496:	8b 05 74 14 00 00    	mov    0x1474(%rip),%eax        # 2910 <stdout>
+    149c:	48 8d 15 20 0e 00 00 	lea    0xe20(%rip),%rdx        # 22c3 <malloc+0x1d0>
+    14a3:	48 89 d6             	mov    %rdx,%rsi
+    14a6:	89 c7                	mov    %eax,%edi
+    14a8:	b8 00 00 00 00       	mov    $0x0,%eax
+    14ad:	e8 53 04 00 00       	call   1905 <printf>
+    14b2:	e8 f5 09 00 00       	call   1eac <exit>
+    if (close(fd) == -1)
+    14b7:	8b 45 e8             	mov    -0x18(%rbp),%eax
+    14ba:	89 c7                	mov    %eax,%edi
+    14bc:	e8 13 0a 00 00       	call   1ed4 <close>
+    14c1:	83 f8 ff             	cmp    $0xffffffff,%eax
+    14c4:	75 61                	jne    1527 <delete_stress_test+0x2bd>
+      error("Unable to close file on %d", i);
+    14c6:	8b 05 44 14 00 00    	mov    0x1444(%rip),%eax        # 2910 <stdout>
+    14cc:	ba 3c 01 00 00       	mov    $0x13c,%edx
+    14d1:	48 8d 0d cb 0d 00 00 	lea    0xdcb(%rip),%rcx        # 22a3 <malloc+0x1b0>
+    14d8:	48 89 ce             	mov    %rcx,%rsi
+    14db:	89 c7                	mov    %eax,%edi
+    14dd:	b8 00 00 00 00       	mov    $0x0,%eax
+    14e2:	e8 1e 04 00 00       	call   1905 <printf>
+    14e7:	8b 05 23 14 00 00    	mov    0x1423(%rip),%eax        # 2910 <stdout>
+    14ed:	8b 55 fc             	mov    -0x4(%rbp),%edx
+    14f0:	48 8d 0d 4b 10 00 00 	lea    0x104b(%rip),%rcx        # 2542 <malloc+0x44f>
+    14f7:	48 89 ce             	mov    %rcx,%rsi
+    14fa:	89 c7                	mov    %eax,%edi
+    14fc:	b8 00 00 00 00       	mov    $0x0,%eax
+    1501:	e8 ff 03 00 00       	call   1905 <printf>
+    1506:	8b 05 04 14 00 00    	mov    0x1404(%rip),%eax        # 2910 <stdout>
+    150c:	48 8d 15 b0 0d 00 00 	lea    0xdb0(%rip),%rdx        # 22c3 <malloc+0x1d0>
+    1513:	48 89 d6             	mov    %rdx,%rsi
+    1516:	89 c7                	mov    %eax,%edi
+    1518:	b8 00 00 00 00       	mov    $0x0,%eax
+    151d:	e8 e3 03 00 00       	call   1905 <printf>
+    1522:	e8 85 09 00 00       	call   1eac <exit>
+    if (unlink("file") == -1)
+    1527:	48 8d 05 f5 0f 00 00 	lea    0xff5(%rip),%rax        # 2523 <malloc+0x430>
+    152e:	48 89 c7             	mov    %rax,%rdi
+    1531:	e8 c6 09 00 00       	call   1efc <unlink>
+    1536:	83 f8 ff             	cmp    $0xffffffff,%eax
+    1539:	75 61                	jne    159c <delete_stress_test+0x332>
+      error("Unable to unlink file on %d", i);
+    153b:	8b 05 cf 13 00 00    	mov    0x13cf(%rip),%eax        # 2910 <stdout>
+    1541:	ba 3e 01 00 00       	mov    $0x13e,%edx
+    1546:	48 8d 0d 56 0d 00 00 	lea    0xd56(%rip),%rcx        # 22a3 <malloc+0x1b0>
+    154d:	48 89 ce             	mov    %rcx,%rsi
+    1550:	89 c7                	mov    %eax,%edi
+    1552:	b8 00 00 00 00       	mov    $0x0,%eax
+    1557:	e8 a9 03 00 00       	call   1905 <printf>
+    155c:	8b 05 ae 13 00 00    	mov    0x13ae(%rip),%eax        # 2910 <stdout>
+    1562:	8b 55 fc             	mov    -0x4(%rbp),%edx
+    1565:	48 8d 0d f1 0f 00 00 	lea    0xff1(%rip),%rcx        # 255d <malloc+0x46a>
+    156c:	48 89 ce             	mov    %rcx,%rsi
+    156f:	89 c7                	mov    %eax,%edi
+    1571:	b8 00 00 00 00       	mov    $0x0,%eax
+    1576:	e8 8a 03 00 00       	call   1905 <printf>
+    157b:	8b 05 8f 13 00 00    	mov    0x138f(%rip),%eax        # 2910 <stdout>
+    1581:	48 8d 15 3b 0d 00 00 	lea    0xd3b(%rip),%rdx        # 22c3 <malloc+0x1d0>
+    1588:	48 89 d6             	mov    %rdx,%rsi
+    158b:	89 c7                	mov    %eax,%edi
+    158d:	b8 00 00 00 00       	mov    $0x0,%eax
+    1592:	e8 6e 03 00 00       	call   1905 <printf>
+    1597:	e8 10 09 00 00       	call   1eac <exit>
+   if (i % 1000 == 0)
+    159c:	8b 55 fc             	mov    -0x4(%rbp),%edx
+    159f:	48 63 c2             	movslq %edx,%rax
+    15a2:	48 69 c0 d3 4d 62 10 	imul   $0x10624dd3,%rax,%rax
+    15a9:	48 c1 e8 20          	shr    $0x20,%rax
+    15ad:	c1 f8 06             	sar    $0x6,%eax
+    15b0:	89 d1                	mov    %edx,%ecx
+    15b2:	c1 f9 1f             	sar    $0x1f,%ecx
+    15b5:	29 c8                	sub    %ecx,%eax
+    15b7:	69 c8 e8 03 00 00    	imul   $0x3e8,%eax,%ecx
+    15bd:	89 d0                	mov    %edx,%eax
+    15bf:	29 c8                	sub    %ecx,%eax
+    15c1:	85 c0                	test   %eax,%eax
+    15c3:	75 27                	jne    15ec <delete_stress_test+0x382>
+      printBar(i / 1000, true);
+    15c5:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    15c8:	48 63 d0             	movslq %eax,%rdx
+    15cb:	48 69 d2 d3 4d 62 10 	imul   $0x10624dd3,%rdx,%rdx
+    15d2:	48 c1 ea 20          	shr    $0x20,%rdx
+    15d6:	89 d1                	mov    %edx,%ecx
+    15d8:	c1 f9 06             	sar    $0x6,%ecx
+    15db:	99                   	cltd
+    15dc:	89 c8                	mov    %ecx,%eax
+    15de:	29 d0                	sub    %edx,%eax
+    15e0:	be 01 00 00 00       	mov    $0x1,%esi
+    15e5:	89 c7                	mov    %eax,%edi
+    15e7:	e8 b8 fb ff ff       	call   11a4 <printBar>
+  for (int i = 1; i <= 100000; ++i) {
+    15ec:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+    15f0:	81 7d fc a0 86 01 00 	cmpl   $0x186a0,-0x4(%rbp)
+    15f7:	0f 8e 3c fe ff ff    	jle    1439 <delete_stress_test+0x1cf>
+  }
+
+  read(fd0, &buf, strlen(text));
+    15fd:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1601:	48 89 c7             	mov    %rax,%rdi
+    1604:	e8 8c 06 00 00       	call   1c95 <strlen>
+    1609:	89 c2                	mov    %eax,%edx
+    160b:	48 8d 8d 68 ff ff ff 	lea    -0x98(%rbp),%rcx
+    1612:	8b 45 f8             	mov    -0x8(%rbp),%eax
+    1615:	48 89 ce             	mov    %rcx,%rsi
+    1618:	89 c7                	mov    %eax,%edi
+    161a:	e8 a5 08 00 00       	call   1ec4 <read>
+  if (strcmp(buf, text) != 0)
+    161f:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    1623:	48 8d 85 68 ff ff ff 	lea    -0x98(%rbp),%rax
+    162a:	48 89 d6             	mov    %rdx,%rsi
+    162d:	48 89 c7             	mov    %rax,%rdi
+    1630:	e8 11 06 00 00       	call   1c46 <strcmp>
+    1635:	85 c0                	test   %eax,%eax
+    1637:	74 66                	je     169f <delete_stress_test+0x435>
+    error("Bad. %s  //  %s\n", buf, text);
+    1639:	8b 05 d1 12 00 00    	mov    0x12d1(%rip),%eax        # 2910 <stdout>
+    163f:	ba 45 01 00 00       	mov    $0x145,%edx
+    1644:	48 8d 0d 58 0c 00 00 	lea    0xc58(%rip),%rcx        # 22a3 <malloc+0x1b0>
+    164b:	48 89 ce             	mov    %rcx,%rsi
+    164e:	89 c7                	mov    %eax,%edi
+    1650:	b8 00 00 00 00       	mov    $0x0,%eax
+    1655:	e8 ab 02 00 00       	call   1905 <printf>
+    165a:	8b 05 b0 12 00 00    	mov    0x12b0(%rip),%eax        # 2910 <stdout>
+    1660:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    1664:	48 8d 95 68 ff ff ff 	lea    -0x98(%rbp),%rdx
+    166b:	48 8d 35 07 0f 00 00 	lea    0xf07(%rip),%rsi        # 2579 <malloc+0x486>
+    1672:	89 c7                	mov    %eax,%edi
+    1674:	b8 00 00 00 00       	mov    $0x0,%eax
+    1679:	e8 87 02 00 00       	call   1905 <printf>
+    167e:	8b 05 8c 12 00 00    	mov    0x128c(%rip),%eax        # 2910 <stdout>
+    1684:	48 8d 15 38 0c 00 00 	lea    0xc38(%rip),%rdx        # 22c3 <malloc+0x1d0>
+    168b:	48 89 d6             	mov    %rdx,%rsi
+    168e:	89 c7                	mov    %eax,%edi
+    1690:	b8 00 00 00 00       	mov    $0x0,%eax
+    1695:	e8 6b 02 00 00       	call   1905 <printf>
+    169a:	e8 0d 08 00 00       	call   1eac <exit>
+
+  printf(1, "\ndelete stress test OK\n");
+    169f:	48 8d 05 e4 0e 00 00 	lea    0xee4(%rip),%rax        # 258a <malloc+0x497>
+    16a6:	48 89 c6             	mov    %rax,%rsi
+    16a9:	bf 01 00 00 00       	mov    $0x1,%edi
+    16ae:	b8 00 00 00 00       	mov    $0x0,%eax
+    16b3:	e8 4d 02 00 00       	call   1905 <printf>
+
+}
+    16b8:	90                   	nop
+    16b9:	c9                   	leave
+    16ba:	c3                   	ret
+
+00000000000016bb <main>:
+
+int main(int argc, char *argv[]) {
+    16bb:	55                   	push   %rbp
+    16bc:	48 89 e5             	mov    %rsp,%rbp
+    16bf:	48 83 ec 10          	sub    $0x10,%rsp
+    16c3:	89 7d fc             	mov    %edi,-0x4(%rbp)
+    16c6:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  printf(stdout, "lab4test_b starting\n");
+    16ca:	8b 05 40 12 00 00    	mov    0x1240(%rip),%eax        # 2910 <stdout>
+    16d0:	48 8d 15 cb 0e 00 00 	lea    0xecb(%rip),%rdx        # 25a2 <malloc+0x4af>
+    16d7:	48 89 d6             	mov    %rdx,%rsi
+    16da:	89 c7                	mov    %eax,%edi
+    16dc:	b8 00 00 00 00       	mov    $0x0,%eax
+    16e1:	e8 1f 02 00 00       	call   1905 <printf>
+
+  concurrent_dup_test();
+    16e6:	b8 00 00 00 00       	mov    $0x0,%eax
+    16eb:	e8 10 e9 ff ff       	call   0 <concurrent_dup_test>
+  concurrent_create_test();
+    16f0:	b8 00 00 00 00       	mov    $0x0,%eax
+    16f5:	e8 6a ec ff ff       	call   364 <concurrent_create_test>
+  concurrent_write_test();
+    16fa:	b8 00 00 00 00       	mov    $0x0,%eax
+    16ff:	e8 25 f1 ff ff       	call   829 <concurrent_write_test>
+  concurrent_read_test();
+    1704:	b8 00 00 00 00       	mov    $0x0,%eax
+    1709:	e8 25 f5 ff ff       	call   c33 <concurrent_read_test>
+  concurrent_delete_test();
+    170e:	b8 00 00 00 00       	mov    $0x0,%eax
+    1713:	e8 f2 f8 ff ff       	call   100a <concurrent_delete_test>
+  delete_stress_test();
+    1718:	b8 00 00 00 00       	mov    $0x0,%eax
+    171d:	e8 48 fb ff ff       	call   126a <delete_stress_test>
+  printf(stdout, "lab4test_b passed!\n");
+    1722:	8b 05 e8 11 00 00    	mov    0x11e8(%rip),%eax        # 2910 <stdout>
+    1728:	48 8d 15 88 0e 00 00 	lea    0xe88(%rip),%rdx        # 25b7 <malloc+0x4c4>
+    172f:	48 89 d6             	mov    %rdx,%rsi
+    1732:	89 c7                	mov    %eax,%edi
+    1734:	b8 00 00 00 00       	mov    $0x0,%eax
+    1739:	e8 c7 01 00 00       	call   1905 <printf>
+  exit();
+    173e:	e8 69 07 00 00       	call   1eac <exit>
+
+0000000000001743 <putc>:
+#include <cdefs.h>
+#include <stat.h>
+#include <stdarg.h>
+#include <user.h>
+
+static void putc(int fd, char c) { write(fd, &c, 1); }
+    1743:	55                   	push   %rbp
+    1744:	48 89 e5             	mov    %rsp,%rbp
+    1747:	48 83 ec 10          	sub    $0x10,%rsp
+    174b:	89 7d fc             	mov    %edi,-0x4(%rbp)
+    174e:	89 f0                	mov    %esi,%eax
+    1750:	88 45 f8             	mov    %al,-0x8(%rbp)
+    1753:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+    1757:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    175a:	ba 01 00 00 00       	mov    $0x1,%edx
+    175f:	48 89 ce             	mov    %rcx,%rsi
+    1762:	89 c7                	mov    %eax,%edi
+    1764:	e8 63 07 00 00       	call   1ecc <write>
+    1769:	90                   	nop
+    176a:	c9                   	leave
+    176b:	c3                   	ret
+
+000000000000176c <printint64>:
+
+static void printint64(int fd, int xx, int base, int sgn) {
+    176c:	55                   	push   %rbp
+    176d:	48 89 e5             	mov    %rsp,%rbp
+    1770:	48 83 ec 40          	sub    $0x40,%rsp
+    1774:	89 7d cc             	mov    %edi,-0x34(%rbp)
+    1777:	89 75 c8             	mov    %esi,-0x38(%rbp)
+    177a:	89 55 c4             	mov    %edx,-0x3c(%rbp)
+    177d:	89 4d c0             	mov    %ecx,-0x40(%rbp)
+  static char digits[] = "0123456789abcdef";
+  char buf[32];
+  int i;
+  uint64_t x;
+
+  if (sgn && (sgn = xx < 0))
+    1780:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+    1784:	74 1f                	je     17a5 <printint64+0x39>
+    1786:	8b 45 c8             	mov    -0x38(%rbp),%eax
+    1789:	c1 e8 1f             	shr    $0x1f,%eax
+    178c:	0f b6 c0             	movzbl %al,%eax
+    178f:	89 45 c0             	mov    %eax,-0x40(%rbp)
+    1792:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+    1796:	74 0d                	je     17a5 <printint64+0x39>
+    x = -xx;
+    1798:	8b 45 c8             	mov    -0x38(%rbp),%eax
+    179b:	f7 d8                	neg    %eax
+    179d:	48 98                	cltq
+    179f:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    17a3:	eb 09                	jmp    17ae <printint64+0x42>
+  else
+    x = xx;
+    17a5:	8b 45 c8             	mov    -0x38(%rbp),%eax
+    17a8:	48 98                	cltq
+    17aa:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+  i = 0;
+    17ae:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  do {
+    buf[i++] = digits[x % base];
+    17b5:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+    17b8:	48 63 c8             	movslq %eax,%rcx
+    17bb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    17bf:	ba 00 00 00 00       	mov    $0x0,%edx
+    17c4:	48 f7 f1             	div    %rcx
+    17c7:	48 89 d1             	mov    %rdx,%rcx
+    17ca:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    17cd:	8d 50 01             	lea    0x1(%rax),%edx
+    17d0:	89 55 fc             	mov    %edx,-0x4(%rbp)
+    17d3:	48 8d 15 46 11 00 00 	lea    0x1146(%rip),%rdx        # 2920 <digits.1>
+    17da:	0f b6 14 11          	movzbl (%rcx,%rdx,1),%edx
+    17de:	48 98                	cltq
+    17e0:	88 54 05 d0          	mov    %dl,-0x30(%rbp,%rax,1)
+  } while ((x /= base) != 0);
+    17e4:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+    17e7:	48 63 f0             	movslq %eax,%rsi
+    17ea:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    17ee:	ba 00 00 00 00       	mov    $0x0,%edx
+    17f3:	48 f7 f6             	div    %rsi
+    17f6:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    17fa:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+    17ff:	75 b4                	jne    17b5 <printint64+0x49>
+
+  if (sgn)
+    1801:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+    1805:	74 2b                	je     1832 <printint64+0xc6>
+    buf[i++] = '-';
+    1807:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    180a:	8d 50 01             	lea    0x1(%rax),%edx
+    180d:	89 55 fc             	mov    %edx,-0x4(%rbp)
+    1810:	48 98                	cltq
+    1812:	c6 44 05 d0 2d       	movb   $0x2d,-0x30(%rbp,%rax,1)
+
+  while (--i >= 0)
+    1817:	eb 19                	jmp    1832 <printint64+0xc6>
+    putc(fd, buf[i]);
+    1819:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    181c:	48 98                	cltq
+    181e:	0f b6 44 05 d0       	movzbl -0x30(%rbp,%rax,1),%eax
+    1823:	0f be d0             	movsbl %al,%edx
+    1826:	8b 45 cc             	mov    -0x34(%rbp),%eax
+    1829:	89 d6                	mov    %edx,%esi
+    182b:	89 c7                	mov    %eax,%edi
+    182d:	e8 11 ff ff ff       	call   1743 <putc>
+  while (--i >= 0)
+    1832:	83 6d fc 01          	subl   $0x1,-0x4(%rbp)
+    1836:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+    183a:	79 dd                	jns    1819 <printint64+0xad>
+}
+    183c:	90                   	nop
+    183d:	90                   	nop
+    183e:	c9                   	leave
+    183f:	c3                   	ret
+
+0000000000001840 <printint>:
+
+static void printint(int fd, int xx, int base, int sgn) {
+    1840:	55                   	push   %rbp
+    1841:	48 89 e5             	mov    %rsp,%rbp
+    1844:	48 83 ec 30          	sub    $0x30,%rsp
+    1848:	89 7d dc             	mov    %edi,-0x24(%rbp)
+    184b:	89 75 d8             	mov    %esi,-0x28(%rbp)
+    184e:	89 55 d4             	mov    %edx,-0x2c(%rbp)
+    1851:	89 4d d0             	mov    %ecx,-0x30(%rbp)
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+    1854:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+  if (sgn && xx < 0) {
+    185b:	83 7d d0 00          	cmpl   $0x0,-0x30(%rbp)
+    185f:	74 17                	je     1878 <printint+0x38>
+    1861:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+    1865:	79 11                	jns    1878 <printint+0x38>
+    neg = 1;
+    1867:	c7 45 f8 01 00 00 00 	movl   $0x1,-0x8(%rbp)
+    x = -xx;
+    186e:	8b 45 d8             	mov    -0x28(%rbp),%eax
+    1871:	f7 d8                	neg    %eax
+    1873:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    1876:	eb 06                	jmp    187e <printint+0x3e>
+  } else {
+    x = xx;
+    1878:	8b 45 d8             	mov    -0x28(%rbp),%eax
+    187b:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  }
+
+  i = 0;
+    187e:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  do {
+    buf[i++] = digits[x % base];
+    1885:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+    1888:	8b 45 f4             	mov    -0xc(%rbp),%eax
+    188b:	ba 00 00 00 00       	mov    $0x0,%edx
+    1890:	f7 f1                	div    %ecx
+    1892:	89 d1                	mov    %edx,%ecx
+    1894:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1897:	8d 50 01             	lea    0x1(%rax),%edx
+    189a:	89 55 fc             	mov    %edx,-0x4(%rbp)
+    189d:	89 c9                	mov    %ecx,%ecx
+    189f:	48 8d 15 9a 10 00 00 	lea    0x109a(%rip),%rdx        # 2940 <digits.0>
+    18a6:	0f b6 14 11          	movzbl (%rcx,%rdx,1),%edx
+    18aa:	48 98                	cltq
+    18ac:	88 54 05 e4          	mov    %dl,-0x1c(%rbp,%rax,1)
+  } while ((x /= base) != 0);
+    18b0:	8b 75 d4             	mov    -0x2c(%rbp),%esi
+    18b3:	8b 45 f4             	mov    -0xc(%rbp),%eax
+    18b6:	ba 00 00 00 00       	mov    $0x0,%edx
+    18bb:	f7 f6                	div    %esi
+    18bd:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    18c0:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+    18c4:	75 bf                	jne    1885 <printint+0x45>
+  if (neg)
+    18c6:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+    18ca:	74 2b                	je     18f7 <printint+0xb7>
+    buf[i++] = '-';
+    18cc:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    18cf:	8d 50 01             	lea    0x1(%rax),%edx
+    18d2:	89 55 fc             	mov    %edx,-0x4(%rbp)
+    18d5:	48 98                	cltq
+    18d7:	c6 44 05 e4 2d       	movb   $0x2d,-0x1c(%rbp,%rax,1)
+
+  while (--i >= 0)
+    18dc:	eb 19                	jmp    18f7 <printint+0xb7>
+    putc(fd, buf[i]);
+    18de:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    18e1:	48 98                	cltq
+    18e3:	0f b6 44 05 e4       	movzbl -0x1c(%rbp,%rax,1),%eax
+    18e8:	0f be d0             	movsbl %al,%edx
+    18eb:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    18ee:	89 d6                	mov    %edx,%esi
+    18f0:	89 c7                	mov    %eax,%edi
+    18f2:	e8 4c fe ff ff       	call   1743 <putc>
+  while (--i >= 0)
+    18f7:	83 6d fc 01          	subl   $0x1,-0x4(%rbp)
+    18fb:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+    18ff:	79 dd                	jns    18de <printint+0x9e>
+}
+    1901:	90                   	nop
+    1902:	90                   	nop
+    1903:	c9                   	leave
+    1904:	c3                   	ret
+
+0000000000001905 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void printf(int fd, char *fmt, ...) {
+    1905:	55                   	push   %rbp
+    1906:	48 89 e5             	mov    %rsp,%rbp
+    1909:	48 83 ec 70          	sub    $0x70,%rsp
+    190d:	89 7d 9c             	mov    %edi,-0x64(%rbp)
+    1910:	48 89 75 90          	mov    %rsi,-0x70(%rbp)
+    1914:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+    1918:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+    191c:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+    1920:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+  char *s;
+  int c, i, state;
+  int lflag;
+  va_list valist;
+  va_start(valist, fmt);
+    1924:	c7 45 a0 10 00 00 00 	movl   $0x10,-0x60(%rbp)
+    192b:	48 8d 45 10          	lea    0x10(%rbp),%rax
+    192f:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+    1933:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+    1937:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+
+  state = 0;
+    193b:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%rbp)
+  for (i = 0; fmt[i]; i++) {
+    1942:	c7 45 c4 00 00 00 00 	movl   $0x0,-0x3c(%rbp)
+    1949:	e9 6b 02 00 00       	jmp    1bb9 <printf+0x2b4>
+    c = fmt[i] & 0xff;
+    194e:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+    1951:	48 63 d0             	movslq %eax,%rdx
+    1954:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+    1958:	48 01 d0             	add    %rdx,%rax
+    195b:	0f b6 00             	movzbl (%rax),%eax
+    195e:	0f be c0             	movsbl %al,%eax
+    1961:	25 ff 00 00 00       	and    $0xff,%eax
+    1966:	89 45 b8             	mov    %eax,-0x48(%rbp)
+    if (state == 0) {
+    1969:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+    196d:	75 30                	jne    199f <printf+0x9a>
+      if (c == '%') {
+    196f:	83 7d b8 25          	cmpl   $0x25,-0x48(%rbp)
+    1973:	75 13                	jne    1988 <printf+0x83>
+        state = '%';
+    1975:	c7 45 c0 25 00 00 00 	movl   $0x25,-0x40(%rbp)
+        lflag = 0;
+    197c:	c7 45 bc 00 00 00 00 	movl   $0x0,-0x44(%rbp)
+    1983:	e9 2d 02 00 00       	jmp    1bb5 <printf+0x2b0>
+      } else {
+        putc(fd, c);
+    1988:	8b 45 b8             	mov    -0x48(%rbp),%eax
+    198b:	0f be d0             	movsbl %al,%edx
+    198e:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    1991:	89 d6                	mov    %edx,%esi
+    1993:	89 c7                	mov    %eax,%edi
+    1995:	e8 a9 fd ff ff       	call   1743 <putc>
+    199a:	e9 16 02 00 00       	jmp    1bb5 <printf+0x2b0>
+      }
+    } else if (state == '%') {
+    199f:	83 7d c0 25          	cmpl   $0x25,-0x40(%rbp)
+    19a3:	0f 85 0c 02 00 00    	jne    1bb5 <printf+0x2b0>
+      if (c == 'l') {
+    19a9:	83 7d b8 6c          	cmpl   $0x6c,-0x48(%rbp)
+    19ad:	75 0c                	jne    19bb <printf+0xb6>
+        lflag = 1;
+    19af:	c7 45 bc 01 00 00 00 	movl   $0x1,-0x44(%rbp)
+        continue;
+    19b6:	e9 fa 01 00 00       	jmp    1bb5 <printf+0x2b0>
+      } else if (c == 'd') {
+    19bb:	83 7d b8 64          	cmpl   $0x64,-0x48(%rbp)
+    19bf:	0f 85 95 00 00 00    	jne    1a5a <printf+0x155>
+        if (lflag == 1)
+    19c5:	83 7d bc 01          	cmpl   $0x1,-0x44(%rbp)
+    19c9:	75 49                	jne    1a14 <printf+0x10f>
+          printint64(fd, va_arg(valist, int64_t), 10, 1);
+    19cb:	8b 45 a0             	mov    -0x60(%rbp),%eax
+    19ce:	83 f8 2f             	cmp    $0x2f,%eax
+    19d1:	77 17                	ja     19ea <printf+0xe5>
+    19d3:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    19d7:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    19da:	89 d2                	mov    %edx,%edx
+    19dc:	48 01 d0             	add    %rdx,%rax
+    19df:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    19e2:	83 c2 08             	add    $0x8,%edx
+    19e5:	89 55 a0             	mov    %edx,-0x60(%rbp)
+    19e8:	eb 0c                	jmp    19f6 <printf+0xf1>
+    19ea:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+    19ee:	48 8d 50 08          	lea    0x8(%rax),%rdx
+    19f2:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    19f6:	48 8b 00             	mov    (%rax),%rax
+    19f9:	89 c6                	mov    %eax,%esi
+    19fb:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    19fe:	b9 01 00 00 00       	mov    $0x1,%ecx
+    1a03:	ba 0a 00 00 00       	mov    $0xa,%edx
+    1a08:	89 c7                	mov    %eax,%edi
+    1a0a:	e8 5d fd ff ff       	call   176c <printint64>
+    1a0f:	e9 9a 01 00 00       	jmp    1bae <printf+0x2a9>
+        else
+          printint(fd, va_arg(valist, int), 10, 1);
+    1a14:	8b 45 a0             	mov    -0x60(%rbp),%eax
+    1a17:	83 f8 2f             	cmp    $0x2f,%eax
+    1a1a:	77 17                	ja     1a33 <printf+0x12e>
+    1a1c:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    1a20:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    1a23:	89 d2                	mov    %edx,%edx
+    1a25:	48 01 d0             	add    %rdx,%rax
+    1a28:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    1a2b:	83 c2 08             	add    $0x8,%edx
+    1a2e:	89 55 a0             	mov    %edx,-0x60(%rbp)
+    1a31:	eb 0c                	jmp    1a3f <printf+0x13a>
+    1a33:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+    1a37:	48 8d 50 08          	lea    0x8(%rax),%rdx
+    1a3b:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    1a3f:	8b 30                	mov    (%rax),%esi
+    1a41:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    1a44:	b9 01 00 00 00       	mov    $0x1,%ecx
+    1a49:	ba 0a 00 00 00       	mov    $0xa,%edx
+    1a4e:	89 c7                	mov    %eax,%edi
+    1a50:	e8 eb fd ff ff       	call   1840 <printint>
+    1a55:	e9 54 01 00 00       	jmp    1bae <printf+0x2a9>
+      } else if (c == 'x' || c == 'p') {
+    1a5a:	83 7d b8 78          	cmpl   $0x78,-0x48(%rbp)
+    1a5e:	74 0a                	je     1a6a <printf+0x165>
+    1a60:	83 7d b8 70          	cmpl   $0x70,-0x48(%rbp)
+    1a64:	0f 85 95 00 00 00    	jne    1aff <printf+0x1fa>
+        if (lflag == 1)
+    1a6a:	83 7d bc 01          	cmpl   $0x1,-0x44(%rbp)
+    1a6e:	75 49                	jne    1ab9 <printf+0x1b4>
+          printint64(fd, va_arg(valist, int64_t), 16, 0);
+    1a70:	8b 45 a0             	mov    -0x60(%rbp),%eax
+    1a73:	83 f8 2f             	cmp    $0x2f,%eax
+    1a76:	77 17                	ja     1a8f <printf+0x18a>
+    1a78:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    1a7c:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    1a7f:	89 d2                	mov    %edx,%edx
+    1a81:	48 01 d0             	add    %rdx,%rax
+    1a84:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    1a87:	83 c2 08             	add    $0x8,%edx
+    1a8a:	89 55 a0             	mov    %edx,-0x60(%rbp)
+    1a8d:	eb 0c                	jmp    1a9b <printf+0x196>
+    1a8f:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+    1a93:	48 8d 50 08          	lea    0x8(%rax),%rdx
+    1a97:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    1a9b:	48 8b 00             	mov    (%rax),%rax
+    1a9e:	89 c6                	mov    %eax,%esi
+    1aa0:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    1aa3:	b9 00 00 00 00       	mov    $0x0,%ecx
+    1aa8:	ba 10 00 00 00       	mov    $0x10,%edx
+    1aad:	89 c7                	mov    %eax,%edi
+    1aaf:	e8 b8 fc ff ff       	call   176c <printint64>
+        if (lflag == 1)
+    1ab4:	e9 f5 00 00 00       	jmp    1bae <printf+0x2a9>
+        else
+          printint(fd, va_arg(valist, int), 16, 0);
+    1ab9:	8b 45 a0             	mov    -0x60(%rbp),%eax
+    1abc:	83 f8 2f             	cmp    $0x2f,%eax
+    1abf:	77 17                	ja     1ad8 <printf+0x1d3>
+    1ac1:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    1ac5:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    1ac8:	89 d2                	mov    %edx,%edx
+    1aca:	48 01 d0             	add    %rdx,%rax
+    1acd:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    1ad0:	83 c2 08             	add    $0x8,%edx
+    1ad3:	89 55 a0             	mov    %edx,-0x60(%rbp)
+    1ad6:	eb 0c                	jmp    1ae4 <printf+0x1df>
+    1ad8:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+    1adc:	48 8d 50 08          	lea    0x8(%rax),%rdx
+    1ae0:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    1ae4:	8b 30                	mov    (%rax),%esi
+    1ae6:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    1ae9:	b9 00 00 00 00       	mov    $0x0,%ecx
+    1aee:	ba 10 00 00 00       	mov    $0x10,%edx
+    1af3:	89 c7                	mov    %eax,%edi
+    1af5:	e8 46 fd ff ff       	call   1840 <printint>
+        if (lflag == 1)
+    1afa:	e9 af 00 00 00       	jmp    1bae <printf+0x2a9>
+      } else if (c == 's') {
+    1aff:	83 7d b8 73          	cmpl   $0x73,-0x48(%rbp)
+    1b03:	75 6e                	jne    1b73 <printf+0x26e>
+        if ((s = (char *)va_arg(valist, char *)) == 0)
+    1b05:	8b 45 a0             	mov    -0x60(%rbp),%eax
+    1b08:	83 f8 2f             	cmp    $0x2f,%eax
+    1b0b:	77 17                	ja     1b24 <printf+0x21f>
+    1b0d:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    1b11:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    1b14:	89 d2                	mov    %edx,%edx
+    1b16:	48 01 d0             	add    %rdx,%rax
+    1b19:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    1b1c:	83 c2 08             	add    $0x8,%edx
+    1b1f:	89 55 a0             	mov    %edx,-0x60(%rbp)
+    1b22:	eb 0c                	jmp    1b30 <printf+0x22b>
+    1b24:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+    1b28:	48 8d 50 08          	lea    0x8(%rax),%rdx
+    1b2c:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    1b30:	48 8b 00             	mov    (%rax),%rax
+    1b33:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    1b37:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+    1b3c:	75 28                	jne    1b66 <printf+0x261>
+          s = "(null)";
+    1b3e:	48 8d 05 86 0a 00 00 	lea    0xa86(%rip),%rax        # 25cb <malloc+0x4d8>
+    1b45:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        for (; *s; s++)
+    1b49:	eb 1b                	jmp    1b66 <printf+0x261>
+          putc(fd, *s);
+    1b4b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    1b4f:	0f b6 00             	movzbl (%rax),%eax
+    1b52:	0f be d0             	movsbl %al,%edx
+    1b55:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    1b58:	89 d6                	mov    %edx,%esi
+    1b5a:	89 c7                	mov    %eax,%edi
+    1b5c:	e8 e2 fb ff ff       	call   1743 <putc>
+        for (; *s; s++)
+    1b61:	48 83 45 c8 01       	addq   $0x1,-0x38(%rbp)
+    1b66:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    1b6a:	0f b6 00             	movzbl (%rax),%eax
+    1b6d:	84 c0                	test   %al,%al
+    1b6f:	75 da                	jne    1b4b <printf+0x246>
+    1b71:	eb 3b                	jmp    1bae <printf+0x2a9>
+      } else if (c == '%') {
+    1b73:	83 7d b8 25          	cmpl   $0x25,-0x48(%rbp)
+    1b77:	75 14                	jne    1b8d <printf+0x288>
+        putc(fd, c);
+    1b79:	8b 45 b8             	mov    -0x48(%rbp),%eax
+    1b7c:	0f be d0             	movsbl %al,%edx
+    1b7f:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    1b82:	89 d6                	mov    %edx,%esi
+    1b84:	89 c7                	mov    %eax,%edi
+    1b86:	e8 b8 fb ff ff       	call   1743 <putc>
+    1b8b:	eb 21                	jmp    1bae <printf+0x2a9>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+    1b8d:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    1b90:	be 25 00 00 00       	mov    $0x25,%esi
+    1b95:	89 c7                	mov    %eax,%edi
+    1b97:	e8 a7 fb ff ff       	call   1743 <putc>
+        putc(fd, c);
+    1b9c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+    1b9f:	0f be d0             	movsbl %al,%edx
+    1ba2:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    1ba5:	89 d6                	mov    %edx,%esi
+    1ba7:	89 c7                	mov    %eax,%edi
+    1ba9:	e8 95 fb ff ff       	call   1743 <putc>
+      }
+      state = 0;
+    1bae:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%rbp)
+  for (i = 0; fmt[i]; i++) {
+    1bb5:	83 45 c4 01          	addl   $0x1,-0x3c(%rbp)
+    1bb9:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+    1bbc:	48 63 d0             	movslq %eax,%rdx
+    1bbf:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+    1bc3:	48 01 d0             	add    %rdx,%rax
+    1bc6:	0f b6 00             	movzbl (%rax),%eax
+    1bc9:	84 c0                	test   %al,%al
+    1bcb:	0f 85 7d fd ff ff    	jne    194e <printf+0x49>
+    }
+  }
+
+  va_end(valist);
+}
+    1bd1:	90                   	nop
+    1bd2:	90                   	nop
+    1bd3:	c9                   	leave
+    1bd4:	c3                   	ret
+
+0000000000001bd5 <stosb>:
+      break;
+    buf[i++] = c;
+    if (c == '\n' || c == '\r')
+      break;
+  }
+  buf[i] = '\0';
+    1bd5:	55                   	push   %rbp
+    1bd6:	48 89 e5             	mov    %rsp,%rbp
+    1bd9:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1bdd:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    1be0:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  return buf;
+    1be3:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+    1be7:	8b 55 f0             	mov    -0x10(%rbp),%edx
+    1bea:	8b 45 f4             	mov    -0xc(%rbp),%eax
+    1bed:	48 89 ce             	mov    %rcx,%rsi
+    1bf0:	48 89 f7             	mov    %rsi,%rdi
+    1bf3:	89 d1                	mov    %edx,%ecx
+    1bf5:	fc                   	cld
+    1bf6:	f3 aa                	rep stos %al,%es:(%rdi)
+    1bf8:	89 ca                	mov    %ecx,%edx
+    1bfa:	48 89 fe             	mov    %rdi,%rsi
+    1bfd:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+    1c01:	89 55 f0             	mov    %edx,-0x10(%rbp)
+}
+
+int stat(char *n, struct stat *st) {
+  int fd;
+    1c04:	90                   	nop
+    1c05:	5d                   	pop    %rbp
+    1c06:	c3                   	ret
+
+0000000000001c07 <strcpy>:
+char *strcpy(char *s, char *t) {
+    1c07:	55                   	push   %rbp
+    1c08:	48 89 e5             	mov    %rsp,%rbp
+    1c0b:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    1c0f:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  os = s;
+    1c13:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1c17:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while ((*s++ = *t++) != 0)
+    1c1b:	90                   	nop
+    1c1c:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    1c20:	48 8d 42 01          	lea    0x1(%rdx),%rax
+    1c24:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    1c28:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1c2c:	48 8d 48 01          	lea    0x1(%rax),%rcx
+    1c30:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+    1c34:	0f b6 12             	movzbl (%rdx),%edx
+    1c37:	88 10                	mov    %dl,(%rax)
+    1c39:	0f b6 00             	movzbl (%rax),%eax
+    1c3c:	84 c0                	test   %al,%al
+    1c3e:	75 dc                	jne    1c1c <strcpy+0x15>
+  return os;
+    1c40:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    1c44:	5d                   	pop    %rbp
+    1c45:	c3                   	ret
+
+0000000000001c46 <strcmp>:
+int strcmp(const char *p, const char *q) {
+    1c46:	55                   	push   %rbp
+    1c47:	48 89 e5             	mov    %rsp,%rbp
+    1c4a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1c4e:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  while (*p && *p == *q)
+    1c52:	eb 0a                	jmp    1c5e <strcmp+0x18>
+    p++, q++;
+    1c54:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    1c59:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (*p && *p == *q)
+    1c5e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1c62:	0f b6 00             	movzbl (%rax),%eax
+    1c65:	84 c0                	test   %al,%al
+    1c67:	74 12                	je     1c7b <strcmp+0x35>
+    1c69:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1c6d:	0f b6 10             	movzbl (%rax),%edx
+    1c70:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1c74:	0f b6 00             	movzbl (%rax),%eax
+    1c77:	38 c2                	cmp    %al,%dl
+    1c79:	74 d9                	je     1c54 <strcmp+0xe>
+  return (uchar)*p - (uchar)*q;
+    1c7b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1c7f:	0f b6 00             	movzbl (%rax),%eax
+    1c82:	0f b6 d0             	movzbl %al,%edx
+    1c85:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1c89:	0f b6 00             	movzbl (%rax),%eax
+    1c8c:	0f b6 c0             	movzbl %al,%eax
+    1c8f:	29 c2                	sub    %eax,%edx
+    1c91:	89 d0                	mov    %edx,%eax
+}
+    1c93:	5d                   	pop    %rbp
+    1c94:	c3                   	ret
+
+0000000000001c95 <strlen>:
+uint strlen(char *s) {
+    1c95:	55                   	push   %rbp
+    1c96:	48 89 e5             	mov    %rsp,%rbp
+    1c99:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  for (n = 0; s[n]; n++)
+    1c9d:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+    1ca4:	eb 04                	jmp    1caa <strlen+0x15>
+    1ca6:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+    1caa:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1cad:	48 63 d0             	movslq %eax,%rdx
+    1cb0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1cb4:	48 01 d0             	add    %rdx,%rax
+    1cb7:	0f b6 00             	movzbl (%rax),%eax
+    1cba:	84 c0                	test   %al,%al
+    1cbc:	75 e8                	jne    1ca6 <strlen+0x11>
+  return n;
+    1cbe:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+    1cc1:	5d                   	pop    %rbp
+    1cc2:	c3                   	ret
+
+0000000000001cc3 <memset>:
+void *memset(void *dst, int c, uint n) {
+    1cc3:	55                   	push   %rbp
+    1cc4:	48 89 e5             	mov    %rsp,%rbp
+    1cc7:	48 83 ec 10          	sub    $0x10,%rsp
+    1ccb:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1ccf:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    1cd2:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  stosb(dst, c, n);
+    1cd5:	8b 55 f0             	mov    -0x10(%rbp),%edx
+    1cd8:	8b 4d f4             	mov    -0xc(%rbp),%ecx
+    1cdb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1cdf:	89 ce                	mov    %ecx,%esi
+    1ce1:	48 89 c7             	mov    %rax,%rdi
+    1ce4:	e8 ec fe ff ff       	call   1bd5 <stosb>
+  return dst;
+    1ce9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    1ced:	c9                   	leave
+    1cee:	c3                   	ret
+
+0000000000001cef <strchr>:
+char *strchr(const char *s, char c) {
+    1cef:	55                   	push   %rbp
+    1cf0:	48 89 e5             	mov    %rsp,%rbp
+    1cf3:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1cf7:	89 f0                	mov    %esi,%eax
+    1cf9:	88 45 f4             	mov    %al,-0xc(%rbp)
+  for (; *s; s++)
+    1cfc:	eb 17                	jmp    1d15 <strchr+0x26>
+    if (*s == c)
+    1cfe:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1d02:	0f b6 00             	movzbl (%rax),%eax
+    1d05:	38 45 f4             	cmp    %al,-0xc(%rbp)
+    1d08:	75 06                	jne    1d10 <strchr+0x21>
+      return (char *)s;
+    1d0a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1d0e:	eb 15                	jmp    1d25 <strchr+0x36>
+  for (; *s; s++)
+    1d10:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    1d15:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1d19:	0f b6 00             	movzbl (%rax),%eax
+    1d1c:	84 c0                	test   %al,%al
+    1d1e:	75 de                	jne    1cfe <strchr+0xf>
+  return 0;
+    1d20:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    1d25:	5d                   	pop    %rbp
+    1d26:	c3                   	ret
+
+0000000000001d27 <gets>:
+char *gets(char *buf, int max) {
+    1d27:	55                   	push   %rbp
+    1d28:	48 89 e5             	mov    %rsp,%rbp
+    1d2b:	48 83 ec 20          	sub    $0x20,%rsp
+    1d2f:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    1d33:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  for (i = 0; i + 1 < max;) {
+    1d36:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+    1d3d:	eb 48                	jmp    1d87 <gets+0x60>
+    cc = read(0, &c, 1);
+    1d3f:	48 8d 45 f7          	lea    -0x9(%rbp),%rax
+    1d43:	ba 01 00 00 00       	mov    $0x1,%edx
+    1d48:	48 89 c6             	mov    %rax,%rsi
+    1d4b:	bf 00 00 00 00       	mov    $0x0,%edi
+    1d50:	e8 6f 01 00 00       	call   1ec4 <read>
+    1d55:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    if (cc < 1)
+    1d58:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+    1d5c:	7e 36                	jle    1d94 <gets+0x6d>
+    buf[i++] = c;
+    1d5e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1d61:	8d 50 01             	lea    0x1(%rax),%edx
+    1d64:	89 55 fc             	mov    %edx,-0x4(%rbp)
+    1d67:	48 63 d0             	movslq %eax,%rdx
+    1d6a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1d6e:	48 01 c2             	add    %rax,%rdx
+    1d71:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+    1d75:	88 02                	mov    %al,(%rdx)
+    if (c == '\n' || c == '\r')
+    1d77:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+    1d7b:	3c 0a                	cmp    $0xa,%al
+    1d7d:	74 16                	je     1d95 <gets+0x6e>
+    1d7f:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+    1d83:	3c 0d                	cmp    $0xd,%al
+    1d85:	74 0e                	je     1d95 <gets+0x6e>
+  for (i = 0; i + 1 < max;) {
+    1d87:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1d8a:	83 c0 01             	add    $0x1,%eax
+    1d8d:	39 45 e4             	cmp    %eax,-0x1c(%rbp)
+    1d90:	7f ad                	jg     1d3f <gets+0x18>
+    1d92:	eb 01                	jmp    1d95 <gets+0x6e>
+      break;
+    1d94:	90                   	nop
+  buf[i] = '\0';
+    1d95:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1d98:	48 63 d0             	movslq %eax,%rdx
+    1d9b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1d9f:	48 01 d0             	add    %rdx,%rax
+    1da2:	c6 00 00             	movb   $0x0,(%rax)
+  return buf;
+    1da5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+    1da9:	c9                   	leave
+    1daa:	c3                   	ret
+
+0000000000001dab <stat>:
+int stat(char *n, struct stat *st) {
+    1dab:	55                   	push   %rbp
+    1dac:	48 89 e5             	mov    %rsp,%rbp
+    1daf:	48 83 ec 20          	sub    $0x20,%rsp
+    1db3:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    1db7:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int r;
+
+  fd = open(n, O_RDONLY);
+    1dbb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1dbf:	be 00 00 00 00       	mov    $0x0,%esi
+    1dc4:	48 89 c7             	mov    %rax,%rdi
+    1dc7:	e8 20 01 00 00       	call   1eec <open>
+    1dcc:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  if (fd < 0)
+    1dcf:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+    1dd3:	79 07                	jns    1ddc <stat+0x31>
+    return -1;
+    1dd5:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1dda:	eb 21                	jmp    1dfd <stat+0x52>
+  r = fstat(fd, st);
+    1ddc:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    1de0:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1de3:	48 89 d6             	mov    %rdx,%rsi
+    1de6:	89 c7                	mov    %eax,%edi
+    1de8:	e8 17 01 00 00       	call   1f04 <fstat>
+    1ded:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  close(fd);
+    1df0:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1df3:	89 c7                	mov    %eax,%edi
+    1df5:	e8 da 00 00 00       	call   1ed4 <close>
+  return r;
+    1dfa:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+    1dfd:	c9                   	leave
+    1dfe:	c3                   	ret
+
+0000000000001dff <atoi>:
+
+int atoi(const char *s) {
+    1dff:	55                   	push   %rbp
+    1e00:	48 89 e5             	mov    %rsp,%rbp
+    1e03:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int n;
+
+  n = 0;
+    1e07:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  while ('0' <= *s && *s <= '9')
+    1e0e:	eb 28                	jmp    1e38 <atoi+0x39>
+    n = n * 10 + *s++ - '0';
+    1e10:	8b 55 fc             	mov    -0x4(%rbp),%edx
+    1e13:	89 d0                	mov    %edx,%eax
+    1e15:	c1 e0 02             	shl    $0x2,%eax
+    1e18:	01 d0                	add    %edx,%eax
+    1e1a:	01 c0                	add    %eax,%eax
+    1e1c:	89 c1                	mov    %eax,%ecx
+    1e1e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1e22:	48 8d 50 01          	lea    0x1(%rax),%rdx
+    1e26:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    1e2a:	0f b6 00             	movzbl (%rax),%eax
+    1e2d:	0f be c0             	movsbl %al,%eax
+    1e30:	01 c8                	add    %ecx,%eax
+    1e32:	83 e8 30             	sub    $0x30,%eax
+    1e35:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while ('0' <= *s && *s <= '9')
+    1e38:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1e3c:	0f b6 00             	movzbl (%rax),%eax
+    1e3f:	3c 2f                	cmp    $0x2f,%al
+    1e41:	7e 0b                	jle    1e4e <atoi+0x4f>
+    1e43:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1e47:	0f b6 00             	movzbl (%rax),%eax
+    1e4a:	3c 39                	cmp    $0x39,%al
+    1e4c:	7e c2                	jle    1e10 <atoi+0x11>
+  return n;
+    1e4e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+    1e51:	5d                   	pop    %rbp
+    1e52:	c3                   	ret
+
+0000000000001e53 <memmove>:
+
+void *memmove(void *vdst, void *vsrc, int n) {
+    1e53:	55                   	push   %rbp
+    1e54:	48 89 e5             	mov    %rsp,%rbp
+    1e57:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    1e5b:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    1e5f:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  char *dst, *src;
+
+  dst = vdst;
+    1e62:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1e66:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  src = vsrc;
+    1e6a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1e6e:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  while (n-- > 0)
+    1e72:	eb 1d                	jmp    1e91 <memmove+0x3e>
+    *dst++ = *src++;
+    1e74:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    1e78:	48 8d 42 01          	lea    0x1(%rdx),%rax
+    1e7c:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    1e80:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1e84:	48 8d 48 01          	lea    0x1(%rax),%rcx
+    1e88:	48 89 4d f8          	mov    %rcx,-0x8(%rbp)
+    1e8c:	0f b6 12             	movzbl (%rdx),%edx
+    1e8f:	88 10                	mov    %dl,(%rax)
+  while (n-- > 0)
+    1e91:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1e94:	8d 50 ff             	lea    -0x1(%rax),%edx
+    1e97:	89 55 dc             	mov    %edx,-0x24(%rbp)
+    1e9a:	85 c0                	test   %eax,%eax
+    1e9c:	7f d6                	jg     1e74 <memmove+0x21>
+  return vdst;
+    1e9e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1ea2:	5d                   	pop    %rbp
+    1ea3:	c3                   	ret
+
+0000000000001ea4 <fork>:
+  name:                                                                        \
+  movl $SYS_##name, % eax;                                                     \
+  int $TRAP_SYSCALL;                                                           \
+  ret
+
+SYSCALL(fork)
+    1ea4:	b8 01 00 00 00       	mov    $0x1,%eax
+    1ea9:	cd 40                	int    $0x40
+    1eab:	c3                   	ret
+
+0000000000001eac <exit>:
+SYSCALL(exit)
+    1eac:	b8 02 00 00 00       	mov    $0x2,%eax
+    1eb1:	cd 40                	int    $0x40
+    1eb3:	c3                   	ret
+
+0000000000001eb4 <wait>:
+SYSCALL(wait)
+    1eb4:	b8 03 00 00 00       	mov    $0x3,%eax
+    1eb9:	cd 40                	int    $0x40
+    1ebb:	c3                   	ret
+
+0000000000001ebc <pipe>:
+SYSCALL(pipe)
+    1ebc:	b8 04 00 00 00       	mov    $0x4,%eax
+    1ec1:	cd 40                	int    $0x40
+    1ec3:	c3                   	ret
+
+0000000000001ec4 <read>:
+SYSCALL(read)
+    1ec4:	b8 05 00 00 00       	mov    $0x5,%eax
+    1ec9:	cd 40                	int    $0x40
+    1ecb:	c3                   	ret
+
+0000000000001ecc <write>:
+SYSCALL(write)
+    1ecc:	b8 10 00 00 00       	mov    $0x10,%eax
+    1ed1:	cd 40                	int    $0x40
+    1ed3:	c3                   	ret
+
+0000000000001ed4 <close>:
+SYSCALL(close)
+    1ed4:	b8 15 00 00 00       	mov    $0x15,%eax
+    1ed9:	cd 40                	int    $0x40
+    1edb:	c3                   	ret
+
+0000000000001edc <kill>:
+SYSCALL(kill)
+    1edc:	b8 06 00 00 00       	mov    $0x6,%eax
+    1ee1:	cd 40                	int    $0x40
+    1ee3:	c3                   	ret
+
+0000000000001ee4 <exec>:
+SYSCALL(exec)
+    1ee4:	b8 07 00 00 00       	mov    $0x7,%eax
+    1ee9:	cd 40                	int    $0x40
+    1eeb:	c3                   	ret
+
+0000000000001eec <open>:
+SYSCALL(open)
+    1eec:	b8 0f 00 00 00       	mov    $0xf,%eax
+    1ef1:	cd 40                	int    $0x40
+    1ef3:	c3                   	ret
+
+0000000000001ef4 <mknod>:
+SYSCALL(mknod)
+    1ef4:	b8 11 00 00 00       	mov    $0x11,%eax
+    1ef9:	cd 40                	int    $0x40
+    1efb:	c3                   	ret
+
+0000000000001efc <unlink>:
+SYSCALL(unlink)
+    1efc:	b8 12 00 00 00       	mov    $0x12,%eax
+    1f01:	cd 40                	int    $0x40
+    1f03:	c3                   	ret
+
+0000000000001f04 <fstat>:
+SYSCALL(fstat)
+    1f04:	b8 08 00 00 00       	mov    $0x8,%eax
+    1f09:	cd 40                	int    $0x40
+    1f0b:	c3                   	ret
+
+0000000000001f0c <link>:
+SYSCALL(link)
+    1f0c:	b8 13 00 00 00       	mov    $0x13,%eax
+    1f11:	cd 40                	int    $0x40
+    1f13:	c3                   	ret
+
+0000000000001f14 <mkdir>:
+SYSCALL(mkdir)
+    1f14:	b8 14 00 00 00       	mov    $0x14,%eax
+    1f19:	cd 40                	int    $0x40
+    1f1b:	c3                   	ret
+
+0000000000001f1c <chdir>:
+SYSCALL(chdir)
+    1f1c:	b8 09 00 00 00       	mov    $0x9,%eax
+    1f21:	cd 40                	int    $0x40
+    1f23:	c3                   	ret
+
+0000000000001f24 <dup>:
+SYSCALL(dup)
+    1f24:	b8 0a 00 00 00       	mov    $0xa,%eax
+    1f29:	cd 40                	int    $0x40
+    1f2b:	c3                   	ret
+
+0000000000001f2c <getpid>:
+SYSCALL(getpid)
+    1f2c:	b8 0b 00 00 00       	mov    $0xb,%eax
+    1f31:	cd 40                	int    $0x40
+    1f33:	c3                   	ret
+
+0000000000001f34 <sbrk>:
+SYSCALL(sbrk)
+    1f34:	b8 0c 00 00 00       	mov    $0xc,%eax
+    1f39:	cd 40                	int    $0x40
+    1f3b:	c3                   	ret
+
+0000000000001f3c <sleep>:
+SYSCALL(sleep)
+    1f3c:	b8 0d 00 00 00       	mov    $0xd,%eax
+    1f41:	cd 40                	int    $0x40
+    1f43:	c3                   	ret
+
+0000000000001f44 <uptime>:
+SYSCALL(uptime)
+    1f44:	b8 0e 00 00 00       	mov    $0xe,%eax
+    1f49:	cd 40                	int    $0x40
+    1f4b:	c3                   	ret
+
+0000000000001f4c <sysinfo>:
+SYSCALL(sysinfo)
+    1f4c:	b8 16 00 00 00       	mov    $0x16,%eax
+    1f51:	cd 40                	int    $0x40
+    1f53:	c3                   	ret
+
+0000000000001f54 <crashn>:
+SYSCALL(crashn)
+    1f54:	b8 17 00 00 00       	mov    $0x17,%eax
+    1f59:	cd 40                	int    $0x40
+    1f5b:	c3                   	ret
+
+0000000000001f5c <sync>:
+SYSCALL(sync)
+    1f5c:	b8 18 00 00 00       	mov    $0x18,%eax
+    1f61:	cd 40                	int    $0x40
+    1f63:	c3                   	ret
+
+0000000000001f64 <fsync>:
+SYSCALL(fsync)
+    1f64:	b8 19 00 00 00       	mov    $0x19,%eax
+    1f69:	cd 40                	int    $0x40
+    1f6b:	c3                   	ret
+
+0000000000001f6c <free>:
+typedef union header Header;
+
+static Header base;
+static Header *freep;
+
+void free(void *ap) {
+    1f6c:	55                   	push   %rbp
+    1f6d:	48 89 e5             	mov    %rsp,%rbp
+    1f70:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  Header *bp, *p;
+
+  bp = (Header *)ap - 1;
+    1f74:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1f78:	48 83 e8 10          	sub    $0x10,%rax
+    1f7c:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  for (p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    1f80:	48 8b 05 e9 09 00 00 	mov    0x9e9(%rip),%rax        # 2970 <freep>
+    1f87:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    1f8b:	eb 2f                	jmp    1fbc <free+0x50>
+    if (p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    1f8d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1f91:	48 8b 00             	mov    (%rax),%rax
+    1f94:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+    1f98:	72 17                	jb     1fb1 <free+0x45>
+    1f9a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1f9e:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+    1fa2:	72 2f                	jb     1fd3 <free+0x67>
+    1fa4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1fa8:	48 8b 00             	mov    (%rax),%rax
+    1fab:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+    1faf:	72 22                	jb     1fd3 <free+0x67>
+  for (p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    1fb1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1fb5:	48 8b 00             	mov    (%rax),%rax
+    1fb8:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    1fbc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1fc0:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+    1fc4:	73 c7                	jae    1f8d <free+0x21>
+    1fc6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1fca:	48 8b 00             	mov    (%rax),%rax
+    1fcd:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+    1fd1:	73 ba                	jae    1f8d <free+0x21>
+      break;
+  if (bp + bp->s.size == p->s.ptr) {
+    1fd3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1fd7:	8b 40 08             	mov    0x8(%rax),%eax
+    1fda:	89 c0                	mov    %eax,%eax
+    1fdc:	48 c1 e0 04          	shl    $0x4,%rax
+    1fe0:	48 89 c2             	mov    %rax,%rdx
+    1fe3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1fe7:	48 01 c2             	add    %rax,%rdx
+    1fea:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1fee:	48 8b 00             	mov    (%rax),%rax
+    1ff1:	48 39 c2             	cmp    %rax,%rdx
+    1ff4:	75 2d                	jne    2023 <free+0xb7>
+    bp->s.size += p->s.ptr->s.size;
+    1ff6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1ffa:	8b 50 08             	mov    0x8(%rax),%edx
+    1ffd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2001:	48 8b 00             	mov    (%rax),%rax
+    2004:	8b 40 08             	mov    0x8(%rax),%eax
+    2007:	01 c2                	add    %eax,%edx
+    2009:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    200d:	89 50 08             	mov    %edx,0x8(%rax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+    2010:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2014:	48 8b 00             	mov    (%rax),%rax
+    2017:	48 8b 10             	mov    (%rax),%rdx
+    201a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    201e:	48 89 10             	mov    %rdx,(%rax)
+    2021:	eb 0e                	jmp    2031 <free+0xc5>
+  } else
+    bp->s.ptr = p->s.ptr;
+    2023:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2027:	48 8b 10             	mov    (%rax),%rdx
+    202a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    202e:	48 89 10             	mov    %rdx,(%rax)
+  if (p + p->s.size == bp) {
+    2031:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2035:	8b 40 08             	mov    0x8(%rax),%eax
+    2038:	89 c0                	mov    %eax,%eax
+    203a:	48 c1 e0 04          	shl    $0x4,%rax
+    203e:	48 89 c2             	mov    %rax,%rdx
+    2041:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2045:	48 01 d0             	add    %rdx,%rax
+    2048:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+    204c:	75 27                	jne    2075 <free+0x109>
+    p->s.size += bp->s.size;
+    204e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2052:	8b 50 08             	mov    0x8(%rax),%edx
+    2055:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2059:	8b 40 08             	mov    0x8(%rax),%eax
+    205c:	01 c2                	add    %eax,%edx
+    205e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2062:	89 50 08             	mov    %edx,0x8(%rax)
+    p->s.ptr = bp->s.ptr;
+    2065:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2069:	48 8b 10             	mov    (%rax),%rdx
+    206c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2070:	48 89 10             	mov    %rdx,(%rax)
+    2073:	eb 0b                	jmp    2080 <free+0x114>
+  } else
+    p->s.ptr = bp;
+    2075:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2079:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    207d:	48 89 10             	mov    %rdx,(%rax)
+  freep = p;
+    2080:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2084:	48 89 05 e5 08 00 00 	mov    %rax,0x8e5(%rip)        # 2970 <freep>
+}
+    208b:	90                   	nop
+    208c:	5d                   	pop    %rbp
+    208d:	c3                   	ret
+
+000000000000208e <morecore>:
+
+static Header *morecore(uint nu) {
+    208e:	55                   	push   %rbp
+    208f:	48 89 e5             	mov    %rsp,%rbp
+    2092:	48 83 ec 20          	sub    $0x20,%rsp
+    2096:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  char *p;
+  Header *hp;
+
+  if (nu < 4096)
+    2099:	81 7d ec ff 0f 00 00 	cmpl   $0xfff,-0x14(%rbp)
+    20a0:	77 07                	ja     20a9 <morecore+0x1b>
+    nu = 4096;
+    20a2:	c7 45 ec 00 10 00 00 	movl   $0x1000,-0x14(%rbp)
+  p = sbrk(nu * sizeof(Header));
+    20a9:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    20ac:	c1 e0 04             	shl    $0x4,%eax
+    20af:	89 c7                	mov    %eax,%edi
+    20b1:	e8 7e fe ff ff       	call   1f34 <sbrk>
+    20b6:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (p == (char *)-1)
+    20ba:	48 83 7d f8 ff       	cmpq   $0xffffffffffffffff,-0x8(%rbp)
+    20bf:	75 07                	jne    20c8 <morecore+0x3a>
+    return 0;
+    20c1:	b8 00 00 00 00       	mov    $0x0,%eax
+    20c6:	eb 29                	jmp    20f1 <morecore+0x63>
+  hp = (Header *)p;
+    20c8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    20cc:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  hp->s.size = nu;
+    20d0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    20d4:	8b 55 ec             	mov    -0x14(%rbp),%edx
+    20d7:	89 50 08             	mov    %edx,0x8(%rax)
+  free((void *)(hp + 1));
+    20da:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    20de:	48 83 c0 10          	add    $0x10,%rax
+    20e2:	48 89 c7             	mov    %rax,%rdi
+    20e5:	e8 82 fe ff ff       	call   1f6c <free>
+  return freep;
+    20ea:	48 8b 05 7f 08 00 00 	mov    0x87f(%rip),%rax        # 2970 <freep>
+}
+    20f1:	c9                   	leave
+    20f2:	c3                   	ret
+
+00000000000020f3 <malloc>:
+
+void *malloc(uint nbytes) {
+    20f3:	55                   	push   %rbp
+    20f4:	48 89 e5             	mov    %rsp,%rbp
+    20f7:	48 83 ec 30          	sub    $0x30,%rsp
+    20fb:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1) / sizeof(Header) + 1;
+    20fe:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    2101:	48 83 c0 0f          	add    $0xf,%rax
+    2105:	48 c1 e8 04          	shr    $0x4,%rax
+    2109:	83 c0 01             	add    $0x1,%eax
+    210c:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  if ((prevp = freep) == 0) {
+    210f:	48 8b 05 5a 08 00 00 	mov    0x85a(%rip),%rax        # 2970 <freep>
+    2116:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    211a:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+    211f:	75 2e                	jne    214f <malloc+0x5c>
+    base.s.ptr = freep = prevp = &base;
+    2121:	48 8d 05 38 08 00 00 	lea    0x838(%rip),%rax        # 2960 <base>
+    2128:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    212c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2130:	48 89 05 39 08 00 00 	mov    %rax,0x839(%rip)        # 2970 <freep>
+    2137:	48 8b 05 32 08 00 00 	mov    0x832(%rip),%rax        # 2970 <freep>
+    213e:	48 89 05 1b 08 00 00 	mov    %rax,0x81b(%rip)        # 2960 <base>
+    base.s.size = 0;
+    2145:	c7 05 19 08 00 00 00 	movl   $0x0,0x819(%rip)        # 2968 <base+0x8>
+    214c:	00 00 00 
+  }
+  for (p = prevp->s.ptr;; prevp = p, p = p->s.ptr) {
+    214f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2153:	48 8b 00             	mov    (%rax),%rax
+    2156:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    if (p->s.size >= nunits) {
+    215a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    215e:	8b 40 08             	mov    0x8(%rax),%eax
+    2161:	3b 45 ec             	cmp    -0x14(%rbp),%eax
+    2164:	72 5f                	jb     21c5 <malloc+0xd2>
+      if (p->s.size == nunits)
+    2166:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    216a:	8b 40 08             	mov    0x8(%rax),%eax
+    216d:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+    2170:	75 10                	jne    2182 <malloc+0x8f>
+        prevp->s.ptr = p->s.ptr;
+    2172:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2176:	48 8b 10             	mov    (%rax),%rdx
+    2179:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    217d:	48 89 10             	mov    %rdx,(%rax)
+    2180:	eb 2e                	jmp    21b0 <malloc+0xbd>
+      else {
+        p->s.size -= nunits;
+    2182:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2186:	8b 40 08             	mov    0x8(%rax),%eax
+    2189:	2b 45 ec             	sub    -0x14(%rbp),%eax
+    218c:	89 c2                	mov    %eax,%edx
+    218e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2192:	89 50 08             	mov    %edx,0x8(%rax)
+        p += p->s.size;
+    2195:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2199:	8b 40 08             	mov    0x8(%rax),%eax
+    219c:	89 c0                	mov    %eax,%eax
+    219e:	48 c1 e0 04          	shl    $0x4,%rax
+    21a2:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+        p->s.size = nunits;
+    21a6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    21aa:	8b 55 ec             	mov    -0x14(%rbp),%edx
+    21ad:	89 50 08             	mov    %edx,0x8(%rax)
+      }
+      freep = prevp;
+    21b0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    21b4:	48 89 05 b5 07 00 00 	mov    %rax,0x7b5(%rip)        # 2970 <freep>
+      return (void *)(p + 1);
+    21bb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    21bf:	48 83 c0 10          	add    $0x10,%rax
+    21c3:	eb 41                	jmp    2206 <malloc+0x113>
+    }
+    if (p == freep)
+    21c5:	48 8b 05 a4 07 00 00 	mov    0x7a4(%rip),%rax        # 2970 <freep>
+    21cc:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+    21d0:	75 1c                	jne    21ee <malloc+0xfb>
+      if ((p = morecore(nunits)) == 0)
+    21d2:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    21d5:	89 c7                	mov    %eax,%edi
+    21d7:	e8 b2 fe ff ff       	call   208e <morecore>
+    21dc:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    21e0:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+    21e5:	75 07                	jne    21ee <malloc+0xfb>
+        return 0;
+    21e7:	b8 00 00 00 00       	mov    $0x0,%eax
+    21ec:	eb 18                	jmp    2206 <malloc+0x113>
+  for (p = prevp->s.ptr;; prevp = p, p = p->s.ptr) {
+    21ee:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    21f2:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    21f6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    21fa:	48 8b 00             	mov    (%rax),%rax
+    21fd:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    if (p->s.size >= nunits) {
+    2201:	e9 54 ff ff ff       	jmp    215a <malloc+0x67>
+  }
+    2206:	c9                   	leave
+    2207:	c3                   	ret
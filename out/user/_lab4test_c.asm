@@ -0,0 +1,1707 @@
+
+out/user/_lab4test_c:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000000000 <check_system_consistent>:
+  } while (0)
+
+
+// will return only if
+// system is consistent.
+void check_system_consistent() {
+       0:	55                   	push   %rbp
+       1:	48 89 e5             	mov    %rsp,%rbp
+       4:	48 83 ec 20          	sub    $0x20,%rsp
+  int fd;
+  struct stat st;
+  fd = open(file_name, O_RDONLY);
+       8:	48 8b 05 51 16 00 00 	mov    0x1651(%rip),%rax        # 1660 <file_name>
+       f:	be 00 00 00 00       	mov    $0x0,%esi
+      14:	48 89 c7             	mov    %rax,%rdi
+      17:	e8 56 0d 00 00       	call   d72 <open>
+      1c:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  if (fd < 0) {
+      1f:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+      23:	0f 89 5e 01 00 00    	jns    187 <check_system_consistent+0x187>
+    // File has not been created yet.
+    // Ensure the root directory hasn't changed.
+    fd = open(".", O_RDONLY);
+      29:	be 00 00 00 00       	mov    $0x0,%esi
+      2e:	48 8d 05 67 10 00 00 	lea    0x1067(%rip),%rax        # 109c <malloc+0x123>
+      35:	48 89 c7             	mov    %rax,%rdi
+      38:	e8 35 0d 00 00       	call   d72 <open>
+      3d:	89 45 fc             	mov    %eax,-0x4(%rbp)
+    if (fstat(fd, &st) != 0) {
+      40:	48 8d 55 ec          	lea    -0x14(%rbp),%rdx
+      44:	8b 45 fc             	mov    -0x4(%rbp),%eax
+      47:	48 89 d6             	mov    %rdx,%rsi
+      4a:	89 c7                	mov    %eax,%edi
+      4c:	e8 39 0d 00 00       	call   d8a <fstat>
+      51:	85 c0                	test   %eax,%eax
+      53:	74 5c                	je     b1 <check_system_consistent+0xb1>
+      error("New file does not exist: Cannot stat root directoy. Not consistent.");
+      55:	8b 05 f5 15 00 00    	mov    0x15f5(%rip),%eax        # 1650 <stdout>
+      5b:	ba 27 00 00 00       	mov    $0x27,%edx
+      60:	48 8d 0d 37 10 00 00 	lea    0x1037(%rip),%rcx        # 109e <malloc+0x125>
+      67:	48 89 ce             	mov    %rcx,%rsi
+      6a:	89 c7                	mov    %eax,%edi
+      6c:	b8 00 00 00 00       	mov    $0x0,%eax
+      71:	e8 15 07 00 00       	call   78b <printf>
+      76:	8b 05 d4 15 00 00    	mov    0x15d4(%rip),%eax        # 1650 <stdout>
+      7c:	48 8d 15 2d 10 00 00 	lea    0x102d(%rip),%rdx        # 10b0 <malloc+0x137>
+      83:	48 89 d6             	mov    %rdx,%rsi
+      86:	89 c7                	mov    %eax,%edi
+      88:	b8 00 00 00 00       	mov    $0x0,%eax
+      8d:	e8 f9 06 00 00       	call   78b <printf>
+      92:	8b 05 b8 15 00 00    	mov    0x15b8(%rip),%eax        # 1650 <stdout>
+      98:	48 8d 15 55 10 00 00 	lea    0x1055(%rip),%rdx        # 10f4 <malloc+0x17b>
+      9f:	48 89 d6             	mov    %rdx,%rsi
+      a2:	89 c7                	mov    %eax,%edi
+      a4:	b8 00 00 00 00       	mov    $0x0,%eax
+      a9:	e8 dd 06 00 00       	call   78b <printf>
+      ae:	90                   	nop
+      af:	eb fd                	jmp    ae <check_system_consistent+0xae>
+    }
+    if (st.size > ROOT_DIR_START_SIZE) {
+      b1:	8b 45 f8             	mov    -0x8(%rbp),%eax
+      b4:	8b 15 9a 15 00 00    	mov    0x159a(%rip),%edx        # 1654 <ROOT_DIR_START_SIZE>
+      ba:	39 c2                	cmp    %eax,%edx
+      bc:	73 5c                	jae    11a <check_system_consistent+0x11a>
+      error("Root dir size grew, but data does not exist. Not consistent.");
+      be:	8b 05 8c 15 00 00    	mov    0x158c(%rip),%eax        # 1650 <stdout>
+      c4:	ba 2a 00 00 00       	mov    $0x2a,%edx
+      c9:	48 8d 0d ce 0f 00 00 	lea    0xfce(%rip),%rcx        # 109e <malloc+0x125>
+      d0:	48 89 ce             	mov    %rcx,%rsi
+      d3:	89 c7                	mov    %eax,%edi
+      d5:	b8 00 00 00 00       	mov    $0x0,%eax
+      da:	e8 ac 06 00 00       	call   78b <printf>
+      df:	8b 05 6b 15 00 00    	mov    0x156b(%rip),%eax        # 1650 <stdout>
+      e5:	48 8d 15 0c 10 00 00 	lea    0x100c(%rip),%rdx        # 10f8 <malloc+0x17f>
+      ec:	48 89 d6             	mov    %rdx,%rsi
+      ef:	89 c7                	mov    %eax,%edi
+      f1:	b8 00 00 00 00       	mov    $0x0,%eax
+      f6:	e8 90 06 00 00       	call   78b <printf>
+      fb:	8b 05 4f 15 00 00    	mov    0x154f(%rip),%eax        # 1650 <stdout>
+     101:	48 8d 15 ec 0f 00 00 	lea    0xfec(%rip),%rdx        # 10f4 <malloc+0x17b>
+     108:	48 89 d6             	mov    %rdx,%rsi
+     10b:	89 c7                	mov    %eax,%edi
+     10d:	b8 00 00 00 00       	mov    $0x0,%eax
+     112:	e8 74 06 00 00       	call   78b <printf>
+     117:	90                   	nop
+     118:	eb fd                	jmp    117 <check_system_consistent+0x117>
+    }
+    if (st.size < ROOT_DIR_START_SIZE) {
+     11a:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     11d:	8b 15 31 15 00 00    	mov    0x1531(%rip),%edx        # 1654 <ROOT_DIR_START_SIZE>
+     123:	39 d0                	cmp    %edx,%eax
+     125:	0f 83 4a 02 00 00    	jae    375 <check_system_consistent+0x375>
+      error("Root size shrunk, uh oh. Not consistent.");
+     12b:	8b 05 1f 15 00 00    	mov    0x151f(%rip),%eax        # 1650 <stdout>
+     131:	ba 2d 00 00 00       	mov    $0x2d,%edx
+     136:	48 8d 0d 61 0f 00 00 	lea    0xf61(%rip),%rcx        # 109e <malloc+0x125>
+     13d:	48 89 ce             	mov    %rcx,%rsi
+     140:	89 c7                	mov    %eax,%edi
+     142:	b8 00 00 00 00       	mov    $0x0,%eax
+     147:	e8 3f 06 00 00       	call   78b <printf>
+     14c:	8b 05 fe 14 00 00    	mov    0x14fe(%rip),%eax        # 1650 <stdout>
+     152:	48 8d 15 df 0f 00 00 	lea    0xfdf(%rip),%rdx        # 1138 <malloc+0x1bf>
+     159:	48 89 d6             	mov    %rdx,%rsi
+     15c:	89 c7                	mov    %eax,%edi
+     15e:	b8 00 00 00 00       	mov    $0x0,%eax
+     163:	e8 23 06 00 00       	call   78b <printf>
+     168:	8b 05 e2 14 00 00    	mov    0x14e2(%rip),%eax        # 1650 <stdout>
+     16e:	48 8d 15 7f 0f 00 00 	lea    0xf7f(%rip),%rdx        # 10f4 <malloc+0x17b>
+     175:	48 89 d6             	mov    %rdx,%rsi
+     178:	89 c7                	mov    %eax,%edi
+     17a:	b8 00 00 00 00       	mov    $0x0,%eax
+     17f:	e8 07 06 00 00       	call   78b <printf>
+     184:	90                   	nop
+     185:	eb fd                	jmp    184 <check_system_consistent+0x184>
+    }
+  } else {
+    // File does exist.
+    if (fstat(fd, &st) != 0) {
+     187:	48 8d 55 ec          	lea    -0x14(%rbp),%rdx
+     18b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     18e:	48 89 d6             	mov    %rdx,%rsi
+     191:	89 c7                	mov    %eax,%edi
+     193:	e8 f2 0b 00 00       	call   d8a <fstat>
+     198:	85 c0                	test   %eax,%eax
+     19a:	74 5c                	je     1f8 <check_system_consistent+0x1f8>
+      error("Cannot stat new file. Not consistent.");
+     19c:	8b 05 ae 14 00 00    	mov    0x14ae(%rip),%eax        # 1650 <stdout>
+     1a2:	ba 32 00 00 00       	mov    $0x32,%edx
+     1a7:	48 8d 0d f0 0e 00 00 	lea    0xef0(%rip),%rcx        # 109e <malloc+0x125>
+     1ae:	48 89 ce             	mov    %rcx,%rsi
+     1b1:	89 c7                	mov    %eax,%edi
+     1b3:	b8 00 00 00 00       	mov    $0x0,%eax
+     1b8:	e8 ce 05 00 00       	call   78b <printf>
+     1bd:	8b 05 8d 14 00 00    	mov    0x148d(%rip),%eax        # 1650 <stdout>
+     1c3:	48 8d 15 9e 0f 00 00 	lea    0xf9e(%rip),%rdx        # 1168 <malloc+0x1ef>
+     1ca:	48 89 d6             	mov    %rdx,%rsi
+     1cd:	89 c7                	mov    %eax,%edi
+     1cf:	b8 00 00 00 00       	mov    $0x0,%eax
+     1d4:	e8 b2 05 00 00       	call   78b <printf>
+     1d9:	8b 05 71 14 00 00    	mov    0x1471(%rip),%eax        # 1650 <stdout>
+     1df:	48 8d 15 0e 0f 00 00 	lea    0xf0e(%rip),%rdx        # 10f4 <malloc+0x17b>
+     1e6:	48 89 d6             	mov    %rdx,%rsi
+     1e9:	89 c7                	mov    %eax,%edi
+     1eb:	b8 00 00 00 00       	mov    $0x0,%eax
+     1f0:	e8 96 05 00 00       	call   78b <printf>
+     1f5:	90                   	nop
+     1f6:	eb fd                	jmp    1f5 <check_system_consistent+0x1f5>
+    }
+    // Ensure that the inode wasn't already allocated in the inodefile.
+    // Note: This will error when the inodefile is updated, but the root inode wasn't.
+    if (st.ino != INUM_START + 1) {
+     1f8:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     1fb:	8b 15 5b 14 00 00    	mov    0x145b(%rip),%edx        # 165c <INUM_START>
+     201:	83 c2 01             	add    $0x1,%edx
+     204:	39 d0                	cmp    %edx,%eax
+     206:	74 65                	je     26d <check_system_consistent+0x26d>
+      error("New file inum is invalid, inum=%d, inum_expected=%d. Not consistent.", st.ino, INUM_START + 1);
+     208:	8b 05 42 14 00 00    	mov    0x1442(%rip),%eax        # 1650 <stdout>
+     20e:	ba 37 00 00 00       	mov    $0x37,%edx
+     213:	48 8d 0d 84 0e 00 00 	lea    0xe84(%rip),%rcx        # 109e <malloc+0x125>
+     21a:	48 89 ce             	mov    %rcx,%rsi
+     21d:	89 c7                	mov    %eax,%edi
+     21f:	b8 00 00 00 00       	mov    $0x0,%eax
+     224:	e8 62 05 00 00       	call   78b <printf>
+     229:	8b 05 2d 14 00 00    	mov    0x142d(%rip),%eax        # 165c <INUM_START>
+     22f:	8d 48 01             	lea    0x1(%rax),%ecx
+     232:	8b 55 f4             	mov    -0xc(%rbp),%edx
+     235:	8b 05 15 14 00 00    	mov    0x1415(%rip),%eax        # 1650 <stdout>
+     23b:	48 8d 35 4e 0f 00 00 	lea    0xf4e(%rip),%rsi        # 1190 <malloc+0x217>
+     242:	89 c7                	mov    %eax,%edi
+     244:	b8 00 00 00 00       	mov    $0x0,%eax
+     249:	e8 3d 05 00 00       	call   78b <printf>
+     24e:	8b 05 fc 13 00 00    	mov    0x13fc(%rip),%eax        # 1650 <stdout>
+     254:	48 8d 15 99 0e 00 00 	lea    0xe99(%rip),%rdx        # 10f4 <malloc+0x17b>
+     25b:	48 89 d6             	mov    %rdx,%rsi
+     25e:	89 c7                	mov    %eax,%edi
+     260:	b8 00 00 00 00       	mov    $0x0,%eax
+     265:	e8 21 05 00 00       	call   78b <printf>
+     26a:	90                   	nop
+     26b:	eb fd                	jmp    26a <check_system_consistent+0x26a>
+    }
+    // Ensure that the root directory grew by 1 dirent.
+    fd = open(".", O_RDONLY);
+     26d:	be 00 00 00 00       	mov    $0x0,%esi
+     272:	48 8d 05 23 0e 00 00 	lea    0xe23(%rip),%rax        # 109c <malloc+0x123>
+     279:	48 89 c7             	mov    %rax,%rdi
+     27c:	e8 f1 0a 00 00       	call   d72 <open>
+     281:	89 45 fc             	mov    %eax,-0x4(%rbp)
+    if (fstat(fd, &st) != 0) {
+     284:	48 8d 55 ec          	lea    -0x14(%rbp),%rdx
+     288:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     28b:	48 89 d6             	mov    %rdx,%rsi
+     28e:	89 c7                	mov    %eax,%edi
+     290:	e8 f5 0a 00 00       	call   d8a <fstat>
+     295:	85 c0                	test   %eax,%eax
+     297:	74 5c                	je     2f5 <check_system_consistent+0x2f5>
+      error("Cannot stat root directoy. Not consistent.");
+     299:	8b 05 b1 13 00 00    	mov    0x13b1(%rip),%eax        # 1650 <stdout>
+     29f:	ba 3c 00 00 00       	mov    $0x3c,%edx
+     2a4:	48 8d 0d f3 0d 00 00 	lea    0xdf3(%rip),%rcx        # 109e <malloc+0x125>
+     2ab:	48 89 ce             	mov    %rcx,%rsi
+     2ae:	89 c7                	mov    %eax,%edi
+     2b0:	b8 00 00 00 00       	mov    $0x0,%eax
+     2b5:	e8 d1 04 00 00       	call   78b <printf>
+     2ba:	8b 05 90 13 00 00    	mov    0x1390(%rip),%eax        # 1650 <stdout>
+     2c0:	48 8d 15 11 0f 00 00 	lea    0xf11(%rip),%rdx        # 11d8 <malloc+0x25f>
+     2c7:	48 89 d6             	mov    %rdx,%rsi
+     2ca:	89 c7                	mov    %eax,%edi
+     2cc:	b8 00 00 00 00       	mov    $0x0,%eax
+     2d1:	e8 b5 04 00 00       	call   78b <printf>
+     2d6:	8b 05 74 13 00 00    	mov    0x1374(%rip),%eax        # 1650 <stdout>
+     2dc:	48 8d 15 11 0e 00 00 	lea    0xe11(%rip),%rdx        # 10f4 <malloc+0x17b>
+     2e3:	48 89 d6             	mov    %rdx,%rsi
+     2e6:	89 c7                	mov    %eax,%edi
+     2e8:	b8 00 00 00 00       	mov    $0x0,%eax
+     2ed:	e8 99 04 00 00       	call   78b <printf>
+     2f2:	90                   	nop
+     2f3:	eb fd                	jmp    2f2 <check_system_consistent+0x2f2>
+    }
+    if (st.size != ROOT_DIR_START_SIZE + DIRENT_SIZE) {
+     2f5:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     2f8:	8b 0d 56 13 00 00    	mov    0x1356(%rip),%ecx        # 1654 <ROOT_DIR_START_SIZE>
+     2fe:	8b 15 54 13 00 00    	mov    0x1354(%rip),%edx        # 1658 <DIRENT_SIZE>
+     304:	01 ca                	add    %ecx,%edx
+     306:	39 d0                	cmp    %edx,%eax
+     308:	74 6b                	je     375 <check_system_consistent+0x375>
+      error("File exists but root directory size is incorrect, size=%d, size_expected=%d. Not consistent.", st.size, ROOT_DIR_START_SIZE + DIRENT_SIZE);
+     30a:	8b 05 40 13 00 00    	mov    0x1340(%rip),%eax        # 1650 <stdout>
+     310:	ba 3f 00 00 00       	mov    $0x3f,%edx
+     315:	48 8d 0d 82 0d 00 00 	lea    0xd82(%rip),%rcx        # 109e <malloc+0x125>
+     31c:	48 89 ce             	mov    %rcx,%rsi
+     31f:	89 c7                	mov    %eax,%edi
+     321:	b8 00 00 00 00       	mov    $0x0,%eax
+     326:	e8 60 04 00 00       	call   78b <printf>
+     32b:	8b 15 23 13 00 00    	mov    0x1323(%rip),%edx        # 1654 <ROOT_DIR_START_SIZE>
+     331:	8b 05 21 13 00 00    	mov    0x1321(%rip),%eax        # 1658 <DIRENT_SIZE>
+     337:	8d 0c 02             	lea    (%rdx,%rax,1),%ecx
+     33a:	8b 55 f8             	mov    -0x8(%rbp),%edx
+     33d:	8b 05 0d 13 00 00    	mov    0x130d(%rip),%eax        # 1650 <stdout>
+     343:	48 8d 35 be 0e 00 00 	lea    0xebe(%rip),%rsi        # 1208 <malloc+0x28f>
+     34a:	89 c7                	mov    %eax,%edi
+     34c:	b8 00 00 00 00       	mov    $0x0,%eax
+     351:	e8 35 04 00 00       	call   78b <printf>
+     356:	8b 05 f4 12 00 00    	mov    0x12f4(%rip),%eax        # 1650 <stdout>
+     35c:	48 8d 15 91 0d 00 00 	lea    0xd91(%rip),%rdx        # 10f4 <malloc+0x17b>
+     363:	48 89 d6             	mov    %rdx,%rsi
+     366:	89 c7                	mov    %eax,%edi
+     368:	b8 00 00 00 00       	mov    $0x0,%eax
+     36d:	e8 19 04 00 00       	call   78b <printf>
+     372:	90                   	nop
+     373:	eb fd                	jmp    372 <check_system_consistent+0x372>
+    }
+  }
+}
+     375:	90                   	nop
+     376:	c9                   	leave
+     377:	c3                   	ret
+
+0000000000000378 <check_before_file_creation>:
+
+void check_before_file_creation() {
+     378:	55                   	push   %rbp
+     379:	48 89 e5             	mov    %rsp,%rbp
+     37c:	48 83 ec 10          	sub    $0x10,%rsp
+  int fd;
+  fd = open(file_name, O_RDONLY);
+     380:	48 8b 05 d9 12 00 00 	mov    0x12d9(%rip),%rax        # 1660 <file_name>
+     387:	be 00 00 00 00       	mov    $0x0,%esi
+     38c:	48 89 c7             	mov    %rax,%rdi
+     38f:	e8 de 09 00 00       	call   d72 <open>
+     394:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  if (fd < 0) {
+     397:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     39b:	79 1e                	jns    3bb <check_before_file_creation+0x43>
+    printf(stdout, "File does not exist yet.\n");
+     39d:	8b 05 ad 12 00 00    	mov    0x12ad(%rip),%eax        # 1650 <stdout>
+     3a3:	48 8d 15 bb 0e 00 00 	lea    0xebb(%rip),%rdx        # 1265 <malloc+0x2ec>
+     3aa:	48 89 d6             	mov    %rdx,%rsi
+     3ad:	89 c7                	mov    %eax,%edi
+     3af:	b8 00 00 00 00       	mov    $0x0,%eax
+     3b4:	e8 d2 03 00 00       	call   78b <printf>
+    return;
+     3b9:	eb 63                	jmp    41e <check_before_file_creation+0xa6>
+  }
+  printf(stdout, "File does exist before creation. Checking consistency.\n");
+     3bb:	8b 05 8f 12 00 00    	mov    0x128f(%rip),%eax        # 1650 <stdout>
+     3c1:	48 8d 15 b8 0e 00 00 	lea    0xeb8(%rip),%rdx        # 1280 <malloc+0x307>
+     3c8:	48 89 d6             	mov    %rdx,%rsi
+     3cb:	89 c7                	mov    %eax,%edi
+     3cd:	b8 00 00 00 00       	mov    $0x0,%eax
+     3d2:	e8 b4 03 00 00       	call   78b <printf>
+  // File has been created.
+  check_system_consistent();
+     3d7:	b8 00 00 00 00       	mov    $0x0,%eax
+     3dc:	e8 1f fc ff ff       	call   0 <check_system_consistent>
+  printf(stdout, "File has been created and system is good!\n");
+     3e1:	8b 05 69 12 00 00    	mov    0x1269(%rip),%eax        # 1650 <stdout>
+     3e7:	48 8d 15 ca 0e 00 00 	lea    0xeca(%rip),%rdx        # 12b8 <malloc+0x33f>
+     3ee:	48 89 d6             	mov    %rdx,%rsi
+     3f1:	89 c7                	mov    %eax,%edi
+     3f3:	b8 00 00 00 00       	mov    $0x0,%eax
+     3f8:	e8 8e 03 00 00       	call   78b <printf>
+  printf(stdout, "lab4test_c passed!\n");
+     3fd:	8b 05 4d 12 00 00    	mov    0x124d(%rip),%eax        # 1650 <stdout>
+     403:	48 8d 15 d9 0e 00 00 	lea    0xed9(%rip),%rdx        # 12e3 <malloc+0x36a>
+     40a:	48 89 d6             	mov    %rdx,%rsi
+     40d:	89 c7                	mov    %eax,%edi
+     40f:	b8 00 00 00 00       	mov    $0x0,%eax
+     414:	e8 72 03 00 00       	call   78b <printf>
+  exit();
+     419:	e8 14 09 00 00       	call   d32 <exit>
+}
+     41e:	c9                   	leave
+     41f:	c3                   	ret
+
+0000000000000420 <check_after_file_creation>:
+
+void check_after_file_creation() {
+     420:	55                   	push   %rbp
+     421:	48 89 e5             	mov    %rsp,%rbp
+     424:	48 83 ec 10          	sub    $0x10,%rsp
+  int fd;
+  fd = open(file_name, O_RDONLY);
+     428:	48 8b 05 31 12 00 00 	mov    0x1231(%rip),%rax        # 1660 <file_name>
+     42f:	be 00 00 00 00       	mov    $0x0,%esi
+     434:	48 89 c7             	mov    %rax,%rdi
+     437:	e8 36 09 00 00       	call   d72 <open>
+     43c:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  if (fd < 0) {
+     43f:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     443:	79 5c                	jns    4a1 <check_after_file_creation+0x81>
+    // File does not exist yet.
+    error("File was not created. Not consistent.");
+     445:	8b 05 05 12 00 00    	mov    0x1205(%rip),%eax        # 1650 <stdout>
+     44b:	ba 58 00 00 00       	mov    $0x58,%edx
+     450:	48 8d 0d 47 0c 00 00 	lea    0xc47(%rip),%rcx        # 109e <malloc+0x125>
+     457:	48 89 ce             	mov    %rcx,%rsi
+     45a:	89 c7                	mov    %eax,%edi
+     45c:	b8 00 00 00 00       	mov    $0x0,%eax
+     461:	e8 25 03 00 00       	call   78b <printf>
+     466:	8b 05 e4 11 00 00    	mov    0x11e4(%rip),%eax        # 1650 <stdout>
+     46c:	48 8d 15 85 0e 00 00 	lea    0xe85(%rip),%rdx        # 12f8 <malloc+0x37f>
+     473:	48 89 d6             	mov    %rdx,%rsi
+     476:	89 c7                	mov    %eax,%edi
+     478:	b8 00 00 00 00       	mov    $0x0,%eax
+     47d:	e8 09 03 00 00       	call   78b <printf>
+     482:	8b 05 c8 11 00 00    	mov    0x11c8(%rip),%eax        # 1650 <stdout>
+     488:	48 8d 15 65 0c 00 00 	lea    0xc65(%rip),%rdx        # 10f4 <malloc+0x17b>
+     48f:	48 89 d6             	mov    %rdx,%rsi
+     492:	89 c7                	mov    %eax,%edi
+     494:	b8 00 00 00 00       	mov    $0x0,%eax
+     499:	e8 ed 02 00 00       	call   78b <printf>
+     49e:	90                   	nop
+     49f:	eb fd                	jmp    49e <check_after_file_creation+0x7e>
+  }
+  // File has been created.
+  check_system_consistent();
+     4a1:	b8 00 00 00 00       	mov    $0x0,%eax
+     4a6:	e8 55 fb ff ff       	call   0 <check_system_consistent>
+  printf(stdout, "File has been created and system is good!\n");
+     4ab:	8b 05 9f 11 00 00    	mov    0x119f(%rip),%eax        # 1650 <stdout>
+     4b1:	48 8d 15 00 0e 00 00 	lea    0xe00(%rip),%rdx        # 12b8 <malloc+0x33f>
+     4b8:	48 89 d6             	mov    %rdx,%rsi
+     4bb:	89 c7                	mov    %eax,%edi
+     4bd:	b8 00 00 00 00       	mov    $0x0,%eax
+     4c2:	e8 c4 02 00 00       	call   78b <printf>
+}
+     4c7:	90                   	nop
+     4c8:	c9                   	leave
+     4c9:	c3                   	ret
+
+00000000000004ca <create_file>:
+
+// Tries to create a file.
+// Will crash afters steps bwrite calls if (steps != 0).
+void create_file(int steps) {
+     4ca:	55                   	push   %rbp
+     4cb:	48 89 e5             	mov    %rsp,%rbp
+     4ce:	48 83 ec 20          	sub    $0x20,%rsp
+     4d2:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  int fd;
+  if (steps)
+     4d5:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+     4d9:	74 0a                	je     4e5 <create_file+0x1b>
+    crashn(steps);
+     4db:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     4de:	89 c7                	mov    %eax,%edi
+     4e0:	e8 f5 08 00 00       	call   dda <crashn>
+  fd = open(file_name, O_CREATE | O_RDWR);
+     4e5:	48 8b 05 74 11 00 00 	mov    0x1174(%rip),%rax        # 1660 <file_name>
+     4ec:	be 02 02 00 00       	mov    $0x202,%esi
+     4f1:	48 89 c7             	mov    %rax,%rdi
+     4f4:	e8 79 08 00 00       	call   d72 <open>
+     4f9:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  if (fd) {
+     4fc:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     500:	74 19                	je     51b <create_file+0x51>
+    printf(1, "File created successfully\n");
+     502:	48 8d 05 15 0e 00 00 	lea    0xe15(%rip),%rax        # 131e <malloc+0x3a5>
+     509:	48 89 c6             	mov    %rax,%rsi
+     50c:	bf 01 00 00 00       	mov    $0x1,%edi
+     511:	b8 00 00 00 00       	mov    $0x0,%eax
+     516:	e8 70 02 00 00       	call   78b <printf>
+  }
+}
+     51b:	90                   	nop
+     51c:	c9                   	leave
+     51d:	c3                   	ret
+
+000000000000051e <main>:
+
+int main(int argc, char *argv[]) {
+     51e:	55                   	push   %rbp
+     51f:	48 89 e5             	mov    %rsp,%rbp
+     522:	48 83 ec 20          	sub    $0x20,%rsp
+     526:	89 7d ec             	mov    %edi,-0x14(%rbp)
+     529:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int steps = 0;
+     52d:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  printf(stdout, "lab4test_c starting\n");
+     534:	8b 05 16 11 00 00    	mov    0x1116(%rip),%eax        # 1650 <stdout>
+     53a:	48 8d 15 f8 0d 00 00 	lea    0xdf8(%rip),%rdx        # 1339 <malloc+0x3c0>
+     541:	48 89 d6             	mov    %rdx,%rsi
+     544:	89 c7                	mov    %eax,%edi
+     546:	b8 00 00 00 00       	mov    $0x0,%eax
+     54b:	e8 3b 02 00 00       	call   78b <printf>
+  if (argc > 1) {
+     550:	83 7d ec 01          	cmpl   $0x1,-0x14(%rbp)
+     554:	7e 34                	jle    58a <main+0x6c>
+    steps = atoi(argv[1]);
+     556:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+     55a:	48 83 c0 08          	add    $0x8,%rax
+     55e:	48 8b 00             	mov    (%rax),%rax
+     561:	48 89 c7             	mov    %rax,%rdi
+     564:	e8 1c 07 00 00       	call   c85 <atoi>
+     569:	89 45 fc             	mov    %eax,-0x4(%rbp)
+    printf(1, "crashing after %d bwrites\n", steps);
+     56c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     56f:	89 c2                	mov    %eax,%edx
+     571:	48 8d 05 d6 0d 00 00 	lea    0xdd6(%rip),%rax        # 134e <malloc+0x3d5>
+     578:	48 89 c6             	mov    %rax,%rsi
+     57b:	bf 01 00 00 00       	mov    $0x1,%edi
+     580:	b8 00 00 00 00       	mov    $0x0,%eax
+     585:	e8 01 02 00 00       	call   78b <printf>
+  }
+  check_before_file_creation();
+     58a:	b8 00 00 00 00       	mov    $0x0,%eax
+     58f:	e8 e4 fd ff ff       	call   378 <check_before_file_creation>
+  create_file(steps);
+     594:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     597:	89 c7                	mov    %eax,%edi
+     599:	e8 2c ff ff ff       	call   4ca <create_file>
+  check_after_file_creation();
+     59e:	b8 00 00 00 00       	mov    $0x0,%eax
+     5a3:	e8 78 fe ff ff       	call   420 <check_after_file_creation>
+  printf(stdout, "lab4test_c passed!\n");
+     5a8:	8b 05 a2 10 00 00    	mov    0x10a2(%rip),%eax        # 1650 <stdout>
+     5ae:	48 8d 15 2e 0d 00 00 	lea    0xd2e(%rip),%rdx        # 12e3 <malloc+0x36a>
+     5b5:	48 89 d6             	mov    %rdx,%rsi
+     5b8:	89 c7                	mov    %eax,%edi
+     5ba:	b8 00 00 00 00       	mov    $0x0,%eax
+     5bf:	e8 c7 01 00 00       	call   78b <printf>
+  exit();
+     5c4:	e8 69 07 00 00       	call   d32 <exit>
+
+00000000000005c9 <putc>:
+#include <cdefs.h>
+#include <stat.h>
+#include <stdarg.h>
+#include <user.h>
+
+static void putc(int fd, char c) { write(fd, &c, 1); }
+     5c9:	55                   	push   %rbp
+     5ca:	48 89 e5             	mov    %rsp,%rbp
+     5cd:	48 83 ec 10          	sub    $0x10,%rsp
+     5d1:	89 7d fc             	mov    %edi,-0x4(%rbp)
+     5d4:	89 f0                	mov    %esi,%eax
+     5d6:	88 45 f8             	mov    %al,-0x8(%rbp)
+     5d9:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+     5dd:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     5e0:	ba 01 00 00 00       	mov    $0x1,%edx
+     5e5:	48 89 ce             	mov    %rcx,%rsi
+     5e8:	89 c7                	mov    %eax,%edi
+     5ea:	e8 63 07 00 00       	call   d52 <write>
+     5ef:	90                   	nop
+     5f0:	c9                   	leave
+     5f1:	c3                   	ret
+
+00000000000005f2 <printint64>:
+
+static void printint64(int fd, int xx, int base, int sgn) {
+     5f2:	55                   	push   %rbp
+     5f3:	48 89 e5             	mov    %rsp,%rbp
+     5f6:	48 83 ec 40          	sub    $0x40,%rsp
+     5fa:	89 7d cc             	mov    %edi,-0x34(%rbp)
+     5fd:	89 75 c8             	mov    %esi,-0x38(%rbp)
+     600:	89 55 c4             	mov    %edx,-0x3c(%rbp)
+     603:	89 4d c0             	mov    %ecx,-0x40(%rbp)
+  static char digits[] = "0123456789abcdef";
+  char buf[32];
+  int i;
+  uint64_t x;
+
+  if (sgn && (sgn = xx < 0))
+     606:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+     60a:	74 1f                	je     62b <printint64+0x39>
+     60c:	8b 45 c8             	mov    -0x38(%rbp),%eax
+     60f:	c1 e8 1f             	shr    $0x1f,%eax
+     612:	0f b6 c0             	movzbl %al,%eax
+     615:	89 45 c0             	mov    %eax,-0x40(%rbp)
+     618:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+     61c:	74 0d                	je     62b <printint64+0x39>
+    x = -xx;
+     61e:	8b 45 c8             	mov    -0x38(%rbp),%eax
+     621:	f7 d8                	neg    %eax
+     623:	48 98                	cltq
+     625:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+     629:	eb 09                	jmp    634 <printint64+0x42>
+  else
+    x = xx;
+     62b:	8b 45 c8             	mov    -0x38(%rbp),%eax
+     62e:	48 98                	cltq
+     630:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+  i = 0;
+     634:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  do {
+    buf[i++] = digits[x % base];
+     63b:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+     63e:	48 63 c8             	movslq %eax,%rcx
+     641:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     645:	ba 00 00 00 00       	mov    $0x0,%edx
+     64a:	48 f7 f1             	div    %rcx
+     64d:	48 89 d1             	mov    %rdx,%rcx
+     650:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     653:	8d 50 01             	lea    0x1(%rax),%edx
+     656:	89 55 fc             	mov    %edx,-0x4(%rbp)
+     659:	48 8d 15 10 10 00 00 	lea    0x1010(%rip),%rdx        # 1670 <digits.1>
+     660:	0f b6 14 11          	movzbl (%rcx,%rdx,1),%edx
+     664:	48 98                	cltq
+     666:	88 54 05 d0          	mov    %dl,-0x30(%rbp,%rax,1)
+  } while ((x /= base) != 0);
+     66a:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+     66d:	48 63 f0             	movslq %eax,%rsi
+     670:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     674:	ba 00 00 00 00       	mov    $0x0,%edx
+     679:	48 f7 f6             	div    %rsi
+     67c:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+     680:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+     685:	75 b4                	jne    63b <printint64+0x49>
+
+  if (sgn)
+     687:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+     68b:	74 2b                	je     6b8 <printint64+0xc6>
+    buf[i++] = '-';
+     68d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     690:	8d 50 01             	lea    0x1(%rax),%edx
+     693:	89 55 fc             	mov    %edx,-0x4(%rbp)
+     696:	48 98                	cltq
+     698:	c6 44 05 d0 2d       	movb   $0x2d,-0x30(%rbp,%rax,1)
+
+  while (--i >= 0)
+     69d:	eb 19                	jmp    6b8 <printint64+0xc6>
+    putc(fd, buf[i]);
+     69f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     6a2:	48 98                	cltq
+     6a4:	0f b6 44 05 d0       	movzbl -0x30(%rbp,%rax,1),%eax
+     6a9:	0f be d0             	movsbl %al,%edx
+     6ac:	8b 45 cc             	mov    -0x34(%rbp),%eax
+     6af:	89 d6                	mov    %edx,%esi
+     6b1:	89 c7                	mov    %eax,%edi
+     6b3:	e8 11 ff ff ff       	call   5c9 <putc>
+  while (--i >= 0)
+     6b8:	83 6d fc 01          	subl   $0x1,-0x4(%rbp)
+     6bc:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     6c0:	79 dd                	jns    69f <printint64+0xad>
+}
+     6c2:	90                   	nop
+     6c3:	90                   	nop
+     6c4:	c9                   	leave
+     6c5:	c3                   	ret
+
+00000000000006c6 <printint>:
+
+static void printint(int fd, int xx, int base, int sgn) {
+     6c6:	55                   	push   %rbp
+     6c7:	48 89 e5             	mov    %rsp,%rbp
+     6ca:	48 83 ec 30          	sub    $0x30,%rsp
+     6ce:	89 7d dc             	mov    %edi,-0x24(%rbp)
+     6d1:	89 75 d8             	mov    %esi,-0x28(%rbp)
+     6d4:	89 55 d4             	mov    %edx,-0x2c(%rbp)
+     6d7:	89 4d d0             	mov    %ecx,-0x30(%rbp)
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+     6da:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+  if (sgn && xx < 0) {
+     6e1:	83 7d d0 00          	cmpl   $0x0,-0x30(%rbp)
+     6e5:	74 17                	je     6fe <printint+0x38>
+     6e7:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+     6eb:	79 11                	jns    6fe <printint+0x38>
+    neg = 1;
+     6ed:	c7 45 f8 01 00 00 00 	movl   $0x1,-0x8(%rbp)
+    x = -xx;
+     6f4:	8b 45 d8             	mov    -0x28(%rbp),%eax
+     6f7:	f7 d8                	neg    %eax
+     6f9:	89 45 f4             	mov    %eax,-0xc(%rbp)
+     6fc:	eb 06                	jmp    704 <printint+0x3e>
+  } else {
+    x = xx;
+     6fe:	8b 45 d8             	mov    -0x28(%rbp),%eax
+     701:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  }
+
+  i = 0;
+     704:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  do {
+    buf[i++] = digits[x % base];
+     70b:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+     70e:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     711:	ba 00 00 00 00       	mov    $0x0,%edx
+     716:	f7 f1                	div    %ecx
+     718:	89 d1                	mov    %edx,%ecx
+     71a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     71d:	8d 50 01             	lea    0x1(%rax),%edx
+     720:	89 55 fc             	mov    %edx,-0x4(%rbp)
+     723:	89 c9                	mov    %ecx,%ecx
+     725:	48 8d 15 64 0f 00 00 	lea    0xf64(%rip),%rdx        # 1690 <digits.0>
+     72c:	0f b6 14 11          	movzbl (%rcx,%rdx,1),%edx
+     730:	48 98                	cltq
+     732:	88 54 05 e4          	mov    %dl,-0x1c(%rbp,%rax,1)
+  } while ((x /= base) != 0);
+     736:	8b 75 d4             	mov    -0x2c(%rbp),%esi
+     739:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     73c:	ba 00 00 00 00       	mov    $0x0,%edx
+     741:	f7 f6                	div    %esi
+     743:	89 45 f4             	mov    %eax,-0xc(%rbp)
+     746:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+     74a:	75 bf                	jne    70b <printint+0x45>
+  if (neg)
+     74c:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+     750:	74 2b                	je     77d <printint+0xb7>
+    buf[i++] = '-';
+     752:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     755:	8d 50 01             	lea    0x1(%rax),%edx
+     758:	89 55 fc             	mov    %edx,-0x4(%rbp)
+     75b:	48 98                	cltq
+     75d:	c6 44 05 e4 2d       	movb   $0x2d,-0x1c(%rbp,%rax,1)
+
+  while (--i >= 0)
+     762:	eb 19                	jmp    77d <printint+0xb7>
+    putc(fd, buf[i]);
+     764:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     767:	48 98                	cltq
+     769:	0f b6 44 05 e4       	movzbl -0x1c(%rbp,%rax,1),%eax
+     76e:	0f be d0             	movsbl %al,%edx
+     771:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     774:	89 d6                	mov    %edx,%esi
+     776:	89 c7                	mov    %eax,%edi
+     778:	e8 4c fe ff ff       	call   5c9 <putc>
+  while (--i >= 0)
+     77d:	83 6d fc 01          	subl   $0x1,-0x4(%rbp)
+     781:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     785:	79 dd                	jns    764 <printint+0x9e>
+}
+     787:	90                   	nop
+     788:	90                   	nop
+     789:	c9                   	leave
+     78a:	c3                   	ret
+
+000000000000078b <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void printf(int fd, char *fmt, ...) {
+     78b:	55                   	push   %rbp
+     78c:	48 89 e5             	mov    %rsp,%rbp
+     78f:	48 83 ec 70          	sub    $0x70,%rsp
+     793:	89 7d 9c             	mov    %edi,-0x64(%rbp)
+     796:	48 89 75 90          	mov    %rsi,-0x70(%rbp)
+     79a:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+     79e:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+     7a2:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+     7a6:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+  char *s;
+  int c, i, state;
+  int lflag;
+  va_list valist;
+  va_start(valist, fmt);
+     7aa:	c7 45 a0 10 00 00 00 	movl   $0x10,-0x60(%rbp)
+     7b1:	48 8d 45 10          	lea    0x10(%rbp),%rax
+     7b5:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+     7b9:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+     7bd:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+
+  state = 0;
+     7c1:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%rbp)
+  for (i = 0; fmt[i]; i++) {
+     7c8:	c7 45 c4 00 00 00 00 	movl   $0x0,-0x3c(%rbp)
+     7cf:	e9 6b 02 00 00       	jmp    a3f <printf+0x2b4>
+    c = fmt[i] & 0xff;
+     7d4:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+     7d7:	48 63 d0             	movslq %eax,%rdx
+     7da:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+     7de:	48 01 d0             	add    %rdx,%rax
+     7e1:	0f b6 00             	movzbl (%rax),%eax
+     7e4:	0f be c0             	movsbl %al,%eax
+     7e7:	25 ff 00 00 00       	and    $0xff,%eax
+     7ec:	89 45 b8             	mov    %eax,-0x48(%rbp)
+    if (state == 0) {
+     7ef:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+     7f3:	75 30                	jne    825 <printf+0x9a>
+      if (c == '%') {
+     7f5:	83 7d b8 25          	cmpl   $0x25,-0x48(%rbp)
+     7f9:	75 13                	jne    80e <printf+0x83>
+        state = '%';
+     7fb:	c7 45 c0 25 00 00 00 	movl   $0x25,-0x40(%rbp)
+        lflag = 0;
+     802:	c7 45 bc 00 00 00 00 	movl   $0x0,-0x44(%rbp)
+     809:	e9 2d 02 00 00       	jmp    a3b <printf+0x2b0>
+      } else {
+        putc(fd, c);
+     80e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+     811:	0f be d0             	movsbl %al,%edx
+     814:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     817:	89 d6                	mov    %edx,%esi
+     819:	89 c7                	mov    %eax,%edi
+     81b:	e8 a9 fd ff ff       	call   5c9 <putc>
+     820:	e9 16 02 00 00       	jmp    a3b <printf+0x2b0>
+      }
+    } else if (state == '%') {
+     825:	83 7d c0 25          	cmpl   $0x25,-0x40(%rbp)
+     829:	0f 85 0c 02 00 00    	jne    a3b <printf+0x2b0>
+      if (c == 'l') {
+     82f:	83 7d b8 6c          	cmpl   $0x6c,-0x48(%rbp)
+     833:	75 0c                	jne    841 <printf+0xb6>
+        lflag = 1;
+     835:	c7 45 bc 01 00 00 00 	movl   $0x1,-0x44(%rbp)
+        continue;
+     83c:	e9 fa 01 00 00       	jmp    a3b <printf+0x2b0>
+      } else if (c == 'd') {
+     841:	83 7d b8 64          	cmpl   $0x64,-0x48(%rbp)
+     845:	0f 85 95 00 00 00    	jne    8e0 <printf+0x155>
+        if (lflag == 1)
+     84b:	83 7d bc 01          	cmpl   $0x1,-0x44(%rbp)
+     84f:	75 49                	jne    89a <printf+0x10f>
+          printint64(fd, va_arg(valist, int64_t), 10, 1);
+     851:	8b 45 a0             	mov    -0x60(%rbp),%eax
+     854:	83 f8 2f             	cmp    $0x2f,%eax
+     857:	77 17                	ja     870 <printf+0xe5>
+     859:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+     85d:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     860:	89 d2                	mov    %edx,%edx
+     862:	48 01 d0             	add    %rdx,%rax
+     865:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     868:	83 c2 08             	add    $0x8,%edx
+     86b:	89 55 a0             	mov    %edx,-0x60(%rbp)
+     86e:	eb 0c                	jmp    87c <printf+0xf1>
+     870:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+     874:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     878:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+     87c:	48 8b 00             	mov    (%rax),%rax
+     87f:	89 c6                	mov    %eax,%esi
+     881:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     884:	b9 01 00 00 00       	mov    $0x1,%ecx
+     889:	ba 0a 00 00 00       	mov    $0xa,%edx
+     88e:	89 c7                	mov    %eax,%edi
+     890:	e8 5d fd ff ff       	call   5f2 <printint64>
+     895:	e9 9a 01 00 00       	jmp    a34 <printf+0x2a9>
+        else
+          printint(fd, va_arg(valist, int), 10, 1);
+     89a:	8b 45 a0             	mov    -0x60(%rbp),%eax
+     89d:	83 f8 2f             	cmp    $0x2f,%eax
+     8a0:	77 17                	ja     8b9 <printf+0x12e>
+     8a2:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+     8a6:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     8a9:	89 d2                	mov    %edx,%edx
+     8ab:	48 01 d0             	add    %rdx,%rax
+     8ae:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     8b1:	83 c2 08             	add    $0x8,%edx
+     8b4:	89 55 a0             	mov    %edx,-0x60(%rbp)
+     8b7:	eb 0c                	jmp    8c5 <printf+0x13a>
+     8b9:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+     8bd:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     8c1:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+     8c5:	8b 30                	mov    (%rax),%esi
+     8c7:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     8ca:	b9 01 00 00 00       	mov    $0x1,%ecx
+     8cf:	ba 0a 00 00 00       	mov    $0xa,%edx
+     8d4:	89 c7                	mov    %eax,%edi
+     8d6:	e8 eb fd ff ff       	call   6c6 <printint>
+     8db:	e9 54 01 00 00       	jmp    a34 <printf+0x2a9>
+      } else if (c == 'x' || c == 'p') {
+     8e0:	83 7d b8 78          	cmpl   $0x78,-0x48(%rbp)
+     8e4:	74 0a                	je     8f0 <printf+0x165>
+     8e6:	83 7d b8 70          	cmpl   $0x70,-0x48(%rbp)
+     8ea:	0f 85 95 00 00 00    	jne    985 <printf+0x1fa>
+        if (lflag == 1)
+     8f0:	83 7d bc 01          	cmpl   $0x1,-0x44(%rbp)
+     8f4:	75 49                	jne    93f <printf+0x1b4>
+          printint64(fd, va_arg(valist, int64_t), 16, 0);
+     8f6:	8b 45 a0             	mov    -0x60(%rbp),%eax
+     8f9:	83 f8 2f             	cmp    $0x2f,%eax
+     8fc:	77 17                	ja     915 <printf+0x18a>
+     8fe:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+     902:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     905:	89 d2                	mov    %edx,%edx
+     907:	48 01 d0             	add    %rdx,%rax
+     90a:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     90d:	83 c2 08             	add    $0x8,%edx
+     910:	89 55 a0             	mov    %edx,-0x60(%rbp)
+     913:	eb 0c                	jmp    921 <printf+0x196>
+     915:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+     919:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     91d:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+     921:	48 8b 00             	mov    (%rax),%rax
+     924:	89 c6                	mov    %eax,%esi
+     926:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     929:	b9 00 00 00 00       	mov    $0x0,%ecx
+     92e:	ba 10 00 00 00       	mov    $0x10,%edx
+     933:	89 c7                	mov    %eax,%edi
+     935:	e8 b8 fc ff ff       	call   5f2 <printint64>
+        if (lflag == 1)
+     93a:	e9 f5 00 00 00       	jmp    a34 <printf+0x2a9>
+        else
+          printint(fd, va_arg(valist, int), 16, 0);
+     93f:	8b 45 a0             	mov    -0x60(%rbp),%eax
+     942:	83 f8 2f             	cmp    $0x2f,%eax
+     945:	77 17                	ja     95e <printf+0x1d3>
+     947:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+     94b:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     94e:	89 d2                	mov    %edx,%edx
+     950:	48 01 d0             	add    %rdx,%rax
+     953:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     956:	83 c2 08             	add    $0x8,%edx
+     959:	89 55 a0             	mov    %edx,-0x60(%rbp)
+     95c:	eb 0c                	jmp    96a <printf+0x1df>
+     95e:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+     962:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     966:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+     96a:	8b 30                	mov    (%rax),%esi
+     96c:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     96f:	b9 00 00 00 00       	mov    $0x0,%ecx
+     974:	ba 10 00 00 00       	mov    $0x10,%edx
+     979:	89 c7                	mov    %eax,%edi
+     97b:	e8 46 fd ff ff       	call   6c6 <printint>
+        if (lflag == 1)
+     980:	e9 af 00 00 00       	jmp    a34 <printf+0x2a9>
+      } else if (c == 's') {
+     985:	83 7d b8 73          	cmpl   $0x73,-0x48(%rbp)
+     989:	75 6e                	jne    9f9 <printf+0x26e>
+        if ((s = (char *)va_arg(valist, char *)) == 0)
+     98b:	8b 45 a0             	mov    -0x60(%rbp),%eax
+     98e:	83 f8 2f             	cmp    $0x2f,%eax
+     991:	77 17                	ja     9aa <printf+0x21f>
+     993:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+     997:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     99a:	89 d2                	mov    %edx,%edx
+     99c:	48 01 d0             	add    %rdx,%rax
+     99f:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     9a2:	83 c2 08             	add    $0x8,%edx
+     9a5:	89 55 a0             	mov    %edx,-0x60(%rbp)
+     9a8:	eb 0c                	jmp    9b6 <printf+0x22b>
+     9aa:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+     9ae:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     9b2:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+     9b6:	48 8b 00             	mov    (%rax),%rax
+     9b9:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+     9bd:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+     9c2:	75 28                	jne    9ec <printf+0x261>
+          s = "(null)";
+     9c4:	48 8d 05 9e 09 00 00 	lea    0x99e(%rip),%rax        # 1369 <malloc+0x3f0>
+     9cb:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        for (; *s; s++)
+     9cf:	eb 1b                	jmp    9ec <printf+0x261>
+          putc(fd, *s);
+     9d1:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+     9d5:	0f b6 00             	movzbl (%rax),%eax
+     9d8:	0f be d0             	movsbl %al,%edx
+     9db:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     9de:	89 d6                	mov    %edx,%esi
+     9e0:	89 c7                	mov    %eax,%edi
+     9e2:	e8 e2 fb ff ff       	call   5c9 <putc>
+        for (; *s; s++)
+     9e7:	48 83 45 c8 01       	addq   $0x1,-0x38(%rbp)
+     9ec:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+     9f0:	0f b6 00             	movzbl (%rax),%eax
+     9f3:	84 c0                	test   %al,%al
+     9f5:	75 da                	jne    9d1 <printf+0x246>
+     9f7:	eb 3b                	jmp    a34 <printf+0x2a9>
+      } else if (c == '%') {
+     9f9:	83 7d b8 25          	cmpl   $0x25,-0x48(%rbp)
+     9fd:	75 14                	jne    a13 <printf+0x288>
+        putc(fd, c);
+     9ff:	8b 45 b8             	mov    -0x48(%rbp),%eax
+     a02:	0f be d0             	movsbl %al,%edx
+     a05:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     a08:	89 d6                	mov    %edx,%esi
+     a0a:	89 c7                	mov    %eax,%edi
+     a0c:	e8 b8 fb ff ff       	call   5c9 <putc>
+     a11:	eb 21                	jmp    a34 <printf+0x2a9>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+     a13:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     a16:	be 25 00 00 00       	mov    $0x25,%esi
+     a1b:	89 c7                	mov    %eax,%edi
+     a1d:	e8 a7 fb ff ff       	call   5c9 <putc>
+        putc(fd, c);
+     a22:	8b 45 b8             	mov    -0x48(%rbp),%eax
+     a25:	0f be d0             	movsbl %al,%edx
+     a28:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     a2b:	89 d6                	mov    %edx,%esi
+     a2d:	89 c7                	mov    %eax,%edi
+     a2f:	e8 95 fb ff ff       	call   5c9 <putc>
+      }
+      state = 0;
+     a34:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%rbp)
+  for (i = 0; fmt[i]; i++) {
+     a3b:	83 45 c4 01          	addl   $0x1,-0x3c(%rbp)
+     a3f:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+     a42:	48 63 d0             	movslq %eax,%rdx
+     a45:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+     a49:	48 01 d0             	add    %rdx,%rax
+     a4c:	0f b6 00             	movzbl (%rax),%eax
+     a4f:	84 c0                	test   %al,%al
+     a51:	0f 85 7d fd ff ff    	jne    7d4 <printf+0x49>
+    }
+  }
+
+  va_end(valist);
+}
+     a57:	90                   	nop
+     a58:	90                   	nop
+     a59:	c9                   	leave
+     a5a:	c3                   	ret
+
+0000000000000a5b <stosb>:
+      break;
+    buf[i++] = c;
+    if (c == '\n' || c == '\r')
+      break;
+  }
+  buf[i] = '\0';
+     a5b:	55                   	push   %rbp
+     a5c:	48 89 e5             	mov    %rsp,%rbp
+     a5f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     a63:	89 75 f4             	mov    %esi,-0xc(%rbp)
+     a66:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  return buf;
+     a69:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+     a6d:	8b 55 f0             	mov    -0x10(%rbp),%edx
+     a70:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     a73:	48 89 ce             	mov    %rcx,%rsi
+     a76:	48 89 f7             	mov    %rsi,%rdi
+     a79:	89 d1                	mov    %edx,%ecx
+     a7b:	fc                   	cld
+     a7c:	f3 aa                	rep stos %al,%es:(%rdi)
+     a7e:	89 ca                	mov    %ecx,%edx
+     a80:	48 89 fe             	mov    %rdi,%rsi
+     a83:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+     a87:	89 55 f0             	mov    %edx,-0x10(%rbp)
+}
+
+int stat(char *n, struct stat *st) {
+  int fd;
+     a8a:	90                   	nop
+     a8b:	5d                   	pop    %rbp
+     a8c:	c3                   	ret
+
+0000000000000a8d <strcpy>:
+char *strcpy(char *s, char *t) {
+     a8d:	55                   	push   %rbp
+     a8e:	48 89 e5             	mov    %rsp,%rbp
+     a91:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+     a95:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  os = s;
+     a99:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     a9d:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while ((*s++ = *t++) != 0)
+     aa1:	90                   	nop
+     aa2:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+     aa6:	48 8d 42 01          	lea    0x1(%rdx),%rax
+     aaa:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+     aae:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     ab2:	48 8d 48 01          	lea    0x1(%rax),%rcx
+     ab6:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+     aba:	0f b6 12             	movzbl (%rdx),%edx
+     abd:	88 10                	mov    %dl,(%rax)
+     abf:	0f b6 00             	movzbl (%rax),%eax
+     ac2:	84 c0                	test   %al,%al
+     ac4:	75 dc                	jne    aa2 <strcpy+0x15>
+  return os;
+     ac6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+     aca:	5d                   	pop    %rbp
+     acb:	c3                   	ret
+
+0000000000000acc <strcmp>:
+int strcmp(const char *p, const char *q) {
+     acc:	55                   	push   %rbp
+     acd:	48 89 e5             	mov    %rsp,%rbp
+     ad0:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     ad4:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  while (*p && *p == *q)
+     ad8:	eb 0a                	jmp    ae4 <strcmp+0x18>
+    p++, q++;
+     ada:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+     adf:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (*p && *p == *q)
+     ae4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     ae8:	0f b6 00             	movzbl (%rax),%eax
+     aeb:	84 c0                	test   %al,%al
+     aed:	74 12                	je     b01 <strcmp+0x35>
+     aef:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     af3:	0f b6 10             	movzbl (%rax),%edx
+     af6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     afa:	0f b6 00             	movzbl (%rax),%eax
+     afd:	38 c2                	cmp    %al,%dl
+     aff:	74 d9                	je     ada <strcmp+0xe>
+  return (uchar)*p - (uchar)*q;
+     b01:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     b05:	0f b6 00             	movzbl (%rax),%eax
+     b08:	0f b6 d0             	movzbl %al,%edx
+     b0b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     b0f:	0f b6 00             	movzbl (%rax),%eax
+     b12:	0f b6 c0             	movzbl %al,%eax
+     b15:	29 c2                	sub    %eax,%edx
+     b17:	89 d0                	mov    %edx,%eax
+}
+     b19:	5d                   	pop    %rbp
+     b1a:	c3                   	ret
+
+0000000000000b1b <strlen>:
+uint strlen(char *s) {
+     b1b:	55                   	push   %rbp
+     b1c:	48 89 e5             	mov    %rsp,%rbp
+     b1f:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  for (n = 0; s[n]; n++)
+     b23:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     b2a:	eb 04                	jmp    b30 <strlen+0x15>
+     b2c:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     b30:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     b33:	48 63 d0             	movslq %eax,%rdx
+     b36:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     b3a:	48 01 d0             	add    %rdx,%rax
+     b3d:	0f b6 00             	movzbl (%rax),%eax
+     b40:	84 c0                	test   %al,%al
+     b42:	75 e8                	jne    b2c <strlen+0x11>
+  return n;
+     b44:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+     b47:	5d                   	pop    %rbp
+     b48:	c3                   	ret
+
+0000000000000b49 <memset>:
+void *memset(void *dst, int c, uint n) {
+     b49:	55                   	push   %rbp
+     b4a:	48 89 e5             	mov    %rsp,%rbp
+     b4d:	48 83 ec 10          	sub    $0x10,%rsp
+     b51:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     b55:	89 75 f4             	mov    %esi,-0xc(%rbp)
+     b58:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  stosb(dst, c, n);
+     b5b:	8b 55 f0             	mov    -0x10(%rbp),%edx
+     b5e:	8b 4d f4             	mov    -0xc(%rbp),%ecx
+     b61:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     b65:	89 ce                	mov    %ecx,%esi
+     b67:	48 89 c7             	mov    %rax,%rdi
+     b6a:	e8 ec fe ff ff       	call   a5b <stosb>
+  return dst;
+     b6f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+     b73:	c9                   	leave
+     b74:	c3                   	ret
+
+0000000000000b75 <strchr>:
+char *strchr(const char *s, char c) {
+     b75:	55                   	push   %rbp
+     b76:	48 89 e5             	mov    %rsp,%rbp
+     b79:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     b7d:	89 f0                	mov    %esi,%eax
+     b7f:	88 45 f4             	mov    %al,-0xc(%rbp)
+  for (; *s; s++)
+     b82:	eb 17                	jmp    b9b <strchr+0x26>
+    if (*s == c)
+     b84:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     b88:	0f b6 00             	movzbl (%rax),%eax
+     b8b:	38 45 f4             	cmp    %al,-0xc(%rbp)
+     b8e:	75 06                	jne    b96 <strchr+0x21>
+      return (char *)s;
+     b90:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     b94:	eb 15                	jmp    bab <strchr+0x36>
+  for (; *s; s++)
+     b96:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+     b9b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     b9f:	0f b6 00             	movzbl (%rax),%eax
+     ba2:	84 c0                	test   %al,%al
+     ba4:	75 de                	jne    b84 <strchr+0xf>
+  return 0;
+     ba6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     bab:	5d                   	pop    %rbp
+     bac:	c3                   	ret
+
+0000000000000bad <gets>:
+char *gets(char *buf, int max) {
+     bad:	55                   	push   %rbp
+     bae:	48 89 e5             	mov    %rsp,%rbp
+     bb1:	48 83 ec 20          	sub    $0x20,%rsp
+     bb5:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+     bb9:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  for (i = 0; i + 1 < max;) {
+     bbc:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     bc3:	eb 48                	jmp    c0d <gets+0x60>
+    cc = read(0, &c, 1);
+     bc5:	48 8d 45 f7          	lea    -0x9(%rbp),%rax
+     bc9:	ba 01 00 00 00       	mov    $0x1,%edx
+     bce:	48 89 c6             	mov    %rax,%rsi
+     bd1:	bf 00 00 00 00       	mov    $0x0,%edi
+     bd6:	e8 6f 01 00 00       	call   d4a <read>
+     bdb:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    if (cc < 1)
+     bde:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+     be2:	7e 36                	jle    c1a <gets+0x6d>
+    buf[i++] = c;
+     be4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     be7:	8d 50 01             	lea    0x1(%rax),%edx
+     bea:	89 55 fc             	mov    %edx,-0x4(%rbp)
+     bed:	48 63 d0             	movslq %eax,%rdx
+     bf0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     bf4:	48 01 c2             	add    %rax,%rdx
+     bf7:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+     bfb:	88 02                	mov    %al,(%rdx)
+    if (c == '\n' || c == '\r')
+     bfd:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+     c01:	3c 0a                	cmp    $0xa,%al
+     c03:	74 16                	je     c1b <gets+0x6e>
+     c05:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+     c09:	3c 0d                	cmp    $0xd,%al
+     c0b:	74 0e                	je     c1b <gets+0x6e>
+  for (i = 0; i + 1 < max;) {
+     c0d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     c10:	83 c0 01             	add    $0x1,%eax
+     c13:	39 45 e4             	cmp    %eax,-0x1c(%rbp)
+     c16:	7f ad                	jg     bc5 <gets+0x18>
+     c18:	eb 01                	jmp    c1b <gets+0x6e>
+      break;
+     c1a:	90                   	nop
+  buf[i] = '\0';
+     c1b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     c1e:	48 63 d0             	movslq %eax,%rdx
+     c21:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     c25:	48 01 d0             	add    %rdx,%rax
+     c28:	c6 00 00             	movb   $0x0,(%rax)
+  return buf;
+     c2b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+     c2f:	c9                   	leave
+     c30:	c3                   	ret
+
+0000000000000c31 <stat>:
+int stat(char *n, struct stat *st) {
+     c31:	55                   	push   %rbp
+     c32:	48 89 e5             	mov    %rsp,%rbp
+     c35:	48 83 ec 20          	sub    $0x20,%rsp
+     c39:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+     c3d:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int r;
+
+  fd = open(n, O_RDONLY);
+     c41:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     c45:	be 00 00 00 00       	mov    $0x0,%esi
+     c4a:	48 89 c7             	mov    %rax,%rdi
+     c4d:	e8 20 01 00 00       	call   d72 <open>
+     c52:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  if (fd < 0)
+     c55:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     c59:	79 07                	jns    c62 <stat+0x31>
+    return -1;
+     c5b:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     c60:	eb 21                	jmp    c83 <stat+0x52>
+  r = fstat(fd, st);
+     c62:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+     c66:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     c69:	48 89 d6             	mov    %rdx,%rsi
+     c6c:	89 c7                	mov    %eax,%edi
+     c6e:	e8 17 01 00 00       	call   d8a <fstat>
+     c73:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  close(fd);
+     c76:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     c79:	89 c7                	mov    %eax,%edi
+     c7b:	e8 da 00 00 00       	call   d5a <close>
+  return r;
+     c80:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+     c83:	c9                   	leave
+     c84:	c3                   	ret
+
+0000000000000c85 <atoi>:
+
+int atoi(const char *s) {
+     c85:	55                   	push   %rbp
+     c86:	48 89 e5             	mov    %rsp,%rbp
+     c89:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int n;
+
+  n = 0;
+     c8d:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  while ('0' <= *s && *s <= '9')
+     c94:	eb 28                	jmp    cbe <atoi+0x39>
+    n = n * 10 + *s++ - '0';
+     c96:	8b 55 fc             	mov    -0x4(%rbp),%edx
+     c99:	89 d0                	mov    %edx,%eax
+     c9b:	c1 e0 02             	shl    $0x2,%eax
+     c9e:	01 d0                	add    %edx,%eax
+     ca0:	01 c0                	add    %eax,%eax
+     ca2:	89 c1                	mov    %eax,%ecx
+     ca4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     ca8:	48 8d 50 01          	lea    0x1(%rax),%rdx
+     cac:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+     cb0:	0f b6 00             	movzbl (%rax),%eax
+     cb3:	0f be c0             	movsbl %al,%eax
+     cb6:	01 c8                	add    %ecx,%eax
+     cb8:	83 e8 30             	sub    $0x30,%eax
+     cbb:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while ('0' <= *s && *s <= '9')
+     cbe:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     cc2:	0f b6 00             	movzbl (%rax),%eax
+     cc5:	3c 2f                	cmp    $0x2f,%al
+     cc7:	7e 0b                	jle    cd4 <atoi+0x4f>
+     cc9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     ccd:	0f b6 00             	movzbl (%rax),%eax
+     cd0:	3c 39                	cmp    $0x39,%al
+     cd2:	7e c2                	jle    c96 <atoi+0x11>
+  return n;
+     cd4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+     cd7:	5d                   	pop    %rbp
+     cd8:	c3                   	ret
+
+0000000000000cd9 <memmove>:
+
+void *memmove(void *vdst, void *vsrc, int n) {
+     cd9:	55                   	push   %rbp
+     cda:	48 89 e5             	mov    %rsp,%rbp
+     cdd:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+     ce1:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+     ce5:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  char *dst, *src;
+
+  dst = vdst;
+     ce8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     cec:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  src = vsrc;
+     cf0:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+     cf4:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  while (n-- > 0)
+     cf8:	eb 1d                	jmp    d17 <memmove+0x3e>
+    *dst++ = *src++;
+     cfa:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+     cfe:	48 8d 42 01          	lea    0x1(%rdx),%rax
+     d02:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+     d06:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     d0a:	48 8d 48 01          	lea    0x1(%rax),%rcx
+     d0e:	48 89 4d f8          	mov    %rcx,-0x8(%rbp)
+     d12:	0f b6 12             	movzbl (%rdx),%edx
+     d15:	88 10                	mov    %dl,(%rax)
+  while (n-- > 0)
+     d17:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     d1a:	8d 50 ff             	lea    -0x1(%rax),%edx
+     d1d:	89 55 dc             	mov    %edx,-0x24(%rbp)
+     d20:	85 c0                	test   %eax,%eax
+     d22:	7f d6                	jg     cfa <memmove+0x21>
+  return vdst;
+     d24:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     d28:	5d                   	pop    %rbp
+     d29:	c3                   	ret
+
+0000000000000d2a <fork>:
+  name:                                                                        \
+  movl $SYS_##name, % eax;                                                     \
+  int $TRAP_SYSCALL;                                                           \
+  ret
+
+SYSCALL(fork)
+     d2a:	b8 01 00 00 00       	mov    $0x1,%eax
+     d2f:	cd 40                	int    $0x40
+     d31:	c3                   	ret
+
+0000000000000d32 <exit>:
+SYSCALL(exit)
+     d32:	b8 02 00 00 00       	mov    $0x2,%eax
+     d37:	cd 40                	int    $0x40
+     d39:	c3                   	ret
+
+0000000000000d3a <wait>:
+SYSCALL(wait)
+     d3a:	b8 03 00 00 00       	mov    $0x3,%eax
+     d3f:	cd 40                	int    $0x40
+     d41:	c3                   	ret
+
+0000000000000d42 <pipe>:
+SYSCALL(pipe)
+     d42:	b8 04 00 00 00       	mov    $0x4,%eax
+     d47:	cd 40                	int    $0x40
+     d49:	c3                   	ret
+
+0000000000000d4a <read>:
+SYSCALL(read)
+     d4a:	b8 05 00 00 00       	mov    $0x5,%eax
+     d4f:	cd 40                	int    $0x40
+     d51:	c3                   	ret
+
+0000000000000d52 <write>:
+SYSCALL(write)
+     d52:	b8 10 00 00 00       	mov    $0x10,%eax
+     d57:	cd 40                	int    $0x40
+     d59:	c3                   	ret
+
+0000000000000d5a <close>:
+SYSCALL(close)
+     d5a:	b8 15 00 00 00       	mov    $0x15,%eax
+     d5f:	cd 40                	int    $0x40
+     d61:	c3                   	ret
+
+0000000000000d62 <kill>:
+SYSCALL(kill)
+     d62:	b8 06 00 00 00       	mov    $0x6,%eax
+     d67:	cd 40                	int    $0x40
+     d69:	c3                   	ret
+
+0000000000000d6a <exec>:
+SYSCALL(exec)
+     d6a:	b8 07 00 00 00       	mov    $0x7,%eax
+     d6f:	cd 40                	int    $0x40
+     d71:	c3                   	ret
+
+0000000000000d72 <open>:
+SYSCALL(open)
+     d72:	b8 0f 00 00 00       	mov    $0xf,%eax
+     d77:	cd 40                	int    $0x40
+     d79:	c3                   	ret
+
+0000000000000d7a <mknod>:
+SYSCALL(mknod)
+     d7a:	b8 11 00 00 00       	mov    $0x11,%eax
+     d7f:	cd 40                	int    $0x40
+     d81:	c3                   	ret
+
+0000000000000d82 <unlink>:
+SYSCALL(unlink)
+     d82:	b8 12 00 00 00       	mov    $0x12,%eax
+     d87:	cd 40                	int    $0x40
+     d89:	c3                   	ret
+
+0000000000000d8a <fstat>:
+SYSCALL(fstat)
+     d8a:	b8 08 00 00 00       	mov    $0x8,%eax
+     d8f:	cd 40                	int    $0x40
+     d91:	c3                   	ret
+
+0000000000000d92 <link>:
+SYSCALL(link)
+     d92:	b8 13 00 00 00       	mov    $0x13,%eax
+     d97:	cd 40                	int    $0x40
+     d99:	c3                   	ret
+
+0000000000000d9a <mkdir>:
+SYSCALL(mkdir)
+     d9a:	b8 14 00 00 00       	mov    $0x14,%eax
+     d9f:	cd 40                	int    $0x40
+     da1:	c3                   	ret
+
+0000000000000da2 <chdir>:
+SYSCALL(chdir)
+     da2:	b8 09 00 00 00       	mov    $0x9,%eax
+     da7:	cd 40                	int    $0x40
+     da9:	c3                   	ret
+
+0000000000000daa <dup>:
+SYSCALL(dup)
+     daa:	b8 0a 00 00 00       	mov    $0xa,%eax
+     daf:	cd 40                	int    $0x40
+     db1:	c3                   	ret
+
+0000000000000db2 <getpid>:
+SYSCALL(getpid)
+     db2:	b8 0b 00 00 00       	mov    $0xb,%eax
+     db7:	cd 40                	int    $0x40
+     db9:	c3                   	ret
+
+0000000000000dba <sbrk>:
+SYSCALL(sbrk)
+     dba:	b8 0c 00 00 00       	mov    $0xc,%eax
+     dbf:	cd 40                	int    $0x40
+     dc1:	c3                   	ret
+
+0000000000000dc2 <sleep>:
+SYSCALL(sleep)
+     dc2:	b8 0d 00 00 00       	mov    $0xd,%eax
+     dc7:	cd 40                	int    $0x40
+     dc9:	c3                   	ret
+
+0000000000000dca <uptime>:
+SYSCALL(uptime)
+     dca:	b8 0e 00 00 00       	mov    $0xe,%eax
+     dcf:	cd 40                	int    $0x40
+     dd1:	c3                   	ret
+
+0000000000000dd2 <sysinfo>:
+SYSCALL(sysinfo)
+     dd2:	b8 16 00 00 00       	mov    $0x16,%eax
+     dd7:	cd 40                	int    $0x40
+     dd9:	c3                   	ret
+
+0000000000000dda <crashn>:
+SYSCALL(crashn)
+     dda:	b8 17 00 00 00       	mov    $0x17,%eax
+     ddf:	cd 40                	int    $0x40
+     de1:	c3                   	ret
+
+0000000000000de2 <sync>:
+SYSCALL(sync)
+     de2:	b8 18 00 00 00       	mov    $0x18,%eax
+     de7:	cd 40                	int    $0x40
+     de9:	c3                   	ret
+
+0000000000000dea <fsync>:
+SYSCALL(fsync)
+     dea:	b8 19 00 00 00       	mov    $0x19,%eax
+     def:	cd 40                	int    $0x40
+     df1:	c3                   	ret
+
+0000000000000df2 <free>:
+typedef union header Header;
+
+static Header base;
+static Header *freep;
+
+void free(void *ap) {
+     df2:	55                   	push   %rbp
+     df3:	48 89 e5             	mov    %rsp,%rbp
+     df6:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  Header *bp, *p;
+
+  bp = (Header *)ap - 1;
+     dfa:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     dfe:	48 83 e8 10          	sub    $0x10,%rax
+     e02:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  for (p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+     e06:	48 8b 05 c3 08 00 00 	mov    0x8c3(%rip),%rax        # 16d0 <freep>
+     e0d:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+     e11:	eb 2f                	jmp    e42 <free+0x50>
+    if (p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+     e13:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     e17:	48 8b 00             	mov    (%rax),%rax
+     e1a:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+     e1e:	72 17                	jb     e37 <free+0x45>
+     e20:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     e24:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+     e28:	72 2f                	jb     e59 <free+0x67>
+     e2a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     e2e:	48 8b 00             	mov    (%rax),%rax
+     e31:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+     e35:	72 22                	jb     e59 <free+0x67>
+  for (p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+     e37:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     e3b:	48 8b 00             	mov    (%rax),%rax
+     e3e:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+     e42:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     e46:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+     e4a:	73 c7                	jae    e13 <free+0x21>
+     e4c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     e50:	48 8b 00             	mov    (%rax),%rax
+     e53:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+     e57:	73 ba                	jae    e13 <free+0x21>
+      break;
+  if (bp + bp->s.size == p->s.ptr) {
+     e59:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     e5d:	8b 40 08             	mov    0x8(%rax),%eax
+     e60:	89 c0                	mov    %eax,%eax
+     e62:	48 c1 e0 04          	shl    $0x4,%rax
+     e66:	48 89 c2             	mov    %rax,%rdx
+     e69:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     e6d:	48 01 c2             	add    %rax,%rdx
+     e70:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     e74:	48 8b 00             	mov    (%rax),%rax
+     e77:	48 39 c2             	cmp    %rax,%rdx
+     e7a:	75 2d                	jne    ea9 <free+0xb7>
+    bp->s.size += p->s.ptr->s.size;
+     e7c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     e80:	8b 50 08             	mov    0x8(%rax),%edx
+     e83:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     e87:	48 8b 00             	mov    (%rax),%rax
+     e8a:	8b 40 08             	mov    0x8(%rax),%eax
+     e8d:	01 c2                	add    %eax,%edx
+     e8f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     e93:	89 50 08             	mov    %edx,0x8(%rax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+     e96:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     e9a:	48 8b 00             	mov    (%rax),%rax
+     e9d:	48 8b 10             	mov    (%rax),%rdx
+     ea0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     ea4:	48 89 10             	mov    %rdx,(%rax)
+     ea7:	eb 0e                	jmp    eb7 <free+0xc5>
+  } else
+    bp->s.ptr = p->s.ptr;
+     ea9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     ead:	48 8b 10             	mov    (%rax),%rdx
+     eb0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     eb4:	48 89 10             	mov    %rdx,(%rax)
+  if (p + p->s.size == bp) {
+     eb7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     ebb:	8b 40 08             	mov    0x8(%rax),%eax
+     ebe:	89 c0                	mov    %eax,%eax
+     ec0:	48 c1 e0 04          	shl    $0x4,%rax
+     ec4:	48 89 c2             	mov    %rax,%rdx
+     ec7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     ecb:	48 01 d0             	add    %rdx,%rax
+     ece:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+     ed2:	75 27                	jne    efb <free+0x109>
+    p->s.size += bp->s.size;
+     ed4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     ed8:	8b 50 08             	mov    0x8(%rax),%edx
+     edb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     edf:	8b 40 08             	mov    0x8(%rax),%eax
+     ee2:	01 c2                	add    %eax,%edx
+     ee4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     ee8:	89 50 08             	mov    %edx,0x8(%rax)
+    p->s.ptr = bp->s.ptr;
+     eeb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     eef:	48 8b 10             	mov    (%rax),%rdx
+     ef2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     ef6:	48 89 10             	mov    %rdx,(%rax)
+     ef9:	eb 0b                	jmp    f06 <free+0x114>
+  } else
+    p->s.ptr = bp;
+     efb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     eff:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+     f03:	48 89 10             	mov    %rdx,(%rax)
+  freep = p;
+     f06:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     f0a:	48 89 05 bf 07 00 00 	mov    %rax,0x7bf(%rip)        # 16d0 <freep>
+}
+     f11:	90                   	nop
+     f12:	5d                   	pop    %rbp
+     f13:	c3                   	ret
+
+0000000000000f14 <morecore>:
+
+static Header *morecore(uint nu) {
+     f14:	55                   	push   %rbp
+     f15:	48 89 e5             	mov    %rsp,%rbp
+     f18:	48 83 ec 20          	sub    $0x20,%rsp
+     f1c:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  char *p;
+  Header *hp;
+
+  if (nu < 4096)
+     f1f:	81 7d ec ff 0f 00 00 	cmpl   $0xfff,-0x14(%rbp)
+     f26:	77 07                	ja     f2f <morecore+0x1b>
+    nu = 4096;
+     f28:	c7 45 ec 00 10 00 00 	movl   $0x1000,-0x14(%rbp)
+  p = sbrk(nu * sizeof(Header));
+     f2f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     f32:	c1 e0 04             	shl    $0x4,%eax
+     f35:	89 c7                	mov    %eax,%edi
+     f37:	e8 7e fe ff ff       	call   dba <sbrk>
+     f3c:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (p == (char *)-1)
+     f40:	48 83 7d f8 ff       	cmpq   $0xffffffffffffffff,-0x8(%rbp)
+     f45:	75 07                	jne    f4e <morecore+0x3a>
+    return 0;
+     f47:	b8 00 00 00 00       	mov    $0x0,%eax
+     f4c:	eb 29                	jmp    f77 <morecore+0x63>
+  hp = (Header *)p;
+     f4e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     f52:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  hp->s.size = nu;
+     f56:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     f5a:	8b 55 ec             	mov    -0x14(%rbp),%edx
+     f5d:	89 50 08             	mov    %edx,0x8(%rax)
+  free((void *)(hp + 1));
+     f60:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     f64:	48 83 c0 10          	add    $0x10,%rax
+     f68:	48 89 c7             	mov    %rax,%rdi
+     f6b:	e8 82 fe ff ff       	call   df2 <free>
+  return freep;
+     f70:	48 8b 05 59 07 00 00 	mov    0x759(%rip),%rax        # 16d0 <freep>
+}
+     f77:	c9                   	leave
+     f78:	c3                   	ret
+
+0000000000000f79 <malloc>:
+
+void *malloc(uint nbytes) {
+     f79:	55                   	push   %rbp
+     f7a:	48 89 e5             	mov    %rsp,%rbp
+     f7d:	48 83 ec 30          	sub    $0x30,%rsp
+     f81:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1) / sizeof(Header) + 1;
+     f84:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     f87:	48 83 c0 0f          	add    $0xf,%rax
+     f8b:	48 c1 e8 04          	shr    $0x4,%rax
+     f8f:	83 c0 01             	add    $0x1,%eax
+     f92:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  if ((prevp = freep) == 0) {
+     f95:	48 8b 05 34 07 00 00 	mov    0x734(%rip),%rax        # 16d0 <freep>
+     f9c:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+     fa0:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+     fa5:	75 2e                	jne    fd5 <malloc+0x5c>
+    base.s.ptr = freep = prevp = &base;
+     fa7:	48 8d 05 12 07 00 00 	lea    0x712(%rip),%rax        # 16c0 <base>
+     fae:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+     fb2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     fb6:	48 89 05 13 07 00 00 	mov    %rax,0x713(%rip)        # 16d0 <freep>
+     fbd:	48 8b 05 0c 07 00 00 	mov    0x70c(%rip),%rax        # 16d0 <freep>
+     fc4:	48 89 05 f5 06 00 00 	mov    %rax,0x6f5(%rip)        # 16c0 <base>
+    base.s.size = 0;
+     fcb:	c7 05 f3 06 00 00 00 	movl   $0x0,0x6f3(%rip)        # 16c8 <base+0x8>
+     fd2:	00 00 00 
+  }
+  for (p = prevp->s.ptr;; prevp = p, p = p->s.ptr) {
+     fd5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     fd9:	48 8b 00             	mov    (%rax),%rax
+     fdc:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    if (p->s.size >= nunits) {
+     fe0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     fe4:	8b 40 08             	mov    0x8(%rax),%eax
+     fe7:	3b 45 ec             	cmp    -0x14(%rbp),%eax
+     fea:	72 5f                	jb     104b <malloc+0xd2>
+      if (p->s.size == nunits)
+     fec:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     ff0:	8b 40 08             	mov    0x8(%rax),%eax
+     ff3:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+     ff6:	75 10                	jne    1008 <malloc+0x8f>
+        prevp->s.ptr = p->s.ptr;
+     ff8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     ffc:	48 8b 10             	mov    (%rax),%rdx
+     fff:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1003:	48 89 10             	mov    %rdx,(%rax)
+    1006:	eb 2e                	jmp    1036 <malloc+0xbd>
+      else {
+        p->s.size -= nunits;
+    1008:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    100c:	8b 40 08             	mov    0x8(%rax),%eax
+    100f:	2b 45 ec             	sub    -0x14(%rbp),%eax
+    1012:	89 c2                	mov    %eax,%edx
+    1014:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1018:	89 50 08             	mov    %edx,0x8(%rax)
+        p += p->s.size;
+    101b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    101f:	8b 40 08             	mov    0x8(%rax),%eax
+    1022:	89 c0                	mov    %eax,%eax
+    1024:	48 c1 e0 04          	shl    $0x4,%rax
+    1028:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+        p->s.size = nunits;
+    102c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1030:	8b 55 ec             	mov    -0x14(%rbp),%edx
+    1033:	89 50 08             	mov    %edx,0x8(%rax)
+      }
+      freep = prevp;
+    1036:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    103a:	48 89 05 8f 06 00 00 	mov    %rax,0x68f(%rip)        # 16d0 <freep>
+      return (void *)(p + 1);
+    1041:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1045:	48 83 c0 10          	add    $0x10,%rax
+    1049:	eb 41                	jmp    108c <malloc+0x113>
+    }
+    if (p == freep)
+    104b:	48 8b 05 7e 06 00 00 	mov    0x67e(%rip),%rax        # 16d0 <freep>
+    1052:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+    1056:	75 1c                	jne    1074 <malloc+0xfb>
+      if ((p = morecore(nunits)) == 0)
+    1058:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    105b:	89 c7                	mov    %eax,%edi
+    105d:	e8 b2 fe ff ff       	call   f14 <morecore>
+    1062:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    1066:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+    106b:	75 07                	jne    1074 <malloc+0xfb>
+        return 0;
+    106d:	b8 00 00 00 00       	mov    $0x0,%eax
+    1072:	eb 18                	jmp    108c <malloc+0x113>
+  for (p = prevp->s.ptr;; prevp = p, p = p->s.ptr) {
+    1074:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1078:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    107c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1080:	48 8b 00             	mov    (%rax),%rax
+    1083:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    if (p->s.size >= nunits) {
+    1087:	e9 54 ff ff ff       	jmp    fe0 <malloc+0x67>
+  }
+    108c:	c9                   	leave
+    108d:	c3                   	ret
@@ -0,0 +1,1573 @@
+
+out/user/_ls:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000000000 <fmtname>:
+#include <cdefs.h>
+#include <fs.h>
+#include <stat.h>
+#include <user.h>
+
+char *fmtname(char *path) {
+   0:	55                   	push   %rbp
+   1:	48 89 e5             	mov    %rsp,%rbp
+   4:	53                   	push   %rbx
+   5:	48 83 ec 28          	sub    $0x28,%rsp
+   9:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  static char buf[DIRSIZ + 1];
+  char *p;
+
+  // Find first character after last slash.
+  for (p = path + strlen(path); p >= path && *p != '/'; p--)
+   d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  11:	48 89 c7             	mov    %rax,%rdi
+  14:	e8 fa 08 00 00       	call   913 <strlen>
+  19:	89 c2                	mov    %eax,%edx
+  1b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  1f:	48 01 d0             	add    %rdx,%rax
+  22:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  26:	eb 05                	jmp    2d <fmtname+0x2d>
+  28:	48 83 6d e8 01       	subq   $0x1,-0x18(%rbp)
+  2d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  31:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  35:	72 0b                	jb     42 <fmtname+0x42>
+  37:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  3b:	0f b6 00             	movzbl (%rax),%eax
+  3e:	3c 2f                	cmp    $0x2f,%al
+  40:	75 e6                	jne    28 <fmtname+0x28>
+    ;
+  p++;
+  42:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+
+  // Return blank-padded name.
+  if (strlen(p) >= DIRSIZ)
+  47:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  4b:	48 89 c7             	mov    %rax,%rdi
+  4e:	e8 c0 08 00 00       	call   913 <strlen>
+  53:	83 f8 0d             	cmp    $0xd,%eax
+  56:	76 06                	jbe    5e <fmtname+0x5e>
+    return p;
+  58:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  5c:	eb 67                	jmp    c5 <fmtname+0xc5>
+  memmove(buf, p, strlen(p));
+  5e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  62:	48 89 c7             	mov    %rax,%rdi
+  65:	e8 a9 08 00 00       	call   913 <strlen>
+  6a:	89 c2                	mov    %eax,%edx
+  6c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  70:	48 89 c6             	mov    %rax,%rsi
+  73:	48 8d 05 46 11 00 00 	lea    0x1146(%rip),%rax        # 11c0 <buf.0>
+  7a:	48 89 c7             	mov    %rax,%rdi
+  7d:	e8 4f 0a 00 00       	call   ad1 <memmove>
+  memset(buf + strlen(p), ' ', DIRSIZ - strlen(p));
+  82:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  86:	48 89 c7             	mov    %rax,%rdi
+  89:	e8 85 08 00 00       	call   913 <strlen>
+  8e:	ba 0e 00 00 00       	mov    $0xe,%edx
+  93:	89 d3                	mov    %edx,%ebx
+  95:	29 c3                	sub    %eax,%ebx
+  97:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  9b:	48 89 c7             	mov    %rax,%rdi
+  9e:	e8 70 08 00 00       	call   913 <strlen>
+  a3:	89 c2                	mov    %eax,%edx
+  a5:	48 8d 05 14 11 00 00 	lea    0x1114(%rip),%rax        # 11c0 <buf.0>
+  ac:	48 01 d0             	add    %rdx,%rax
+  af:	89 da                	mov    %ebx,%edx
+  b1:	be 20 00 00 00       	mov    $0x20,%esi
+  b6:	48 89 c7             	mov    %rax,%rdi
+  b9:	e8 83 08 00 00       	call   941 <memset>
+  return buf;
+  be:	48 8d 05 fb 10 00 00 	lea    0x10fb(%rip),%rax        # 11c0 <buf.0>
+}
+  c5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  c9:	c9                   	leave
+  ca:	c3                   	ret
+
+00000000000000cb <ls>:
+
+void ls(char *path) {
+  cb:	55                   	push   %rbp
+  cc:	48 89 e5             	mov    %rsp,%rbp
+  cf:	41 55                	push   %r13
+  d1:	41 54                	push   %r12
+  d3:	53                   	push   %rbx
+  d4:	48 81 ec 48 02 00 00 	sub    $0x248,%rsp
+  db:	48 89 bd a8 fd ff ff 	mov    %rdi,-0x258(%rbp)
+  char buf[512], *p;
+  int fd;
+  struct dirent de;
+  struct stat st;
+
+  if ((fd = open(path, 0)) < 0) {
+  e2:	48 8b 85 a8 fd ff ff 	mov    -0x258(%rbp),%rax
+  e9:	be 00 00 00 00       	mov    $0x0,%esi
+  ee:	48 89 c7             	mov    %rax,%rdi
+  f1:	e8 74 0a 00 00       	call   b6a <open>
+  f6:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  f9:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  fd:	79 28                	jns    127 <ls+0x5c>
+    printf(2, "ls: cannot open %s\n", path);
+  ff:	48 8b 85 a8 fd ff ff 	mov    -0x258(%rbp),%rax
+ 106:	48 89 c2             	mov    %rax,%rdx
+ 109:	48 8d 05 76 0d 00 00 	lea    0xd76(%rip),%rax        # e86 <malloc+0x115>
+ 110:	48 89 c6             	mov    %rax,%rsi
+ 113:	bf 02 00 00 00       	mov    $0x2,%edi
+ 118:	b8 00 00 00 00       	mov    $0x0,%eax
+ 11d:	e8 61 04 00 00       	call   583 <printf>
+    return;
+ 122:	e9 2a 02 00 00       	jmp    351 <ls+0x286>
+  }
+
+  if (fstat(fd, &st) < 0) {
+ 127:	48 8d 95 b0 fd ff ff 	lea    -0x250(%rbp),%rdx
+ 12e:	8b 45 dc             	mov    -0x24(%rbp),%eax
+ 131:	48 89 d6             	mov    %rdx,%rsi
+ 134:	89 c7                	mov    %eax,%edi
+ 136:	e8 47 0a 00 00       	call   b82 <fstat>
+ 13b:	85 c0                	test   %eax,%eax
+ 13d:	79 32                	jns    171 <ls+0xa6>
+    printf(2, "ls: cannot stat %s\n", path);
+ 13f:	48 8b 85 a8 fd ff ff 	mov    -0x258(%rbp),%rax
+ 146:	48 89 c2             	mov    %rax,%rdx
+ 149:	48 8d 05 4a 0d 00 00 	lea    0xd4a(%rip),%rax        # e9a <malloc+0x129>
+ 150:	48 89 c6             	mov    %rax,%rsi
+ 153:	bf 02 00 00 00       	mov    $0x2,%edi
+ 158:	b8 00 00 00 00       	mov    $0x0,%eax
+ 15d:	e8 21 04 00 00       	call   583 <printf>
+    close(fd);
+ 162:	8b 45 dc             	mov    -0x24(%rbp),%eax
+ 165:	89 c7                	mov    %eax,%edi
+ 167:	e8 e6 09 00 00       	call   b52 <close>
+    return;
+ 16c:	e9 e0 01 00 00       	jmp    351 <ls+0x286>
+  }
+
+  switch (st.type) {
+ 171:	0f b7 85 b0 fd ff ff 	movzwl -0x250(%rbp),%eax
+ 178:	98                   	cwtl
+ 179:	83 f8 01             	cmp    $0x1,%eax
+ 17c:	74 59                	je     1d7 <ls+0x10c>
+ 17e:	83 f8 02             	cmp    $0x2,%eax
+ 181:	0f 85 c0 01 00 00    	jne    347 <ls+0x27c>
+  case T_FILE:
+    printf(1, "%s %d %d %d\n", fmtname(path), st.type, st.ino, st.size);
+ 187:	44 8b ad bc fd ff ff 	mov    -0x244(%rbp),%r13d
+ 18e:	44 8b a5 b8 fd ff ff 	mov    -0x248(%rbp),%r12d
+ 195:	0f b7 85 b0 fd ff ff 	movzwl -0x250(%rbp),%eax
+ 19c:	0f bf d8             	movswl %ax,%ebx
+ 19f:	48 8b 85 a8 fd ff ff 	mov    -0x258(%rbp),%rax
+ 1a6:	48 89 c7             	mov    %rax,%rdi
+ 1a9:	e8 52 fe ff ff       	call   0 <fmtname>
+ 1ae:	45 89 e9             	mov    %r13d,%r9d
+ 1b1:	45 89 e0             	mov    %r12d,%r8d
+ 1b4:	89 d9                	mov    %ebx,%ecx
+ 1b6:	48 89 c2             	mov    %rax,%rdx
+ 1b9:	48 8d 05 ee 0c 00 00 	lea    0xcee(%rip),%rax        # eae <malloc+0x13d>
+ 1c0:	48 89 c6             	mov    %rax,%rsi
+ 1c3:	bf 01 00 00 00       	mov    $0x1,%edi
+ 1c8:	b8 00 00 00 00       	mov    $0x0,%eax
+ 1cd:	e8 b1 03 00 00       	call   583 <printf>
+    break;
+ 1d2:	e9 70 01 00 00       	jmp    347 <ls+0x27c>
+
+  case T_DIR:
+    if (strlen(path) + 1 + DIRSIZ + 1 > sizeof buf) {
+ 1d7:	48 8b 85 a8 fd ff ff 	mov    -0x258(%rbp),%rax
+ 1de:	48 89 c7             	mov    %rax,%rdi
+ 1e1:	e8 2d 07 00 00       	call   913 <strlen>
+ 1e6:	83 c0 10             	add    $0x10,%eax
+ 1e9:	3d 00 02 00 00       	cmp    $0x200,%eax
+ 1ee:	76 1e                	jbe    20e <ls+0x143>
+      printf(1, "ls: path too long\n");
+ 1f0:	48 8d 05 c4 0c 00 00 	lea    0xcc4(%rip),%rax        # ebb <malloc+0x14a>
+ 1f7:	48 89 c6             	mov    %rax,%rsi
+ 1fa:	bf 01 00 00 00       	mov    $0x1,%edi
+ 1ff:	b8 00 00 00 00       	mov    $0x0,%eax
+ 204:	e8 7a 03 00 00       	call   583 <printf>
+      break;
+ 209:	e9 39 01 00 00       	jmp    347 <ls+0x27c>
+    }
+    strcpy(buf, path);
+ 20e:	48 8b 95 a8 fd ff ff 	mov    -0x258(%rbp),%rdx
+ 215:	48 8d 85 d0 fd ff ff 	lea    -0x230(%rbp),%rax
+ 21c:	48 89 d6             	mov    %rdx,%rsi
+ 21f:	48 89 c7             	mov    %rax,%rdi
+ 222:	e8 5e 06 00 00       	call   885 <strcpy>
+    p = buf + strlen(buf);
+ 227:	48 8d 85 d0 fd ff ff 	lea    -0x230(%rbp),%rax
+ 22e:	48 89 c7             	mov    %rax,%rdi
+ 231:	e8 dd 06 00 00       	call   913 <strlen>
+ 236:	89 c2                	mov    %eax,%edx
+ 238:	48 8d 85 d0 fd ff ff 	lea    -0x230(%rbp),%rax
+ 23f:	48 01 d0             	add    %rdx,%rax
+ 242:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+    *p++ = '/';
+ 246:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+ 24a:	48 8d 50 01          	lea    0x1(%rax),%rdx
+ 24e:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+ 252:	c6 00 2f             	movb   $0x2f,(%rax)
+    while (read(fd, &de, sizeof(de)) == sizeof(de)) {
+ 255:	e9 ca 00 00 00       	jmp    324 <ls+0x259>
+      if (de.inum == 0)
+ 25a:	0f b7 85 c0 fd ff ff 	movzwl -0x240(%rbp),%eax
+ 261:	66 85 c0             	test   %ax,%ax
+ 264:	0f 84 b9 00 00 00    	je     323 <ls+0x258>
+        continue;
+      memmove(p, de.name, DIRSIZ);
+ 26a:	48 8d 85 c0 fd ff ff 	lea    -0x240(%rbp),%rax
+ 271:	48 8d 48 02          	lea    0x2(%rax),%rcx
+ 275:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+ 279:	ba 0e 00 00 00       	mov    $0xe,%edx
+ 27e:	48 89 ce             	mov    %rcx,%rsi
+ 281:	48 89 c7             	mov    %rax,%rdi
+ 284:	e8 48 08 00 00       	call   ad1 <memmove>
+      p[DIRSIZ] = 0;
+ 289:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+ 28d:	48 83 c0 0e          	add    $0xe,%rax
+ 291:	c6 00 00             	movb   $0x0,(%rax)
+      if (stat(buf, &st) < 0) {
+ 294:	48 8d 95 b0 fd ff ff 	lea    -0x250(%rbp),%rdx
+ 29b:	48 8d 85 d0 fd ff ff 	lea    -0x230(%rbp),%rax
+ 2a2:	48 89 d6             	mov    %rdx,%rsi
+ 2a5:	48 89 c7             	mov    %rax,%rdi
+ 2a8:	e8 7c 07 00 00       	call   a29 <stat>
+ 2ad:	85 c0                	test   %eax,%eax
+ 2af:	79 25                	jns    2d6 <ls+0x20b>
+        printf(1, "ls: cannot stat %s\n", buf);
+ 2b1:	48 8d 85 d0 fd ff ff 	lea    -0x230(%rbp),%rax
+ 2b8:	48 89 c2             	mov    %rax,%rdx
+ 2bb:	48 8d 05 d8 0b 00 00 	lea    0xbd8(%rip),%rax        # e9a <malloc+0x129>
+ 2c2:	48 89 c6             	mov    %rax,%rsi
+ 2c5:	bf 01 00 00 00       	mov    $0x1,%edi
+ 2ca:	b8 00 00 00 00       	mov    $0x0,%eax
+ 2cf:	e8 af 02 00 00       	call   583 <printf>
+        continue;
+ 2d4:	eb 4e                	jmp    324 <ls+0x259>
+     // buf[2] = 'i';
+    //  buf[3] = '/';
+   //   buf[4] = 'o';
+  //    buf[5] = 'z';
+//      buf[6] = 0;
+      printf(1, "%s %d %d %d\n", fmtname(buf), st.type, st.ino, st.size);
+ 2d6:	44 8b ad bc fd ff ff 	mov    -0x244(%rbp),%r13d
+ 2dd:	44 8b a5 b8 fd ff ff 	mov    -0x248(%rbp),%r12d
+ 2e4:	0f b7 85 b0 fd ff ff 	movzwl -0x250(%rbp),%eax
+ 2eb:	0f bf d8             	movswl %ax,%ebx
+ 2ee:	48 8d 85 d0 fd ff ff 	lea    -0x230(%rbp),%rax
+ 2f5:	48 89 c7             	mov    %rax,%rdi
+ 2f8:	e8 03 fd ff ff       	call   0 <fmtname>
+ 2fd:	45 89 e9             	mov    %r13d,%r9d
+ 300:	45 89 e0             	mov    %r12d,%r8d
+ 303:	89 d9                	mov    %ebx,%ecx
+ 305:	48 89 c2             	mov    %rax,%rdx
+ 308:	48 8d 05 9f 0b 00 00 	lea    0xb9f(%rip),%rax        # eae <malloc+0x13d>
+ 30f:	48 89 c6             	mov    %rax,%rsi
+ 312:	bf 01 00 00 00       	mov    $0x1,%edi
+ 317:	b8 00 00 00 00       	mov    $0x0,%eax
+ 31c:	e8 62 02 00 00       	call   583 <printf>
+ 321:	eb 01                	jmp    324 <ls+0x259>
+        continue;
+ 323:	90                   	nop
+    while (read(fd, &de, sizeof(de)) == sizeof(de)) {
+ 324:	48 8d 8d c0 fd ff ff 	lea    -0x240(%rbp),%rcx
+ 32b:	8b 45 dc             	mov    -0x24(%rbp),%eax
+ 32e:	ba 10 00 00 00       	mov    $0x10,%edx
+ 333:	48 89 ce             	mov    %rcx,%rsi
+ 336:	89 c7                	mov    %eax,%edi
+ 338:	e8 05 08 00 00       	call   b42 <read>
+ 33d:	83 f8 10             	cmp    $0x10,%eax
+ 340:	0f 84 14 ff ff ff    	je     25a <ls+0x18f>
+    }
+    break;
+ 346:	90                   	nop
+  }
+  close(fd);
+ 347:	8b 45 dc             	mov    -0x24(%rbp),%eax
+ 34a:	89 c7                	mov    %eax,%edi
+ 34c:	e8 01 08 00 00       	call   b52 <close>
+}
+ 351:	48 81 c4 48 02 00 00 	add    $0x248,%rsp
+ 358:	5b                   	pop    %rbx
+ 359:	41 5c                	pop    %r12
+ 35b:	41 5d                	pop    %r13
+ 35d:	5d                   	pop    %rbp
+ 35e:	c3                   	ret
+
+000000000000035f <main>:
+
+int main(int argc, char *argv[]) {
+ 35f:	55                   	push   %rbp
+ 360:	48 89 e5             	mov    %rsp,%rbp
+ 363:	48 83 ec 20          	sub    $0x20,%rsp
+ 367:	89 7d ec             	mov    %edi,-0x14(%rbp)
+ 36a:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int i;
+
+  if (argc < 2) {
+ 36e:	83 7d ec 01          	cmpl   $0x1,-0x14(%rbp)
+ 372:	7f 14                	jg     388 <main+0x29>
+    ls(".");
+ 374:	48 8d 05 53 0b 00 00 	lea    0xb53(%rip),%rax        # ece <malloc+0x15d>
+ 37b:	48 89 c7             	mov    %rax,%rdi
+ 37e:	e8 48 fd ff ff       	call   cb <ls>
+    exit();
+ 383:	e8 a2 07 00 00       	call   b2a <exit>
+  }
+  for (i = 1; i < argc; i++)
+ 388:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+ 38f:	eb 23                	jmp    3b4 <main+0x55>
+    ls(argv[i]);
+ 391:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 394:	48 98                	cltq
+ 396:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+ 39d:	00 
+ 39e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+ 3a2:	48 01 d0             	add    %rdx,%rax
+ 3a5:	48 8b 00             	mov    (%rax),%rax
+ 3a8:	48 89 c7             	mov    %rax,%rdi
+ 3ab:	e8 1b fd ff ff       	call   cb <ls>
+  for (i = 1; i < argc; i++)
+ 3b0:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+ 3b4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 3b7:	3b 45 ec             	cmp    -0x14(%rbp),%eax
+ 3ba:	7c d5                	jl     391 <main+0x32>
+  exit();
+ 3bc:	e8 69 07 00 00       	call   b2a <exit>
+
+00000000000003c1 <putc>:
+#include <cdefs.h>
+#include <stat.h>
+#include <stdarg.h>
+#include <user.h>
+
+static void putc(int fd, char c) { write(fd, &c, 1); }
+ 3c1:	55                   	push   %rbp
+ 3c2:	48 89 e5             	mov    %rsp,%rbp
+ 3c5:	48 83 ec 10          	sub    $0x10,%rsp
+ 3c9:	89 7d fc             	mov    %edi,-0x4(%rbp)
+ 3cc:	89 f0                	mov    %esi,%eax
+ 3ce:	88 45 f8             	mov    %al,-0x8(%rbp)
+ 3d1:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+ 3d5:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 3d8:	ba 01 00 00 00       	mov    $0x1,%edx
+ 3dd:	48 89 ce             	mov    %rcx,%rsi
+ 3e0:	89 c7                	mov    %eax,%edi
+ 3e2:	e8 63 07 00 00       	call   b4a <write>
+ 3e7:	90                   	nop
+ 3e8:	c9                   	leave
+ 3e9:	c3                   	ret
+
+00000000000003ea <printint64>:
+
+static void printint64(int fd, int xx, int base, int sgn) {
+ 3ea:	55                   	push   %rbp
+ 3eb:	48 89 e5             	mov    %rsp,%rbp
+ 3ee:	48 83 ec 40          	sub    $0x40,%rsp
+ 3f2:	89 7d cc             	mov    %edi,-0x34(%rbp)
+ 3f5:	89 75 c8             	mov    %esi,-0x38(%rbp)
+ 3f8:	89 55 c4             	mov    %edx,-0x3c(%rbp)
+ 3fb:	89 4d c0             	mov    %ecx,-0x40(%rbp)
+  static char digits[] = "0123456789abcdef";
+  char buf[32];
+  int i;
+  uint64_t x;
+
+  if (sgn && (sgn = xx < 0))
+ 3fe:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+ 402:	74 1f                	je     423 <printint64+0x39>
+ 404:	8b 45 c8             	mov    -0x38(%rbp),%eax
+ 407:	c1 e8 1f             	shr    $0x1f,%eax
+ 40a:	0f b6 c0             	movzbl %al,%eax
+ 40d:	89 45 c0             	mov    %eax,-0x40(%rbp)
+ 410:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+ 414:	74 0d                	je     423 <printint64+0x39>
+    x = -xx;
+ 416:	8b 45 c8             	mov    -0x38(%rbp),%eax
+ 419:	f7 d8                	neg    %eax
+ 41b:	48 98                	cltq
+ 41d:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+ 421:	eb 09                	jmp    42c <printint64+0x42>
+  else
+    x = xx;
+ 423:	8b 45 c8             	mov    -0x38(%rbp),%eax
+ 426:	48 98                	cltq
+ 428:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+  i = 0;
+ 42c:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  do {
+    buf[i++] = digits[x % base];
+ 433:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+ 436:	48 63 c8             	movslq %eax,%rcx
+ 439:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ 43d:	ba 00 00 00 00       	mov    $0x0,%edx
+ 442:	48 f7 f1             	div    %rcx
+ 445:	48 89 d1             	mov    %rdx,%rcx
+ 448:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 44b:	8d 50 01             	lea    0x1(%rax),%edx
+ 44e:	89 55 fc             	mov    %edx,-0x4(%rbp)
+ 451:	48 8d 15 28 0d 00 00 	lea    0xd28(%rip),%rdx        # 1180 <digits.1>
+ 458:	0f b6 14 11          	movzbl (%rcx,%rdx,1),%edx
+ 45c:	48 98                	cltq
+ 45e:	88 54 05 d0          	mov    %dl,-0x30(%rbp,%rax,1)
+  } while ((x /= base) != 0);
+ 462:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+ 465:	48 63 f0             	movslq %eax,%rsi
+ 468:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ 46c:	ba 00 00 00 00       	mov    $0x0,%edx
+ 471:	48 f7 f6             	div    %rsi
+ 474:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+ 478:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+ 47d:	75 b4                	jne    433 <printint64+0x49>
+
+  if (sgn)
+ 47f:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+ 483:	74 2b                	je     4b0 <printint64+0xc6>
+    buf[i++] = '-';
+ 485:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 488:	8d 50 01             	lea    0x1(%rax),%edx
+ 48b:	89 55 fc             	mov    %edx,-0x4(%rbp)
+ 48e:	48 98                	cltq
+ 490:	c6 44 05 d0 2d       	movb   $0x2d,-0x30(%rbp,%rax,1)
+
+  while (--i >= 0)
+ 495:	eb 19                	jmp    4b0 <printint64+0xc6>
+    putc(fd, buf[i]);
+ 497:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 49a:	48 98                	cltq
+ 49c:	0f b6 44 05 d0       	movzbl -0x30(%rbp,%rax,1),%eax
+ 4a1:	0f be d0             	movsbl %al,%edx
+ 4a4:	8b 45 cc             	mov    -0x34(%rbp),%eax
+ 4a7:	89 d6                	mov    %edx,%esi
+ 4a9:	89 c7                	mov    %eax,%edi
+ 4ab:	e8 11 ff ff ff       	call   3c1 <putc>
+  while (--i >= 0)
+ 4b0:	83 6d fc 01          	subl   $0x1,-0x4(%rbp)
+ 4b4:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+ 4b8:	79 dd                	jns    497 <printint64+0xad>
+}
+ 4ba:	90                   	nop
+ 4bb:	90                   	nop
+ 4bc:	c9                   	leave
+ 4bd:	c3                   	ret
+
+00000000000004be <printint>:
+
+static void printint(int fd, int xx, int base, int sgn) {
+ 4be:	55                   	push   %rbp
+ 4bf:	48 89 e5             	mov    %rsp,%rbp
+ 4c2:	48 83 ec 30          	sub    $0x30,%rsp
+ 4c6:	89 7d dc             	mov    %edi,-0x24(%rbp)
+ 4c9:	89 75 d8             	mov    %esi,-0x28(%rbp)
+ 4cc:	89 55 d4             	mov    %edx,-0x2c(%rbp)
+ 4cf:	89 4d d0             	mov    %ecx,-0x30(%rbp)
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+ 4d2:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+  if (sgn && xx < 0) {
+ 4d9:	83 7d d0 00          	cmpl   $0x0,-0x30(%rbp)
+ 4dd:	74 17                	je     4f6 <printint+0x38>
+ 4df:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+ 4e3:	79 11                	jns    4f6 <printint+0x38>
+    neg = 1;
+ 4e5:	c7 45 f8 01 00 00 00 	movl   $0x1,-0x8(%rbp)
+    x = -xx;
+ 4ec:	8b 45 d8             	mov    -0x28(%rbp),%eax
+ 4ef:	f7 d8                	neg    %eax
+ 4f1:	89 45 f4             	mov    %eax,-0xc(%rbp)
+ 4f4:	eb 06                	jmp    4fc <printint+0x3e>
+  } else {
+    x = xx;
+ 4f6:	8b 45 d8             	mov    -0x28(%rbp),%eax
+ 4f9:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  }
+
+  i = 0;
+ 4fc:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  do {
+    buf[i++] = digits[x % base];
+ 503:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+ 506:	8b 45 f4             	mov    -0xc(%rbp),%eax
+ 509:	ba 00 00 00 00       	mov    $0x0,%edx
+ 50e:	f7 f1                	div    %ecx
+ 510:	89 d1                	mov    %edx,%ecx
+ 512:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 515:	8d 50 01             	lea    0x1(%rax),%edx
+ 518:	89 55 fc             	mov    %edx,-0x4(%rbp)
+ 51b:	89 c9                	mov    %ecx,%ecx
+ 51d:	48 8d 15 7c 0c 00 00 	lea    0xc7c(%rip),%rdx        # 11a0 <digits.0>
+ 524:	0f b6 14 11          	movzbl (%rcx,%rdx,1),%edx
+ 528:	48 98                	cltq
+ 52a:	88 54 05 e4          	mov    %dl,-0x1c(%rbp,%rax,1)
+  } while ((x /= base) != 0);
+ 52e:	8b 75 d4             	mov    -0x2c(%rbp),%esi
+ 531:	8b 45 f4             	mov    -0xc(%rbp),%eax
+ 534:	ba 00 00 00 00       	mov    $0x0,%edx
+ 539:	f7 f6                	div    %esi
+ 53b:	89 45 f4             	mov    %eax,-0xc(%rbp)
+ 53e:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+ 542:	75 bf                	jne    503 <printint+0x45>
+  if (neg)
+ 544:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+ 548:	74 2b                	je     575 <printint+0xb7>
+    buf[i++] = '-';
+ 54a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 54d:	8d 50 01             	lea    0x1(%rax),%edx
+ 550:	89 55 fc             	mov    %edx,-0x4(%rbp)
+ 553:	48 98                	cltq
+ 555:	c6 44 05 e4 2d       	movb   $0x2d,-0x1c(%rbp,%rax,1)
+
+  while (--i >= 0)
+ 55a:	eb 19                	jmp    575 <printint+0xb7>
+    putc(fd, buf[i]);
+ 55c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 55f:	48 98                	cltq
+ 561:	0f b6 44 05 e4       	movzbl -0x1c(%rbp,%rax,1),%eax
+ 566:	0f be d0             	movsbl %al,%edx
+ 569:	8b 45 dc             	mov    -0x24(%rbp),%eax
+ 56c:	89 d6                	mov    %edx,%esi
+ 56e:	89 c7                	mov    %eax,%edi
+ 570:	e8 4c fe ff ff       	call   3c1 <putc>
+  while (--i >= 0)
+ 575:	83 6d fc 01          	subl   $0x1,-0x4(%rbp)
+ 579:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+ 57d:	79 dd                	jns    55c <printint+0x9e>
+}
+ 57f:	90                   	nop
+ 580:	90                   	nop
+ 581:	c9                   	leave
+ 582:	c3                   	ret
+
+0000000000000583 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void printf(int fd, char *fmt, ...) {
+ 583:	55                   	push   %rbp
+ 584:	48 89 e5             	mov    %rsp,%rbp
+ 587:	48 83 ec 70          	sub    $0x70,%rsp
+ 58b:	89 7d 9c             	mov    %edi,-0x64(%rbp)
+ 58e:	48 89 75 90          	mov    %rsi,-0x70(%rbp)
+ 592:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+ 596:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+ 59a:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+ 59e:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+  char *s;
+  int c, i, state;
+  int lflag;
+  va_list valist;
+  va_start(valist, fmt);
+ 5a2:	c7 45 a0 10 00 00 00 	movl   $0x10,-0x60(%rbp)
+ 5a9:	48 8d 45 10          	lea    0x10(%rbp),%rax
+ 5ad:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+ 5b1:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+ 5b5:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+
+  state = 0;
+ 5b9:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%rbp)
+  for (i = 0; fmt[i]; i++) {
+ 5c0:	c7 45 c4 00 00 00 00 	movl   $0x0,-0x3c(%rbp)
+ 5c7:	e9 6b 02 00 00       	jmp    837 <printf+0x2b4>
+    c = fmt[i] & 0xff;
+ 5cc:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+ 5cf:	48 63 d0             	movslq %eax,%rdx
+ 5d2:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+ 5d6:	48 01 d0             	add    %rdx,%rax
+ 5d9:	0f b6 00             	movzbl (%rax),%eax
+ 5dc:	0f be c0             	movsbl %al,%eax
+ 5df:	25 ff 00 00 00       	and    $0xff,%eax
+ 5e4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+    if (state == 0) {
+ 5e7:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+ 5eb:	75 30                	jne    61d <printf+0x9a>
+      if (c == '%') {
+ 5ed:	83 7d b8 25          	cmpl   $0x25,-0x48(%rbp)
+ 5f1:	75 13                	jne    606 <printf+0x83>
+        state = '%';
+ 5f3:	c7 45 c0 25 00 00 00 	movl   $0x25,-0x40(%rbp)
+        lflag = 0;
+ 5fa:	c7 45 bc 00 00 00 00 	movl   $0x0,-0x44(%rbp)
+ 601:	e9 2d 02 00 00       	jmp    833 <printf+0x2b0>
+      } else {
+        putc(fd, c);
+ 606:	8b 45 b8             	mov    -0x48(%rbp),%eax
+ 609:	0f be d0             	movsbl %al,%edx
+ 60c:	8b 45 9c             	mov    -0x64(%rbp),%eax
+ 60f:	89 d6                	mov    %edx,%esi
+ 611:	89 c7                	mov    %eax,%edi
+ 613:	e8 a9 fd ff ff       	call   3c1 <putc>
+ 618:	e9 16 02 00 00       	jmp    833 <printf+0x2b0>
+      }
+    } else if (state == '%') {
+ 61d:	83 7d c0 25          	cmpl   $0x25,-0x40(%rbp)
+ 621:	0f 85 0c 02 00 00    	jne    833 <printf+0x2b0>
+      if (c == 'l') {
+ 627:	83 7d b8 6c          	cmpl   $0x6c,-0x48(%rbp)
+ 62b:	75 0c                	jne    639 <printf+0xb6>
+        lflag = 1;
+ 62d:	c7 45 bc 01 00 00 00 	movl   $0x1,-0x44(%rbp)
+        continue;
+ 634:	e9 fa 01 00 00       	jmp    833 <printf+0x2b0>
+      } else if (c == 'd') {
+ 639:	83 7d b8 64          	cmpl   $0x64,-0x48(%rbp)
+ 63d:	0f 85 95 00 00 00    	jne    6d8 <printf+0x155>
+        if (lflag == 1)
+ 643:	83 7d bc 01          	cmpl   $0x1,-0x44(%rbp)
+ 647:	75 49                	jne    692 <printf+0x10f>
+          printint64(fd, va_arg(valist, int64_t), 10, 1);
+ 649:	8b 45 a0             	mov    -0x60(%rbp),%eax
+ 64c:	83 f8 2f             	cmp    $0x2f,%eax
+ 64f:	77 17                	ja     668 <printf+0xe5>
+ 651:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+ 655:	8b 55 a0             	mov    -0x60(%rbp),%edx
+ 658:	89 d2                	mov    %edx,%edx
+ 65a:	48 01 d0             	add    %rdx,%rax
+ 65d:	8b 55 a0             	mov    -0x60(%rbp),%edx
+ 660:	83 c2 08             	add    $0x8,%edx
+ 663:	89 55 a0             	mov    %edx,-0x60(%rbp)
+ 666:	eb 0c                	jmp    674 <printf+0xf1>
+ 668:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+ 66c:	48 8d 50 08          	lea    0x8(%rax),%rdx
+ 670:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+ 674:	48 8b 00             	mov    (%rax),%rax
+ 677:	89 c6                	mov    %eax,%esi
+ 679:	8b 45 9c             	mov    -0x64(%rbp),%eax
+ 67c:	b9 01 00 00 00       	mov    $0x1,%ecx
+ 681:	ba 0a 00 00 00       	mov    $0xa,%edx
+ 686:	89 c7                	mov    %eax,%edi
+ 688:	e8 5d fd ff ff       	call   3ea <printint64>
+ 68d:	e9 9a 01 00 00       	jmp    82c <printf+0x2a9>
+        else
+          printint(fd, va_arg(valist, int), 10, 1);
+ 692:	8b 45 a0             	mov    -0x60(%rbp),%eax
+ 695:	83 f8 2f             	cmp    $0x2f,%eax
+ 698:	77 17                	ja     6b1 <printf+0x12e>
+ 69a:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+ 69e:	8b 55 a0             	mov    -0x60(%rbp),%edx
+ 6a1:	89 d2                	mov    %edx,%edx
+ 6a3:	48 01 d0             	add    %rdx,%rax
+ 6a6:	8b 55 a0             	mov    -0x60(%rbp),%edx
+ 6a9:	83 c2 08             	add    $0x8,%edx
+ 6ac:	89 55 a0             	mov    %edx,-0x60(%rbp)
+ 6af:	eb 0c                	jmp    6bd <printf+0x13a>
+ 6b1:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+ 6b5:	48 8d 50 08          	lea    0x8(%rax),%rdx
+ 6b9:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+ 6bd:	8b 30                	mov    (%rax),%esi
+ 6bf:	8b 45 9c             	mov    -0x64(%rbp),%eax
+ 6c2:	b9 01 00 00 00       	mov    $0x1,%ecx
+ 6c7:	ba 0a 00 00 00       	mov    $0xa,%edx
+ 6cc:	89 c7                	mov    %eax,%edi
+ 6ce:	e8 eb fd ff ff       	call   4be <printint>
+ 6d3:	e9 54 01 00 00       	jmp    82c <printf+0x2a9>
+      } else if (c == 'x' || c == 'p') {
+ 6d8:	83 7d b8 78          	cmpl   $0x78,-0x48(%rbp)
+ 6dc:	74 0a                	je     6e8 <printf+0x165>
+ 6de:	83 7d b8 70          	cmpl   $0x70,-0x48(%rbp)
+ 6e2:	0f 85 95 00 00 00    	jne    77d <printf+0x1fa>
+        if (lflag == 1)
+ 6e8:	83 7d bc 01          	cmpl   $0x1,-0x44(%rbp)
+ 6ec:	75 49                	jne    737 <printf+0x1b4>
+          printint64(fd, va_arg(valist, int64_t), 16, 0);
+ 6ee:	8b 45 a0             	mov    -0x60(%rbp),%eax
+ 6f1:	83 f8 2f             	cmp    $0x2f,%eax
+ 6f4:	77 17                	ja     70d <printf+0x18a>
+ 6f6:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+ 6fa:	8b 55 a0             	mov    -0x60(%rbp),%edx
+ 6fd:	89 d2                	mov    %edx,%edx
+ 6ff:	48 01 d0             	add    %rdx,%rax
+ 702:	8b 55 a0             	mov    -0x60(%rbp),%edx
+ 705:	83 c2 08             	add    $0x8,%edx
+ 708:	89 55 a0             	mov    %edx,-0x60(%rbp)
+ 70b:	eb 0c                	jmp    719 <printf+0x196>
+ 70d:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+ 711:	48 8d 50 08          	lea    0x8(%rax),%rdx
+ 715:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+ 719:	48 8b 00             	mov    (%rax),%rax
+ 71c:	89 c6                	mov    %eax,%esi
+ 71e:	8b 45 9c             	mov    -0x64(%rbp),%eax
+ 721:	b9 00 00 00 00       	mov    $0x0,%ecx
+ 726:	ba 10 00 00 00       	mov    $0x10,%edx
+ 72b:	89 c7                	mov    %eax,%edi
+ 72d:	e8 b8 fc ff ff       	call   3ea <printint64>
+        if (lflag == 1)
+ 732:	e9 f5 00 00 00       	jmp    82c <printf+0x2a9>
+        else
+          printint(fd, va_arg(valist, int), 16, 0);
+ 737:	8b 45 a0             	mov    -0x60(%rbp),%eax
+ 73a:	83 f8 2f             	cmp    $0x2f,%eax
+ 73d:	77 17                	ja     756 <printf+0x1d3>
+ 73f:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+ 743:	8b 55 a0             	mov    -0x60(%rbp),%edx
+ 746:	89 d2                	mov    %edx,%edx
+ 748:	48 01 d0             	add    %rdx,%rax
+ 74b:	8b 55 a0             	mov    -0x60(%rbp),%edx
+ 74e:	83 c2 08             	add    $0x8,%edx
+ 751:	89 55 a0             	mov    %edx,-0x60(%rbp)
+ 754:	eb 0c                	jmp    762 <printf+0x1df>
+ 756:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+ 75a:	48 8d 50 08          	lea    0x8(%rax),%rdx
+ 75e:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+ 762:	8b 30                	mov    (%rax),%esi
+ 764:	8b 45 9c             	mov    -0x64(%rbp),%eax
+ 767:	b9 00 00 00 00       	mov    $0x0,%ecx
+ 76c:	ba 10 00 00 00       	mov    $0x10,%edx
+ 771:	89 c7                	mov    %eax,%edi
+ 773:	e8 46 fd ff ff       	call   4be <printint>
+        if (lflag == 1)
+ 778:	e9 af 00 00 00       	jmp    82c <printf+0x2a9>
+      } else if (c == 's') {
+ 77d:	83 7d b8 73          	cmpl   $0x73,-0x48(%rbp)
+ 781:	75 6e                	jne    7f1 <printf+0x26e>
+        if ((s = (char *)va_arg(valist, char *)) == 0)
+ 783:	8b 45 a0             	mov    -0x60(%rbp),%eax
+ 786:	83 f8 2f             	cmp    $0x2f,%eax
+ 789:	77 17                	ja     7a2 <printf+0x21f>
+ 78b:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+ 78f:	8b 55 a0             	mov    -0x60(%rbp),%edx
+ 792:	89 d2                	mov    %edx,%edx
+ 794:	48 01 d0             	add    %rdx,%rax
+ 797:	8b 55 a0             	mov    -0x60(%rbp),%edx
+ 79a:	83 c2 08             	add    $0x8,%edx
+ 79d:	89 55 a0             	mov    %edx,-0x60(%rbp)
+ 7a0:	eb 0c                	jmp    7ae <printf+0x22b>
+ 7a2:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+ 7a6:	48 8d 50 08          	lea    0x8(%rax),%rdx
+ 7aa:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+ 7ae:	48 8b 00             	mov    (%rax),%rax
+ 7b1:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+ 7b5:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+ 7ba:	75 28                	jne    7e4 <printf+0x261>
+          s = "(null)";
+ 7bc:	48 8d 05 0d 07 00 00 	lea    0x70d(%rip),%rax        # ed0 <malloc+0x15f>
+ 7c3:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        for (; *s; s++)
+ 7c7:	eb 1b                	jmp    7e4 <printf+0x261>
+          putc(fd, *s);
+ 7c9:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+ 7cd:	0f b6 00             	movzbl (%rax),%eax
+ 7d0:	0f be d0             	movsbl %al,%edx
+ 7d3:	8b 45 9c             	mov    -0x64(%rbp),%eax
+ 7d6:	89 d6                	mov    %edx,%esi
+ 7d8:	89 c7                	mov    %eax,%edi
+ 7da:	e8 e2 fb ff ff       	call   3c1 <putc>
+        for (; *s; s++)
+ 7df:	48 83 45 c8 01       	addq   $0x1,-0x38(%rbp)
+ 7e4:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+ 7e8:	0f b6 00             	movzbl (%rax),%eax
+ 7eb:	84 c0                	test   %al,%al
+ 7ed:	75 da                	jne    7c9 <printf+0x246>
+ 7ef:	eb 3b                	jmp    82c <printf+0x2a9>
+      } else if (c == '%') {
+ 7f1:	83 7d b8 25          	cmpl   $0x25,-0x48(%rbp)
+ 7f5:	75 14                	jne    80b <printf+0x288>
+        putc(fd, c);
+ 7f7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+ 7fa:	0f be d0             	movsbl %al,%edx
+ 7fd:	8b 45 9c             	mov    -0x64(%rbp),%eax
+ 800:	89 d6                	mov    %edx,%esi
+ 802:	89 c7                	mov    %eax,%edi
+ 804:	e8 b8 fb ff ff       	call   3c1 <putc>
+ 809:	eb 21                	jmp    82c <printf+0x2a9>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+ 80b:	8b 45 9c             	mov    -0x64(%rbp),%eax
+ 80e:	be 25 00 00 00       	mov    $0x25,%esi
+ 813:	89 c7                	mov    %eax,%edi
+ 815:	e8 a7 fb ff ff       	call   3c1 <putc>
+        putc(fd, c);
+ 81a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+ 81d:	0f be d0             	movsbl %al,%edx
+ 820:	8b 45 9c             	mov    -0x64(%rbp),%eax
+ 823:	89 d6                	mov    %edx,%esi
+ 825:	89 c7                	mov    %eax,%edi
+ 827:	e8 95 fb ff ff       	call   3c1 <putc>
+      }
+      state = 0;
+ 82c:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%rbp)
+  for (i = 0; fmt[i]; i++) {
+ 833:	83 45 c4 01          	addl   $0x1,-0x3c(%rbp)
+ 837:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+ 83a:	48 63 d0             	movslq %eax,%rdx
+ 83d:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+ 841:	48 01 d0             	add    %rdx,%rax
+ 844:	0f b6 00             	movzbl (%rax),%eax
+ 847:	84 c0                	test   %al,%al
+ 849:	0f 85 7d fd ff ff    	jne    5cc <printf+0x49>
+    }
+  }
+
+  va_end(valist);
+}
+ 84f:	90                   	nop
+ 850:	90                   	nop
+ 851:	c9                   	leave
+ 852:	c3                   	ret
+
+0000000000000853 <stosb>:
+      break;
+    buf[i++] = c;
+    if (c == '\n' || c == '\r')
+      break;
+  }
+  buf[i] = '\0';
+ 853:	55                   	push   %rbp
+ 854:	48 89 e5             	mov    %rsp,%rbp
+ 857:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+ 85b:	89 75 f4             	mov    %esi,-0xc(%rbp)
+ 85e:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  return buf;
+ 861:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+ 865:	8b 55 f0             	mov    -0x10(%rbp),%edx
+ 868:	8b 45 f4             	mov    -0xc(%rbp),%eax
+ 86b:	48 89 ce             	mov    %rcx,%rsi
+ 86e:	48 89 f7             	mov    %rsi,%rdi
+ 871:	89 d1                	mov    %edx,%ecx
+ 873:	fc                   	cld
+ 874:	f3 aa                	rep stos %al,%es:(%rdi)
+ 876:	89 ca                	mov    %ecx,%edx
+ 878:	48 89 fe             	mov    %rdi,%rsi
+ 87b:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+ 87f:	89 55 f0             	mov    %edx,-0x10(%rbp)
+}
+
+int stat(char *n, struct stat *st) {
+  int fd;
+ 882:	90                   	nop
+ 883:	5d                   	pop    %rbp
+ 884:	c3                   	ret
+
+0000000000000885 <strcpy>:
+char *strcpy(char *s, char *t) {
+ 885:	55                   	push   %rbp
+ 886:	48 89 e5             	mov    %rsp,%rbp
+ 889:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+ 88d:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  os = s;
+ 891:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 895:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while ((*s++ = *t++) != 0)
+ 899:	90                   	nop
+ 89a:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+ 89e:	48 8d 42 01          	lea    0x1(%rdx),%rax
+ 8a2:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+ 8a6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 8aa:	48 8d 48 01          	lea    0x1(%rax),%rcx
+ 8ae:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+ 8b2:	0f b6 12             	movzbl (%rdx),%edx
+ 8b5:	88 10                	mov    %dl,(%rax)
+ 8b7:	0f b6 00             	movzbl (%rax),%eax
+ 8ba:	84 c0                	test   %al,%al
+ 8bc:	75 dc                	jne    89a <strcpy+0x15>
+  return os;
+ 8be:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+ 8c2:	5d                   	pop    %rbp
+ 8c3:	c3                   	ret
+
+00000000000008c4 <strcmp>:
+int strcmp(const char *p, const char *q) {
+ 8c4:	55                   	push   %rbp
+ 8c5:	48 89 e5             	mov    %rsp,%rbp
+ 8c8:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+ 8cc:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  while (*p && *p == *q)
+ 8d0:	eb 0a                	jmp    8dc <strcmp+0x18>
+    p++, q++;
+ 8d2:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+ 8d7:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (*p && *p == *q)
+ 8dc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 8e0:	0f b6 00             	movzbl (%rax),%eax
+ 8e3:	84 c0                	test   %al,%al
+ 8e5:	74 12                	je     8f9 <strcmp+0x35>
+ 8e7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 8eb:	0f b6 10             	movzbl (%rax),%edx
+ 8ee:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ 8f2:	0f b6 00             	movzbl (%rax),%eax
+ 8f5:	38 c2                	cmp    %al,%dl
+ 8f7:	74 d9                	je     8d2 <strcmp+0xe>
+  return (uchar)*p - (uchar)*q;
+ 8f9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 8fd:	0f b6 00             	movzbl (%rax),%eax
+ 900:	0f b6 d0             	movzbl %al,%edx
+ 903:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ 907:	0f b6 00             	movzbl (%rax),%eax
+ 90a:	0f b6 c0             	movzbl %al,%eax
+ 90d:	29 c2                	sub    %eax,%edx
+ 90f:	89 d0                	mov    %edx,%eax
+}
+ 911:	5d                   	pop    %rbp
+ 912:	c3                   	ret
+
+0000000000000913 <strlen>:
+uint strlen(char *s) {
+ 913:	55                   	push   %rbp
+ 914:	48 89 e5             	mov    %rsp,%rbp
+ 917:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  for (n = 0; s[n]; n++)
+ 91b:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+ 922:	eb 04                	jmp    928 <strlen+0x15>
+ 924:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+ 928:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 92b:	48 63 d0             	movslq %eax,%rdx
+ 92e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 932:	48 01 d0             	add    %rdx,%rax
+ 935:	0f b6 00             	movzbl (%rax),%eax
+ 938:	84 c0                	test   %al,%al
+ 93a:	75 e8                	jne    924 <strlen+0x11>
+  return n;
+ 93c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+ 93f:	5d                   	pop    %rbp
+ 940:	c3                   	ret
+
+0000000000000941 <memset>:
+void *memset(void *dst, int c, uint n) {
+ 941:	55                   	push   %rbp
+ 942:	48 89 e5             	mov    %rsp,%rbp
+ 945:	48 83 ec 10          	sub    $0x10,%rsp
+ 949:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+ 94d:	89 75 f4             	mov    %esi,-0xc(%rbp)
+ 950:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  stosb(dst, c, n);
+ 953:	8b 55 f0             	mov    -0x10(%rbp),%edx
+ 956:	8b 4d f4             	mov    -0xc(%rbp),%ecx
+ 959:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 95d:	89 ce                	mov    %ecx,%esi
+ 95f:	48 89 c7             	mov    %rax,%rdi
+ 962:	e8 ec fe ff ff       	call   853 <stosb>
+  return dst;
+ 967:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+ 96b:	c9                   	leave
+ 96c:	c3                   	ret
+
+000000000000096d <strchr>:
+char *strchr(const char *s, char c) {
+ 96d:	55                   	push   %rbp
+ 96e:	48 89 e5             	mov    %rsp,%rbp
+ 971:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+ 975:	89 f0                	mov    %esi,%eax
+ 977:	88 45 f4             	mov    %al,-0xc(%rbp)
+  for (; *s; s++)
+ 97a:	eb 17                	jmp    993 <strchr+0x26>
+    if (*s == c)
+ 97c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 980:	0f b6 00             	movzbl (%rax),%eax
+ 983:	38 45 f4             	cmp    %al,-0xc(%rbp)
+ 986:	75 06                	jne    98e <strchr+0x21>
+      return (char *)s;
+ 988:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 98c:	eb 15                	jmp    9a3 <strchr+0x36>
+  for (; *s; s++)
+ 98e:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+ 993:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 997:	0f b6 00             	movzbl (%rax),%eax
+ 99a:	84 c0                	test   %al,%al
+ 99c:	75 de                	jne    97c <strchr+0xf>
+  return 0;
+ 99e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 9a3:	5d                   	pop    %rbp
+ 9a4:	c3                   	ret
+
+00000000000009a5 <gets>:
+char *gets(char *buf, int max) {
+ 9a5:	55                   	push   %rbp
+ 9a6:	48 89 e5             	mov    %rsp,%rbp
+ 9a9:	48 83 ec 20          	sub    $0x20,%rsp
+ 9ad:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+ 9b1:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  for (i = 0; i + 1 < max;) {
+ 9b4:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+ 9bb:	eb 48                	jmp    a05 <gets+0x60>
+    cc = read(0, &c, 1);
+ 9bd:	48 8d 45 f7          	lea    -0x9(%rbp),%rax
+ 9c1:	ba 01 00 00 00       	mov    $0x1,%edx
+ 9c6:	48 89 c6             	mov    %rax,%rsi
+ 9c9:	bf 00 00 00 00       	mov    $0x0,%edi
+ 9ce:	e8 6f 01 00 00       	call   b42 <read>
+ 9d3:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    if (cc < 1)
+ 9d6:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+ 9da:	7e 36                	jle    a12 <gets+0x6d>
+    buf[i++] = c;
+ 9dc:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 9df:	8d 50 01             	lea    0x1(%rax),%edx
+ 9e2:	89 55 fc             	mov    %edx,-0x4(%rbp)
+ 9e5:	48 63 d0             	movslq %eax,%rdx
+ 9e8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 9ec:	48 01 c2             	add    %rax,%rdx
+ 9ef:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+ 9f3:	88 02                	mov    %al,(%rdx)
+    if (c == '\n' || c == '\r')
+ 9f5:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+ 9f9:	3c 0a                	cmp    $0xa,%al
+ 9fb:	74 16                	je     a13 <gets+0x6e>
+ 9fd:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+ a01:	3c 0d                	cmp    $0xd,%al
+ a03:	74 0e                	je     a13 <gets+0x6e>
+  for (i = 0; i + 1 < max;) {
+ a05:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ a08:	83 c0 01             	add    $0x1,%eax
+ a0b:	39 45 e4             	cmp    %eax,-0x1c(%rbp)
+ a0e:	7f ad                	jg     9bd <gets+0x18>
+ a10:	eb 01                	jmp    a13 <gets+0x6e>
+      break;
+ a12:	90                   	nop
+  buf[i] = '\0';
+ a13:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ a16:	48 63 d0             	movslq %eax,%rdx
+ a19:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ a1d:	48 01 d0             	add    %rdx,%rax
+ a20:	c6 00 00             	movb   $0x0,(%rax)
+  return buf;
+ a23:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+ a27:	c9                   	leave
+ a28:	c3                   	ret
+
+0000000000000a29 <stat>:
+int stat(char *n, struct stat *st) {
+ a29:	55                   	push   %rbp
+ a2a:	48 89 e5             	mov    %rsp,%rbp
+ a2d:	48 83 ec 20          	sub    $0x20,%rsp
+ a31:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+ a35:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int r;
+
+  fd = open(n, O_RDONLY);
+ a39:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ a3d:	be 00 00 00 00       	mov    $0x0,%esi
+ a42:	48 89 c7             	mov    %rax,%rdi
+ a45:	e8 20 01 00 00       	call   b6a <open>
+ a4a:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  if (fd < 0)
+ a4d:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+ a51:	79 07                	jns    a5a <stat+0x31>
+    return -1;
+ a53:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ a58:	eb 21                	jmp    a7b <stat+0x52>
+  r = fstat(fd, st);
+ a5a:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+ a5e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ a61:	48 89 d6             	mov    %rdx,%rsi
+ a64:	89 c7                	mov    %eax,%edi
+ a66:	e8 17 01 00 00       	call   b82 <fstat>
+ a6b:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  close(fd);
+ a6e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ a71:	89 c7                	mov    %eax,%edi
+ a73:	e8 da 00 00 00       	call   b52 <close>
+  return r;
+ a78:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+ a7b:	c9                   	leave
+ a7c:	c3                   	ret
+
+0000000000000a7d <atoi>:
+
+int atoi(const char *s) {
+ a7d:	55                   	push   %rbp
+ a7e:	48 89 e5             	mov    %rsp,%rbp
+ a81:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int n;
+
+  n = 0;
+ a85:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  while ('0' <= *s && *s <= '9')
+ a8c:	eb 28                	jmp    ab6 <atoi+0x39>
+    n = n * 10 + *s++ - '0';
+ a8e:	8b 55 fc             	mov    -0x4(%rbp),%edx
+ a91:	89 d0                	mov    %edx,%eax
+ a93:	c1 e0 02             	shl    $0x2,%eax
+ a96:	01 d0                	add    %edx,%eax
+ a98:	01 c0                	add    %eax,%eax
+ a9a:	89 c1                	mov    %eax,%ecx
+ a9c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ aa0:	48 8d 50 01          	lea    0x1(%rax),%rdx
+ aa4:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+ aa8:	0f b6 00             	movzbl (%rax),%eax
+ aab:	0f be c0             	movsbl %al,%eax
+ aae:	01 c8                	add    %ecx,%eax
+ ab0:	83 e8 30             	sub    $0x30,%eax
+ ab3:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while ('0' <= *s && *s <= '9')
+ ab6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ aba:	0f b6 00             	movzbl (%rax),%eax
+ abd:	3c 2f                	cmp    $0x2f,%al
+ abf:	7e 0b                	jle    acc <atoi+0x4f>
+ ac1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ ac5:	0f b6 00             	movzbl (%rax),%eax
+ ac8:	3c 39                	cmp    $0x39,%al
+ aca:	7e c2                	jle    a8e <atoi+0x11>
+  return n;
+ acc:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+ acf:	5d                   	pop    %rbp
+ ad0:	c3                   	ret
+
+0000000000000ad1 <memmove>:
+
+void *memmove(void *vdst, void *vsrc, int n) {
+ ad1:	55                   	push   %rbp
+ ad2:	48 89 e5             	mov    %rsp,%rbp
+ ad5:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+ ad9:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+ add:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  char *dst, *src;
+
+  dst = vdst;
+ ae0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ ae4:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  src = vsrc;
+ ae8:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+ aec:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  while (n-- > 0)
+ af0:	eb 1d                	jmp    b0f <memmove+0x3e>
+    *dst++ = *src++;
+ af2:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+ af6:	48 8d 42 01          	lea    0x1(%rdx),%rax
+ afa:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+ afe:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ b02:	48 8d 48 01          	lea    0x1(%rax),%rcx
+ b06:	48 89 4d f8          	mov    %rcx,-0x8(%rbp)
+ b0a:	0f b6 12             	movzbl (%rdx),%edx
+ b0d:	88 10                	mov    %dl,(%rax)
+  while (n-- > 0)
+ b0f:	8b 45 dc             	mov    -0x24(%rbp),%eax
+ b12:	8d 50 ff             	lea    -0x1(%rax),%edx
+ b15:	89 55 dc             	mov    %edx,-0x24(%rbp)
+ b18:	85 c0                	test   %eax,%eax
+ b1a:	7f d6                	jg     af2 <memmove+0x21>
+  return vdst;
+ b1c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ b20:	5d                   	pop    %rbp
+ b21:	c3                   	ret
+
+0000000000000b22 <fork>:
+  name:                                                                        \
+  movl $SYS_##name, % eax;                                                     \
+  int $TRAP_SYSCALL;                                                           \
+  ret
+
+SYSCALL(fork)
+ b22:	b8 01 00 00 00       	mov    $0x1,%eax
+ b27:	cd 40                	int    $0x40
+ b29:	c3                   	ret
+
+0000000000000b2a <exit>:
+SYSCALL(exit)
+ b2a:	b8 02 00 00 00       	mov    $0x2,%eax
+ b2f:	cd 40                	int    $0x40
+ b31:	c3                   	ret
+
+0000000000000b32 <wait>:
+SYSCALL(wait)
+ b32:	b8 03 00 00 00       	mov    $0x3,%eax
+ b37:	cd 40                	int    $0x40
+ b39:	c3                   	ret
+
+0000000000000b3a <pipe>:
+SYSCALL(pipe)
+ b3a:	b8 04 00 00 00       	mov    $0x4,%eax
+ b3f:	cd 40                	int    $0x40
+ b41:	c3                   	ret
+
+0000000000000b42 <read>:
+SYSCALL(read)
+ b42:	b8 05 00 00 00       	mov    $0x5,%eax
+ b47:	cd 40                	int    $0x40
+ b49:	c3                   	ret
+
+0000000000000b4a <write>:
+SYSCALL(write)
+ b4a:	b8 10 00 00 00       	mov    $0x10,%eax
+ b4f:	cd 40                	int    $0x40
+ b51:	c3                   	ret
+
+0000000000000b52 <close>:
+SYSCALL(close)
+ b52:	b8 15 00 00 00       	mov    $0x15,%eax
+ b57:	cd 40                	int    $0x40
+ b59:	c3                   	ret
+
+0000000000000b5a <kill>:
+SYSCALL(kill)
+ b5a:	b8 06 00 00 00       	mov    $0x6,%eax
+ b5f:	cd 40                	int    $0x40
+ b61:	c3                   	ret
+
+0000000000000b62 <exec>:
+SYSCALL(exec)
+ b62:	b8 07 00 00 00       	mov    $0x7,%eax
+ b67:	cd 40                	int    $0x40
+ b69:	c3                   	ret
+
+0000000000000b6a <open>:
+SYSCALL(open)
+ b6a:	b8 0f 00 00 00       	mov    $0xf,%eax
+ b6f:	cd 40                	int    $0x40
+ b71:	c3                   	ret
+
+0000000000000b72 <mknod>:
+SYSCALL(mknod)
+ b72:	b8 11 00 00 00       	mov    $0x11,%eax
+ b77:	cd 40                	int    $0x40
+ b79:	c3                   	ret
+
+0000000000000b7a <unlink>:
+SYSCALL(unlink)
+ b7a:	b8 12 00 00 00       	mov    $0x12,%eax
+ b7f:	cd 40                	int    $0x40
+ b81:	c3                   	ret
+
+0000000000000b82 <fstat>:
+SYSCALL(fstat)
+ b82:	b8 08 00 00 00       	mov    $0x8,%eax
+ b87:	cd 40                	int    $0x40
+ b89:	c3                   	ret
+
+0000000000000b8a <link>:
+SYSCALL(link)
+ b8a:	b8 13 00 00 00       	mov    $0x13,%eax
+ b8f:	cd 40                	int    $0x40
+ b91:	c3                   	ret
+
+0000000000000b92 <mkdir>:
+SYSCALL(mkdir)
+ b92:	b8 14 00 00 00       	mov    $0x14,%eax
+ b97:	cd 40                	int    $0x40
+ b99:	c3                   	ret
+
+0000000000000b9a <chdir>:
+SYSCALL(chdir)
+ b9a:	b8 09 00 00 00       	mov    $0x9,%eax
+ b9f:	cd 40                	int    $0x40
+ ba1:	c3                   	ret
+
+0000000000000ba2 <dup>:
+SYSCALL(dup)
+ ba2:	b8 0a 00 00 00       	mov    $0xa,%eax
+ ba7:	cd 40                	int    $0x40
+ ba9:	c3                   	ret
+
+0000000000000baa <getpid>:
+SYSCALL(getpid)
+ baa:	b8 0b 00 00 00       	mov    $0xb,%eax
+ baf:	cd 40                	int    $0x40
+ bb1:	c3                   	ret
+
+0000000000000bb2 <sbrk>:
+SYSCALL(sbrk)
+ bb2:	b8 0c 00 00 00       	mov    $0xc,%eax
+ bb7:	cd 40                	int    $0x40
+ bb9:	c3                   	ret
+
+0000000000000bba <sleep>:
+SYSCALL(sleep)
+ bba:	b8 0d 00 00 00       	mov    $0xd,%eax
+ bbf:	cd 40                	int    $0x40
+ bc1:	c3                   	ret
+
+0000000000000bc2 <uptime>:
+SYSCALL(uptime)
+ bc2:	b8 0e 00 00 00       	mov    $0xe,%eax
+ bc7:	cd 40                	int    $0x40
+ bc9:	c3                   	ret
+
+0000000000000bca <sysinfo>:
+SYSCALL(sysinfo)
+ bca:	b8 16 00 00 00       	mov    $0x16,%eax
+ bcf:	cd 40                	int    $0x40
+ bd1:	c3                   	ret
+
+0000000000000bd2 <crashn>:
+SYSCALL(crashn)
+ bd2:	b8 17 00 00 00       	mov    $0x17,%eax
+ bd7:	cd 40                	int    $0x40
+ bd9:	c3                   	ret
+
+0000000000000bda <sync>:
+SYSCALL(sync)
+ bda:	b8 18 00 00 00       	mov    $0x18,%eax
+ bdf:	cd 40                	int    $0x40
+ be1:	c3                   	ret
+
+0000000000000be2 <fsync>:
+SYSCALL(fsync)
+ be2:	b8 19 00 00 00       	mov    $0x19,%eax
+ be7:	cd 40                	int    $0x40
+ be9:	c3                   	ret
+
+0000000000000bea <free>:
+typedef union header Header;
+
+static Header base;
+static Header *freep;
+
+void free(void *ap) {
+ bea:	55                   	push   %rbp
+ beb:	48 89 e5             	mov    %rsp,%rbp
+ bee:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  Header *bp, *p;
+
+  bp = (Header *)ap - 1;
+ bf2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ bf6:	48 83 e8 10          	sub    $0x10,%rax
+ bfa:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  for (p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ bfe:	48 8b 05 db 05 00 00 	mov    0x5db(%rip),%rax        # 11e0 <freep>
+ c05:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+ c09:	eb 2f                	jmp    c3a <free+0x50>
+    if (p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ c0b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ c0f:	48 8b 00             	mov    (%rax),%rax
+ c12:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+ c16:	72 17                	jb     c2f <free+0x45>
+ c18:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ c1c:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+ c20:	72 2f                	jb     c51 <free+0x67>
+ c22:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ c26:	48 8b 00             	mov    (%rax),%rax
+ c29:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+ c2d:	72 22                	jb     c51 <free+0x67>
+  for (p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ c2f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ c33:	48 8b 00             	mov    (%rax),%rax
+ c36:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+ c3a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ c3e:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+ c42:	73 c7                	jae    c0b <free+0x21>
+ c44:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ c48:	48 8b 00             	mov    (%rax),%rax
+ c4b:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+ c4f:	73 ba                	jae    c0b <free+0x21>
+      break;
+  if (bp + bp->s.size == p->s.ptr) {
+ c51:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ c55:	8b 40 08             	mov    0x8(%rax),%eax
+ c58:	89 c0                	mov    %eax,%eax
+ c5a:	48 c1 e0 04          	shl    $0x4,%rax
+ c5e:	48 89 c2             	mov    %rax,%rdx
+ c61:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ c65:	48 01 c2             	add    %rax,%rdx
+ c68:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ c6c:	48 8b 00             	mov    (%rax),%rax
+ c6f:	48 39 c2             	cmp    %rax,%rdx
+ c72:	75 2d                	jne    ca1 <free+0xb7>
+    bp->s.size += p->s.ptr->s.size;
+ c74:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ c78:	8b 50 08             	mov    0x8(%rax),%edx
+ c7b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ c7f:	48 8b 00             	mov    (%rax),%rax
+ c82:	8b 40 08             	mov    0x8(%rax),%eax
+ c85:	01 c2                	add    %eax,%edx
+ c87:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ c8b:	89 50 08             	mov    %edx,0x8(%rax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ c8e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ c92:	48 8b 00             	mov    (%rax),%rax
+ c95:	48 8b 10             	mov    (%rax),%rdx
+ c98:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ c9c:	48 89 10             	mov    %rdx,(%rax)
+ c9f:	eb 0e                	jmp    caf <free+0xc5>
+  } else
+    bp->s.ptr = p->s.ptr;
+ ca1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ ca5:	48 8b 10             	mov    (%rax),%rdx
+ ca8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ cac:	48 89 10             	mov    %rdx,(%rax)
+  if (p + p->s.size == bp) {
+ caf:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ cb3:	8b 40 08             	mov    0x8(%rax),%eax
+ cb6:	89 c0                	mov    %eax,%eax
+ cb8:	48 c1 e0 04          	shl    $0x4,%rax
+ cbc:	48 89 c2             	mov    %rax,%rdx
+ cbf:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ cc3:	48 01 d0             	add    %rdx,%rax
+ cc6:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+ cca:	75 27                	jne    cf3 <free+0x109>
+    p->s.size += bp->s.size;
+ ccc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ cd0:	8b 50 08             	mov    0x8(%rax),%edx
+ cd3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ cd7:	8b 40 08             	mov    0x8(%rax),%eax
+ cda:	01 c2                	add    %eax,%edx
+ cdc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ ce0:	89 50 08             	mov    %edx,0x8(%rax)
+    p->s.ptr = bp->s.ptr;
+ ce3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ ce7:	48 8b 10             	mov    (%rax),%rdx
+ cea:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ cee:	48 89 10             	mov    %rdx,(%rax)
+ cf1:	eb 0b                	jmp    cfe <free+0x114>
+  } else
+    p->s.ptr = bp;
+ cf3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ cf7:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+ cfb:	48 89 10             	mov    %rdx,(%rax)
+  freep = p;
+ cfe:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ d02:	48 89 05 d7 04 00 00 	mov    %rax,0x4d7(%rip)        # 11e0 <freep>
+}
+ d09:	90                   	nop
+ d0a:	5d                   	pop    %rbp
+ d0b:	c3                   	ret
+
+0000000000000d0c <morecore>:
+
+static Header *morecore(uint nu) {
+ d0c:	55                   	push   %rbp
+ d0d:	48 89 e5             	mov    %rsp,%rbp
+ d10:	48 83 ec 20          	sub    $0x20,%rsp
+ d14:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  char *p;
+  Header *hp;
+
+  if (nu < 4096)
+ d17:	81 7d ec ff 0f 00 00 	cmpl   $0xfff,-0x14(%rbp)
+ d1e:	77 07                	ja     d27 <morecore+0x1b>
+    nu = 4096;
+ d20:	c7 45 ec 00 10 00 00 	movl   $0x1000,-0x14(%rbp)
+  p = sbrk(nu * sizeof(Header));
+ d27:	8b 45 ec             	mov    -0x14(%rbp),%eax
+ d2a:	c1 e0 04             	shl    $0x4,%eax
+ d2d:	89 c7                	mov    %eax,%edi
+ d2f:	e8 7e fe ff ff       	call   bb2 <sbrk>
+ d34:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (p == (char *)-1)
+ d38:	48 83 7d f8 ff       	cmpq   $0xffffffffffffffff,-0x8(%rbp)
+ d3d:	75 07                	jne    d46 <morecore+0x3a>
+    return 0;
+ d3f:	b8 00 00 00 00       	mov    $0x0,%eax
+ d44:	eb 29                	jmp    d6f <morecore+0x63>
+  hp = (Header *)p;
+ d46:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ d4a:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  hp->s.size = nu;
+ d4e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ d52:	8b 55 ec             	mov    -0x14(%rbp),%edx
+ d55:	89 50 08             	mov    %edx,0x8(%rax)
+  free((void *)(hp + 1));
+ d58:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ d5c:	48 83 c0 10          	add    $0x10,%rax
+ d60:	48 89 c7             	mov    %rax,%rdi
+ d63:	e8 82 fe ff ff       	call   bea <free>
+  return freep;
+ d68:	48 8b 05 71 04 00 00 	mov    0x471(%rip),%rax        # 11e0 <freep>
+}
+ d6f:	c9                   	leave
+ d70:	c3                   	ret
+
+0000000000000d71 <malloc>:
+
+void *malloc(uint nbytes) {
+ d71:	55                   	push   %rbp
+ d72:	48 89 e5             	mov    %rsp,%rbp
+ d75:	48 83 ec 30          	sub    $0x30,%rsp
+ d79:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1) / sizeof(Header) + 1;
+ d7c:	8b 45 dc             	mov    -0x24(%rbp),%eax
+ d7f:	48 83 c0 0f          	add    $0xf,%rax
+ d83:	48 c1 e8 04          	shr    $0x4,%rax
+ d87:	83 c0 01             	add    $0x1,%eax
+ d8a:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  if ((prevp = freep) == 0) {
+ d8d:	48 8b 05 4c 04 00 00 	mov    0x44c(%rip),%rax        # 11e0 <freep>
+ d94:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+ d98:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+ d9d:	75 2e                	jne    dcd <malloc+0x5c>
+    base.s.ptr = freep = prevp = &base;
+ d9f:	48 8d 05 2a 04 00 00 	lea    0x42a(%rip),%rax        # 11d0 <base>
+ da6:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+ daa:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ dae:	48 89 05 2b 04 00 00 	mov    %rax,0x42b(%rip)        # 11e0 <freep>
+ db5:	48 8b 05 24 04 00 00 	mov    0x424(%rip),%rax        # 11e0 <freep>
+ dbc:	48 89 05 0d 04 00 00 	mov    %rax,0x40d(%rip)        # 11d0 <base>
+    base.s.size = 0;
+ dc3:	c7 05 0b 04 00 00 00 	movl   $0x0,0x40b(%rip)        # 11d8 <base+0x8>
+ dca:	00 00 00 
+  }
+  for (p = prevp->s.ptr;; prevp = p, p = p->s.ptr) {
+ dcd:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ dd1:	48 8b 00             	mov    (%rax),%rax
+ dd4:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    if (p->s.size >= nunits) {
+ dd8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ ddc:	8b 40 08             	mov    0x8(%rax),%eax
+ ddf:	3b 45 ec             	cmp    -0x14(%rbp),%eax
+ de2:	72 5f                	jb     e43 <malloc+0xd2>
+      if (p->s.size == nunits)
+ de4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ de8:	8b 40 08             	mov    0x8(%rax),%eax
+ deb:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+ dee:	75 10                	jne    e00 <malloc+0x8f>
+        prevp->s.ptr = p->s.ptr;
+ df0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ df4:	48 8b 10             	mov    (%rax),%rdx
+ df7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ dfb:	48 89 10             	mov    %rdx,(%rax)
+ dfe:	eb 2e                	jmp    e2e <malloc+0xbd>
+      else {
+        p->s.size -= nunits;
+ e00:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ e04:	8b 40 08             	mov    0x8(%rax),%eax
+ e07:	2b 45 ec             	sub    -0x14(%rbp),%eax
+ e0a:	89 c2                	mov    %eax,%edx
+ e0c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ e10:	89 50 08             	mov    %edx,0x8(%rax)
+        p += p->s.size;
+ e13:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ e17:	8b 40 08             	mov    0x8(%rax),%eax
+ e1a:	89 c0                	mov    %eax,%eax
+ e1c:	48 c1 e0 04          	shl    $0x4,%rax
+ e20:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+        p->s.size = nunits;
+ e24:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ e28:	8b 55 ec             	mov    -0x14(%rbp),%edx
+ e2b:	89 50 08             	mov    %edx,0x8(%rax)
+      }
+      freep = prevp;
+ e2e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ e32:	48 89 05 a7 03 00 00 	mov    %rax,0x3a7(%rip)        # 11e0 <freep>
+      return (void *)(p + 1);
+ e39:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ e3d:	48 83 c0 10          	add    $0x10,%rax
+ e41:	eb 41                	jmp    e84 <malloc+0x113>
+    }
+    if (p == freep)
+ e43:	48 8b 05 96 03 00 00 	mov    0x396(%rip),%rax        # 11e0 <freep>
+ e4a:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+ e4e:	75 1c                	jne    e6c <malloc+0xfb>
+      if ((p = morecore(nunits)) == 0)
+ e50:	8b 45 ec             	mov    -0x14(%rbp),%eax
+ e53:	89 c7                	mov    %eax,%edi
+ e55:	e8 b2 fe ff ff       	call   d0c <morecore>
+ e5a:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+ e5e:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+ e63:	75 07                	jne    e6c <malloc+0xfb>
+        return 0;
+ e65:	b8 00 00 00 00       	mov    $0x0,%eax
+ e6a:	eb 18                	jmp    e84 <malloc+0x113>
+  for (p = prevp->s.ptr;; prevp = p, p = p->s.ptr) {
+ e6c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ e70:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+ e74:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ e78:	48 8b 00             	mov    (%rax),%rax
+ e7b:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    if (p->s.size >= nunits) {
+ e7f:	e9 54 ff ff ff       	jmp    dd8 <malloc+0x67>
+  }
+ e84:	c9                   	leave
+ e85:	c3                   	ret
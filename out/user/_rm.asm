@@ -0,0 +1,1309 @@
+
+out/user/_rm:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000000000 <main>:
+#include <cdefs.h>
+#include <stat.h>
+#include <user.h>
+
+int main(int argc, char *argv[]) {
+   0:	55                   	push   %rbp
+   1:	48 89 e5             	mov    %rsp,%rbp
+   4:	48 83 ec 20          	sub    $0x20,%rsp
+   8:	89 7d ec             	mov    %edi,-0x14(%rbp)
+   b:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int i;
+
+  if (argc < 2) {
+   f:	83 7d ec 01          	cmpl   $0x1,-0x14(%rbp)
+  13:	7f 1e                	jg     33 <main+0x33>
+    printf(2, "Usage: rm files...\n");
+  15:	48 8d 05 4e 0b 00 00 	lea    0xb4e(%rip),%rax        # b6a <malloc+0x115>
+  1c:	48 89 c6             	mov    %rax,%rsi
+  1f:	bf 02 00 00 00       	mov    $0x2,%edi
+  24:	b8 00 00 00 00       	mov    $0x0,%eax
+  29:	e8 39 02 00 00       	call   267 <printf>
+    exit();
+  2e:	e8 db 07 00 00       	call   80e <exit>
+  }
+
+  for (i = 1; i < argc; i++) {
+  33:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+  3a:	eb 5c                	jmp    98 <main+0x98>
+    if (unlink(argv[i]) < 0) {
+  3c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  3f:	48 98                	cltq
+  41:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  48:	00 
+  49:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  4d:	48 01 d0             	add    %rdx,%rax
+  50:	48 8b 00             	mov    (%rax),%rax
+  53:	48 89 c7             	mov    %rax,%rdi
+  56:	e8 03 08 00 00       	call   85e <unlink>
+  5b:	85 c0                	test   %eax,%eax
+  5d:	79 35                	jns    94 <main+0x94>
+      printf(2, "rm: %s failed to delete\n", argv[i]);
+  5f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  62:	48 98                	cltq
+  64:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  6b:	00 
+  6c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  70:	48 01 d0             	add    %rdx,%rax
+  73:	48 8b 00             	mov    (%rax),%rax
+  76:	48 89 c2             	mov    %rax,%rdx
+  79:	48 8d 05 fe 0a 00 00 	lea    0xafe(%rip),%rax        # b7e <malloc+0x129>
+  80:	48 89 c6             	mov    %rax,%rsi
+  83:	bf 02 00 00 00       	mov    $0x2,%edi
+  88:	b8 00 00 00 00       	mov    $0x0,%eax
+  8d:	e8 d5 01 00 00       	call   267 <printf>
+      break;
+  92:	eb 0c                	jmp    a0 <main+0xa0>
+  for (i = 1; i < argc; i++) {
+  94:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  98:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  9b:	3b 45 ec             	cmp    -0x14(%rbp),%eax
+  9e:	7c 9c                	jl     3c <main+0x3c>
+    }
+  }
+
+  exit();
+  a0:	e8 69 07 00 00       	call   80e <exit>
+
+00000000000000a5 <putc>:
+#include <cdefs.h>
+#include <stat.h>
+#include <stdarg.h>
+#include <user.h>
+
+static void putc(int fd, char c) { write(fd, &c, 1); }
+  a5:	55                   	push   %rbp
+  a6:	48 89 e5             	mov    %rsp,%rbp
+  a9:	48 83 ec 10          	sub    $0x10,%rsp
+  ad:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  b0:	89 f0                	mov    %esi,%eax
+  b2:	88 45 f8             	mov    %al,-0x8(%rbp)
+  b5:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+  b9:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  bc:	ba 01 00 00 00       	mov    $0x1,%edx
+  c1:	48 89 ce             	mov    %rcx,%rsi
+  c4:	89 c7                	mov    %eax,%edi
+  c6:	e8 63 07 00 00       	call   82e <write>
+  cb:	90                   	nop
+  cc:	c9                   	leave
+  cd:	c3                   	ret
+
+00000000000000ce <printint64>:
+
+static void printint64(int fd, int xx, int base, int sgn) {
+  ce:	55                   	push   %rbp
+  cf:	48 89 e5             	mov    %rsp,%rbp
+  d2:	48 83 ec 40          	sub    $0x40,%rsp
+  d6:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  d9:	89 75 c8             	mov    %esi,-0x38(%rbp)
+  dc:	89 55 c4             	mov    %edx,-0x3c(%rbp)
+  df:	89 4d c0             	mov    %ecx,-0x40(%rbp)
+  static char digits[] = "0123456789abcdef";
+  char buf[32];
+  int i;
+  uint64_t x;
+
+  if (sgn && (sgn = xx < 0))
+  e2:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+  e6:	74 1f                	je     107 <printint64+0x39>
+  e8:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  eb:	c1 e8 1f             	shr    $0x1f,%eax
+  ee:	0f b6 c0             	movzbl %al,%eax
+  f1:	89 45 c0             	mov    %eax,-0x40(%rbp)
+  f4:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+  f8:	74 0d                	je     107 <printint64+0x39>
+    x = -xx;
+  fa:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  fd:	f7 d8                	neg    %eax
+  ff:	48 98                	cltq
+ 101:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+ 105:	eb 09                	jmp    110 <printint64+0x42>
+  else
+    x = xx;
+ 107:	8b 45 c8             	mov    -0x38(%rbp),%eax
+ 10a:	48 98                	cltq
+ 10c:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+  i = 0;
+ 110:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  do {
+    buf[i++] = digits[x % base];
+ 117:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+ 11a:	48 63 c8             	movslq %eax,%rcx
+ 11d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ 121:	ba 00 00 00 00       	mov    $0x0,%edx
+ 126:	48 f7 f1             	div    %rcx
+ 129:	48 89 d1             	mov    %rdx,%rcx
+ 12c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 12f:	8d 50 01             	lea    0x1(%rax),%edx
+ 132:	89 55 fc             	mov    %edx,-0x4(%rbp)
+ 135:	48 8d 15 c4 0c 00 00 	lea    0xcc4(%rip),%rdx        # e00 <digits.1>
+ 13c:	0f b6 14 11          	movzbl (%rcx,%rdx,1),%edx
+ 140:	48 98                	cltq
+ 142:	88 54 05 d0          	mov    %dl,-0x30(%rbp,%rax,1)
+  } while ((x /= base) != 0);
+ 146:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+ 149:	48 63 f0             	movslq %eax,%rsi
+ 14c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ 150:	ba 00 00 00 00       	mov    $0x0,%edx
+ 155:	48 f7 f6             	div    %rsi
+ 158:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+ 15c:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+ 161:	75 b4                	jne    117 <printint64+0x49>
+
+  if (sgn)
+ 163:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+ 167:	74 2b                	je     194 <printint64+0xc6>
+    buf[i++] = '-';
+ 169:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 16c:	8d 50 01             	lea    0x1(%rax),%edx
+ 16f:	89 55 fc             	mov    %edx,-0x4(%rbp)
+ 172:	48 98                	cltq
+ 174:	c6 44 05 d0 2d       	movb   $0x2d,-0x30(%rbp,%rax,1)
+
+  while (--i >= 0)
+ 179:	eb 19                	jmp    194 <printint64+0xc6>
+    putc(fd, buf[i]);
+ 17b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 17e:	48 98                	cltq
+ 180:	0f b6 44 05 d0       	movzbl -0x30(%rbp,%rax,1),%eax
+ 185:	0f be d0             	movsbl %al,%edx
+ 188:	8b 45 cc             	mov    -0x34(%rbp),%eax
+ 18b:	89 d6                	mov    %edx,%esi
+ 18d:	89 c7                	mov    %eax,%edi
+ 18f:	e8 11 ff ff ff       	call   a5 <putc>
+  while (--i >= 0)
+ 194:	83 6d fc 01          	subl   $0x1,-0x4(%rbp)
+ 198:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+ 19c:	79 dd                	jns    17b <printint64+0xad>
+}
+ 19e:	90                   	nop
+ 19f:	90                   	nop
+ 1a0:	c9                   	leave
+ 1a1:	c3                   	ret
+
+00000000000001a2 <printint>:
+
+static void printint(int fd, int xx, int base, int sgn) {
+ 1a2:	55                   	push   %rbp
+ 1a3:	48 89 e5             	mov    %rsp,%rbp
+ 1a6:	48 83 ec 30          	sub    $0x30,%rsp
+ 1aa:	89 7d dc             	mov    %edi,-0x24(%rbp)
+ 1ad:	89 75 d8             	mov    %esi,-0x28(%rbp)
+ 1b0:	89 55 d4             	mov    %edx,-0x2c(%rbp)
+ 1b3:	89 4d d0             	mov    %ecx,-0x30(%rbp)
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+ 1b6:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+  if (sgn && xx < 0) {
+ 1bd:	83 7d d0 00          	cmpl   $0x0,-0x30(%rbp)
+ 1c1:	74 17                	je     1da <printint+0x38>
+ 1c3:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+ 1c7:	79 11                	jns    1da <printint+0x38>
+    neg = 1;
+ 1c9:	c7 45 f8 01 00 00 00 	movl   $0x1,-0x8(%rbp)
+    x = -xx;
+ 1d0:	8b 45 d8             	mov    -0x28(%rbp),%eax
+ 1d3:	f7 d8                	neg    %eax
+ 1d5:	89 45 f4             	mov    %eax,-0xc(%rbp)
+ 1d8:	eb 06                	jmp    1e0 <printint+0x3e>
+  } else {
+    x = xx;
+ 1da:	8b 45 d8             	mov    -0x28(%rbp),%eax
+ 1dd:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  }
+
+  i = 0;
+ 1e0:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  do {
+    buf[i++] = digits[x % base];
+ 1e7:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+ 1ea:	8b 45 f4             	mov    -0xc(%rbp),%eax
+ 1ed:	ba 00 00 00 00       	mov    $0x0,%edx
+ 1f2:	f7 f1                	div    %ecx
+ 1f4:	89 d1                	mov    %edx,%ecx
+ 1f6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 1f9:	8d 50 01             	lea    0x1(%rax),%edx
+ 1fc:	89 55 fc             	mov    %edx,-0x4(%rbp)
+ 1ff:	89 c9                	mov    %ecx,%ecx
+ 201:	48 8d 15 18 0c 00 00 	lea    0xc18(%rip),%rdx        # e20 <digits.0>
+ 208:	0f b6 14 11          	movzbl (%rcx,%rdx,1),%edx
+ 20c:	48 98                	cltq
+ 20e:	88 54 05 e4          	mov    %dl,-0x1c(%rbp,%rax,1)
+  } while ((x /= base) != 0);
+ 212:	8b 75 d4             	mov    -0x2c(%rbp),%esi
+ 215:	8b 45 f4             	mov    -0xc(%rbp),%eax
+ 218:	ba 00 00 00 00       	mov    $0x0,%edx
+ 21d:	f7 f6                	div    %esi
+ 21f:	89 45 f4             	mov    %eax,-0xc(%rbp)
+ 222:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+ 226:	75 bf                	jne    1e7 <printint+0x45>
+  if (neg)
+ 228:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+ 22c:	74 2b                	je     259 <printint+0xb7>
+    buf[i++] = '-';
+ 22e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 231:	8d 50 01             	lea    0x1(%rax),%edx
+ 234:	89 55 fc             	mov    %edx,-0x4(%rbp)
+ 237:	48 98                	cltq
+ 239:	c6 44 05 e4 2d       	movb   $0x2d,-0x1c(%rbp,%rax,1)
+
+  while (--i >= 0)
+ 23e:	eb 19                	jmp    259 <printint+0xb7>
+    putc(fd, buf[i]);
+ 240:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 243:	48 98                	cltq
+ 245:	0f b6 44 05 e4       	movzbl -0x1c(%rbp,%rax,1),%eax
+ 24a:	0f be d0             	movsbl %al,%edx
+ 24d:	8b 45 dc             	mov    -0x24(%rbp),%eax
+ 250:	89 d6                	mov    %edx,%esi
+ 252:	89 c7                	mov    %eax,%edi
+ 254:	e8 4c fe ff ff       	call   a5 <putc>
+  while (--i >= 0)
+ 259:	83 6d fc 01          	subl   $0x1,-0x4(%rbp)
+ 25d:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+ 261:	79 dd                	jns    240 <printint+0x9e>
+}
+ 263:	90                   	nop
+ 264:	90                   	nop
+ 265:	c9                   	leave
+ 266:	c3                   	ret
+
+0000000000000267 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void printf(int fd, char *fmt, ...) {
+ 267:	55                   	push   %rbp
+ 268:	48 89 e5             	mov    %rsp,%rbp
+ 26b:	48 83 ec 70          	sub    $0x70,%rsp
+ 26f:	89 7d 9c             	mov    %edi,-0x64(%rbp)
+ 272:	48 89 75 90          	mov    %rsi,-0x70(%rbp)
+ 276:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+ 27a:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+ 27e:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+ 282:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+  char *s;
+  int c, i, state;
+  int lflag;
+  va_list valist;
+  va_start(valist, fmt);
+ 286:	c7 45 a0 10 00 00 00 	movl   $0x10,-0x60(%rbp)
+ 28d:	48 8d 45 10          	lea    0x10(%rbp),%rax
+ 291:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+ 295:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+ 299:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+
+  state = 0;
+ 29d:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%rbp)
+  for (i = 0; fmt[i]; i++) {
+ 2a4:	c7 45 c4 00 00 00 00 	movl   $0x0,-0x3c(%rbp)
+ 2ab:	e9 6b 02 00 00       	jmp    51b <printf+0x2b4>
+    c = fmt[i] & 0xff;
+ 2b0:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+ 2b3:	48 63 d0             	movslq %eax,%rdx
+ 2b6:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+ 2ba:	48 01 d0             	add    %rdx,%rax
+ 2bd:	0f b6 00             	movzbl (%rax),%eax
+ 2c0:	0f be c0             	movsbl %al,%eax
+ 2c3:	25 ff 00 00 00       	and    $0xff,%eax
+ 2c8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+    if (state == 0) {
+ 2cb:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+ 2cf:	75 30                	jne    301 <printf+0x9a>
+      if (c == '%') {
+ 2d1:	83 7d b8 25          	cmpl   $0x25,-0x48(%rbp)
+ 2d5:	75 13                	jne    2ea <printf+0x83>
+        state = '%';
+ 2d7:	c7 45 c0 25 00 00 00 	movl   $0x25,-0x40(%rbp)
+        lflag = 0;
+ 2de:	c7 45 bc 00 00 00 00 	movl   $0x0,-0x44(%rbp)
+ 2e5:	e9 2d 02 00 00       	jmp    517 <printf+0x2b0>
+      } else {
+        putc(fd, c);
+ 2ea:	8b 45 b8             	mov    -0x48(%rbp),%eax
+ 2ed:	0f be d0             	movsbl %al,%edx
+ 2f0:	8b 45 9c             	mov    -0x64(%rbp),%eax
+ 2f3:	89 d6                	mov    %edx,%esi
+ 2f5:	89 c7                	mov    %eax,%edi
+ 2f7:	e8 a9 fd ff ff       	call   a5 <putc>
+ 2fc:	e9 16 02 00 00       	jmp    517 <printf+0x2b0>
+      }
+    } else if (state == '%') {
+ 301:	83 7d c0 25          	cmpl   $0x25,-0x40(%rbp)
+ 305:	0f 85 0c 02 00 00    	jne    517 <printf+0x2b0>
+      if (c == 'l') {
+ 30b:	83 7d b8 6c          	cmpl   $0x6c,-0x48(%rbp)
+ 30f:	75 0c                	jne    31d <printf+0xb6>
+        lflag = 1;
+ 311:	c7 45 bc 01 00 00 00 	movl   $0x1,-0x44(%rbp)
+        continue;
+ 318:	e9 fa 01 00 00       	jmp    517 <printf+0x2b0>
+      } else if (c == 'd') {
+ 31d:	83 7d b8 64          	cmpl   $0x64,-0x48(%rbp)
+ 321:	0f 85 95 00 00 00    	jne    3bc <printf+0x155>
+        if (lflag == 1)
+ 327:	83 7d bc 01          	cmpl   $0x1,-0x44(%rbp)
+ 32b:	75 49                	jne    376 <printf+0x10f>
+          printint64(fd, va_arg(valist, int64_t), 10, 1);
+ 32d:	8b 45 a0             	mov    -0x60(%rbp),%eax
+ 330:	83 f8 2f             	cmp    $0x2f,%eax
+ 333:	77 17                	ja     34c <printf+0xe5>
+ 335:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+ 339:	8b 55 a0             	mov    -0x60(%rbp),%edx
+ 33c:	89 d2                	mov    %edx,%edx
+ 33e:	48 01 d0             	add    %rdx,%rax
+ 341:	8b 55 a0             	mov    -0x60(%rbp),%edx
+ 344:	83 c2 08             	add    $0x8,%edx
+ 347:	89 55 a0             	mov    %edx,-0x60(%rbp)
+ 34a:	eb 0c                	jmp    358 <printf+0xf1>
+ 34c:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+ 350:	48 8d 50 08          	lea    0x8(%rax),%rdx
+ 354:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+ 358:	48 8b 00             	mov    (%rax),%rax
+ 35b:	89 c6                	mov    %eax,%esi
+ 35d:	8b 45 9c             	mov    -0x64(%rbp),%eax
+ 360:	b9 01 00 00 00       	mov    $0x1,%ecx
+ 365:	ba 0a 00 00 00       	mov    $0xa,%edx
+ 36a:	89 c7                	mov    %eax,%edi
+ 36c:	e8 5d fd ff ff       	call   ce <printint64>
+ 371:	e9 9a 01 00 00       	jmp    510 <printf+0x2a9>
+        else
+          printint(fd, va_arg(valist, int), 10, 1);
+ 376:	8b 45 a0             	mov    -0x60(%rbp),%eax
+ 379:	83 f8 2f             	cmp    $0x2f,%eax
+ 37c:	77 17                	ja     395 <printf+0x12e>
+ 37e:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+ 382:	8b 55 a0             	mov    -0x60(%rbp),%edx
+ 385:	89 d2                	mov    %edx,%edx
+ 387:	48 01 d0             	add    %rdx,%rax
+ 38a:	8b 55 a0             	mov    -0x60(%rbp),%edx
+ 38d:	83 c2 08             	add    $0x8,%edx
+ 390:	89 55 a0             	mov    %edx,-0x60(%rbp)
+ 393:	eb 0c                	jmp    3a1 <printf+0x13a>
+ 395:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+ 399:	48 8d 50 08          	lea    0x8(%rax),%rdx
+ 39d:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+ 3a1:	8b 30                	mov    (%rax),%esi
+ 3a3:	8b 45 9c             	mov    -0x64(%rbp),%eax
+ 3a6:	b9 01 00 00 00       	mov    $0x1,%ecx
+ 3ab:	ba 0a 00 00 00       	mov    $0xa,%edx
+ 3b0:	89 c7                	mov    %eax,%edi
+ 3b2:	e8 eb fd ff ff       	call   1a2 <printint>
+ 3b7:	e9 54 01 00 00       	jmp    510 <printf+0x2a9>
+      } else if (c == 'x' || c == 'p') {
+ 3bc:	83 7d b8 78          	cmpl   $0x78,-0x48(%rbp)
+ 3c0:	74 0a                	je     3cc <printf+0x165>
+ 3c2:	83 7d b8 70          	cmpl   $0x70,-0x48(%rbp)
+ 3c6:	0f 85 95 00 00 00    	jne    461 <printf+0x1fa>
+        if (lflag == 1)
+ 3cc:	83 7d bc 01          	cmpl   $0x1,-0x44(%rbp)
+ 3d0:	75 49                	jne    41b <printf+0x1b4>
+          printint64(fd, va_arg(valist, int64_t), 16, 0);
+ 3d2:	8b 45 a0             	mov    -0x60(%rbp),%eax
+ 3d5:	83 f8 2f             	cmp    $0x2f,%eax
+ 3d8:	77 17                	ja     3f1 <printf+0x18a>
+ 3da:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+ 3de:	8b 55 a0             	mov    -0x60(%rbp),%edx
+ 3e1:	89 d2                	mov    %edx,%edx
+ 3e3:	48 01 d0             	add    %rdx,%rax
+ 3e6:	8b 55 a0             	mov    -0x60(%rbp),%edx
+ 3e9:	83 c2 08             	add    $0x8,%edx
+ 3ec:	89 55 a0             	mov    %edx,-0x60(%rbp)
+ 3ef:	eb 0c                	jmp    3fd <printf+0x196>
+ 3f1:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+ 3f5:	48 8d 50 08          	lea    0x8(%rax),%rdx
+ 3f9:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+ 3fd:	48 8b 00             	mov    (%rax),%rax
+ 400:	89 c6                	mov    %eax,%esi
+ 402:	8b 45 9c             	mov    -0x64(%rbp),%eax
+ 405:	b9 00 00 00 00       	mov    $0x0,%ecx
+ 40a:	ba 10 00 00 00       	mov    $0x10,%edx
+ 40f:	89 c7                	mov    %eax,%edi
+ 411:	e8 b8 fc ff ff       	call   ce <printint64>
+        if (lflag == 1)
+ 416:	e9 f5 00 00 00       	jmp    510 <printf+0x2a9>
+        else
+          printint(fd, va_arg(valist, int), 16, 0);
+ 41b:	8b 45 a0             	mov    -0x60(%rbp),%eax
+ 41e:	83 f8 2f             	cmp    $0x2f,%eax
+ 421:	77 17                	ja     43a <printf+0x1d3>
+ 423:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+ 427:	8b 55 a0             	mov    -0x60(%rbp),%edx
+ 42a:	89 d2                	mov    %edx,%edx
+ 42c:	48 01 d0             	add    %rdx,%rax
+ 42f:	8b 55 a0             	mov    -0x60(%rbp),%edx
+ 432:	83 c2 08             	add    $0x8,%edx
+ 435:	89 55 a0             	mov    %edx,-0x60(%rbp)
+ 438:	eb 0c                	jmp    446 <printf+0x1df>
+ 43a:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+ 43e:	48 8d 50 08          	lea    0x8(%rax),%rdx
+ 442:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+ 446:	8b 30                	mov    (%rax),%esi
+ 448:	8b 45 9c             	mov    -0x64(%rbp),%eax
+ 44b:	b9 00 00 00 00       	mov    $0x0,%ecx
+ 450:	ba 10 00 00 00       	mov    $0x10,%edx
+ 455:	89 c7                	mov    %eax,%edi
+ 457:	e8 46 fd ff ff       	call   1a2 <printint>
+        if (lflag == 1)
+ 45c:	e9 af 00 00 00       	jmp    510 <printf+0x2a9>
+      } else if (c == 's') {
+ 461:	83 7d b8 73          	cmpl   $0x73,-0x48(%rbp)
+ 465:	75 6e                	jne    4d5 <printf+0x26e>
+        if ((s = (char *)va_arg(valist, char *)) == 0)
+ 467:	8b 45 a0             	mov    -0x60(%rbp),%eax
+ 46a:	83 f8 2f             	cmp    $0x2f,%eax
+ 46d:	77 17                	ja     486 <printf+0x21f>
+ 46f:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+ 473:	8b 55 a0             	mov    -0x60(%rbp),%edx
+ 476:	89 d2                	mov    %edx,%edx
+ 478:	48 01 d0             	add    %rdx,%rax
+ 47b:	8b 55 a0             	mov    -0x60(%rbp),%edx
+ 47e:	83 c2 08             	add    $0x8,%edx
+ 481:	89 55 a0             	mov    %edx,-0x60(%rbp)
+ 484:	eb 0c                	jmp    492 <printf+0x22b>
+ 486:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+ 48a:	48 8d 50 08          	lea    0x8(%rax),%rdx
+ 48e:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+ 492:	48 8b 00             	mov    (%rax),%rax
+ 495:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+ 499:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+ 49e:	75 28                	jne    4c8 <printf+0x261>
+          s = "(null)";
+ 4a0:	48 8d 05 f0 06 00 00 	lea    0x6f0(%rip),%rax        # b97 <malloc+0x142>
+ 4a7:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        for (; *s; s++)
+ 4ab:	eb 1b                	jmp    4c8 <printf+0x261>
+          putc(fd, *s);
+ 4ad:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+ 4b1:	0f b6 00             	movzbl (%rax),%eax
+ 4b4:	0f be d0             	movsbl %al,%edx
+ 4b7:	8b 45 9c             	mov    -0x64(%rbp),%eax
+ 4ba:	89 d6                	mov    %edx,%esi
+ 4bc:	89 c7                	mov    %eax,%edi
+ 4be:	e8 e2 fb ff ff       	call   a5 <putc>
+        for (; *s; s++)
+ 4c3:	48 83 45 c8 01       	addq   $0x1,-0x38(%rbp)
+ 4c8:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+ 4cc:	0f b6 00             	movzbl (%rax),%eax
+ 4cf:	84 c0                	test   %al,%al
+ 4d1:	75 da                	jne    4ad <printf+0x246>
+ 4d3:	eb 3b                	jmp    510 <printf+0x2a9>
+      } else if (c == '%') {
+ 4d5:	83 7d b8 25          	cmpl   $0x25,-0x48(%rbp)
+ 4d9:	75 14                	jne    4ef <printf+0x288>
+        putc(fd, c);
+ 4db:	8b 45 b8             	mov    -0x48(%rbp),%eax
+ 4de:	0f be d0             	movsbl %al,%edx
+ 4e1:	8b 45 9c             	mov    -0x64(%rbp),%eax
+ 4e4:	89 d6                	mov    %edx,%esi
+ 4e6:	89 c7                	mov    %eax,%edi
+ 4e8:	e8 b8 fb ff ff       	call   a5 <putc>
+ 4ed:	eb 21                	jmp    510 <printf+0x2a9>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+ 4ef:	8b 45 9c             	mov    -0x64(%rbp),%eax
+ 4f2:	be 25 00 00 00       	mov    $0x25,%esi
+ 4f7:	89 c7                	mov    %eax,%edi
+ 4f9:	e8 a7 fb ff ff       	call   a5 <putc>
+        putc(fd, c);
+ 4fe:	8b 45 b8             	mov    -0x48(%rbp),%eax
+ 501:	0f be d0             	movsbl %al,%edx
+ 504:	8b 45 9c             	mov    -0x64(%rbp),%eax
+ 507:	89 d6                	mov    %edx,%esi
+ 509:	89 c7                	mov    %eax,%edi
+ 50b:	e8 95 fb ff ff       	call   a5 <putc>
+      }
+      state = 0;
+ 510:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%rbp)
+  for (i = 0; fmt[i]; i++) {
+ 517:	83 45 c4 01          	addl   $0x1,-0x3c(%rbp)
+ 51b:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+ 51e:	48 63 d0             	movslq %eax,%rdx
+ 521:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+ 525:	48 01 d0             	add    %rdx,%rax
+ 528:	0f b6 00             	movzbl (%rax),%eax
+ 52b:	84 c0                	test   %al,%al
+ 52d:	0f 85 7d fd ff ff    	jne    2b0 <printf+0x49>
+    }
+  }
+
+  va_end(valist);
+}
+ 533:	90                   	nop
+ 534:	90                   	nop
+ 535:	c9                   	leave
+ 536:	c3                   	ret
+
+0000000000000537 <stosb>:
+      break;
+    buf[i++] = c;
+    if (c == '\n' || c == '\r')
+      break;
+  }
+  buf[i] = '\0';
+ 537:	55                   	push   %rbp
+ 538:	48 89 e5             	mov    %rsp,%rbp
+ 53b:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+ 53f:	89 75 f4             	mov    %esi,-0xc(%rbp)
+ 542:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  return buf;
+ 545:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+ 549:	8b 55 f0             	mov    -0x10(%rbp),%edx
+ 54c:	8b 45 f4             	mov    -0xc(%rbp),%eax
+ 54f:	48 89 ce             	mov    %rcx,%rsi
+ 552:	48 89 f7             	mov    %rsi,%rdi
+ 555:	89 d1                	mov    %edx,%ecx
+ 557:	fc                   	cld
+ 558:	f3 aa                	rep stos %al,%es:(%rdi)
+ 55a:	89 ca                	mov    %ecx,%edx
+ 55c:	48 89 fe             	mov    %rdi,%rsi
+ 55f:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+ 563:	89 55 f0             	mov    %edx,-0x10(%rbp)
+}
+
+int stat(char *n, struct stat *st) {
+  int fd;
+ 566:	90                   	nop
+ 567:	5d                   	pop    %rbp
+ 568:	c3                   	ret
+
+0000000000000569 <strcpy>:
+char *strcpy(char *s, char *t) {
+ 569:	55                   	push   %rbp
+ 56a:	48 89 e5             	mov    %rsp,%rbp
+ 56d:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+ 571:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  os = s;
+ 575:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 579:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while ((*s++ = *t++) != 0)
+ 57d:	90                   	nop
+ 57e:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+ 582:	48 8d 42 01          	lea    0x1(%rdx),%rax
+ 586:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+ 58a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 58e:	48 8d 48 01          	lea    0x1(%rax),%rcx
+ 592:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+ 596:	0f b6 12             	movzbl (%rdx),%edx
+ 599:	88 10                	mov    %dl,(%rax)
+ 59b:	0f b6 00             	movzbl (%rax),%eax
+ 59e:	84 c0                	test   %al,%al
+ 5a0:	75 dc                	jne    57e <strcpy+0x15>
+  return os;
+ 5a2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+ 5a6:	5d                   	pop    %rbp
+ 5a7:	c3                   	ret
+
+00000000000005a8 <strcmp>:
+int strcmp(const char *p, const char *q) {
+ 5a8:	55                   	push   %rbp
+ 5a9:	48 89 e5             	mov    %rsp,%rbp
+ 5ac:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+ 5b0:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  while (*p && *p == *q)
+ 5b4:	eb 0a                	jmp    5c0 <strcmp+0x18>
+    p++, q++;
+ 5b6:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+ 5bb:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (*p && *p == *q)
+ 5c0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 5c4:	0f b6 00             	movzbl (%rax),%eax
+ 5c7:	84 c0                	test   %al,%al
+ 5c9:	74 12                	je     5dd <strcmp+0x35>
+ 5cb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 5cf:	0f b6 10             	movzbl (%rax),%edx
+ 5d2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ 5d6:	0f b6 00             	movzbl (%rax),%eax
+ 5d9:	38 c2                	cmp    %al,%dl
+ 5db:	74 d9                	je     5b6 <strcmp+0xe>
+  return (uchar)*p - (uchar)*q;
+ 5dd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 5e1:	0f b6 00             	movzbl (%rax),%eax
+ 5e4:	0f b6 d0             	movzbl %al,%edx
+ 5e7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ 5eb:	0f b6 00             	movzbl (%rax),%eax
+ 5ee:	0f b6 c0             	movzbl %al,%eax
+ 5f1:	29 c2                	sub    %eax,%edx
+ 5f3:	89 d0                	mov    %edx,%eax
+}
+ 5f5:	5d                   	pop    %rbp
+ 5f6:	c3                   	ret
+
+00000000000005f7 <strlen>:
+uint strlen(char *s) {
+ 5f7:	55                   	push   %rbp
+ 5f8:	48 89 e5             	mov    %rsp,%rbp
+ 5fb:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  for (n = 0; s[n]; n++)
+ 5ff:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+ 606:	eb 04                	jmp    60c <strlen+0x15>
+ 608:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+ 60c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 60f:	48 63 d0             	movslq %eax,%rdx
+ 612:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 616:	48 01 d0             	add    %rdx,%rax
+ 619:	0f b6 00             	movzbl (%rax),%eax
+ 61c:	84 c0                	test   %al,%al
+ 61e:	75 e8                	jne    608 <strlen+0x11>
+  return n;
+ 620:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+ 623:	5d                   	pop    %rbp
+ 624:	c3                   	ret
+
+0000000000000625 <memset>:
+void *memset(void *dst, int c, uint n) {
+ 625:	55                   	push   %rbp
+ 626:	48 89 e5             	mov    %rsp,%rbp
+ 629:	48 83 ec 10          	sub    $0x10,%rsp
+ 62d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+ 631:	89 75 f4             	mov    %esi,-0xc(%rbp)
+ 634:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  stosb(dst, c, n);
+ 637:	8b 55 f0             	mov    -0x10(%rbp),%edx
+ 63a:	8b 4d f4             	mov    -0xc(%rbp),%ecx
+ 63d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 641:	89 ce                	mov    %ecx,%esi
+ 643:	48 89 c7             	mov    %rax,%rdi
+ 646:	e8 ec fe ff ff       	call   537 <stosb>
+  return dst;
+ 64b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+ 64f:	c9                   	leave
+ 650:	c3                   	ret
+
+0000000000000651 <strchr>:
+char *strchr(const char *s, char c) {
+ 651:	55                   	push   %rbp
+ 652:	48 89 e5             	mov    %rsp,%rbp
+ 655:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+ 659:	89 f0                	mov    %esi,%eax
+ 65b:	88 45 f4             	mov    %al,-0xc(%rbp)
+  for (; *s; s++)
+ 65e:	eb 17                	jmp    677 <strchr+0x26>
+    if (*s == c)
+ 660:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 664:	0f b6 00             	movzbl (%rax),%eax
+ 667:	38 45 f4             	cmp    %al,-0xc(%rbp)
+ 66a:	75 06                	jne    672 <strchr+0x21>
+      return (char *)s;
+ 66c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 670:	eb 15                	jmp    687 <strchr+0x36>
+  for (; *s; s++)
+ 672:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+ 677:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 67b:	0f b6 00             	movzbl (%rax),%eax
+ 67e:	84 c0                	test   %al,%al
+ 680:	75 de                	jne    660 <strchr+0xf>
+  return 0;
+ 682:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 687:	5d                   	pop    %rbp
+ 688:	c3                   	ret
+
+0000000000000689 <gets>:
+char *gets(char *buf, int max) {
+ 689:	55                   	push   %rbp
+ 68a:	48 89 e5             	mov    %rsp,%rbp
+ 68d:	48 83 ec 20          	sub    $0x20,%rsp
+ 691:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+ 695:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  for (i = 0; i + 1 < max;) {
+ 698:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+ 69f:	eb 48                	jmp    6e9 <gets+0x60>
+    cc = read(0, &c, 1);
+ 6a1:	48 8d 45 f7          	lea    -0x9(%rbp),%rax
+ 6a5:	ba 01 00 00 00       	mov    $0x1,%edx
+ 6aa:	48 89 c6             	mov    %rax,%rsi
+ 6ad:	bf 00 00 00 00       	mov    $0x0,%edi
+ 6b2:	e8 6f 01 00 00       	call   826 <read>
+ 6b7:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    if (cc < 1)
+ 6ba:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+ 6be:	7e 36                	jle    6f6 <gets+0x6d>
+    buf[i++] = c;
+ 6c0:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 6c3:	8d 50 01             	lea    0x1(%rax),%edx
+ 6c6:	89 55 fc             	mov    %edx,-0x4(%rbp)
+ 6c9:	48 63 d0             	movslq %eax,%rdx
+ 6cc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 6d0:	48 01 c2             	add    %rax,%rdx
+ 6d3:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+ 6d7:	88 02                	mov    %al,(%rdx)
+    if (c == '\n' || c == '\r')
+ 6d9:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+ 6dd:	3c 0a                	cmp    $0xa,%al
+ 6df:	74 16                	je     6f7 <gets+0x6e>
+ 6e1:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+ 6e5:	3c 0d                	cmp    $0xd,%al
+ 6e7:	74 0e                	je     6f7 <gets+0x6e>
+  for (i = 0; i + 1 < max;) {
+ 6e9:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 6ec:	83 c0 01             	add    $0x1,%eax
+ 6ef:	39 45 e4             	cmp    %eax,-0x1c(%rbp)
+ 6f2:	7f ad                	jg     6a1 <gets+0x18>
+ 6f4:	eb 01                	jmp    6f7 <gets+0x6e>
+      break;
+ 6f6:	90                   	nop
+  buf[i] = '\0';
+ 6f7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 6fa:	48 63 d0             	movslq %eax,%rdx
+ 6fd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 701:	48 01 d0             	add    %rdx,%rax
+ 704:	c6 00 00             	movb   $0x0,(%rax)
+  return buf;
+ 707:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+ 70b:	c9                   	leave
+ 70c:	c3                   	ret
+
+000000000000070d <stat>:
+int stat(char *n, struct stat *st) {
+ 70d:	55                   	push   %rbp
+ 70e:	48 89 e5             	mov    %rsp,%rbp
+ 711:	48 83 ec 20          	sub    $0x20,%rsp
+ 715:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+ 719:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 71d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 721:	be 00 00 00 00       	mov    $0x0,%esi
+ 726:	48 89 c7             	mov    %rax,%rdi
+ 729:	e8 20 01 00 00       	call   84e <open>
+ 72e:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  if (fd < 0)
+ 731:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+ 735:	79 07                	jns    73e <stat+0x31>
+    return -1;
+ 737:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 73c:	eb 21                	jmp    75f <stat+0x52>
+  r = fstat(fd, st);
+ 73e:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+ 742:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 745:	48 89 d6             	mov    %rdx,%rsi
+ 748:	89 c7                	mov    %eax,%edi
+ 74a:	e8 17 01 00 00       	call   866 <fstat>
+ 74f:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  close(fd);
+ 752:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 755:	89 c7                	mov    %eax,%edi
+ 757:	e8 da 00 00 00       	call   836 <close>
+  return r;
+ 75c:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+ 75f:	c9                   	leave
+ 760:	c3                   	ret
+
+0000000000000761 <atoi>:
+
+int atoi(const char *s) {
+ 761:	55                   	push   %rbp
+ 762:	48 89 e5             	mov    %rsp,%rbp
+ 765:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int n;
+
+  n = 0;
+ 769:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  while ('0' <= *s && *s <= '9')
+ 770:	eb 28                	jmp    79a <atoi+0x39>
+    n = n * 10 + *s++ - '0';
+ 772:	8b 55 fc             	mov    -0x4(%rbp),%edx
+ 775:	89 d0                	mov    %edx,%eax
+ 777:	c1 e0 02             	shl    $0x2,%eax
+ 77a:	01 d0                	add    %edx,%eax
+ 77c:	01 c0                	add    %eax,%eax
+ 77e:	89 c1                	mov    %eax,%ecx
+ 780:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 784:	48 8d 50 01          	lea    0x1(%rax),%rdx
+ 788:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+ 78c:	0f b6 00             	movzbl (%rax),%eax
+ 78f:	0f be c0             	movsbl %al,%eax
+ 792:	01 c8                	add    %ecx,%eax
+ 794:	83 e8 30             	sub    $0x30,%eax
+ 797:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while ('0' <= *s && *s <= '9')
+ 79a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 79e:	0f b6 00             	movzbl (%rax),%eax
+ 7a1:	3c 2f                	cmp    $0x2f,%al
+ 7a3:	7e 0b                	jle    7b0 <atoi+0x4f>
+ 7a5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 7a9:	0f b6 00             	movzbl (%rax),%eax
+ 7ac:	3c 39                	cmp    $0x39,%al
+ 7ae:	7e c2                	jle    772 <atoi+0x11>
+  return n;
+ 7b0:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+ 7b3:	5d                   	pop    %rbp
+ 7b4:	c3                   	ret
+
+00000000000007b5 <memmove>:
+
+void *memmove(void *vdst, void *vsrc, int n) {
+ 7b5:	55                   	push   %rbp
+ 7b6:	48 89 e5             	mov    %rsp,%rbp
+ 7b9:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+ 7bd:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+ 7c1:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  char *dst, *src;
+
+  dst = vdst;
+ 7c4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 7c8:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  src = vsrc;
+ 7cc:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+ 7d0:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  while (n-- > 0)
+ 7d4:	eb 1d                	jmp    7f3 <memmove+0x3e>
+    *dst++ = *src++;
+ 7d6:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+ 7da:	48 8d 42 01          	lea    0x1(%rdx),%rax
+ 7de:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+ 7e2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 7e6:	48 8d 48 01          	lea    0x1(%rax),%rcx
+ 7ea:	48 89 4d f8          	mov    %rcx,-0x8(%rbp)
+ 7ee:	0f b6 12             	movzbl (%rdx),%edx
+ 7f1:	88 10                	mov    %dl,(%rax)
+  while (n-- > 0)
+ 7f3:	8b 45 dc             	mov    -0x24(%rbp),%eax
+ 7f6:	8d 50 ff             	lea    -0x1(%rax),%edx
+ 7f9:	89 55 dc             	mov    %edx,-0x24(%rbp)
+ 7fc:	85 c0                	test   %eax,%eax
+ 7fe:	7f d6                	jg     7d6 <memmove+0x21>
+  return vdst;
+ 800:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 804:	5d                   	pop    %rbp
+ 805:	c3                   	ret
+
+0000000000000806 <fork>:
+  name:                                                                        \
+  movl $SYS_##name, % eax;                                                     \
+  int $TRAP_SYSCALL;                                                           \
+  ret
+
+SYSCALL(fork)
+ 806:	b8 01 00 00 00       	mov    $0x1,%eax
+ 80b:	cd 40                	int    $0x40
+ 80d:	c3                   	ret
+
+000000000000080e <exit>:
+SYSCALL(exit)
+ 80e:	b8 02 00 00 00       	mov    $0x2,%eax
+ 813:	cd 40                	int    $0x40
+ 815:	c3                   	ret
+
+0000000000000816 <wait>:
+SYSCALL(wait)
+ 816:	b8 03 00 00 00       	mov    $0x3,%eax
+ 81b:	cd 40                	int    $0x40
+ 81d:	c3                   	ret
+
+000000000000081e <pipe>:
+SYSCALL(pipe)
+ 81e:	b8 04 00 00 00       	mov    $0x4,%eax
+ 823:	cd 40                	int    $0x40
+ 825:	c3                   	ret
+
+0000000000000826 <read>:
+SYSCALL(read)
+ 826:	b8 05 00 00 00       	mov    $0x5,%eax
+ 82b:	cd 40                	int    $0x40
+ 82d:	c3                   	ret
+
+000000000000082e <write>:
+SYSCALL(write)
+ 82e:	b8 10 00 00 00       	mov    $0x10,%eax
+ 833:	cd 40                	int    $0x40
+ 835:	c3                   	ret
+
+0000000000000836 <close>:
+SYSCALL(close)
+ 836:	b8 15 00 00 00       	mov    $0x15,%eax
+ 83b:	cd 40                	int    $0x40
+ 83d:	c3                   	ret
+
+000000000000083e <kill>:
+SYSCALL(kill)
+ 83e:	b8 06 00 00 00       	mov    $0x6,%eax
+ 843:	cd 40                	int    $0x40
+ 845:	c3                   	ret
+
+0000000000000846 <exec>:
+SYSCALL(exec)
+ 846:	b8 07 00 00 00       	mov    $0x7,%eax
+ 84b:	cd 40                	int    $0x40
+ 84d:	c3                   	ret
+
+000000000000084e <open>:
+SYSCALL(open)
+ 84e:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 853:	cd 40                	int    $0x40
+ 855:	c3                   	ret
+
+0000000000000856 <mknod>:
+SYSCALL(mknod)
+ 856:	b8 11 00 00 00       	mov    $0x11,%eax
+ 85b:	cd 40                	int    $0x40
+ 85d:	c3                   	ret
+
+000000000000085e <unlink>:
+SYSCALL(unlink)
+ 85e:	b8 12 00 00 00       	mov    $0x12,%eax
+ 863:	cd 40                	int    $0x40
+ 865:	c3                   	ret
+
+0000000000000866 <fstat>:
+SYSCALL(fstat)
+ 866:	b8 08 00 00 00       	mov    $0x8,%eax
+ 86b:	cd 40                	int    $0x40
+ 86d:	c3                   	ret
+
+000000000000086e <link>:
+SYSCALL(link)
+ 86e:	b8 13 00 00 00       	mov    $0x13,%eax
+ 873:	cd 40                	int    $0x40
+ 875:	c3                   	ret
+
+0000000000000876 <mkdir>:
+SYSCALL(mkdir)
+ 876:	b8 14 00 00 00       	mov    $0x14,%eax
+ 87b:	cd 40                	int    $0x40
+ 87d:	c3                   	ret
+
+000000000000087e <chdir>:
+SYSCALL(chdir)
+ 87e:	b8 09 00 00 00       	mov    $0x9,%eax
+ 883:	cd 40                	int    $0x40
+ 885:	c3                   	ret
+
+0000000000000886 <dup>:
+SYSCALL(dup)
+ 886:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 88b:	cd 40                	int    $0x40
+ 88d:	c3                   	ret
+
+000000000000088e <getpid>:
+SYSCALL(getpid)
+ 88e:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 893:	cd 40                	int    $0x40
+ 895:	c3                   	ret
+
+0000000000000896 <sbrk>:
+SYSCALL(sbrk)
+ 896:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 89b:	cd 40                	int    $0x40
+ 89d:	c3                   	ret
+
+000000000000089e <sleep>:
+SYSCALL(sleep)
+ 89e:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 8a3:	cd 40                	int    $0x40
+ 8a5:	c3                   	ret
+
+00000000000008a6 <uptime>:
+SYSCALL(uptime)
+ 8a6:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 8ab:	cd 40                	int    $0x40
+ 8ad:	c3                   	ret
+
+00000000000008ae <sysinfo>:
+SYSCALL(sysinfo)
+ 8ae:	b8 16 00 00 00       	mov    $0x16,%eax
+ 8b3:	cd 40                	int    $0x40
+ 8b5:	c3                   	ret
+
+00000000000008b6 <crashn>:
+SYSCALL(crashn)
+ 8b6:	b8 17 00 00 00       	mov    $0x17,%eax
+ 8bb:	cd 40                	int    $0x40
+ 8bd:	c3                   	ret
+
+00000000000008be <sync>:
+SYSCALL(sync)
+ 8be:	b8 18 00 00 00       	mov    $0x18,%eax
+ 8c3:	cd 40                	int    $0x40
+ 8c5:	c3                   	ret
+
+00000000000008c6 <fsync>:
+SYSCALL(fsync)
+ 8c6:	b8 19 00 00 00       	mov    $0x19,%eax
+ 8cb:	cd 40                	int    $0x40
+ 8cd:	c3                   	ret
+
+00000000000008ce <free>:
+typedef union header Header;
+
+static Header base;
+static Header *freep;
+
+void free(void *ap) {
+ 8ce:	55                   	push   %rbp
+ 8cf:	48 89 e5             	mov    %rsp,%rbp
+ 8d2:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  Header *bp, *p;
+
+  bp = (Header *)ap - 1;
+ 8d6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 8da:	48 83 e8 10          	sub    $0x10,%rax
+ 8de:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  for (p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 8e2:	48 8b 05 67 05 00 00 	mov    0x567(%rip),%rax        # e50 <freep>
+ 8e9:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+ 8ed:	eb 2f                	jmp    91e <free+0x50>
+    if (p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 8ef:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 8f3:	48 8b 00             	mov    (%rax),%rax
+ 8f6:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+ 8fa:	72 17                	jb     913 <free+0x45>
+ 8fc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ 900:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+ 904:	72 2f                	jb     935 <free+0x67>
+ 906:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 90a:	48 8b 00             	mov    (%rax),%rax
+ 90d:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+ 911:	72 22                	jb     935 <free+0x67>
+  for (p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 913:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 917:	48 8b 00             	mov    (%rax),%rax
+ 91a:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+ 91e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ 922:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+ 926:	73 c7                	jae    8ef <free+0x21>
+ 928:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 92c:	48 8b 00             	mov    (%rax),%rax
+ 92f:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+ 933:	73 ba                	jae    8ef <free+0x21>
+      break;
+  if (bp + bp->s.size == p->s.ptr) {
+ 935:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ 939:	8b 40 08             	mov    0x8(%rax),%eax
+ 93c:	89 c0                	mov    %eax,%eax
+ 93e:	48 c1 e0 04          	shl    $0x4,%rax
+ 942:	48 89 c2             	mov    %rax,%rdx
+ 945:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ 949:	48 01 c2             	add    %rax,%rdx
+ 94c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 950:	48 8b 00             	mov    (%rax),%rax
+ 953:	48 39 c2             	cmp    %rax,%rdx
+ 956:	75 2d                	jne    985 <free+0xb7>
+    bp->s.size += p->s.ptr->s.size;
+ 958:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ 95c:	8b 50 08             	mov    0x8(%rax),%edx
+ 95f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 963:	48 8b 00             	mov    (%rax),%rax
+ 966:	8b 40 08             	mov    0x8(%rax),%eax
+ 969:	01 c2                	add    %eax,%edx
+ 96b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ 96f:	89 50 08             	mov    %edx,0x8(%rax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 972:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 976:	48 8b 00             	mov    (%rax),%rax
+ 979:	48 8b 10             	mov    (%rax),%rdx
+ 97c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ 980:	48 89 10             	mov    %rdx,(%rax)
+ 983:	eb 0e                	jmp    993 <free+0xc5>
+  } else
+    bp->s.ptr = p->s.ptr;
+ 985:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 989:	48 8b 10             	mov    (%rax),%rdx
+ 98c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ 990:	48 89 10             	mov    %rdx,(%rax)
+  if (p + p->s.size == bp) {
+ 993:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 997:	8b 40 08             	mov    0x8(%rax),%eax
+ 99a:	89 c0                	mov    %eax,%eax
+ 99c:	48 c1 e0 04          	shl    $0x4,%rax
+ 9a0:	48 89 c2             	mov    %rax,%rdx
+ 9a3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 9a7:	48 01 d0             	add    %rdx,%rax
+ 9aa:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+ 9ae:	75 27                	jne    9d7 <free+0x109>
+    p->s.size += bp->s.size;
+ 9b0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 9b4:	8b 50 08             	mov    0x8(%rax),%edx
+ 9b7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ 9bb:	8b 40 08             	mov    0x8(%rax),%eax
+ 9be:	01 c2                	add    %eax,%edx
+ 9c0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 9c4:	89 50 08             	mov    %edx,0x8(%rax)
+    p->s.ptr = bp->s.ptr;
+ 9c7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ 9cb:	48 8b 10             	mov    (%rax),%rdx
+ 9ce:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 9d2:	48 89 10             	mov    %rdx,(%rax)
+ 9d5:	eb 0b                	jmp    9e2 <free+0x114>
+  } else
+    p->s.ptr = bp;
+ 9d7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 9db:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+ 9df:	48 89 10             	mov    %rdx,(%rax)
+  freep = p;
+ 9e2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 9e6:	48 89 05 63 04 00 00 	mov    %rax,0x463(%rip)        # e50 <freep>
+}
+ 9ed:	90                   	nop
+ 9ee:	5d                   	pop    %rbp
+ 9ef:	c3                   	ret
+
+00000000000009f0 <morecore>:
+
+static Header *morecore(uint nu) {
+ 9f0:	55                   	push   %rbp
+ 9f1:	48 89 e5             	mov    %rsp,%rbp
+ 9f4:	48 83 ec 20          	sub    $0x20,%rsp
+ 9f8:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  char *p;
+  Header *hp;
+
+  if (nu < 4096)
+ 9fb:	81 7d ec ff 0f 00 00 	cmpl   $0xfff,-0x14(%rbp)
+ a02:	77 07                	ja     a0b <morecore+0x1b>
+    nu = 4096;
+ a04:	c7 45 ec 00 10 00 00 	movl   $0x1000,-0x14(%rbp)
+  p = sbrk(nu * sizeof(Header));
+ a0b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+ a0e:	c1 e0 04             	shl    $0x4,%eax
+ a11:	89 c7                	mov    %eax,%edi
+ a13:	e8 7e fe ff ff       	call   896 <sbrk>
+ a18:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (p == (char *)-1)
+ a1c:	48 83 7d f8 ff       	cmpq   $0xffffffffffffffff,-0x8(%rbp)
+ a21:	75 07                	jne    a2a <morecore+0x3a>
+    return 0;
+ a23:	b8 00 00 00 00       	mov    $0x0,%eax
+ a28:	eb 29                	jmp    a53 <morecore+0x63>
+  hp = (Header *)p;
+ a2a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ a2e:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  hp->s.size = nu;
+ a32:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ a36:	8b 55 ec             	mov    -0x14(%rbp),%edx
+ a39:	89 50 08             	mov    %edx,0x8(%rax)
+  free((void *)(hp + 1));
+ a3c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ a40:	48 83 c0 10          	add    $0x10,%rax
+ a44:	48 89 c7             	mov    %rax,%rdi
+ a47:	e8 82 fe ff ff       	call   8ce <free>
+  return freep;
+ a4c:	48 8b 05 fd 03 00 00 	mov    0x3fd(%rip),%rax        # e50 <freep>
+}
+ a53:	c9                   	leave
+ a54:	c3                   	ret
+
+0000000000000a55 <malloc>:
+
+void *malloc(uint nbytes) {
+ a55:	55                   	push   %rbp
+ a56:	48 89 e5             	mov    %rsp,%rbp
+ a59:	48 83 ec 30          	sub    $0x30,%rsp
+ a5d:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1) / sizeof(Header) + 1;
+ a60:	8b 45 dc             	mov    -0x24(%rbp),%eax
+ a63:	48 83 c0 0f          	add    $0xf,%rax
+ a67:	48 c1 e8 04          	shr    $0x4,%rax
+ a6b:	83 c0 01             	add    $0x1,%eax
+ a6e:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  if ((prevp = freep) == 0) {
+ a71:	48 8b 05 d8 03 00 00 	mov    0x3d8(%rip),%rax        # e50 <freep>
+ a78:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+ a7c:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+ a81:	75 2e                	jne    ab1 <malloc+0x5c>
+    base.s.ptr = freep = prevp = &base;
+ a83:	48 8d 05 b6 03 00 00 	lea    0x3b6(%rip),%rax        # e40 <base>
+ a8a:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+ a8e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ a92:	48 89 05 b7 03 00 00 	mov    %rax,0x3b7(%rip)        # e50 <freep>
+ a99:	48 8b 05 b0 03 00 00 	mov    0x3b0(%rip),%rax        # e50 <freep>
+ aa0:	48 89 05 99 03 00 00 	mov    %rax,0x399(%rip)        # e40 <base>
+    base.s.size = 0;
+ aa7:	c7 05 97 03 00 00 00 	movl   $0x0,0x397(%rip)        # e48 <base+0x8>
+ aae:	00 00 00 
+  }
+  for (p = prevp->s.ptr;; prevp = p, p = p->s.ptr) {
+ ab1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ ab5:	48 8b 00             	mov    (%rax),%rax
+ ab8:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    if (p->s.size >= nunits) {
+ abc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ ac0:	8b 40 08             	mov    0x8(%rax),%eax
+ ac3:	3b 45 ec             	cmp    -0x14(%rbp),%eax
+ ac6:	72 5f                	jb     b27 <malloc+0xd2>
+      if (p->s.size == nunits)
+ ac8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ acc:	8b 40 08             	mov    0x8(%rax),%eax
+ acf:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+ ad2:	75 10                	jne    ae4 <malloc+0x8f>
+        prevp->s.ptr = p->s.ptr;
+ ad4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ ad8:	48 8b 10             	mov    (%rax),%rdx
+ adb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ adf:	48 89 10             	mov    %rdx,(%rax)
+ ae2:	eb 2e                	jmp    b12 <malloc+0xbd>
+      else {
+        p->s.size -= nunits;
+ ae4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ ae8:	8b 40 08             	mov    0x8(%rax),%eax
+ aeb:	2b 45 ec             	sub    -0x14(%rbp),%eax
+ aee:	89 c2                	mov    %eax,%edx
+ af0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ af4:	89 50 08             	mov    %edx,0x8(%rax)
+        p += p->s.size;
+ af7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ afb:	8b 40 08             	mov    0x8(%rax),%eax
+ afe:	89 c0                	mov    %eax,%eax
+ b00:	48 c1 e0 04          	shl    $0x4,%rax
+ b04:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+        p->s.size = nunits;
+ b08:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ b0c:	8b 55 ec             	mov    -0x14(%rbp),%edx
+ b0f:	89 50 08             	mov    %edx,0x8(%rax)
+      }
+      freep = prevp;
+ b12:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ b16:	48 89 05 33 03 00 00 	mov    %rax,0x333(%rip)        # e50 <freep>
+      return (void *)(p + 1);
+ b1d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ b21:	48 83 c0 10          	add    $0x10,%rax
+ b25:	eb 41                	jmp    b68 <malloc+0x113>
+    }
+    if (p == freep)
+ b27:	48 8b 05 22 03 00 00 	mov    0x322(%rip),%rax        # e50 <freep>
+ b2e:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+ b32:	75 1c                	jne    b50 <malloc+0xfb>
+      if ((p = morecore(nunits)) == 0)
+ b34:	8b 45 ec             	mov    -0x14(%rbp),%eax
+ b37:	89 c7                	mov    %eax,%edi
+ b39:	e8 b2 fe ff ff       	call   9f0 <morecore>
+ b3e:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+ b42:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+ b47:	75 07                	jne    b50 <malloc+0xfb>
+        return 0;
+ b49:	b8 00 00 00 00       	mov    $0x0,%eax
+ b4e:	eb 18                	jmp    b68 <malloc+0x113>
+  for (p = prevp->s.ptr;; prevp = p, p = p->s.ptr) {
+ b50:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ b54:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+ b58:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ b5c:	48 8b 00             	mov    (%rax),%rax
+ b5f:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    if (p->s.size >= nunits) {
+ b63:	e9 54 ff ff ff       	jmp    abc <malloc+0x67>
+  }
+ b68:	c9                   	leave
+ b69:	c3                   	ret
@@ -0,0 +1,1335 @@
+
+out/user/_sysinfo:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000000000 <main>:
+#include <fs.h>
+#include <stat.h>
+#include <sysinfo.h>
+#include <user.h>
+
+int main(int argc, char *argv[]) {
+   0:	55                   	push   %rbp
+   1:	48 89 e5             	mov    %rsp,%rbp
+   4:	48 83 ec 40          	sub    $0x40,%rsp
+   8:	89 7d cc             	mov    %edi,-0x34(%rbp)
+   b:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  struct sys_info info;
+  sysinfo(&info);
+   f:	48 8d 45 dc          	lea    -0x24(%rbp),%rax
+  13:	48 89 c7             	mov    %rax,%rdi
+  16:	e8 1c 09 00 00       	call   937 <sysinfo>
+
+  printf(1, "pages_in_use = %d\n", info.pages_in_use);
+  1b:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  1e:	89 c2                	mov    %eax,%edx
+  20:	48 8d 05 cc 0b 00 00 	lea    0xbcc(%rip),%rax        # bf3 <malloc+0x115>
+  27:	48 89 c6             	mov    %rax,%rsi
+  2a:	bf 01 00 00 00       	mov    $0x1,%edi
+  2f:	b8 00 00 00 00       	mov    $0x0,%eax
+  34:	e8 b7 02 00 00       	call   2f0 <printf>
+  printf(1, "pages_in_swap = %d\n", info.pages_in_swap);
+  39:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  3c:	89 c2                	mov    %eax,%edx
+  3e:	48 8d 05 c1 0b 00 00 	lea    0xbc1(%rip),%rax        # c06 <malloc+0x128>
+  45:	48 89 c6             	mov    %rax,%rsi
+  48:	bf 01 00 00 00       	mov    $0x1,%edi
+  4d:	b8 00 00 00 00       	mov    $0x0,%eax
+  52:	e8 99 02 00 00       	call   2f0 <printf>
+  printf(1, "free_pages = %d\n", info.free_pages);
+  57:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  5a:	89 c2                	mov    %eax,%edx
+  5c:	48 8d 05 b7 0b 00 00 	lea    0xbb7(%rip),%rax        # c1a <malloc+0x13c>
+  63:	48 89 c6             	mov    %rax,%rsi
+  66:	bf 01 00 00 00       	mov    $0x1,%edi
+  6b:	b8 00 00 00 00       	mov    $0x0,%eax
+  70:	e8 7b 02 00 00       	call   2f0 <printf>
+  printf(1, "num_page_faults = %d\n", info.num_page_faults);
+  75:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  78:	89 c2                	mov    %eax,%edx
+  7a:	48 8d 05 aa 0b 00 00 	lea    0xbaa(%rip),%rax        # c2b <malloc+0x14d>
+  81:	48 89 c6             	mov    %rax,%rsi
+  84:	bf 01 00 00 00       	mov    $0x1,%edi
+  89:	b8 00 00 00 00       	mov    $0x0,%eax
+  8e:	e8 5d 02 00 00       	call   2f0 <printf>
+  printf(1, "num_disk_reads = %d\n", info.num_disk_reads);
+  93:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  96:	89 c2                	mov    %eax,%edx
+  98:	48 8d 05 a2 0b 00 00 	lea    0xba2(%rip),%rax        # c41 <malloc+0x163>
+  9f:	48 89 c6             	mov    %rax,%rsi
+  a2:	bf 01 00 00 00       	mov    $0x1,%edi
+  a7:	b8 00 00 00 00       	mov    $0x0,%eax
+  ac:	e8 3f 02 00 00       	call   2f0 <printf>
+  printf(1, "num_io_requests = %d\n", info.num_io_requests);
+  b1:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  b4:	89 c2                	mov    %eax,%edx
+  b6:	48 8d 05 99 0b 00 00 	lea    0xb99(%rip),%rax        # c56 <malloc+0x178>
+  bd:	48 89 c6             	mov    %rax,%rsi
+  c0:	bf 01 00 00 00       	mov    $0x1,%edi
+  c5:	b8 00 00 00 00       	mov    $0x0,%eax
+  ca:	e8 21 02 00 00       	call   2f0 <printf>
+  printf(1, "num_io_merges = %d\n", info.num_io_merges);
+  cf:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  d2:	89 c2                	mov    %eax,%edx
+  d4:	48 8d 05 91 0b 00 00 	lea    0xb91(%rip),%rax        # c6c <malloc+0x18e>
+  db:	48 89 c6             	mov    %rax,%rsi
+  de:	bf 01 00 00 00       	mov    $0x1,%edi
+  e3:	b8 00 00 00 00       	mov    $0x0,%eax
+  e8:	e8 03 02 00 00       	call   2f0 <printf>
+  printf(1, "io_queue_depth = %d\n", info.io_queue_depth);
+  ed:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  f0:	89 c2                	mov    %eax,%edx
+  f2:	48 8d 05 87 0b 00 00 	lea    0xb87(%rip),%rax        # c80 <malloc+0x1a2>
+  f9:	48 89 c6             	mov    %rax,%rsi
+  fc:	bf 01 00 00 00       	mov    $0x1,%edi
+ 101:	b8 00 00 00 00       	mov    $0x0,%eax
+ 106:	e8 e5 01 00 00       	call   2f0 <printf>
+  printf(1, "max_io_queue_depth = %d\n", info.max_io_queue_depth);
+ 10b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 10e:	89 c2                	mov    %eax,%edx
+ 110:	48 8d 05 7e 0b 00 00 	lea    0xb7e(%rip),%rax        # c95 <malloc+0x1b7>
+ 117:	48 89 c6             	mov    %rax,%rsi
+ 11a:	bf 01 00 00 00       	mov    $0x1,%edi
+ 11f:	b8 00 00 00 00       	mov    $0x0,%eax
+ 124:	e8 c7 01 00 00       	call   2f0 <printf>
+
+  exit();
+ 129:	e8 69 07 00 00       	call   897 <exit>
+
+000000000000012e <putc>:
+#include <cdefs.h>
+#include <stat.h>
+#include <stdarg.h>
+#include <user.h>
+
+static void putc(int fd, char c) { write(fd, &c, 1); }
+ 12e:	55                   	push   %rbp
+ 12f:	48 89 e5             	mov    %rsp,%rbp
+ 132:	48 83 ec 10          	sub    $0x10,%rsp
+ 136:	89 7d fc             	mov    %edi,-0x4(%rbp)
+ 139:	89 f0                	mov    %esi,%eax
+ 13b:	88 45 f8             	mov    %al,-0x8(%rbp)
+ 13e:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+ 142:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 145:	ba 01 00 00 00       	mov    $0x1,%edx
+ 14a:	48 89 ce             	mov    %rcx,%rsi
+ 14d:	89 c7                	mov    %eax,%edi
+ 14f:	e8 63 07 00 00       	call   8b7 <write>
+ 154:	90                   	nop
+ 155:	c9                   	leave
+ 156:	c3                   	ret
+
+0000000000000157 <printint64>:
+
+static void printint64(int fd, int xx, int base, int sgn) {
+ 157:	55                   	push   %rbp
+ 158:	48 89 e5             	mov    %rsp,%rbp
+ 15b:	48 83 ec 40          	sub    $0x40,%rsp
+ 15f:	89 7d cc             	mov    %edi,-0x34(%rbp)
+ 162:	89 75 c8             	mov    %esi,-0x38(%rbp)
+ 165:	89 55 c4             	mov    %edx,-0x3c(%rbp)
+ 168:	89 4d c0             	mov    %ecx,-0x40(%rbp)
+  static char digits[] = "0123456789abcdef";
+  char buf[32];
+  int i;
+  uint64_t x;
+
+  if (sgn && (sgn = xx < 0))
+ 16b:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+ 16f:	74 1f                	je     190 <printint64+0x39>
+ 171:	8b 45 c8             	mov    -0x38(%rbp),%eax
+ 174:	c1 e8 1f             	shr    $0x1f,%eax
+ 177:	0f b6 c0             	movzbl %al,%eax
+ 17a:	89 45 c0             	mov    %eax,-0x40(%rbp)
+ 17d:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+ 181:	74 0d                	je     190 <printint64+0x39>
+    x = -xx;
+ 183:	8b 45 c8             	mov    -0x38(%rbp),%eax
+ 186:	f7 d8                	neg    %eax
+ 188:	48 98                	cltq
+ 18a:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+ 18e:	eb 09                	jmp    199 <printint64+0x42>
+  else
+    x = xx;
+ 190:	8b 45 c8             	mov    -0x38(%rbp),%eax
+ 193:	48 98                	cltq
+ 195:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+  i = 0;
+ 199:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  do {
+    buf[i++] = digits[x % base];
+ 1a0:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+ 1a3:	48 63 c8             	movslq %eax,%rcx
+ 1a6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ 1aa:	ba 00 00 00 00       	mov    $0x0,%edx
+ 1af:	48 f7 f1             	div    %rcx
+ 1b2:	48 89 d1             	mov    %rdx,%rcx
+ 1b5:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 1b8:	8d 50 01             	lea    0x1(%rax),%edx
+ 1bb:	89 55 fc             	mov    %edx,-0x4(%rbp)
+ 1be:	48 8d 15 4b 0d 00 00 	lea    0xd4b(%rip),%rdx        # f10 <digits.1>
+ 1c5:	0f b6 14 11          	movzbl (%rcx,%rdx,1),%edx
+ 1c9:	48 98                	cltq
+ 1cb:	88 54 05 d0          	mov    %dl,-0x30(%rbp,%rax,1)
+  } while ((x /= base) != 0);
+ 1cf:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+ 1d2:	48 63 f0             	movslq %eax,%rsi
+ 1d5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ 1d9:	ba 00 00 00 00       	mov    $0x0,%edx
+ 1de:	48 f7 f6             	div    %rsi
+ 1e1:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+ 1e5:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+ 1ea:	75 b4                	jne    1a0 <printint64+0x49>
+
+  if (sgn)
+ 1ec:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+ 1f0:	74 2b                	je     21d <printint64+0xc6>
+    buf[i++] = '-';
+ 1f2:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 1f5:	8d 50 01             	lea    0x1(%rax),%edx
+ 1f8:	89 55 fc             	mov    %edx,-0x4(%rbp)
+ 1fb:	48 98                	cltq
+ 1fd:	c6 44 05 d0 2d       	movb   $0x2d,-0x30(%rbp,%rax,1)
+
+  while (--i >= 0)
+ 202:	eb 19                	jmp    21d <printint64+0xc6>
+    putc(fd, buf[i]);
+ 204:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 207:	48 98                	cltq
+ 209:	0f b6 44 05 d0       	movzbl -0x30(%rbp,%rax,1),%eax
+ 20e:	0f be d0             	movsbl %al,%edx
+ 211:	8b 45 cc             	mov    -0x34(%rbp),%eax
+ 214:	89 d6                	mov    %edx,%esi
+ 216:	89 c7                	mov    %eax,%edi
+ 218:	e8 11 ff ff ff       	call   12e <putc>
+  while (--i >= 0)
+ 21d:	83 6d fc 01          	subl   $0x1,-0x4(%rbp)
+ 221:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+ 225:	79 dd                	jns    204 <printint64+0xad>
+}
+ 227:	90                   	nop
+ 228:	90                   	nop
+ 229:	c9                   	leave
+ 22a:	c3                   	ret
+
+000000000000022b <printint>:
+
+static void printint(int fd, int xx, int base, int sgn) {
+ 22b:	55                   	push   %rbp
+ 22c:	48 89 e5             	mov    %rsp,%rbp
+ 22f:	48 83 ec 30          	sub    $0x30,%rsp
+ 233:	89 7d dc             	mov    %edi,-0x24(%rbp)
+ 236:	89 75 d8             	mov    %esi,-0x28(%rbp)
+ 239:	89 55 d4             	mov    %edx,-0x2c(%rbp)
+ 23c:	89 4d d0             	mov    %ecx,-0x30(%rbp)
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+ 23f:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+  if (sgn && xx < 0) {
+ 246:	83 7d d0 00          	cmpl   $0x0,-0x30(%rbp)
+ 24a:	74 17                	je     263 <printint+0x38>
+ 24c:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+ 250:	79 11                	jns    263 <printint+0x38>
+    neg = 1;
+ 252:	c7 45 f8 01 00 00 00 	movl   $0x1,-0x8(%rbp)
+    x = -xx;
+ 259:	8b 45 d8             	mov    -0x28(%rbp),%eax
+ 25c:	f7 d8                	neg    %eax
+ 25e:	89 45 f4             	mov    %eax,-0xc(%rbp)
+ 261:	eb 06                	jmp    269 <printint+0x3e>
+  } else {
+    x = xx;
+ 263:	8b 45 d8             	mov    -0x28(%rbp),%eax
+ 266:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  }
+
+  i = 0;
+ 269:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  do {
+    buf[i++] = digits[x % base];
+ 270:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+ 273:	8b 45 f4             	mov    -0xc(%rbp),%eax
+ 276:	ba 00 00 00 00       	mov    $0x0,%edx
+ 27b:	f7 f1                	div    %ecx
+ 27d:	89 d1                	mov    %edx,%ecx
+ 27f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 282:	8d 50 01             	lea    0x1(%rax),%edx
+ 285:	89 55 fc             	mov    %edx,-0x4(%rbp)
+ 288:	89 c9                	mov    %ecx,%ecx
+ 28a:	48 8d 15 9f 0c 00 00 	lea    0xc9f(%rip),%rdx        # f30 <digits.0>
+ 291:	0f b6 14 11          	movzbl (%rcx,%rdx,1),%edx
+ 295:	48 98                	cltq
+ 297:	88 54 05 e4          	mov    %dl,-0x1c(%rbp,%rax,1)
+  } while ((x /= base) != 0);
+ 29b:	8b 75 d4             	mov    -0x2c(%rbp),%esi
+ 29e:	8b 45 f4             	mov    -0xc(%rbp),%eax
+ 2a1:	ba 00 00 00 00       	mov    $0x0,%edx
+ 2a6:	f7 f6                	div    %esi
+ 2a8:	89 45 f4             	mov    %eax,-0xc(%rbp)
+ 2ab:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+ 2af:	75 bf                	jne    270 <printint+0x45>
+  if (neg)
+ 2b1:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+ 2b5:	74 2b                	je     2e2 <printint+0xb7>
+    buf[i++] = '-';
+ 2b7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 2ba:	8d 50 01             	lea    0x1(%rax),%edx
+ 2bd:	89 55 fc             	mov    %edx,-0x4(%rbp)
+ 2c0:	48 98                	cltq
+ 2c2:	c6 44 05 e4 2d       	movb   $0x2d,-0x1c(%rbp,%rax,1)
+
+  while (--i >= 0)
+ 2c7:	eb 19                	jmp    2e2 <printint+0xb7>
+    putc(fd, buf[i]);
+ 2c9:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 2cc:	48 98                	cltq
+ 2ce:	0f b6 44 05 e4       	movzbl -0x1c(%rbp,%rax,1),%eax
+ 2d3:	0f be d0             	movsbl %al,%edx
+ 2d6:	8b 45 dc             	mov    -0x24(%rbp),%eax
+ 2d9:	89 d6                	mov    %edx,%esi
+ 2db:	89 c7                	mov    %eax,%edi
+ 2dd:	e8 4c fe ff ff       	call   12e <putc>
+  while (--i >= 0)
+ 2e2:	83 6d fc 01          	subl   $0x1,-0x4(%rbp)
+ 2e6:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+ 2ea:	79 dd                	jns    2c9 <printint+0x9e>
+}
+ 2ec:	90                   	nop
+ 2ed:	90                   	nop
+ 2ee:	c9                   	leave
+ 2ef:	c3                   	ret
+
+00000000000002f0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void printf(int fd, char *fmt, ...) {
+ 2f0:	55                   	push   %rbp
+ 2f1:	48 89 e5             	mov    %rsp,%rbp
+ 2f4:	48 83 ec 70          	sub    $0x70,%rsp
+ 2f8:	89 7d 9c             	mov    %edi,-0x64(%rbp)
+ 2fb:	48 89 75 90          	mov    %rsi,-0x70(%rbp)
+ 2ff:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+ 303:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+ 307:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+ 30b:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+  char *s;
+  int c, i, state;
+  int lflag;
+  va_list valist;
+  va_start(valist, fmt);
+ 30f:	c7 45 a0 10 00 00 00 	movl   $0x10,-0x60(%rbp)
+ 316:	48 8d 45 10          	lea    0x10(%rbp),%rax
+ 31a:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+ 31e:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+ 322:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+
+  state = 0;
+ 326:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%rbp)
+  for (i = 0; fmt[i]; i++) {
+ 32d:	c7 45 c4 00 00 00 00 	movl   $0x0,-0x3c(%rbp)
+ 334:	e9 6b 02 00 00       	jmp    5a4 <printf+0x2b4>
+    c = fmt[i] & 0xff;
+ 339:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+ 33c:	48 63 d0             	movslq %eax,%rdx
+ 33f:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+ 343:	48 01 d0             	add    %rdx,%rax
+ 346:	0f b6 00             	movzbl (%rax),%eax
+ 349:	0f be c0             	movsbl %al,%eax
+ 34c:	25 ff 00 00 00       	and    $0xff,%eax
+ 351:	89 45 b8             	mov    %eax,-0x48(%rbp)
+    if (state == 0) {
+ 354:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+ 358:	75 30                	jne    38a <printf+0x9a>
+      if (c == '%') {
+ 35a:	83 7d b8 25          	cmpl   $0x25,-0x48(%rbp)
+ 35e:	75 13                	jne    373 <printf+0x83>
+        state = '%';
+ 360:	c7 45 c0 25 00 00 00 	movl   $0x25,-0x40(%rbp)
+        lflag = 0;
+ 367:	c7 45 bc 00 00 00 00 	movl   $0x0,-0x44(%rbp)
+ 36e:	e9 2d 02 00 00       	jmp    5a0 <printf+0x2b0>
+      } else {
+        putc(fd, c);
+ 373:	8b 45 b8             	mov    -0x48(%rbp),%eax
+ 376:	0f be d0             	movsbl %al,%edx
+ 379:	8b 45 9c             	mov    -0x64(%rbp),%eax
+ 37c:	89 d6                	mov    %edx,%esi
+ 37e:	89 c7                	mov    %eax,%edi
+ 380:	e8 a9 fd ff ff       	call   12e <putc>
+ 385:	e9 16 02 00 00       	jmp    5a0 <printf+0x2b0>
+      }
+    } else if (state == '%') {
+ 38a:	83 7d c0 25          	cmpl   $0x25,-0x40(%rbp)
+ 38e:	0f 85 0c 02 00 00    	jne    5a0 <printf+0x2b0>
+      if (c == 'l') {
+ 394:	83 7d b8 6c          	cmpl   $0x6c,-0x48(%rbp)
+ 398:	75 0c                	jne    3a6 <printf+0xb6>
+        lflag = 1;
+ 39a:	c7 45 bc 01 00 00 00 	movl   $0x1,-0x44(%rbp)
+        continue;
+ 3a1:	e9 fa 01 00 00       	jmp    5a0 <printf+0x2b0>
+      } else if (c == 'd') {
+ 3a6:	83 7d b8 64          	cmpl   $0x64,-0x48(%rbp)
+ 3aa:	0f 85 95 00 00 00    	jne    445 <printf+0x155>
+        if (lflag == 1)
+ 3b0:	83 7d bc 01          	cmpl   $0x1,-0x44(%rbp)
+ 3b4:	75 49                	jne    3ff <printf+0x10f>
+          printint64(fd, va_arg(valist, int64_t), 10, 1);
+ 3b6:	8b 45 a0             	mov    -0x60(%rbp),%eax
+ 3b9:	83 f8 2f             	cmp    $0x2f,%eax
+ 3bc:	77 17                	ja     3d5 <printf+0xe5>
+ 3be:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+ 3c2:	8b 55 a0             	mov    -0x60(%rbp),%edx
+ 3c5:	89 d2                	mov    %edx,%edx
+ 3c7:	48 01 d0             	add    %rdx,%rax
+ 3ca:	8b 55 a0             	mov    -0x60(%rbp),%edx
+ 3cd:	83 c2 08             	add    $0x8,%edx
+ 3d0:	89 55 a0             	mov    %edx,-0x60(%rbp)
+ 3d3:	eb 0c                	jmp    3e1 <printf+0xf1>
+ 3d5:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+ 3d9:	48 8d 50 08          	lea    0x8(%rax),%rdx
+ 3dd:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+ 3e1:	48 8b 00             	mov    (%rax),%rax
+ 3e4:	89 c6                	mov    %eax,%esi
+ 3e6:	8b 45 9c             	mov    -0x64(%rbp),%eax
+ 3e9:	b9 01 00 00 00       	mov    $0x1,%ecx
+ 3ee:	ba 0a 00 00 00       	mov    $0xa,%edx
+ 3f3:	89 c7                	mov    %eax,%edi
+ 3f5:	e8 5d fd ff ff       	call   157 <printint64>
+ 3fa:	e9 9a 01 00 00       	jmp    599 <printf+0x2a9>
+        else
+          printint(fd, va_arg(valist, int), 10, 1);
+ 3ff:	8b 45 a0             	mov    -0x60(%rbp),%eax
+ 402:	83 f8 2f             	cmp    $0x2f,%eax
+ 405:	77 17                	ja     41e <printf+0x12e>
+ 407:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+ 40b:	8b 55 a0             	mov    -0x60(%rbp),%edx
+ 40e:	89 d2                	mov    %edx,%edx
+ 410:	48 01 d0             	add    %rdx,%rax
+ 413:	8b 55 a0             	mov    -0x60(%rbp),%edx
+ 416:	83 c2 08             	add    $0x8,%edx
+ 419:	89 55 a0             	mov    %edx,-0x60(%rbp)
+ 41c:	eb 0c                	jmp    42a <printf+0x13a>
+ 41e:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+ 422:	48 8d 50 08          	lea    0x8(%rax),%rdx
+ 426:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+ 42a:	8b 30                	mov    (%rax),%esi
+ 42c:	8b 45 9c             	mov    -0x64(%rbp),%eax
+ 42f:	b9 01 00 00 00       	mov    $0x1,%ecx
+ 434:	ba 0a 00 00 00       	mov    $0xa,%edx
+ 439:	89 c7                	mov    %eax,%edi
+ 43b:	e8 eb fd ff ff       	call   22b <printint>
+ 440:	e9 54 01 00 00       	jmp    599 <printf+0x2a9>
+      } else if (c == 'x' || c == 'p') {
+ 445:	83 7d b8 78          	cmpl   $0x78,-0x48(%rbp)
+ 449:	74 0a                	je     455 <printf+0x165>
+ 44b:	83 7d b8 70          	cmpl   $0x70,-0x48(%rbp)
+ 44f:	0f 85 95 00 00 00    	jne    4ea <printf+0x1fa>
+        if (lflag == 1)
+ 455:	83 7d bc 01          	cmpl   $0x1,-0x44(%rbp)
+ 459:	75 49                	jne    4a4 <printf+0x1b4>
+          printint64(fd, va_arg(valist, int64_t), 16, 0);
+ 45b:	8b 45 a0             	mov    -0x60(%rbp),%eax
+ 45e:	83 f8 2f             	cmp    $0x2f,%eax
+ 461:	77 17                	ja     47a <printf+0x18a>
+ 463:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+ 467:	8b 55 a0             	mov    -0x60(%rbp),%edx
+ 46a:	89 d2                	mov    %edx,%edx
+ 46c:	48 01 d0             	add    %rdx,%rax
+ 46f:	8b 55 a0             	mov    -0x60(%rbp),%edx
+ 472:	83 c2 08             	add    $0x8,%edx
+ 475:	89 55 a0             	mov    %edx,-0x60(%rbp)
+ 478:	eb 0c                	jmp    486 <printf+0x196>
+ 47a:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+ 47e:	48 8d 50 08          	lea    0x8(%rax),%rdx
+ 482:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+ 486:	48 8b 00             	mov    (%rax),%rax
+ 489:	89 c6                	mov    %eax,%esi
+ 48b:	8b 45 9c             	mov    -0x64(%rbp),%eax
+ 48e:	b9 00 00 00 00       	mov    $0x0,%ecx
+ 493:	ba 10 00 00 00       	mov    $0x10,%edx
+ 498:	89 c7                	mov    %eax,%edi
+ 49a:	e8 b8 fc ff ff       	call   157 <printint64>
+        if (lflag == 1)
+ 49f:	e9 f5 00 00 00       	jmp    599 <printf+0x2a9>
+        else
+          printint(fd, va_arg(valist, int), 16, 0);
+ 4a4:	8b 45 a0             	mov    -0x60(%rbp),%eax
+ 4a7:	83 f8 2f             	cmp    $0x2f,%eax
+ 4aa:	77 17                	ja     4c3 <printf+0x1d3>
+ 4ac:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+ 4b0:	8b 55 a0             	mov    -0x60(%rbp),%edx
+ 4b3:	89 d2                	mov    %edx,%edx
+ 4b5:	48 01 d0             	add    %rdx,%rax
+ 4b8:	8b 55 a0             	mov    -0x60(%rbp),%edx
+ 4bb:	83 c2 08             	add    $0x8,%edx
+ 4be:	89 55 a0             	mov    %edx,-0x60(%rbp)
+ 4c1:	eb 0c                	jmp    4cf <printf+0x1df>
+ 4c3:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+ 4c7:	48 8d 50 08          	lea    0x8(%rax),%rdx
+ 4cb:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+ 4cf:	8b 30                	mov    (%rax),%esi
+ 4d1:	8b 45 9c             	mov    -0x64(%rbp),%eax
+ 4d4:	b9 00 00 00 00       	mov    $0x0,%ecx
+ 4d9:	ba 10 00 00 00       	mov    $0x10,%edx
+ 4de:	89 c7                	mov    %eax,%edi
+ 4e0:	e8 46 fd ff ff       	call   22b <printint>
+        if (lflag == 1)
+ 4e5:	e9 af 00 00 00       	jmp    599 <printf+0x2a9>
+      } else if (c == 's') {
+ 4ea:	83 7d b8 73          	cmpl   $0x73,-0x48(%rbp)
+ 4ee:	75 6e                	jne    55e <printf+0x26e>
+        if ((s = (char *)va_arg(valist, char *)) == 0)
+ 4f0:	8b 45 a0             	mov    -0x60(%rbp),%eax
+ 4f3:	83 f8 2f             	cmp    $0x2f,%eax
+ 4f6:	77 17                	ja     50f <printf+0x21f>
+ 4f8:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+ 4fc:	8b 55 a0             	mov    -0x60(%rbp),%edx
+ 4ff:	89 d2                	mov    %edx,%edx
+ 501:	48 01 d0             	add    %rdx,%rax
+ 504:	8b 55 a0             	mov    -0x60(%rbp),%edx
+ 507:	83 c2 08             	add    $0x8,%edx
+ 50a:	89 55 a0             	mov    %edx,-0x60(%rbp)
+ 50d:	eb 0c                	jmp    51b <printf+0x22b>
+ 50f:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+ 513:	48 8d 50 08          	lea    0x8(%rax),%rdx
+ 517:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+ 51b:	48 8b 00             	mov    (%rax),%rax
+ 51e:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+ 522:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+ 527:	75 28                	jne    551 <printf+0x261>
+          s = "(null)";
+ 529:	48 8d 05 7e 07 00 00 	lea    0x77e(%rip),%rax        # cae <malloc+0x1d0>
+ 530:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        for (; *s; s++)
+ 534:	eb 1b                	jmp    551 <printf+0x261>
+          putc(fd, *s);
+ 536:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+ 53a:	0f b6 00             	movzbl (%rax),%eax
+ 53d:	0f be d0             	movsbl %al,%edx
+ 540:	8b 45 9c             	mov    -0x64(%rbp),%eax
+ 543:	89 d6                	mov    %edx,%esi
+ 545:	89 c7                	mov    %eax,%edi
+ 547:	e8 e2 fb ff ff       	call   12e <putc>
+        for (; *s; s++)
+ 54c:	48 83 45 c8 01       	addq   $0x1,-0x38(%rbp)
+ 551:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+ 555:	0f b6 00             	movzbl (%rax),%eax
+ 558:	84 c0                	test   %al,%al
+ 55a:	75 da                	jne    536 <printf+0x246>
+ 55c:	eb 3b                	jmp    599 <printf+0x2a9>
+      } else if (c == '%') {
+ 55e:	83 7d b8 25          	cmpl   $0x25,-0x48(%rbp)
+ 562:	75 14                	jne    578 <printf+0x288>
+        putc(fd, c);
+ 564:	8b 45 b8             	mov    -0x48(%rbp),%eax
+ 567:	0f be d0             	movsbl %al,%edx
+ 56a:	8b 45 9c             	mov    -0x64(%rbp),%eax
+ 56d:	89 d6                	mov    %edx,%esi
+ 56f:	89 c7                	mov    %eax,%edi
+ 571:	e8 b8 fb ff ff       	call   12e <putc>
+ 576:	eb 21                	jmp    599 <printf+0x2a9>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+ 578:	8b 45 9c             	mov    -0x64(%rbp),%eax
+ 57b:	be 25 00 00 00       	mov    $0x25,%esi
+ 580:	89 c7                	mov    %eax,%edi
+ 582:	e8 a7 fb ff ff       	call   12e <putc>
+        putc(fd, c);
+ 587:	8b 45 b8             	mov    -0x48(%rbp),%eax
+ 58a:	0f be d0             	movsbl %al,%edx
+ 58d:	8b 45 9c             	mov    -0x64(%rbp),%eax
+ 590:	89 d6                	mov    %edx,%esi
+ 592:	89 c7                	mov    %eax,%edi
+ 594:	e8 95 fb ff ff       	call   12e <putc>
+      }
+      state = 0;
+ 599:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%rbp)
+  for (i = 0; fmt[i]; i++) {
+ 5a0:	83 45 c4 01          	addl   $0x1,-0x3c(%rbp)
+ 5a4:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+ 5a7:	48 63 d0             	movslq %eax,%rdx
+ 5aa:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+ 5ae:	48 01 d0             	add    %rdx,%rax
+ 5b1:	0f b6 00             	movzbl (%rax),%eax
+ 5b4:	84 c0                	test   %al,%al
+ 5b6:	0f 85 7d fd ff ff    	jne    339 <printf+0x49>
+    }
+  }
+
+  va_end(valist);
+}
+ 5bc:	90                   	nop
+ 5bd:	90                   	nop
+ 5be:	c9                   	leave
+ 5bf:	c3                   	ret
+
+00000000000005c0 <stosb>:
+      break;
+    buf[i++] = c;
+    if (c == '\n' || c == '\r')
+      break;
+  }
+  buf[i] = '\0';
+ 5c0:	55                   	push   %rbp
+ 5c1:	48 89 e5             	mov    %rsp,%rbp
+ 5c4:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+ 5c8:	89 75 f4             	mov    %esi,-0xc(%rbp)
+ 5cb:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  return buf;
+ 5ce:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+ 5d2:	8b 55 f0             	mov    -0x10(%rbp),%edx
+ 5d5:	8b 45 f4             	mov    -0xc(%rbp),%eax
+ 5d8:	48 89 ce             	mov    %rcx,%rsi
+ 5db:	48 89 f7             	mov    %rsi,%rdi
+ 5de:	89 d1                	mov    %edx,%ecx
+ 5e0:	fc                   	cld
+ 5e1:	f3 aa                	rep stos %al,%es:(%rdi)
+ 5e3:	89 ca                	mov    %ecx,%edx
+ 5e5:	48 89 fe             	mov    %rdi,%rsi
+ 5e8:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+ 5ec:	89 55 f0             	mov    %edx,-0x10(%rbp)
+}
+
+int stat(char *n, struct stat *st) {
+  int fd;
+ 5ef:	90                   	nop
+ 5f0:	5d                   	pop    %rbp
+ 5f1:	c3                   	ret
+
+00000000000005f2 <strcpy>:
+char *strcpy(char *s, char *t) {
+ 5f2:	55                   	push   %rbp
+ 5f3:	48 89 e5             	mov    %rsp,%rbp
+ 5f6:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+ 5fa:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  os = s;
+ 5fe:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 602:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while ((*s++ = *t++) != 0)
+ 606:	90                   	nop
+ 607:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+ 60b:	48 8d 42 01          	lea    0x1(%rdx),%rax
+ 60f:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+ 613:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 617:	48 8d 48 01          	lea    0x1(%rax),%rcx
+ 61b:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+ 61f:	0f b6 12             	movzbl (%rdx),%edx
+ 622:	88 10                	mov    %dl,(%rax)
+ 624:	0f b6 00             	movzbl (%rax),%eax
+ 627:	84 c0                	test   %al,%al
+ 629:	75 dc                	jne    607 <strcpy+0x15>
+  return os;
+ 62b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+ 62f:	5d                   	pop    %rbp
+ 630:	c3                   	ret
+
+0000000000000631 <strcmp>:
+int strcmp(const char *p, const char *q) {
+ 631:	55                   	push   %rbp
+ 632:	48 89 e5             	mov    %rsp,%rbp
+ 635:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+ 639:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  while (*p && *p == *q)
+ 63d:	eb 0a                	jmp    649 <strcmp+0x18>
+    p++, q++;
+ 63f:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+ 644:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (*p && *p == *q)
+ 649:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 64d:	0f b6 00             	movzbl (%rax),%eax
+ 650:	84 c0                	test   %al,%al
+ 652:	74 12                	je     666 <strcmp+0x35>
+ 654:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 658:	0f b6 10             	movzbl (%rax),%edx
+ 65b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ 65f:	0f b6 00             	movzbl (%rax),%eax
+ 662:	38 c2                	cmp    %al,%dl
+ 664:	74 d9                	je     63f <strcmp+0xe>
+  return (uchar)*p - (uchar)*q;
+ 666:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 66a:	0f b6 00             	movzbl (%rax),%eax
+ 66d:	0f b6 d0             	movzbl %al,%edx
+ 670:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ 674:	0f b6 00             	movzbl (%rax),%eax
+ 677:	0f b6 c0             	movzbl %al,%eax
+ 67a:	29 c2                	sub    %eax,%edx
+ 67c:	89 d0                	mov    %edx,%eax
+}
+ 67e:	5d                   	pop    %rbp
+ 67f:	c3                   	ret
+
+0000000000000680 <strlen>:
+uint strlen(char *s) {
+ 680:	55                   	push   %rbp
+ 681:	48 89 e5             	mov    %rsp,%rbp
+ 684:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  for (n = 0; s[n]; n++)
+ 688:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+ 68f:	eb 04                	jmp    695 <strlen+0x15>
+ 691:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+ 695:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 698:	48 63 d0             	movslq %eax,%rdx
+ 69b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 69f:	48 01 d0             	add    %rdx,%rax
+ 6a2:	0f b6 00             	movzbl (%rax),%eax
+ 6a5:	84 c0                	test   %al,%al
+ 6a7:	75 e8                	jne    691 <strlen+0x11>
+  return n;
+ 6a9:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+ 6ac:	5d                   	pop    %rbp
+ 6ad:	c3                   	ret
+
+00000000000006ae <memset>:
+void *memset(void *dst, int c, uint n) {
+ 6ae:	55                   	push   %rbp
+ 6af:	48 89 e5             	mov    %rsp,%rbp
+ 6b2:	48 83 ec 10          	sub    $0x10,%rsp
+ 6b6:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+ 6ba:	89 75 f4             	mov    %esi,-0xc(%rbp)
+ 6bd:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  stosb(dst, c, n);
+ 6c0:	8b 55 f0             	mov    -0x10(%rbp),%edx
+ 6c3:	8b 4d f4             	mov    -0xc(%rbp),%ecx
+ 6c6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 6ca:	89 ce                	mov    %ecx,%esi
+ 6cc:	48 89 c7             	mov    %rax,%rdi
+ 6cf:	e8 ec fe ff ff       	call   5c0 <stosb>
+  return dst;
+ 6d4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+ 6d8:	c9                   	leave
+ 6d9:	c3                   	ret
+
+00000000000006da <strchr>:
+char *strchr(const char *s, char c) {
+ 6da:	55                   	push   %rbp
+ 6db:	48 89 e5             	mov    %rsp,%rbp
+ 6de:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+ 6e2:	89 f0                	mov    %esi,%eax
+ 6e4:	88 45 f4             	mov    %al,-0xc(%rbp)
+  for (; *s; s++)
+ 6e7:	eb 17                	jmp    700 <strchr+0x26>
+    if (*s == c)
+ 6e9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 6ed:	0f b6 00             	movzbl (%rax),%eax
+ 6f0:	38 45 f4             	cmp    %al,-0xc(%rbp)
+ 6f3:	75 06                	jne    6fb <strchr+0x21>
+      return (char *)s;
+ 6f5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 6f9:	eb 15                	jmp    710 <strchr+0x36>
+  for (; *s; s++)
+ 6fb:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+ 700:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 704:	0f b6 00             	movzbl (%rax),%eax
+ 707:	84 c0                	test   %al,%al
+ 709:	75 de                	jne    6e9 <strchr+0xf>
+  return 0;
+ 70b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 710:	5d                   	pop    %rbp
+ 711:	c3                   	ret
+
+0000000000000712 <gets>:
+char *gets(char *buf, int max) {
+ 712:	55                   	push   %rbp
+ 713:	48 89 e5             	mov    %rsp,%rbp
+ 716:	48 83 ec 20          	sub    $0x20,%rsp
+ 71a:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+ 71e:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  for (i = 0; i + 1 < max;) {
+ 721:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+ 728:	eb 48                	jmp    772 <gets+0x60>
+    cc = read(0, &c, 1);
+ 72a:	48 8d 45 f7          	lea    -0x9(%rbp),%rax
+ 72e:	ba 01 00 00 00       	mov    $0x1,%edx
+ 733:	48 89 c6             	mov    %rax,%rsi
+ 736:	bf 00 00 00 00       	mov    $0x0,%edi
+ 73b:	e8 6f 01 00 00       	call   8af <read>
+ 740:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    if (cc < 1)
+ 743:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+ 747:	7e 36                	jle    77f <gets+0x6d>
+    buf[i++] = c;
+ 749:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 74c:	8d 50 01             	lea    0x1(%rax),%edx
+ 74f:	89 55 fc             	mov    %edx,-0x4(%rbp)
+ 752:	48 63 d0             	movslq %eax,%rdx
+ 755:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 759:	48 01 c2             	add    %rax,%rdx
+ 75c:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+ 760:	88 02                	mov    %al,(%rdx)
+    if (c == '\n' || c == '\r')
+ 762:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+ 766:	3c 0a                	cmp    $0xa,%al
+ 768:	74 16                	je     780 <gets+0x6e>
+ 76a:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+ 76e:	3c 0d                	cmp    $0xd,%al
+ 770:	74 0e                	je     780 <gets+0x6e>
+  for (i = 0; i + 1 < max;) {
+ 772:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 775:	83 c0 01             	add    $0x1,%eax
+ 778:	39 45 e4             	cmp    %eax,-0x1c(%rbp)
+ 77b:	7f ad                	jg     72a <gets+0x18>
+ 77d:	eb 01                	jmp    780 <gets+0x6e>
+      break;
+ 77f:	90                   	nop
+  buf[i] = '\0';
+ 780:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 783:	48 63 d0             	movslq %eax,%rdx
+ 786:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 78a:	48 01 d0             	add    %rdx,%rax
+ 78d:	c6 00 00             	movb   $0x0,(%rax)
+  return buf;
+ 790:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+ 794:	c9                   	leave
+ 795:	c3                   	ret
+
+0000000000000796 <stat>:
+int stat(char *n, struct stat *st) {
+ 796:	55                   	push   %rbp
+ 797:	48 89 e5             	mov    %rsp,%rbp
+ 79a:	48 83 ec 20          	sub    $0x20,%rsp
+ 79e:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+ 7a2:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 7a6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 7aa:	be 00 00 00 00       	mov    $0x0,%esi
+ 7af:	48 89 c7             	mov    %rax,%rdi
+ 7b2:	e8 20 01 00 00       	call   8d7 <open>
+ 7b7:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  if (fd < 0)
+ 7ba:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+ 7be:	79 07                	jns    7c7 <stat+0x31>
+    return -1;
+ 7c0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 7c5:	eb 21                	jmp    7e8 <stat+0x52>
+  r = fstat(fd, st);
+ 7c7:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+ 7cb:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 7ce:	48 89 d6             	mov    %rdx,%rsi
+ 7d1:	89 c7                	mov    %eax,%edi
+ 7d3:	e8 17 01 00 00       	call   8ef <fstat>
+ 7d8:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  close(fd);
+ 7db:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 7de:	89 c7                	mov    %eax,%edi
+ 7e0:	e8 da 00 00 00       	call   8bf <close>
+  return r;
+ 7e5:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+ 7e8:	c9                   	leave
+ 7e9:	c3                   	ret
+
+00000000000007ea <atoi>:
+
+int atoi(const char *s) {
+ 7ea:	55                   	push   %rbp
+ 7eb:	48 89 e5             	mov    %rsp,%rbp
+ 7ee:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int n;
+
+  n = 0;
+ 7f2:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  while ('0' <= *s && *s <= '9')
+ 7f9:	eb 28                	jmp    823 <atoi+0x39>
+    n = n * 10 + *s++ - '0';
+ 7fb:	8b 55 fc             	mov    -0x4(%rbp),%edx
+ 7fe:	89 d0                	mov    %edx,%eax
+ 800:	c1 e0 02             	shl    $0x2,%eax
+ 803:	01 d0                	add    %edx,%eax
+ 805:	01 c0                	add    %eax,%eax
+ 807:	89 c1                	mov    %eax,%ecx
+ 809:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 80d:	48 8d 50 01          	lea    0x1(%rax),%rdx
+ 811:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+ 815:	0f b6 00             	movzbl (%rax),%eax
+ 818:	0f be c0             	movsbl %al,%eax
+ 81b:	01 c8                	add    %ecx,%eax
+ 81d:	83 e8 30             	sub    $0x30,%eax
+ 820:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while ('0' <= *s && *s <= '9')
+ 823:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 827:	0f b6 00             	movzbl (%rax),%eax
+ 82a:	3c 2f                	cmp    $0x2f,%al
+ 82c:	7e 0b                	jle    839 <atoi+0x4f>
+ 82e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 832:	0f b6 00             	movzbl (%rax),%eax
+ 835:	3c 39                	cmp    $0x39,%al
+ 837:	7e c2                	jle    7fb <atoi+0x11>
+  return n;
+ 839:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+ 83c:	5d                   	pop    %rbp
+ 83d:	c3                   	ret
+
+000000000000083e <memmove>:
+
+void *memmove(void *vdst, void *vsrc, int n) {
+ 83e:	55                   	push   %rbp
+ 83f:	48 89 e5             	mov    %rsp,%rbp
+ 842:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+ 846:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+ 84a:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  char *dst, *src;
+
+  dst = vdst;
+ 84d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 851:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  src = vsrc;
+ 855:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+ 859:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  while (n-- > 0)
+ 85d:	eb 1d                	jmp    87c <memmove+0x3e>
+    *dst++ = *src++;
+ 85f:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+ 863:	48 8d 42 01          	lea    0x1(%rdx),%rax
+ 867:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+ 86b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 86f:	48 8d 48 01          	lea    0x1(%rax),%rcx
+ 873:	48 89 4d f8          	mov    %rcx,-0x8(%rbp)
+ 877:	0f b6 12             	movzbl (%rdx),%edx
+ 87a:	88 10                	mov    %dl,(%rax)
+  while (n-- > 0)
+ 87c:	8b 45 dc             	mov    -0x24(%rbp),%eax
+ 87f:	8d 50 ff             	lea    -0x1(%rax),%edx
+ 882:	89 55 dc             	mov    %edx,-0x24(%rbp)
+ 885:	85 c0                	test   %eax,%eax
+ 887:	7f d6                	jg     85f <memmove+0x21>
+  return vdst;
+ 889:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 88d:	5d                   	pop    %rbp
+ 88e:	c3                   	ret
+
+000000000000088f <fork>:
+  name:                                                                        \
+  movl $SYS_##name, % eax;                                                     \
+  int $TRAP_SYSCALL;                                                           \
+  ret
+
+SYSCALL(fork)
+ 88f:	b8 01 00 00 00       	mov    $0x1,%eax
+ 894:	cd 40                	int    $0x40
+ 896:	c3                   	ret
+
+0000000000000897 <exit>:
+SYSCALL(exit)
+ 897:	b8 02 00 00 00       	mov    $0x2,%eax
+ 89c:	cd 40                	int    $0x40
+ 89e:	c3                   	ret
+
+000000000000089f <wait>:
+SYSCALL(wait)
+ 89f:	b8 03 00 00 00       	mov    $0x3,%eax
+ 8a4:	cd 40                	int    $0x40
+ 8a6:	c3                   	ret
+
+00000000000008a7 <pipe>:
+SYSCALL(pipe)
+ 8a7:	b8 04 00 00 00       	mov    $0x4,%eax
+ 8ac:	cd 40                	int    $0x40
+ 8ae:	c3                   	ret
+
+00000000000008af <read>:
+SYSCALL(read)
+ 8af:	b8 05 00 00 00       	mov    $0x5,%eax
+ 8b4:	cd 40                	int    $0x40
+ 8b6:	c3                   	ret
+
+00000000000008b7 <write>:
+SYSCALL(write)
+ 8b7:	b8 10 00 00 00       	mov    $0x10,%eax
+ 8bc:	cd 40                	int    $0x40
+ 8be:	c3                   	ret
+
+00000000000008bf <close>:
+SYSCALL(close)
+ 8bf:	b8 15 00 00 00       	mov    $0x15,%eax
+ 8c4:	cd 40                	int    $0x40
+ 8c6:	c3                   	ret
+
+00000000000008c7 <kill>:
+SYSCALL(kill)
+ 8c7:	b8 06 00 00 00       	mov    $0x6,%eax
+ 8cc:	cd 40                	int    $0x40
+ 8ce:	c3                   	ret
+
+00000000000008cf <exec>:
+SYSCALL(exec)
+ 8cf:	b8 07 00 00 00       	mov    $0x7,%eax
+ 8d4:	cd 40                	int    $0x40
+ 8d6:	c3                   	ret
+
+00000000000008d7 <open>:
+SYSCALL(open)
+ 8d7:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 8dc:	cd 40                	int    $0x40
+ 8de:	c3                   	ret
+
+00000000000008df <mknod>:
+SYSCALL(mknod)
+ 8df:	b8 11 00 00 00       	mov    $0x11,%eax
+ 8e4:	cd 40                	int    $0x40
+ 8e6:	c3                   	ret
+
+00000000000008e7 <unlink>:
+SYSCALL(unlink)
+ 8e7:	b8 12 00 00 00       	mov    $0x12,%eax
+ 8ec:	cd 40                	int    $0x40
+ 8ee:	c3                   	ret
+
+00000000000008ef <fstat>:
+SYSCALL(fstat)
+ 8ef:	b8 08 00 00 00       	mov    $0x8,%eax
+ 8f4:	cd 40                	int    $0x40
+ 8f6:	c3                   	ret
+
+00000000000008f7 <link>:
+SYSCALL(link)
+ 8f7:	b8 13 00 00 00       	mov    $0x13,%eax
+ 8fc:	cd 40                	int    $0x40
+ 8fe:	c3                   	ret
+
+00000000000008ff <mkdir>:
+SYSCALL(mkdir)
+ 8ff:	b8 14 00 00 00       	mov    $0x14,%eax
+ 904:	cd 40                	int    $0x40
+ 906:	c3                   	ret
+
+0000000000000907 <chdir>:
+SYSCALL(chdir)
+ 907:	b8 09 00 00 00       	mov    $0x9,%eax
+ 90c:	cd 40                	int    $0x40
+ 90e:	c3                   	ret
+
+000000000000090f <dup>:
+SYSCALL(dup)
+ 90f:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 914:	cd 40                	int    $0x40
+ 916:	c3                   	ret
+
+0000000000000917 <getpid>:
+SYSCALL(getpid)
+ 917:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 91c:	cd 40                	int    $0x40
+ 91e:	c3                   	ret
+
+000000000000091f <sbrk>:
+SYSCALL(sbrk)
+ 91f:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 924:	cd 40                	int    $0x40
+ 926:	c3                   	ret
+
+0000000000000927 <sleep>:
+SYSCALL(sleep)
+ 927:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 92c:	cd 40                	int    $0x40
+ 92e:	c3                   	ret
+
+000000000000092f <uptime>:
+SYSCALL(uptime)
+ 92f:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 934:	cd 40                	int    $0x40
+ 936:	c3                   	ret
+
+0000000000000937 <sysinfo>:
+SYSCALL(sysinfo)
+ 937:	b8 16 00 00 00       	mov    $0x16,%eax
+ 93c:	cd 40                	int    $0x40
+ 93e:	c3                   	ret
+
+000000000000093f <crashn>:
+SYSCALL(crashn)
+ 93f:	b8 17 00 00 00       	mov    $0x17,%eax
+ 944:	cd 40                	int    $0x40
+ 946:	c3                   	ret
+
+0000000000000947 <sync>:
+SYSCALL(sync)
+ 947:	b8 18 00 00 00       	mov    $0x18,%eax
+ 94c:	cd 40                	int    $0x40
+ 94e:	c3                   	ret
+
+000000000000094f <fsync>:
+SYSCALL(fsync)
+ 94f:	b8 19 00 00 00       	mov    $0x19,%eax
+ 954:	cd 40                	int    $0x40
+ 956:	c3                   	ret
+
+0000000000000957 <free>:
+typedef union header Header;
+
+static Header base;
+static Header *freep;
+
+void free(void *ap) {
+ 957:	55                   	push   %rbp
+ 958:	48 89 e5             	mov    %rsp,%rbp
+ 95b:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  Header *bp, *p;
+
+  bp = (Header *)ap - 1;
+ 95f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 963:	48 83 e8 10          	sub    $0x10,%rax
+ 967:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  for (p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 96b:	48 8b 05 ee 05 00 00 	mov    0x5ee(%rip),%rax        # f60 <freep>
+ 972:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+ 976:	eb 2f                	jmp    9a7 <free+0x50>
+    if (p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 978:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 97c:	48 8b 00             	mov    (%rax),%rax
+ 97f:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+ 983:	72 17                	jb     99c <free+0x45>
+ 985:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ 989:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+ 98d:	72 2f                	jb     9be <free+0x67>
+ 98f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 993:	48 8b 00             	mov    (%rax),%rax
+ 996:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+ 99a:	72 22                	jb     9be <free+0x67>
+  for (p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 99c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 9a0:	48 8b 00             	mov    (%rax),%rax
+ 9a3:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+ 9a7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ 9ab:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+ 9af:	73 c7                	jae    978 <free+0x21>
+ 9b1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 9b5:	48 8b 00             	mov    (%rax),%rax
+ 9b8:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+ 9bc:	73 ba                	jae    978 <free+0x21>
+      break;
+  if (bp + bp->s.size == p->s.ptr) {
+ 9be:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ 9c2:	8b 40 08             	mov    0x8(%rax),%eax
+ 9c5:	89 c0                	mov    %eax,%eax
+ 9c7:	48 c1 e0 04          	shl    $0x4,%rax
+ 9cb:	48 89 c2             	mov    %rax,%rdx
+ 9ce:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ 9d2:	48 01 c2             	add    %rax,%rdx
+ 9d5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 9d9:	48 8b 00             	mov    (%rax),%rax
+ 9dc:	48 39 c2             	cmp    %rax,%rdx
+ 9df:	75 2d                	jne    a0e <free+0xb7>
+    bp->s.size += p->s.ptr->s.size;
+ 9e1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ 9e5:	8b 50 08             	mov    0x8(%rax),%edx
+ 9e8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 9ec:	48 8b 00             	mov    (%rax),%rax
+ 9ef:	8b 40 08             	mov    0x8(%rax),%eax
+ 9f2:	01 c2                	add    %eax,%edx
+ 9f4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ 9f8:	89 50 08             	mov    %edx,0x8(%rax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 9fb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 9ff:	48 8b 00             	mov    (%rax),%rax
+ a02:	48 8b 10             	mov    (%rax),%rdx
+ a05:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ a09:	48 89 10             	mov    %rdx,(%rax)
+ a0c:	eb 0e                	jmp    a1c <free+0xc5>
+  } else
+    bp->s.ptr = p->s.ptr;
+ a0e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ a12:	48 8b 10             	mov    (%rax),%rdx
+ a15:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ a19:	48 89 10             	mov    %rdx,(%rax)
+  if (p + p->s.size == bp) {
+ a1c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ a20:	8b 40 08             	mov    0x8(%rax),%eax
+ a23:	89 c0                	mov    %eax,%eax
+ a25:	48 c1 e0 04          	shl    $0x4,%rax
+ a29:	48 89 c2             	mov    %rax,%rdx
+ a2c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ a30:	48 01 d0             	add    %rdx,%rax
+ a33:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+ a37:	75 27                	jne    a60 <free+0x109>
+    p->s.size += bp->s.size;
+ a39:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ a3d:	8b 50 08             	mov    0x8(%rax),%edx
+ a40:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ a44:	8b 40 08             	mov    0x8(%rax),%eax
+ a47:	01 c2                	add    %eax,%edx
+ a49:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ a4d:	89 50 08             	mov    %edx,0x8(%rax)
+    p->s.ptr = bp->s.ptr;
+ a50:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ a54:	48 8b 10             	mov    (%rax),%rdx
+ a57:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ a5b:	48 89 10             	mov    %rdx,(%rax)
+ a5e:	eb 0b                	jmp    a6b <free+0x114>
+  } else
+    p->s.ptr = bp;
+ a60:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ a64:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+ a68:	48 89 10             	mov    %rdx,(%rax)
+  freep = p;
+ a6b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ a6f:	48 89 05 ea 04 00 00 	mov    %rax,0x4ea(%rip)        # f60 <freep>
+}
+ a76:	90                   	nop
+ a77:	5d                   	pop    %rbp
+ a78:	c3                   	ret
+
+0000000000000a79 <morecore>:
+
+static Header *morecore(uint nu) {
+ a79:	55                   	push   %rbp
+ a7a:	48 89 e5             	mov    %rsp,%rbp
+ a7d:	48 83 ec 20          	sub    $0x20,%rsp
+ a81:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  char *p;
+  Header *hp;
+
+  if (nu < 4096)
+ a84:	81 7d ec ff 0f 00 00 	cmpl   $0xfff,-0x14(%rbp)
+ a8b:	77 07                	ja     a94 <morecore+0x1b>
+    nu = 4096;
+ a8d:	c7 45 ec 00 10 00 00 	movl   $0x1000,-0x14(%rbp)
+  p = sbrk(nu * sizeof(Header));
+ a94:	8b 45 ec             	mov    -0x14(%rbp),%eax
+ a97:	c1 e0 04             	shl    $0x4,%eax
+ a9a:	89 c7                	mov    %eax,%edi
+ a9c:	e8 7e fe ff ff       	call   91f <sbrk>
+ aa1:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (p == (char *)-1)
+ aa5:	48 83 7d f8 ff       	cmpq   $0xffffffffffffffff,-0x8(%rbp)
+ aaa:	75 07                	jne    ab3 <morecore+0x3a>
+    return 0;
+ aac:	b8 00 00 00 00       	mov    $0x0,%eax
+ ab1:	eb 29                	jmp    adc <morecore+0x63>
+  hp = (Header *)p;
+ ab3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ ab7:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  hp->s.size = nu;
+ abb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ abf:	8b 55 ec             	mov    -0x14(%rbp),%edx
+ ac2:	89 50 08             	mov    %edx,0x8(%rax)
+  free((void *)(hp + 1));
+ ac5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ ac9:	48 83 c0 10          	add    $0x10,%rax
+ acd:	48 89 c7             	mov    %rax,%rdi
+ ad0:	e8 82 fe ff ff       	call   957 <free>
+  return freep;
+ ad5:	48 8b 05 84 04 00 00 	mov    0x484(%rip),%rax        # f60 <freep>
+}
+ adc:	c9                   	leave
+ add:	c3                   	ret
+
+0000000000000ade <malloc>:
+
+void *malloc(uint nbytes) {
+ ade:	55                   	push   %rbp
+ adf:	48 89 e5             	mov    %rsp,%rbp
+ ae2:	48 83 ec 30          	sub    $0x30,%rsp
+ ae6:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1) / sizeof(Header) + 1;
+ ae9:	8b 45 dc             	mov    -0x24(%rbp),%eax
+ aec:	48 83 c0 0f          	add    $0xf,%rax
+ af0:	48 c1 e8 04          	shr    $0x4,%rax
+ af4:	83 c0 01             	add    $0x1,%eax
+ af7:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  if ((prevp = freep) == 0) {
+ afa:	48 8b 05 5f 04 00 00 	mov    0x45f(%rip),%rax        # f60 <freep>
+ b01:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+ b05:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+ b0a:	75 2e                	jne    b3a <malloc+0x5c>
+    base.s.ptr = freep = prevp = &base;
+ b0c:	48 8d 05 3d 04 00 00 	lea    0x43d(%rip),%rax        # f50 <base>
+ b13:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+ b17:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ b1b:	48 89 05 3e 04 00 00 	mov    %rax,0x43e(%rip)        # f60 <freep>
+ b22:	48 8b 05 37 04 00 00 	mov    0x437(%rip),%rax        # f60 <freep>
+ b29:	48 89 05 20 04 00 00 	mov    %rax,0x420(%rip)        # f50 <base>
+    base.s.size = 0;
+ b30:	c7 05 1e 04 00 00 00 	movl   $0x0,0x41e(%rip)        # f58 <base+0x8>
+ b37:	00 00 00 
+  }
+  for (p = prevp->s.ptr;; prevp = p, p = p->s.ptr) {
+ b3a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ b3e:	48 8b 00             	mov    (%rax),%rax
+ b41:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    if (p->s.size >= nunits) {
+ b45:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ b49:	8b 40 08             	mov    0x8(%rax),%eax
+ b4c:	3b 45 ec             	cmp    -0x14(%rbp),%eax
+ b4f:	72 5f                	jb     bb0 <malloc+0xd2>
+      if (p->s.size == nunits)
+ b51:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ b55:	8b 40 08             	mov    0x8(%rax),%eax
+ b58:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+ b5b:	75 10                	jne    b6d <malloc+0x8f>
+        prevp->s.ptr = p->s.ptr;
+ b5d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ b61:	48 8b 10             	mov    (%rax),%rdx
+ b64:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ b68:	48 89 10             	mov    %rdx,(%rax)
+ b6b:	eb 2e                	jmp    b9b <malloc+0xbd>
+      else {
+        p->s.size -= nunits;
+ b6d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ b71:	8b 40 08             	mov    0x8(%rax),%eax
+ b74:	2b 45 ec             	sub    -0x14(%rbp),%eax
+ b77:	89 c2                	mov    %eax,%edx
+ b79:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ b7d:	89 50 08             	mov    %edx,0x8(%rax)
+        p += p->s.size;
+ b80:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ b84:	8b 40 08             	mov    0x8(%rax),%eax
+ b87:	89 c0                	mov    %eax,%eax
+ b89:	48 c1 e0 04          	shl    $0x4,%rax
+ b8d:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+        p->s.size = nunits;
+ b91:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ b95:	8b 55 ec             	mov    -0x14(%rbp),%edx
+ b98:	89 50 08             	mov    %edx,0x8(%rax)
+      }
+      freep = prevp;
+ b9b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ b9f:	48 89 05 ba 03 00 00 	mov    %rax,0x3ba(%rip)        # f60 <freep>
+      return (void *)(p + 1);
+ ba6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ baa:	48 83 c0 10          	add    $0x10,%rax
+ bae:	eb 41                	jmp    bf1 <malloc+0x113>
+    }
+    if (p == freep)
+ bb0:	48 8b 05 a9 03 00 00 	mov    0x3a9(%rip),%rax        # f60 <freep>
+ bb7:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+ bbb:	75 1c                	jne    bd9 <malloc+0xfb>
+      if ((p = morecore(nunits)) == 0)
+ bbd:	8b 45 ec             	mov    -0x14(%rbp),%eax
+ bc0:	89 c7                	mov    %eax,%edi
+ bc2:	e8 b2 fe ff ff       	call   a79 <morecore>
+ bc7:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+ bcb:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+ bd0:	75 07                	jne    bd9 <malloc+0xfb>
+        return 0;
+ bd2:	b8 00 00 00 00       	mov    $0x0,%eax
+ bd7:	eb 18                	jmp    bf1 <malloc+0x113>
+  for (p = prevp->s.ptr;; prevp = p, p = p->s.ptr) {
+ bd9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ bdd:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+ be1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ be5:	48 8b 00             	mov    (%rax),%rax
+ be8:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    if (p->s.size >= nunits) {
+ bec:	e9 54 ff ff ff       	jmp    b45 <malloc+0x67>
+  }
+ bf1:	c9                   	leave
+ bf2:	c3                   	ret
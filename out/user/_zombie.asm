@@ -0,0 +1,1260 @@
+
+out/user/_zombie:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000000000 <main>:
+
+#include <cdefs.h>
+#include <stat.h>
+#include <user.h>
+
+int main(void) {
+   0:	55                   	push   %rbp
+   1:	48 89 e5             	mov    %rsp,%rbp
+  if (fork() > 0)
+   4:	e8 74 07 00 00       	call   77d <fork>
+   9:	85 c0                	test   %eax,%eax
+   b:	7e 0a                	jle    17 <main+0x17>
+    sleep(5); // Let child exit before parent.
+   d:	bf 05 00 00 00       	mov    $0x5,%edi
+  12:	e8 fe 07 00 00       	call   815 <sleep>
+  exit();
+  17:	e8 69 07 00 00       	call   785 <exit>
+
+000000000000001c <putc>:
+#include <cdefs.h>
+#include <stat.h>
+#include <stdarg.h>
+#include <user.h>
+
+static void putc(int fd, char c) { write(fd, &c, 1); }
+  1c:	55                   	push   %rbp
+  1d:	48 89 e5             	mov    %rsp,%rbp
+  20:	48 83 ec 10          	sub    $0x10,%rsp
+  24:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  27:	89 f0                	mov    %esi,%eax
+  29:	88 45 f8             	mov    %al,-0x8(%rbp)
+  2c:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+  30:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  33:	ba 01 00 00 00       	mov    $0x1,%edx
+  38:	48 89 ce             	mov    %rcx,%rsi
+  3b:	89 c7                	mov    %eax,%edi
+  3d:	e8 63 07 00 00       	call   7a5 <write>
+  42:	90                   	nop
+  43:	c9                   	leave
+  44:	c3                   	ret
+
+0000000000000045 <printint64>:
+
+static void printint64(int fd, int xx, int base, int sgn) {
+  45:	55                   	push   %rbp
+  46:	48 89 e5             	mov    %rsp,%rbp
+  49:	48 83 ec 40          	sub    $0x40,%rsp
+  4d:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  50:	89 75 c8             	mov    %esi,-0x38(%rbp)
+  53:	89 55 c4             	mov    %edx,-0x3c(%rbp)
+  56:	89 4d c0             	mov    %ecx,-0x40(%rbp)
+  static char digits[] = "0123456789abcdef";
+  char buf[32];
+  int i;
+  uint64_t x;
+
+  if (sgn && (sgn = xx < 0))
+  59:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+  5d:	74 1f                	je     7e <printint64+0x39>
+  5f:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  62:	c1 e8 1f             	shr    $0x1f,%eax
+  65:	0f b6 c0             	movzbl %al,%eax
+  68:	89 45 c0             	mov    %eax,-0x40(%rbp)
+  6b:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+  6f:	74 0d                	je     7e <printint64+0x39>
+    x = -xx;
+  71:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  74:	f7 d8                	neg    %eax
+  76:	48 98                	cltq
+  78:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  7c:	eb 09                	jmp    87 <printint64+0x42>
+  else
+    x = xx;
+  7e:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  81:	48 98                	cltq
+  83:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+  i = 0;
+  87:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  do {
+    buf[i++] = digits[x % base];
+  8e:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  91:	48 63 c8             	movslq %eax,%rcx
+  94:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  98:	ba 00 00 00 00       	mov    $0x0,%edx
+  9d:	48 f7 f1             	div    %rcx
+  a0:	48 89 d1             	mov    %rdx,%rcx
+  a3:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  a6:	8d 50 01             	lea    0x1(%rax),%edx
+  a9:	89 55 fc             	mov    %edx,-0x4(%rbp)
+  ac:	48 8d 15 8d 0c 00 00 	lea    0xc8d(%rip),%rdx        # d40 <digits.1>
+  b3:	0f b6 14 11          	movzbl (%rcx,%rdx,1),%edx
+  b7:	48 98                	cltq
+  b9:	88 54 05 d0          	mov    %dl,-0x30(%rbp,%rax,1)
+  } while ((x /= base) != 0);
+  bd:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  c0:	48 63 f0             	movslq %eax,%rsi
+  c3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  c7:	ba 00 00 00 00       	mov    $0x0,%edx
+  cc:	48 f7 f6             	div    %rsi
+  cf:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  d3:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+  d8:	75 b4                	jne    8e <printint64+0x49>
+
+  if (sgn)
+  da:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+  de:	74 2b                	je     10b <printint64+0xc6>
+    buf[i++] = '-';
+  e0:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  e3:	8d 50 01             	lea    0x1(%rax),%edx
+  e6:	89 55 fc             	mov    %edx,-0x4(%rbp)
+  e9:	48 98                	cltq
+  eb:	c6 44 05 d0 2d       	movb   $0x2d,-0x30(%rbp,%rax,1)
+
+  while (--i >= 0)
+  f0:	eb 19                	jmp    10b <printint64+0xc6>
+    putc(fd, buf[i]);
+  f2:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  f5:	48 98                	cltq
+  f7:	0f b6 44 05 d0       	movzbl -0x30(%rbp,%rax,1),%eax
+  fc:	0f be d0             	movsbl %al,%edx
+  ff:	8b 45 cc             	mov    -0x34(%rbp),%eax
+ 102:	89 d6                	mov    %edx,%esi
+ 104:	89 c7                	mov    %eax,%edi
+ 106:	e8 11 ff ff ff       	call   1c <putc>
+  while (--i >= 0)
+ 10b:	83 6d fc 01          	subl   $0x1,-0x4(%rbp)
+ 10f:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+ 113:	79 dd                	jns    f2 <printint64+0xad>
+}
+ 115:	90                   	nop
+ 116:	90                   	nop
+ 117:	c9                   	leave
+ 118:	c3                   	ret
+
+0000000000000119 <printint>:
+
+static void printint(int fd, int xx, int base, int sgn) {
+ 119:	55                   	push   %rbp
+ 11a:	48 89 e5             	mov    %rsp,%rbp
+ 11d:	48 83 ec 30          	sub    $0x30,%rsp
+ 121:	89 7d dc             	mov    %edi,-0x24(%rbp)
+ 124:	89 75 d8             	mov    %esi,-0x28(%rbp)
+ 127:	89 55 d4             	mov    %edx,-0x2c(%rbp)
+ 12a:	89 4d d0             	mov    %ecx,-0x30(%rbp)
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+ 12d:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+  if (sgn && xx < 0) {
+ 134:	83 7d d0 00          	cmpl   $0x0,-0x30(%rbp)
+ 138:	74 17                	je     151 <printint+0x38>
+ 13a:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+ 13e:	79 11                	jns    151 <printint+0x38>
+    neg = 1;
+ 140:	c7 45 f8 01 00 00 00 	movl   $0x1,-0x8(%rbp)
+    x = -xx;
+ 147:	8b 45 d8             	mov    -0x28(%rbp),%eax
+ 14a:	f7 d8                	neg    %eax
+ 14c:	89 45 f4             	mov    %eax,-0xc(%rbp)
+ 14f:	eb 06                	jmp    157 <printint+0x3e>
+  } else {
+    x = xx;
+ 151:	8b 45 d8             	mov    -0x28(%rbp),%eax
+ 154:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  }
+
+  i = 0;
+ 157:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  do {
+    buf[i++] = digits[x % base];
+ 15e:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+ 161:	8b 45 f4             	mov    -0xc(%rbp),%eax
+ 164:	ba 00 00 00 00       	mov    $0x0,%edx
+ 169:	f7 f1                	div    %ecx
+ 16b:	89 d1                	mov    %edx,%ecx
+ 16d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 170:	8d 50 01             	lea    0x1(%rax),%edx
+ 173:	89 55 fc             	mov    %edx,-0x4(%rbp)
+ 176:	89 c9                	mov    %ecx,%ecx
+ 178:	48 8d 15 e1 0b 00 00 	lea    0xbe1(%rip),%rdx        # d60 <digits.0>
+ 17f:	0f b6 14 11          	movzbl (%rcx,%rdx,1),%edx
+ 183:	48 98                	cltq
+ 185:	88 54 05 e4          	mov    %dl,-0x1c(%rbp,%rax,1)
+  } while ((x /= base) != 0);
+ 189:	8b 75 d4             	mov    -0x2c(%rbp),%esi
+ 18c:	8b 45 f4             	mov    -0xc(%rbp),%eax
+ 18f:	ba 00 00 00 00       	mov    $0x0,%edx
+ 194:	f7 f6                	div    %esi
+ 196:	89 45 f4             	mov    %eax,-0xc(%rbp)
+ 199:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+ 19d:	75 bf                	jne    15e <printint+0x45>
+  if (neg)
+ 19f:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+ 1a3:	74 2b                	je     1d0 <printint+0xb7>
+    buf[i++] = '-';
+ 1a5:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 1a8:	8d 50 01             	lea    0x1(%rax),%edx
+ 1ab:	89 55 fc             	mov    %edx,-0x4(%rbp)
+ 1ae:	48 98                	cltq
+ 1b0:	c6 44 05 e4 2d       	movb   $0x2d,-0x1c(%rbp,%rax,1)
+
+  while (--i >= 0)
+ 1b5:	eb 19                	jmp    1d0 <printint+0xb7>
+    putc(fd, buf[i]);
+ 1b7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 1ba:	48 98                	cltq
+ 1bc:	0f b6 44 05 e4       	movzbl -0x1c(%rbp,%rax,1),%eax
+ 1c1:	0f be d0             	movsbl %al,%edx
+ 1c4:	8b 45 dc             	mov    -0x24(%rbp),%eax
+ 1c7:	89 d6                	mov    %edx,%esi
+ 1c9:	89 c7                	mov    %eax,%edi
+ 1cb:	e8 4c fe ff ff       	call   1c <putc>
+  while (--i >= 0)
+ 1d0:	83 6d fc 01          	subl   $0x1,-0x4(%rbp)
+ 1d4:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+ 1d8:	79 dd                	jns    1b7 <printint+0x9e>
+}
+ 1da:	90                   	nop
+ 1db:	90                   	nop
+ 1dc:	c9                   	leave
+ 1dd:	c3                   	ret
+
+00000000000001de <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void printf(int fd, char *fmt, ...) {
+ 1de:	55                   	push   %rbp
+ 1df:	48 89 e5             	mov    %rsp,%rbp
+ 1e2:	48 83 ec 70          	sub    $0x70,%rsp
+ 1e6:	89 7d 9c             	mov    %edi,-0x64(%rbp)
+ 1e9:	48 89 75 90          	mov    %rsi,-0x70(%rbp)
+ 1ed:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+ 1f1:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+ 1f5:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+ 1f9:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+  char *s;
+  int c, i, state;
+  int lflag;
+  va_list valist;
+  va_start(valist, fmt);
+ 1fd:	c7 45 a0 10 00 00 00 	movl   $0x10,-0x60(%rbp)
+ 204:	48 8d 45 10          	lea    0x10(%rbp),%rax
+ 208:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+ 20c:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+ 210:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+
+  state = 0;
+ 214:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%rbp)
+  for (i = 0; fmt[i]; i++) {
+ 21b:	c7 45 c4 00 00 00 00 	movl   $0x0,-0x3c(%rbp)
+ 222:	e9 6b 02 00 00       	jmp    492 <printf+0x2b4>
+    c = fmt[i] & 0xff;
+ 227:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+ 22a:	48 63 d0             	movslq %eax,%rdx
+ 22d:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+ 231:	48 01 d0             	add    %rdx,%rax
+ 234:	0f b6 00             	movzbl (%rax),%eax
+ 237:	0f be c0             	movsbl %al,%eax
+ 23a:	25 ff 00 00 00       	and    $0xff,%eax
+ 23f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+    if (state == 0) {
+ 242:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+ 246:	75 30                	jne    278 <printf+0x9a>
+      if (c == '%') {
+ 248:	83 7d b8 25          	cmpl   $0x25,-0x48(%rbp)
+ 24c:	75 13                	jne    261 <printf+0x83>
+        state = '%';
+ 24e:	c7 45 c0 25 00 00 00 	movl   $0x25,-0x40(%rbp)
+        lflag = 0;
+ 255:	c7 45 bc 00 00 00 00 	movl   $0x0,-0x44(%rbp)
+ 25c:	e9 2d 02 00 00       	jmp    48e <printf+0x2b0>
+      } else {
+        putc(fd, c);
+ 261:	8b 45 b8             	mov    -0x48(%rbp),%eax
+ 264:	0f be d0             	movsbl %al,%edx
+ 267:	8b 45 9c             	mov    -0x64(%rbp),%eax
+ 26a:	89 d6                	mov    %edx,%esi
+ 26c:	89 c7                	mov    %eax,%edi
+ 26e:	e8 a9 fd ff ff       	call   1c <putc>
+ 273:	e9 16 02 00 00       	jmp    48e <printf+0x2b0>
+      }
+    } else if (state == '%') {
+ 278:	83 7d c0 25          	cmpl   $0x25,-0x40(%rbp)
+ 27c:	0f 85 0c 02 00 00    	jne    48e <printf+0x2b0>
+      if (c == 'l') {
+ 282:	83 7d b8 6c          	cmpl   $0x6c,-0x48(%rbp)
+ 286:	75 0c                	jne    294 <printf+0xb6>
+        lflag = 1;
+ 288:	c7 45 bc 01 00 00 00 	movl   $0x1,-0x44(%rbp)
+        continue;
+ 28f:	e9 fa 01 00 00       	jmp    48e <printf+0x2b0>
+      } else if (c == 'd') {
+ 294:	83 7d b8 64          	cmpl   $0x64,-0x48(%rbp)
+ 298:	0f 85 95 00 00 00    	jne    333 <printf+0x155>
+        if (lflag == 1)
+ 29e:	83 7d bc 01          	cmpl   $0x1,-0x44(%rbp)
+ 2a2:	75 49                	jne    2ed <printf+0x10f>
+          printint64(fd, va_arg(valist, int64_t), 10, 1);
+ 2a4:	8b 45 a0             	mov    -0x60(%rbp),%eax
+ 2a7:	83 f8 2f             	cmp    $0x2f,%eax
+ 2aa:	77 17                	ja     2c3 <printf+0xe5>
+ 2ac:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+ 2b0:	8b 55 a0             	mov    -0x60(%rbp),%edx
+ 2b3:	89 d2                	mov    %edx,%edx
+ 2b5:	48 01 d0             	add    %rdx,%rax
+ 2b8:	8b 55 a0             	mov    -0x60(%rbp),%edx
+ 2bb:	83 c2 08             	add    $0x8,%edx
+ 2be:	89 55 a0             	mov    %edx,-0x60(%rbp)
+ 2c1:	eb 0c                	jmp    2cf <printf+0xf1>
+ 2c3:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+ 2c7:	48 8d 50 08          	lea    0x8(%rax),%rdx
+ 2cb:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+ 2cf:	48 8b 00             	mov    (%rax),%rax
+ 2d2:	89 c6                	mov    %eax,%esi
+ 2d4:	8b 45 9c             	mov    -0x64(%rbp),%eax
+ 2d7:	b9 01 00 00 00       	mov    $0x1,%ecx
+ 2dc:	ba 0a 00 00 00       	mov    $0xa,%edx
+ 2e1:	89 c7                	mov    %eax,%edi
+ 2e3:	e8 5d fd ff ff       	call   45 <printint64>
+ 2e8:	e9 9a 01 00 00       	jmp    487 <printf+0x2a9>
+        else
+          printint(fd, va_arg(valist, int), 10, 1);
+ 2ed:	8b 45 a0             	mov    -0x60(%rbp),%eax
+ 2f0:	83 f8 2f             	cmp    $0x2f,%eax
+ 2f3:	77 17                	ja     30c <printf+0x12e>
+ 2f5:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+ 2f9:	8b 55 a0             	mov    -0x60(%rbp),%edx
+ 2fc:	89 d2                	mov    %edx,%edx
+ 2fe:	48 01 d0             	add    %rdx,%rax
+ 301:	8b 55 a0             	mov    -0x60(%rbp),%edx
+ 304:	83 c2 08             	add    $0x8,%edx
+ 307:	89 55 a0             	mov    %edx,-0x60(%rbp)
+ 30a:	eb 0c                	jmp    318 <printf+0x13a>
+ 30c:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+ 310:	48 8d 50 08          	lea    0x8(%rax),%rdx
+ 314:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+ 318:	8b 30                	mov    (%rax),%esi
+ 31a:	8b 45 9c             	mov    -0x64(%rbp),%eax
+ 31d:	b9 01 00 00 00       	mov    $0x1,%ecx
+ 322:	ba 0a 00 00 00       	mov    $0xa,%edx
+ 327:	89 c7                	mov    %eax,%edi
+ 329:	e8 eb fd ff ff       	call   119 <printint>
+ 32e:	e9 54 01 00 00       	jmp    487 <printf+0x2a9>
+      } else if (c == 'x' || c == 'p') {
+ 333:	83 7d b8 78          	cmpl   $0x78,-0x48(%rbp)
+ 337:	74 0a                	je     343 <printf+0x165>
+ 339:	83 7d b8 70          	cmpl   $0x70,-0x48(%rbp)
+ 33d:	0f 85 95 00 00 00    	jne    3d8 <printf+0x1fa>
+        if (lflag == 1)
+ 343:	83 7d bc 01          	cmpl   $0x1,-0x44(%rbp)
+ 347:	75 49                	jne    392 <printf+0x1b4>
+          printint64(fd, va_arg(valist, int64_t), 16, 0);
+ 349:	8b 45 a0             	mov    -0x60(%rbp),%eax
+ 34c:	83 f8 2f             	cmp    $0x2f,%eax
+ 34f:	77 17                	ja     368 <printf+0x18a>
+ 351:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+ 355:	8b 55 a0             	mov    -0x60(%rbp),%edx
+ 358:	89 d2                	mov    %edx,%edx
+ 35a:	48 01 d0             	add    %rdx,%rax
+ 35d:	8b 55 a0             	mov    -0x60(%rbp),%edx
+ 360:	83 c2 08             	add    $0x8,%edx
+ 363:	89 55 a0             	mov    %edx,-0x60(%rbp)
+ 366:	eb 0c                	jmp    374 <printf+0x196>
+ 368:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+ 36c:	48 8d 50 08          	lea    0x8(%rax),%rdx
+ 370:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+ 374:	48 8b 00             	mov    (%rax),%rax
+ 377:	89 c6                	mov    %eax,%esi
+ 379:	8b 45 9c             	mov    -0x64(%rbp),%eax
+ 37c:	b9 00 00 00 00       	mov    $0x0,%ecx
+ 381:	ba 10 00 00 00       	mov    $0x10,%edx
+ 386:	89 c7                	mov    %eax,%edi
+ 388:	e8 b8 fc ff ff       	call   45 <printint64>
+        if (lflag == 1)
+ 38d:	e9 f5 00 00 00       	jmp    487 <printf+0x2a9>
+        else
+          printint(fd, va_arg(valist, int), 16, 0);
+ 392:	8b 45 a0             	mov    -0x60(%rbp),%eax
+ 395:	83 f8 2f             	cmp    $0x2f,%eax
+ 398:	77 17                	ja     3b1 <printf+0x1d3>
+ 39a:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+ 39e:	8b 55 a0             	mov    -0x60(%rbp),%edx
+ 3a1:	89 d2                	mov    %edx,%edx
+ 3a3:	48 01 d0             	add    %rdx,%rax
+ 3a6:	8b 55 a0             	mov    -0x60(%rbp),%edx
+ 3a9:	83 c2 08             	add    $0x8,%edx
+ 3ac:	89 55 a0             	mov    %edx,-0x60(%rbp)
+ 3af:	eb 0c                	jmp    3bd <printf+0x1df>
+ 3b1:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+ 3b5:	48 8d 50 08          	lea    0x8(%rax),%rdx
+ 3b9:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+ 3bd:	8b 30                	mov    (%rax),%esi
+ 3bf:	8b 45 9c             	mov    -0x64(%rbp),%eax
+ 3c2:	b9 00 00 00 00       	mov    $0x0,%ecx
+ 3c7:	ba 10 00 00 00       	mov    $0x10,%edx
+ 3cc:	89 c7                	mov    %eax,%edi
+ 3ce:	e8 46 fd ff ff       	call   119 <printint>
+        if (lflag == 1)
+ 3d3:	e9 af 00 00 00       	jmp    487 <printf+0x2a9>
+      } else if (c == 's') {
+ 3d8:	83 7d b8 73          	cmpl   $0x73,-0x48(%rbp)
+ 3dc:	75 6e                	jne    44c <printf+0x26e>
+        if ((s = (char *)va_arg(valist, char *)) == 0)
+ 3de:	8b 45 a0             	mov    -0x60(%rbp),%eax
+ 3e1:	83 f8 2f             	cmp    $0x2f,%eax
+ 3e4:	77 17                	ja     3fd <printf+0x21f>
+ 3e6:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+ 3ea:	8b 55 a0             	mov    -0x60(%rbp),%edx
+ 3ed:	89 d2                	mov    %edx,%edx
+ 3ef:	48 01 d0             	add    %rdx,%rax
+ 3f2:	8b 55 a0             	mov    -0x60(%rbp),%edx
+ 3f5:	83 c2 08             	add    $0x8,%edx
+ 3f8:	89 55 a0             	mov    %edx,-0x60(%rbp)
+ 3fb:	eb 0c                	jmp    409 <printf+0x22b>
+ 3fd:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+ 401:	48 8d 50 08          	lea    0x8(%rax),%rdx
+ 405:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+ 409:	48 8b 00             	mov    (%rax),%rax
+ 40c:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+ 410:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+ 415:	75 28                	jne    43f <printf+0x261>
+          s = "(null)";
+ 417:	48 8d 05 c3 06 00 00 	lea    0x6c3(%rip),%rax        # ae1 <malloc+0x115>
+ 41e:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        for (; *s; s++)
+ 422:	eb 1b                	jmp    43f <printf+0x261>
+          putc(fd, *s);
+ 424:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+ 428:	0f b6 00             	movzbl (%rax),%eax
+ 42b:	0f be d0             	movsbl %al,%edx
+ 42e:	8b 45 9c             	mov    -0x64(%rbp),%eax
+ 431:	89 d6                	mov    %edx,%esi
+ 433:	89 c7                	mov    %eax,%edi
+ 435:	e8 e2 fb ff ff       	call   1c <putc>
+        for (; *s; s++)
+ 43a:	48 83 45 c8 01       	addq   $0x1,-0x38(%rbp)
+ 43f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+ 443:	0f b6 00             	movzbl (%rax),%eax
+ 446:	84 c0                	test   %al,%al
+ 448:	75 da                	jne    424 <printf+0x246>
+ 44a:	eb 3b                	jmp    487 <printf+0x2a9>
+      } else if (c == '%') {
+ 44c:	83 7d b8 25          	cmpl   $0x25,-0x48(%rbp)
+ 450:	75 14                	jne    466 <printf+0x288>
+        putc(fd, c);
+ 452:	8b 45 b8             	mov    -0x48(%rbp),%eax
+ 455:	0f be d0             	movsbl %al,%edx
+ 458:	8b 45 9c             	mov    -0x64(%rbp),%eax
+ 45b:	89 d6                	mov    %edx,%esi
+ 45d:	89 c7                	mov    %eax,%edi
+ 45f:	e8 b8 fb ff ff       	call   1c <putc>
+ 464:	eb 21                	jmp    487 <printf+0x2a9>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+ 466:	8b 45 9c             	mov    -0x64(%rbp),%eax
+ 469:	be 25 00 00 00       	mov    $0x25,%esi
+ 46e:	89 c7                	mov    %eax,%edi
+ 470:	e8 a7 fb ff ff       	call   1c <putc>
+        putc(fd, c);
+ 475:	8b 45 b8             	mov    -0x48(%rbp),%eax
+ 478:	0f be d0             	movsbl %al,%edx
+ 47b:	8b 45 9c             	mov    -0x64(%rbp),%eax
+ 47e:	89 d6                	mov    %edx,%esi
+ 480:	89 c7                	mov    %eax,%edi
+ 482:	e8 95 fb ff ff       	call   1c <putc>
+      }
+      state = 0;
+ 487:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%rbp)
+  for (i = 0; fmt[i]; i++) {
+ 48e:	83 45 c4 01          	addl   $0x1,-0x3c(%rbp)
+ 492:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+ 495:	48 63 d0             	movslq %eax,%rdx
+ 498:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+ 49c:	48 01 d0             	add    %rdx,%rax
+ 49f:	0f b6 00             	movzbl (%rax),%eax
+ 4a2:	84 c0                	test   %al,%al
+ 4a4:	0f 85 7d fd ff ff    	jne    227 <printf+0x49>
+    }
+  }
+
+  va_end(valist);
+}
+ 4aa:	90                   	nop
+ 4ab:	90                   	nop
+ 4ac:	c9                   	leave
+ 4ad:	c3                   	ret
+
+00000000000004ae <stosb>:
+      break;
+    buf[i++] = c;
+    if (c == '\n' || c == '\r')
+      break;
+  }
+  buf[i] = '\0';
+ 4ae:	55                   	push   %rbp
+ 4af:	48 89 e5             	mov    %rsp,%rbp
+ 4b2:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+ 4b6:	89 75 f4             	mov    %esi,-0xc(%rbp)
+ 4b9:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  return buf;
+ 4bc:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+ 4c0:	8b 55 f0             	mov    -0x10(%rbp),%edx
+ 4c3:	8b 45 f4             	mov    -0xc(%rbp),%eax
+ 4c6:	48 89 ce             	mov    %rcx,%rsi
+ 4c9:	48 89 f7             	mov    %rsi,%rdi
+ 4cc:	89 d1                	mov    %edx,%ecx
+ 4ce:	fc                   	cld
+ 4cf:	f3 aa                	rep stos %al,%es:(%rdi)
+ 4d1:	89 ca                	mov    %ecx,%edx
+ 4d3:	48 89 fe             	mov    %rdi,%rsi
+ 4d6:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+ 4da:	89 55 f0             	mov    %edx,-0x10(%rbp)
+}
+
+int stat(char *n, struct stat *st) {
+  int fd;
+ 4dd:	90                   	nop
+ 4de:	5d                   	pop    %rbp
+ 4df:	c3                   	ret
+
+00000000000004e0 <strcpy>:
+char *strcpy(char *s, char *t) {
+ 4e0:	55                   	push   %rbp
+ 4e1:	48 89 e5             	mov    %rsp,%rbp
+ 4e4:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+ 4e8:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  os = s;
+ 4ec:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 4f0:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while ((*s++ = *t++) != 0)
+ 4f4:	90                   	nop
+ 4f5:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+ 4f9:	48 8d 42 01          	lea    0x1(%rdx),%rax
+ 4fd:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+ 501:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 505:	48 8d 48 01          	lea    0x1(%rax),%rcx
+ 509:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+ 50d:	0f b6 12             	movzbl (%rdx),%edx
+ 510:	88 10                	mov    %dl,(%rax)
+ 512:	0f b6 00             	movzbl (%rax),%eax
+ 515:	84 c0                	test   %al,%al
+ 517:	75 dc                	jne    4f5 <strcpy+0x15>
+  return os;
+ 519:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+ 51d:	5d                   	pop    %rbp
+ 51e:	c3                   	ret
+
+000000000000051f <strcmp>:
+int strcmp(const char *p, const char *q) {
+ 51f:	55                   	push   %rbp
+ 520:	48 89 e5             	mov    %rsp,%rbp
+ 523:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+ 527:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  while (*p && *p == *q)
+ 52b:	eb 0a                	jmp    537 <strcmp+0x18>
+    p++, q++;
+ 52d:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+ 532:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (*p && *p == *q)
+ 537:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 53b:	0f b6 00             	movzbl (%rax),%eax
+ 53e:	84 c0                	test   %al,%al
+ 540:	74 12                	je     554 <strcmp+0x35>
+ 542:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 546:	0f b6 10             	movzbl (%rax),%edx
+ 549:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ 54d:	0f b6 00             	movzbl (%rax),%eax
+ 550:	38 c2                	cmp    %al,%dl
+ 552:	74 d9                	je     52d <strcmp+0xe>
+  return (uchar)*p - (uchar)*q;
+ 554:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 558:	0f b6 00             	movzbl (%rax),%eax
+ 55b:	0f b6 d0             	movzbl %al,%edx
+ 55e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ 562:	0f b6 00             	movzbl (%rax),%eax
+ 565:	0f b6 c0             	movzbl %al,%eax
+ 568:	29 c2                	sub    %eax,%edx
+ 56a:	89 d0                	mov    %edx,%eax
+}
+ 56c:	5d                   	pop    %rbp
+ 56d:	c3                   	ret
+
+000000000000056e <strlen>:
+uint strlen(char *s) {
+ 56e:	55                   	push   %rbp
+ 56f:	48 89 e5             	mov    %rsp,%rbp
+ 572:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  for (n = 0; s[n]; n++)
+ 576:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+ 57d:	eb 04                	jmp    583 <strlen+0x15>
+ 57f:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+ 583:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 586:	48 63 d0             	movslq %eax,%rdx
+ 589:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 58d:	48 01 d0             	add    %rdx,%rax
+ 590:	0f b6 00             	movzbl (%rax),%eax
+ 593:	84 c0                	test   %al,%al
+ 595:	75 e8                	jne    57f <strlen+0x11>
+  return n;
+ 597:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+ 59a:	5d                   	pop    %rbp
+ 59b:	c3                   	ret
+
+000000000000059c <memset>:
+void *memset(void *dst, int c, uint n) {
+ 59c:	55                   	push   %rbp
+ 59d:	48 89 e5             	mov    %rsp,%rbp
+ 5a0:	48 83 ec 10          	sub    $0x10,%rsp
+ 5a4:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+ 5a8:	89 75 f4             	mov    %esi,-0xc(%rbp)
+ 5ab:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  stosb(dst, c, n);
+ 5ae:	8b 55 f0             	mov    -0x10(%rbp),%edx
+ 5b1:	8b 4d f4             	mov    -0xc(%rbp),%ecx
+ 5b4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 5b8:	89 ce                	mov    %ecx,%esi
+ 5ba:	48 89 c7             	mov    %rax,%rdi
+ 5bd:	e8 ec fe ff ff       	call   4ae <stosb>
+  return dst;
+ 5c2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+ 5c6:	c9                   	leave
+ 5c7:	c3                   	ret
+
+00000000000005c8 <strchr>:
+char *strchr(const char *s, char c) {
+ 5c8:	55                   	push   %rbp
+ 5c9:	48 89 e5             	mov    %rsp,%rbp
+ 5cc:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+ 5d0:	89 f0                	mov    %esi,%eax
+ 5d2:	88 45 f4             	mov    %al,-0xc(%rbp)
+  for (; *s; s++)
+ 5d5:	eb 17                	jmp    5ee <strchr+0x26>
+    if (*s == c)
+ 5d7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 5db:	0f b6 00             	movzbl (%rax),%eax
+ 5de:	38 45 f4             	cmp    %al,-0xc(%rbp)
+ 5e1:	75 06                	jne    5e9 <strchr+0x21>
+      return (char *)s;
+ 5e3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 5e7:	eb 15                	jmp    5fe <strchr+0x36>
+  for (; *s; s++)
+ 5e9:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+ 5ee:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 5f2:	0f b6 00             	movzbl (%rax),%eax
+ 5f5:	84 c0                	test   %al,%al
+ 5f7:	75 de                	jne    5d7 <strchr+0xf>
+  return 0;
+ 5f9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 5fe:	5d                   	pop    %rbp
+ 5ff:	c3                   	ret
+
+0000000000000600 <gets>:
+char *gets(char *buf, int max) {
+ 600:	55                   	push   %rbp
+ 601:	48 89 e5             	mov    %rsp,%rbp
+ 604:	48 83 ec 20          	sub    $0x20,%rsp
+ 608:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+ 60c:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  for (i = 0; i + 1 < max;) {
+ 60f:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+ 616:	eb 48                	jmp    660 <gets+0x60>
+    cc = read(0, &c, 1);
+ 618:	48 8d 45 f7          	lea    -0x9(%rbp),%rax
+ 61c:	ba 01 00 00 00       	mov    $0x1,%edx
+ 621:	48 89 c6             	mov    %rax,%rsi
+ 624:	bf 00 00 00 00       	mov    $0x0,%edi
+ 629:	e8 6f 01 00 00       	call   79d <read>
+ 62e:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    if (cc < 1)
+ 631:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+ 635:	7e 36                	jle    66d <gets+0x6d>
+    buf[i++] = c;
+ 637:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 63a:	8d 50 01             	lea    0x1(%rax),%edx
+ 63d:	89 55 fc             	mov    %edx,-0x4(%rbp)
+ 640:	48 63 d0             	movslq %eax,%rdx
+ 643:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 647:	48 01 c2             	add    %rax,%rdx
+ 64a:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+ 64e:	88 02                	mov    %al,(%rdx)
+    if (c == '\n' || c == '\r')
+ 650:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+ 654:	3c 0a                	cmp    $0xa,%al
+ 656:	74 16                	je     66e <gets+0x6e>
+ 658:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+ 65c:	3c 0d                	cmp    $0xd,%al
+ 65e:	74 0e                	je     66e <gets+0x6e>
+  for (i = 0; i + 1 < max;) {
+ 660:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 663:	83 c0 01             	add    $0x1,%eax
+ 666:	39 45 e4             	cmp    %eax,-0x1c(%rbp)
+ 669:	7f ad                	jg     618 <gets+0x18>
+ 66b:	eb 01                	jmp    66e <gets+0x6e>
+      break;
+ 66d:	90                   	nop
+  buf[i] = '\0';
+ 66e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 671:	48 63 d0             	movslq %eax,%rdx
+ 674:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 678:	48 01 d0             	add    %rdx,%rax
+ 67b:	c6 00 00             	movb   $0x0,(%rax)
+  return buf;
+ 67e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+ 682:	c9                   	leave
+ 683:	c3                   	ret
+
+0000000000000684 <stat>:
+int stat(char *n, struct stat *st) {
+ 684:	55                   	push   %rbp
+ 685:	48 89 e5             	mov    %rsp,%rbp
+ 688:	48 83 ec 20          	sub    $0x20,%rsp
+ 68c:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+ 690:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 694:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 698:	be 00 00 00 00       	mov    $0x0,%esi
+ 69d:	48 89 c7             	mov    %rax,%rdi
+ 6a0:	e8 20 01 00 00       	call   7c5 <open>
+ 6a5:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  if (fd < 0)
+ 6a8:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+ 6ac:	79 07                	jns    6b5 <stat+0x31>
+    return -1;
+ 6ae:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 6b3:	eb 21                	jmp    6d6 <stat+0x52>
+  r = fstat(fd, st);
+ 6b5:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+ 6b9:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 6bc:	48 89 d6             	mov    %rdx,%rsi
+ 6bf:	89 c7                	mov    %eax,%edi
+ 6c1:	e8 17 01 00 00       	call   7dd <fstat>
+ 6c6:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  close(fd);
+ 6c9:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 6cc:	89 c7                	mov    %eax,%edi
+ 6ce:	e8 da 00 00 00       	call   7ad <close>
+  return r;
+ 6d3:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+ 6d6:	c9                   	leave
+ 6d7:	c3                   	ret
+
+00000000000006d8 <atoi>:
+
+int atoi(const char *s) {
+ 6d8:	55                   	push   %rbp
+ 6d9:	48 89 e5             	mov    %rsp,%rbp
+ 6dc:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int n;
+
+  n = 0;
+ 6e0:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  while ('0' <= *s && *s <= '9')
+ 6e7:	eb 28                	jmp    711 <atoi+0x39>
+    n = n * 10 + *s++ - '0';
+ 6e9:	8b 55 fc             	mov    -0x4(%rbp),%edx
+ 6ec:	89 d0                	mov    %edx,%eax
+ 6ee:	c1 e0 02             	shl    $0x2,%eax
+ 6f1:	01 d0                	add    %edx,%eax
+ 6f3:	01 c0                	add    %eax,%eax
+ 6f5:	89 c1                	mov    %eax,%ecx
+ 6f7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 6fb:	48 8d 50 01          	lea    0x1(%rax),%rdx
+ 6ff:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+ 703:	0f b6 00             	movzbl (%rax),%eax
+ 706:	0f be c0             	movsbl %al,%eax
+ 709:	01 c8                	add    %ecx,%eax
+ 70b:	83 e8 30             	sub    $0x30,%eax
+ 70e:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while ('0' <= *s && *s <= '9')
+ 711:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 715:	0f b6 00             	movzbl (%rax),%eax
+ 718:	3c 2f                	cmp    $0x2f,%al
+ 71a:	7e 0b                	jle    727 <atoi+0x4f>
+ 71c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 720:	0f b6 00             	movzbl (%rax),%eax
+ 723:	3c 39                	cmp    $0x39,%al
+ 725:	7e c2                	jle    6e9 <atoi+0x11>
+  return n;
+ 727:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+ 72a:	5d                   	pop    %rbp
+ 72b:	c3                   	ret
+
+000000000000072c <memmove>:
+
+void *memmove(void *vdst, void *vsrc, int n) {
+ 72c:	55                   	push   %rbp
+ 72d:	48 89 e5             	mov    %rsp,%rbp
+ 730:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+ 734:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+ 738:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  char *dst, *src;
+
+  dst = vdst;
+ 73b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 73f:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  src = vsrc;
+ 743:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+ 747:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  while (n-- > 0)
+ 74b:	eb 1d                	jmp    76a <memmove+0x3e>
+    *dst++ = *src++;
+ 74d:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+ 751:	48 8d 42 01          	lea    0x1(%rdx),%rax
+ 755:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+ 759:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 75d:	48 8d 48 01          	lea    0x1(%rax),%rcx
+ 761:	48 89 4d f8          	mov    %rcx,-0x8(%rbp)
+ 765:	0f b6 12             	movzbl (%rdx),%edx
+ 768:	88 10                	mov    %dl,(%rax)
+  while (n-- > 0)
+ 76a:	8b 45 dc             	mov    -0x24(%rbp),%eax
+ 76d:	8d 50 ff             	lea    -0x1(%rax),%edx
+ 770:	89 55 dc             	mov    %edx,-0x24(%rbp)
+ 773:	85 c0                	test   %eax,%eax
+ 775:	7f d6                	jg     74d <memmove+0x21>
+  return vdst;
+ 777:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 77b:	5d                   	pop    %rbp
+ 77c:	c3                   	ret
+
+000000000000077d <fork>:
+  name:                                                                        \
+  movl $SYS_##name, % eax;                                                     \
+  int $TRAP_SYSCALL;                                                           \
+  ret
+
+SYSCALL(fork)
+ 77d:	b8 01 00 00 00       	mov    $0x1,%eax
+ 782:	cd 40                	int    $0x40
+ 784:	c3                   	ret
+
+0000000000000785 <exit>:
+SYSCALL(exit)
+ 785:	b8 02 00 00 00       	mov    $0x2,%eax
+ 78a:	cd 40                	int    $0x40
+ 78c:	c3                   	ret
+
+000000000000078d <wait>:
+SYSCALL(wait)
+ 78d:	b8 03 00 00 00       	mov    $0x3,%eax
+ 792:	cd 40                	int    $0x40
+ 794:	c3                   	ret
+
+0000000000000795 <pipe>:
+SYSCALL(pipe)
+ 795:	b8 04 00 00 00       	mov    $0x4,%eax
+ 79a:	cd 40                	int    $0x40
+ 79c:	c3                   	ret
+
+000000000000079d <read>:
+SYSCALL(read)
+ 79d:	b8 05 00 00 00       	mov    $0x5,%eax
+ 7a2:	cd 40                	int    $0x40
+ 7a4:	c3                   	ret
+
+00000000000007a5 <write>:
+SYSCALL(write)
+ 7a5:	b8 10 00 00 00       	mov    $0x10,%eax
+ 7aa:	cd 40                	int    $0x40
+ 7ac:	c3                   	ret
+
+00000000000007ad <close>:
+SYSCALL(close)
+ 7ad:	b8 15 00 00 00       	mov    $0x15,%eax
+ 7b2:	cd 40                	int    $0x40
+ 7b4:	c3                   	ret
+
+00000000000007b5 <kill>:
+SYSCALL(kill)
+ 7b5:	b8 06 00 00 00       	mov    $0x6,%eax
+ 7ba:	cd 40                	int    $0x40
+ 7bc:	c3                   	ret
+
+00000000000007bd <exec>:
+SYSCALL(exec)
+ 7bd:	b8 07 00 00 00       	mov    $0x7,%eax
+ 7c2:	cd 40                	int    $0x40
+ 7c4:	c3                   	ret
+
+00000000000007c5 <open>:
+SYSCALL(open)
+ 7c5:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 7ca:	cd 40                	int    $0x40
+ 7cc:	c3                   	ret
+
+00000000000007cd <mknod>:
+SYSCALL(mknod)
+ 7cd:	b8 11 00 00 00       	mov    $0x11,%eax
+ 7d2:	cd 40                	int    $0x40
+ 7d4:	c3                   	ret
+
+00000000000007d5 <unlink>:
+SYSCALL(unlink)
+ 7d5:	b8 12 00 00 00       	mov    $0x12,%eax
+ 7da:	cd 40                	int    $0x40
+ 7dc:	c3                   	ret
+
+00000000000007dd <fstat>:
+SYSCALL(fstat)
+ 7dd:	b8 08 00 00 00       	mov    $0x8,%eax
+ 7e2:	cd 40                	int    $0x40
+ 7e4:	c3                   	ret
+
+00000000000007e5 <link>:
+SYSCALL(link)
+ 7e5:	b8 13 00 00 00       	mov    $0x13,%eax
+ 7ea:	cd 40                	int    $0x40
+ 7ec:	c3                   	ret
+
+00000000000007ed <mkdir>:
+SYSCALL(mkdir)
+ 7ed:	b8 14 00 00 00       	mov    $0x14,%eax
+ 7f2:	cd 40                	int    $0x40
+ 7f4:	c3                   	ret
+
+00000000000007f5 <chdir>:
+SYSCALL(chdir)
+ 7f5:	b8 09 00 00 00       	mov    $0x9,%eax
+ 7fa:	cd 40                	int    $0x40
+ 7fc:	c3                   	ret
+
+00000000000007fd <dup>:
+SYSCALL(dup)
+ 7fd:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 802:	cd 40                	int    $0x40
+ 804:	c3                   	ret
+
+0000000000000805 <getpid>:
+SYSCALL(getpid)
+ 805:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 80a:	cd 40                	int    $0x40
+ 80c:	c3                   	ret
+
+000000000000080d <sbrk>:
+SYSCALL(sbrk)
+ 80d:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 812:	cd 40                	int    $0x40
+ 814:	c3                   	ret
+
+0000000000000815 <sleep>:
+SYSCALL(sleep)
+ 815:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 81a:	cd 40                	int    $0x40
+ 81c:	c3                   	ret
+
+000000000000081d <uptime>:
+SYSCALL(uptime)
+ 81d:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 822:	cd 40                	int    $0x40
+ 824:	c3                   	ret
+
+0000000000000825 <sysinfo>:
+SYSCALL(sysinfo)
+ 825:	b8 16 00 00 00       	mov    $0x16,%eax
+ 82a:	cd 40                	int    $0x40
+ 82c:	c3                   	ret
+
+000000000000082d <crashn>:
+SYSCALL(crashn)
+ 82d:	b8 17 00 00 00       	mov    $0x17,%eax
+ 832:	cd 40                	int    $0x40
+ 834:	c3                   	ret
+
+0000000000000835 <sync>:
+SYSCALL(sync)
+ 835:	b8 18 00 00 00       	mov    $0x18,%eax
+ 83a:	cd 40                	int    $0x40
+ 83c:	c3                   	ret
+
+000000000000083d <fsync>:
+SYSCALL(fsync)
+ 83d:	b8 19 00 00 00       	mov    $0x19,%eax
+ 842:	cd 40                	int    $0x40
+ 844:	c3                   	ret
+
+0000000000000845 <free>:
+typedef union header Header;
+
+static Header base;
+static Header *freep;
+
+void free(void *ap) {
+ 845:	55                   	push   %rbp
+ 846:	48 89 e5             	mov    %rsp,%rbp
+ 849:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  Header *bp, *p;
+
+  bp = (Header *)ap - 1;
+ 84d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 851:	48 83 e8 10          	sub    $0x10,%rax
+ 855:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  for (p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 859:	48 8b 05 30 05 00 00 	mov    0x530(%rip),%rax        # d90 <freep>
+ 860:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+ 864:	eb 2f                	jmp    895 <free+0x50>
+    if (p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 866:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 86a:	48 8b 00             	mov    (%rax),%rax
+ 86d:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+ 871:	72 17                	jb     88a <free+0x45>
+ 873:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ 877:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+ 87b:	72 2f                	jb     8ac <free+0x67>
+ 87d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 881:	48 8b 00             	mov    (%rax),%rax
+ 884:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+ 888:	72 22                	jb     8ac <free+0x67>
+  for (p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 88a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 88e:	48 8b 00             	mov    (%rax),%rax
+ 891:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+ 895:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ 899:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+ 89d:	73 c7                	jae    866 <free+0x21>
+ 89f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 8a3:	48 8b 00             	mov    (%rax),%rax
+ 8a6:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+ 8aa:	73 ba                	jae    866 <free+0x21>
+      break;
+  if (bp + bp->s.size == p->s.ptr) {
+ 8ac:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ 8b0:	8b 40 08             	mov    0x8(%rax),%eax
+ 8b3:	89 c0                	mov    %eax,%eax
+ 8b5:	48 c1 e0 04          	shl    $0x4,%rax
+ 8b9:	48 89 c2             	mov    %rax,%rdx
+ 8bc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ 8c0:	48 01 c2             	add    %rax,%rdx
+ 8c3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 8c7:	48 8b 00             	mov    (%rax),%rax
+ 8ca:	48 39 c2             	cmp    %rax,%rdx
+ 8cd:	75 2d                	jne    8fc <free+0xb7>
+    bp->s.size += p->s.ptr->s.size;
+ 8cf:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ 8d3:	8b 50 08             	mov    0x8(%rax),%edx
+ 8d6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 8da:	48 8b 00             	mov    (%rax),%rax
+ 8dd:	8b 40 08             	mov    0x8(%rax),%eax
+ 8e0:	01 c2                	add    %eax,%edx
+ 8e2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ 8e6:	89 50 08             	mov    %edx,0x8(%rax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 8e9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 8ed:	48 8b 00             	mov    (%rax),%rax
+ 8f0:	48 8b 10             	mov    (%rax),%rdx
+ 8f3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ 8f7:	48 89 10             	mov    %rdx,(%rax)
+ 8fa:	eb 0e                	jmp    90a <free+0xc5>
+  } else
+    bp->s.ptr = p->s.ptr;
+ 8fc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 900:	48 8b 10             	mov    (%rax),%rdx
+ 903:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ 907:	48 89 10             	mov    %rdx,(%rax)
+  if (p + p->s.size == bp) {
+ 90a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 90e:	8b 40 08             	mov    0x8(%rax),%eax
+ 911:	89 c0                	mov    %eax,%eax
+ 913:	48 c1 e0 04          	shl    $0x4,%rax
+ 917:	48 89 c2             	mov    %rax,%rdx
+ 91a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 91e:	48 01 d0             	add    %rdx,%rax
+ 921:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+ 925:	75 27                	jne    94e <free+0x109>
+    p->s.size += bp->s.size;
+ 927:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 92b:	8b 50 08             	mov    0x8(%rax),%edx
+ 92e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ 932:	8b 40 08             	mov    0x8(%rax),%eax
+ 935:	01 c2                	add    %eax,%edx
+ 937:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 93b:	89 50 08             	mov    %edx,0x8(%rax)
+    p->s.ptr = bp->s.ptr;
+ 93e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ 942:	48 8b 10             	mov    (%rax),%rdx
+ 945:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 949:	48 89 10             	mov    %rdx,(%rax)
+ 94c:	eb 0b                	jmp    959 <free+0x114>
+  } else
+    p->s.ptr = bp;
+ 94e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 952:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+ 956:	48 89 10             	mov    %rdx,(%rax)
+  freep = p;
+ 959:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 95d:	48 89 05 2c 04 00 00 	mov    %rax,0x42c(%rip)        # d90 <freep>
+}
+ 964:	90                   	nop
+ 965:	5d                   	pop    %rbp
+ 966:	c3                   	ret
+
+0000000000000967 <morecore>:
+
+static Header *morecore(uint nu) {
+ 967:	55                   	push   %rbp
+ 968:	48 89 e5             	mov    %rsp,%rbp
+ 96b:	48 83 ec 20          	sub    $0x20,%rsp
+ 96f:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  char *p;
+  Header *hp;
+
+  if (nu < 4096)
+ 972:	81 7d ec ff 0f 00 00 	cmpl   $0xfff,-0x14(%rbp)
+ 979:	77 07                	ja     982 <morecore+0x1b>
+    nu = 4096;
+ 97b:	c7 45 ec 00 10 00 00 	movl   $0x1000,-0x14(%rbp)
+  p = sbrk(nu * sizeof(Header));
+ 982:	8b 45 ec             	mov    -0x14(%rbp),%eax
+ 985:	c1 e0 04             	shl    $0x4,%eax
+ 988:	89 c7                	mov    %eax,%edi
+ 98a:	e8 7e fe ff ff       	call   80d <sbrk>
+ 98f:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (p == (char *)-1)
+ 993:	48 83 7d f8 ff       	cmpq   $0xffffffffffffffff,-0x8(%rbp)
+ 998:	75 07                	jne    9a1 <morecore+0x3a>
+    return 0;
+ 99a:	b8 00 00 00 00       	mov    $0x0,%eax
+ 99f:	eb 29                	jmp    9ca <morecore+0x63>
+  hp = (Header *)p;
+ 9a1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 9a5:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  hp->s.size = nu;
+ 9a9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ 9ad:	8b 55 ec             	mov    -0x14(%rbp),%edx
+ 9b0:	89 50 08             	mov    %edx,0x8(%rax)
+  free((void *)(hp + 1));
+ 9b3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ 9b7:	48 83 c0 10          	add    $0x10,%rax
+ 9bb:	48 89 c7             	mov    %rax,%rdi
+ 9be:	e8 82 fe ff ff       	call   845 <free>
+  return freep;
+ 9c3:	48 8b 05 c6 03 00 00 	mov    0x3c6(%rip),%rax        # d90 <freep>
+}
+ 9ca:	c9                   	leave
+ 9cb:	c3                   	ret
+
+00000000000009cc <malloc>:
+
+void *malloc(uint nbytes) {
+ 9cc:	55                   	push   %rbp
+ 9cd:	48 89 e5             	mov    %rsp,%rbp
+ 9d0:	48 83 ec 30          	sub    $0x30,%rsp
+ 9d4:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1) / sizeof(Header) + 1;
+ 9d7:	8b 45 dc             	mov    -0x24(%rbp),%eax
+ 9da:	48 83 c0 0f          	add    $0xf,%rax
+ 9de:	48 c1 e8 04          	shr    $0x4,%rax
+ 9e2:	83 c0 01             	add    $0x1,%eax
+ 9e5:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  if ((prevp = freep) == 0) {
+ 9e8:	48 8b 05 a1 03 00 00 	mov    0x3a1(%rip),%rax        # d90 <freep>
+ 9ef:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+ 9f3:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+ 9f8:	75 2e                	jne    a28 <malloc+0x5c>
+    base.s.ptr = freep = prevp = &base;
+ 9fa:	48 8d 05 7f 03 00 00 	lea    0x37f(%rip),%rax        # d80 <base>
+ a01:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+ a05:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ a09:	48 89 05 80 03 00 00 	mov    %rax,0x380(%rip)        # d90 <freep>
+ a10:	48 8b 05 79 03 00 00 	mov    0x379(%rip),%rax        # d90 <freep>
+ a17:	48 89 05 62 03 00 00 	mov    %rax,0x362(%rip)        # d80 <base>
+    base.s.size = 0;
+ a1e:	c7 05 60 03 00 00 00 	movl   $0x0,0x360(%rip)        # d88 <base+0x8>
+ a25:	00 00 00 
+  }
+  for (p = prevp->s.ptr;; prevp = p, p = p->s.ptr) {
+ a28:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ a2c:	48 8b 00             	mov    (%rax),%rax
+ a2f:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    if (p->s.size >= nunits) {
+ a33:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ a37:	8b 40 08             	mov    0x8(%rax),%eax
+ a3a:	3b 45 ec             	cmp    -0x14(%rbp),%eax
+ a3d:	72 5f                	jb     a9e <malloc+0xd2>
+      if (p->s.size == nunits)
+ a3f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ a43:	8b 40 08             	mov    0x8(%rax),%eax
+ a46:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+ a49:	75 10                	jne    a5b <malloc+0x8f>
+        prevp->s.ptr = p->s.ptr;
+ a4b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ a4f:	48 8b 10             	mov    (%rax),%rdx
+ a52:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ a56:	48 89 10             	mov    %rdx,(%rax)
+ a59:	eb 2e                	jmp    a89 <malloc+0xbd>
+      else {
+        p->s.size -= nunits;
+ a5b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ a5f:	8b 40 08             	mov    0x8(%rax),%eax
+ a62:	2b 45 ec             	sub    -0x14(%rbp),%eax
+ a65:	89 c2                	mov    %eax,%edx
+ a67:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ a6b:	89 50 08             	mov    %edx,0x8(%rax)
+        p += p->s.size;
+ a6e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ a72:	8b 40 08             	mov    0x8(%rax),%eax
+ a75:	89 c0                	mov    %eax,%eax
+ a77:	48 c1 e0 04          	shl    $0x4,%rax
+ a7b:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+        p->s.size = nunits;
+ a7f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ a83:	8b 55 ec             	mov    -0x14(%rbp),%edx
+ a86:	89 50 08             	mov    %edx,0x8(%rax)
+      }
+      freep = prevp;
+ a89:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ a8d:	48 89 05 fc 02 00 00 	mov    %rax,0x2fc(%rip)        # d90 <freep>
+      return (void *)(p + 1);
+ a94:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ a98:	48 83 c0 10          	add    $0x10,%rax
+ a9c:	eb 41                	jmp    adf <malloc+0x113>
+    }
+    if (p == freep)
+ a9e:	48 8b 05 eb 02 00 00 	mov    0x2eb(%rip),%rax        # d90 <freep>
+ aa5:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+ aa9:	75 1c                	jne    ac7 <malloc+0xfb>
+      if ((p = morecore(nunits)) == 0)
+ aab:	8b 45 ec             	mov    -0x14(%rbp),%eax
+ aae:	89 c7                	mov    %eax,%edi
+ ab0:	e8 b2 fe ff ff       	call   967 <morecore>
+ ab5:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+ ab9:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+ abe:	75 07                	jne    ac7 <malloc+0xfb>
+        return 0;
+ ac0:	b8 00 00 00 00       	mov    $0x0,%eax
+ ac5:	eb 18                	jmp    adf <malloc+0x113>
+  for (p = prevp->s.ptr;; prevp = p, p = p->s.ptr) {
+ ac7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ acb:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+ acf:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ ad3:	48 8b 00             	mov    (%rax),%rax
+ ad6:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    if (p->s.size >= nunits) {
+ ada:	e9 54 ff ff ff       	jmp    a33 <malloc+0x67>
+  }
+ adf:	c9                   	leave
+ ae0:	c3                   	ret
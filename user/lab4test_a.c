@@ -143,6 +143,78 @@ void filecreation(void) {
 }
 
 
+// Creates many files one after another, so their creations commit
+// in separate log transactions and grow the inode file and the root
+// directory. Checks each file, then deletes them all.
+void manyfiles(void) {
+  char name[4];
+  int fd, i;
+  printf(1, "manyfiles...\n");
+
+  name[0] = 'm';
+  name[1] = 'f';
+  name[3] = 0;
+  for (i = 0; i < 26; i++) {
+    name[2] = 'a' + i;
+    if ((fd = open(name, O_CREATE|O_RDWR)) < 0)
+      error("create '%s' failed", name);
+    buf[0] = i;
+    if (write(fd, buf, 1) != 1)
+      error("write to '%s' failed", name);
+    close(fd);
+  }
+
+  for (i = 0; i < 26; i++) {
+    name[2] = 'a' + i;
+    if ((fd = open(name, O_RDONLY)) < 0)
+      error("open '%s' after creation failed", name);
+    buf[0] = -1;
+    if (read(fd, buf, 1) != 1 || buf[0] != i)
+      error("'%s' has the wrong contents", name);
+    close(fd);
+    if (unlink(name) != 0)
+      error("unlink '%s' failed", name);
+  }
+
+  printf(1, "manyfiles ok\n");
+}
+
+// Writes a file and flushes it with fsync and sync.
+// Checks the data is still there and that fsync rejects a closed fd.
+void syncfile(void) {
+  int fd, i;
+  printf(1, "syncfile...\n");
+
+  if ((fd = open("sync.txt", O_CREATE|O_RDWR)) < 0)
+    error("create 'sync.txt' failed");
+  for (i = 0; i < 2000; i++)
+    buf[i] = 'a' + i % 26;
+  if (write(fd, buf, 2000) != 2000)
+    error("write to 'sync.txt' failed");
+  if (fsync(fd) != 0)
+    error("fsync of 'sync.txt' failed");
+  if (sync() != 0)
+    error("sync failed");
+  close(fd);
+
+  if (fsync(fd) != -1)
+    error("fsync of a closed fd succeeded");
+
+  if ((fd = open("sync.txt", O_RDONLY)) < 0)
+    error("open 'sync.txt' after sync failed");
+  memset(buf, 0, 2000);
+  if (read(fd, buf, 2000) != 2000)
+    error("read of 'sync.txt' failed");
+  for (i = 0; i < 2000; i++)
+    if (buf[i] != 'a' + i % 26)
+      error("'sync.txt' byte %d is wrong after sync", i);
+  close(fd);
+  if (unlink("sync.txt") != 0)
+    error("unlink 'sync.txt' failed");
+
+  printf(1, "syncfile ok\n");
+}
+
 // Creates a file, writes and reads data.
 // Data is written and read by 500 bytes to try
 // and catch errors in writing.
@@ -358,6 +430,8 @@ int main(int argc, char *argv[]) {
   overwrite();
   append();
   filecreation();
+  manyfiles();
+  syncfile();
   onefile();
   fourfiles();
   simpledelete();
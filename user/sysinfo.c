@@ -13,6 +13,10 @@ int main(int argc, char *argv[]) {
   printf(1, "free_pages = %d\n", info.free_pages);
   printf(1, "num_page_faults = %d\n", info.num_page_faults);
   printf(1, "num_disk_reads = %d\n", info.num_disk_reads);
+  printf(1, "num_io_requests = %d\n", info.num_io_requests);
+  printf(1, "num_io_merges = %d\n", info.num_io_merges);
+  printf(1, "io_queue_depth = %d\n", info.io_queue_depth);
+  printf(1, "max_io_queue_depth = %d\n", info.max_io_queue_depth);
 
   exit();
 }